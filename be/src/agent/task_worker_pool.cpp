@@ -255,7 +255,19 @@ void TaskWorkerPool::submit_task(const TAgentTaskRequest& task) {
         size_t task_count_in_queue = 0;
         {
             std::lock_guard<std::mutex> worker_thread_lock(_worker_thread_lock);
-            _tasks.push_back(task);
+            if (_merge_queued_task(task)) {
+                LOG_INFO("merge task into a queued one")
+                        .tag("type", type_str)
+                        .tag("signature", signature);
+                return;
+            }
+            // The high priority tasks, e.g. the clones of the tablets missing replicas, are
+            // not delayed by the normal ones queued before them.
+            if (task.__isset.priority && task.priority == TPriority::HIGH) {
+                _tasks.push_front(task);
+            } else {
+                _tasks.push_back(task);
+            }
             task_count_in_queue = _tasks.size();
             _worker_thread_condition_variable.notify_one();
         }
@@ -268,6 +280,35 @@ void TaskWorkerPool::submit_task(const TAgentTaskRequest& task) {
     }
 }
 
+bool TaskWorkerPool::_merge_queued_task(const TAgentTaskRequest& task) {
+    // The FE may send a task of a tablet again with a new signature before the BE reports the
+    // queued one, doing both of them is a waste of the worker.
+    if (task.signature == -1) {
+        return false;
+    }
+    std::function<bool(const TAgentTaskRequest&)> same_request;
+    if (task.task_type == TTaskType::CLONE && task.__isset.clone_req) {
+        same_request = [&task](const TAgentTaskRequest& queued) {
+            return queued.__isset.clone_req && queued.clone_req == task.clone_req;
+        };
+    } else if (task.task_type == TTaskType::ALTER && task.__isset.alter_tablet_req_v2) {
+        same_request = [&task](const TAgentTaskRequest& queued) {
+            return queued.__isset.alter_tablet_req_v2 &&
+                   queued.alter_tablet_req_v2 == task.alter_tablet_req_v2;
+        };
+    } else {
+        return false;
+    }
+    for (const auto& queued : _tasks) {
+        if (queued.task_type == task.task_type && queued.signature != -1 &&
+            queued.signature != task.signature && same_request(queued)) {
+            _merged_signatures[queued.signature].push_back(task.signature);
+            return true;
+        }
+    }
+    return false;
+}
+
 void TaskWorkerPool::notify_thread() {
     _worker_thread_condition_variable.notify_one();
     VLOG_CRITICAL << "notify task worker pool: " << _name;
@@ -288,11 +329,23 @@ bool TaskWorkerPool::_register_task_info(const TTaskType::type task_type, int64_
 }
 
 void TaskWorkerPool::_remove_task_info(const TTaskType::type task_type, int64_t signature) {
+    std::vector<int64_t> merged_signatures;
+    {
+        std::lock_guard<std::mutex> worker_thread_lock(_worker_thread_lock);
+        auto it = _merged_signatures.find(signature);
+        if (it != _merged_signatures.end()) {
+            merged_signatures.swap(it->second);
+            _merged_signatures.erase(it);
+        }
+    }
     size_t queue_size;
     {
         std::lock_guard<std::mutex> task_signatures_lock(_s_task_signatures_lock);
         std::set<int64_t>& signature_set = _s_task_signatures[task_type];
         signature_set.erase(signature);
+        for (int64_t merged_signature : merged_signatures) {
+            signature_set.erase(merged_signature);
+        }
         queue_size = signature_set.size();
     }
 
@@ -320,7 +373,24 @@ void TaskWorkerPool::_finish_task(const TFinishTaskRequest& finish_task_request)
                     .error(result.status);
             try_time += 1;
         }
-        sleep(config::sleep_one_second);
+        if (try_time < TASK_FINISH_MAX_RETRY) {
+            sleep(config::sleep_one_second);
+        }
+    }
+
+    // The tasks merged into this one are finished with the same result.
+    std::vector<int64_t> merged_signatures;
+    {
+        std::lock_guard<std::mutex> worker_thread_lock(_worker_thread_lock);
+        auto it = _merged_signatures.find(finish_task_request.signature);
+        if (it != _merged_signatures.end()) {
+            merged_signatures = it->second;
+        }
+    }
+    for (int64_t merged_signature : merged_signatures) {
+        TFinishTaskRequest merged_request = finish_task_request;
+        merged_request.__set_signature(merged_signature);
+        _finish_task(merged_request);
     }
 }
 
@@ -717,7 +787,8 @@ void TaskWorkerPool::_upload_worker_thread_callback() {
                                                        : TStorageBackendType::type::BROKER,
                 upload_request.__isset.location ? upload_request.location : "");
         if (status.ok()) {
-            status = loader->upload(upload_request.src_dest_map, &tablet_files);
+            status = loader->upload(upload_request.src_dest_map, upload_request.src_base_map,
+                                    &tablet_files);
         }
 
         if (!status.ok()) {
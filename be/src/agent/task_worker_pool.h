@@ -182,6 +182,9 @@ protected:
     bool _register_task_info(const TTaskType::type task_type, int64_t signature);
     void _remove_task_info(const TTaskType::type task_type, int64_t signature);
     void _finish_task(const TFinishTaskRequest& finish_task_request);
+    // Returns true if a queued task of the same request is found, then the task is finished
+    // along with it. Must be called with _worker_thread_lock held.
+    bool _merge_queued_task(const TAgentTaskRequest& task);
 
     void _alter_inverted_index_worker_thread_callback();
     void _check_consistency_worker_thread_callback();
@@ -233,6 +236,9 @@ protected:
     std::unique_ptr<ThreadPool> _thread_pool;
     // Only meaningful when _thread_model is MULTI_THREADS
     std::deque<TAgentTaskRequest> _tasks;
+    // The signatures of the tasks merged into a queued task, by the signature of the queued task.
+    // Protected by _worker_thread_lock.
+    std::map<int64_t, std::vector<int64_t>> _merged_signatures;
     // Only meaningful when _thread_model is SINGLE_THREAD
     std::atomic<bool> _is_doing_work;
 
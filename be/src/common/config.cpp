@@ -97,6 +97,9 @@ DEFINE_Double(soft_mem_limit_frac, "0.9");
 // memory greater than 16 GB.
 DEFINE_mInt64(mmap_threshold, "134217728"); // bytes
 
+DEFINE_Bool(enable_huge_page_alloc, "false");
+DEFINE_Int64(huge_page_alloc_threshold, "4194304"); // bytes
+
 // When hash table capacity is greater than 2^double_grow_degree(default 2G), grow when 75% of the capacity is satisfied.
 // Increase can reduce the number of hash table resize, but may waste more memory.
 DEFINE_mInt32(hash_table_double_grow_degree, "31");
@@ -108,6 +111,15 @@ DEFINE_mInt32(double_resize_threshold, "23");
 // There are fewer duplicate keys, reducing the number of resize hash tables
 // There are many duplicate keys, and the hash table filled bucket is far less than the hash table build bucket.
 DEFINE_mInt64(hash_table_pre_expanse_max_rows, "65535");
+DEFINE_mInt32(hash_join_parallel_build_threads, "8");
+DEFINE_mInt64(hash_join_parallel_build_min_rows, "1048576");
+DEFINE_mBool(enable_join_swiss_hash_table, "false");
+DEFINE_mBool(enable_nested_loop_range_join_index, "true");
+DEFINE_mBool(enable_nested_loop_join_tiling, "true");
+DEFINE_mInt64(nested_loop_join_tile_bytes, "1048576");
+DEFINE_mInt32(parallel_sort_merge_threads, "8");
+DEFINE_mInt64(parallel_sort_merge_min_rows, "4194304");
+DEFINE_mBool(enable_normalized_key_sort, "true");
 
 // The maximum low water mark of the system `/proc/meminfo/MemAvailable`, Unit byte, default 1.6G,
 // actual low water mark=min(1.6G, MemTotal * 10%), avoid wasting too much memory on machines
@@ -120,12 +132,18 @@ DEFINE_Int64(max_sys_mem_available_low_water_mark_bytes, "1717986918");
 DEFINE_mString(process_minor_gc_size, "10%");
 DEFINE_mString(process_full_gc_size, "20%");
 
+DEFINE_mBool(enable_memory_governor, "true");
+DEFINE_mInt32(memory_governor_high_watermark_percent, "85");
+DEFINE_mInt64(memory_governor_max_free_bytes_per_round, "67108864");
+
 // If true, when the process does not exceed the soft mem limit, the query memory will not be limited;
 // when the process memory exceeds the soft mem limit, the query with the largest ratio between the currently
 // used memory and the exec_mem_limit will be canceled.
 // If false, cancel query when the memory used exceeds exec_mem_limit, same as before.
 DEFINE_mBool(enable_query_memory_overcommit, "true");
 
+DEFINE_mInt32(workload_group_memory_soft_limit_percent, "80");
+
 // The maximum time a thread waits for a full GC. Currently only query will wait for full gc.
 DEFINE_mInt32(thread_wait_gc_max_milliseconds, "1000");
 
@@ -147,6 +165,8 @@ DEFINE_Int32(publish_version_worker_count, "8");
 DEFINE_Int32(tablet_publish_txn_max_thread, "32");
 // the count of thread to calc delete bitmap
 DEFINE_Int32(calc_delete_bitmap_max_thread, "32");
+DEFINE_Int32(schema_change_sort_max_thread, "8");
+DEFINE_mInt32(schema_change_sort_min_rows_per_thread, "65536");
 // the count of thread to clear transaction task
 DEFINE_Int32(clear_transaction_task_worker_count, "1");
 // the count of thread to delete
@@ -157,12 +177,17 @@ DEFINE_Int32(alter_tablet_worker_count, "3");
 DEFINE_Int32(alter_inverted_index_worker_count, "3");
 // the count of thread to clone
 DEFINE_Int32(clone_worker_count, "3");
+DEFINE_Int32(clone_download_max_thread, "16");
+DEFINE_mInt32(clone_download_concurrency_per_task, "4");
+DEFINE_mInt64(clone_download_range_bytes, "268435456");
+DEFINE_mBool(clone_verify_all_checksums, "false");
 // the count of thread to clone
 DEFINE_Int32(storage_medium_migrate_count, "1");
 // the count of thread to check consistency
 DEFINE_Int32(check_consistency_worker_count, "1");
 // the count of thread to upload
 DEFINE_Int32(upload_worker_count, "1");
+DEFINE_Int32(snapshot_upload_max_thread, "8");
 // the count of thread to download
 DEFINE_Int32(download_worker_count, "1");
 // the count of thread to make snapshot
@@ -221,8 +246,17 @@ DEFINE_mInt64(doris_blocking_priority_queue_wait_timeout_ms, "500");
 // number of scanner thread pool size for olap table
 // and the min thread num of remote scanner thread pool
 DEFINE_Int32(doris_scanner_thread_pool_thread_num, "48");
+DEFINE_Int32(doris_scanner_thread_pool_reserved_thread_num_per_disk, "0");
 // max number of remote scanner thread pool size
 DEFINE_Int32(doris_max_remote_scanner_thread_pool_thread_num, "512");
+DEFINE_mBool(enable_file_scan_range_stealing, "true");
+DEFINE_mInt64(local_disk_read_bytes_per_second, "0");
+DEFINE_mInt64(remote_read_bytes_per_second, "0");
+DEFINE_mInt64(query_read_bytes_per_second, "0");
+DEFINE_mInt32(compaction_io_weight, "256");
+DEFINE_mInt32(clone_io_weight, "256");
+DEFINE_mInt32(query_io_weight, "1024");
+DEFINE_mInt32(local_io_os_page_cache_latency_us, "50");
 // number of olap scanner thread pool queue size
 DEFINE_Int32(doris_scanner_thread_pool_queue_size, "102400");
 // default thrift client connect timeout(in seconds)
@@ -234,6 +268,7 @@ DEFINE_mInt64(thrift_client_retry_interval_ms, "1000");
 DEFINE_mInt32(doris_scan_range_row_count, "524288");
 // max bytes number for single scan range, used in segmentv2
 DEFINE_mInt32(doris_scan_range_max_mb, "1024");
+DEFINE_mInt64(doris_scan_split_min_rows, "1048576");
 // max bytes number for single scan block, used in segmentv2
 DEFINE_mInt32(doris_scan_block_max_mb, "67108864");
 // size of scanner queue between scanner thread and compute thread
@@ -242,6 +277,7 @@ DEFINE_mInt32(doris_scanner_queue_size, "1024");
 DEFINE_mInt32(doris_scanner_row_num, "16384");
 // single read execute fragment row bytes
 DEFINE_mInt32(doris_scanner_row_bytes, "10485760");
+DEFINE_mInt32(scanner_concurrency_adjust_interval_ms, "100");
 // number of max scan keys
 DEFINE_mInt32(doris_max_scan_key_num, "48");
 // the max number of push down values of a single column.
@@ -290,12 +326,33 @@ DEFINE_mInt32(trash_file_expire_time_sec, "259200");
 DEFINE_Int32(min_file_descriptor_number, "60000");
 DEFINE_Int64(index_stream_cache_capacity, "10737418240");
 DEFINE_String(row_cache_mem_limit, "20%");
+DEFINE_String(row_cache_admission_policy, "lru");
+DEFINE_mBool(enable_runtime_filter_cache, "false");
+DEFINE_Int64(runtime_filter_cache_capacity, "1073741824");
+DEFINE_mBool(enable_merged_agg_block_cache, "false");
+DEFINE_String(merged_agg_block_cache_limit, "5%");
+DEFINE_mBool(enable_descriptor_tbl_cache, "false");
+DEFINE_Int64(descriptor_tbl_cache_capacity, "268435456");
 
 // Cache for storage page size
 DEFINE_String(storage_page_cache_limit, "20%");
 // Shard size for page cache, the value must be power of two.
 // It's recommended to set it to a value close to the number of BE cores in order to reduce lock contentions.
 DEFINE_Int32(storage_page_cache_shard_size, "16");
+DEFINE_String(storage_page_cache_admission_policy, "lru");
+DEFINE_String(segment_cache_admission_policy, "lru");
+DEFINE_mInt32(column_iterator_pool_size, "2");
+
+DEFINE_mBool(enable_segment_page_prefetch, "false");
+DEFINE_mInt32(segment_page_prefetch_max_inflight, "8");
+DEFINE_mInt64(segment_page_prefetch_merge_gap_bytes, "65536");
+DEFINE_mInt64(segment_page_prefetch_max_merged_bytes, "8388608");
+DEFINE_mInt32(segment_footer_read_bytes, "65536");
+DEFINE_mInt64(segment_index_prefetch_max_bytes, "4194304");
+DEFINE_mBool(enable_local_segment_page_readahead, "false");
+DEFINE_mBool(local_compaction_read_drop_page_cache, "false");
+DEFINE_mBool(enable_late_runtime_filter_index_pruning, "true");
+DEFINE_mInt64(primary_key_fingerprint_index_memory_limit_mb, "0");
 // Percentage for index page cache
 // all storage page cache will be divided into data_page_cache and index_page_cache
 DEFINE_Int32(index_page_cache_percentage, "10");
@@ -307,6 +364,8 @@ DEFINE_Bool(disable_storage_row_cache, "true");
 // Cache for mow primary key storage page size
 DEFINE_String(pk_storage_page_cache_limit, "10%");
 
+DEFINE_String(bloom_filter_page_cache_limit, "2%");
+
 DEFINE_Bool(enable_low_cardinality_optimize, "true");
 DEFINE_Bool(enable_low_cardinality_cache_code, "true");
 
@@ -323,6 +382,7 @@ DEFINE_mBool(enable_ordered_data_compaction, "true");
 DEFINE_mInt32(vertical_compaction_num_columns_per_group, "5");
 // In vertical compaction, max memory usage for row_source_buffer
 DEFINE_Int32(vertical_compaction_max_row_source_memory_mb, "200");
+DEFINE_mInt32(vertical_compaction_max_parallel_groups, "4");
 // In vertical compaction, max dest segment file size
 DEFINE_mInt64(vertical_compaction_max_segment_size, "268435456");
 
@@ -389,11 +449,18 @@ DEFINE_Validator(compaction_task_num_per_fast_disk,
 // How many rounds of cumulative compaction for each round of base compaction when compaction tasks generation.
 DEFINE_mInt32(cumulative_compaction_rounds_for_each_base_compaction_round, "9");
 
+DEFINE_mBool(enable_compaction_priority_schedule, "true");
+DEFINE_mInt32(compaction_hot_tablet_window_sec, "300");
+DEFINE_mInt32(compaction_urgent_version_count_percent, "80");
+DEFINE_mInt32(compaction_disk_io_util_limit_percent, "0");
+
 // Threshold to logging compaction trace, in seconds.
 DEFINE_mInt32(base_compaction_trace_threshold, "60");
 DEFINE_mInt32(cumulative_compaction_trace_threshold, "10");
 DEFINE_mBool(disable_compaction_trace_log, "true");
 
+DEFINE_mInt32(compaction_history_size, "10000");
+
 // Interval to picking rowset to compact, in seconds
 DEFINE_mInt64(pick_rowset_to_compact_interval_sec, "86400");
 
@@ -475,6 +542,16 @@ DEFINE_mInt32(stream_load_record_batch_size, "50");
 DEFINE_Int32(stream_load_record_expire_time_secs, "28800");
 // time interval to clean expired stream load records
 DEFINE_mInt64(clean_stream_load_record_interval_secs, "1800");
+DEFINE_mBool(enable_stream_load_zero_copy, "true");
+DEFINE_mInt32(stream_load_parse_parallelism, "4");
+DEFINE_mInt64(stream_load_parallel_parse_min_bytes, "134217728");
+
+DEFINE_String(group_commit_wal_dir, "${DORIS_HOME}/wal");
+DEFINE_mInt32(group_commit_interval_ms, "1000");
+DEFINE_mInt64(group_commit_max_load_bytes, "1048576");
+DEFINE_mInt64(group_commit_max_batch_bytes, "67108864");
+DEFINE_Int32(group_commit_thread_num, "4");
+DEFINE_mInt32(group_commit_max_retries, "3");
 
 // OlapTableSink sender's send interval, should be less than the real response time of a tablet writer rpc.
 // You may need to lower the speed when the sink receiver bes are too busy.
@@ -527,6 +604,16 @@ DEFINE_Bool(enable_quadratic_probing, "false");
 DEFINE_String(pprof_profile_dir, "${DORIS_HOME}/log");
 // for jeprofile in jemalloc
 DEFINE_mString(jeprofile_dir, "${DORIS_HOME}/log");
+DEFINE_Bool(enable_cpu_sampler, "false");
+DEFINE_Int32(cpu_sampler_frequency, "99");
+DEFINE_Int32(cpu_sampler_retention_minutes, "1440");
+DEFINE_Int32(cpu_sampler_max_stacks_per_minute, "65536");
+
+DEFINE_mBool(enable_lock_profiling, "false");
+DEFINE_mInt32(lock_profiling_sample_every, "100");
+
+DEFINE_mString(rpc_capture_dir, "${DORIS_HOME}/log/rpc_capture");
+DEFINE_mInt64(rpc_capture_max_bytes, "10737418240");
 
 // to forward compatibility, will be removed later
 DEFINE_mBool(enable_token_check, "true");
@@ -577,6 +664,8 @@ DEFINE_Int32(load_process_max_memory_limit_percent, "50"); // 50%
 // might avoid all load jobs hang at the same time.
 DEFINE_Int32(load_process_soft_mem_limit_percent, "80");
 
+DEFINE_mInt32(load_process_proactive_flush_mem_limit_percent, "60");
+
 // result buffer cancelled time (unit: second)
 DEFINE_mInt32(result_buffer_cancelled_interval_time, "300");
 
@@ -585,6 +674,11 @@ DEFINE_mInt32(priority_queue_remaining_tasks_increased_frequency, "512");
 
 // sync tablet_meta when modifying meta
 DEFINE_mBool(sync_tablet_meta, "false");
+DEFINE_mBool(enable_lazy_schema_change, "true");
+DEFINE_mBool(enable_meta_group_write, "true");
+DEFINE_mInt32(meta_group_write_max_entries, "1024");
+
+DEFINE_mBool(enable_segment_footer_meta_cache, "true");
 
 // default thrift rpc timeout ms
 DEFINE_mInt32(thrift_rpc_timeout_ms, "10000");
@@ -616,6 +710,8 @@ DEFINE_String(es_scroll_keepalive, "5m");
 // HTTP connection timeout for es
 DEFINE_mInt32(es_http_timeout_ms, "5000");
 
+DEFINE_mInt32(es_scroll_slices_per_shard, "1");
+
 // the max client cache number per each host
 // There are variety of client cache in BE, but currently we use the
 // same cache size configuration.
@@ -656,11 +752,15 @@ DEFINE_String(default_rowset_type, "BETA");
 DEFINE_Int64(brpc_max_body_size, "3147483648");
 // Max unwritten bytes in each socket, if the limit is reached, Socket.Write fails with EOVERCROWDED
 DEFINE_Int64(brpc_socket_max_unwritten_bytes, "1073741824");
+DEFINE_String(brpc_connection_type, "single");
+DEFINE_Int32(brpc_num_channels_per_host, "1");
 // TODO(zxy): expect to be true in v1.3
 // Whether to embed the ProtoBuf Request serialized string together with Tuple/Block data into
 // Controller Attachment and send it through http brpc when the length of the Tuple/Block data
 // is greater than 1.8G. This is to avoid the error of Request length overflow (2G).
 DEFINE_mBool(transfer_large_data_by_brpc, "false");
+DEFINE_mBool(exchange_transfer_block_by_attachment, "true");
+DEFINE_mBool(enable_broadcast_exchange_per_host, "false");
 
 // max number of txns for every txn_partition_map in txn manager
 // this is a self protection to avoid too many txns saving in manager
@@ -681,6 +781,8 @@ DEFINE_Int32(txn_shard_size, "1024");
 // Whether to continue to start be when load tablet from header failed.
 DEFINE_Bool(ignore_load_tablet_failure, "false");
 
+DEFINE_Int32(load_data_dir_thread_num, "8");
+
 // Whether to continue to start be when load tablet from header failed.
 DEFINE_mBool(ignore_rowset_stale_unconsistent_delete, "false");
 
@@ -723,6 +825,9 @@ DEFINE_mInt32(remote_storage_read_buffer_mb, "16");
 // Decreasing this value will increase the frequency of consume/release.
 // Increasing this value will cause MemTracker statistics to be inaccurate.
 DEFINE_mInt32(mem_tracker_consume_min_size_bytes, "1048576");
+DEFINE_mInt64(mem_tracker_core_local_slack_bytes, "4194304");
+DEFINE_mBool(enable_query_memory_profile, "false");
+DEFINE_mInt64(mem_alloc_profile_sample_bytes, "524288");
 
 // The version information of the tablet will be stored in the memory
 // in an adjacency graph data structure.
@@ -759,6 +864,18 @@ DEFINE_Int64(download_cache_buffer_size, "10485760");
 // When doing compaction, each segment may take at least 1MB buffer.
 DEFINE_mInt32(max_segment_num_per_rowset, "200");
 DEFINE_mInt32(segment_compression_threshold_kb, "256");
+DEFINE_mInt32(segment_ngram_bf_max_column_kb, "1024");
+DEFINE_mInt32(segment_ngram_bf_size, "4096");
+DEFINE_Validator(segment_ngram_bf_size,
+                 [](const int config) -> bool { return config > 0 && config % 8 == 0; });
+DEFINE_mInt32(segment_ngram_bf_gram_size, "3");
+DEFINE_Validator(segment_ngram_bf_gram_size,
+                 [](const int config) -> bool { return config > 0 && config <= 255; });
+DEFINE_mInt32(segment_zstd_dict_size_kb, "0");
+DEFINE_mInt32(segment_zstd_dict_sample_kb, "1024");
+
+DEFINE_mInt32(parquet_writer_encode_threads, "1");
+DEFINE_mInt64(parquet_writer_row_group_max_bytes, "67108864");
 
 // The connection timeout when connecting to external table such as odbc table.
 DEFINE_mInt32(external_table_connect_timeout_sec, "30");
@@ -781,11 +898,14 @@ DEFINE_String(kafka_broker_version_fallback, "0.10.0");
 // If you meet the error describe in https://github.com/edenhill/librdkafka/issues/3608
 // Change this size to 0 to fix it temporarily.
 DEFINE_Int32(routine_load_consumer_pool_size, "10");
+DEFINE_Int32(routine_load_consume_batch_size, "100");
 
 // Used in single-stream-multi-table load. When receive a batch of messages from kafka,
 // if the size of batch is more than this threshold, we will request plans for all related tables.
 DEFINE_Int32(multi_table_batch_plan_threshold, "200");
 
+DEFINE_mInt32(multi_table_plan_cache_expire_sec, "1800");
+
 // When the timeout of a load task is less than this threshold,
 // Doris treats it as a high priority task.
 // high priority tasks use a separate thread pool for flush and do not block rpc by memory cleanup logic.
@@ -859,6 +979,10 @@ DEFINE_mInt32(parquet_rowgroup_max_buffer_mb, "128");
 // Max buffer size for parquet chunk column
 DEFINE_mInt32(parquet_column_max_buffer_mb, "8");
 DEFINE_mDouble(max_amplified_read_ratio, "0.8");
+DEFINE_mBool(enable_parquet_row_group_prefetch, "false");
+DEFINE_mInt32(parquet_row_group_prefetch_num, "2");
+DEFINE_mInt32(parquet_row_group_prefetch_budget_mb, "128");
+DEFINE_mInt32(parquet_row_group_prefetch_max_inflight, "4");
 
 // OrcReader
 DEFINE_mInt32(orc_natural_read_size_mb, "8");
@@ -895,6 +1019,7 @@ DEFINE_Int32(s3_transfer_executor_pool_size, "2");
 
 DEFINE_Bool(enable_time_lut, "true");
 DEFINE_Bool(enable_simdjson_reader, "true");
+DEFINE_mBool(enable_simdjson_batch_reader, "false");
 
 DEFINE_mBool(enable_query_like_bloom_filter, "true");
 // number of s3 scanner thread pool size
@@ -935,7 +1060,24 @@ DEFINE_Bool(enable_java_support, "true");
 DEFINE_Bool(enable_fuzzy_mode, "false");
 
 DEFINE_Int32(pipeline_executor_size, "0");
+DEFINE_Bool(enable_pipeline_numa_affinity, "true");
+DEFINE_mInt32(pipeline_cross_numa_steal_threshold, "2");
+DEFINE_Bool(enable_pipeline_sharded_task_queue, "false");
+DEFINE_Bool(enable_pipeline_task_dependency, "true");
+DEFINE_mInt64(pipeline_task_column_pool_bytes, "16777216");
 DEFINE_mInt16(pipeline_short_query_timeout_s, "20");
+DEFINE_mBool(enable_scan_in_pipeline_task, "false");
+DEFINE_mBool(enable_pipeline_task_tracing, "false");
+DEFINE_Int32(pipeline_task_tracing_buffer_size, "65536");
+DEFINE_mInt32(pipeline_task_scan_time_slice_ms, "20");
+DEFINE_mBool(enable_adaptive_streaming_preagg, "true");
+DEFINE_mInt32(streaming_preagg_sample_block_interval, "16");
+DEFINE_mBool(enable_fused_agg_kernels, "true");
+DEFINE_mBool(enable_common_subexpr_elimination, "true");
+DEFINE_mDouble(early_filter_block_ratio, "0.25");
+DEFINE_mBool(enable_adaptive_conjunct_order, "true");
+DEFINE_mInt32(conjunct_reorder_block_interval, "64");
+DEFINE_mBool(enable_multi_pattern_like, "true");
 
 // Temp config. True to use optimization for bitmap_index apply predicate except leaf node of the and node.
 // Will remove after fully test.
@@ -958,6 +1100,11 @@ DEFINE_Validator(file_cache_min_file_segment_size, [](const int64_t config) -> b
            config <= config::file_cache_max_file_segment_size;
 });
 DEFINE_Bool(clear_file_cache, "false");
+DEFINE_Int32(file_cache_num_shards_per_path, "1");
+DEFINE_Validator(file_cache_num_shards_per_path,
+                 [](const int32_t config) -> bool { return config >= 1 && config <= 256; });
+DEFINE_mInt64(file_cache_warm_up_bytes_per_second, "104857600");
+DEFINE_mBool(enable_file_cache_warm_up_after_clone, "false");
 DEFINE_Bool(enable_file_cache_query_limit, "false");
 
 // inverted index searcher cache
@@ -967,6 +1114,7 @@ DEFINE_mInt32(index_cache_entry_stay_time_after_lookup_s, "3600");
 DEFINE_mInt32(index_cache_entry_no_visit_gc_time_s, "3600");
 // inverted index searcher cache size
 DEFINE_String(inverted_index_searcher_cache_limit, "10%");
+DEFINE_String(inverted_index_searcher_cache_admission_policy, "lru");
 // set `true` to enable insert searcher into cache when write inverted index data
 DEFINE_Bool(enable_write_index_searcher_cache, "true");
 DEFINE_Bool(enable_inverted_index_cache_check_timestamp, "true");
@@ -974,6 +1122,8 @@ DEFINE_Int32(inverted_index_fd_number_limit_percent, "50"); // 50%
 
 // inverted index match bitmap cache size
 DEFINE_String(inverted_index_query_cache_limit, "10%");
+DEFINE_Int32(inverted_index_searcher_open_threads, "8");
+DEFINE_String(inverted_index_term_cache_limit, "2%");
 
 // inverted index
 DEFINE_mDouble(inverted_index_ram_buffer_size, "512");
@@ -984,7 +1134,9 @@ DEFINE_Int32(inverted_index_read_buffer_size, "4096");
 // tree depth for bkd index
 DEFINE_Int32(max_depth_in_bkd_tree, "32");
 // index compaction
-DEFINE_Bool(inverted_index_compaction_enable, "false");
+DEFINE_Bool(inverted_index_compaction_enable, "true");
+DEFINE_mBool(enable_async_inverted_index_build, "false");
+DEFINE_Int32(async_inverted_index_build_thread_num, "1");
 // use num_broadcast_buffer blocks as buffer to do broadcast
 DEFINE_Int32(num_broadcast_buffer, "32");
 // semi-structure configs
@@ -1016,12 +1168,19 @@ DEFINE_mInt32(tablet_path_check_batch_size, "1000");
 
 // Page size of row column, default 4KB
 DEFINE_mInt64(row_column_page_size, "4096");
+DEFINE_mBool(enable_adaptive_numeric_encoding, "false");
 // it must be larger than or equal to 5MB
 DEFINE_mInt32(s3_write_buffer_size, "5242880");
 // the size of the whole s3 buffer pool, which indicates the s3 file writer
 // can at most buffer 50MB data. And the num of multi part upload task is
 // s3_write_buffer_whole_size / s3_write_buffer_size
 DEFINE_mInt32(s3_write_buffer_whole_size, "524288000");
+DEFINE_mInt64(s3_write_max_part_size, "67108864");
+DEFINE_mInt32(s3_write_max_inflight_parts_per_writer, "16");
+DEFINE_mInt32(s3_write_part_hedge_delay_ms, "0");
+DEFINE_Int32(s3_file_upload_thread_num, "64");
+DEFINE_mBool(enable_s3_hedged_read, "false");
+DEFINE_mInt32(s3_hedged_read_min_delay_ms, "50");
 
 //disable shrink memory by default
 DEFINE_Bool(enable_shrink_memory, "false");
@@ -1035,7 +1194,11 @@ DEFINE_Bool(enable_feature_binlog, "false");
 DEFINE_Bool(enable_set_in_bitmap_value, "false");
 
 DEFINE_Int64(max_hdfs_file_handle_cache_num, "20000");
+DEFINE_mInt32(hdfs_hedged_read_threadpool_size, "0");
+DEFINE_mInt32(hdfs_hedged_read_threshold_ms, "500");
+DEFINE_mBool(enable_hdfs_zero_copy_read, "false");
 DEFINE_Int64(max_external_file_meta_cache_num, "20000");
+DEFINE_Int64(max_external_file_meta_cache_bytes, "1073741824");
 
 #ifdef BE_TEST
 // test s3
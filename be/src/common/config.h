@@ -135,6 +135,14 @@ DECLARE_Double(soft_mem_limit_frac);
 // memory greater than 16 GB.
 DECLARE_mInt64(mmap_threshold); // bytes
 
+// Whether to mmap the allocations not smaller than huge_page_alloc_threshold, e.g. of hash
+// tables and large PODArrays, aligned to 2MB and advise them to be backed by transparent
+// huge pages (MADV_HUGEPAGE), which reduces the TLB misses of random access.
+// Requires /sys/kernel/mm/transparent_hugepage/enabled to be "madvise" or "always".
+DECLARE_Bool(enable_huge_page_alloc);
+// bytes, at least 2MB
+DECLARE_Int64(huge_page_alloc_threshold);
+
 // When hash table capacity is greater than 2^double_grow_degree(default 2G), grow when 75% of the capacity is satisfied.
 // Increase can reduce the number of hash table resize, but may waste more memory.
 DECLARE_mInt32(hash_table_double_grow_degree);
@@ -148,6 +156,36 @@ DECLARE_mInt32(double_resize_threshold);
 // There are fewer duplicate keys, reducing the number of resize hash tables
 // There are many duplicate keys, and the hash table filled bucket is far less than the hash table build bucket.
 DECLARE_mInt64(hash_table_pre_expanse_max_rows);
+// The number of threads used to build a hash table shared by the instances of a broadcast join,
+// every thread fills a disjoint set of the sub tables of the partitioned hash table.
+// Values less than 2 disable the parallel build.
+DECLARE_mInt32(hash_join_parallel_build_threads);
+// Build the shared hash table in parallel only when a build block has at least so many rows.
+DECLARE_mInt64(hash_join_parallel_build_min_rows);
+// Use the swiss table for the hash joins on a single int or bigint key without flags,
+// i.e. not the right/full outer, right semi/anti joins and no other join conjuncts.
+DECLARE_mBool(enable_join_swiss_hash_table);
+// Look up the build rows joined with a probe row by the range conjuncts of a nested loop join,
+// e.g. `a.ts between b.start and b.end`, in a sorted or interval index of the build rows.
+// Not used by the joins setting build side flags and the mark joins.
+DECLARE_mBool(enable_nested_loop_range_join_index);
+// Join the inner and cross nested loop joins by tiles: a tile of probe rows is joined with a
+// build block before the next one, and the join conjuncts are evaluated before the joined rows
+// are materialized.
+DECLARE_mBool(enable_nested_loop_join_tiling);
+// The bytes of a probe or build tile, about the size of a L2 cache. Larger build blocks are
+// split into tiles.
+DECLARE_mInt64(nested_loop_join_tile_bytes);
+// The number of threads merging the sorted blocks of a full sort kept in memory, every thread
+// merges the rows between two splitters sampled from the blocks. Values less than 2 disable
+// the parallel merge.
+DECLARE_mInt32(parallel_sort_merge_threads);
+// Merge the sorted blocks in parallel only when there are at least so many rows.
+DECLARE_mInt64(parallel_sort_merge_min_rows);
+// Sort a block by multiple columns with the radix sort of the normalized keys, i.e. the sort
+// columns encoded into byte strings comparable by memcmp, when the leading sort columns are
+// integers, dates, decimals or strings.
+DECLARE_mBool(enable_normalized_key_sort);
 
 // The maximum low water mark of the system `/proc/meminfo/MemAvailable`, Unit byte, default 1.6G,
 // actual low water mark=min(1.6G, MemTotal * 10%), avoid wasting too much memory on machines
@@ -160,12 +198,26 @@ DECLARE_Int64(max_sys_mem_available_low_water_mark_bytes);
 DECLARE_mString(process_minor_gc_size);
 DECLARE_mString(process_full_gc_size);
 
+// If true, the memory gc thread frees the caches gradually, from the least valuable cache by
+// its hit rate and reload cost, when the process memory is above the high watermark, a
+// percentage of the mem limit, see MemoryGovernor. At most
+// memory_governor_max_free_bytes_per_round are freed each memory_maintenance_sleep_time_ms.
+DECLARE_mBool(enable_memory_governor);
+DECLARE_mInt32(memory_governor_high_watermark_percent);
+DECLARE_mInt64(memory_governor_max_free_bytes_per_round);
+
 // If true, when the process does not exceed the soft mem limit, the query memory will not be limited;
 // when the process memory exceeds the soft mem limit, the query with the largest ratio between the currently
 // used memory and the exec_mem_limit will be canceled.
 // If false, cancel query when the memory used exceeds exec_mem_limit, same as before.
 DECLARE_mBool(enable_query_memory_overcommit);
 
+// The soft memory limit of a workload group, as a percentage of its memory_limit. The queries
+// of a group above its soft limit can not reserve more memory, so the spilling operators spill
+// instead of the group growing to its memory_limit. A group that enables memory overcommit
+// can keep reserving beyond it by borrowing the idle memory of the other groups.
+DECLARE_mInt32(workload_group_memory_soft_limit_percent);
+
 // The maximum time a thread waits for a full GC. Currently only query will wait for full gc.
 DECLARE_mInt32(thread_wait_gc_max_milliseconds);
 
@@ -187,6 +239,10 @@ DECLARE_Int32(publish_version_worker_count);
 DECLARE_Int32(tablet_publish_txn_max_thread);
 // the count of thread to calc delete bitmap
 DECLARE_Int32(calc_delete_bitmap_max_thread);
+// the count of thread to sort the blocks of the schema changes with sorting
+DECLARE_Int32(schema_change_sort_max_thread);
+// the min rows sorted by a thread when a schema change sorts its blocks in parallel
+DECLARE_mInt32(schema_change_sort_min_rows_per_thread);
 // the count of thread to clear transaction task
 DECLARE_Int32(clear_transaction_task_worker_count);
 // the count of thread to delete
@@ -197,12 +253,22 @@ DECLARE_Int32(alter_tablet_worker_count);
 DECLARE_Int32(alter_inverted_index_worker_count);
 // the count of thread to clone
 DECLARE_Int32(clone_worker_count);
+// the count of thread to download the files of all the clones, and of one clone
+DECLARE_Int32(clone_download_max_thread);
+DECLARE_mInt32(clone_download_concurrency_per_task);
+// the files of a clone larger than this are downloaded by ranges of this size in parallel
+DECLARE_mInt64(clone_download_range_bytes);
+// whether to verify the md5 of all the files downloaded by a clone, not only the files
+// downloaded by ranges or resumed
+DECLARE_mBool(clone_verify_all_checksums);
 // the count of thread to clone
 DECLARE_Int32(storage_medium_migrate_count);
 // the count of thread to check consistency
 DECLARE_Int32(check_consistency_worker_count);
 // the count of thread to upload
 DECLARE_Int32(upload_worker_count);
+// the count of thread to upload the tablet snapshots of all the upload tasks
+DECLARE_Int32(snapshot_upload_max_thread);
 // the count of thread to download
 DECLARE_Int32(download_worker_count);
 // the count of thread to make snapshot
@@ -261,8 +327,27 @@ DECLARE_mInt64(doris_blocking_priority_queue_wait_timeout_ms);
 // number of scanner thread pool size for olap table
 // and the min thread num of remote scanner thread pool
 DECLARE_Int32(doris_scanner_thread_pool_thread_num);
+// number of the olap scanner threads of each disk that do not run the scanners of other disks
+DECLARE_Int32(doris_scanner_thread_pool_reserved_thread_num_per_disk);
 // max number of remote scanner thread pool size
 DECLARE_Int32(doris_max_remote_scanner_thread_pool_thread_num);
+// whether the file scanners steal the remaining scan ranges of each other
+DECLARE_mBool(enable_file_scan_range_stealing);
+// The read bandwidth limit of each local disk and of all remote storage, 0 means unlimited.
+// When limited, the reads are queued and served by the weight of their IO groups.
+DECLARE_mInt64(local_disk_read_bytes_per_second);
+DECLARE_mInt64(remote_read_bytes_per_second);
+// the read bandwidth limit of each query, 0 means unlimited
+DECLARE_mInt64(query_read_bytes_per_second);
+// The weights of the compaction and the queries without workload group to share the read
+// bandwidth, the weight of a workload group is its cpu share.
+DECLARE_mInt32(compaction_io_weight);
+// the weight of the downloads of the clones to share the bandwidth of the local disks
+DECLARE_mInt32(clone_io_weight);
+DECLARE_mInt32(query_io_weight);
+// The local reads faster than this are accounted as served by the os page cache in the IO
+// tiers of the scan profiles, the slower ones as read from the disk.
+DECLARE_mInt32(local_io_os_page_cache_latency_us);
 // number of olap scanner thread pool queue size
 DECLARE_Int32(doris_scanner_thread_pool_queue_size);
 // default thrift client connect timeout(in seconds)
@@ -274,6 +359,10 @@ DECLARE_mInt64(thrift_client_retry_interval_ms);
 DECLARE_mInt32(doris_scan_range_row_count);
 // max bytes number for single scan range, used in segmentv2
 DECLARE_mInt32(doris_scan_range_max_mb);
+// Split a tablet of the duplicate key or merge-on-write unique key tables which can not be split
+// by key ranges into the scanners by its segments and the row ranges of the segments, each
+// scanner reads at least this number of rows, 0 to disable.
+DECLARE_mInt64(doris_scan_split_min_rows);
 // max bytes number for single scan block, used in segmentv2
 DECLARE_mInt32(doris_scan_block_max_mb);
 // size of scanner queue between scanner thread and compute thread
@@ -282,6 +371,10 @@ DECLARE_mInt32(doris_scanner_queue_size);
 DECLARE_mInt32(doris_scanner_row_num);
 // single read execute fragment row bytes
 DECLARE_mInt32(doris_scanner_row_bytes);
+// The interval to adjust the number of the active scanners of a scan by the fill level of its
+// blocks queue and the consuming rate of the blocks, 0 to always run as many scanners as
+// possible.
+DECLARE_mInt32(scanner_concurrency_adjust_interval_ms);
 // number of max scan keys
 DECLARE_mInt32(doris_max_scan_key_num);
 // the max number of push down values of a single column.
@@ -330,12 +423,63 @@ DECLARE_mInt32(trash_file_expire_time_sec);
 DECLARE_Int32(min_file_descriptor_number);
 DECLARE_Int64(index_stream_cache_capacity);
 DECLARE_String(row_cache_mem_limit);
+// Admission policy of row cache, "lru" or "tinylfu".
+DECLARE_String(row_cache_admission_policy);
+// Whether to reuse the runtime filters published by previous queries with the same build side.
+DECLARE_mBool(enable_runtime_filter_cache);
+DECLARE_Int64(runtime_filter_cache_capacity);
+// Whether to cache the merged rows of the base versions of agg-key tablets, so the queries
+// on them only merge the later versions, see MergedAggBlockCache.
+DECLARE_mBool(enable_merged_agg_block_cache);
+DECLARE_String(merged_agg_block_cache_limit);
+// Whether to share the descriptor tables of the queries with the same descriptor table, so the
+// repeated short queries do not build the descriptors again, see DescriptorTblCache.
+DECLARE_mBool(enable_descriptor_tbl_cache);
+DECLARE_Int64(descriptor_tbl_cache_capacity);
 
 // Cache for storage page size
 DECLARE_String(storage_page_cache_limit);
 // Shard size for page cache, the value must be power of two.
 // It's recommended to set it to a value close to the number of BE cores in order to reduce lock contentions.
 DECLARE_Int32(storage_page_cache_shard_size);
+// Admission policy of page cache, "lru" or "tinylfu". With "tinylfu" a new page is only cached
+// when it is accessed more often than the page to be evicted, so large scans can not flush the cache.
+DECLARE_String(storage_page_cache_admission_policy);
+// Admission policy of segment cache, "lru" or "tinylfu".
+DECLARE_String(segment_cache_admission_policy);
+// Max number of column iterators released by the finished queries kept by each column of a
+// cached segment for the next queries, so they need not decode the dictionary page again.
+// 0 disables the reuse.
+DECLARE_mInt32(column_iterator_pool_size);
+
+// Whether to plan the data pages read by each batch of segment iterator and prefetch them
+// asynchronously with coalesced ios, only for segments not on local disk.
+DECLARE_mBool(enable_segment_page_prefetch);
+// Max number of prefetch ios in flight of each segment iterator.
+DECLARE_mInt32(segment_page_prefetch_max_inflight);
+// Pages whose gap is less than this are read by one io.
+DECLARE_mInt64(segment_page_prefetch_merge_gap_bytes);
+// Max size of one coalesced prefetch io.
+DECLARE_mInt64(segment_page_prefetch_max_merged_bytes);
+// The tail of this size of a segment is read on open, which holds the footer unless it is
+// larger.
+DECLARE_mInt32(segment_footer_read_bytes);
+// The index region of a remote segment in the file cache is fetched in one request on open,
+// if it is at most this size. 0 means disabled.
+DECLARE_mInt64(segment_index_prefetch_max_bytes);
+// Whether to hint the kernel to read the planned data pages of the segments on local disk
+// ahead by posix_fadvise, so the reads of a batch are queued to the disk together instead
+// of blocking the scanner thread one page at a time.
+DECLARE_mBool(enable_local_segment_page_readahead);
+// Whether to drop the data read by compaction from the os page cache, so that compaction
+// does not evict the pages cached for queries.
+DECLARE_mBool(local_compaction_read_drop_page_cache);
+// Whether to prune the pages of the segments not read yet by zone map and bloom filter index
+// with the IN and min/max runtime filters arriving after the scanner is opened.
+DECLARE_mBool(enable_late_runtime_filter_index_pruning);
+// Memory limit of the in-memory key fingerprint indexes of the merge-on-write segments, which
+// locate a key by one probe instead of a search of the primary key index. 0 means disabled.
+DECLARE_mInt64(primary_key_fingerprint_index_memory_limit_mb);
 // Percentage for index page cache
 // all storage page cache will be divided into data_page_cache and index_page_cache
 DECLARE_Int32(index_page_cache_percentage);
@@ -348,6 +492,10 @@ DECLARE_Bool(disable_storage_row_cache);
 // storage_page_cache_limit
 DECLARE_String(pk_storage_page_cache_limit);
 
+// Cache for the decoded bloom filters of the bloom filter index pages, it's seperated from
+// storage_page_cache_limit. 0 to disable.
+DECLARE_String(bloom_filter_page_cache_limit);
+
 DECLARE_Bool(enable_low_cardinality_optimize);
 DECLARE_Bool(enable_low_cardinality_cache_code);
 
@@ -364,6 +512,9 @@ DECLARE_mBool(enable_ordered_data_compaction);
 DECLARE_mInt32(vertical_compaction_num_columns_per_group);
 // In vertical compaction, max memory usage for row_source_buffer
 DECLARE_Int32(vertical_compaction_max_row_source_memory_mb);
+// In vertical compaction, max number of threads to compact the value column groups of a task
+// in parallel, which is scaled down by the free permits of compaction
+DECLARE_mInt32(vertical_compaction_max_parallel_groups);
 // In vertical compaction, max dest segment file size
 DECLARE_mInt64(vertical_compaction_max_segment_size);
 
@@ -425,11 +576,27 @@ DECLARE_mInt32(compaction_task_num_per_fast_disk);
 // How many rounds of cumulative compaction for each round of base compaction when compaction tasks generation.
 DECLARE_mInt32(cumulative_compaction_rounds_for_each_base_compaction_round);
 
+// Whether to pick compaction candidates by priority instead of by compaction score only.
+// The priority weighs the compaction score against the data a compaction rewrites, and
+// boosts the tablets being queried and the tablets close to max_tablet_version_num.
+DECLARE_mBool(enable_compaction_priority_schedule);
+// A tablet queried within this period is considered hot by compaction, <= 0 means disabled.
+DECLARE_mInt32(compaction_hot_tablet_window_sec);
+// A tablet whose version count exceeds this percent of max_tablet_version_num is
+// compacted before all the other tablets.
+DECLARE_mInt32(compaction_urgent_version_count_percent);
+// Only one cumulative and one base compaction task run on each disk when the max disk io
+// util percent exceeds this value, 0 means disabled.
+DECLARE_mInt32(compaction_disk_io_util_limit_percent);
+
 // Threshold to logging compaction trace, in seconds.
 DECLARE_mInt32(base_compaction_trace_threshold);
 DECLARE_mInt32(cumulative_compaction_trace_threshold);
 DECLARE_mBool(disable_compaction_trace_log);
 
+// The number of the last compactions kept in information_schema.compaction_history.
+DECLARE_mInt32(compaction_history_size);
+
 // Interval to picking rowset to compact, in seconds
 DECLARE_mInt64(pick_rowset_to_compact_interval_sec);
 
@@ -511,6 +678,28 @@ DECLARE_mInt32(stream_load_record_batch_size);
 DECLARE_Int32(stream_load_record_expire_time_secs);
 // time interval to clean expired stream load records
 DECLARE_mInt64(clean_stream_load_record_interval_secs);
+// Whether to pass the body chunks of a stream load from libevent to the scanner by reference
+// instead of copying them, for the plain csv and json by line.
+DECLARE_mBool(enable_stream_load_zero_copy);
+// The number of the scanners parsing a stream load of at least
+// stream_load_parallel_parse_min_bytes in parallel, for the tables taking the rows in any order.
+DECLARE_mInt32(stream_load_parse_parallelism);
+DECLARE_mInt64(stream_load_parallel_parse_min_bytes);
+
+// The dir of the write-ahead logs of the stream loads with the group_commit header.
+DECLARE_String(group_commit_wal_dir);
+// The interval to commit the batch of the group committed loads of a table as one transaction.
+DECLARE_mInt32(group_commit_interval_ms);
+// The body of a group committed load can not be larger than it.
+DECLARE_mInt64(group_commit_max_load_bytes);
+// A batch is committed before the interval when its loads reach it, and the loads of a table
+// are rejected when its batches waiting to be committed reach twice of it.
+DECLARE_mInt64(group_commit_max_batch_bytes);
+// The number of the threads committing the batches.
+DECLARE_Int32(group_commit_thread_num);
+// The times to retry committing a batch, after which its write-ahead log is renamed with the
+// suffix .failed and left for the manual recovery.
+DECLARE_mInt32(group_commit_max_retries);
 
 // OlapTableSink sender's send interval, should be less than the real response time of a tablet writer rpc.
 // You may need to lower the speed when the sink receiver bes are too busy.
@@ -563,6 +752,26 @@ DECLARE_Bool(enable_quadratic_probing);
 DECLARE_String(pprof_profile_dir);
 // for jeprofile in jemalloc
 DECLARE_mString(jeprofile_dir);
+// Sample the stacks of the threads burning CPU continuously, tagged by the query and the
+// workload group the threads work for, served as folded stacks by /api/cpu_sampler.
+DECLARE_Bool(enable_cpu_sampler);
+// samples per second of CPU time
+DECLARE_Int32(cpu_sampler_frequency);
+// The samples are aggregated by minute and kept for this number of minutes.
+DECLARE_Int32(cpu_sampler_retention_minutes);
+// The distinct stacks kept in a minute, the samples of the others are counted as truncated.
+DECLARE_Int32(cpu_sampler_max_stacks_per_minute);
+
+// Record the wait time of the contended acquisitions and a sample of the hold time of the
+// profiled mutexes by lock site, see /api/lock_profile and the lock_site metrics.
+DECLARE_mBool(enable_lock_profiling);
+// The hold time of one of this many acquisitions of a thread is recorded.
+DECLARE_mInt32(lock_profiling_sample_every);
+
+// The directory of the captures of /api/rpc_capture, ${DORIS_HOME}/log/rpc_capture by default.
+DECLARE_mString(rpc_capture_dir);
+// A capture stops when its file reaches this size.
+DECLARE_mInt64(rpc_capture_max_bytes);
 
 // to forward compatibility, will be removed later
 DECLARE_mBool(enable_token_check);
@@ -613,6 +822,10 @@ DECLARE_Int32(load_process_max_memory_limit_percent); // 50%
 // might avoid all load jobs hang at the same time.
 DECLARE_Int32(load_process_soft_mem_limit_percent);
 
+// Percent of load_process_max_memory_limit, above which the largest memtables are flushed
+// asynchronously before the soft limit is reached. 0 means disabled.
+DECLARE_mInt32(load_process_proactive_flush_mem_limit_percent);
+
 // result buffer cancelled time (unit: second)
 DECLARE_mInt32(result_buffer_cancelled_interval_time);
 
@@ -622,6 +835,20 @@ DECLARE_mInt32(priority_queue_remaining_tasks_increased_frequency);
 // sync tablet_meta when modifying meta
 DECLARE_mBool(sync_tablet_meta);
 
+// Whether a schema change widening the type of a value column, e.g. INT to BIGINT, keeps the
+// segments written in the old type by linking them, which are converted as read until compacted.
+DECLARE_mBool(enable_lazy_schema_change);
+
+// Whether to write the rowset and tablet metas saved at the same time, e.g. by the commits and
+// publishes of the loads of a lot of tablets, in one write batch of the meta store, of at most
+// meta_group_write_max_entries entries.
+DECLARE_mBool(enable_meta_group_write);
+DECLARE_mInt32(meta_group_write_max_entries);
+
+// cache the footers of local segments in tablet meta, to avoid reading them from
+// the segment files when the segments are opened again after restart
+DECLARE_mBool(enable_segment_footer_meta_cache);
+
 // default thrift rpc timeout ms
 DECLARE_mInt32(thrift_rpc_timeout_ms);
 
@@ -652,6 +879,10 @@ DECLARE_String(es_scroll_keepalive);
 // HTTP connection timeout for es
 DECLARE_mInt32(es_http_timeout_ms);
 
+// The number of slices of the sliced scroll of an es shard, each slice is read by a scanner.
+// 1 means a shard is read by one scroll without slices.
+DECLARE_mInt32(es_scroll_slices_per_shard);
+
 // the max client cache number per each host
 // There are variety of client cache in BE, but currently we use the
 // same cache size configuration.
@@ -692,11 +923,24 @@ DECLARE_String(default_rowset_type);
 DECLARE_Int64(brpc_max_body_size);
 // Max unwritten bytes in each socket, if the limit is reached, Socket.Write fails with EOVERCROWDED
 DECLARE_Int64(brpc_socket_max_unwritten_bytes);
+// The connection type of the brpc channels to other BEs, "single", "pooled" or "short".
+// With "pooled", a connection carries one request at a time, so a large block sent by exchange
+// does not hold the smaller requests to the same BE behind it.
+DECLARE_String(brpc_connection_type);
+// The number of brpc channels to each BE, every one has its own connections, the client held by
+// the fewest users is given out.
+DECLARE_Int32(brpc_num_channels_per_host);
 // TODO(zxy): expect to be true in v1.3
 // Whether to embed the ProtoBuf Request serialized string together with Tuple/Block data into
 // Controller Attachment and send it through http brpc when the length of the Tuple/Block data
 // is greater than 1.8G. This is to avoid the error of Request length overflow (2G).
 DECLARE_mBool(transfer_large_data_by_brpc);
+// Whether to hand the column values of the exchanged blocks to brpc as the attachment without
+// copying them into the serialized request.
+DECLARE_mBool(exchange_transfer_block_by_attachment);
+// Whether to send a broadcast block once per dest BE instead of once per dest fragment instance.
+// All the BEs should support it before it is turned on.
+DECLARE_mBool(enable_broadcast_exchange_per_host);
 
 // max number of txns for every txn_partition_map in txn manager
 // this is a self protection to avoid too many txns saving in manager
@@ -717,6 +961,9 @@ DECLARE_Int32(txn_shard_size);
 // Whether to continue to start be when load tablet from header failed.
 DECLARE_Bool(ignore_load_tablet_failure);
 
+// Number of threads to load the tablets and rowsets of one data dir when be starts.
+DECLARE_Int32(load_data_dir_thread_num);
+
 // Whether to continue to start be when load tablet from header failed.
 DECLARE_mBool(ignore_rowset_stale_unconsistent_delete);
 
@@ -759,6 +1006,17 @@ DECLARE_mInt32(remote_storage_read_buffer_mb);
 // Decreasing this value will increase the frequency of consume/release.
 // Increasing this value will cause MemTracker statistics to be inaccurate.
 DECLARE_mInt32(mem_tracker_consume_min_size_bytes);
+// The memory consumed by the threads is accumulated in a slab of each core before being added
+// to the shared counter of the MemTrackerLimiter, to avoid the contention among the cores.
+// This is the max bytes kept in a slab, it is also at most 1/64 of the limit divided by the
+// number of cores, so the error of limit check is bounded. 0 to disable the slabs.
+DECLARE_mInt64(mem_tracker_core_local_slack_bytes);
+// Sample the allocation stacks of the queries and loads started while this is on, served as
+// folded stacks by /api/query_memory_profile and written to jeprofile_dir when a query is
+// cancelled for exceeding its memory limit.
+DECLARE_mBool(enable_query_memory_profile);
+// A thread samples an allocation stack about every this many bytes it allocates.
+DECLARE_mInt64(mem_alloc_profile_sample_bytes);
 
 // The version information of the tablet will be stored in the memory
 // in an adjacency graph data structure.
@@ -797,6 +1055,28 @@ DECLARE_mInt32(max_segment_num_per_rowset);
 // segment_compression_threshold_kb.
 DECLARE_mInt32(segment_compression_threshold_kb);
 
+// Compaction builds an ngram bloom filter of all values of a string column without ngram
+// bloom filter index into the segment footer, if the total size of the values is at most
+// segment_ngram_bf_max_column_kb, so the segments which can not match a LIKE predicate are
+// skipped. 0 means disabled.
+DECLARE_mInt32(segment_ngram_bf_max_column_kb);
+// the size in bytes and the gram size of the segment ngram bloom filter
+DECLARE_mInt32(segment_ngram_bf_size);
+DECLARE_mInt32(segment_ngram_bf_gram_size);
+
+// Compaction trains a ZSTD dictionary of at most segment_zstd_dict_size_kb from the first
+// segment_zstd_dict_sample_kb of the pages of a ZSTD compressed string column, stores it into
+// the segment footer and compresses all the pages of the column with it. The segments can not
+// be read by the BEs without this feature. 0 means disabled.
+DECLARE_mInt32(segment_zstd_dict_size_kb);
+DECLARE_mInt32(segment_zstd_dict_sample_kb);
+
+// The number of threads encoding the column chunks of a row group of the parquet files
+// exported by SELECT INTO OUTFILE or EXPORT, 1 means encoding in the sink thread.
+DECLARE_mInt32(parquet_writer_encode_threads);
+// The row groups of the exported parquet files are buffered in memory up to this size.
+DECLARE_mInt64(parquet_writer_row_group_max_bytes);
+
 // The connection timeout when connecting to external table such as odbc table.
 DECLARE_mInt32(external_table_connect_timeout_sec);
 
@@ -818,11 +1098,19 @@ DECLARE_String(kafka_broker_version_fallback);
 // If you meet the error describe in https://github.com/edenhill/librdkafka/issues/3608
 // Change this size to 0 to fix it temporarily.
 DECLARE_Int32(routine_load_consumer_pool_size);
+// The max number of the kafka messages a consumer takes at a time without waiting, which are
+// handed to the consumer group together.
+DECLARE_Int32(routine_load_consume_batch_size);
 
 // Used in single-stream-multi-table load. When receive a batch of messages from kafka,
 // if the size of batch is more than this threshold, we will request plans for all related tables.
 DECLARE_Int32(multi_table_batch_plan_threshold);
 
+// Used in single-stream-multi-table load. The plans of the tables of a routine load job are cached
+// and reused by its following tasks while the FE reports their tables unchanged, a plan unused for
+// more than this many seconds is evicted. 0 means not to cache the plans.
+DECLARE_mInt32(multi_table_plan_cache_expire_sec);
+
 // When the timeout of a load task is less than this threshold,
 // Doris treats it as a high priority task.
 // high priority tasks use a separate thread pool for flush and do not block rpc by memory cleanup logic.
@@ -888,6 +1176,14 @@ DECLARE_mInt32(parquet_rowgroup_max_buffer_mb);
 DECLARE_mInt32(parquet_column_max_buffer_mb);
 // Merge small IO, the max amplified read ratio
 DECLARE_mDouble(max_amplified_read_ratio);
+// Whether to fetch the column chunks of the next row groups of remote parquet files in background
+DECLARE_mBool(enable_parquet_row_group_prefetch);
+// Max number of row groups prefetched after the row group being read
+DECLARE_mInt32(parquet_row_group_prefetch_num);
+// Max bytes of the column chunks prefetched by one parquet reader, including the current row group
+DECLARE_mInt32(parquet_row_group_prefetch_budget_mb);
+// Max number of prefetch ios in flight of one parquet reader
+DECLARE_mInt32(parquet_row_group_prefetch_max_inflight);
 
 // OrcReader
 DECLARE_mInt32(orc_natural_read_size_mb);
@@ -920,6 +1216,9 @@ DECLARE_Int32(s3_transfer_executor_pool_size);
 
 DECLARE_Bool(enable_time_lut);
 DECLARE_Bool(enable_simdjson_reader);
+// Whether to parse the lines of line delimited json by a simdjson document stream in batch,
+// only works for the json without jsonpaths and json_root.
+DECLARE_mBool(enable_simdjson_batch_reader);
 
 DECLARE_mBool(enable_query_like_bloom_filter);
 // number of s3 scanner thread pool size
@@ -960,7 +1259,59 @@ DECLARE_Bool(enable_java_support);
 DECLARE_Bool(enable_fuzzy_mode);
 
 DECLARE_Int32(pipeline_executor_size);
+// Pin each pipeline executor to the cores of its NUMA node, only takes effect when there are
+// more than one NUMA nodes.
+DECLARE_Bool(enable_pipeline_numa_affinity);
+// An idle pipeline executor steals tasks from the executors of other NUMA nodes only when they
+// have at least this number of tasks waiting, the executors of the same NUMA node are always
+// tried first.
+DECLARE_mInt32(pipeline_cross_numa_steal_threshold);
+// Lock each level of the pipeline priority task queue separately instead of the whole queue,
+// to reduce the contention of the executors when there are a lot of pipeline tasks.
+DECLARE_Bool(enable_pipeline_sharded_task_queue);
+// Wake up the blocked pipeline tasks by the dependencies of their operators, instead of polling
+// them in BlockedTaskScheduler.
+DECLARE_Bool(enable_pipeline_task_dependency);
+// The max bytes of the empty column buffers kept by a pipeline task for the next batches,
+// 0 to disable the column pool.
+DECLARE_mInt64(pipeline_task_column_pool_bytes);
 DECLARE_mInt16(pipeline_short_query_timeout_s);
+// Run the scanners of the pipeline queries in the pipeline executors by their scan operators,
+// instead of the scanner thread pools, so the scan CPU time is also scheduled by the task
+// queue, e.g. shared by the workload groups. It takes effect for the new queries.
+DECLARE_mBool(enable_scan_in_pipeline_task);
+// Record the runs of the pipeline tasks on the executors, served as a Chrome trace of a query by
+// /api/pipeline_trace?query_id=xxx.
+DECLARE_mBool(enable_pipeline_task_tracing);
+// The number of the task runs kept by each pipeline executor for the tracing, the oldest ones
+// are overwritten.
+DECLARE_Int32(pipeline_task_tracing_buffer_size);
+// The time slice of a scanner run by a scan operator, after which the scanner yields between
+// batches.
+DECLARE_mInt32(pipeline_task_scan_time_slice_ms);
+// Decide whether a streaming pre-aggregation keeps aggregating by also sampling the reduction
+// of the recent blocks with HLL, and let it switch back from passthrough to aggregation.
+DECLARE_mBool(enable_adaptive_streaming_preagg);
+// In passthrough mode, sample one of every this number of blocks to find whether aggregating
+// gets worthwhile again.
+DECLARE_mInt32(streaming_preagg_sample_block_interval);
+// Add a block into the states of the common combinations of sum, count, min and max in one
+// pass by the fused kernels, instead of one pass per function.
+DECLARE_mBool(enable_fused_agg_kernels);
+// Execute the equal function calls in the projections of a node once per block, and the
+// others reuse the result column.
+DECLARE_mBool(enable_common_subexpr_elimination);
+// When the rows surviving the executed conjuncts are at most this ratio of a block, filter the
+// block before the next conjunct executes, 0 to always filter the block after all conjuncts.
+DECLARE_mDouble(early_filter_block_ratio);
+// Measure the selectivity and cost of the conjuncts of scans and the predicates of segment
+// iterators, and reorder them every this number of blocks so the most selective and cheapest
+// ones go first.
+DECLARE_mBool(enable_adaptive_conjunct_order);
+DECLARE_mInt32(conjunct_reorder_block_interval);
+// Compile an OR chain of LIKE and REGEXP on the same column into one hyperscan database, and
+// match all the patterns in one scan of each string.
+DECLARE_mBool(enable_multi_pattern_like);
 
 // Temp config. True to use optimization for bitmap_index apply predicate except leaf node of the and node.
 // Will remove after fully test.
@@ -975,6 +1326,13 @@ DECLARE_Int64(file_cache_min_file_segment_size);
 DECLARE_Int64(file_cache_max_file_segment_size);
 DECLARE_Bool(clear_file_cache);
 DECLARE_Bool(enable_file_cache_query_limit);
+// Number of shards of the file cache of each path. Each shard has its own lock, lru queues
+// and 1/n of the capacity, the files are assigned to the shards by the hash of cache key.
+DECLARE_Int32(file_cache_num_shards_per_path);
+// the read bandwidth limit of warming up file cache, 0 means no limit
+DECLARE_mInt64(file_cache_warm_up_bytes_per_second);
+// warm up the file cache of the remote rowsets of a tablet after it is cloned
+DECLARE_mBool(enable_file_cache_warm_up_after_clone);
 
 // inverted index searcher cache
 // cache entry stay time after lookup, default 1h
@@ -983,6 +1341,8 @@ DECLARE_mInt32(index_cache_entry_stay_time_after_lookup_s);
 DECLARE_mInt32(index_cache_entry_no_visit_gc_time_s);
 // inverted index searcher cache size
 DECLARE_String(inverted_index_searcher_cache_limit);
+// Admission policy of inverted index searcher cache, "lru" or "tinylfu".
+DECLARE_String(inverted_index_searcher_cache_admission_policy);
 // set `true` to enable insert searcher into cache when write inverted index data
 DECLARE_Bool(enable_write_index_searcher_cache);
 DECLARE_Bool(enable_inverted_index_cache_check_timestamp);
@@ -990,6 +1350,13 @@ DECLARE_Int32(inverted_index_fd_number_limit_percent); // 50%
 
 // inverted index match bitmap cache size
 DECLARE_String(inverted_index_query_cache_limit);
+// threads to open the index searchers of all segments of a rowset in parallel before they
+// are queried, 0 to open them one by one on query
+DECLARE_Int32(inverted_index_searcher_open_threads);
+// Size of the cache of the bloom filters over the terms of fulltext index files. A query
+// term absent from the filter of a segment is answered without opening its index searcher.
+// 0 to disable.
+DECLARE_String(inverted_index_term_cache_limit);
 
 // inverted index
 DECLARE_mDouble(inverted_index_ram_buffer_size);
@@ -999,8 +1366,14 @@ DECLARE_String(inverted_index_dict_path);
 DECLARE_Int32(inverted_index_read_buffer_size);
 // tree depth for bkd index
 DECLARE_Int32(max_depth_in_bkd_tree);
-// index compaction
+// index compaction, merge the inverted indexes of the input segments with the row id
+// conversion on compaction instead of tokenizing and indexing the merged rows again
 DECLARE_Bool(inverted_index_compaction_enable);
+// Do not tokenize and index the fulltext inverted indexes on the flush of load, build them
+// in background after the rowset is committed instead. The segments are queried without
+// the index until it is built.
+DECLARE_mBool(enable_async_inverted_index_build);
+DECLARE_Int32(async_inverted_index_build_thread_num);
 // use num_broadcast_buffer blocks as buffer to do broadcast
 DECLARE_Int32(num_broadcast_buffer);
 // semi-structure configs
@@ -1029,12 +1402,32 @@ DECLARE_mInt32(tablet_path_check_batch_size);
 
 // Page size of row column, default 4KB
 DECLARE_mInt64(row_column_page_size);
+// Whether to encode the newly written timestamp columns by delta-of-delta encoding and
+// float columns by alp encoding when the column has no explicit encoding. The segments can
+// not be read by the BEs of older versions, so enable it after all BEs are upgraded.
+DECLARE_mBool(enable_adaptive_numeric_encoding);
 // it must be larger than or equal to 5MB
 DECLARE_mInt32(s3_write_buffer_size);
 // the size of the whole s3 buffer pool, which indicates the s3 file writer
 // can at most buffer 50MB data. And the num of multi part upload task is
 // s3_write_buffer_whole_size / s3_write_buffer_size
 DECLARE_mInt32(s3_write_buffer_whole_size);
+// the max size of one part of s3 multipart upload, the part size of a file grows from
+// s3_write_buffer_size up to it as more parts are uploaded
+DECLARE_mInt64(s3_write_max_part_size);
+// the max number of parts of one s3 file writer being uploaded, so a writer can not take
+// the whole s3 buffer pool. 0 means no limit
+DECLARE_mInt32(s3_write_max_inflight_parts_per_writer);
+// send the part again if it is not uploaded after the delay, the first successful request
+// is used. 0 means disabled
+DECLARE_mInt32(s3_write_part_hedge_delay_ms);
+// the number of threads to upload the parts of s3 file writers
+DECLARE_Int32(s3_file_upload_thread_num);
+// send the same request again if a s3 read does not return after the p95 latency of the
+// recent reads, and use the first successful response
+DECLARE_mBool(enable_s3_hedged_read);
+// the min delay to send the hedged s3 read
+DECLARE_mInt32(s3_hedged_read_min_delay_ms);
 //enable shrink memory
 DECLARE_Bool(enable_shrink_memory);
 // enable cache for high concurrent point query work load
@@ -1049,8 +1442,20 @@ DECLARE_Bool(enable_set_in_bitmap_value);
 
 // max number of hdfs file handle in cache
 DECLARE_Int64(max_hdfs_file_handle_cache_num);
+// Number of threads of the hedged read of the hdfs client, 0 means disable. A hedged read
+// sends a second read to another datanode when the first one is slower than the threshold.
+// Only the positional reads are hedged. Can be overridden by the hdfs conf of a catalog.
+DECLARE_mInt32(hdfs_hedged_read_threadpool_size);
+DECLARE_mInt32(hdfs_hedged_read_threshold_ms);
+// Read hdfs files by zero copy read, which maps the blocks of the datanode on the same host
+// into memory instead of copying by the socket. Requires the short circuit read of the hdfs,
+// and skips the checksum verification of the mapped blocks. Only for hadoop libhdfs.
+DECLARE_mBool(enable_hdfs_zero_copy_read);
 // max number of meta info of external files, such as parquet footer
 DECLARE_Int64(max_external_file_meta_cache_num);
+// max memory of meta info of external files, such as parquet footer, orc tail and the deleted
+// rows of iceberg and hive acid delete files
+DECLARE_Int64(max_external_file_meta_cache_bytes);
 
 #ifdef BE_TEST
 // test s3
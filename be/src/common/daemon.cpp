@@ -48,6 +48,7 @@
 #include "runtime/load_channel_mgr.h"
 #include "runtime/memory/mem_tracker.h"
 #include "runtime/memory/mem_tracker_limiter.h"
+#include "runtime/memory/memory_governor.h"
 #include "runtime/task_group/task_group_manager.h"
 #include "runtime/user_function_cache.h"
 #include "service/backend_options.h"
@@ -232,11 +233,21 @@ void Daemon::memory_gc_thread() {
         auto sys_mem_available = doris::MemInfo::sys_mem_available();
         auto proc_mem_no_allocator_cache = doris::MemInfo::proc_mem_no_allocator_cache();
 
+        // Refresh the memory used and lent by the resource groups before their gc
+        taskgroup::TaskGroupManager::instance()->refresh_memory_usage();
         // GC excess memory for resource groups that not enable overcommit
         auto tg_free_mem = doris::MemInfo::tg_hard_memory_limit_gc();
         sys_mem_available += tg_free_mem;
         proc_mem_no_allocator_cache -= tg_free_mem;
 
+        // Free the caches gradually above the high watermark, before the minor gc prunes them
+        if (config::enable_memory_governor) {
+            auto governor_free_mem = doris::MemoryGovernor::instance()->free_above_high_watermark(
+                    proc_mem_no_allocator_cache);
+            sys_mem_available += governor_free_mem;
+            proc_mem_no_allocator_cache -= governor_free_mem;
+        }
+
         if (memory_full_gc_sleep_time_ms <= 0 &&
             (sys_mem_available < doris::MemInfo::sys_mem_available_low_water_mark() ||
              proc_mem_no_allocator_cache >= doris::MemInfo::mem_limit())) {
@@ -47,6 +47,9 @@ public:
     static constexpr const char* KEY_DOC_VALUES_MODE = "doc_values_mode";
     static constexpr const char* KEY_HTTP_SSL_ENABLED = "http_ssl_enabled";
     static constexpr const char* KEY_QUERY_DSL = "query_dsl";
+    // the slice of the sliced scroll of a shard
+    static constexpr const char* KEY_SLICE_ID = "slice_id";
+    static constexpr const char* KEY_SLICE_MAX = "slice_max";
     ESScanReader(const std::string& target, const std::map<std::string, std::string>& props,
                  bool doc_value_mode);
     ~ESScanReader();
@@ -128,6 +128,9 @@ Status ExecNode::prepare(RuntimeState* state) {
     OpentelemetryScope scope {_span};
     _rows_returned_counter = ADD_COUNTER(_runtime_profile, "RowsReturned", TUnit::UNIT);
     _projection_timer = ADD_TIMER(_runtime_profile, "ProjectionTime");
+    if (state->enable_operator_perf_counters()) {
+        _hw_perf_counters.init(_runtime_profile.get());
+    }
     _rows_returned_rate = runtime_profile()->add_derived_counter(
             ROW_THROUGHPUT_COUNTER, TUnit::UNIT_PER_SECOND,
             std::bind<int64_t>(&RuntimeProfile::units_per_second, _rows_returned_counter,
@@ -141,6 +144,9 @@ Status ExecNode::prepare(RuntimeState* state) {
     }
 
     RETURN_IF_ERROR(vectorized::VExpr::prepare(_projections, state, intermediate_row_desc()));
+    if (config::enable_common_subexpr_elimination) {
+        vectorized::VExpr::eliminate_common_subexprs(_projections, &_projection_common_results);
+    }
 
     for (int i = 0; i < _children.size(); ++i) {
         RETURN_IF_ERROR(_children[i]->prepare(state));
@@ -568,6 +574,8 @@ Status ExecNode::do_projections(vectorized::Block* origin_block, vectorized::Blo
     auto rows = origin_block->rows();
 
     if (rows != 0) {
+        // the shared results are the columns of the last block
+        VExpr::reset_common_results(_projection_common_results);
         auto& mutable_columns = mutable_block.mutable_columns();
         DCHECK(mutable_columns.size() == _projections.size());
         for (int i = 0; i < mutable_columns.size(); ++i) {
@@ -596,6 +604,7 @@ Status ExecNode::get_next_after_projects(
         RuntimeState* state, vectorized::Block* block, bool* eos,
         const std::function<Status(RuntimeState*, vectorized::Block*, bool*)>& func,
         bool clear_data) {
+    SCOPED_HW_PERF_COUNTERS(&_hw_perf_counters);
     if (_output_row_descriptor) {
         if (clear_data) {
             clear_origin_block();
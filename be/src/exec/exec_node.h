@@ -35,6 +35,7 @@
 #include "common/global_types.h"
 #include "common/status.h"
 #include "runtime/descriptors.h"
+#include "util/hw_perf_counters.h"
 #include "util/runtime_profile.h"
 #include "util/telemetry/telemetry.h"
 #include "vec/core/block.h"
@@ -229,6 +230,9 @@ public:
 
     RuntimeProfile* faker_runtime_profile() const { return _faker_runtime_profile.get(); }
     RuntimeProfile* runtime_profile() const { return _runtime_profile.get(); }
+    // the hardware counters of the operator, enabled by the query option
+    // enable_operator_perf_counters
+    HwPerfProfileCounters* hw_perf_counters() { return &_hw_perf_counters; }
     RuntimeProfile::Counter* memory_used_counter() const { return _memory_used_counter; }
 
     MemTracker* mem_tracker() const { return _mem_tracker.get(); }
@@ -268,6 +272,8 @@ protected:
 
     std::unique_ptr<RowDescriptor> _output_row_descriptor;
     vectorized::VExprContextSPtrs _projections;
+    // the results of the function calls shared by the projections
+    vectorized::VExprCommonResults _projection_common_results;
 
     /// Resource information sent from the frontend.
     const TBackendResourceProfile _resource_profile;
@@ -286,6 +292,7 @@ protected:
     // Account for peak memory used by this node
     RuntimeProfile::Counter* _memory_used_counter;
     RuntimeProfile::Counter* _projection_timer;
+    HwPerfProfileCounters _hw_perf_counters;
 
     //
     OpentelemetrySpan _span;
@@ -31,6 +31,7 @@
 #include <algorithm>
 #include <cstdint>
 #include <ostream>
+#include <set>
 #include <string>
 #include <unordered_map>
 #include <utility>
@@ -55,6 +56,7 @@
 #include "vec/common/string_ref.h"
 #include "vec/core/block.h" // Block
 #include "vec/data_types/data_type_factory.hpp"
+#include "vec/data_types/data_type_nullable.h"
 #include "vec/data_types/serde/data_type_serde.h"
 #include "vec/jsonb/serialize.h"
 
@@ -76,7 +78,8 @@ Status RowIDFetcher::init() {
     return Status::OK();
 }
 
-PMultiGetRequest RowIDFetcher::_init_fetch_request(const vectorized::ColumnString& row_locs) const {
+PMultiGetRequest RowIDFetcher::_init_fetch_request(const vectorized::ColumnString& row_locs,
+                                                   const vectorized::NullMap* null_map) const {
     PMultiGetRequest mget_req;
     _fetch_option.desc->to_protobuf(mget_req.mutable_desc());
     for (SlotDescriptor* slot : _fetch_option.desc->slots()) {
@@ -86,12 +89,20 @@ PMultiGetRequest RowIDFetcher::_init_fetch_request(const vectorized::ColumnStrin
         }
         slot->to_protobuf(mget_req.add_slots());
     }
+    // the same row may be referenced many times after join, fetch it once
+    std::set<GlobalRowLoacation> requested;
     for (size_t i = 0; i < row_locs.size(); ++i) {
+        if (null_map != nullptr && (*null_map)[i]) {
+            continue;
+        }
         PRowLocation row_loc;
         StringRef row_id_rep = row_locs.get_data_at(i);
         // TODO: When transferring data between machines with different byte orders (endianness),
         // not performing proper handling may lead to issues in parsing and exchanging the data.
         auto location = reinterpret_cast<const GlobalRowLoacation*>(row_id_rep.data);
+        if (!requested.insert(*location).second) {
+            continue;
+        }
         row_loc.set_tablet_id(location->tablet_id);
         row_loc.set_rowset_id(location->row_location.rowset_id.to_string());
         row_loc.set_segment_id(location->row_location.segment_id);
@@ -191,8 +202,17 @@ Status RowIDFetcher::_merge_rpc_results(const PMultiGetRequest& request,
 Status RowIDFetcher::fetch(const vectorized::ColumnPtr& column_row_ids,
                            vectorized::Block* res_block) {
     CHECK(!_stubs.empty());
-    PMultiGetRequest mget_req = _init_fetch_request(assert_cast<const vectorized::ColumnString&>(
-            *vectorized::remove_nullable(column_row_ids).get()));
+    // row id is null for the rows not matched by outer join, which are filled with null
+    const vectorized::NullMap* null_map = nullptr;
+    if (const auto* nullable =
+                vectorized::check_and_get_column<vectorized::ColumnNullable>(*column_row_ids)) {
+        if (nullable->has_null()) {
+            null_map = &nullable->get_null_map_data();
+        }
+    }
+    const auto& row_locs = assert_cast<const vectorized::ColumnString&>(
+            *vectorized::remove_nullable(column_row_ids).get());
+    PMultiGetRequest mget_req = _init_fetch_request(row_locs, null_map);
     std::vector<PMultiGetResponse> resps(_stubs.size());
     std::vector<brpc::Controller> cntls(_stubs.size());
     bthread::CountdownEvent counter(_stubs.size());
@@ -207,6 +227,10 @@ Status RowIDFetcher::fetch(const vectorized::ColumnPtr& column_row_ids,
     std::vector<PRowLocation> rows_locs;
     rows_locs.reserve(rows_locs.size());
     RETURN_IF_ERROR(_merge_rpc_results(mget_req, resps, cntls, res_block, &rows_locs));
+    if (res_block->is_empty_column()) {
+        // nothing is fetched, e.g. all the row ids are null
+        *res_block = vectorized::Block(_fetch_option.desc->slots(), 0);
+    }
 
     // Final sort by row_ids sequence, since row_ids is already sorted if need
     std::map<GlobalRowLoacation, size_t> positions;
@@ -217,17 +241,37 @@ Status RowIDFetcher::fetch(const vectorized::ColumnPtr& column_row_ids,
                                rows_locs[i].ordinal_id());
         positions[grl] = i;
     };
+    size_t num_rows = res_block->rows();
     vectorized::IColumn::Permutation permutation;
-    permutation.reserve(column_row_ids->size());
-    for (size_t i = 0; i < column_row_ids->size(); ++i) {
-        auto location =
-                reinterpret_cast<const GlobalRowLoacation*>(column_row_ids->get_data_at(i).data);
+    permutation.reserve(row_locs.size());
+    for (size_t i = 0; i < row_locs.size(); ++i) {
+        if (null_map != nullptr && (*null_map)[i]) {
+            // point to the default row appended below
+            permutation.push_back(num_rows);
+            continue;
+        }
+        auto location = reinterpret_cast<const GlobalRowLoacation*>(row_locs.get_data_at(i).data);
         permutation.push_back(positions[*location]);
     }
-    size_t num_rows = res_block->rows();
     for (size_t i = 0; i < res_block->columns(); ++i) {
-        res_block->get_by_position(i).column =
-                res_block->get_by_position(i).column->permute(permutation, num_rows);
+        auto& column_with_type = res_block->get_by_position(i);
+        if (null_map == nullptr) {
+            column_with_type.column =
+                    column_with_type.column->permute(permutation, permutation.size());
+            continue;
+        }
+        auto column =
+                column_with_type.column->convert_to_full_column_if_const()->clone_resized(num_rows);
+        column->insert_default();
+        auto permuted = vectorized::make_nullable(column->permute(permutation, permutation.size()))
+                                ->assume_mutable();
+        auto& res_null_map =
+                assert_cast<vectorized::ColumnNullable&>(*permuted).get_null_map_data();
+        for (size_t j = 0; j < res_null_map.size(); ++j) {
+            res_null_map[j] |= (*null_map)[j];
+        }
+        column_with_type.column = std::move(permuted);
+        column_with_type.type = vectorized::make_nullable(column_with_type.type);
     }
     // shrink for char type
     std::vector<size_t> char_type_idx;
@@ -26,6 +26,7 @@
 
 #include "common/status.h"
 #include "exec/tablet_info.h" // DorisNodesInfo
+#include "vec/columns/column_nullable.h"
 #include "vec/core/block.h"
 #include "vec/data_types/data_type.h"
 
@@ -42,6 +43,8 @@ class MutableBlock;
 
 // fetch rows by global rowid
 // tablet_id/rowset_name/segment_id/ordinal_id
+// The duplicated row ids, e.g. the ones after join, are fetched once. The rows of null row ids,
+// e.g. the ones not matched by outer join, are filled with null.
 
 struct FetchOption {
     TupleDescriptor* desc = nullptr;
@@ -56,7 +59,8 @@ public:
     Status fetch(const vectorized::ColumnPtr& row_ids, vectorized::Block* block);
 
 private:
-    PMultiGetRequest _init_fetch_request(const vectorized::ColumnString& row_ids) const;
+    PMultiGetRequest _init_fetch_request(const vectorized::ColumnString& row_ids,
+                                         const vectorized::NullMap* null_map) const;
     Status _merge_rpc_results(const PMultiGetRequest& request,
                               const std::vector<PMultiGetResponse>& rsps,
                               const std::vector<brpc::Controller>& cntls,
@@ -29,8 +29,10 @@
 #include "exec/schema_scanner/schema_charsets_scanner.h"
 #include "exec/schema_scanner/schema_collations_scanner.h"
 #include "exec/schema_scanner/schema_columns_scanner.h"
+#include "exec/schema_scanner/schema_compaction_history_scanner.h"
 #include "exec/schema_scanner/schema_dummy_scanner.h"
 #include "exec/schema_scanner/schema_files_scanner.h"
+#include "exec/schema_scanner/schema_load_channels_scanner.h"
 #include "exec/schema_scanner/schema_partitions_scanner.h"
 #include "exec/schema_scanner/schema_rowsets_scanner.h"
 #include "exec/schema_scanner/schema_schema_privileges_scanner.h"
@@ -144,6 +146,10 @@ std::unique_ptr<SchemaScanner> SchemaScanner::create(TSchemaTableType::type type
         return SchemaPartitionsScanner::create_unique();
     case TSchemaTableType::SCH_ROWSETS:
         return SchemaRowsetsScanner::create_unique();
+    case TSchemaTableType::SCH_COMPACTION_HISTORY:
+        return SchemaCompactionHistoryScanner::create_unique();
+    case TSchemaTableType::SCH_LOAD_CHANNELS:
+        return SchemaLoadChannelsScanner::create_unique();
     default:
         return SchemaDummyScanner::create_unique();
         break;
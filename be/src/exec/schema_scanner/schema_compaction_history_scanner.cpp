@@ -0,0 +1,147 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+
+#include "exec/schema_scanner/schema_compaction_history_scanner.h"
+
+#include <gen_cpp/Descriptors_types.h>
+
+#include <algorithm>
+#include <string>
+
+#include "common/status.h"
+#include "runtime/define_primitive_type.h"
+#include "runtime/runtime_state.h"
+#include "util/runtime_profile.h"
+#include "vec/common/string_ref.h"
+
+namespace doris {
+namespace vectorized {
+class Block;
+} // namespace vectorized
+
+std::vector<SchemaScanner::ColumnDesc> SchemaCompactionHistoryScanner::_s_tbls_columns = {
+        //   name,       type,          size,     is_null
+        {"BACKEND_ID", TYPE_BIGINT, sizeof(int64_t), true},
+        {"TABLET_ID", TYPE_BIGINT, sizeof(int64_t), true},
+        {"DATA_DIR", TYPE_VARCHAR, sizeof(StringRef), true},
+        {"COMPACTION_TYPE", TYPE_VARCHAR, sizeof(StringRef), true},
+        {"STATUS", TYPE_VARCHAR, sizeof(StringRef), true},
+        {"QUEUE_DEPTH", TYPE_BIGINT, sizeof(int64_t), true},
+        {"START_TIME", TYPE_BIGINT, sizeof(int64_t), true},
+        {"END_TIME", TYPE_BIGINT, sizeof(int64_t), true},
+        {"PREPARE_TIME_MS", TYPE_BIGINT, sizeof(int64_t), true},
+        {"MERGE_TIME_MS", TYPE_BIGINT, sizeof(int64_t), true},
+        {"BUILD_TIME_MS", TYPE_BIGINT, sizeof(int64_t), true},
+        {"MODIFY_TIME_MS", TYPE_BIGINT, sizeof(int64_t), true},
+        {"INPUT_ROWSETS", TYPE_BIGINT, sizeof(int64_t), true},
+        {"INPUT_SEGMENTS", TYPE_BIGINT, sizeof(int64_t), true},
+        {"INPUT_ROWS", TYPE_BIGINT, sizeof(int64_t), true},
+        {"INPUT_BYTES", TYPE_BIGINT, sizeof(int64_t), true},
+        {"INPUT_LOADED_BYTES", TYPE_BIGINT, sizeof(int64_t), true},
+        {"OUTPUT_ROWS", TYPE_BIGINT, sizeof(int64_t), true},
+        {"OUTPUT_BYTES", TYPE_BIGINT, sizeof(int64_t), true},
+        {"MERGED_ROWS", TYPE_BIGINT, sizeof(int64_t), true},
+        {"FILTERED_ROWS", TYPE_BIGINT, sizeof(int64_t), true},
+        {"WRITE_AMPLIFICATION", TYPE_DOUBLE, sizeof(double), true},
+};
+
+SchemaCompactionHistoryScanner::SchemaCompactionHistoryScanner()
+        : SchemaScanner(_s_tbls_columns, TSchemaTableType::SCH_COMPACTION_HISTORY) {}
+
+Status SchemaCompactionHistoryScanner::start(RuntimeState* state) {
+    if (!_is_init) {
+        return Status::InternalError("used before initialized.");
+    }
+    _backend_id = state->backend_id();
+    _records = CompactionHistory::instance()->get_records();
+    return Status::OK();
+}
+
+Status SchemaCompactionHistoryScanner::get_next_block(vectorized::Block* block, bool* eos) {
+    if (!_is_init) {
+        return Status::InternalError("Used before initialized.");
+    }
+    if (nullptr == block || nullptr == eos) {
+        return Status::InternalError("input pointer is nullptr.");
+    }
+
+    if (_records_idx >= _records.size()) {
+        *eos = true;
+        return Status::OK();
+    }
+    *eos = false;
+    return _fill_block_impl(block);
+}
+
+Status SchemaCompactionHistoryScanner::_fill_block_impl(vectorized::Block* block) {
+    SCOPED_TIMER(_fill_block_timer);
+    size_t fill_num = std::min(1000ul, _records.size() - _records_idx);
+    auto begin = _records.begin() + _records_idx;
+    std::vector<void*> datas(fill_num);
+    std::vector<int64_t> srcs(fill_num);
+    std::vector<StringRef> strs(fill_num);
+    auto fill_int = [&](size_t pos, auto get) {
+        for (size_t i = 0; i < fill_num; ++i) {
+            srcs[i] = get(begin[i]);
+            datas[i] = &srcs[i];
+        }
+        return fill_dest_column_for_range(block, pos, datas);
+    };
+    auto fill_string = [&](size_t pos, auto get) {
+        for (size_t i = 0; i < fill_num; ++i) {
+            const std::string& str = get(begin[i]);
+            strs[i] = StringRef(str.data(), str.size());
+            datas[i] = &strs[i];
+        }
+        return fill_dest_column_for_range(block, pos, datas);
+    };
+    using R = const CompactionRecord&;
+    RETURN_IF_ERROR(fill_int(0, [&](R) { return _backend_id; }));
+    RETURN_IF_ERROR(fill_int(1, [](R r) { return r.tablet_id; }));
+    RETURN_IF_ERROR(fill_string(2, [](R r) -> const std::string& { return r.data_dir; }));
+    RETURN_IF_ERROR(fill_string(3, [](R r) -> const std::string& { return r.compaction_type; }));
+    RETURN_IF_ERROR(fill_string(4, [](R r) -> const std::string& { return r.status; }));
+    RETURN_IF_ERROR(fill_int(5, [](R r) { return r.queue_depth; }));
+    RETURN_IF_ERROR(fill_int(6, [](R r) { return r.start_time_ms; }));
+    RETURN_IF_ERROR(fill_int(7, [](R r) { return r.end_time_ms; }));
+    RETURN_IF_ERROR(fill_int(8, [](R r) { return r.prepare_time_us / 1000; }));
+    RETURN_IF_ERROR(fill_int(9, [](R r) { return r.merge_time_us / 1000; }));
+    RETURN_IF_ERROR(fill_int(10, [](R r) { return r.build_time_us / 1000; }));
+    RETURN_IF_ERROR(fill_int(11, [](R r) { return r.modify_time_us / 1000; }));
+    RETURN_IF_ERROR(fill_int(12, [](R r) { return r.input_rowsets; }));
+    RETURN_IF_ERROR(fill_int(13, [](R r) { return r.input_segments; }));
+    RETURN_IF_ERROR(fill_int(14, [](R r) { return r.input_rows; }));
+    RETURN_IF_ERROR(fill_int(15, [](R r) { return r.input_bytes; }));
+    RETURN_IF_ERROR(fill_int(16, [](R r) { return r.input_loaded_bytes; }));
+    RETURN_IF_ERROR(fill_int(17, [](R r) { return r.output_rows; }));
+    RETURN_IF_ERROR(fill_int(18, [](R r) { return r.output_bytes; }));
+    RETURN_IF_ERROR(fill_int(19, [](R r) { return r.merged_rows; }));
+    RETURN_IF_ERROR(fill_int(20, [](R r) { return r.filtered_rows; }));
+    // WRITE_AMPLIFICATION
+    {
+        std::vector<double> amps(fill_num);
+        for (size_t i = 0; i < fill_num; ++i) {
+            amps[i] = begin[i].write_amplification();
+            datas[i] = &amps[i];
+        }
+        RETURN_IF_ERROR(fill_dest_column_for_range(block, 21, datas));
+    }
+    _records_idx += fill_num;
+    return Status::OK();
+}
+} // namespace doris
@@ -0,0 +1,204 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+
+#include "exec/schema_scanner/schema_load_channels_scanner.h"
+
+#include <fmt/format.h>
+#include <gen_cpp/Descriptors_types.h>
+
+#include <algorithm>
+#include <memory>
+
+#include "common/status.h"
+#include "olap/memtable_flush_executor.h"
+#include "runtime/define_primitive_type.h"
+#include "runtime/exec_env.h"
+#include "runtime/load_channel.h"
+#include "runtime/load_channel_mgr.h"
+#include "runtime/runtime_state.h"
+#include "util/runtime_profile.h"
+#include "util/time.h"
+#include "vec/common/string_ref.h"
+
+namespace doris {
+namespace vectorized {
+class Block;
+} // namespace vectorized
+
+std::vector<SchemaScanner::ColumnDesc> SchemaLoadChannelsScanner::_s_tbls_columns = {
+        //   name,       type,          size,     is_null
+        {"BACKEND_ID", TYPE_BIGINT, sizeof(int64_t), true},
+        {"LOAD_ID", TYPE_VARCHAR, sizeof(StringRef), true},
+        {"SENDER_IP", TYPE_VARCHAR, sizeof(StringRef), true},
+        {"IS_HIGH_PRIORITY", TYPE_BOOLEAN, sizeof(bool), true},
+        {"TIMEOUT_S", TYPE_BIGINT, sizeof(int64_t), true},
+        {"LAST_UPDATED_TIME", TYPE_BIGINT, sizeof(int64_t), true},
+        {"MEM_CONSUMPTION", TYPE_BIGINT, sizeof(int64_t), true},
+        {"WRITE_MEM_CONSUMPTION", TYPE_BIGINT, sizeof(int64_t), true},
+        {"NUM_INDEXES", TYPE_BIGINT, sizeof(int64_t), true},
+        {"NUM_TABLETS", TYPE_BIGINT, sizeof(int64_t), true},
+        {"FLUSH_RUNNING", TYPE_BIGINT, sizeof(int64_t), true},
+        {"FLUSH_FINISHED", TYPE_BIGINT, sizeof(int64_t), true},
+        {"FLUSH_BYTES", TYPE_BIGINT, sizeof(int64_t), true},
+        {"FLUSH_DISK_BYTES", TYPE_BIGINT, sizeof(int64_t), true},
+        {"FLUSH_TIME_MS", TYPE_BIGINT, sizeof(int64_t), true},
+        {"FLUSH_WAIT_TIME_MS", TYPE_BIGINT, sizeof(int64_t), true},
+        {"FLUSH_LATENCY_P50_MS", TYPE_BIGINT, sizeof(int64_t), true},
+        {"FLUSH_LATENCY_P99_MS", TYPE_BIGINT, sizeof(int64_t), true},
+        {"FLUSH_LATENCY_HISTOGRAM", TYPE_VARCHAR, sizeof(StringRef), true},
+};
+
+// The upper bound in ms of the latency bucket of the flushes at the percentile.
+static int64_t flush_latency_percentile(const TabletsChannelStats& stats, double percentile) {
+    uint64_t total = 0;
+    for (auto count : stats.flush_latency_buckets) {
+        total += count;
+    }
+    if (total == 0) {
+        return 0;
+    }
+    uint64_t rank = std::max<uint64_t>(1, total * percentile);
+    uint64_t seen = 0;
+    for (int i = 0; i < FlushStatistic::NUM_LATENCY_BUCKETS; ++i) {
+        seen += stats.flush_latency_buckets[i];
+        if (seen >= rank) {
+            return int64_t(1) << i;
+        }
+    }
+    return int64_t(1) << (FlushStatistic::NUM_LATENCY_BUCKETS - 1);
+}
+
+// e.g. "<1ms:3 <4ms:10 >=16384ms:1", the buckets without flushes are omitted
+static std::string flush_latency_histogram(const TabletsChannelStats& stats) {
+    fmt::memory_buffer buf;
+    for (int i = 0; i < FlushStatistic::NUM_LATENCY_BUCKETS; ++i) {
+        uint64_t count = stats.flush_latency_buckets[i];
+        if (count == 0) {
+            continue;
+        }
+        if (buf.size() > 0) {
+            fmt::format_to(buf, " ");
+        }
+        if (i == FlushStatistic::NUM_LATENCY_BUCKETS - 1) {
+            fmt::format_to(buf, ">={}ms:{}", int64_t(1) << (i - 1), count);
+        } else {
+            fmt::format_to(buf, "<{}ms:{}", int64_t(1) << i, count);
+        }
+    }
+    return fmt::to_string(buf);
+}
+
+SchemaLoadChannelsScanner::SchemaLoadChannelsScanner()
+        : SchemaScanner(_s_tbls_columns, TSchemaTableType::SCH_LOAD_CHANNELS) {}
+
+Status SchemaLoadChannelsScanner::start(RuntimeState* state) {
+    if (!_is_init) {
+        return Status::InternalError("used before initialized.");
+    }
+    _backend_id = state->backend_id();
+    LoadChannelMgr* mgr = ExecEnv::GetInstance()->load_channel_mgr();
+    if (mgr == nullptr) {
+        return Status::OK();
+    }
+    for (auto& channel : mgr->get_load_channels()) {
+        LoadChannelInfo info;
+        info.load_id = channel->load_id().to_string();
+        info.sender_ip = channel->sender_ip();
+        info.is_high_priority = channel->is_high_priority();
+        info.timeout_s = channel->timeout();
+        info.last_updated_time = channel->last_updated_time();
+        info.mem_consumption = channel->mem_consumption();
+        info.write_mem_consumption = channel->write_mem_consumption();
+        channel->get_stats(&info.stats);
+        _channels.push_back(std::move(info));
+    }
+    return Status::OK();
+}
+
+Status SchemaLoadChannelsScanner::get_next_block(vectorized::Block* block, bool* eos) {
+    if (!_is_init) {
+        return Status::InternalError("Used before initialized.");
+    }
+    if (nullptr == block || nullptr == eos) {
+        return Status::InternalError("input pointer is nullptr.");
+    }
+
+    if (_channels_idx >= _channels.size()) {
+        *eos = true;
+        return Status::OK();
+    }
+    *eos = false;
+    return _fill_block_impl(block);
+}
+
+Status SchemaLoadChannelsScanner::_fill_block_impl(vectorized::Block* block) {
+    SCOPED_TIMER(_fill_block_timer);
+    size_t fill_num = std::min(1000ul, _channels.size() - _channels_idx);
+    auto begin = _channels.begin() + _channels_idx;
+    std::vector<void*> datas(fill_num);
+    std::vector<int64_t> srcs(fill_num);
+    std::vector<std::string> values(fill_num);
+    std::vector<StringRef> strs(fill_num);
+    auto fill_int = [&](size_t pos, auto get) {
+        for (size_t i = 0; i < fill_num; ++i) {
+            srcs[i] = get(begin[i]);
+            datas[i] = &srcs[i];
+        }
+        return fill_dest_column_for_range(block, pos, datas);
+    };
+    auto fill_string = [&](size_t pos, auto get) {
+        for (size_t i = 0; i < fill_num; ++i) {
+            values[i] = get(begin[i]);
+            strs[i] = StringRef(values[i].data(), values[i].size());
+            datas[i] = &strs[i];
+        }
+        return fill_dest_column_for_range(block, pos, datas);
+    };
+    using C = const LoadChannelInfo&;
+    RETURN_IF_ERROR(fill_int(0, [&](C) { return _backend_id; }));
+    RETURN_IF_ERROR(fill_string(1, [](C c) { return c.load_id; }));
+    RETURN_IF_ERROR(fill_string(2, [](C c) { return c.sender_ip; }));
+    // IS_HIGH_PRIORITY
+    {
+        std::unique_ptr<bool[]> flags(new bool[fill_num]);
+        for (size_t i = 0; i < fill_num; ++i) {
+            flags[i] = begin[i].is_high_priority;
+            datas[i] = &flags[i];
+        }
+        RETURN_IF_ERROR(fill_dest_column_for_range(block, 3, datas));
+    }
+    RETURN_IF_ERROR(fill_int(4, [](C c) { return c.timeout_s; }));
+    RETURN_IF_ERROR(fill_int(5, [](C c) { return c.last_updated_time; }));
+    RETURN_IF_ERROR(fill_int(6, [](C c) { return c.mem_consumption; }));
+    RETURN_IF_ERROR(fill_int(7, [](C c) { return c.write_mem_consumption; }));
+    RETURN_IF_ERROR(fill_int(8, [](C c) { return c.stats.num_indexes; }));
+    RETURN_IF_ERROR(fill_int(9, [](C c) { return c.stats.num_tablets; }));
+    RETURN_IF_ERROR(fill_int(10, [](C c) { return c.stats.flush_running_count; }));
+    RETURN_IF_ERROR(fill_int(11, [](C c) { return c.stats.flush_finish_count; }));
+    RETURN_IF_ERROR(fill_int(12, [](C c) { return c.stats.flush_size_bytes; }));
+    RETURN_IF_ERROR(fill_int(13, [](C c) { return c.stats.flush_disk_size_bytes; }));
+    RETURN_IF_ERROR(fill_int(14, [](C c) { return c.stats.flush_time_ns / NANOS_PER_MILLIS; }));
+    RETURN_IF_ERROR(
+            fill_int(15, [](C c) { return c.stats.flush_wait_time_ns / NANOS_PER_MILLIS; }));
+    RETURN_IF_ERROR(fill_int(16, [](C c) { return flush_latency_percentile(c.stats, 0.5); }));
+    RETURN_IF_ERROR(fill_int(17, [](C c) { return flush_latency_percentile(c.stats, 0.99); }));
+    RETURN_IF_ERROR(fill_string(18, [](C c) { return flush_latency_histogram(c.stats); }));
+    _channels_idx += fill_num;
+    return Status::OK();
+}
+} // namespace doris
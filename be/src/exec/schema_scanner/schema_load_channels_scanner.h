@@ -0,0 +1,66 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "common/status.h"
+#include "exec/schema_scanner.h"
+#include "runtime/tablets_channel.h"
+
+namespace doris {
+class RuntimeState;
+
+namespace vectorized {
+class Block;
+} // namespace vectorized
+
+class SchemaLoadChannelsScanner : public SchemaScanner {
+    ENABLE_FACTORY_CREATOR(SchemaLoadChannelsScanner);
+
+public:
+    SchemaLoadChannelsScanner();
+    ~SchemaLoadChannelsScanner() override = default;
+
+    Status start(RuntimeState* state) override;
+    Status get_next_block(vectorized::Block* block, bool* eos) override;
+
+private:
+    struct LoadChannelInfo {
+        std::string load_id;
+        std::string sender_ip;
+        bool is_high_priority = false;
+        int64_t timeout_s = 0;
+        int64_t last_updated_time = 0;
+        int64_t mem_consumption = 0;
+        int64_t write_mem_consumption = 0;
+        TabletsChannelStats stats;
+    };
+
+    Status _fill_block_impl(vectorized::Block* block);
+
+    static std::vector<SchemaScanner::ColumnDesc> _s_tbls_columns;
+    int64_t _backend_id = 0;
+    size_t _channels_idx = 0;
+    std::vector<LoadChannelInfo> _channels;
+};
+} // namespace doris
@@ -146,6 +146,10 @@ public:
     // - Or'ing with kAlwaysTrueFilter is disallowed.
     Status merge(const BlockBloomFilter& other);
 
+    // Same as merge() with the serialized directory of another filter, which is or'ed into this
+    // filter chunk by chunk instead of being copied into a filter first.
+    Status merge_from_directory(butil::IOBufAsZeroCopyInputStream* data, const size_t data_size);
+
     // Computes out[i] |= in[i] for the arrays 'in' and 'out' of length 'n' bytes where 'n'
     // is multiple of 32-bytes.
     static Status or_equal_array(size_t n, const uint8_t* __restrict__ in,
@@ -245,4 +245,31 @@ Status BlockBloomFilter::merge(const BlockBloomFilter& other) {
     return Status::OK();
 }
 
+Status BlockBloomFilter::merge_from_directory(butil::IOBufAsZeroCopyInputStream* data,
+                                              const size_t data_size) {
+    if (directory_size() != data_size) {
+        return Status::InvalidArgument("Directory size don't match. this: {}, other: {}",
+                                       directory_size(), data_size);
+    }
+    const void* chunk = nullptr;
+    int size = 0;
+    uint8_t* out = reinterpret_cast<uint8_t*>(_directory);
+    while (data->Next(&chunk, &size)) {
+        const uint8_t* in = static_cast<const uint8_t*>(chunk);
+        size_t chunk_size = size;
+        if (out + chunk_size > reinterpret_cast<uint8_t*>(_directory) + data_size) {
+            return Status::InvalidArgument("Directory data is longer than {}", data_size);
+        }
+        // the chunks of an IOBuf are not aligned to buckets
+        size_t simd_size = chunk_size & ~(kBucketByteSize - 1);
+        or_equal_array_internal(simd_size, in, out);
+        for (size_t i = simd_size; i < chunk_size; ++i) {
+            out[i] |= in[i];
+        }
+        out += chunk_size;
+    }
+    _always_false = false;
+    return Status::OK();
+}
+
 } // namespace doris
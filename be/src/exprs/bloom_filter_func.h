@@ -34,6 +34,10 @@ public:
 
     Status merge(BloomFilterAdaptor* other) { return _bloom_filter->merge(*other->_bloom_filter); }
 
+    Status merge(butil::IOBufAsZeroCopyInputStream* data, const size_t data_size) {
+        return _bloom_filter->merge_from_directory(data, data_size);
+    }
+
     Status init(int len) {
         int log_space = log2(len);
         return _bloom_filter->init(log_space, /*hash_seed*/ 0);
@@ -192,6 +196,22 @@ public:
         }
     }
 
+    // Merge the serialized bloom filter of a producer without deserializing it into a filter.
+    Status merge(butil::IOBufAsZeroCopyInputStream* data, const size_t data_size) {
+        std::lock_guard<std::mutex> l(_lock);
+        if (!_inited) {
+            RETURN_IF_ERROR(assign(data, data_size));
+            _inited = true;
+            return Status::OK();
+        }
+        if (static_cast<size_t>(_bloom_filter_alloced) != data_size) {
+            LOG(WARNING) << "bloom filter size not the same: already allocated bytes = "
+                         << _bloom_filter_alloced << ", expected allocated bytes = " << data_size;
+            return Status::InvalidArgument("bloom filter size invalid");
+        }
+        return _bloom_filter->merge(data, data_size);
+    }
+
     Status assign(butil::IOBufAsZeroCopyInputStream* data, const size_t data_size) {
         if (_bloom_filter == nullptr) {
             _bloom_filter.reset(BloomFilterAdaptor::create());
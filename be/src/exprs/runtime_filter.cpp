@@ -33,6 +33,7 @@
 #include <ostream>
 #include <utility>
 
+#include "common/config.h"
 #include "common/logging.h"
 #include "common/object_pool.h"
 #include "common/status.h"
@@ -45,6 +46,7 @@
 #include "runtime/define_primitive_type.h"
 #include "runtime/large_int_value.h"
 #include "runtime/primitive_type.h"
+#include "runtime/runtime_filter_cache.h"
 #include "runtime/runtime_filter_mgr.h"
 #include "util/bitmap_value.h"
 #include "util/runtime_profile.h"
@@ -1129,10 +1131,13 @@ Status IRuntimeFilter::publish() {
         IRuntimeFilter* consumer_filter = nullptr;
         RETURN_IF_ERROR(
                 _state->runtime_filter_mgr()->get_consume_filter(_filter_id, &consumer_filter));
-        // push down
-        consumer_filter->_wrapper = _wrapper;
-        consumer_filter->update_runtime_filter_type_to_profile();
-        consumer_filter->signal();
+        // push down, the consumer which got the filter from cache may be using it already
+        if (!consumer_filter->_from_cache) {
+            consumer_filter->_wrapper = _wrapper;
+            consumer_filter->update_runtime_filter_type_to_profile();
+            consumer_filter->signal();
+        }
+        _insert_to_cache();
         return Status::OK();
     } else {
         TNetworkAddress addr;
@@ -1334,7 +1339,8 @@ Status IRuntimeFilter::init_with_desc(const TRuntimeFilterDesc* desc, const TQue
     params.column_return_type = build_ctx->root()->type().type;
     params.max_in_num = options->runtime_filter_max_in_num;
     // We build runtime filter by exact distinct count iff three conditions are met:
-    // 1. Only 1 join key
+    // 1. The distinct count of the build keys is known. With more than one join key it is the
+    //    count of the distinct key tuples, which is not less than the one of a single key.
     // 2. Do not have remote target (e.g. do not need to merge)
     // 3. Bloom filter
     params.build_bf_exactly = build_bf_exactly && !_has_remote_target &&
@@ -1376,7 +1382,56 @@ Status IRuntimeFilter::init_with_desc(const TRuntimeFilterDesc* desc, const TQue
     } else {
         _wrapper = _pool->add(new RuntimePredicateWrapper(_query_ctx, _pool, &params));
     }
-    return _wrapper->init(&params);
+    RETURN_IF_ERROR(_wrapper->init(&params));
+
+    if (desc->__isset.cache_key && config::enable_runtime_filter_cache &&
+        RuntimeFilterCache::instance() != nullptr) {
+        _cache_key = desc->cache_key;
+        if (is_consumer()) {
+            _apply_cached_filter();
+        }
+    }
+    return Status::OK();
+}
+
+void IRuntimeFilter::_apply_cached_filter() {
+    RuntimeFilterCache::CacheValue value;
+    if (!RuntimeFilterCache::instance()->lookup(_cache_key, &value)) {
+        return;
+    }
+    _wrapper->_context = value.context;
+    if (_runtime_filter_type == RuntimeFilterType::IN_OR_BLOOM_FILTER) {
+        _wrapper->_is_bloomfilter = value.is_bloomfilter;
+    }
+    _from_cache = true;
+    // The filter is just registered and no one is waiting for it, no need to notify.
+    if (_enable_pipeline_exec) {
+        _rf_state_atomic.store(RuntimeFilterState::READY);
+    } else {
+        _rf_state = RuntimeFilterState::READY;
+    }
+}
+
+void IRuntimeFilter::_insert_to_cache() {
+    if (_cache_key.empty() || _is_ignored || _wrapper->is_ignored_in_filter()) {
+        return;
+    }
+    size_t charge = sizeof(RuntimeFilterCache::CacheValue);
+    switch (_wrapper->get_real_type()) {
+    case RuntimeFilterType::IN_FILTER:
+        charge += _wrapper->get_in_filter_size() * sizeof(StringRef);
+        break;
+    case RuntimeFilterType::BLOOM_FILTER:
+        charge += _wrapper->get_bloom_filter_size();
+        break;
+    case RuntimeFilterType::BITMAP_FILTER:
+        charge += _wrapper->get_bitmap_filter()->size() * sizeof(uint64_t);
+        break;
+    default:
+        break;
+    }
+    RuntimeFilterCache::instance()->insert(
+            _cache_key, {_wrapper->_context, _wrapper->is_bloomfilter()}, charge);
 }
 
 Status IRuntimeFilter::serialize(PMergeFilterRequest* request, void** data, int* len) {
@@ -1491,6 +1546,9 @@ void IRuntimeFilter::init_profile(RuntimeProfile* parent_profile) {
     }
     parent_profile->add_child(_profile.get(), true, nullptr);
     _profile->add_info_string("Info", _format_status());
+    if (_from_cache) {
+        _profile->add_info_string("FromCache", "true");
+    }
     if (_runtime_filter_type == RuntimeFilterType::IN_OR_BLOOM_FILTER) {
         update_runtime_filter_type_to_profile();
     }
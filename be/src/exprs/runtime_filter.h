@@ -321,6 +321,11 @@ protected:
 
     void _set_push_down() { _is_push_down = true; }
 
+    // Use the filter published by a previous query with the same build side, see
+    // RuntimeFilterCache.
+    void _apply_cached_filter();
+    void _insert_to_cache();
+
     std::string _format_status() {
         return fmt::format(
                 "[IsPushDown = {}, RuntimeFilterState = {}, IsIgnored = {}, HasRemoteTarget = {}, "
@@ -402,6 +407,11 @@ protected:
     std::mutex _profile_mutex;
     std::string _name;
     bool _opt_remote_rf;
+
+    // not empty only if the runtime filter cache is enabled and FE allows caching the filter
+    std::string _cache_key;
+    // the consumer already got the filter from cache
+    bool _from_cache = false;
 };
 
 // avoid expose RuntimePredicateWrapper
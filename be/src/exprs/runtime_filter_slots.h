@@ -103,10 +103,18 @@ public:
             if (over_max_in_num &&
                 runtime_filter->type() == RuntimeFilterType::IN_OR_BLOOM_FILTER) {
                 runtime_filter->change_to_bloom_filter();
+                _add_decision(filter_desc.filter_id,
+                              fmt::format("bloom filter for in_num({}) >= max_in_num({})",
+                                          hash_table_size, max_in_num));
             }
 
             if (runtime_filter->is_bloomfilter()) {
                 RETURN_IF_ERROR(runtime_filter->init_bloom_filter(build_bf_cardinality));
+                if (auto size = runtime_filter->get_bloomfilter()->get_size(); size > 0) {
+                    _add_decision(filter_desc.filter_id,
+                                  fmt::format("bloom filter of {} bytes for {} distinct keys",
+                                              size, build_bf_cardinality));
+                }
             }
 
             // Note:
@@ -124,6 +132,9 @@ public:
                                << " ignore runtime filter(in filter id " << filter_desc.filter_id
                                << ") because: in_num(" << hash_table_size << ") >= max_in_num("
                                << max_in_num << ")";
+                    _add_decision(filter_desc.filter_id,
+                                  fmt::format("ignored for in_num({}) >= max_in_num({})",
+                                              hash_table_size, max_in_num));
                     ignore_local_filter(filter_desc.filter_id);
                     continue;
                 } else if (!is_in_filter && exists_in_filter) {
@@ -133,6 +144,7 @@ public:
                                << " ignore runtime filter(" << to_string(runtime_filter->type())
                                << " id " << filter_desc.filter_id
                                << ") because: already exists in filter";
+                    _add_decision(filter_desc.filter_id, "ignored for the in filter on the key");
                     ignore_local_filter(filter_desc.filter_id);
                     continue;
                 }
@@ -143,6 +155,9 @@ public:
                         print_id(state->fragment_instance_id()), filter_desc.filter_id,
                         hash_table_size, max_in_num);
                 RETURN_IF_ERROR(ignore_remote_filter(runtime_filter, msg));
+                _add_decision(filter_desc.filter_id,
+                              fmt::format("ignored for in_num({}) >= max_in_num({})",
+                                          hash_table_size, max_in_num));
                 continue;
             }
 
@@ -157,6 +172,35 @@ public:
         return Status::OK();
     }
 
+    // Ignore all the runtime filters instead of building them, e.g. the build side of hash join
+    // is spilled to disk and never fully in memory.
+    // Only the filters with remote target are kept in the slots, to wait for their rpc finishing.
+    Status init_ignored(RuntimeState* state, const std::string& reason) {
+        for (auto& filter_desc : _runtime_filter_descs) {
+            IRuntimeFilter* runtime_filter = nullptr;
+            RETURN_IF_ERROR(state->runtime_filter_mgr()->get_producer_filter(filter_desc.filter_id,
+                                                                             &runtime_filter));
+            DCHECK(runtime_filter != nullptr);
+            if (!runtime_filter->has_remote_target()) {
+                IRuntimeFilter* consumer_filter = nullptr;
+                state->runtime_filter_mgr()->get_consume_filter(filter_desc.filter_id,
+                                                                &consumer_filter);
+                DCHECK(consumer_filter != nullptr);
+                consumer_filter->set_ignored();
+                consumer_filter->signal();
+            } else {
+                std::string msg = fmt::format(
+                        "fragment instance {} ignore runtime filter(id {}) because: {}",
+                        print_id(state->fragment_instance_id()), filter_desc.filter_id, reason);
+                runtime_filter->set_ignored();
+                runtime_filter->set_ignored_msg(msg);
+                RETURN_IF_ERROR(runtime_filter->publish());
+                _runtime_filters[runtime_filter->expr_order()].push_back(runtime_filter);
+            }
+        }
+        return Status::OK();
+    }
+
     void insert(std::unordered_map<const vectorized::Block*, std::vector<int>>& datas) {
         for (int i = 0; i < _build_expr_context.size(); ++i) {
             auto iter = _runtime_filters.find(i);
@@ -247,12 +291,21 @@ public:
 
     bool empty() { return !_runtime_filters.size(); }
 
+    // How the type and size of the filters are chosen for the build side, for the profile.
+    const std::string& decisions() const { return _decisions; }
+
 private:
+    void _add_decision(int filter_id, const std::string& decision) {
+        _decisions.append(fmt::format("{}RF{}: {}", _decisions.empty() ? "" : ", ", filter_id,
+                                      decision));
+    }
+
     const std::vector<std::shared_ptr<ExprCtxType>>& _probe_expr_context;
     const std::vector<std::shared_ptr<ExprCtxType>>& _build_expr_context;
     const std::vector<TRuntimeFilterDesc>& _runtime_filter_descs;
     // prob_contition index -> [IRuntimeFilter]
     std::map<int, std::list<IRuntimeFilter*>> _runtime_filters;
+    std::string _decisions;
 };
 
 using VRuntimeFilterSlots = RuntimeFilterSlotsBase<vectorized::VExprContext>;
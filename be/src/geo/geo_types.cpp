@@ -23,6 +23,7 @@
 #include <s2/s2cap.h>
 #include <s2/s2earth.h>
 #include <s2/s2latlng.h>
+#include <s2/s2latlng_rect.h>
 #include <s2/s2loop.h>
 #include <s2/s2point.h>
 #include <s2/s2polygon.h>
@@ -31,6 +32,7 @@
 #include <s2/util/units/length-units.h>
 #include <string.h>
 // IWYU pragma: no_include <bits/std_abs.h>
+#include <algorithm>
 #include <cmath>
 #include <iomanip>
 #include <sstream>
@@ -79,6 +81,23 @@ static inline GeoParseStatus to_s2point(const GeoCoordinate& coord, S2Point* poi
     return to_s2point(coord.x, coord.y, point);
 }
 
+// The bound of S2 is conservative, expand it a little more to tolerate the rounding error
+// of converting between degrees and radians.
+static bool to_geo_bound(const S2LatLngRect& rect, GeoBound* bound) {
+    static constexpr double MARGIN = 1e-9;
+    if (rect.is_empty()) {
+        return false;
+    }
+    *bound = GeoBound();
+    bound->min_lat = std::max(-90.0, S1Angle::Radians(rect.lat().lo()).degrees() - MARGIN);
+    bound->max_lat = std::min(90.0, S1Angle::Radians(rect.lat().hi()).degrees() + MARGIN);
+    if (!rect.lng().is_full() && !rect.lng().is_inverted()) {
+        bound->min_lng = std::max(-180.0, S1Angle::Radians(rect.lng().lo()).degrees() - MARGIN);
+        bound->max_lng = std::min(180.0, S1Angle::Radians(rect.lng().hi()).degrees() + MARGIN);
+    }
+    return true;
+}
+
 static bool is_loop_closed(const std::vector<S2Point>& points) {
     if (points.empty()) {
         return false;
@@ -347,6 +366,16 @@ bool GeoPoint::ComputeDistance(double x_lng, double x_lat, double y_lng, double
     return true;
 }
 
+bool GeoPoint::ComputeDistanceBound(double lng, double lat, double distance, GeoBound* bound) {
+    S2LatLng center = S2LatLng::FromDegrees(lat, lng);
+    // no point is within a negative distance
+    if (!center.is_valid() || !(distance >= 0)) {
+        return false;
+    }
+    S2Cap cap(center.ToPoint(), S2Earth::ToAngle(util::units::Meters(distance)));
+    return to_geo_bound(cap.GetRectBound(), bound);
+}
+
 bool GeoPoint::ComputeAngleSphere(double x_lng, double x_lat, double y_lng, double y_lat,
                                   double* angle) {
     S2LatLng x = S2LatLng::FromDegrees(x_lat, x_lng);
@@ -495,6 +524,10 @@ bool GeoPolygon::contains(const GeoShape* rhs) const {
     }
 }
 
+bool GeoPolygon::get_bound(GeoBound* bound) const {
+    return to_geo_bound(_polygon->GetRectBound(), bound);
+}
+
 std::double_t GeoPolygon::getArea() const {
     return _polygon->GetArea();
 }
@@ -532,6 +565,10 @@ bool GeoCircle::contains(const GeoShape* rhs) const {
     }
 }
 
+bool GeoCircle::get_bound(GeoBound* bound) const {
+    return to_geo_bound(_cap->GetRectBound(), bound);
+}
+
 void GeoCircle::encode(std::string* buf) {
     Encoder encoder;
     _cap->Encode(&encoder);
@@ -39,6 +39,15 @@ using S2Point = Vector3_d;
 
 namespace doris {
 
+// A longitude and latitude range in degrees. The longitude range covers all when the
+// bounded shape crosses the antimeridian.
+struct GeoBound {
+    double min_lng = -180;
+    double max_lng = 180;
+    double min_lat = -90;
+    double max_lat = 90;
+};
+
 class GeoShape {
 public:
     virtual ~GeoShape() = default;
@@ -60,6 +69,9 @@ public:
     virtual std::string as_wkt() const = 0;
 
     virtual bool contains(const GeoShape* rhs) const { return false; }
+    // Get the bound which covers all the points contained by this shape,
+    // return false if this shape contains nothing.
+    virtual bool get_bound(GeoBound* bound) const { return false; }
     virtual std::string to_string() const { return ""; }
     static std::string as_binary(GeoShape* rhs);
 
@@ -88,6 +100,9 @@ public:
 
     static bool ComputeDistance(double x_lng, double x_lat, double y_lng, double y_lat,
                                 double* distance);
+    // Get the bound of the points within the distance in meters to the point,
+    // return false if the point is invalid.
+    static bool ComputeDistanceBound(double lng, double lat, double distance, GeoBound* bound);
 
     static bool ComputeAngleSphere(double x_lng, double x_lat, double y_lng, double y_lat,
                                    double* angle);
@@ -149,6 +164,7 @@ public:
     const S2Polygon* polygon() const { return _polygon.get(); }
 
     bool contains(const GeoShape* rhs) const override;
+    bool get_bound(GeoBound* bound) const override;
     std::string as_wkt() const override;
 
     int numLoops() const;
@@ -175,6 +191,7 @@ public:
     GeoShapeType type() const override { return GEO_SHAPE_CIRCLE; }
 
     bool contains(const GeoShape* rhs) const override;
+    bool get_bound(GeoBound* bound) const override;
     std::string as_wkt() const override;
 
     double getArea() const;
@@ -0,0 +1,78 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "http/action/cpu_sampler_action.h"
+
+#include <gen_cpp/Types_types.h>
+
+#include <string>
+
+#include "common/config.h"
+#include "http/http_channel.h"
+#include "http/http_request.h"
+#include "http/http_status.h"
+#include "util/cpu_sampler.h"
+#include "util/string_parser.hpp"
+#include "util/time.h"
+#include "util/uid_util.h"
+
+namespace doris {
+
+static const int64_t kDefaultSampleRangeSecs = 600;
+
+void CpuSamplerAction::handle(HttpRequest* req) {
+    if (!config::enable_cpu_sampler) {
+        HttpChannel::send_reply(req, HttpStatus::BAD_REQUEST, "enable_cpu_sampler is off");
+        return;
+    }
+    TUniqueId query_id;
+    query_id.hi = 0;
+    query_id.lo = 0;
+    // parse_id modifies the string
+    std::string query_id_str = req->param("query_id");
+    if (!query_id_str.empty() && !parse_id(query_id_str, &query_id)) {
+        HttpChannel::send_reply(req, HttpStatus::BAD_REQUEST,
+                                "invalid query_id: " + req->param("query_id"));
+        return;
+    }
+    auto parse_int = [&](const std::string& name, int64_t default_value, int64_t* value) {
+        const std::string& str = req->param(name);
+        if (str.empty()) {
+            *value = default_value;
+            return true;
+        }
+        StringParser::ParseResult result;
+        *value = StringParser::string_to_int<int64_t>(str.data(), str.size(), &result);
+        return result == StringParser::PARSE_SUCCESS;
+    };
+    int64_t now = UnixSeconds();
+    int64_t workload_group_id = 0;
+    int64_t start = 0;
+    int64_t end = 0;
+    if (!parse_int("workload_group_id", 0, &workload_group_id) ||
+        !parse_int("start", now - kDefaultSampleRangeSecs, &start) ||
+        !parse_int("end", now, &end)) {
+        HttpChannel::send_reply(req, HttpStatus::BAD_REQUEST,
+                                "invalid workload_group_id, start or end");
+        return;
+    }
+    HttpChannel::send_reply(req, HttpStatus::OK,
+                            CpuSampler::instance()->folded_stacks(query_id, workload_group_id,
+                                                                  start, end));
+}
+
+} // namespace doris
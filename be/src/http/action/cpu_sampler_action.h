@@ -0,0 +1,40 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include "http/http_handler.h"
+
+namespace doris {
+
+class HttpRequest;
+
+// Get the folded stacks of the CPU samples of a query or a workload group from CpuSampler,
+// e.g. for flamegraph.pl. The samples are kept only when enable_cpu_sampler is on.
+// Usage: curl "http://be_host:webserver_port/api/cpu_sampler?query_id=xxx&start=ts&end=ts"
+//   query_id, workload_group_id: optional, all the samples by default
+//   start, end: optional unix seconds, the last 10 minutes by default
+class CpuSamplerAction : public HttpHandler {
+public:
+    CpuSamplerAction() = default;
+
+    ~CpuSamplerAction() override = default;
+
+    void handle(HttpRequest* req) override;
+};
+
+} // namespace doris
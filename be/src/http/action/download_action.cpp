@@ -28,13 +28,43 @@
 #include "http/http_channel.h"
 #include "http/http_request.h"
 #include "http/utils.h"
+#include "io/fs/file_reader.h"
 #include "io/fs/local_file_system.h"
 #include "runtime/exec_env.h"
+#include "util/md5.h"
 
 namespace doris {
 
 const std::string FILE_PARAMETER = "file";
 const std::string TOKEN_PARAMETER = "token";
+const std::string ACQUIRE_MD5_PARAMETER = "acquire_md5";
+
+// Replies the md5 of the file, by which a clone verifies the file downloaded by ranges.
+static void do_md5_response(const std::string& file_path, HttpRequest* req) {
+    io::FileReaderSPtr reader;
+    Status st = io::global_local_filesystem()->open_file(file_path, &reader);
+    if (!st.ok()) {
+        HttpChannel::send_reply(req, HttpStatus::NOT_FOUND, st.to_string());
+        return;
+    }
+    static constexpr size_t BUFFER_SIZE = 1024 * 1024;
+    Md5Digest digest;
+    std::unique_ptr<char[]> buf(new char[BUFFER_SIZE]);
+    size_t offset = 0;
+    while (offset < reader->size()) {
+        size_t bytes_read = 0;
+        st = reader->read_at(offset, Slice(buf.get(), BUFFER_SIZE), &bytes_read);
+        if (!st.ok() || bytes_read == 0) {
+            HttpChannel::send_reply(req, HttpStatus::INTERNAL_SERVER_ERROR,
+                                    st.ok() ? "unexpected end of file" : st.to_string());
+            return;
+        }
+        digest.update(buf.get(), bytes_read);
+        offset += bytes_read;
+    }
+    digest.digest();
+    HttpChannel::send_reply(req, digest.hex());
+}
 
 DownloadAction::DownloadAction(ExecEnv* exec_env, const std::vector<std::string>& allow_dirs,
                                int32_t num_workers)
@@ -102,6 +132,8 @@ void DownloadAction::handle_normal(HttpRequest* req, const std::string& file_par
 
     if (is_dir) {
         do_dir_response(file_param, req);
+    } else if (!req->param(ACQUIRE_MD5_PARAMETER).empty()) {
+        do_md5_response(file_param, req);
     } else {
         do_file_response(file_param, req);
     }
@@ -21,15 +21,19 @@
 #include <shared_mutex>
 #include <sstream>
 #include <string>
+#include <vector>
 
+#include "gutil/strings/split.h"
 #include "http/http_channel.h"
 #include "http/http_headers.h"
 #include "http/http_request.h"
 #include "http/http_status.h"
 #include "io/cache/block/block_file_cache_factory.h"
+#include "olap/file_cache_warm_up_mgr.h"
 #include "olap/olap_define.h"
 #include "olap/tablet_meta.h"
 #include "util/easy_json.h"
+#include "util/string_parser.hpp"
 
 namespace doris {
 
@@ -50,6 +54,50 @@ Status FileCacheAction::_handle_header(HttpRequest* req, std::string* json_metri
         json["released_elements"] = released;
         *json_metrics = json.ToString();
         return Status::OK();
+    } else if (operation == "warm_up") {
+        std::vector<std::string> ids =
+                strings::Split(req->param("tablet_ids"), ",", strings::SkipWhitespace());
+        std::vector<int64_t> tablet_ids;
+        for (const std::string& id : ids) {
+            StringParser::ParseResult result;
+            tablet_ids.push_back(
+                    StringParser::string_to_int<int64_t>(id.data(), id.size(), &result));
+            if (result != StringParser::PARSE_SUCCESS) {
+                return Status::InvalidArgument("invalid tablet id: {}", id);
+            }
+        }
+        if (tablet_ids.empty()) {
+            return Status::InvalidArgument("tablet_ids is empty");
+        }
+        int64_t job_id = 0;
+        RETURN_IF_ERROR(FileCacheWarmUpMgr::instance()->submit(std::move(tablet_ids), &job_id));
+        EasyJson json;
+        json["job_id"] = job_id;
+        *json_metrics = json.ToString();
+        return Status::OK();
+    } else if (operation == "warm_up_progress") {
+        const std::string& id = req->param("job_id");
+        StringParser::ParseResult result;
+        int64_t job_id = StringParser::string_to_int<int64_t>(id.data(), id.size(), &result);
+        if (result != StringParser::PARSE_SUCCESS) {
+            return Status::InvalidArgument("invalid job id: {}", id);
+        }
+        auto job = FileCacheWarmUpMgr::instance()->get_job(job_id);
+        if (job == nullptr) {
+            return Status::NotFound("warm up job {} is not found", job_id);
+        }
+        EasyJson json;
+        json["job_id"] = job_id;
+        json["num_tablets"] = job->tablet_ids.size();
+        json["num_segments"] = job->num_segments.load();
+        json["total_bytes"] = job->total_bytes.load();
+        json["index_bytes"] = job->index_bytes.load();
+        json["data_bytes"] = job->data_bytes.load();
+        json["downloaded_bytes"] = job->downloaded_bytes.load();
+        json["finished"] = job->finished.load();
+        json["status"] = job->status().to_string();
+        *json_metrics = json.ToString();
+        return Status::OK();
     }
     return Status::InternalError("invalid operation: {}", operation);
 }
@@ -0,0 +1,49 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "http/action/pipeline_trace_action.h"
+
+#include <gen_cpp/Types_types.h>
+
+#include <string>
+
+#include "http/http_channel.h"
+#include "http/http_headers.h"
+#include "http/http_request.h"
+#include "http/http_status.h"
+#include "pipeline/pipeline_tracing.h"
+#include "util/uid_util.h"
+
+namespace doris {
+
+const static std::string HEADER_JSON = "application/json";
+
+void PipelineTraceAction::handle(HttpRequest* req) {
+    // parse_id modifies the string
+    std::string query_id_str = req->param("query_id");
+    TUniqueId query_id;
+    if (!parse_id(query_id_str, &query_id)) {
+        HttpChannel::send_reply(req, HttpStatus::BAD_REQUEST,
+                                "invalid query_id: " + req->param("query_id"));
+        return;
+    }
+    std::string result = pipeline::PipelineTracer::instance()->dump_chrome_trace(query_id);
+    req->add_output_header(HttpHeaders::CONTENT_TYPE, HEADER_JSON.c_str());
+    HttpChannel::send_reply(req, HttpStatus::OK, result);
+}
+
+} // namespace doris
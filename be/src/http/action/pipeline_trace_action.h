@@ -0,0 +1,39 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include "http/http_handler.h"
+
+namespace doris {
+
+class HttpRequest;
+
+// Get the timeline of the pipeline tasks of a query as a Chrome trace, which could be opened by
+// chrome://tracing or Perfetto. The runs are recorded only when enable_pipeline_task_tracing
+// is on, see pipeline::PipelineTracer.
+// Usage: curl http://be_host:webserver_port/api/pipeline_trace?query_id=xxx > trace.json
+class PipelineTraceAction : public HttpHandler {
+public:
+    PipelineTraceAction() = default;
+
+    ~PipelineTraceAction() override = default;
+
+    void handle(HttpRequest* req) override;
+};
+
+} // namespace doris
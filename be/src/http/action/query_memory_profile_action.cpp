@@ -0,0 +1,53 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "http/action/query_memory_profile_action.h"
+
+#include <gen_cpp/Types_types.h>
+
+#include <string>
+
+#include "common/status.h"
+#include "http/http_channel.h"
+#include "http/http_request.h"
+#include "http/http_status.h"
+#include "runtime/exec_env.h"
+#include "runtime/memory/mem_tracker_limiter.h"
+#include "util/uid_util.h"
+
+namespace doris {
+
+void QueryMemoryProfileAction::handle(HttpRequest* req) {
+    TUniqueId query_id;
+    // parse_id modifies the string
+    std::string query_id_str = req->param("query_id");
+    if (query_id_str.empty() || !parse_id(query_id_str, &query_id)) {
+        HttpChannel::send_reply(req, HttpStatus::BAD_REQUEST,
+                                "invalid query_id: " + req->param("query_id"));
+        return;
+    }
+    std::string folded_stacks;
+    Status st = MemTrackerLimiter::alloc_profile_folded_stacks(
+            query_id, _exec_env->bfd_parser(), &folded_stacks);
+    if (!st.ok()) {
+        HttpChannel::send_reply(req, HttpStatus::NOT_FOUND, st.to_string());
+        return;
+    }
+    HttpChannel::send_reply(req, HttpStatus::OK, folded_stacks);
+}
+
+} // namespace doris
@@ -0,0 +1,42 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include "http/http_handler.h"
+
+namespace doris {
+
+class ExecEnv;
+class HttpRequest;
+
+// Get the sampled allocation stacks of a running query or load as folded stacks weighted by
+// bytes, recorded when enable_query_memory_profile is on as the query started.
+// Usage: curl "http://be_host:webserver_port/api/query_memory_profile?query_id=xxx-xxx"
+class QueryMemoryProfileAction : public HttpHandler {
+public:
+    explicit QueryMemoryProfileAction(ExecEnv* exec_env) : _exec_env(exec_env) {}
+
+    ~QueryMemoryProfileAction() override = default;
+
+    void handle(HttpRequest* req) override;
+
+private:
+    ExecEnv* _exec_env;
+};
+
+} // namespace doris
@@ -0,0 +1,70 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "http/action/rpc_capture_action.h"
+
+#include <string>
+
+#include "common/status.h"
+#include "http/http_channel.h"
+#include "http/http_headers.h"
+#include "http/http_method.h"
+#include "http/http_request.h"
+#include "http/http_status.h"
+#include "runtime/rpc_capture.h"
+#include "util/easy_json.h"
+#include "util/string_parser.hpp"
+
+namespace doris {
+
+const static std::string HEADER_JSON = "application/json";
+
+void RpcCaptureAction::handle(HttpRequest* req) {
+    const std::string& cmd = req->param("cmd");
+    if (!cmd.empty() && req->method() != HttpMethod::POST) {
+        HttpChannel::send_reply(req, HttpStatus::METHOD_NOT_ALLOWED, "cmd requires POST");
+        return;
+    }
+    Status st;
+    if (cmd == "start") {
+        const std::string& duration = req->param("duration_s");
+        StringParser::ParseResult result;
+        int64_t duration_s =
+                StringParser::string_to_int<int64_t>(duration.data(), duration.size(), &result);
+        if (result != StringParser::PARSE_SUCCESS) {
+            HttpChannel::send_reply(req, HttpStatus::BAD_REQUEST,
+                                    "invalid duration_s: " + duration);
+            return;
+        }
+        st = RpcCapture::instance()->start(duration_s);
+    } else if (cmd == "stop") {
+        st = RpcCapture::instance()->stop();
+    } else if (!cmd.empty()) {
+        HttpChannel::send_reply(req, HttpStatus::BAD_REQUEST, "unknown cmd: " + cmd);
+        return;
+    }
+    if (!st.ok()) {
+        HttpChannel::send_reply(req, HttpStatus::INTERNAL_SERVER_ERROR, st.to_string());
+        return;
+    }
+    EasyJson json;
+    RpcCapture::instance()->to_json(&json);
+    req->add_output_header(HttpHeaders::CONTENT_TYPE, HEADER_JSON.c_str());
+    HttpChannel::send_reply(req, HttpStatus::OK, json.ToString());
+}
+
+} // namespace doris
@@ -0,0 +1,41 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include "http/http_handler.h"
+
+namespace doris {
+
+class HttpRequest;
+
+// Capture the fragment, load and stream load requests received by this BE into a file of
+// rpc_capture_dir, for the replay by rpc_replay_tool.
+// Usage:
+//   curl -X POST "http://be_host:webserver_port/api/rpc_capture?cmd=start&duration_s=60"
+//   curl -X POST "http://be_host:webserver_port/api/rpc_capture?cmd=stop"
+//   curl "http://be_host:webserver_port/api/rpc_capture"
+class RpcCaptureAction : public HttpHandler {
+public:
+    RpcCaptureAction() = default;
+
+    ~RpcCaptureAction() override = default;
+
+    void handle(HttpRequest* req) override;
+};
+
+} // namespace doris
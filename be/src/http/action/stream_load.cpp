@@ -52,8 +52,10 @@
 #include "olap/storage_engine.h"
 #include "runtime/client_cache.h"
 #include "runtime/exec_env.h"
+#include "runtime/group_commit_mgr.h"
 #include "runtime/load_path_mgr.h"
 #include "runtime/message_body_sink.h"
+#include "runtime/rpc_capture.h"
 #include "runtime/stream_load/new_load_stream_mgr.h"
 #include "runtime/stream_load/stream_load_context.h"
 #include "runtime/stream_load/stream_load_executor.h"
@@ -165,6 +167,7 @@ void StreamLoadAction::handle(HttpRequest* req) {
         }
     }
     ctx->load_cost_millis = UnixMillis() - ctx->start_millis;
+    RpcCapture::instance()->capture_stream_load_end(ctx->label);
 
     if (!ctx->status.ok() && !ctx->status.is<PUBLISH_TIMEOUT>()) {
         if (ctx->need_rollback) {
@@ -198,6 +201,11 @@ Status StreamLoadAction::_handle(std::shared_ptr<StreamLoadContext> ctx) {
                      << ", receive_bytes=" << ctx->receive_bytes << ", id=" << ctx->id;
         return Status::InternalError("receive body don't equal with body bytes");
     }
+    if (ctx->group_commit) {
+        auto sink = std::static_pointer_cast<MessageBodyStringSink>(ctx->body_sink);
+        return _exec_env->group_commit_mgr()->append(ctx.get(), ctx->group_commit_request,
+                                                     std::move(sink->data()));
+    }
     if (!ctx->use_streaming) {
         // if we use non-streaming, we need to close file first,
         // then execute_plan_fragment here
@@ -244,6 +252,7 @@ int StreamLoadAction::on_header(HttpRequest* req) {
 
     LOG(INFO) << "new income streaming load request." << ctx->brief() << ", db=" << ctx->db
               << ", tbl=" << ctx->table << "two_phase_commit: " << ctx->two_phase_commit;
+    RpcCapture::instance()->capture_stream_load_begin(req, ctx->label, ctx->db, ctx->table);
 
     auto st = _on_header(req, ctx);
     if (!st.ok()) {
@@ -340,6 +349,9 @@ Status StreamLoadAction::_on_header(HttpRequest* http_req, std::shared_ptr<Strea
     if (!http_req->header(HTTP_COMMENT).empty()) {
         ctx->load_comment = http_req->header(HTTP_COMMENT);
     }
+    if (iequal(http_req->header(HTTP_GROUP_COMMIT), "true")) {
+        return _on_group_commit_header(http_req, ctx);
+    }
     // begin transaction
     int64_t begin_txn_start_time = MonotonicNanos();
     RETURN_IF_ERROR(_exec_env->stream_load_executor()->begin_txn(ctx.get()));
@@ -349,6 +361,59 @@ Status StreamLoadAction::_on_header(HttpRequest* http_req, std::shared_ptr<Strea
     return _process_put(http_req, ctx);
 }
 
+Status StreamLoadAction::_on_group_commit_header(HttpRequest* http_req,
+                                                 std::shared_ptr<StreamLoadContext> ctx) {
+    if (ctx->two_phase_commit) {
+        return Status::InvalidArgument("group commit does not support two phase commit");
+    }
+    if (ctx->body_bytes == 0 || ctx->body_bytes > config::group_commit_max_load_bytes) {
+        return Status::InvalidArgument(
+                "group commit needs a Content-Length of at most {} bytes, data: {}",
+                config::group_commit_max_load_bytes, ctx->body_bytes);
+    }
+    TStreamLoadPutRequest& request = ctx->group_commit_request;
+    request.db = ctx->db;
+    request.tbl = ctx->table;
+    request.formatType = ctx->format;
+    request.__set_compress_type(ctx->compress_type);
+    request.__set_header_type(ctx->header_type);
+    request.fileType = TFileType::FILE_STREAM;
+    RETURN_IF_ERROR(_parse_put_params(http_req, ctx.get(), &request));
+    // the bodies of the loads of a batch are concatenated by lines
+    bool by_line = ctx->format == TFileFormatType::FORMAT_CSV_PLAIN ||
+                   (ctx->format == TFileFormatType::FORMAT_JSON && request.read_json_by_line);
+    if (!by_line || !ctx->header_type.empty() ||
+        (request.__isset.skip_lines && request.skip_lines > 0)) {
+        return Status::InvalidArgument(
+                "group commit only supports plain csv without header lines, or json by line");
+    }
+    ctx->group_commit = true;
+    ctx->body_sink = std::make_shared<MessageBodyStringSink>();
+    return Status::OK();
+}
+
+// The chains of libevent smaller than it are copied into the chunks of the pipe, not to queue
+// too many small buffers.
+static constexpr size_t MIN_ZERO_COPY_CHAIN_SIZE = 4096;
+
+// Moves the first chain of `evbuf` into a buffer referencing its bytes, returns nullptr if the
+// chain is too small to be worth it.
+static ByteBufferPtr move_first_chain(evbuffer* evbuf) {
+    evbuffer_iovec vec;
+    if (evbuffer_peek(evbuf, -1, nullptr, &vec, 1) < 1 ||
+        vec.iov_len < MIN_ZERO_COPY_CHAIN_SIZE) {
+        return nullptr;
+    }
+    size_t size = vec.iov_len;
+    // removing exactly the bytes of the first chain moves the chain instead of copying it
+    evbuffer* chain = evbuffer_new();
+    evbuffer_remove_buffer(evbuf, chain, size);
+    evbuffer_peek(chain, -1, nullptr, &vec, 1);
+    DCHECK_EQ(vec.iov_len, size);
+    return ByteBuffer::reference(static_cast<char*>(vec.iov_base), size,
+                                 [chain]() { evbuffer_free(chain); });
+}
+
 void StreamLoadAction::on_chunk_data(HttpRequest* req) {
     std::shared_ptr<StreamLoadContext> ctx =
             std::static_pointer_cast<StreamLoadContext>(req->handler_ctx());
@@ -360,11 +425,18 @@ void StreamLoadAction::on_chunk_data(HttpRequest* req) {
     auto evbuf = evhttp_request_get_input_buffer(ev_req);
 
     int64_t start_read_data_time = MonotonicNanos();
+    bool zero_copy = config::enable_stream_load_zero_copy && ctx->pipe != nullptr;
     while (evbuffer_get_length(evbuf) > 0) {
-        auto bb = ByteBuffer::allocate(128 * 1024);
-        auto remove_bytes = evbuffer_remove(evbuf, bb->ptr, bb->capacity);
-        bb->pos = remove_bytes;
-        bb->flip();
+        ByteBufferPtr bb = zero_copy ? move_first_chain(evbuf) : nullptr;
+        if (bb == nullptr) {
+            bb = ByteBuffer::allocate(128 * 1024);
+            auto bytes = evbuffer_remove(evbuf, bb->ptr, bb->capacity);
+            bb->pos = bytes;
+            bb->flip();
+        }
+        // the buffer may be consumed by the scanner once appended
+        size_t remove_bytes = bb->remaining();
+        RpcCapture::instance()->capture_stream_load_body(ctx->label, bb->ptr, remove_bytes);
         auto st = ctx->body_sink->append(bb);
         if (!st.ok()) {
             LOG(WARNING) << "append body content failed. errmsg=" << st << ", " << ctx->brief();
@@ -421,6 +493,40 @@ Status StreamLoadAction::_process_put(HttpRequest* http_req,
         request.__set_file_size(ctx->body_bytes);
         ctx->body_sink = file_sink;
     }
+    RETURN_IF_ERROR(_parse_put_params(http_req, ctx.get(), &request));
+
+#ifndef BE_TEST
+    // plan this load
+    TNetworkAddress master_addr = _exec_env->master_info()->network_address;
+    int64_t stream_load_put_start_time = MonotonicNanos();
+    RETURN_IF_ERROR(ThriftRpcHelper::rpc<FrontendServiceClient>(
+            master_addr.hostname, master_addr.port,
+            [&request, ctx](FrontendServiceConnection& client) {
+                client->streamLoadPut(ctx->put_result, request);
+            }));
+    ctx->stream_load_put_cost_nanos = MonotonicNanos() - stream_load_put_start_time;
+#else
+    ctx->put_result = k_stream_load_put_result;
+#endif
+    Status plan_status(ctx->put_result.status);
+    if (!plan_status.ok()) {
+        LOG(WARNING) << "plan streaming load failed. errmsg=" << plan_status << ctx->brief();
+        return plan_status;
+    }
+
+    VLOG_NOTICE << "params is " << apache::thrift::ThriftDebugString(ctx->put_result.params);
+    // if we not use streaming, we must download total content before we begin
+    // to process this load
+    if (!ctx->use_streaming) {
+        return Status::OK();
+    }
+
+    return _exec_env->stream_load_executor()->execute_plan_fragment(ctx);
+}
+
+Status StreamLoadAction::_parse_put_params(HttpRequest* http_req, StreamLoadContext* ctx,
+                                           TStreamLoadPutRequest* put_request) {
+    TStreamLoadPutRequest& request = *put_request;
     if (!http_req->header(HTTP_COLUMNS).empty()) {
         request.__set_columns(http_req->header(HTTP_COLUMNS));
     }
@@ -599,34 +705,7 @@ Status StreamLoadAction::_process_put(HttpRequest* http_req,
             request.__set_partial_update(false);
         }
     }
-
-#ifndef BE_TEST
-    // plan this load
-    TNetworkAddress master_addr = _exec_env->master_info()->network_address;
-    int64_t stream_load_put_start_time = MonotonicNanos();
-    RETURN_IF_ERROR(ThriftRpcHelper::rpc<FrontendServiceClient>(
-            master_addr.hostname, master_addr.port,
-            [&request, ctx](FrontendServiceConnection& client) {
-                client->streamLoadPut(ctx->put_result, request);
-            }));
-    ctx->stream_load_put_cost_nanos = MonotonicNanos() - stream_load_put_start_time;
-#else
-    ctx->put_result = k_stream_load_put_result;
-#endif
-    Status plan_status(ctx->put_result.status);
-    if (!plan_status.ok()) {
-        LOG(WARNING) << "plan streaming load failed. errmsg=" << plan_status << ctx->brief();
-        return plan_status;
-    }
-
-    VLOG_NOTICE << "params is " << apache::thrift::ThriftDebugString(ctx->put_result.params);
-    // if we not use streaming, we must download total content before we begin
-    // to process this load
-    if (!ctx->use_streaming) {
-        return Status::OK();
-    }
-
-    return _exec_env->stream_load_executor()->execute_plan_fragment(ctx);
+    return Status::OK();
 }
 
 Status StreamLoadAction::_data_saved_path(HttpRequest* req, std::string* file_path) {
@@ -29,6 +29,7 @@ class ExecEnv;
 class Status;
 class StreamLoadContext;
 class HttpRequest;
+class TStreamLoadPutRequest;
 
 class StreamLoadAction : public HttpHandler {
 public:
@@ -49,6 +50,10 @@ private:
     Status _handle(std::shared_ptr<StreamLoadContext> ctx);
     Status _data_saved_path(HttpRequest* req, std::string* file_path);
     Status _process_put(HttpRequest* http_req, std::shared_ptr<StreamLoadContext> ctx);
+    // the params of the put request from the headers
+    Status _parse_put_params(HttpRequest* http_req, StreamLoadContext* ctx,
+                             TStreamLoadPutRequest* request);
+    Status _on_group_commit_header(HttpRequest* http_req, std::shared_ptr<StreamLoadContext> ctx);
     void _save_stream_load_record(std::shared_ptr<StreamLoadContext> ctx, const std::string& str);
 
 private:
@@ -17,6 +17,7 @@
 
 #include "http/http_client.h"
 
+#include <fcntl.h>
 #include <glog/logging.h>
 #include <unistd.h>
 
@@ -24,6 +25,7 @@
 #include <ostream>
 
 #include "common/config.h"
+#include "http/http_status.h"
 #include "util/stack_util.h"
 
 namespace doris {
@@ -165,6 +167,13 @@ Status HttpClient::execute_delete_request(const std::string& payload, std::strin
     return execute(response);
 }
 
+Status HttpClient::execute_put_request(const std::string& payload, std::string* response) {
+    // CURLOPT_UPLOAD of set_method(PUT) reads the body by a callback
+    curl_easy_setopt(_curl, CURLOPT_CUSTOMREQUEST, "PUT");
+    set_payload(payload);
+    return execute(response);
+}
+
 Status HttpClient::execute(const std::function<bool(const void* data, size_t length)>& callback) {
     _callback = &callback;
     auto code = curl_easy_perform(_curl);
@@ -207,6 +216,65 @@ Status HttpClient::download(const std::string& local_path) {
     return status;
 }
 
+Status HttpClient::download_range(const std::string& local_path, uint64_t offset, uint64_t size,
+                                  uint64_t* downloaded,
+                                  const std::function<void(size_t length)>& before_write) {
+    if (*downloaded >= size) {
+        return Status::OK();
+    }
+    set_method(GET);
+    curl_easy_setopt(_curl, CURLOPT_LOW_SPEED_LIMIT, config::download_low_speed_limit_kbps * 1024);
+    curl_easy_setopt(_curl, CURLOPT_LOW_SPEED_TIME, config::download_low_speed_time);
+    curl_easy_setopt(_curl, CURLOPT_MAX_RECV_SPEED_LARGE, config::max_download_speed_kbps * 1024);
+    std::string range = fmt::format("{}-{}", offset + *downloaded, offset + size - 1);
+    curl_easy_setopt(_curl, CURLOPT_RANGE, range.c_str());
+
+    int fd = open(local_path.c_str(), O_WRONLY | O_CREAT, 0644);
+    if (fd < 0) {
+        LOG(WARNING) << "open file failed, file=" << local_path;
+        return Status::InternalError("open file failed");
+    }
+    Status status;
+    auto callback = [&](const void* data, size_t length) {
+        if (get_http_status() != HttpStatus::PARTIAL_CONTENT) {
+            status = Status::NotSupported("range download is not supported by source");
+            return false;
+        }
+        if (*downloaded + length > size) {
+            status = Status::InternalError("received more bytes than the range {}", range);
+            return false;
+        }
+        if (before_write) {
+            before_write(length);
+        }
+        const char* buf = static_cast<const char*>(data);
+        while (length > 0) {
+            ssize_t res = pwrite(fd, buf, length, offset + *downloaded);
+            if (res < 0) {
+                if (errno == EINTR) {
+                    continue;
+                }
+                LOG(WARNING) << "fail to write data to file, file=" << local_path
+                             << ", error=" << errno;
+                status = Status::InternalError("fail to write data when download");
+                return false;
+            }
+            buf += res;
+            length -= res;
+            *downloaded += res;
+        }
+        return true;
+    };
+    Status st = execute(callback);
+    close(fd);
+    RETURN_IF_ERROR(status);
+    RETURN_IF_ERROR(st);
+    if (*downloaded != size) {
+        return Status::InternalError("downloaded {} bytes of the range {}", *downloaded, range);
+    }
+    return Status::OK();
+}
+
 Status HttpClient::execute(std::string* response) {
     auto callback = [response](const void* data, size_t length) {
         response->append((char*)data, length);
@@ -73,10 +73,11 @@ public:
         curl_easy_setopt(_curl, CURLOPT_SSL_VERIFYHOST, 0L);
     }
 
-    // TODO(zc): support set header
-    // void set_header(const std::string& key, const std::string& value) {
-    // _cntl.http_request().SetHeader(key, value);
-    // }
+    void set_header(const std::string& key, const std::string& value) {
+        std::string scratch_str = key + ": " + value;
+        _header_list = curl_slist_append(_header_list, scratch_str.c_str());
+        curl_easy_setopt(_curl, CURLOPT_HTTPHEADER, _header_list);
+    }
 
     std::string get_response_content_type() {
         char* ct = nullptr;
@@ -131,10 +132,23 @@ public:
     // a file to local_path
     Status download(const std::string& local_path);
 
+    // Downloads the bytes [offset, offset + size) of the file into the same range of local_path,
+    // which is not truncated, so the ranges of a file can be downloaded concurrently. The
+    // download starts after the *downloaded bytes of the range already written and adds the
+    // bytes written to it, so a failed download is resumed by calling it again.
+    // `before_write` is called with the length of each piece received before writing it.
+    // Returns NotSupported if the source ignores the range and sends the whole file.
+    Status download_range(const std::string& local_path, uint64_t offset, uint64_t size,
+                          uint64_t* downloaded,
+                          const std::function<void(size_t length)>& before_write = {});
+
     Status execute_post_request(const std::string& payload, std::string* response);
 
     Status execute_delete_request(const std::string& payload, std::string* response);
 
+    // a PUT with the payload in memory, e.g. the body of a stream load
+    Status execute_put_request(const std::string& payload, std::string* response);
+
     // execute a simple method, and its response is saved in response argument
     Status execute(std::string* response);
 
@@ -22,6 +22,8 @@
 #include <sys/stat.h>
 #include <unistd.h>
 
+#include <algorithm>
+#include <cstdlib>
 #include <memory>
 #include <ostream>
 #include <vector>
@@ -120,6 +122,39 @@ std::string get_content_type(const std::string& file_name) {
     return "";
 }
 
+// Parses a single range "bytes=<first>-[<last>]" of a file, the ranges of the clone downloads.
+static bool parse_range(const std::string& range_header, int64_t file_size, int64_t* offset,
+                        int64_t* length) {
+    static const std::string PREFIX = "bytes=";
+    if (range_header.compare(0, PREFIX.size(), PREFIX) != 0) {
+        return false;
+    }
+    std::string range = range_header.substr(PREFIX.size());
+    size_t dash = range.find('-');
+    if (dash == std::string::npos || dash == 0 || range.find(',') != std::string::npos) {
+        return false;
+    }
+    char* end = nullptr;
+    int64_t first = strtoll(range.c_str(), &end, 10);
+    if (end != range.c_str() + dash) {
+        return false;
+    }
+    int64_t last = file_size - 1;
+    if (dash + 1 < range.size()) {
+        last = strtoll(range.c_str() + dash + 1, &end, 10);
+        if (*end != '\0') {
+            return false;
+        }
+        last = std::min(last, file_size - 1);
+    }
+    if (first < 0 || first > last) {
+        return false;
+    }
+    *offset = first;
+    *length = last - first + 1;
+    return true;
+}
+
 void do_file_response(const std::string& file_path, HttpRequest* req) {
     if (file_path.find("..") != std::string::npos) {
         LOG(WARNING) << "Not allowed to read relative path: " << file_path;
@@ -146,14 +181,27 @@ void do_file_response(const std::string& file_path, HttpRequest* req) {
     int64_t file_size = st.st_size;
 
     // TODO(lingbin): process "IF_MODIFIED_SINCE" header
-    // TODO(lingbin): process "RANGE" header
+    req->add_output_header(HttpHeaders::CONTENT_TYPE, get_content_type(file_path).c_str());
+    req->add_output_header(HttpHeaders::ACCEPT_RANGES, "bytes");
+
     const std::string& range_header = req->header(HttpHeaders::RANGE);
-    if (!range_header.empty()) {
-        // analyse range header
+    if (!range_header.empty() && req->method() != HttpMethod::HEAD) {
+        int64_t offset = 0;
+        int64_t length = 0;
+        if (!parse_range(range_header, file_size, &offset, &length)) {
+            close(fd);
+            req->add_output_header(HttpHeaders::CONTENT_RANGE,
+                                   fmt::format("bytes */{}", file_size).c_str());
+            HttpChannel::send_error(req, HttpStatus::REQUESTED_RANGE_NOT_SATISFIED);
+            return;
+        }
+        req->add_output_header(
+                HttpHeaders::CONTENT_RANGE,
+                fmt::format("bytes {}-{}/{}", offset, offset + length - 1, file_size).c_str());
+        HttpChannel::send_file(req, fd, offset, length, HttpStatus::PARTIAL_CONTENT);
+        return;
     }
 
-    req->add_output_header(HttpHeaders::CONTENT_TYPE, get_content_type(file_path).c_str());
-
     if (req->method() == HttpMethod::HEAD) {
         close(fd);
         req->add_output_header(HttpHeaders::CONTENT_LENGTH, std::to_string(file_size).c_str());
@@ -36,13 +36,14 @@ namespace fs = std::filesystem;
 namespace doris {
 namespace io {
 
-IFileCache::IFileCache(const std::string& cache_base_path, const FileCacheSettings& cache_settings)
+IFileCache::IFileCache(const std::string& cache_base_path, const FileCacheSettings& cache_settings,
+                       const std::string& size_metric_name)
         : _cache_base_path(cache_base_path),
           _total_size(cache_settings.total_size),
           _max_file_segment_size(cache_settings.max_file_segment_size),
           _max_query_cache_size(cache_settings.max_query_cache_size) {
     _cur_size_metrics =
-            std::make_shared<bvar::Status<size_t>>(_cache_base_path.c_str(), "cur_size", 0);
+            std::make_shared<bvar::Status<size_t>>(_cache_base_path.c_str(), size_metric_name, 0);
 }
 
 std::string IFileCache::Key::to_string() const {
@@ -113,7 +114,7 @@ IFileCache::QueryFileCacheContextHolderPtr IFileCache::get_query_context_holder(
 }
 
 IFileCache::QueryFileCacheContextPtr IFileCache::get_query_context(
-        const TUniqueId& query_id, std::lock_guard<std::mutex>& cache_lock) {
+        const TUniqueId& query_id, std::lock_guard<CacheMutex>& cache_lock) {
     auto query_iter = _query_map.find(query_id);
     return (query_iter == _query_map.end()) ? nullptr : query_iter->second;
 }
@@ -128,7 +129,7 @@ void IFileCache::remove_query_context(const TUniqueId& query_id) {
 }
 
 IFileCache::QueryFileCacheContextPtr IFileCache::get_or_set_query_context(
-        const TUniqueId& query_id, std::lock_guard<std::mutex>& cache_lock) {
+        const TUniqueId& query_id, std::lock_guard<CacheMutex>& cache_lock) {
     if (query_id.lo == 0 && query_id.hi == 0) {
         return nullptr;
     }
@@ -144,7 +145,7 @@ IFileCache::QueryFileCacheContextPtr IFileCache::get_or_set_query_context(
 }
 
 void IFileCache::QueryFileCacheContext::remove(const Key& key, size_t offset,
-                                               std::lock_guard<std::mutex>& cache_lock) {
+                                               std::lock_guard<CacheMutex>& cache_lock) {
     auto pair = std::make_pair(key, offset);
     auto record = records.find(pair);
     DCHECK(record != records.end());
@@ -154,7 +155,7 @@ void IFileCache::QueryFileCacheContext::remove(const Key& key, size_t offset,
 }
 
 void IFileCache::QueryFileCacheContext::reserve(const Key& key, size_t offset, size_t size,
-                                                std::lock_guard<std::mutex>& cache_lock) {
+                                                std::lock_guard<CacheMutex>& cache_lock) {
     auto pair = std::make_pair(key, offset);
     if (records.find(pair) == records.end()) {
         auto queue_iter = lru_queue.add(key, offset, size, cache_lock);
@@ -39,6 +39,7 @@
 #include "io/cache/block/block_file_cache_settings.h"
 #include "io/io_common.h"
 #include "util/hash_util.hpp"
+#include "util/lock_profiler.h"
 #include "vec/common/uint128.h"
 
 namespace doris {
@@ -48,6 +49,8 @@ class FileBlock;
 using FileBlockSPtr = std::shared_ptr<FileBlock>;
 using FileBlocks = std::list<FileBlockSPtr>;
 struct FileBlocksHolder;
+// the lock of the cache, taken by the functions with a `cache_lock` parameter
+using CacheMutex = ProfiledMutex<std::mutex>;
 
 enum CacheType {
     INDEX,
@@ -94,7 +97,8 @@ public:
         bool operator==(const Key& other) const { return key == other.key; }
     };
 
-    IFileCache(const std::string& cache_base_path, const FileCacheSettings& cache_settings);
+    IFileCache(const std::string& cache_base_path, const FileCacheSettings& cache_settings,
+               const std::string& size_metric_name = "cur_size");
 
     virtual ~IFileCache() = default;
 
@@ -137,6 +141,9 @@ public:
 
     virtual size_t get_file_segments_num(CacheType type) const = 0;
 
+    /// The downloaded bytes of the file blocks which intersect with [offset, offset + size).
+    virtual size_t get_cached_size(const Key& key, size_t offset, size_t size) const = 0;
+
     static std::string cache_type_to_string(CacheType type);
     static CacheType string_to_cache_type(const std::string& str);
 
@@ -153,12 +160,12 @@ protected:
 
     bool _is_initialized = false;
 
-    mutable std::mutex _mutex;
+    mutable CacheMutex _mutex {"LRUFileCache::_mutex"};
 
     virtual bool try_reserve(const Key& key, const CacheContext& context, size_t offset,
-                             size_t size, std::lock_guard<std::mutex>& cache_lock) = 0;
+                             size_t size, std::lock_guard<CacheMutex>& cache_lock) = 0;
 
-    virtual void remove(FileBlockSPtr file_segment, std::lock_guard<std::mutex>& cache_lock,
+    virtual void remove(FileBlockSPtr file_segment, std::lock_guard<CacheMutex>& cache_lock,
                         std::lock_guard<std::mutex>& segment_lock) = 0;
 
     class LRUQueue {
@@ -182,30 +189,30 @@ protected:
         size_t get_max_size() const { return max_size; }
         size_t get_max_element_size() const { return max_element_size; }
 
-        size_t get_total_cache_size(std::lock_guard<std::mutex>& /* cache_lock */) const {
+        size_t get_total_cache_size(std::lock_guard<CacheMutex>& /* cache_lock */) const {
             return cache_size;
         }
 
-        size_t get_elements_num(std::lock_guard<std::mutex>& /* cache_lock */) const {
+        size_t get_elements_num(std::lock_guard<CacheMutex>& /* cache_lock */) const {
             return queue.size();
         }
 
         Iterator add(const Key& key, size_t offset, size_t size,
-                     std::lock_guard<std::mutex>& cache_lock);
+                     std::lock_guard<CacheMutex>& cache_lock);
 
-        void remove(Iterator queue_it, std::lock_guard<std::mutex>& cache_lock);
+        void remove(Iterator queue_it, std::lock_guard<CacheMutex>& cache_lock);
 
-        void move_to_end(Iterator queue_it, std::lock_guard<std::mutex>& cache_lock);
+        void move_to_end(Iterator queue_it, std::lock_guard<CacheMutex>& cache_lock);
 
-        std::string to_string(std::lock_guard<std::mutex>& cache_lock) const;
+        std::string to_string(std::lock_guard<CacheMutex>& cache_lock) const;
 
-        bool contains(const Key& key, size_t offset, std::lock_guard<std::mutex>& cache_lock) const;
+        bool contains(const Key& key, size_t offset, std::lock_guard<CacheMutex>& cache_lock) const;
 
         Iterator begin() { return queue.begin(); }
 
         Iterator end() { return queue.end(); }
 
-        void remove_all(std::lock_guard<std::mutex>& cache_lock);
+        void remove_all(std::lock_guard<CacheMutex>& cache_lock);
 
         int64_t get_hot_data_interval() const { return hot_data_interval; }
 
@@ -237,14 +244,14 @@ protected:
 
         QueryFileCacheContext(size_t max_cache_size) : max_cache_size(max_cache_size) {}
 
-        void remove(const Key& key, size_t offset, std::lock_guard<std::mutex>& cache_lock);
+        void remove(const Key& key, size_t offset, std::lock_guard<CacheMutex>& cache_lock);
 
         void reserve(const Key& key, size_t offset, size_t size,
-                     std::lock_guard<std::mutex>& cache_lock);
+                     std::lock_guard<CacheMutex>& cache_lock);
 
         size_t get_max_cache_size() const { return max_cache_size; }
 
-        size_t get_cache_size(std::lock_guard<std::mutex>& cache_lock) const {
+        size_t get_cache_size(std::lock_guard<CacheMutex>& cache_lock) const {
             return lru_queue.get_total_cache_size(cache_lock);
         }
 
@@ -259,12 +266,12 @@ protected:
     bool _enable_file_cache_query_limit = config::enable_file_cache_query_limit;
 
     QueryFileCacheContextPtr get_query_context(const TUniqueId& query_id,
-                                               std::lock_guard<std::mutex>&);
+                                               std::lock_guard<CacheMutex>&);
 
     void remove_query_context(const TUniqueId& query_id);
 
     QueryFileCacheContextPtr get_or_set_query_context(const TUniqueId& query_id,
-                                                      std::lock_guard<std::mutex>&);
+                                                      std::lock_guard<CacheMutex>&);
 
 public:
     /// Save a query context information, and adopt different cache policies
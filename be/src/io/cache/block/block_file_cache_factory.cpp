@@ -51,11 +51,15 @@ size_t FileCacheFactory::try_release() {
 }
 
 size_t FileCacheFactory::try_release(const std::string& base_path) {
-    auto iter = _path_to_cache.find(base_path);
-    if (iter != _path_to_cache.end()) {
-        return iter->second->try_release();
+    auto iter = _path_to_index.find(base_path);
+    if (iter == _path_to_index.end()) {
+        return 0;
     }
-    return 0;
+    size_t elements = 0;
+    for (auto* shard : _path_shards[iter->second]) {
+        elements += shard->try_release();
+    }
+    return elements;
 }
 
 Status FileCacheFactory::create_file_cache(const std::string& cache_base_path,
@@ -69,27 +73,48 @@ Status FileCacheFactory::create_file_cache(const std::string& cache_base_path,
         }
     }
 
-    std::unique_ptr<IFileCache> cache =
-            std::make_unique<LRUFileCache>(cache_base_path, file_cache_settings);
-    RETURN_IF_ERROR(cache->initialize());
-    _path_to_cache[cache_base_path] = cache.get();
-    _caches.push_back(std::move(cache));
+    // the shards split the capacity of the path evenly
+    size_t num_shards = config::file_cache_num_shards_per_path;
+    FileCacheSettings shard_settings = file_cache_settings;
+    shard_settings.total_size /= num_shards;
+    shard_settings.disposable_queue_size /= num_shards;
+    shard_settings.disposable_queue_elements /= num_shards;
+    shard_settings.index_queue_size /= num_shards;
+    shard_settings.index_queue_elements /= num_shards;
+    shard_settings.query_queue_size /= num_shards;
+    shard_settings.query_queue_elements /= num_shards;
+    shard_settings.max_query_cache_size /= num_shards;
+    std::vector<CloudFileCachePtr> shards;
+    for (size_t i = 0; i < num_shards; ++i) {
+        std::unique_ptr<IFileCache> cache =
+                std::make_unique<LRUFileCache>(cache_base_path, shard_settings, i, num_shards);
+        RETURN_IF_ERROR(cache->initialize());
+        shards.push_back(cache.get());
+        _caches.push_back(std::move(cache));
+    }
+    _path_to_index[cache_base_path] = _path_shards.size();
+    _path_shards.push_back(std::move(shards));
     LOG(INFO) << "[FileCache] path: " << cache_base_path
-              << " total_size: " << file_cache_settings.total_size;
+              << " total_size: " << file_cache_settings.total_size << " shards: " << num_shards;
     return Status::OK();
 }
 
+// The shard in a path is chosen by the low part of the hash, which is the same as the one
+// used to load the cached files of the path, see LRUFileCache.
 CloudFileCachePtr FileCacheFactory::get_by_path(const IFileCache::Key& key) {
-    return _caches[KeyHash()(key) % _caches.size()].get();
+    size_t hash = KeyHash()(key);
+    const auto& shards = _path_shards[hash / _path_shards[0].size() % _path_shards.size()];
+    return shards[hash % shards.size()];
 }
 
-CloudFileCachePtr FileCacheFactory::get_by_path(const std::string& cache_base_path) {
-    auto iter = _path_to_cache.find(cache_base_path);
-    if (iter == _path_to_cache.end()) {
+CloudFileCachePtr FileCacheFactory::get_by_path(const std::string& cache_base_path,
+                                                const IFileCache::Key& key) {
+    auto iter = _path_to_index.find(cache_base_path);
+    if (iter == _path_to_index.end()) {
         return nullptr;
-    } else {
-        return iter->second;
     }
+    const auto& shards = _path_shards[iter->second];
+    return shards[KeyHash()(key) % shards.size()];
 }
 
 std::vector<IFileCache::QueryFileCacheContextHolderPtr> FileCacheFactory::get_query_context_holders(
@@ -22,6 +22,7 @@
 
 #include <memory>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 #include "common/status.h"
@@ -47,7 +48,8 @@ public:
     size_t try_release(const std::string& base_path);
 
     CloudFileCachePtr get_by_path(const IFileCache::Key& key);
-    CloudFileCachePtr get_by_path(const std::string& cache_base_path);
+    // get the shard of the key in the cache of cache_base_path
+    CloudFileCachePtr get_by_path(const std::string& cache_base_path, const IFileCache::Key& key);
     std::vector<IFileCache::QueryFileCacheContextHolderPtr> get_query_context_holders(
             const TUniqueId& query_id);
     FileCacheFactory() = default;
@@ -56,7 +58,9 @@ public:
 
 private:
     std::vector<std::unique_ptr<IFileCache>> _caches;
-    std::unordered_map<std::string, CloudFileCachePtr> _path_to_cache;
+    // the shards of each path, in the order of the paths created
+    std::vector<std::vector<CloudFileCachePtr>> _path_shards;
+    std::unordered_map<std::string, size_t> _path_to_index;
 };
 
 } // namespace io
@@ -74,8 +74,12 @@ DEFINE_GAUGE_METRIC_PROTOTYPE_2ARG(file_cache_disposable_queue_max_elements, Met
 DEFINE_GAUGE_METRIC_PROTOTYPE_2ARG(file_cache_disposable_queue_curr_elements, MetricUnit::NOUNIT);
 
 LRUFileCache::LRUFileCache(const std::string& cache_base_path,
-                           const FileCacheSettings& cache_settings)
-        : IFileCache(cache_base_path, cache_settings) {
+                           const FileCacheSettings& cache_settings, size_t shard_id,
+                           size_t num_shards)
+        : IFileCache(cache_base_path, cache_settings,
+                     num_shards > 1 ? fmt::format("cur_size_shard_{}", shard_id) : "cur_size"),
+          _shard_id(shard_id),
+          _num_shards(num_shards) {
     _disposable_queue = LRUQueue(cache_settings.disposable_queue_size,
                                  cache_settings.disposable_queue_elements, 60 * 60);
     _index_queue = LRUQueue(cache_settings.index_queue_size, cache_settings.index_queue_elements,
@@ -83,8 +87,12 @@ LRUFileCache::LRUFileCache(const std::string& cache_base_path,
     _normal_queue = LRUQueue(cache_settings.query_queue_size, cache_settings.query_queue_elements,
                              24 * 60 * 60);
 
-    _entity = DorisMetrics::instance()->metric_registry()->register_entity(
-            "lru_file_cache", {{"path", _cache_base_path}});
+    Labels labels {{"path", _cache_base_path}};
+    if (_num_shards > 1) {
+        labels.emplace("shard", std::to_string(_shard_id));
+    }
+    _entity = DorisMetrics::instance()->metric_registry()->register_entity("lru_file_cache",
+                                                                           labels);
     _entity->register_hook(_cache_base_path, std::bind(&LRUFileCache::update_cache_metrics, this));
 
     INT_DOUBLE_METRIC_REGISTER(_entity, file_cache_hits_ratio);
@@ -147,7 +155,7 @@ Status LRUFileCache::initialize() {
 }
 
 void LRUFileCache::use_cell(const FileBlockCell& cell, FileBlocks& result, bool move_iter_flag,
-                            std::lock_guard<std::mutex>& cache_lock) {
+                            std::lock_guard<CacheMutex>& cache_lock) {
     auto file_block = cell.file_block;
     auto& queue = get_queue(cell.cache_type);
     DCHECK(!(file_block->is_downloaded() &&
@@ -167,7 +175,7 @@ void LRUFileCache::use_cell(const FileBlockCell& cell, FileBlocks& result, bool
 }
 
 LRUFileCache::FileBlockCell* LRUFileCache::get_cell(const Key& key, size_t offset,
-                                                    std::lock_guard<std::mutex>& /* cache_lock */) {
+                                                    std::lock_guard<CacheMutex>& /* cache_lock */) {
     auto it = _files.find(key);
     if (it == _files.end()) {
         return nullptr;
@@ -188,7 +196,7 @@ bool LRUFileCache::need_to_move(CacheType cell_type, CacheType query_type) const
 
 FileBlocks LRUFileCache::get_impl(const Key& key, const CacheContext& context,
                                   const FileBlock::Range& range,
-                                  std::lock_guard<std::mutex>& cache_lock) {
+                                  std::lock_guard<CacheMutex>& cache_lock) {
     /// Given range = [left, right] and non-overlapping ordered set of file segments,
     /// find list [segment1, ..., segmentN] of segments which intersect with given range.
     auto it = _files.find(key);
@@ -270,7 +278,7 @@ FileBlocks LRUFileCache::get_impl(const Key& key, const CacheContext& context,
 
 FileBlocks LRUFileCache::split_range_into_cells(const Key& key, const CacheContext& context,
                                                 size_t offset, size_t size, FileBlock::State state,
-                                                std::lock_guard<std::mutex>& cache_lock) {
+                                                std::lock_guard<CacheMutex>& cache_lock) {
     DCHECK(size > 0);
 
     auto current_pos = offset;
@@ -309,7 +317,7 @@ FileBlocks LRUFileCache::split_range_into_cells(const Key& key, const CacheConte
 void LRUFileCache::fill_holes_with_empty_file_blocks(FileBlocks& file_blocks, const Key& key,
                                                      const CacheContext& context,
                                                      const FileBlock::Range& range,
-                                                     std::lock_guard<std::mutex>& cache_lock) {
+                                                     std::lock_guard<CacheMutex>& cache_lock) {
     /// There are segments [segment1, ..., segmentN]
     /// (non-overlapping, non-empty, ascending-ordered) which (maybe partially)
     /// intersect with given range.
@@ -399,7 +407,7 @@ FileBlocksHolder LRUFileCache::get_or_set(const Key& key, size_t offset, size_t
 LRUFileCache::FileBlockCell* LRUFileCache::add_cell(const Key& key, const CacheContext& context,
                                                     size_t offset, size_t size,
                                                     FileBlock::State state,
-                                                    std::lock_guard<std::mutex>& cache_lock) {
+                                                    std::lock_guard<CacheMutex>& cache_lock) {
     /// Create a file segment cell and put it in `files` map by [key][offset].
     if (size == 0) {
         return nullptr; /// Empty files are not cached.
@@ -438,7 +446,7 @@ LRUFileCache::FileBlockCell* LRUFileCache::add_cell(const Key& key, const CacheC
 }
 
 size_t LRUFileCache::try_release() {
-    std::lock_guard<std::mutex> l(_mutex);
+    std::lock_guard l(_mutex);
     std::vector<FileBlockCell*> trash;
     for (auto& [key, segments] : _files) {
         for (auto& [offset, cell] : segments) {
@@ -492,7 +500,7 @@ const LRUFileCache::LRUQueue& LRUFileCache::get_queue(CacheType type) const {
 //     a. evict from query queue
 //     b. evict from other queue
 bool LRUFileCache::try_reserve(const Key& key, const CacheContext& context, size_t offset,
-                               size_t size, std::lock_guard<std::mutex>& cache_lock) {
+                               size_t size, std::lock_guard<CacheMutex>& cache_lock) {
     auto query_context =
             _enable_file_cache_query_limit && (context.query_id.hi != 0 || context.query_id.lo != 0)
                     ? get_query_context(context.query_id, cache_lock)
@@ -600,7 +608,7 @@ std::vector<CacheType> LRUFileCache::get_other_cache_type(CacheType cur_cache_ty
 
 bool LRUFileCache::try_reserve_from_other_queue(CacheType cur_cache_type, size_t size,
                                                 int64_t cur_time,
-                                                std::lock_guard<std::mutex>& cache_lock) {
+                                                std::lock_guard<CacheMutex>& cache_lock) {
     auto other_cache_types = get_other_cache_type(cur_cache_type);
     size_t removed_size = 0;
     size_t cur_cache_size = _cur_cache_size;
@@ -664,7 +672,7 @@ bool LRUFileCache::try_reserve_from_other_queue(CacheType cur_cache_type, size_t
 
 bool LRUFileCache::try_reserve_for_lru(const Key& key, QueryFileCacheContextPtr query_context,
                                        const CacheContext& context, size_t offset, size_t size,
-                                       std::lock_guard<std::mutex>& cache_lock) {
+                                       std::lock_guard<CacheMutex>& cache_lock) {
     int64_t cur_time = std::chrono::duration_cast<std::chrono::seconds>(
                                std::chrono::steady_clock::now().time_since_epoch())
                                .count();
@@ -743,7 +751,7 @@ bool LRUFileCache::try_reserve_for_lru(const Key& key, QueryFileCacheContextPtr
     return true;
 }
 
-void LRUFileCache::remove(FileBlockSPtr file_block, std::lock_guard<std::mutex>& cache_lock,
+void LRUFileCache::remove(FileBlockSPtr file_block, std::lock_guard<CacheMutex>& cache_lock,
                           std::lock_guard<std::mutex>&) {
     auto key = file_block->key();
     auto offset = file_block->offset();
@@ -782,7 +790,7 @@ void LRUFileCache::remove(FileBlockSPtr file_block, std::lock_guard<std::mutex>&
     }
 }
 
-Status LRUFileCache::load_cache_info_into_memory(std::lock_guard<std::mutex>& cache_lock) {
+Status LRUFileCache::load_cache_info_into_memory(std::lock_guard<CacheMutex>& cache_lock) {
     /// version 1.0: cache_base_path / key / offset
     /// version 2.0: cache_base_path / key_prefix / key / offset
     if (USE_CACHE_VERSION2 && read_file_cache_version() != "2.0") {
@@ -827,6 +835,10 @@ Status LRUFileCache::load_cache_info_into_memory(std::lock_guard<std::mutex>& ca
         for (; key_it != fs::directory_iterator(); ++key_it) {
             key = Key(
                     vectorized::unhex_uint<uint128_t>(key_it->path().filename().native().c_str()));
+            if (KeyHash()(key) % _num_shards != _shard_id) {
+                // loaded by another shard of the path
+                continue;
+            }
             CacheContext context;
             context.query_id = TUniqueId();
             fs::directory_iterator offset_it {key_it->path()};
@@ -975,7 +987,7 @@ size_t LRUFileCache::get_used_cache_size(CacheType cache_type) const {
 }
 
 size_t LRUFileCache::get_used_cache_size_unlocked(CacheType cache_type,
-                                                  std::lock_guard<std::mutex>& cache_lock) const {
+                                                  std::lock_guard<CacheMutex>& cache_lock) const {
     return get_queue(cache_type).get_total_cache_size(cache_lock);
 }
 
@@ -985,7 +997,7 @@ size_t LRUFileCache::get_available_cache_size(CacheType cache_type) const {
 }
 
 size_t LRUFileCache::get_available_cache_size_unlocked(
-        CacheType cache_type, std::lock_guard<std::mutex>& cache_lock) const {
+        CacheType cache_type, std::lock_guard<CacheMutex>& cache_lock) const {
     return get_queue(cache_type).get_max_element_size() -
            get_used_cache_size_unlocked(cache_type, cache_lock);
 }
@@ -996,12 +1008,30 @@ size_t LRUFileCache::get_file_segments_num(CacheType cache_type) const {
 }
 
 size_t LRUFileCache::get_file_segments_num_unlocked(CacheType cache_type,
-                                                    std::lock_guard<std::mutex>& cache_lock) const {
+                                                    std::lock_guard<CacheMutex>& cache_lock) const {
     return get_queue(cache_type).get_elements_num(cache_lock);
 }
 
+size_t LRUFileCache::get_cached_size(const Key& key, size_t offset, size_t size) const {
+    std::lock_guard cache_lock(_mutex);
+    auto it = _files.find(key);
+    if (it == _files.end()) {
+        return 0;
+    }
+    size_t cached_size = 0;
+    for (const auto& [_, cell] : it->second) {
+        const auto& range = cell.file_block->range();
+        if (range.right < offset || range.left >= offset + size ||
+            !cell.file_block->is_downloaded()) {
+            continue;
+        }
+        cached_size += std::min(range.right + 1, offset + size) - std::max(range.left, offset);
+    }
+    return cached_size;
+}
+
 LRUFileCache::FileBlockCell::FileBlockCell(FileBlockSPtr file_block, CacheType cache_type,
-                                           std::lock_guard<std::mutex>& cache_lock)
+                                           std::lock_guard<CacheMutex>& cache_lock)
         : file_block(file_block), cache_type(cache_type) {
     /**
      * Cell can be created with either DOWNLOADED or EMPTY file segment's state.
@@ -1023,28 +1053,28 @@ LRUFileCache::FileBlockCell::FileBlockCell(FileBlockSPtr file_block, CacheType c
 
 IFileCache::LRUQueue::Iterator IFileCache::LRUQueue::add(
         const IFileCache::Key& key, size_t offset, size_t size,
-        std::lock_guard<std::mutex>& /* cache_lock */) {
+        std::lock_guard<CacheMutex>& /* cache_lock */) {
     cache_size += size;
     return queue.insert(queue.end(), FileKeyAndOffset(key, offset, size));
 }
 
 void IFileCache::LRUQueue::remove(Iterator queue_it,
-                                  std::lock_guard<std::mutex>& /* cache_lock */) {
+                                  std::lock_guard<CacheMutex>& /* cache_lock */) {
     cache_size -= queue_it->size;
     queue.erase(queue_it);
 }
 
-void IFileCache::LRUQueue::remove_all(std::lock_guard<std::mutex>& /* cache_lock */) {
+void IFileCache::LRUQueue::remove_all(std::lock_guard<CacheMutex>& /* cache_lock */) {
     queue.clear();
     cache_size = 0;
 }
 
 void IFileCache::LRUQueue::move_to_end(Iterator queue_it,
-                                       std::lock_guard<std::mutex>& /* cache_lock */) {
+                                       std::lock_guard<CacheMutex>& /* cache_lock */) {
     queue.splice(queue.end(), queue, queue_it);
 }
 bool IFileCache::LRUQueue::contains(const IFileCache::Key& key, size_t offset,
-                                    std::lock_guard<std::mutex>& /* cache_lock */) const {
+                                    std::lock_guard<CacheMutex>& /* cache_lock */) const {
     /// This method is used for assertions in debug mode.
     /// So we do not care about complexity here.
     for (const auto& [entry_key, entry_offset, size] : queue) {
@@ -1055,7 +1085,7 @@ bool IFileCache::LRUQueue::contains(const IFileCache::Key& key, size_t offset,
     return false;
 }
 
-std::string IFileCache::LRUQueue::to_string(std::lock_guard<std::mutex>& /* cache_lock */) const {
+std::string IFileCache::LRUQueue::to_string(std::lock_guard<CacheMutex>& /* cache_lock */) const {
     std::string result;
     for (const auto& [key, offset, size] : queue) {
         if (!result.empty()) {
@@ -1071,7 +1101,8 @@ std::string LRUFileCache::dump_structure(const Key& key) {
     return dump_structure_unlocked(key, cache_lock);
 }
 
-std::string LRUFileCache::dump_structure_unlocked(const Key& key, std::lock_guard<std::mutex>&) {
+std::string LRUFileCache::dump_structure_unlocked(const Key& key,
+                                                  std::lock_guard<CacheMutex>&) {
     std::stringstream result;
     const auto& cells_by_offset = _files[key];
 
@@ -1093,7 +1124,7 @@ void LRUFileCache::run_background_operation() {
 }
 
 void LRUFileCache::update_cache_metrics() const {
-    std::lock_guard<std::mutex> l(_mutex);
+    std::lock_guard l(_mutex);
     double hit_ratio = 0;
     if (_num_read_segments > 0) {
         hit_ratio = (double)_num_hit_segments / (double)_num_read_segments;
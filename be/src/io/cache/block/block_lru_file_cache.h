@@ -49,8 +49,11 @@ public:
     /**
      * cache_base_path: the file cache path
      * cache_settings: the file cache setttings
+     * shard_id, num_shards: the caches of a path are sharded by the hash of keys, a shard only
+     * holds the keys with KeyHash() % num_shards == shard_id
      */
-    LRUFileCache(const std::string& cache_base_path, const FileCacheSettings& cache_settings);
+    LRUFileCache(const std::string& cache_base_path, const FileCacheSettings& cache_settings,
+                 size_t shard_id = 0, size_t num_shards = 1);
     ~LRUFileCache() override {
         _close = true;
         if (_cache_background_thread.joinable()) {
@@ -71,6 +74,8 @@ public:
 
     size_t get_file_segments_num(CacheType type) const override;
 
+    size_t get_cached_size(const Key& key, size_t offset, size_t size) const override;
+
 private:
     struct FileBlockCell {
         FileBlockSPtr file_block;
@@ -94,7 +99,7 @@ private:
         size_t size() const { return file_block->_segment_range.size(); }
 
         FileBlockCell(FileBlockSPtr file_block, CacheType cache_type,
-                      std::lock_guard<std::mutex>& cache_lock);
+                      std::lock_guard<CacheMutex>& cache_lock);
 
         FileBlockCell(FileBlockCell&& other) noexcept
                 : file_block(std::move(other.file_block)),
@@ -133,34 +138,34 @@ private:
     const LRUFileCache::LRUQueue& get_queue(CacheType type) const;
 
     FileBlocks get_impl(const Key& key, const CacheContext& context, const FileBlock::Range& range,
-                        std::lock_guard<std::mutex>& cache_lock);
+                        std::lock_guard<CacheMutex>& cache_lock);
 
-    FileBlockCell* get_cell(const Key& key, size_t offset, std::lock_guard<std::mutex>& cache_lock);
+    FileBlockCell* get_cell(const Key& key, size_t offset, std::lock_guard<CacheMutex>& cache_lock);
 
     FileBlockCell* add_cell(const Key& key, const CacheContext& context, size_t offset, size_t size,
-                            FileBlock::State state, std::lock_guard<std::mutex>& cache_lock);
+                            FileBlock::State state, std::lock_guard<CacheMutex>& cache_lock);
 
     void use_cell(const FileBlockCell& cell, FileBlocks& result, bool not_need_move,
-                  std::lock_guard<std::mutex>& cache_lock);
+                  std::lock_guard<CacheMutex>& cache_lock);
 
     bool try_reserve(const Key& key, const CacheContext& context, size_t offset, size_t size,
-                     std::lock_guard<std::mutex>& cache_lock) override;
+                     std::lock_guard<CacheMutex>& cache_lock) override;
 
     bool try_reserve_for_lru(const Key& key, QueryFileCacheContextPtr query_context,
                              const CacheContext& context, size_t offset, size_t size,
-                             std::lock_guard<std::mutex>& cache_lock);
+                             std::lock_guard<CacheMutex>& cache_lock);
 
     std::vector<CacheType> get_other_cache_type(CacheType cur_cache_type);
 
     bool try_reserve_from_other_queue(CacheType cur_cache_type, size_t offset, int64_t cur_time,
-                                      std::lock_guard<std::mutex>& cache_lock);
+                                      std::lock_guard<CacheMutex>& cache_lock);
 
-    void remove(FileBlockSPtr file_block, std::lock_guard<std::mutex>& cache_lock,
+    void remove(FileBlockSPtr file_block, std::lock_guard<CacheMutex>& cache_lock,
                 std::lock_guard<std::mutex>& segment_lock) override;
 
     size_t get_available_cache_size(CacheType cache_type) const;
 
-    Status load_cache_info_into_memory(std::lock_guard<std::mutex>& cache_lock);
+    Status load_cache_info_into_memory(std::lock_guard<CacheMutex>& cache_lock);
 
     Status write_file_cache_version() const;
 
@@ -168,23 +173,23 @@ private:
 
     FileBlocks split_range_into_cells(const Key& key, const CacheContext& context, size_t offset,
                                       size_t size, FileBlock::State state,
-                                      std::lock_guard<std::mutex>& cache_lock);
+                                      std::lock_guard<CacheMutex>& cache_lock);
 
-    std::string dump_structure_unlocked(const Key& key, std::lock_guard<std::mutex>& cache_lock);
+    std::string dump_structure_unlocked(const Key& key, std::lock_guard<CacheMutex>& cache_lock);
 
     void fill_holes_with_empty_file_blocks(FileBlocks& file_blocks, const Key& key,
                                            const CacheContext& context,
                                            const FileBlock::Range& range,
-                                           std::lock_guard<std::mutex>& cache_lock);
+                                           std::lock_guard<CacheMutex>& cache_lock);
 
     size_t get_used_cache_size_unlocked(CacheType type,
-                                        std::lock_guard<std::mutex>& cache_lock) const;
+                                        std::lock_guard<CacheMutex>& cache_lock) const;
 
     size_t get_available_cache_size_unlocked(CacheType type,
-                                             std::lock_guard<std::mutex>& cache_lock) const;
+                                             std::lock_guard<CacheMutex>& cache_lock) const;
 
     size_t get_file_segments_num_unlocked(CacheType type,
-                                          std::lock_guard<std::mutex>& cache_lock) const;
+                                          std::lock_guard<CacheMutex>& cache_lock) const;
 
     bool need_to_move(CacheType cell_type, CacheType query_type) const;
 
@@ -196,6 +201,8 @@ public:
     std::string dump_structure(const Key& key) override;
 
 private:
+    size_t _shard_id = 0;
+    size_t _num_shards = 1;
     std::atomic_bool _close {false};
     std::thread _cache_background_thread;
     size_t _num_read_segments = 0;
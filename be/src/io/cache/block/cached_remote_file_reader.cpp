@@ -58,7 +58,7 @@ CachedRemoteFileReader::CachedRemoteFileReader(FileReaderSPtr remote_file_reader
         : _remote_file_reader(std::move(remote_file_reader)) {
     std::string unique_path = fmt::format("{}:{}", cache_path, modification_time);
     _cache_key = IFileCache::hash(unique_path);
-    _cache = FileCacheFactory::instance().get_by_path(cache_base_path);
+    _cache = FileCacheFactory::instance().get_by_path(cache_base_path, _cache_key);
     if (_cache == nullptr) {
         LOG(WARNING) << "Can't get cache from base path: " << cache_base_path
                      << ", using random instead.";
@@ -210,11 +210,17 @@ Status CachedRemoteFileReader::read_at_impl(size_t offset, Slice result, size_t*
             return Status::IOError("Waiting too long for the download to complete");
         }
         size_t file_offset = current_offset - left;
+        int64_t local_read_ns = 0;
         {
-            SCOPED_RAW_TIMER(&stats.local_read_timer);
+            SCOPED_RAW_TIMER(&local_read_ns);
             RETURN_IF_ERROR(segment->read_at(
                     Slice(result.data + (current_offset - offset), read_size), file_offset));
         }
+        stats.local_read_timer += local_read_ns;
+        // the reads of the remote file are accounted by the remote reader
+        if (io_ctx->io_stats != nullptr) {
+            io_ctx->io_stats->record(IOTier::FILE_CACHE, read_size, local_read_ns);
+        }
         *bytes_read += read_size;
         current_offset = right + 1;
     }
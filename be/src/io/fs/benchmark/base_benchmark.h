@@ -51,7 +51,7 @@ public:
     virtual Status init() { return Status::OK(); }
     virtual Status run() { return Status::OK(); }
 
-    void register_bm() {
+    virtual void register_bm() {
         auto bm = benchmark::RegisterBenchmark(_name.c_str(), [&](benchmark::State& state) {
             // first turn will use more time
             Status st;
@@ -21,6 +21,7 @@
 #include <string>
 #include <vector>
 
+#include "io/fs/benchmark/file_read_benchmark.hpp"
 #include "io/fs/benchmark/s3_benchmark.hpp"
 
 namespace doris::io {
@@ -35,7 +36,9 @@ Status BenchmarkFactory::getBm(const std::string fs_type, const std::string op_t
                                int64_t iterations,
                                const std::map<std::string, std::string>& conf_map,
                                BaseBenchmark** bm) {
-    if (fs_type == "s3") {
+    if (op_type == "read_at") {
+        *bm = new FileReadBenchmark(fs_type, iterations, conf_map);
+    } else if (fs_type == "s3") {
         if (op_type == "read") {
             *bm = new S3ReadBenchmark(iterations, conf_map);
         } else {
@@ -0,0 +1,248 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <gen_cpp/Types_types.h>
+
+#include <algorithm>
+#include <fstream>
+#include <memory>
+#include <random>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include "io/cache/block/block_file_cache_factory.h"
+#include "io/cache/block/cached_remote_file_reader.h"
+#include "io/file_factory.h"
+#include "io/fs/benchmark/base_benchmark.h"
+#include "io/fs/file_reader.h"
+#include "io/fs/file_writer.h"
+#include "io/fs/local_file_system.h"
+#include "io/hdfs_builder.h"
+#include "olap/options.h"
+#include "util/slice.h"
+#include "util/time.h"
+
+namespace doris::io {
+
+// Benchmarks the read_at of the file reader of a file system with the access patterns of
+// scans, to compare the hardware and the cache settings. The conf items are:
+//   file: the file to read
+//   read_size: the bytes of each read, default 1048576
+//   pattern: the offsets of the reads, default sequential
+//       sequential: each thread reads its own part of the file in order
+//       random: each read is at a random offset aligned to 4KB
+//       trace: replays the "offset size" lines of trace_file, e.g. the page reads of segments
+//   threads: the number of threads reading the file concurrently, default 1
+//   file_cache_path, file_cache_size: read through the block file cache in the path
+//   write_file, write_percent: the percentage of the iterations which append read_size bytes
+//       to write_file.<thread index> instead of reading, for the mixed read and write workload
+//   broker_host, broker_port: the broker to read by, for the broker file system
+// Each iteration is one read or write. The throughput and the latency percentiles of the
+// reads are reported as counters.
+class FileReadBenchmark : public BaseBenchmark {
+public:
+    FileReadBenchmark(const std::string& fs_type, int iterations,
+                      const std::map<std::string, std::string>& conf_map)
+            : BaseBenchmark(fs_type + "ReadBenchmark", iterations, conf_map), _fs_type(fs_type) {}
+    ~FileReadBenchmark() override = default;
+
+    Status init() override {
+        bm_log("begin to init {}", _name);
+        _file_path = _conf_map["file"];
+        _read_size = std::stoul(_get_conf("read_size", "1048576"));
+        _pattern = _get_conf("pattern", "sequential");
+        _threads = std::stoi(_get_conf("threads", "1"));
+        _write_percent = std::stoi(_get_conf("write_percent", "0"));
+        if (_pattern != "sequential" && _pattern != "random" && _pattern != "trace") {
+            return Status::InvalidArgument("unknown pattern: {}", _pattern);
+        }
+        if (_pattern == "trace") {
+            RETURN_IF_ERROR(_load_trace(_conf_map["trace_file"]));
+        }
+        RETURN_IF_ERROR(_open_reader());
+        if (_conf_map.count("file_cache_path") > 0) {
+            std::string cache_path = _conf_map["file_cache_path"];
+            int64_t cache_size = std::stoll(_get_conf("file_cache_size", "10737418240"));
+            RETURN_IF_ERROR(FileCacheFactory::instance().create_file_cache(
+                    cache_path, CachePath(cache_path, cache_size, cache_size).init_settings()));
+            _reader = std::make_shared<CachedRemoteFileReader>(_reader, cache_path, _file_path,
+                                                               0);
+        }
+        if (_reader->size() < _read_size) {
+            return Status::InvalidArgument("file size {} is less than the read size {}",
+                                           _reader->size(), _read_size);
+        }
+        bm_log("finish to init {}, file size: {}", _name, _reader->size());
+        return Status::OK();
+    }
+
+    void register_bm() override {
+        Status st = init();
+        if (!st) {
+            std::cerr << "failed to init. bm: " << _name << ", err: " << st << std::endl;
+            return;
+        }
+        std::string name = fmt::format("{}/{}/{}", _name, _pattern, _read_size);
+        auto bm = benchmark::RegisterBenchmark(
+                name.c_str(), [this](benchmark::State& state) { _run_thread(state); });
+        if (_iterations != 0) {
+            bm->Iterations(_iterations);
+        }
+        bm->Threads(_threads)->UseRealTime()->Unit(benchmark::kMillisecond);
+    }
+
+private:
+    std::string _get_conf(const std::string& key, const std::string& default_value) {
+        auto it = _conf_map.find(key);
+        return it == _conf_map.end() ? default_value : it->second;
+    }
+
+    Status _open_reader() {
+        FileReaderOptions reader_opts = FileFactory::get_reader_options(nullptr);
+        if (_fs_type == "local") {
+            _fs = global_local_filesystem();
+            return _fs->open_file(_file_path, reader_opts, &_reader);
+        } else if (_fs_type == "hdfs") {
+            return FileFactory::create_hdfs_reader(parse_properties(_conf_map), _file_path, &_fs,
+                                                   &_reader, reader_opts);
+        } else if (_fs_type == "s3") {
+            return FileFactory::create_s3_reader(_conf_map, _file_path, &_fs, &_reader,
+                                                 reader_opts);
+        } else if (_fs_type == "broker") {
+            TNetworkAddress broker_addr;
+            broker_addr.__set_hostname(_conf_map["broker_host"]);
+            broker_addr.__set_port(std::stoi(_conf_map["broker_port"]));
+            FileDescription file_description;
+            file_description.path = _file_path;
+            file_description.start_offset = 0;
+            file_description.file_size = -1;
+            return FileFactory::create_broker_reader(broker_addr, _conf_map, file_description,
+                                                     &_fs, &_reader, reader_opts);
+        }
+        return Status::InvalidArgument("unknown fs type: {}", _fs_type);
+    }
+
+    Status _load_trace(const std::string& trace_file) {
+        std::ifstream fin(trace_file);
+        if (!fin.is_open()) {
+            return Status::InvalidArgument("failed to open trace file: {}", trace_file);
+        }
+        size_t offset = 0;
+        size_t size = 0;
+        while (fin >> offset >> size) {
+            _trace.emplace_back(offset, size);
+            _read_size = std::max(_read_size, size);
+        }
+        if (_trace.empty()) {
+            return Status::InvalidArgument("empty trace file: {}", trace_file);
+        }
+        return Status::OK();
+    }
+
+    void _run_thread(benchmark::State& state) {
+        size_t file_size = _reader->size();
+        std::unique_ptr<char[]> buffer(new char[_read_size]);
+        std::mt19937_64 rand(state.thread_index);
+        // the part of the file read by the thread in sequential pattern
+        size_t part_size = file_size / state.threads;
+        size_t part_offset = part_size * state.thread_index;
+        size_t next_offset = 0;
+        size_t next_trace = state.thread_index;
+        FileWriterPtr writer;
+        if (_write_percent > 0) {
+            Status st = _fs->create_file(
+                    fmt::format("{}.{}", _conf_map["write_file"], state.thread_index), &writer);
+            if (!st) {
+                state.SkipWithError(st.to_string().c_str());
+                return;
+            }
+        }
+
+        std::vector<int64_t> latencies_ns;
+        int64_t bytes = 0;
+        int64_t iteration = 0;
+        for (auto _ : state) {
+            Status st;
+            int64_t start_ns = MonotonicNanos();
+            if (_write_percent > 0 && iteration++ % 100 < _write_percent) {
+                st = writer->append(Slice(buffer.get(), _read_size));
+                bytes += _read_size;
+            } else {
+                size_t offset = 0;
+                size_t size = _read_size;
+                if (_pattern == "sequential") {
+                    if (next_offset + size > std::max(part_size, size)) {
+                        next_offset = 0;
+                    }
+                    offset = part_offset + next_offset;
+                    next_offset += size;
+                } else if (_pattern == "random") {
+                    offset = rand() % (file_size - size + 1) / 4096 * 4096;
+                } else {
+                    std::tie(offset, size) = _trace[next_trace % _trace.size()];
+                    next_trace += state.threads;
+                }
+                size_t bytes_read = 0;
+                st = _reader->read_at(offset, Slice(buffer.get(), size), &bytes_read);
+                bytes += bytes_read;
+                latencies_ns.push_back(MonotonicNanos() - start_ns);
+            }
+            if (!st) {
+                state.SkipWithError(st.to_string().c_str());
+                break;
+            }
+        }
+        if (writer != nullptr) {
+            Status st = writer->close();
+            if (!st) {
+                state.SkipWithError(st.to_string().c_str());
+            }
+        }
+
+        state.SetBytesProcessed(bytes);
+        if (!latencies_ns.empty()) {
+            std::sort(latencies_ns.begin(), latencies_ns.end());
+            auto percentile_us = [&](double p) {
+                return latencies_ns[std::min(latencies_ns.size() - 1,
+                                             (size_t)(latencies_ns.size() * p))] /
+                       1000.0;
+            };
+            state.counters["read_p50_us"] =
+                    benchmark::Counter(percentile_us(0.5), benchmark::Counter::kAvgThreads);
+            state.counters["read_p99_us"] =
+                    benchmark::Counter(percentile_us(0.99), benchmark::Counter::kAvgThreads);
+            state.counters["read_max_us"] = benchmark::Counter(
+                    latencies_ns.back() / 1000.0, benchmark::Counter::kAvgThreads);
+        }
+    }
+
+    std::string _fs_type;
+    std::string _file_path;
+    size_t _read_size = 0;
+    std::string _pattern;
+    int _threads = 1;
+    int _write_percent = 0;
+    std::vector<std::pair<size_t, size_t>> _trace;
+    std::shared_ptr<FileSystem> _fs;
+    FileReaderSPtr _reader;
+};
+
+} // namespace doris::io
@@ -18,13 +18,18 @@
 #include <gflags/gflags.h>
 
 #include <fstream>
+#include <string>
+#include <vector>
 
 #include "io/fs/benchmark/benchmark_factory.hpp"
 
-DEFINE_string(fs_type, "hdfs", "Supported File System: s3, hdfs, local");
-DEFINE_string(operation, "read", "Supported Operations: read, write, open, size, list, connect");
+DEFINE_string(fs_type, "hdfs", "Supported File System: s3, hdfs, local, broker");
+DEFINE_string(operation, "read",
+              "Supported Operations: read, read_at, write, open, size, list, connect");
 DEFINE_string(iterations, "10", "Number of runs");
 DEFINE_string(conf, "", "config file");
+DEFINE_string(result_format, "console", "Format of the results: console, json, csv");
+DEFINE_string(result_file, "", "File to write the results in result_format besides console");
 
 std::string get_usage(const std::string& progname) {
     std::stringstream ss;
@@ -35,13 +40,18 @@ std::string get_usage(const std::string& progname) {
     ss << "\nfs_type:\n";
     ss << "     hdfs\n";
     ss << "     s3\n";
+    ss << "     local\n";
+    ss << "     broker\n";
     ss << "\nop_type:\n";
     ss << "     read\n";
+    ss << "     read_at: read with the pattern, size and threads in conf, see FileReadBenchmark\n";
     ss << "     write\n";
     ss << "\niterations:\n";
     ss << "     num of run\n";
     ss << "\nExample:\n";
     ss << progname << " --conf my.conf --fs_type=s3 --operation=read --iterations=100\n";
+    ss << progname << " --conf my.conf --fs_type=local --operation=read_at --iterations=10000"
+       << " --result_format=json --result_file=local.json\n";
     return ss.str();
 }
 
@@ -106,7 +116,20 @@ int main(int argc, char** argv) {
             return 1;
         }
 
-        benchmark::Initialize(&argc, argv);
+        // the flags of google benchmark are rejected by gflags, so pass them here
+        std::vector<std::string> bm_flags = {argv[0]};
+        if (FLAGS_result_file.empty()) {
+            bm_flags.push_back("--benchmark_format=" + FLAGS_result_format);
+        } else {
+            bm_flags.push_back("--benchmark_out=" + FLAGS_result_file);
+            bm_flags.push_back("--benchmark_out_format=" + FLAGS_result_format);
+        }
+        std::vector<char*> bm_argv;
+        for (auto& flag : bm_flags) {
+            bm_argv.push_back(flag.data());
+        }
+        int bm_argc = bm_argv.size();
+        benchmark::Initialize(&bm_argc, bm_argv.data());
         benchmark::RunSpecifiedBenchmarks();
         benchmark::Shutdown();
 
@@ -58,6 +58,8 @@ protected:
     Status read_at_impl(size_t offset, Slice result, size_t* bytes_read,
                         const IOContext* io_ctx) override;
 
+    std::optional<IOTier> io_tier() const override { return IOTier::REMOTE; }
+
 private:
     const Path _path;
     size_t _file_size;
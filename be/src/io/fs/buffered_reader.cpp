@@ -27,6 +27,7 @@
 #include "common/compiler_util.h" // IWYU pragma: keep
 #include "common/config.h"
 #include "common/status.h"
+#include "io/fs/hdfs_file_reader.h"
 #include "runtime/exec_env.h"
 #include "util/runtime_profile.h"
 #include "util/threadpool.h"
@@ -638,6 +639,121 @@ Status PrefetchBufferedReader::close() {
     return Status::OK();
 }
 
+AsyncRangePrefetchReader::AsyncRangePrefetchReader(io::FileReaderSPtr reader, int max_inflight,
+                                                   size_t merge_gap, size_t max_merged_size)
+        : FileReader(reader->file_id()),
+          _reader(std::move(reader)),
+          _merge_gap(merge_gap),
+          _max_merged_size(max_merged_size) {
+    _token = ExecEnv::GetInstance()->buffered_reader_prefetch_thread_pool()->new_token(
+            ThreadPool::ExecutionMode::CONCURRENT, std::max(max_inflight, 1));
+}
+
+AsyncRangePrefetchReader::~AsyncRangePrefetchReader() {
+    static_cast<void>(close());
+}
+
+Status AsyncRangePrefetchReader::close() {
+    if (!_closed) {
+        _closed = true;
+        // wait for the inflight ios, the underlying reader is shared and not closed here
+        _token->shutdown();
+        _buffers.clear();
+    }
+    return Status::OK();
+}
+
+size_t AsyncRangePrefetchReader::prefetch(std::vector<PrefetchRange> ranges,
+                                          const IOContext* io_ctx) {
+    if (_closed) {
+        return 0;
+    }
+    if (ranges.empty()) {
+        _buffers.clear();
+        return 0;
+    }
+    std::sort(ranges.begin(), ranges.end(), [](const PrefetchRange& a, const PrefetchRange& b) {
+        return a.start_offset < b.start_offset;
+    });
+    std::vector<PrefetchRange> merged_ranges;
+    merged_ranges.push_back(ranges[0]);
+    for (size_t i = 1; i < ranges.size(); ++i) {
+        auto& last = merged_ranges.back();
+        if (ranges[i].start_offset <= last.end_offset + _merge_gap &&
+            ranges[i].end_offset - last.start_offset <= _max_merged_size) {
+            last.end_offset = std::max(last.end_offset, ranges[i].end_offset);
+        } else {
+            merged_ranges.push_back(ranges[i]);
+        }
+    }
+
+    // The file cache statistics are not thread safe, so they are not collected by the async ios.
+    IOContext ctx = io_ctx == nullptr ? IOContext() : *io_ctx;
+    ctx.file_cache_stats = nullptr;
+
+    std::vector<std::shared_ptr<RangeBuffer>> buffers;
+    size_t num_ios = 0;
+    size_t old_idx = 0;
+    for (const auto& range : merged_ranges) {
+        // reuse the buffer of previous plan if it covers the range
+        while (old_idx < _buffers.size() &&
+               _buffers[old_idx]->range.end_offset < range.end_offset) {
+            ++old_idx;
+        }
+        if (old_idx < _buffers.size() &&
+            _buffers[old_idx]->range.start_offset <= range.start_offset) {
+            if (buffers.empty() || buffers.back() != _buffers[old_idx]) {
+                buffers.push_back(_buffers[old_idx]);
+            }
+            continue;
+        }
+        auto buffer = std::make_shared<RangeBuffer>(range);
+        Status st = _token->submit_func([buffer, reader = _reader, ctx]() {
+            size_t bytes_read = 0;
+            buffer->data.resize(buffer->range.end_offset - buffer->range.start_offset);
+            Status status = reader->read_at(buffer->range.start_offset,
+                                            Slice(buffer->data.data(), buffer->data.size()),
+                                            &bytes_read, &ctx);
+            buffer->data.resize(bytes_read);
+            g_bytes_downloaded << bytes_read;
+            std::lock_guard l(buffer->lock);
+            buffer->status = status;
+            buffer->finished = true;
+            buffer->finished_cv.notify_all();
+        });
+        if (!st.ok()) {
+            // read from the underlying reader directly
+            continue;
+        }
+        buffers.push_back(std::move(buffer));
+        ++num_ios;
+    }
+    _buffers.swap(buffers);
+    return num_ios;
+}
+
+Status AsyncRangePrefetchReader::read_at_impl(size_t offset, Slice result, size_t* bytes_read,
+                                              const IOContext* io_ctx) {
+    auto it = std::upper_bound(_buffers.begin(), _buffers.end(), offset,
+                               [](size_t off, const std::shared_ptr<RangeBuffer>& buffer) {
+                                   return off < buffer->range.start_offset;
+                               });
+    if (it != _buffers.begin()) {
+        auto& buffer = *(it - 1);
+        if (offset + result.size <= buffer->range.end_offset) {
+            std::unique_lock l(buffer->lock);
+            buffer->finished_cv.wait(l, [&buffer]() { return buffer->finished; });
+            size_t pos = offset - buffer->range.start_offset;
+            if (buffer->status.ok() && pos + result.size <= buffer->data.size()) {
+                memcpy(result.data, buffer->data.data() + pos, result.size);
+                *bytes_read = result.size;
+                return Status::OK();
+            }
+        }
+    }
+    return _reader->read_at(offset, result, bytes_read, io_ctx);
+}
+
 InMemoryFileReader::InMemoryFileReader(io::FileReaderSPtr reader) : _reader(std::move(reader)) {
     _size = _reader->size();
 }
@@ -744,16 +860,21 @@ Status DelegateReader::create_file_reader(RuntimeProfile* profile,
     if (reader->size() < IN_MEMORY_FILE_SIZE) {
         *file_reader = std::make_shared<InMemoryFileReader>(reader);
     } else if (access_mode == AccessMode::SEQUENTIAL) {
-        bool is_thread_safe = false;
-        if (typeid_cast<io::S3FileReader*>(reader.get())) {
-            is_thread_safe = true;
-        } else if (io::CachedRemoteFileReader* cached_reader =
-                           typeid_cast<io::CachedRemoteFileReader*>(reader.get())) {
-            if (typeid_cast<io::S3FileReader*>(cached_reader->get_remote_reader())) {
-                is_thread_safe = true;
+        auto is_thread_safe = [](io::FileReader* remote_reader) {
+#ifdef USE_HADOOP_HDFS
+            // reads by hdfsPread
+            if (typeid_cast<io::HdfsFileReader*>(remote_reader)) {
+                return true;
             }
+#endif
+            return typeid_cast<io::S3FileReader*>(remote_reader) != nullptr;
+        };
+        bool thread_safe = is_thread_safe(reader.get());
+        if (io::CachedRemoteFileReader* cached_reader =
+                    typeid_cast<io::CachedRemoteFileReader*>(reader.get())) {
+            thread_safe = is_thread_safe(cached_reader->get_remote_reader());
         }
-        if (is_thread_safe) {
+        if (thread_safe) {
             // PrefetchBufferedReader needs thread-safe reader to prefetch data concurrently.
             *file_reader = std::make_shared<io::PrefetchBufferedReader>(profile, reader, file_range,
                                                                         io_ctx);
@@ -41,6 +41,8 @@
 #include "vec/common/typeid_cast.h"
 
 namespace doris {
+class ThreadPoolToken;
+
 namespace io {
 
 class FileSystem;
@@ -411,6 +413,64 @@ private:
     size_t _size;
 };
 
+/**
+ * A file reader that reads the planned ranges of the underlying reader asynchronously.
+ *
+ * The caller plans the ranges going to be read soon by prefetch(). Adjacent ranges whose gap is
+ * less than merge_gap are coalesced into one io of at most max_merged_size, and at most
+ * max_inflight ios are running in the daemon thread pool at once, so a reader of remote files
+ * is bound by bandwidth rather than the latency of each small read.
+ * read_at within a prefetched range waits for the buffer and copies from it, other reads go to
+ * the underlying reader directly. Each prefetch() drops the buffers not planned again, so the
+ * memory is bounded by one plan.
+ *
+ * prefetch() and read_at() should be called by the same thread. The reader shares the file id
+ * of the underlying reader, so pages read by it hit the same entries of page cache.
+ */
+class AsyncRangePrefetchReader : public io::FileReader {
+public:
+    AsyncRangePrefetchReader(io::FileReaderSPtr reader, int max_inflight, size_t merge_gap,
+                             size_t max_merged_size);
+    ~AsyncRangePrefetchReader() override;
+
+    // The ranges do not need to be sorted. Return the number of ios issued.
+    size_t prefetch(std::vector<PrefetchRange> ranges, const IOContext* io_ctx);
+
+    Status close() override;
+
+    const io::Path& path() const override { return _reader->path(); }
+
+    size_t size() const override { return _reader->size(); }
+
+    bool closed() const override { return _closed; }
+
+    std::shared_ptr<io::FileSystem> fs() const override { return _reader->fs(); }
+
+protected:
+    Status read_at_impl(size_t offset, Slice result, size_t* bytes_read,
+                        const IOContext* io_ctx) override;
+
+private:
+    struct RangeBuffer {
+        explicit RangeBuffer(const PrefetchRange& range) : range(range) {}
+
+        const PrefetchRange range;
+        std::mutex lock;
+        std::condition_variable finished_cv;
+        bool finished = false;
+        Status status;
+        std::string data;
+    };
+
+    io::FileReaderSPtr _reader;
+    std::unique_ptr<ThreadPoolToken> _token;
+    const size_t _merge_gap;
+    const size_t _max_merged_size;
+    // sorted by start offset and not overlapped
+    std::vector<std::shared_ptr<RangeBuffer>> _buffers;
+    bool _closed = false;
+};
+
 /**
  * A file reader that read the whole file into memory.
  * When a file is small(<8MB), InMemoryFileReader can effectively reduce the number of file accesses
@@ -17,15 +17,24 @@
 
 #include "io/fs/file_meta_cache.h"
 
+#include <fmt/format.h>
+
+#include "io/fs/file_reader.h"
 #include "vec/exec/format/parquet/parquet_thrift_util.h"
 
 namespace doris {
 
+std::string FileMetaCache::get_key(MetaType type, const std::string& path, int64_t file_size,
+                                   int64_t mtime) {
+    return fmt::format("{}:{}:{}:{}", static_cast<int>(type), file_size, mtime, path);
+}
+
 Status FileMetaCache::get_parquet_footer(io::FileReaderSPtr file_reader, io::IOContext* io_ctx,
                                          int64_t mtime, size_t* meta_size,
                                          ObjLRUCache::CacheHandle* handle) {
     ObjLRUCache::CacheHandle cache_handle;
-    std::string cache_key = file_reader->path().native() + std::to_string(mtime);
+    std::string cache_key = get_key(MetaType::PARQUET_FOOTER, file_reader->path().native(),
+                                    file_reader->size(), mtime);
     auto hit_cache = _cache.lookup({cache_key}, &cache_handle);
     if (hit_cache) {
         *handle = std::move(cache_handle);
@@ -33,7 +42,8 @@ Status FileMetaCache::get_parquet_footer(io::FileReaderSPtr file_reader, io::IOC
     } else {
         vectorized::FileMetaData* meta = nullptr;
         RETURN_IF_ERROR(vectorized::parse_thrift_footer(file_reader, &meta, meta_size, io_ctx));
-        _cache.insert({cache_key}, meta, handle);
+        // the parsed footer is charged by its serialized size
+        _cache.insert({cache_key}, meta, *meta_size, handle);
     }
 
     return Status::OK();
@@ -17,31 +17,64 @@
 
 #pragma once
 
+#include <stdint.h>
+
+#include <memory>
+#include <string>
+
 #include "io/fs/file_reader_writer_fwd.h"
 #include "util/obj_lru_cache.h"
 
 namespace doris {
 
-// A file meta cache depends on a LRU cache.
-// Such as parsed parquet footer.
-// The capacity will limit the number of cache entries in cache.
+// A file meta cache depends on a LRU cache, shared by the scans of all queries.
+// Such as parsed parquet footer, serialized orc tail, and the deleted rows of the delete files
+// of iceberg and hive acid tables.
+// The capacity limits the memory charged by the metas, and the element count capacity limits
+// the number of cache entries in cache.
 class FileMetaCache {
 public:
-    FileMetaCache(int64_t capacity) : _cache(capacity) {}
+    // part of the key, so the different metas of one file do not collide
+    enum class MetaType : uint8_t {
+        PARQUET_FOOTER = 0,
+        ORC_TAIL = 1,
+        ICEBERG_POSITION_DELETE = 2,
+        ACID_DELETE_DELTA = 3,
+    };
+
+    FileMetaCache(int64_t capacity, int64_t element_count_capacity)
+            : _cache("FileMetaCache", capacity, element_count_capacity) {}
 
     FileMetaCache(const FileMetaCache&) = delete;
     const FileMetaCache& operator=(const FileMetaCache&) = delete;
 
     ObjLRUCache& cache() { return _cache; }
 
-    Status get_parquet_footer(io::FileReaderSPtr file_reader, io::IOContext* io_ctx, int64_t mtime,
-                              size_t* meta_size, ObjLRUCache::CacheHandle* handle);
+    // The size and mtime of the file are part of the key, so the meta of a file rewritten in
+    // place is not used. They are -1 and 0 if unknown, e.g. the delete files of iceberg and hive
+    // acid tables, which are never rewritten.
+    static std::string get_key(MetaType type, const std::string& path, int64_t file_size,
+                               int64_t mtime);
+
+    bool enabled() const { return _cache.enabled(); }
 
-    Status get_orc_footer() {
-        // TODO: implement
-        return Status::OK();
+    bool lookup(const std::string& key, ObjLRUCache::CacheHandle* handle) {
+        return _cache.lookup({key}, handle);
     }
 
+    // The charge is the memory size of the value. The value is released and the handle is
+    // not valid if the cache is disabled.
+    template <typename T>
+    void insert(const std::string& key, std::unique_ptr<T> value, size_t charge,
+                ObjLRUCache::CacheHandle* handle) {
+        if (_cache.enabled()) {
+            _cache.insert({key}, value.release(), charge, handle);
+        }
+    }
+
+    Status get_parquet_footer(io::FileReaderSPtr file_reader, io::IOContext* io_ctx, int64_t mtime,
+                              size_t* meta_size, ObjLRUCache::CacheHandle* handle);
+
 private:
     ObjLRUCache _cache;
 };
@@ -20,14 +20,28 @@
 #include <bthread/bthread.h>
 #include <glog/logging.h>
 
+#include <atomic>
+
+#include "common/config.h"
 #include "io/fs/file_system.h"
 #include "util/async_io.h"
+#include "util/time.h"
 
 namespace doris {
 namespace io {
 
+static std::atomic<uint64_t> s_next_file_id {1};
+
+FileReader::FileReader() : _file_id(s_next_file_id.fetch_add(1, std::memory_order_relaxed)) {}
+
 Status FileReader::read_at(size_t offset, Slice result, size_t* bytes_read,
                            const IOContext* io_ctx) {
+    std::optional<IOTier> tier;
+    int64_t start_ns = 0;
+    if (io_ctx != nullptr && io_ctx->io_stats != nullptr) {
+        tier = io_tier();
+        start_ns = tier.has_value() ? MonotonicNanos() : 0;
+    }
 #if !defined(USE_BTHREAD_SCANNER)
     DCHECK(bthread_self() == 0);
     Status st = read_at_impl(offset, result, bytes_read, io_ctx);
@@ -42,6 +56,14 @@ Status FileReader::read_at(size_t offset, Slice result, size_t* bytes_read,
 #endif
     if (!st) {
         LOG(WARNING) << st;
+    } else if (tier.has_value()) {
+        int64_t latency_ns = MonotonicNanos() - start_ns;
+        // the reads served by the os page cache are told apart from the disk by their latency
+        if (*tier == IOTier::LOCAL_DISK &&
+            latency_ns < config::local_io_os_page_cache_latency_us * 1000L) {
+            tier = IOTier::OS_PAGE_CACHE;
+        }
+        io_ctx->io_stats->record(*tier, *bytes_read, latency_ns);
     }
     return st;
 }
@@ -19,11 +19,14 @@
 
 #include <butil/macros.h>
 #include <stddef.h>
+#include <stdint.h>
 
 #include <memory>
+#include <optional>
 
 #include "common/status.h"
 #include "io/fs/path.h"
+#include "io/io_common.h"
 #include "util/slice.h"
 
 namespace doris {
@@ -31,11 +34,10 @@ namespace doris {
 namespace io {
 
 class FileSystem;
-class IOContext;
 
 class FileReader {
 public:
-    FileReader() = default;
+    FileReader();
     virtual ~FileReader() = default;
 
     DISALLOW_COPY_AND_ASSIGN(FileReader);
@@ -55,9 +57,24 @@ public:
 
     virtual std::shared_ptr<FileSystem> fs() const = 0;
 
+    // Unique id of this opened file in the process, it identifies the pages of the file in
+    // StoragePageCache much cheaper than the path. A file opened again gets a new id.
+    uint64_t file_id() const { return _file_id; }
+
 protected:
+    // Used by the readers wrapping another reader of the same file, to share its file id.
+    explicit FileReader(uint64_t file_id) : _file_id(file_id) {}
+
     virtual Status read_at_impl(size_t offset, Slice result, size_t* bytes_read,
                                 const IOContext* io_ctx) = 0;
+
+    // The tier of the reads accounted in IOContext::io_stats by read_at. Only the readers of
+    // a storage have one, the readers wrapping other readers account their reads themselves
+    // or leave them to the wrapped readers, so the bytes are not counted twice.
+    virtual std::optional<IOTier> io_tier() const { return std::nullopt; }
+
+private:
+    const uint64_t _file_id;
 };
 
 } // namespace io
@@ -18,6 +18,7 @@
 #include "io/fs/hdfs_file_reader.h"
 
 #include <stdint.h>
+#include <string.h>
 
 #include <algorithm>
 #include <filesystem>
@@ -26,11 +27,15 @@
 
 // IWYU pragma: no_include <opentelemetry/common/threadlocal.h>
 #include "common/compiler_util.h" // IWYU pragma: keep
+#include "common/config.h"
 #include "common/logging.h"
 #include "io/fs/err_utils.h"
+#include "io/fs/io_scheduler.h"
+#include "io/io_common.h"
 // #include "io/fs/hdfs_file_system.h"
 #include "service/backend_options.h"
 #include "util/doris_metrics.h"
+#include "util/runtime_profile.h"
 
 namespace doris {
 namespace io {
@@ -46,6 +51,11 @@ HdfsFileReader::HdfsFileReader(Path path, const std::string& name_node,
 
 HdfsFileReader::~HdfsFileReader() {
     close();
+#ifdef USE_HADOOP_HDFS
+    if (_rz_options != nullptr) {
+        hadoopRzOptionsFree(_rz_options);
+    }
+#endif
 }
 
 Status HdfsFileReader::close() {
@@ -57,19 +67,13 @@ Status HdfsFileReader::close() {
 }
 
 Status HdfsFileReader::read_at_impl(size_t offset, Slice result, size_t* bytes_read,
-                                    const IOContext* /*io_ctx*/) {
+                                    const IOContext* io_ctx) {
     DCHECK(!closed());
     if (offset > _handle->file_size()) {
         return Status::IOError("offset exceeds file size(offset: {}, file size: {}, path: {})",
                                offset, _handle->file_size(), _path.native());
     }
 
-    int res = hdfsSeek(_handle->fs(), _handle->file(), offset);
-    if (res != 0) {
-        return Status::InternalError("Seek to offset failed. (BE: {}) offset={}, err: {}",
-                                     BackendOptions::get_localhost(), offset, hdfs_error());
-    }
-
     size_t bytes_req = result.size;
     char* to = result.data;
     bytes_req = std::min(bytes_req, (size_t)(_handle->file_size() - offset));
@@ -77,8 +81,65 @@ Status HdfsFileReader::read_at_impl(size_t offset, Slice result, size_t* bytes_r
     if (UNLIKELY(bytes_req == 0)) {
         return Status::OK();
     }
+    IOScheduler::instance()->schedule(IOScheduler::REMOTE_DEVICE, io_ctx, bytes_req);
+
+    HdfsReadStatistics* stats = io_ctx != nullptr ? io_ctx->hdfs_read_stats : nullptr;
+    if (stats == nullptr) {
+        return _read(offset, to, bytes_req, bytes_read);
+    }
+#ifdef USE_HADOOP_HDFS
+    {
+        // the stream may have been read by the previous owner of the cached handle
+        std::lock_guard l(_stats_lock);
+        if (!_has_last_stats) {
+            _collect_read_statistics(nullptr);
+        }
+    }
+#endif
+    {
+        SCOPED_RAW_TIMER(&stats->read_timer);
+        RETURN_IF_ERROR(_read(offset, to, bytes_req, bytes_read));
+    }
+    stats->num_read_calls++;
+    stats->bytes_read += *bytes_read;
+#ifdef USE_HADOOP_HDFS
+    std::lock_guard l(_stats_lock);
+    _collect_read_statistics(stats);
+#endif
+    return Status::OK();
+}
 
+Status HdfsFileReader::_read(size_t offset, char* to, size_t bytes_req, size_t* bytes_read) {
     size_t has_read = 0;
+#ifdef USE_HADOOP_HDFS
+    if (config::enable_hdfs_zero_copy_read) {
+        Status st = _read_zero_copy(offset, to, bytes_req, &has_read);
+        if (!st.ok()) {
+            LOG_EVERY_N(WARNING, 100) << "fallback to pread of " << _path.native() << ", " << st;
+        }
+    }
+    while (has_read < bytes_req) {
+        // hdfsPread does not move the position of the stream, so it is thread safe
+        size_t loop_req = std::min<size_t>(bytes_req - has_read, INT32_MAX);
+        int64_t loop_read = hdfsPread(_handle->fs(), _handle->file(), offset + has_read,
+                                      to + has_read, loop_req);
+        if (loop_read < 0) {
+            return Status::InternalError(
+                    "Read hdfs file failed. (BE: {}) namenode:{}, path:{}, err: {}",
+                    BackendOptions::get_localhost(), _name_node, _path.string(), hdfs_error());
+        }
+        if (loop_read == 0) {
+            break;
+        }
+        has_read += loop_read;
+    }
+#else
+    int res = hdfsSeek(_handle->fs(), _handle->file(), offset);
+    if (res != 0) {
+        return Status::InternalError("Seek to offset failed. (BE: {}) offset={}, err: {}",
+                                     BackendOptions::get_localhost(), offset, hdfs_error());
+    }
+
     while (has_read < bytes_req) {
         int64_t loop_read =
                 hdfsRead(_handle->fs(), _handle->file(), to + has_read, bytes_req - has_read);
@@ -92,8 +153,70 @@ Status HdfsFileReader::read_at_impl(size_t offset, Slice result, size_t* bytes_r
         }
         has_read += loop_read;
     }
+#endif
     *bytes_read = has_read;
     return Status::OK();
 }
+
+#ifdef USE_HADOOP_HDFS
+Status HdfsFileReader::_read_zero_copy(size_t offset, char* to, size_t bytes_req,
+                                       size_t* bytes_read) {
+    std::lock_guard l(_zero_copy_lock);
+    if (_rz_options == nullptr) {
+        _rz_options = hadoopRzOptionsAlloc();
+        if (_rz_options == nullptr) {
+            return Status::InternalError("failed to alloc zero copy read options, err: {}",
+                                         hdfs_error());
+        }
+        // the checksum can not be verified on the mapped blocks, and copy by the buffer pool
+        // if the block can not be mapped, e.g. it is not on this host
+        if (hadoopRzOptionsSetSkipChecksum(_rz_options, 1) != 0 ||
+            hadoopRzOptionsSetByteBufferPool(_rz_options, ELASTIC_BYTE_BUFFER_POOL_CLASS) != 0) {
+            return Status::InternalError("failed to set zero copy read options, err: {}",
+                                         hdfs_error());
+        }
+    }
+    if (hdfsSeek(_handle->fs(), _handle->file(), offset) != 0) {
+        return Status::InternalError("Seek to offset failed. (BE: {}) offset={}, err: {}",
+                                     BackendOptions::get_localhost(), offset, hdfs_error());
+    }
+    while (*bytes_read < bytes_req) {
+        hadoopRzBuffer* buffer = hadoopReadZero(
+                _handle->file(), _rz_options, std::min<size_t>(bytes_req - *bytes_read, INT32_MAX));
+        if (buffer == nullptr) {
+            return Status::InternalError("Zero copy read hdfs file failed, path:{}, err: {}",
+                                         _path.string(), hdfs_error());
+        }
+        int32_t length = hadoopRzBufferLength(buffer);
+        if (length > 0) {
+            memcpy(to + *bytes_read, hadoopRzBufferGet(buffer), length);
+            *bytes_read += length;
+        }
+        hadoopRzBufferFree(_handle->file(), buffer);
+        if (length <= 0) {
+            break;
+        }
+    }
+    return Status::OK();
+}
+
+void HdfsFileReader::_collect_read_statistics(HdfsReadStatistics* stats) {
+    hdfsReadStatistics* cur = nullptr;
+    if (hdfsFileGetReadStatistics(_handle->file(), &cur) != 0) {
+        return;
+    }
+    if (stats != nullptr && _has_last_stats) {
+        stats->local_bytes_read += cur->totalLocalBytesRead - _last_stats.totalLocalBytesRead;
+        stats->short_circuit_bytes_read +=
+                cur->totalShortCircuitBytesRead - _last_stats.totalShortCircuitBytesRead;
+        stats->zero_copy_bytes_read +=
+                cur->totalZeroCopyBytesRead - _last_stats.totalZeroCopyBytesRead;
+    }
+    _last_stats = *cur;
+    _has_last_stats = true;
+    hdfsFileFreeReadStatistics(cur);
+}
+#endif
+
 } // namespace io
 } // namespace doris
@@ -21,6 +21,7 @@
 
 #include <atomic>
 #include <memory>
+#include <mutex>
 #include <string>
 
 #include "common/status.h"
@@ -35,7 +36,10 @@
 namespace doris {
 namespace io {
 class IOContext;
+struct HdfsReadStatistics;
 
+// With hadoop libhdfs, the reader reads by hdfsPread, so it is thread safe and the reads
+// can be hedged by the hdfs client. With libhdfs3, it seeks and reads the shared stream.
 class HdfsFileReader : public FileReader {
 public:
     HdfsFileReader(Path path, const std::string& name_node, FileHandleCache::Accessor accessor);
@@ -56,12 +60,34 @@ protected:
     Status read_at_impl(size_t offset, Slice result, size_t* bytes_read,
                         const IOContext* io_ctx) override;
 
+    std::optional<IOTier> io_tier() const override { return IOTier::REMOTE; }
+
 private:
+    Status _read(size_t offset, char* to, size_t bytes_req, size_t* bytes_read);
+
+#ifdef USE_HADOOP_HDFS
+    // read from the current position of the stream, the blocks of the datanode on the same
+    // host are mapped into memory instead of copied
+    Status _read_zero_copy(size_t offset, char* to, size_t bytes_req, size_t* bytes_read);
+
+    // add the increment of the read statistics of the stream since last call to stats
+    void _collect_read_statistics(HdfsReadStatistics* stats);
+#endif
+
     Path _path;
     const std::string& _name_node;
     FileHandleCache::Accessor _accessor;
     CachedHdfsFileHandle* _handle = nullptr; // owned by _cached_file_handle
     std::atomic<bool> _closed = false;
+#ifdef USE_HADOOP_HDFS
+    // the zero copy read seeks the stream
+    std::mutex _zero_copy_lock;
+    hadoopRzOptions* _rz_options = nullptr;
+
+    std::mutex _stats_lock;
+    bool _has_last_stats = false;
+    hdfsReadStatistics _last_stats {};
+#endif
 };
 } // namespace io
 } // namespace doris
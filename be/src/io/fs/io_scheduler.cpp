@@ -0,0 +1,228 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "io/fs/io_scheduler.h"
+
+#include <algorithm>
+#include <chrono>
+#include <thread>
+
+#include "common/config.h"
+#include "io/io_common.h"
+#include "runtime/query_context.h"
+#include "runtime/runtime_state.h"
+#include "runtime/task_group/task_group.h"
+#include "util/time.h"
+#include "util/uid_util.h"
+
+namespace doris {
+namespace io {
+
+// the idle time after which the token bucket of a query is dropped
+static constexpr int64_t QUERY_BUCKET_IDLE_NS = 60L * 1000 * 1000 * 1000;
+
+IOScheduler* IOScheduler::instance() {
+    static IOScheduler scheduler;
+    return &scheduler;
+}
+
+void IOScheduler::set_workload_group(RuntimeState* state, IOContext* io_ctx) {
+    if (state == nullptr || state->get_query_ctx() == nullptr) {
+        return;
+    }
+    taskgroup::TaskGroup* task_group = state->get_query_ctx()->get_task_group();
+    if (task_group != nullptr) {
+        io_ctx->workload_group_id = task_group->id();
+        io_ctx->workload_group_cpu_share = task_group->cpu_share();
+    }
+}
+
+void IOScheduler::schedule(uint64_t device, const IOContext* io_ctx, size_t bytes) {
+    uint64_t weight = 0;
+    Group* group = _get_group(io_ctx, &weight);
+    group->read_bytes << bytes;
+    int64_t bytes_per_second = device == REMOTE_DEVICE ? config::remote_read_bytes_per_second
+                                                       : config::local_disk_read_bytes_per_second;
+    bool limit_query = config::query_read_bytes_per_second > 0 && io_ctx != nullptr &&
+                       io_ctx->query_id != nullptr;
+    if (bytes_per_second <= 0 && !limit_query) {
+        group->wait_latency << 0;
+        return;
+    }
+
+    int64_t start_ns = MonotonicNanos();
+    if (limit_query) {
+        _limit_query(io_ctx, bytes);
+    }
+    if (bytes_per_second > 0) {
+        _get_device(device)->schedule(bytes_per_second, group->name, weight, bytes);
+    }
+    group->wait_latency << (MonotonicNanos() - start_ns) / 1000;
+}
+
+void IOScheduler::schedule_clone(uint64_t device, size_t bytes) {
+    Group* group = _get_or_create_group("clone");
+    group->read_bytes << bytes;
+    int64_t bytes_per_second = config::local_disk_read_bytes_per_second;
+    if (bytes_per_second <= 0) {
+        group->wait_latency << 0;
+        return;
+    }
+    int64_t start_ns = MonotonicNanos();
+    _get_device(device)->schedule(bytes_per_second, group->name, config::clone_io_weight, bytes);
+    group->wait_latency << (MonotonicNanos() - start_ns) / 1000;
+}
+
+IOScheduler::Group* IOScheduler::_get_group(const IOContext* io_ctx, uint64_t* weight) {
+    *weight = config::query_io_weight;
+    if (io_ctx == nullptr) {
+        return _get_or_create_group("other");
+    }
+    switch (io_ctx->reader_type) {
+    case ReaderType::READER_ALTER_TABLE:
+    case ReaderType::READER_BASE_COMPACTION:
+    case ReaderType::READER_CUMULATIVE_COMPACTION:
+    case ReaderType::READER_CHECKSUM:
+    case ReaderType::READER_COLD_DATA_COMPACTION:
+    case ReaderType::READER_SEGMENT_COMPACTION:
+        *weight = config::compaction_io_weight;
+        return _get_or_create_group("compaction");
+    default:
+        break;
+    }
+    if (io_ctx->workload_group_id != 0) {
+        *weight = io_ctx->workload_group_cpu_share;
+        return _get_or_create_group("workload_group_" +
+                                    std::to_string(io_ctx->workload_group_id));
+    }
+    bool is_query = io_ctx->reader_type == ReaderType::READER_QUERY || io_ctx->query_id != nullptr;
+    return _get_or_create_group(is_query ? "query" : "other");
+}
+
+IOScheduler::Group* IOScheduler::_get_or_create_group(const std::string& name) {
+    {
+        std::shared_lock l(_lock);
+        auto it = _groups.find(name);
+        if (it != _groups.end()) {
+            return it->second.get();
+        }
+    }
+    std::lock_guard l(_lock);
+    auto& group = _groups[name];
+    if (group == nullptr) {
+        group = std::make_unique<Group>(name);
+    }
+    return group.get();
+}
+
+IOScheduler::Device* IOScheduler::_get_device(uint64_t device) {
+    {
+        std::shared_lock l(_lock);
+        auto it = _devices.find(device);
+        if (it != _devices.end()) {
+            return it->second.get();
+        }
+    }
+    std::lock_guard l(_lock);
+    auto& dev = _devices[device];
+    if (dev == nullptr) {
+        dev = std::make_unique<Device>();
+    }
+    return dev.get();
+}
+
+void IOScheduler::_limit_query(const IOContext* io_ctx, size_t bytes) {
+    std::string query_id = print_id(*io_ctx->query_id);
+    std::shared_ptr<QueryBucket> query_bucket;
+    {
+        int64_t now = MonotonicNanos();
+        std::lock_guard l(_query_lock);
+        auto& bucket = _query_buckets[query_id];
+        if (bucket == nullptr) {
+            bucket = std::make_shared<QueryBucket>();
+            for (auto it = _query_buckets.begin(); it != _query_buckets.end();) {
+                if (now - it->second->last_access_ns > QUERY_BUCKET_IDLE_NS) {
+                    it = _query_buckets.erase(it);
+                } else {
+                    ++it;
+                }
+            }
+        }
+        bucket->last_access_ns = now;
+        query_bucket = bucket;
+    }
+    while (true) {
+        int64_t wait_ns = 0;
+        {
+            std::lock_guard l(query_bucket->lock);
+            wait_ns = query_bucket->bucket.try_acquire(config::query_read_bytes_per_second, bytes);
+        }
+        if (wait_ns == 0) {
+            return;
+        }
+        std::this_thread::sleep_for(std::chrono::nanoseconds(wait_ns));
+    }
+}
+
+int64_t IOScheduler::TokenBucket::try_acquire(int64_t bytes_per_second, size_t bytes) {
+    if (bytes_per_second <= 0) {
+        return 0;
+    }
+    // allow a burst of 100ms, a read larger than the burst is taken when the bucket is full
+    // and leaves a debt
+    double burst = bytes_per_second / 10.0;
+    int64_t now = MonotonicNanos();
+    if (_last_refill_ns == 0) {
+        _tokens = burst;
+    } else {
+        _tokens = std::min(burst, _tokens + (now - _last_refill_ns) * bytes_per_second / 1e9);
+    }
+    _last_refill_ns = now;
+    double needed = std::min<double>(bytes, burst);
+    if (_tokens >= needed) {
+        _tokens -= bytes;
+        return 0;
+    }
+    return std::max<int64_t>(1000, (needed - _tokens) * 1e9 / bytes_per_second);
+}
+
+void IOScheduler::Device::schedule(int64_t bytes_per_second, const std::string& group,
+                                   uint64_t weight, size_t bytes) {
+    std::unique_lock l(_lock);
+    // weighted fair queuing by the virtual finish time, an idle group restarts from now
+    double& group_finish_time = _group_finish_times[group];
+    double start_time = std::max(_virtual_time, group_finish_time);
+    group_finish_time = start_time + static_cast<double>(bytes) / std::max<uint64_t>(weight, 1);
+    auto waiter = _waiters.emplace(group_finish_time, _next_seq++).first;
+    while (true) {
+        if (_waiters.begin() != waiter) {
+            _cv.wait(l);
+            continue;
+        }
+        int64_t wait_ns = _bucket.try_acquire(bytes_per_second, bytes);
+        if (wait_ns == 0) {
+            break;
+        }
+        _cv.wait_for(l, std::chrono::nanoseconds(wait_ns));
+    }
+    _virtual_time = std::max(_virtual_time, start_time);
+    _waiters.erase(waiter);
+    _cv.notify_all();
+}
+
+} // namespace io
+} // namespace doris
@@ -0,0 +1,133 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <bvar/latency_recorder.h>
+#include <bvar/reducer.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include <condition_variable>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <shared_mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+
+namespace doris {
+class RuntimeState;
+
+namespace io {
+class IOContext;
+
+// Schedules the reads of the storage devices, so a big compaction or a heavy query does not
+// take all the bandwidth of a disk from the interactive queries.
+//
+// The reads of a device are tagged by the IOContext into IO groups: compaction, the queries
+// of each workload group, the other queries and the rest. When the bandwidth of the device
+// is limited, the reads wait in a queue and are served in the weighted fair order of their
+// groups, within the rate of the token bucket of the device. The weight of a workload group
+// is its cpu share. The reads of a query can also be limited by its own token bucket.
+//
+// All the local files on one disk share a device, and all remote reads share a device for
+// the network bandwidth of this backend. Nothing is queued unless a limit is set.
+class IOScheduler {
+public:
+    static constexpr uint64_t REMOTE_DEVICE = UINT64_MAX;
+
+    static IOScheduler* instance();
+
+    // tag the reads of the io context with the workload group of the query of the state
+    static void set_workload_group(RuntimeState* state, IOContext* io_ctx);
+
+    // block until the read of the bytes on the device is allowed by the limits
+    void schedule(uint64_t device, const IOContext* io_ctx, size_t bytes);
+
+    // block until the write of the bytes downloaded by a clone to the device is allowed, the
+    // clones share the bandwidth of the device with the compaction reads in the clone group
+    void schedule_clone(uint64_t device, size_t bytes);
+
+private:
+    struct Group {
+        std::string name;
+        bvar::Adder<int64_t> read_bytes;
+        bvar::LatencyRecorder wait_latency;
+
+        explicit Group(const std::string& group_name)
+                : name(group_name),
+                  read_bytes("io_scheduler_" + group_name, "read_bytes"),
+                  wait_latency("io_scheduler_" + group_name, "wait_latency") {}
+    };
+
+    class TokenBucket {
+    public:
+        // the ns to wait before the bytes are available, 0 if taken
+        int64_t try_acquire(int64_t bytes_per_second, size_t bytes);
+
+    private:
+        double _tokens = 0;
+        int64_t _last_refill_ns = 0;
+    };
+
+    // the queue of the reads of a device
+    class Device {
+    public:
+        void schedule(int64_t bytes_per_second, const std::string& group, uint64_t weight,
+                      size_t bytes);
+
+    private:
+        std::mutex _lock;
+        std::condition_variable _cv;
+        TokenBucket _bucket;
+        // virtual time of the read served last
+        double _virtual_time = 0;
+        // virtual finish time of the last read of each group
+        std::unordered_map<std::string, double> _group_finish_times;
+        // the waiting reads, ordered by virtual finish time and arrival
+        std::set<std::pair<double, uint64_t>> _waiters;
+        uint64_t _next_seq = 0;
+    };
+
+    struct QueryBucket {
+        std::mutex lock;
+        TokenBucket bucket;
+        int64_t last_access_ns = 0;
+    };
+
+    Group* _get_group(const IOContext* io_ctx, uint64_t* weight);
+
+    Group* _get_or_create_group(const std::string& name);
+
+    Device* _get_device(uint64_t device);
+
+    void _limit_query(const IOContext* io_ctx, size_t bytes);
+
+    // looked up by every read, so a shared lock
+    std::shared_mutex _lock;
+    std::map<std::string, std::unique_ptr<Group>> _groups;
+    std::map<uint64_t, std::unique_ptr<Device>> _devices;
+
+    std::mutex _query_lock;
+    std::map<std::string, std::shared_ptr<QueryBucket>> _query_buckets;
+};
+
+} // namespace io
+} // namespace doris
@@ -17,6 +17,10 @@
 
 #pragma once
 
+#include <librdkafka/rdkafkacpp.h>
+
+#include <memory>
+
 #include "io/fs/stream_load_pipe.h"
 
 namespace doris {
@@ -42,6 +46,15 @@ public:
     virtual Status append_json(const char* data, size_t size) {
         return append_and_flush(data, size);
     }
+
+    // appends a json message as a buffer referencing its payload, the message is deleted with
+    // the buffer once read
+    Status append_json_message(std::unique_ptr<RdKafka::Message> msg) {
+        RdKafka::Message* message = msg.release();
+        auto buf = ByteBuffer::reference(static_cast<char*>(message->payload()), message->len(),
+                                         [message]() { delete message; });
+        return append(buf);
+    }
 };
 } // namespace io
 } // end namespace doris
@@ -20,8 +20,10 @@
 #include <bthread/bthread.h>
 // IWYU pragma: no_include <bthread/errno.h>
 #include <errno.h> // IWYU pragma: keep
+#include <fcntl.h>
 #include <fmt/format.h>
 #include <glog/logging.h>
+#include <sys/stat.h>
 #include <unistd.h>
 
 #include <algorithm>
@@ -32,17 +34,23 @@
 
 // IWYU pragma: no_include <opentelemetry/common/threadlocal.h>
 #include "common/compiler_util.h" // IWYU pragma: keep
+#include "common/config.h"
 #include "io/fs/err_utils.h"
+#include "io/fs/io_scheduler.h"
+#include "io/io_common.h"
 #include "util/async_io.h"
 #include "util/doris_metrics.h"
 
 namespace doris {
 namespace io {
-class IOContext;
 
 LocalFileReader::LocalFileReader(Path path, size_t file_size, int fd,
                                  std::shared_ptr<LocalFileSystem> fs)
         : _fd(fd), _path(std::move(path)), _file_size(file_size), _fs(std::move(fs)) {
+    struct stat st;
+    if (::fstat(_fd, &st) == 0) {
+        _device = st.st_dev;
+    }
     DorisMetrics::instance()->local_file_open_reading->increment(1);
     DorisMetrics::instance()->local_file_reader_total->increment(1);
 }
@@ -77,8 +85,17 @@ Status LocalFileReader::close() {
     return Status::OK();
 }
 
+void LocalFileReader::readahead(size_t offset, size_t len) {
+    DCHECK(!closed());
+    if (offset >= _file_size) {
+        return;
+    }
+    // it is only a hint, the data is read again by read_at if the hint fails
+    ::posix_fadvise(_fd, offset, std::min(len, _file_size - offset), POSIX_FADV_WILLNEED);
+}
+
 Status LocalFileReader::read_at_impl(size_t offset, Slice result, size_t* bytes_read,
-                                     const IOContext* /*io_ctx*/) {
+                                     const IOContext* io_ctx) {
     DCHECK(!closed());
     if (offset > _file_size) {
         return Status::IOError("offset exceeds file size(offset: {}, file size: {}, path: {})",
@@ -88,6 +105,8 @@ Status LocalFileReader::read_at_impl(size_t offset, Slice result, size_t* bytes_
     char* to = result.data;
     bytes_req = std::min(bytes_req, _file_size - offset);
     *bytes_read = 0;
+    const size_t read_offset = offset;
+    IOScheduler::instance()->schedule(_device, io_ctx, bytes_req);
 
     while (bytes_req != 0) {
         auto res = ::pread(_fd, to, bytes_req, offset);
@@ -105,6 +124,13 @@ Status LocalFileReader::read_at_impl(size_t offset, Slice result, size_t* bytes_
         }
     }
     DorisMetrics::instance()->local_bytes_read_total->increment(*bytes_read);
+    if (config::local_compaction_read_drop_page_cache && io_ctx != nullptr &&
+        (io_ctx->reader_type == ReaderType::READER_BASE_COMPACTION ||
+         io_ctx->reader_type == ReaderType::READER_CUMULATIVE_COMPACTION ||
+         io_ctx->reader_type == ReaderType::READER_SEGMENT_COMPACTION)) {
+        // the pages read are clean, dropping them does not write back
+        ::posix_fadvise(_fd, read_offset, *bytes_read, POSIX_FADV_DONTNEED);
+    }
     return Status::OK();
 }
 
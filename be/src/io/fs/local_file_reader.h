@@ -49,12 +49,20 @@ public:
 
     FileSystemSPtr fs() const override { return _fs; }
 
+    // Hint the kernel to read the range into the os page cache asynchronously, it does not
+    // block the caller.
+    void readahead(size_t offset, size_t len);
+
 private:
     Status read_at_impl(size_t offset, Slice result, size_t* bytes_read,
                         const IOContext* io_ctx) override;
 
+    std::optional<IOTier> io_tier() const override { return IOTier::LOCAL_DISK; }
+
 private:
     int _fd = -1; // owned
+    // the disk of the file to schedule the reads
+    uint64_t _device = 0;
     Path _path;
     size_t _file_size;
     std::atomic<bool> _closed = false;
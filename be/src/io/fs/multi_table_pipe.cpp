@@ -21,8 +21,10 @@
 #include <gen_cpp/FrontendService_types.h>
 #include <gen_cpp/HeartbeatService_types.h>
 #include <gen_cpp/Types_types.h>
+#include <string.h>
 #include <thrift/protocol/TDebugProtocol.h>
 
+#include "common/config.h"
 #include "common/status.h"
 #include "runtime/client_cache.h"
 #include "runtime/fragment_mgr.h"
@@ -35,11 +37,60 @@
 namespace doris {
 namespace io {
 
+MultiTablePlanCache* MultiTablePlanCache::instance() {
+    static MultiTablePlanCache cache;
+    return &cache;
+}
+
+std::map<std::string, TExecPlanFragmentParams> MultiTablePlanCache::get(
+        int64_t job_id, const std::vector<std::string>& tables) {
+    std::map<std::string, TExecPlanFragmentParams> plans;
+    int64_t now_s = MonotonicSeconds();
+    std::lock_guard l(_lock);
+    _evict_expired_locked(now_s);
+    for (const auto& table : tables) {
+        auto it = _plans.find({job_id, table});
+        if (it != _plans.end()) {
+            it->second.last_used_s = now_s;
+            plans.emplace(table, it->second.plan);
+        }
+    }
+    return plans;
+}
+
+void MultiTablePlanCache::put(int64_t job_id, const TExecPlanFragmentParams& plan) {
+    std::lock_guard l(_lock);
+    _plans[{job_id, plan.table_name}] = {plan, MonotonicSeconds()};
+}
+
+void MultiTablePlanCache::evict(int64_t job_id, const std::string& table) {
+    std::lock_guard l(_lock);
+    _plans.erase({job_id, table});
+}
+
+void MultiTablePlanCache::_evict_expired_locked(int64_t now_s) {
+    int64_t expire_s = config::multi_table_plan_cache_expire_sec;
+    if (now_s - _last_evict_s < expire_s / 10) {
+        return;
+    }
+    _last_evict_s = now_s;
+    for (auto it = _plans.begin(); it != _plans.end();) {
+        if (now_s - it->second.last_used_s > expire_s) {
+            it = _plans.erase(it);
+        } else {
+            ++it;
+        }
+    }
+}
+
 Status MultiTablePipe::append_with_line_delimiter(const char* data, size_t size) {
     const std::string& table = parse_dst_table(data, size);
     if (table.empty()) {
         return Status::InternalError("table name is empty");
     }
+    if (table.length() == size) {
+        return Status::InternalError("no table name delimiter '|' in message");
+    }
     size_t prefix_len = table.length() + 1;
     AppendFunc cb = &KafkaConsumerPipe::append_with_line_delimiter;
     return dispatch(table, data + prefix_len, size - prefix_len, cb);
@@ -50,6 +101,9 @@ Status MultiTablePipe::append_json(const char* data, size_t size) {
     if (table.empty()) {
         return Status::InternalError("table name is empty");
     }
+    if (table.length() == size) {
+        return Status::InternalError("no table name delimiter '|' in message");
+    }
     size_t prefix_len = table.length() + 1;
     AppendFunc cb = &KafkaConsumerPipe::append_json;
     return dispatch(table, data + prefix_len, size - prefix_len, cb);
@@ -61,14 +115,14 @@ KafkaConsumerPipePtr MultiTablePipe::get_pipe_by_table(const std::string& table)
     return pipe->second;
 }
 
-static std::string_view get_first_part(const char* dat, char delimiter) {
-    const char* delimiterPos = std::strchr(dat, delimiter);
+static std::string_view get_first_part(const char* dat, size_t size, char delimiter) {
+    const char* delimiterPos = static_cast<const char*>(memchr(dat, delimiter, size));
 
     if (delimiterPos != nullptr) {
         std::ptrdiff_t length = delimiterPos - dat;
         return std::string_view(dat, length);
     } else {
-        return std::string_view(dat);
+        return std::string_view(dat, size);
     }
 }
 
@@ -86,12 +140,14 @@ void MultiTablePipe::cancel(const std::string& reason) {
 }
 
 std::string MultiTablePipe::parse_dst_table(const char* data, size_t size) {
-    return std::string(get_first_part(data, '|'));
+    // the message is not nul-terminated, the table name is the part before the first '|' and
+    // the rest is dispatched as is, without being parsed again
+    return std::string(get_first_part(data, size, '|'));
 }
 
 Status MultiTablePipe::dispatch(const std::string& table, const char* data, size_t size,
                                 AppendFunc cb) {
-    if (size == 0 || strlen(data) == 0) {
+    if (size == 0) {
         LOG(WARNING) << "empty data for table: " << table;
         return Status::InternalError("empty data");
     }
@@ -158,6 +214,17 @@ Status MultiTablePipe::request_and_exec_plans() {
     request.__set_thrift_rpc_timeout_ms(config::thrift_rpc_timeout_ms);
     // no need to register new_load_stream_mgr coz it is already done in routineload submit task
 
+    // the plans cached by the previous tasks of the job, the FE only plans the tables changed since
+    bool use_plan_cache = config::multi_table_plan_cache_expire_sec > 0 && _ctx->job_id >= 0;
+    std::map<std::string, TExecPlanFragmentParams> cached_plans;
+    if (use_plan_cache) {
+        cached_plans = MultiTablePlanCache::instance()->get(_ctx->job_id, tables);
+        for (const auto& [table, plan] : cached_plans) {
+            request.table_plan_signatures[table] = plan.plan_signature;
+        }
+        request.__isset.table_plan_signatures = !cached_plans.empty();
+    }
+
     // plan this load
     ExecEnv* exec_env = doris::ExecEnv::GetInstance();
     TNetworkAddress master_addr = exec_env->master_info()->network_address;
@@ -175,6 +242,15 @@ Status MultiTablePipe::request_and_exec_plans() {
         return plan_status;
     }
 
+    if (use_plan_cache) {
+        for (const auto& plan : _ctx->multi_table_put_result.params) {
+            if (plan.__isset.plan_signature) {
+                MultiTablePlanCache::instance()->put(_ctx->job_id, plan);
+            }
+        }
+        reuse_cached_plans(cached_plans);
+    }
+
     // put unplanned pipes into planned pipes and clear unplanned pipes
     for (auto& pipe : _unplanned_pipes) {
         _ctx->table_list.push_back(pipe.first);
@@ -193,8 +269,9 @@ Status MultiTablePipe::request_and_exec_plans() {
         putPipe(plan.params.fragment_instance_id, _planned_pipes[plan.table_name]);
         LOG(INFO) << "fragment_instance_id=" << plan.params.fragment_instance_id
                   << " table=" << plan.table_name;
-        exec_env->fragment_mgr()->exec_plan_fragment(plan, [this](RuntimeState* state,
-                                                                  Status* status) {
+        std::string table = plan.table_name;
+        exec_env->fragment_mgr()->exec_plan_fragment(plan, [this, table](RuntimeState* state,
+                                                                         Status* status) {
             {
                 std::lock_guard<std::mutex> l(_tablet_commit_infos_lock);
                 _tablet_commit_infos.insert(_tablet_commit_infos.end(),
@@ -222,6 +299,8 @@ Status MultiTablePipe::request_and_exec_plans() {
             if (!status->ok()) {
                 LOG(WARNING) << "plan fragment exec failed. errmsg=" << *status << _ctx->brief();
                 _status = *status;
+                // the failure may come from a change of the table the FE does not sign
+                MultiTablePlanCache::instance()->evict(_ctx->job_id, table);
             }
 
             --_inflight_plan_cnt;
@@ -243,6 +322,42 @@ Status MultiTablePipe::request_and_exec_plans() {
 
     return Status::OK();
 }
+
+void MultiTablePipe::reuse_cached_plans(
+        const std::map<std::string, TExecPlanFragmentParams>& cached_plans) {
+    auto& result = _ctx->multi_table_put_result;
+    TUniqueId load_id = _ctx->id.to_thrift();
+    int64_t now_us = UnixMicros();
+    for (const auto& [table, instance_index] : result.cached_plan_instance_indexes) {
+        auto it = cached_plans.find(table);
+        DCHECK(it != cached_plans.end());
+        if (it == cached_plans.end()) {
+            continue;
+        }
+        // the ids of this load the FE would set in a plan of it
+        TExecPlanFragmentParams plan = it->second;
+        plan.params.query_id = load_id;
+        plan.params.fragment_instance_id = load_id;
+        plan.params.fragment_instance_id.lo += instance_index;
+        plan.fragment.output_sink.olap_table_sink.load_id = load_id;
+        plan.fragment.output_sink.olap_table_sink.txn_id = _ctx->txn_id;
+        for (auto& [node_id, scan_ranges] : plan.params.per_node_scan_ranges) {
+            for (auto& scan_range : scan_ranges) {
+                for (auto& range : scan_range.scan_range.ext_scan_range.file_scan_range.ranges) {
+                    range.__set_load_id(load_id);
+                }
+            }
+        }
+        // now_string is ignored as the time zone is always set for a load
+        plan.query_globals.__set_timestamp_ms(now_us / 1000);
+        plan.query_globals.__set_nano_seconds((now_us % (1000 * 1000)) * 1000);
+        result.params.push_back(std::move(plan));
+    }
+    if (!result.cached_plan_instance_indexes.empty()) {
+        LOG(INFO) << fmt::format("reuse cached plans of {} tables, job_id={}",
+                                 result.cached_plan_instance_indexes.size(), _ctx->job_id);
+    }
+}
 #else
 Status MultiTablePipe::request_and_exec_plans() {
     // put unplanned pipes into planned pipes
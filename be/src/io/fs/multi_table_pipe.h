@@ -17,6 +17,15 @@
 
 #pragma once
 
+#include <gen_cpp/PaloInternalService_types.h>
+#include <stdint.h>
+
+#include <map>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
 #include "io/fs/kafka_consumer_pipe.h"
 #include "io/fs/multi_table_pipe.h"
 #include "runtime/stream_load/stream_load_context.h"
@@ -25,6 +34,36 @@ namespace doris {
 namespace io {
 
 class MultiTablePipe;
+
+// The plans of the tables of multi-table routine load jobs, which are reused by the following
+// tasks of a job while the signature of the table metadata they depend on is unchanged, checked
+// by FE::streamLoadMultiTablePut. A plan is evicted when a fragment of it fails or it is unused
+// for config::multi_table_plan_cache_expire_sec.
+class MultiTablePlanCache {
+public:
+    static MultiTablePlanCache* instance();
+
+    // the cached plans of the tables of the job
+    std::map<std::string, TExecPlanFragmentParams> get(int64_t job_id,
+                                                       const std::vector<std::string>& tables);
+
+    void put(int64_t job_id, const TExecPlanFragmentParams& plan);
+
+    void evict(int64_t job_id, const std::string& table);
+
+private:
+    struct Entry {
+        TExecPlanFragmentParams plan;
+        int64_t last_used_s;
+    };
+
+    void _evict_expired_locked(int64_t now_s);
+
+    std::mutex _lock;
+    std::map<std::pair<int64_t, std::string>, Entry> _plans;
+    int64_t _last_evict_s = 0;
+};
+
 using AppendFunc = Status (KafkaConsumerPipe::*)(const char* data, size_t size);
 using KafkaConsumerPipePtr = std::shared_ptr<io::KafkaConsumerPipe>;
 
@@ -65,6 +104,9 @@ private:
     // parse table name from data
     std::string parse_dst_table(const char* data, size_t size);
 
+    // the plans of the tables cached from the previous tasks, to the requested plans
+    void reuse_cached_plans(const std::map<std::string, TExecPlanFragmentParams>& cached_plans);
+
     // [thread-unsafe] dispatch data to corresponding KafkaConsumerPipe
     Status dispatch(const std::string& table, const char* data, size_t size, AppendFunc cb);
 
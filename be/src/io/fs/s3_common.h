@@ -20,6 +20,15 @@
 #include <aws/core/utils/memory/stl/AWSStreamFwd.h>
 #include <aws/core/utils/stream/PreallocatedStreamBuf.h>
 
+#include <algorithm>
+#include <cstddef>
+#include <istream>
+#include <streambuf>
+#include <utility>
+#include <vector>
+
+#include "util/slice.h"
+
 namespace doris {
 
 // A non-copying iostream.
@@ -34,6 +43,72 @@ public:
               std::iostream(this) {}
 };
 
+// A non-copying read only iostream over several memory buffers, which are read one after
+// another as a contiguous stream.
+class SlicesViewStream : std::streambuf, public std::iostream {
+public:
+    explicit SlicesViewStream(std::vector<Slice> slices)
+            : std::iostream(this), _slices(std::move(slices)) {
+        for (const auto& slice : _slices) {
+            _offsets.push_back(_size);
+            _size += slice.size;
+        }
+        _set_slice(0, 0);
+    }
+
+protected:
+    int_type underflow() override {
+        while (gptr() == egptr()) {
+            if (_cur + 1 >= _slices.size()) {
+                return traits_type::eof();
+            }
+            _set_slice(_cur + 1, 0);
+        }
+        return traits_type::to_int_type(*gptr());
+    }
+
+    pos_type seekoff(off_type off, std::ios_base::seekdir dir,
+                     std::ios_base::openmode which) override {
+        off_type base = 0;
+        if (dir == std::ios_base::cur) {
+            base = _slices.empty() ? 0 : _offsets[_cur] + (gptr() - eback());
+        } else if (dir == std::ios_base::end) {
+            base = _size;
+        }
+        return seekpos(base + off, which);
+    }
+
+    pos_type seekpos(pos_type pos, std::ios_base::openmode which) override {
+        off_type off = pos;
+        if (!(which & std::ios_base::in) || off < 0 || off > static_cast<off_type>(_size)) {
+            return pos_type(off_type(-1));
+        }
+        if (!_slices.empty()) {
+            size_t idx = std::upper_bound(_offsets.begin(), _offsets.end(),
+                                          static_cast<size_t>(off)) -
+                         _offsets.begin() - 1;
+            _set_slice(idx, off - _offsets[idx]);
+        }
+        return pos;
+    }
+
+private:
+    void _set_slice(size_t idx, size_t offset) {
+        if (_slices.empty()) {
+            return;
+        }
+        _cur = idx;
+        char* begin = _slices[idx].data;
+        setg(begin, begin + offset, begin + _slices[idx].size);
+    }
+
+    std::vector<Slice> _slices;
+    // the offset of each slice in the stream
+    std::vector<size_t> _offsets;
+    size_t _size = 0;
+    size_t _cur = 0;
+};
+
 // By default, the AWS SDK reads object data into an auto-growing StringStream.
 // To avoid copies, read directly into our preallocated buffer instead.
 // See https://github.com/aws/aws-sdk-cpp/issues/64 for an alternative but
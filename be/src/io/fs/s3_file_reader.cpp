@@ -17,22 +17,32 @@
 
 #include "io/fs/s3_file_reader.h"
 
+#include <aws/core/http/HttpRequest.h>
 #include <aws/core/http/URI.h>
 #include <aws/core/utils/Outcome.h>
 #include <aws/s3/S3Client.h>
 #include <aws/s3/S3Errors.h>
 #include <aws/s3/model/GetObjectRequest.h>
 #include <aws/s3/model/GetObjectResult.h>
+#include <bvar/latency_recorder.h>
 #include <fmt/format.h>
 #include <glog/logging.h>
 
 #include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <future>
+#include <memory>
 #include <utility>
 
 // IWYU pragma: no_include <opentelemetry/common/threadlocal.h>
 #include "common/compiler_util.h" // IWYU pragma: keep
+#include "common/config.h"
+#include "io/fs/io_scheduler.h"
 #include "io/fs/s3_common.h"
 #include "util/doris_metrics.h"
+#include "util/time.h"
 
 namespace doris {
 namespace io {
@@ -41,6 +51,8 @@ bvar::Adder<uint64_t> s3_file_reader_read_counter("s3_file_reader", "read_at");
 bvar::Adder<uint64_t> s3_file_reader_total("s3_file_reader", "total_num");
 bvar::Adder<uint64_t> s3_bytes_read_total("s3_file_reader", "bytes_read");
 bvar::Adder<uint64_t> s3_file_being_read("s3_file_reader", "file_being_read");
+bvar::Adder<uint64_t> s3_file_reader_hedged_read("s3_file_reader", "hedged_read");
+bvar::LatencyRecorder s3_file_reader_latency("s3_file_reader", "read_latency");
 
 S3FileReader::S3FileReader(Path path, size_t file_size, std::string key, std::string bucket,
                            std::shared_ptr<S3FileSystem> fs)
@@ -71,7 +83,7 @@ Status S3FileReader::close() {
 }
 
 Status S3FileReader::read_at_impl(size_t offset, Slice result, size_t* bytes_read,
-                                  const IOContext* /*io_ctx*/) {
+                                  const IOContext* io_ctx) {
     DCHECK(!closed());
     if (offset > _file_size) {
         return Status::IOError("offset exceeds file size(offset: {}, file size: {}, path: {})",
@@ -84,6 +96,7 @@ Status S3FileReader::read_at_impl(size_t offset, Slice result, size_t* bytes_rea
         *bytes_read = 0;
         return Status::OK();
     }
+    IOScheduler::instance()->schedule(IOScheduler::REMOTE_DEVICE, io_ctx, bytes_req);
 
     Aws::S3::Model::GetObjectRequest request;
     request.WithBucket(_bucket).WithKey(_key);
@@ -94,12 +107,21 @@ Status S3FileReader::read_at_impl(size_t offset, Slice result, size_t* bytes_rea
     if (!client) {
         return Status::InternalError("init s3 client error");
     }
-    auto outcome = client->GetObject(request);
-    if (!outcome.IsSuccess()) {
-        return Status::IOError("failed to read from {}: {}", _path.native(),
-                               outcome.GetError().GetMessage());
+    int64_t start_us = MonotonicMicros();
+    if (config::enable_s3_hedged_read) {
+        int64_t delay_us = std::max<int64_t>(config::s3_hedged_read_min_delay_ms * 1000,
+                                             s3_file_reader_latency.latency_percentile(0.95));
+        RETURN_IF_ERROR(
+                _hedged_get_object(client.get(), request, to, bytes_req, delay_us, bytes_read));
+    } else {
+        auto outcome = client->GetObject(request);
+        if (!outcome.IsSuccess()) {
+            return Status::IOError("failed to read from {}: {}", _path.native(),
+                                   outcome.GetError().GetMessage());
+        }
+        *bytes_read = outcome.GetResult().GetContentLength();
     }
-    *bytes_read = outcome.GetResult().GetContentLength();
+    s3_file_reader_latency << MonotonicMicros() - start_us;
     if (*bytes_read != bytes_req) {
         return Status::IOError("failed to read from {}(bytes read: {}, bytes req: {})",
                                _path.native(), *bytes_read, bytes_req);
@@ -110,5 +132,75 @@ Status S3FileReader::read_at_impl(size_t offset, Slice result, size_t* bytes_rea
     return Status::OK();
 }
 
+Status S3FileReader::_hedged_get_object(Aws::S3::S3Client* client,
+                                        Aws::S3::Model::GetObjectRequest& request, char* to,
+                                        size_t bytes_req, int64_t delay_us, size_t* bytes_read) {
+    // the request still running is cancelled after the other one returns
+    auto cancel_handler = [](std::shared_ptr<std::atomic<bool>> cancelled) {
+        return [cancelled](const Aws::Http::HttpRequest*) { return !cancelled->load(); };
+    };
+    auto primary_cancelled = std::make_shared<std::atomic<bool>>(false);
+    request.SetContinueRequestHandler(cancel_handler(primary_cancelled));
+    auto primary = client->GetObjectCallable(request);
+    Aws::S3::Model::GetObjectOutcome outcome;
+    if (primary.wait_for(std::chrono::microseconds(delay_us)) == std::future_status::ready) {
+        outcome = primary.get();
+    } else {
+        s3_file_reader_hedged_read << 1;
+        std::unique_ptr<char[]> hedged_buf(new char[bytes_req]);
+        auto hedged_cancelled = std::make_shared<std::atomic<bool>>(false);
+        Aws::S3::Model::GetObjectRequest hedged_request = request;
+        hedged_request.SetResponseStreamFactory(
+                AwsWriteableStreamFactory(hedged_buf.get(), bytes_req));
+        hedged_request.SetContinueRequestHandler(cancel_handler(hedged_cancelled));
+        auto hedged = client->GetObjectCallable(hedged_request);
+
+        bool primary_pending = true;
+        bool hedged_pending = true;
+        bool use_hedged = false;
+        while (primary_pending || hedged_pending) {
+            if (primary_pending &&
+                primary.wait_for(std::chrono::milliseconds(1)) == std::future_status::ready) {
+                primary_pending = false;
+                auto primary_outcome = primary.get();
+                if (primary_outcome.IsSuccess() || !hedged_pending) {
+                    outcome = std::move(primary_outcome);
+                    use_hedged = false;
+                    break;
+                }
+            }
+            if (hedged_pending &&
+                hedged.wait_for(std::chrono::milliseconds(0)) == std::future_status::ready) {
+                hedged_pending = false;
+                auto hedged_outcome = hedged.get();
+                if (hedged_outcome.IsSuccess() || !primary_pending) {
+                    outcome = std::move(hedged_outcome);
+                    use_hedged = true;
+                    break;
+                }
+            }
+        }
+        // the buffers must not be written by the other request after return
+        if (primary_pending) {
+            primary_cancelled->store(true);
+            primary.wait();
+        }
+        if (hedged_pending) {
+            hedged_cancelled->store(true);
+            hedged.wait();
+        }
+        if (use_hedged && outcome.IsSuccess()) {
+            memcpy(to, hedged_buf.get(), std::min<size_t>(bytes_req,
+                                                          outcome.GetResult().GetContentLength()));
+        }
+    }
+    if (!outcome.IsSuccess()) {
+        return Status::IOError("failed to read from {}: {}", _path.native(),
+                               outcome.GetError().GetMessage());
+    }
+    *bytes_read = outcome.GetResult().GetContentLength();
+    return Status::OK();
+}
+
 } // namespace io
 } // namespace doris
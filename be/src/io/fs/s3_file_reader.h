@@ -30,6 +30,13 @@
 #include "io/fs/s3_file_system.h"
 #include "util/slice.h"
 
+namespace Aws::S3 {
+namespace Model {
+class GetObjectRequest;
+} // namespace Model
+class S3Client;
+} // namespace Aws::S3
+
 namespace doris {
 namespace io {
 class IOContext;
@@ -55,7 +62,13 @@ protected:
     Status read_at_impl(size_t offset, Slice result, size_t* bytes_read,
                         const IOContext* io_ctx) override;
 
+    std::optional<IOTier> io_tier() const override { return IOTier::REMOTE; }
+
 private:
+    // send the request again into another buffer if it does not return after the delay
+    Status _hedged_get_object(Aws::S3::S3Client* client, Aws::S3::Model::GetObjectRequest& request,
+                              char* to, size_t bytes_req, int64_t delay_us, size_t* bytes_read);
+
     Path _path;
     size_t _file_size;
     std::shared_ptr<S3FileSystem> _fs;
@@ -17,84 +17,107 @@
 
 #include "s3_file_write_bufferpool.h"
 
+#include <algorithm>
 #include <cstring>
 
 #include "common/config.h"
 #include "common/logging.h"
 #include "io/fs/s3_common.h"
 #include "runtime/exec_env.h"
-#include "util/defer_op.h"
 
 namespace doris {
 namespace io {
 void S3FileBuffer::on_finished() {
-    if (_buf.empty()) {
+    if (_bufs.empty()) {
         return;
     }
     reset();
-    S3FileBufferPool::GetInstance()->reclaim(_buf);
-    _buf.clear();
+    S3FileBufferPool::GetInstance()->reclaim(_bufs);
+    _bufs.clear();
 }
 
 // when there is memory preserved, directly write data to buf
 // TODO:(AlexYue): write to file cache otherwise, then we'll wait for free buffer
 // and to rob it
 void S3FileBuffer::append_data(const Slice& data) {
-    Defer defer {[&] { _size += data.get_size(); }};
-    while (true) {
-        // if buf is not empty, it means there is memory preserved for this buf
-        if (!_buf.empty()) {
-            memcpy(_buf.data + _size, data.get_data(), data.get_size());
-            break;
-        } else {
-            // wait allocate buffer pool
-            auto tmp = S3FileBufferPool::GetInstance()->allocate(true);
-            rob_buffer(tmp);
-        }
+    // if bufs is not empty, it means there is memory preserved for this buf
+    if (_bufs.empty()) {
+        // wait allocate buffer pool
+        auto tmp = S3FileBufferPool::GetInstance()->allocate(true, _num_bufs);
+        rob_buffer(tmp);
+    }
+    size_t buffer_size = S3FileBufferPool::GetInstance()->buffer_size();
+    for (size_t pos = 0; pos < data.get_size();) {
+        Slice& buf = _bufs[_size / buffer_size];
+        size_t offset = _size % buffer_size;
+        size_t len = std::min(data.get_size() - pos, buf.size - offset);
+        memcpy(buf.data + offset, data.get_data() + pos, len);
+        pos += len;
+        _size += len;
+    }
+}
+
+std::shared_ptr<std::iostream> S3FileBuffer::new_stream() const {
+    if (_bufs.size() == 1) {
+        return std::make_shared<StringViewStream>(_bufs[0].data, _size);
     }
+    std::vector<Slice> slices;
+    for (size_t i = 0, remaining = _size; i < _bufs.size() && remaining > 0; ++i) {
+        slices.emplace_back(_bufs[i].data, std::min(remaining, _bufs[i].size));
+        remaining -= slices.back().size;
+    }
+    return std::make_shared<SlicesViewStream>(std::move(slices));
 }
 
 void S3FileBuffer::submit() {
-    if (LIKELY(!_buf.empty())) {
-        _stream_ptr = std::make_shared<StringViewStream>(_buf.data, _size);
+    if (LIKELY(!_bufs.empty())) {
+        _stream_ptr = new_stream();
     }
 
-    ExecEnv::GetInstance()->buffered_reader_prefetch_thread_pool()->submit_func(
+    ExecEnv::GetInstance()->s3_file_upload_thread_pool()->submit_func(
             [buf = this->shared_from_this()]() { buf->_on_upload(); });
 }
 
 S3FileBufferPool::S3FileBufferPool() {
     // the nums could be one configuration
-    size_t buf_num = config::s3_write_buffer_whole_size / config::s3_write_buffer_size;
+    _buffer_size = config::s3_write_buffer_size;
+    _num_buffers = config::s3_write_buffer_whole_size / config::s3_write_buffer_size;
     DCHECK((config::s3_write_buffer_size >= 5 * 1024 * 1024) &&
            (config::s3_write_buffer_whole_size > config::s3_write_buffer_size));
-    LOG_INFO("S3 file buffer pool with {} buffers", buf_num);
+    LOG_INFO("S3 file buffer pool with {} buffers", _num_buffers);
     _whole_mem_buffer = std::make_unique<char[]>(config::s3_write_buffer_whole_size);
-    for (size_t i = 0; i < buf_num; i++) {
-        Slice s {_whole_mem_buffer.get() + i * config::s3_write_buffer_size,
-                 static_cast<size_t>(config::s3_write_buffer_size)};
+    for (size_t i = 0; i < _num_buffers; i++) {
+        Slice s {_whole_mem_buffer.get() + i * _buffer_size, _buffer_size};
         _free_raw_buffers.emplace_back(s);
     }
 }
 
-std::shared_ptr<S3FileBuffer> S3FileBufferPool::allocate(bool reserve) {
+std::shared_ptr<S3FileBuffer> S3FileBufferPool::allocate(bool reserve, size_t num_bufs) {
     std::shared_ptr<S3FileBuffer> buf = std::make_shared<S3FileBuffer>();
+    num_bufs = std::clamp<size_t>(num_bufs, 1, _num_buffers);
+    buf->_num_bufs = num_bufs;
+    auto take_buffers = [&]() {
+        std::vector<Slice> bufs;
+        for (size_t i = 0; i < num_bufs; ++i) {
+            bufs.emplace_back(_free_raw_buffers.front());
+            _free_raw_buffers.pop_front();
+        }
+        buf->reserve_buffers(std::move(bufs));
+    };
     // if need reserve then we must ensure return buf with memory preserved
     if (reserve) {
         {
             std::unique_lock<std::mutex> lck {_lock};
-            _cv.wait(lck, [this]() { return !_free_raw_buffers.empty(); });
-            buf->reserve_buffer(_free_raw_buffers.front());
-            _free_raw_buffers.pop_front();
+            _cv.wait(lck, [&]() { return _free_raw_buffers.size() >= num_bufs; });
+            take_buffers();
         }
         return buf;
     }
-    // try to get one memory reserved buffer
+    // try to get the memory reserved buffers
     {
         std::unique_lock<std::mutex> lck {_lock};
-        if (!_free_raw_buffers.empty()) {
-            buf->reserve_buffer(_free_raw_buffers.front());
-            _free_raw_buffers.pop_front();
+        if (_free_raw_buffers.size() >= num_bufs) {
+            take_buffers();
         }
     }
     // if there is no free buffer and no need to reserve memory, we could return one empty buffer
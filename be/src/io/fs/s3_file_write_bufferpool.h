@@ -24,6 +24,7 @@
 #include <list>
 #include <memory>
 #include <mutex>
+#include <vector>
 
 #include "common/config.h"
 #include "common/status.h"
@@ -41,13 +42,13 @@ struct S3FileBuffer : public std::enable_shared_from_this<S3FileBuffer> {
     ~S3FileBuffer() = default;
 
     void rob_buffer(std::shared_ptr<S3FileBuffer>& other) {
-        _buf = other->_buf;
-        // we should clear other's memory buffer in case it woule be reclaimed twice
+        _bufs = std::move(other->_bufs);
+        // we should clear other's memory buffers in case they would be reclaimed twice
         // when calling on_finished
-        other->_buf.clear();
+        other->_bufs.clear();
     }
 
-    void reserve_buffer(Slice s) { _buf = s; }
+    void reserve_buffers(std::vector<Slice> bufs) { _bufs = std::move(bufs); }
 
     // apend data into the memory buffer inside or into the file cache
     // if the buffer has no memory buffer
@@ -63,6 +64,9 @@ struct S3FileBuffer : public std::enable_shared_from_this<S3FileBuffer> {
     // set callback to notify all the tasks that the whole procedure could be cancelled
     // if this buffer's task failed
     void set_on_failed(std::function<void(Status)> cb) { _on_failed = std::move(cb); }
+    // set callback to run after the caller is notified and before this buffer is reclaimed,
+    // e.g. to wait for the requests which still read this buffer
+    void set_before_reclaim(Callback cb) { _before_reclaim = std::move(cb); }
     // reclaim this buffer when task is done
     void on_finished();
     // set the status of the caller if task failed
@@ -71,6 +75,8 @@ struct S3FileBuffer : public std::enable_shared_from_this<S3FileBuffer> {
     size_t get_size() const { return _size; }
     // get the underlying stream containing
     std::shared_ptr<std::iostream> get_stream() const { return _stream_ptr; }
+    // create another stream over the memory buffers, which is read independently
+    std::shared_ptr<std::iostream> new_stream() const;
     // get file offset corresponding to the buffer
     size_t get_file_offset() const { return _offset; }
     // set the offset of the buffer
@@ -81,6 +87,7 @@ struct S3FileBuffer : public std::enable_shared_from_this<S3FileBuffer> {
         _is_cancelled = nullptr;
         _on_failed = nullptr;
         _on_finish_upload = nullptr;
+        _before_reclaim = nullptr;
         _offset = 0;
         _size = 0;
     }
@@ -95,6 +102,9 @@ struct S3FileBuffer : public std::enable_shared_from_this<S3FileBuffer> {
     void _on_upload() {
         _upload_to_remote_callback();
         _on_finish_upload();
+        if (_before_reclaim) {
+            _before_reclaim();
+        }
         on_finished();
     };
     // the caller might be cancelled
@@ -103,12 +113,15 @@ struct S3FileBuffer : public std::enable_shared_from_this<S3FileBuffer> {
     std::function<void(Status)> _on_failed = nullptr;
     // caller of this buf could use this callback to do syncronization
     Callback _on_finish_upload = nullptr;
+    Callback _before_reclaim = nullptr;
     Status _status;
     size_t _offset;
     size_t _size;
     std::shared_ptr<std::iostream> _stream_ptr;
-    // only served as one reserved buffer
-    Slice _buf;
+    // the reserved memory buffers of the pool, a part may take several of them
+    std::vector<Slice> _bufs;
+    // the number of memory buffers to reserve when this buffer has none
+    size_t _num_bufs {1};
     size_t _append_offset {0};
 };
 
@@ -122,15 +135,26 @@ public:
         return &_pool;
     }
 
-    void reclaim(Slice buf) {
+    void reclaim(const std::vector<Slice>& bufs) {
         std::unique_lock<std::mutex> lck {_lock};
-        _free_raw_buffers.emplace_front(buf);
+        for (const auto& buf : bufs) {
+            _free_raw_buffers.emplace_front(buf);
+        }
         _cv.notify_all();
     }
 
-    std::shared_ptr<S3FileBuffer> allocate(bool reserve = false);
+    // The memory buffers of one part are reserved all at once, so the writers never wait
+    // for each other while holding the buffers of a part not uploaded.
+    std::shared_ptr<S3FileBuffer> allocate(bool reserve = false, size_t num_bufs = 1);
+
+    // the size of one memory buffer
+    size_t buffer_size() const { return _buffer_size; }
+
+    size_t num_buffers() const { return _num_buffers; }
 
 private:
+    size_t _buffer_size;
+    size_t _num_buffers;
     std::mutex _lock;
     std::condition_variable _cv;
     std::unique_ptr<char[]> _whole_mem_buffer;
@@ -39,8 +39,12 @@
 #include <fmt/core.h>
 #include <glog/logging.h>
 
+#include <algorithm>
+#include <chrono>
+#include <future>
 #include <sstream>
 #include <utility>
+#include <vector>
 
 #include "common/config.h"
 #include "common/status.h"
@@ -76,6 +80,39 @@ bvar::Adder<uint64_t> s3_file_writer_total("s3_file_writer", "total_num");
 bvar::Adder<uint64_t> s3_bytes_written_total("s3_file_writer", "bytes_written");
 bvar::Adder<uint64_t> s3_file_created_total("s3_file_writer", "file_created");
 bvar::Adder<uint64_t> s3_file_being_written("s3_file_writer", "file_being_written");
+bvar::Adder<uint64_t> s3_file_writer_hedged_parts("s3_file_writer", "hedged_parts");
+
+// Send the part which is not uploaded after s3_write_part_hedge_delay_ms again, and return
+// the first successful outcome. The other request still reads the buffer, so it is waited
+// before the buffer is reclaimed.
+static UploadPartOutcome hedge_upload_part(std::shared_ptr<S3Client> client,
+                                           UploadPartRequest& request,
+                                           UploadPartOutcomeCallable primary, S3FileBuffer& buf) {
+    s3_file_writer_hedged_parts << 1;
+    request.SetBody(buf.new_stream());
+    std::vector<UploadPartOutcomeCallable> pending;
+    pending.push_back(std::move(primary));
+    pending.push_back(client->UploadPartCallable(request));
+    while (true) {
+        for (auto it = pending.begin(); it != pending.end(); ++it) {
+            if (it->wait_for(std::chrono::milliseconds(10)) != std::future_status::ready) {
+                continue;
+            }
+            UploadPartOutcome outcome = it->get();
+            pending.erase(it);
+            if (outcome.IsSuccess() || pending.empty()) {
+                if (!pending.empty()) {
+                    auto other = std::make_shared<UploadPartOutcomeCallable>(
+                            std::move(pending.front()));
+                    // hold the client until the request finishes
+                    buf.set_before_reclaim([client, other]() { other->wait(); });
+                }
+                return outcome;
+            }
+            break;
+        }
+    }
+}
 
 S3FileWriter::S3FileWriter(Path path, std::shared_ptr<S3Client> client, const S3Conf& s3_conf,
                            FileSystemSPtr fs)
@@ -121,11 +158,11 @@ Status S3FileWriter::_create_multi_upload_request() {
                            _bucket, _path.native(), _upload_id, outcome.GetError().GetMessage());
 }
 
-void S3FileWriter::_wait_until_finish(std::string task_name) {
+void S3FileWriter::_wait_until_finish(std::string task_name, int64_t max_pending) {
     auto msg =
             fmt::format("{} multipart upload already takes 5 min, bucket={}, key={}, upload_id={}",
                         std::move(task_name), _bucket, _path.native(), _upload_id);
-    while (!_wait.wait()) {
+    while (!_wait.wait(300, max_pending)) {
         LOG(WARNING) << msg;
     }
 }
@@ -192,7 +229,6 @@ Status S3FileWriter::close() {
 
 Status S3FileWriter::appendv(const Slice* data, size_t data_cnt) {
     DCHECK(!_closed);
-    size_t buffer_size = config::s3_write_buffer_size;
     SCOPED_RAW_TIMER(_upload_cost_ms.get());
     for (size_t i = 0; i < data_cnt; i++) {
         size_t data_size = data[i].get_size();
@@ -201,7 +237,14 @@ Status S3FileWriter::appendv(const Slice* data, size_t data_cnt) {
                 return _st;
             }
             if (!_pending_buf) {
-                _pending_buf = S3FileBufferPool::GetInstance()->allocate();
+                // a writer can not take the whole buffer pool and all the upload threads
+                int64_t max_inflight_parts = config::s3_write_max_inflight_parts_per_writer;
+                if (max_inflight_parts > 0) {
+                    _wait_until_finish("appendv", max_inflight_parts - 1);
+                }
+                size_t num_bufs = _num_buffers_of_part(_cur_part_num);
+                _pending_part_size = num_bufs * S3FileBufferPool::GetInstance()->buffer_size();
+                _pending_buf = S3FileBufferPool::GetInstance()->allocate(false, num_bufs);
                 // capture part num by value along with the value of the shared ptr
                 _pending_buf->set_upload_remote_callback(
                         [part_num = _cur_part_num, this, cur_buf = _pending_buf]() {
@@ -221,8 +264,8 @@ Status S3FileWriter::appendv(const Slice* data, size_t data_cnt) {
             }
             // we need to make sure all parts except the last one to be 5MB or more
             // and shouldn't be larger than buf
-            data_size_to_append = std::min(data_size - pos, _pending_buf->get_file_offset() +
-                                                                    buffer_size - _bytes_appended);
+            data_size_to_append =
+                    std::min(data_size - pos, _pending_part_size - _pending_buf->get_size());
 
             // if the buffer has memory buf inside, the data would be written into memory first then S3 then file cache
             // it would be written to cache then S3 if the buffer doesn't have memory preserved
@@ -231,7 +274,7 @@ Status S3FileWriter::appendv(const Slice* data, size_t data_cnt) {
             // if it's the last part, it could be less than 5MB, or it must
             // satisfy that the size is larger than or euqal to 5MB
             // _complete() would handle the first situation
-            if (_pending_buf->get_size() == buffer_size) {
+            if (_pending_buf->get_size() == _pending_part_size) {
                 // only create multiple upload request when the data is more
                 // than one memory buffer
                 if (_cur_part_num == 1) {
@@ -268,7 +311,13 @@ void S3FileWriter::_upload_one_part(int64_t part_num, S3FileBuffer& buf) {
 
     auto upload_part_callable = _client->UploadPartCallable(upload_request);
 
-    UploadPartOutcome upload_part_outcome = upload_part_callable.get();
+    int64_t hedge_delay_ms = config::s3_write_part_hedge_delay_ms;
+    bool slow = hedge_delay_ms > 0 &&
+                upload_part_callable.wait_for(std::chrono::milliseconds(hedge_delay_ms)) ==
+                        std::future_status::timeout;
+    UploadPartOutcome upload_part_outcome =
+            slow ? hedge_upload_part(_client, upload_request, std::move(upload_part_callable), buf)
+                 : upload_part_callable.get();
     if (!upload_part_outcome.IsSuccess()) {
         auto s = Status::IOError(
                 "failed to upload part (bucket={}, key={}, part_num={}, up_load_id={}): {}",
@@ -291,6 +340,16 @@ void S3FileWriter::_upload_one_part(int64_t part_num, S3FileBuffer& buf) {
     _bytes_written += buf.get_size();
 }
 
+size_t S3FileWriter::_num_buffers_of_part(int part_num) const {
+    auto* pool = S3FileBufferPool::GetInstance();
+    auto max_num = static_cast<size_t>(std::max<int64_t>(
+            1, config::s3_write_max_part_size / static_cast<int64_t>(pool->buffer_size())));
+    // a part should not take too many buffers of the pool shared by all the writers
+    max_num = std::min(max_num, std::max<size_t>(1, pool->num_buffers() / 8));
+    int shift = std::min((part_num - 1) / PARTS_PER_SIZE_DOUBLING, 16);
+    return std::min(max_num, size_t(1) << shift);
+}
+
 Status S3FileWriter::_complete() {
     SCOPED_RAW_TIMER(_upload_cost_ms.get());
     if (_failed) {
@@ -77,22 +77,21 @@ private:
 
         // decrease count if one concurrent worker finished it's work
         void done() {
+            std::unique_lock<std::mutex> lck {_lock};
             _count--;
-            if (_count.load() <= 0) {
-                _cv.notify_all();
-            }
+            _cv.notify_all();
         }
 
-        // wait for all concurrent workers finish their work and return true
+        // wait until at most max_count concurrent workers are still working and return true
         // would return false if timeout, default timeout would be 5min
-        bool wait(int64_t timeout_seconds = 300) {
-            if (_count.load() <= 0) {
+        bool wait(int64_t timeout_seconds = 300, int64_t max_count = 0) {
+            if (_count.load() <= max_count) {
                 return true;
             }
             std::unique_lock<std::mutex> lck {_lock};
             _cv.wait_for(lck, std::chrono::seconds(timeout_seconds),
-                         [this]() { return _count.load() <= 0; });
-            return _count.load() <= 0;
+                         [this, max_count]() { return _count.load() <= max_count; });
+            return _count.load() <= max_count;
         }
 
     private:
@@ -100,11 +99,17 @@ private:
         std::condition_variable _cv;
         std::atomic_int64_t _count {0};
     };
-    void _wait_until_finish(std::string task_name);
+    // the part size is doubled every PARTS_PER_SIZE_DOUBLING parts, so a large file is
+    // uploaded in fewer and larger parts, and does not hit the limit of 10000 parts
+    static constexpr int PARTS_PER_SIZE_DOUBLING = 100;
+
+    void _wait_until_finish(std::string task_name, int64_t max_pending = 0);
     Status _complete();
     Status _create_multi_upload_request();
     void _put_object(S3FileBuffer& buf);
     void _upload_one_part(int64_t part_num, S3FileBuffer& buf);
+    // the number of the buffers of s3 buffer pool to hold the part
+    size_t _num_buffers_of_part(int part_num) const;
 
     std::string _bucket;
     std::string _key;
@@ -129,6 +134,7 @@ private:
     size_t _bytes_written = 0;
 
     std::shared_ptr<S3FileBuffer> _pending_buf = nullptr;
+    size_t _pending_part_size = 0;
 };
 
 } // namespace io
@@ -18,6 +18,7 @@
 #include "stream_load_pipe.h"
 
 #include <glog/logging.h>
+#include <string.h>
 
 #include <algorithm>
 #include <ostream>
@@ -100,6 +101,138 @@ Status StreamLoadPipe::read_at_impl(size_t /*offset*/, Slice result, size_t* byt
     return Status::OK();
 }
 
+Status StreamLoadPipe::read_buffer(ByteBufferPtr* buf) {
+    DCHECK(!_use_proto);
+    // the buffers are allocated by the http threads, as in read_at_impl
+    SCOPED_SWITCH_THREAD_MEM_TRACKER_LIMITER(ExecEnv::GetInstance()->orphan_mem_tracker());
+    buf->reset();
+    if (_split_delimiter.empty()) {
+        return _pop_buffer(buf);
+    }
+    return _pop_line_aligned_buffer(buf);
+}
+
+static ByteBufferPtr copy_to_buffer(const std::string& data) {
+    auto buf = ByteBuffer::allocate(data.size());
+    buf->put_bytes(data.data(), data.size());
+    buf->flip();
+    return buf;
+}
+
+// A buffer of the queue is split into its first line completing the partial line of the last
+// buffer, which is copied, and the following whole lines referenced in place.
+Status StreamLoadPipe::_pop_line_aligned_buffer(ByteBufferPtr* buf) {
+    std::lock_guard<std::mutex> l(_split_lock);
+    if (_split_pending != nullptr) {
+        *buf = std::move(_split_pending);
+        return Status::OK();
+    }
+    const char* delimiter = _split_delimiter.data();
+    size_t delimiter_size = _split_delimiter.size();
+    while (true) {
+        ByteBufferPtr next;
+        RETURN_IF_ERROR(_pop_buffer(&next));
+        if (next == nullptr) {
+            // the last line may have no delimiter
+            if (!_split_partial.empty()) {
+                *buf = copy_to_buffer(_split_partial);
+                _split_partial.clear();
+            }
+            return Status::OK();
+        }
+        const char* start = next->ptr + next->pos;
+        size_t len = next->remaining();
+
+        // the end of the first line, 0 if the buffer starts a line
+        size_t first_end = 0;
+        if (!_split_partial.empty()) {
+            const char* pos = nullptr;
+            if (delimiter_size > 1) {
+                // the delimiter may straddle the partial line and this buffer
+                size_t tail = std::min(_split_partial.size(), delimiter_size - 1);
+                std::string window = _split_partial.substr(_split_partial.size() - tail);
+                window.append(start, std::min(len, delimiter_size - 1));
+                pos = static_cast<const char*>(
+                        memmem(window.data(), window.size(), delimiter, delimiter_size));
+                if (pos != nullptr) {
+                    first_end = delimiter_size - (tail - (pos - window.data()));
+                }
+            }
+            if (pos == nullptr) {
+                pos = static_cast<const char*>(memmem(start, len, delimiter, delimiter_size));
+                if (pos == nullptr) {
+                    _split_partial.append(start, len);
+                    continue;
+                }
+                first_end = pos - start + delimiter_size;
+            }
+        }
+
+        // the end of the last line, the lines are scanned forward as the line reader does
+        // with a multi bytes delimiter, whose occurrences may overlap
+        size_t last_end = first_end;
+        if (delimiter_size == 1) {
+            auto* pos = static_cast<const char*>(
+                    memrchr(start + first_end, delimiter[0], len - first_end));
+            if (pos != nullptr) {
+                last_end = pos - start + 1;
+            }
+        } else {
+            while (true) {
+                auto* pos = static_cast<const char*>(memmem(start + last_end, len - last_end,
+                                                            delimiter, delimiter_size));
+                if (pos == nullptr) {
+                    break;
+                }
+                last_end = pos - start + delimiter_size;
+            }
+        }
+
+        ByteBufferPtr first_line;
+        if (first_end > 0) {
+            _split_partial.append(start, first_end);
+            first_line = copy_to_buffer(_split_partial);
+        }
+        _split_partial.assign(start + last_end, len - last_end);
+        if (last_end > first_end) {
+            size_t base = next->pos;
+            next->pos = base + first_end;
+            next->limit = base + last_end;
+        } else {
+            next.reset();
+        }
+
+        if (first_line != nullptr) {
+            *buf = std::move(first_line);
+            _split_pending = std::move(next);
+            return Status::OK();
+        }
+        if (next != nullptr) {
+            *buf = std::move(next);
+            return Status::OK();
+        }
+    }
+}
+
+Status StreamLoadPipe::_pop_buffer(ByteBufferPtr* buf) {
+    std::unique_lock<std::mutex> l(_lock);
+    while (!_cancelled && !_finished && _buf_queue.empty()) {
+        _get_cond.wait(l);
+    }
+    if (_cancelled) {
+        return Status::InternalError("cancelled: {}", _cancelled_reason);
+    }
+    if (_buf_queue.empty()) {
+        DCHECK(_finished);
+        return Status::OK();
+    }
+    *buf = std::move(_buf_queue.front());
+    _buf_queue.pop_front();
+    _buffered_bytes -= (*buf)->limit;
+    _put_cond.notify_one();
+    return Status::OK();
+}
+
 // If _total_length == -1, this should be a Kafka routine load task,
 // just get the next buffer directly from the buffer queue, because one buffer contains a complete piece of data.
 // Otherwise, this should be a stream load task that needs to read the specified amount of data.
@@ -77,6 +77,15 @@ public:
 
     Status read_one_message(std::unique_ptr<uint8_t[]>* data, size_t* length);
 
+    // Hands out the next buffer of the queue instead of copying its bytes, the reader keeps
+    // it alive as long as it references them and passes it back to be released by the next
+    // call. *buf is nullptr when the pipe is finished. Not for the proto pipes.
+    Status read_buffer(ByteBufferPtr* buf);
+
+    // Makes read_buffer hand out buffers of whole lines, for the scanners parsing the stream
+    // in parallel by sharing the pipe. Called before any read.
+    void split_by_lines(const std::string& line_delimiter) { _split_delimiter = line_delimiter; }
+
     FileSystemSPtr fs() const override { return nullptr; }
 
     size_t get_queue_size() { return _buf_queue.size(); }
@@ -95,6 +104,9 @@ private:
 
     Status _append(const ByteBufferPtr& buf, size_t proto_byte_size = 0);
 
+    Status _pop_buffer(ByteBufferPtr* buf);
+    Status _pop_line_aligned_buffer(ByteBufferPtr* buf);
+
     // Blocking queue
     std::mutex _lock;
     size_t _buffered_bytes;
@@ -119,6 +131,14 @@ private:
     UniqueId _id;
     uint64_t _last_active = 0;
 
+    // not empty if split by lines
+    std::string _split_delimiter;
+    std::mutex _split_lock;
+    // the lines of the last buffer but the first one, to be handed out next
+    ByteBufferPtr _split_pending;
+    // the incomplete line at the end of the last buffer
+    std::string _split_partial;
+
     // no use, only for compatibility with the `Path` interface
     Path _path = "";
 };
@@ -26,6 +26,7 @@
 #include <vector>
 
 #include "agent/utils.h"
+#include "common/config.h"
 #include "common/logging.h"
 #include "io/fs/hdfs.h"
 #include "util/string_util.h"
@@ -129,6 +130,16 @@ Status createHDFSBuilder(const THdfsParams& hdfsParams, HDFSCommonBuilder* build
         hdfsBuilderSetKeyTabFile(builder->get(), hdfsParams.hdfs_kerberos_keytab.c_str());
 #endif
     }
+    // set before the other conf, so it can be overridden by the conf of catalog
+    if (config::hdfs_hedged_read_threadpool_size > 0) {
+        builder->hedged_read_threadpool_size =
+                std::to_string(config::hdfs_hedged_read_threadpool_size);
+        builder->hedged_read_threshold_ms = std::to_string(config::hdfs_hedged_read_threshold_ms);
+        hdfsBuilderConfSetStr(builder->get(), "dfs.client.hedged.read.threadpool.size",
+                              builder->hedged_read_threadpool_size.c_str());
+        hdfsBuilderConfSetStr(builder->get(), "dfs.client.hedged.read.threshold.millis",
+                              builder->hedged_read_threshold_ms.c_str());
+    }
     // set other conf
     if (hdfsParams.__isset.hdfs_conf) {
         for (const THdfsConf& conf : hdfsParams.hdfs_conf) {
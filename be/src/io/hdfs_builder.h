@@ -63,6 +63,9 @@ private:
     bool need_kinit {false};
     std::string hdfs_kerberos_keytab;
     std::string hdfs_kerberos_principal;
+    // hdfsBuilderConfSetStr keeps the pointer of the value, so hold the value here
+    std::string hedged_read_threadpool_size;
+    std::string hedged_read_threshold_ms;
 };
 
 THdfsParams parse_properties(const std::map<std::string, std::string>& properties);
@@ -18,6 +18,7 @@
 #pragma once
 
 #include <gen_cpp/Types_types.h>
+#include <stdint.h>
 
 namespace doris {
 
@@ -46,6 +47,55 @@ struct FileCacheStatistics {
     int64_t num_skip_cache_io_total = 0;
 };
 
+struct HdfsReadStatistics {
+    int64_t num_read_calls = 0;
+    int64_t read_timer = 0;
+    int64_t bytes_read = 0;
+    // the bytes read from the datanode on the same host, by short circuit and by zero copy,
+    // only reported by the hadoop libhdfs
+    int64_t local_bytes_read = 0;
+    int64_t short_circuit_bytes_read = 0;
+    int64_t zero_copy_bytes_read = 0;
+};
+
+// Where the bytes of a read come from, from the nearest to the farthest.
+enum class IOTier : uint8_t {
+    PAGE_CACHE = 0, // StoragePageCache
+    OS_PAGE_CACHE,  // local reads faster than config::local_io_os_page_cache_latency_us
+    LOCAL_DISK,
+    FILE_CACHE, // the block file cache of remote files
+    REMOTE,     // S3, HDFS or broker
+    NUM_TIERS
+};
+
+// The reads of a scan by tier, with a histogram of their latency.
+struct IOStatistics {
+    // bucket i counts the reads below 16us * 4^i, the last one the slower reads
+    static constexpr int NUM_LATENCY_BUCKETS = 8;
+
+    struct Tier {
+        int64_t num_reads = 0;
+        int64_t bytes_read = 0;
+        int64_t read_timer = 0;
+        int64_t latency_buckets[NUM_LATENCY_BUCKETS] = {};
+    };
+
+    void record(IOTier tier, int64_t bytes, int64_t latency_ns) {
+        auto& t = tiers[static_cast<int>(tier)];
+        t.num_reads++;
+        t.bytes_read += bytes;
+        t.read_timer += latency_ns;
+        int bucket = 0;
+        for (int64_t bound_ns = 16000; bucket < NUM_LATENCY_BUCKETS - 1 && latency_ns >= bound_ns;
+             bound_ns *= 4) {
+            ++bucket;
+        }
+        t.latency_buckets[bucket]++;
+    }
+
+    Tier tiers[static_cast<int>(IOTier::NUM_TIERS)];
+};
+
 class IOContext {
 public:
     IOContext() = default;
@@ -61,6 +111,12 @@ public:
     bool is_disposable = false;
     bool read_segment_index = false;
     FileCacheStatistics* file_cache_stats = nullptr;
+    HdfsReadStatistics* hdfs_read_stats = nullptr;
+    // accounted by FileReader::read_at of the readers of the storage, see FileReader::io_tier
+    IOStatistics* io_stats = nullptr;
+    // the workload group of the query, 0 if none, to share the disk bandwidth by cpu share
+    uint64_t workload_group_id = 0;
+    uint64_t workload_group_cpu_share = 0;
 };
 
 } // namespace io
@@ -0,0 +1,91 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "io/io_statistics_reporter.h"
+
+#include <string>
+
+#include "runtime/query_context.h"
+#include "runtime/runtime_state.h"
+#include "runtime/task_group/task_group.h"
+#include "util/runtime_profile.h"
+
+namespace doris {
+namespace io {
+
+const char* io_tier_name(IOTier tier) {
+    switch (tier) {
+    case IOTier::PAGE_CACHE:
+        return "PageCache";
+    case IOTier::OS_PAGE_CACHE:
+        return "OsPageCache";
+    case IOTier::LOCAL_DISK:
+        return "LocalDisk";
+    case IOTier::FILE_CACHE:
+        return "FileCache";
+    case IOTier::REMOTE:
+        return "Remote";
+    default:
+        return "Unknown";
+    }
+}
+
+// the upper bounds of IOStatistics::latency_buckets
+static const char* LATENCY_BUCKET_NAMES[IOStatistics::NUM_LATENCY_BUCKETS] = {
+        "<16us", "<64us", "<256us", "<1ms", "<4ms", "<16ms", "<64ms", ">=64ms"};
+
+void report_io_statistics(RuntimeState* state, RuntimeProfile* profile,
+                          const IOStatistics& stats) {
+    static const char* io_tiers_profile = "IOTiers";
+    bool added_parent = false;
+    for (int i = 0; i < static_cast<int>(IOTier::NUM_TIERS); ++i) {
+        const auto& tier = stats.tiers[i];
+        if (tier.num_reads == 0) {
+            continue;
+        }
+        if (!added_parent) {
+            ADD_TIMER(profile, io_tiers_profile);
+            added_parent = true;
+        }
+        std::string name = io_tier_name(static_cast<IOTier>(i));
+        std::string read_time = name + "ReadTime";
+        COUNTER_UPDATE(ADD_CHILD_COUNTER(profile, name + "NumReads", TUnit::UNIT,
+                                         io_tiers_profile),
+                       tier.num_reads);
+        COUNTER_UPDATE(ADD_CHILD_COUNTER(profile, name + "BytesRead", TUnit::BYTES,
+                                         io_tiers_profile),
+                       tier.bytes_read);
+        COUNTER_UPDATE(ADD_CHILD_TIMER(profile, read_time, io_tiers_profile), tier.read_timer);
+        for (int j = 0; j < IOStatistics::NUM_LATENCY_BUCKETS; ++j) {
+            if (tier.latency_buckets[j] > 0) {
+                COUNTER_UPDATE(ADD_CHILD_COUNTER(profile, name + LATENCY_BUCKET_NAMES[j],
+                                                 TUnit::UNIT, read_time),
+                               tier.latency_buckets[j]);
+            }
+        }
+    }
+
+    if (added_parent && state != nullptr && state->get_query_ctx() != nullptr) {
+        auto* task_group = state->get_query_ctx()->get_task_group();
+        if (task_group != nullptr) {
+            task_group->update_io_statistics(stats);
+        }
+    }
+}
+
+} // namespace io
+} // namespace doris
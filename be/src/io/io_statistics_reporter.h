@@ -0,0 +1,38 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include "io/io_common.h"
+
+namespace doris {
+
+class RuntimeProfile;
+class RuntimeState;
+
+namespace io {
+
+// Adds the reads of a scanner by IO tier to `profile` and to the IO metrics of the workload
+// group of the query. A tier without reads adds no counters, e.g. the remote tier of a scan
+// of local tablets.
+void report_io_statistics(RuntimeState* state, RuntimeProfile* profile,
+                          const IOStatistics& stats);
+
+const char* io_tier_name(IOTier tier);
+
+} // namespace io
+} // namespace doris
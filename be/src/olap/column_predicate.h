@@ -25,6 +25,7 @@
 #include "olap/schema.h"
 #include "olap/selection_vector.h"
 #include "vec/columns/column.h"
+#include "vec/exprs/conjunct_stats.h"
 
 using namespace doris::segment_v2;
 
@@ -223,6 +224,9 @@ public:
 
     std::shared_ptr<PredicateParams> predicate_params() { return _predicate_params; }
 
+    // the stats of short circuit evaluation, to reorder the predicates of a segment iterator
+    vectorized::ConjunctStats& conjunct_stats() const { return _conjunct_stats; }
+
     const std::string pred_type_string(PredicateType type) {
         switch (type) {
         case PredicateType::EQ:
@@ -271,6 +275,7 @@ protected:
     std::shared_ptr<PredicateParams> _predicate_params;
     mutable uint64_t _evaluated_rows = 1;
     mutable uint64_t _passed_rows = 0;
+    mutable vectorized::ConjunctStats _conjunct_stats;
 };
 
 } //namespace doris
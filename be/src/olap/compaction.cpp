@@ -44,6 +44,8 @@
 #include "olap/rowset/rowset_writer.h"
 #include "olap/rowset/rowset_writer_context.h"
 #include "olap/rowset/segment_v2/inverted_index_compaction.h"
+#include "olap/rowset/segment_v2/inverted_index_desc.h"
+#include "olap/rowset/segment_v2/segment.h"
 #include "olap/storage_engine.h"
 #include "olap/storage_policy.h"
 #include "olap/tablet.h"
@@ -94,11 +96,18 @@ Status Compaction::do_compaction(int64_t permits) {
         checksum_task.execute();
     }
 
+    if (StorageEngine::instance() != nullptr) {
+        _record.queue_depth =
+                StorageEngine::instance()->submitted_compaction_num(_tablet->data_dir());
+    }
+    _record.start_time_ms = UnixMillis();
     _tablet->data_dir()->disks_compaction_score_increment(permits);
     _tablet->data_dir()->disks_compaction_num_increment(1);
     Status st = do_compaction_impl(permits);
     _tablet->data_dir()->disks_compaction_score_increment(-permits);
     _tablet->data_dir()->disks_compaction_num_increment(-1);
+    _record.end_time_ms = UnixMillis();
+    add_to_history(st);
 
     if (config::enable_compaction_checksum) {
         EngineChecksumTask checksum_task(_tablet->tablet_id(), _tablet->schema_hash(),
@@ -113,6 +122,27 @@ Status Compaction::do_compaction(int64_t permits) {
     return st;
 }
 
+void Compaction::add_to_history(const Status& st) {
+    _record.tablet_id = _tablet->tablet_id();
+    _record.data_dir = _tablet->data_dir()->path();
+    _record.compaction_type = compaction_name();
+    _record.status = st.ok() ? "OK" : st.to_string();
+    _record.input_rowsets = _input_rowsets.size();
+    _record.input_segments = _input_num_segments;
+    _record.input_rows = _input_row_num;
+    _record.input_bytes = _input_rowsets_size;
+    for (auto& rowset : _input_rowsets) {
+        if (rowset->start_version() == rowset->end_version()) {
+            _record.input_loaded_bytes += rowset->data_disk_size();
+        }
+    }
+    if (st.ok() && _output_rowset != nullptr) {
+        _record.output_rows = _output_rowset->num_rows();
+        _record.output_bytes = _output_rowset->data_disk_size();
+    }
+    CompactionHistory::instance()->add(_record);
+}
+
 bool Compaction::should_vertical_compaction() {
     // some conditions that not use vertical compaction
     if (!config::enable_vertical_compaction) {
@@ -138,6 +168,19 @@ bool Compaction::is_rowset_tidy(std::string& pre_max_key, const RowsetSharedPtr&
     if (rhs->is_segments_overlapping()) {
         return false;
     }
+    // for merge-on-write table, the rows deleted by delete bitmap are dropped by compaction,
+    // linking them as is would keep the garbage forever
+    if (_tablet->enable_unique_key_merge_on_write()) {
+        DeleteBitmap subset_map(_tablet->tablet_id());
+        _tablet->tablet_meta()->delete_bitmap().subset({rhs->rowset_id(), 0, 0},
+                                                       {rhs->rowset_id(), UINT32_MAX, UINT64_MAX},
+                                                       &subset_map);
+        for (const auto& [key, bitmap] : subset_map.delete_bitmap) {
+            if (!bitmap.isEmpty()) {
+                return false;
+            }
+        }
+    }
     // check segment size
     auto beta_rowset = reinterpret_cast<BetaRowset*>(rhs.get());
     std::vector<size_t> segments_size;
@@ -180,6 +223,23 @@ Status Compaction::do_compact_ordered_rowsets() {
         rowset->get_segments_key_bounds(&key_bounds);
         segment_key_bounds.insert(segment_key_bounds.end(), key_bounds.begin(), key_bounds.end());
     }
+    if (_tablet->keys_type() == KeysType::UNIQUE_KEYS &&
+        _tablet->enable_unique_key_merge_on_write()) {
+        // The rows are linked as is, the delete bitmap of the rows deleted by the loads during
+        // compaction is converted with the identity row id mapping in modify_rowsets().
+        _rowid_conversion.set_dst_rowset_id(_output_rs_writer->rowset_id());
+        for (auto& rowset : _input_rowsets) {
+            std::vector<segment_v2::SegmentSharedPtr> segments;
+            RETURN_IF_ERROR(
+                    std::static_pointer_cast<BetaRowset>(rowset)->load_segments(&segments));
+            std::vector<uint32_t> segment_num_rows;
+            for (auto& segment : segments) {
+                segment_num_rows.push_back(segment->num_rows());
+            }
+            _rowid_conversion.init_segment_map(rowset->rowset_id(), segment_num_rows);
+        }
+        _rowid_conversion.add_linked_segments();
+    }
     // build output rowset
     RowsetMetaSharedPtr rowset_meta = std::make_shared<RowsetMeta>();
     rowset_meta->set_num_rows(_input_row_num);
@@ -227,10 +287,6 @@ bool Compaction::handle_ordered_data_compaction() {
         // The remote file system does not support to link files.
         return false;
     }
-    if (_tablet->keys_type() == KeysType::UNIQUE_KEYS &&
-        _tablet->enable_unique_key_merge_on_write()) {
-        return false;
-    }
     // check delete version: if compaction type is base compaction and
     // has a delete version, use original compaction
     if (compaction_type() == ReaderType::READER_BASE_COMPACTION) {
@@ -259,6 +315,8 @@ bool Compaction::handle_ordered_data_compaction() {
     // just handle nonoverlappint rowsets
     auto st = do_compact_ordered_rowsets();
     if (!st.ok()) {
+        // the rowid conversion is rebuilt by the normal compaction
+        _rowid_conversion = RowIdConversion();
         return false;
     }
     return true;
@@ -266,9 +324,13 @@ bool Compaction::handle_ordered_data_compaction() {
 
 Status Compaction::do_compaction_impl(int64_t permits) {
     OlapStopWatch watch;
+    OlapStopWatch phase_watch;
 
     if (handle_ordered_data_compaction()) {
+        _record.build_time_us = phase_watch.get_elapse_time_us();
+        phase_watch.reset();
         RETURN_IF_ERROR(modify_rowsets());
+        _record.modify_time_us = phase_watch.get_elapse_time_us();
 
         int64_t now = UnixMillis();
         if (compaction_type() == ReaderType::READER_CUMULATIVE_COMPACTION) {
@@ -298,6 +360,8 @@ Status Compaction::do_compaction_impl(int64_t permits) {
     if (compaction_type() == ReaderType::READER_COLD_DATA_COMPACTION) {
         Tablet::add_pending_remote_rowset(_output_rs_writer->rowset_id().to_string());
     }
+    _record.prepare_time_us = phase_watch.get_elapse_time_us();
+    phase_watch.reset();
 
     // 2. write merged rows to output rowset
     // The test results show that merger is low-memory-footprint, there is no need to tracker its mem pool
@@ -318,6 +382,10 @@ Status Compaction::do_compaction_impl(int64_t permits) {
         res = Merger::vmerge_rowsets(_tablet, compaction_type(), _cur_tablet_schema,
                                      _input_rs_readers, _output_rs_writer.get(), &stats);
     }
+    _record.merge_time_us = phase_watch.get_elapse_time_us();
+    _record.merged_rows = stats.merged_rows;
+    _record.filtered_rows = stats.filtered_rows;
+    phase_watch.reset();
 
     if (!res.ok()) {
         LOG(WARNING) << "fail to do " << compaction_name() << ". res=" << res
@@ -406,8 +474,12 @@ Status Compaction::do_compaction_impl(int64_t permits) {
                   << ". elapsed time=" << inverted_watch.get_elapse_second() << "s.";
     }
 
+    _record.build_time_us = phase_watch.get_elapse_time_us();
+    phase_watch.reset();
+
     // 4. modify rowsets in memory
     RETURN_IF_ERROR(modify_rowsets(&stats));
+    _record.modify_time_us = phase_watch.get_elapse_time_us();
 
     // 5. update last success compaction time
     int64_t now = UnixMillis();
@@ -444,6 +516,48 @@ Status Compaction::do_compaction_impl(int64_t permits) {
     return Status::OK();
 }
 
+bool Compaction::input_rowsets_have_index_files(int64_t index_id) {
+    for (auto& rowset : _input_rowsets) {
+        auto beta_rowset = std::static_pointer_cast<BetaRowset>(rowset);
+        auto fs = rowset->rowset_meta()->fs();
+        for (int i = 0; i < rowset->num_segments(); ++i) {
+            bool exists = false;
+            auto index_file = segment_v2::InvertedIndexDescriptor::get_index_file_name(
+                    beta_rowset->segment_file_path(i), index_id);
+            if (fs == nullptr || !fs->exists(index_file, &exists).ok() || !exists) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+bool Compaction::can_compact_inverted_index(const TabletIndex& index) {
+    // the rows of aggregate keys tables are aggregated from several input rows, and the
+    // merge does not record the row ids
+    if (_tablet->keys_type() != KeysType::UNIQUE_KEYS &&
+        _tablet->keys_type() != KeysType::DUP_KEYS) {
+        return false;
+    }
+    auto unique_id = index.col_unique_ids()[0];
+    if (_cur_tablet_schema->field_index(unique_id) < 0) {
+        return false;
+    }
+    const auto& column = _cur_tablet_schema->column_by_uid(unique_id);
+    auto type = column.type();
+    if (type == FieldType::OLAP_FIELD_TYPE_ARRAY) {
+        // an array is indexed as one document of several terms, just like a string
+        type = column.get_sub_column(0).type();
+    }
+    // the bkd index of numeric types can not be merged
+    if (!field_is_slice_type(type)) {
+        return false;
+    }
+    // the input rowsets could be written before the index is added, or be indexed
+    // asynchronously, then the index is rebuilt from the merged rows
+    return input_rowsets_have_index_files(index.index_id());
+}
+
 Status Compaction::construct_output_rowset_writer(RowsetWriterContext& ctx, bool is_vertical) {
     ctx.version = _output_version;
     ctx.rowset_state = VISIBLE;
@@ -451,15 +565,10 @@ Status Compaction::construct_output_rowset_writer(RowsetWriterContext& ctx, bool
     ctx.tablet_schema = _cur_tablet_schema;
     ctx.newest_write_timestamp = _newest_write_timestamp;
     ctx.write_type = DataWriteType::TYPE_COMPACTION;
-    if (config::inverted_index_compaction_enable &&
-        ((_tablet->keys_type() == KeysType::UNIQUE_KEYS ||
-          _tablet->keys_type() == KeysType::DUP_KEYS))) {
+    if (config::inverted_index_compaction_enable) {
         for (auto& index : _cur_tablet_schema->indexes()) {
-            if (index.index_type() == IndexType::INVERTED) {
-                auto unique_id = index.col_unique_ids()[0];
-                if (field_is_slice_type(_cur_tablet_schema->column_by_uid(unique_id).type())) {
-                    ctx.skip_inverted_index.insert(unique_id);
-                }
+            if (index.index_type() == IndexType::INVERTED && can_compact_inverted_index(index)) {
+                ctx.skip_inverted_index.insert(index.col_unique_ids()[0]);
             }
         }
     }
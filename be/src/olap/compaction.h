@@ -26,6 +26,7 @@
 
 #include "common/status.h"
 #include "io/io_common.h"
+#include "olap/compaction_history.h"
 #include "olap/merger.h"
 #include "olap/olap_common.h"
 #include "olap/rowid_conversion.h"
@@ -89,6 +90,12 @@ protected:
     Status do_compact_ordered_rowsets();
     bool is_rowset_tidy(std::string& pre_max_key, const RowsetSharedPtr& rhs);
     void build_basic_info();
+    // whether the index of the output rowset can be merged from the indexes of the input
+    // rowsets with the row id conversion, instead of indexing the merged rows again
+    bool can_compact_inverted_index(const TabletIndex& index);
+    // false if the index of any input segment is not built, e.g. it is built asynchronously
+    bool input_rowsets_have_index_files(int64_t index_id);
+    void add_to_history(const Status& st);
 
 protected:
     // the root tracker for this compaction
@@ -115,6 +122,9 @@ protected:
     RowIdConversion _rowid_conversion;
     TabletSchemaSPtr _cur_tablet_schema;
 
+    // the phases and the stats of this compaction kept in CompactionHistory
+    CompactionRecord _record;
+
     DISALLOW_COPY_AND_ASSIGN(Compaction);
 };
 
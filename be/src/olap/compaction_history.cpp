@@ -0,0 +1,46 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+
+#include "olap/compaction_history.h"
+
+#include <algorithm>
+#include <utility>
+
+#include "common/config.h"
+
+namespace doris {
+
+CompactionHistory* CompactionHistory::instance() {
+    static CompactionHistory history;
+    return &history;
+}
+
+void CompactionHistory::add(CompactionRecord record) {
+    std::lock_guard l(_lock);
+    _records.push_back(std::move(record));
+    while (_records.size() > static_cast<size_t>(std::max(config::compaction_history_size, 0))) {
+        _records.pop_front();
+    }
+}
+
+std::vector<CompactionRecord> CompactionHistory::get_records() {
+    std::lock_guard l(_lock);
+    return {_records.begin(), _records.end()};
+}
+
+} // namespace doris
@@ -0,0 +1,80 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+
+#pragma once
+
+#include <stdint.h>
+
+#include <deque>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace doris {
+
+struct CompactionRecord {
+    int64_t tablet_id = 0;
+    std::string data_dir;
+    std::string compaction_type;
+    std::string status;
+    // the compactions submitted on the data dir, queued or running, when this one started
+    int64_t queue_depth = 0;
+    int64_t start_time_ms = 0;
+    int64_t end_time_ms = 0;
+
+    // picking the readers and the writer, merging the rows, building the output rowset
+    // with its indexes, and replacing the input rowsets in the tablet
+    int64_t prepare_time_us = 0;
+    int64_t merge_time_us = 0;
+    int64_t build_time_us = 0;
+    int64_t modify_time_us = 0;
+
+    int64_t input_rowsets = 0;
+    int64_t input_segments = 0;
+    int64_t input_rows = 0;
+    int64_t input_bytes = 0;
+    // the bytes of the input rowsets written by loads and not compacted before
+    int64_t input_loaded_bytes = 0;
+    int64_t output_rows = 0;
+    int64_t output_bytes = 0;
+    int64_t merged_rows = 0;
+    int64_t filtered_rows = 0;
+
+    // The bytes written by the compaction for each byte loaded, 0 if no input rowset is
+    // written by loads, e.g. a base compaction.
+    double write_amplification() const {
+        return input_loaded_bytes > 0 ? double(output_bytes) / input_loaded_bytes : 0;
+    }
+};
+
+// The last config::compaction_history_size compactions of this BE, served by
+// information_schema.compaction_history.
+class CompactionHistory {
+public:
+    static CompactionHistory* instance();
+
+    void add(CompactionRecord record);
+
+    std::vector<CompactionRecord> get_records();
+
+private:
+    std::mutex _lock;
+    std::deque<CompactionRecord> _records;
+};
+
+} // namespace doris
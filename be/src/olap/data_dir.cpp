@@ -22,16 +22,19 @@
 #include <gen_cpp/olap_file.pb.h>
 #include <stdio.h>
 
+#include <algorithm>
 #include <atomic>
 // IWYU pragma: no_include <bits/chrono.h>
 #include <chrono> // IWYU pragma: keep
 #include <filesystem>
 #include <memory>
+#include <mutex>
 #include <new>
 #include <set>
 #include <sstream>
 #include <string>
 #include <thread>
+#include <unordered_map>
 #include <utility>
 
 #include "common/config.h"
@@ -60,6 +63,7 @@
 #include "service/backend_options.h"
 #include "util/doris_metrics.h"
 #include "util/string_util.h"
+#include "util/threadpool.h"
 #include "util/uid_util.h"
 
 using strings::Substitute;
@@ -74,8 +78,12 @@ DEFINE_GAUGE_METRIC_PROTOTYPE_2ARG(disks_remote_used_capacity, MetricUnit::BYTES
 DEFINE_GAUGE_METRIC_PROTOTYPE_2ARG(disks_state, MetricUnit::BYTES);
 DEFINE_GAUGE_METRIC_PROTOTYPE_2ARG(disks_compaction_score, MetricUnit::NOUNIT);
 DEFINE_GAUGE_METRIC_PROTOTYPE_2ARG(disks_compaction_num, MetricUnit::NOUNIT);
+DEFINE_GAUGE_METRIC_PROTOTYPE_2ARG(disks_loaded_tablet_num, MetricUnit::NOUNIT);
+DEFINE_GAUGE_METRIC_PROTOTYPE_2ARG(disks_loaded_rowset_num, MetricUnit::NOUNIT);
 
 static const char* const kTestFilePath = ".testfile";
+// number of metas loaded in one task when loading data dir
+static const size_t LOAD_BATCH_SIZE = 64;
 
 DataDir::DataDir(const std::string& path, int64_t capacity_bytes,
                  TStorageMedium::type storage_medium, TabletManager* tablet_manager,
@@ -102,6 +110,8 @@ DataDir::DataDir(const std::string& path, int64_t capacity_bytes,
     INT_GAUGE_METRIC_REGISTER(_data_dir_metric_entity, disks_state);
     INT_GAUGE_METRIC_REGISTER(_data_dir_metric_entity, disks_compaction_score);
     INT_GAUGE_METRIC_REGISTER(_data_dir_metric_entity, disks_compaction_num);
+    INT_GAUGE_METRIC_REGISTER(_data_dir_metric_entity, disks_loaded_tablet_num);
+    INT_GAUGE_METRIC_REGISTER(_data_dir_metric_entity, disks_loaded_rowset_num);
 }
 
 DataDir::~DataDir() {
@@ -365,26 +375,61 @@ Status DataDir::load() {
     // necessarily check incompatible old format. when there are old metas, it may load to data missing
     _check_incompatible_old_format_tablet();
 
-    std::vector<RowsetMetaSharedPtr> dir_rowset_metas;
-    LOG(INFO) << "begin loading rowset from meta";
-    auto load_rowset_func = [&dir_rowset_metas, &local_fs = fs()](
-                                    TabletUid tablet_uid, RowsetId rowset_id,
-                                    const std::string& meta_str) -> bool {
-        RowsetMetaSharedPtr rowset_meta(new RowsetMeta());
-        bool parsed = rowset_meta->init(meta_str);
-        if (!parsed) {
-            LOG(WARNING) << "parse rowset meta string failed for rowset_id:" << rowset_id;
-            // return false will break meta iterator, return true to skip this error
-            return true;
+    // The metas are deserialized and the tablets and rowsets are initialized in parallel,
+    // since a data dir with many tablets takes a long time to load on one thread.
+    std::unique_ptr<ThreadPool> load_pool;
+    ThreadPoolBuilder("LoadDataDirThreadPool")
+            .set_min_threads(1)
+            .set_max_threads(std::max(1, config::load_data_dir_thread_num))
+            .build(&load_pool);
+    // run the task in the current thread if the pool is not available
+    auto submit = [&load_pool](std::function<void()> task) {
+        if (load_pool == nullptr || !load_pool->submit_func(task).ok()) {
+            task();
         }
-        if (rowset_meta->is_local()) {
-            rowset_meta->set_fs(local_fs);
-        }
-        dir_rowset_metas.push_back(rowset_meta);
+    };
+
+    std::vector<std::pair<RowsetId, std::string>> rowset_meta_strs;
+    LOG(INFO) << "begin loading rowset from meta";
+    auto load_rowset_func = [&rowset_meta_strs](TabletUid tablet_uid, RowsetId rowset_id,
+                                                const std::string& meta_str) -> bool {
+        rowset_meta_strs.emplace_back(rowset_id, meta_str);
         return true;
     };
     Status load_rowset_status = RowsetMetaManager::traverse_rowset_metas(_meta, load_rowset_func);
 
+    std::vector<RowsetMetaSharedPtr> parsed_rowset_metas(rowset_meta_strs.size());
+    for (size_t begin = 0; begin < rowset_meta_strs.size(); begin += LOAD_BATCH_SIZE) {
+        size_t end = std::min(begin + LOAD_BATCH_SIZE, rowset_meta_strs.size());
+        submit([&, begin, end] {
+            for (size_t i = begin; i < end; ++i) {
+                RowsetMetaSharedPtr rowset_meta(new RowsetMeta());
+                if (!rowset_meta->init(rowset_meta_strs[i].second)) {
+                    LOG(WARNING) << "parse rowset meta string failed for rowset_id:"
+                                 << rowset_meta_strs[i].first;
+                    continue;
+                }
+                if (rowset_meta->is_local()) {
+                    rowset_meta->set_fs(fs());
+                }
+                parsed_rowset_metas[i] = std::move(rowset_meta);
+            }
+        });
+    }
+    if (load_pool != nullptr) {
+        load_pool->wait();
+    }
+    rowset_meta_strs.clear();
+    std::vector<RowsetMetaSharedPtr> dir_rowset_metas;
+    dir_rowset_metas.reserve(parsed_rowset_metas.size());
+    for (auto& rowset_meta : parsed_rowset_metas) {
+        // skip the rowset metas failed to parse
+        if (rowset_meta != nullptr) {
+            dir_rowset_metas.push_back(std::move(rowset_meta));
+        }
+    }
+    parsed_rowset_metas.clear();
+
     if (!load_rowset_status) {
         LOG(WARNING) << "errors when load rowset meta from meta env, skip this data dir:" << _path;
     } else {
@@ -394,38 +439,44 @@ Status DataDir::load() {
     // load tablet
     // create tablet from tablet meta and add it to tablet mgr
     LOG(INFO) << "begin loading tablet from meta";
-    std::set<int64_t> tablet_ids;
-    std::set<int64_t> failed_tablet_ids;
-    auto load_tablet_func = [this, &tablet_ids, &failed_tablet_ids](
-                                    int64_t tablet_id, int32_t schema_hash,
-                                    const std::string& value) -> bool {
-        Status status = _tablet_manager->load_tablet_from_meta(this, tablet_id, schema_hash, value,
-                                                               false, false, false, false);
-        if (!status.ok() && !status.is<TABLE_ALREADY_DELETED_ERROR>() &&
-            !status.is<ENGINE_INSERT_OLD_TABLET>()) {
-            // load_tablet_from_meta() may return Status::Error<TABLE_ALREADY_DELETED_ERROR>()
-            // which means the tablet status is DELETED
-            // This may happen when the tablet was just deleted before the BE restarted,
-            // but it has not been cleared from rocksdb. At this time, restarting the BE
-            // will read the tablet in the DELETE state from rocksdb. These tablets have been
-            // added to the garbage collection queue and will be automatically deleted afterwards.
-            // Therefore, we believe that this situation is not a failure.
-
-            // Besides, load_tablet_from_meta() may return Status::Error<ENGINE_INSERT_OLD_TABLET>()
-            // when BE is restarting and the older tablet have been added to the
-            // garbage collection queue but not deleted yet.
-            // In this case, since the data_dirs are parallel loaded, a later loaded tablet
-            // may be older than previously loaded one, which should not be acknowledged as a
-            // failure.
-            LOG(WARNING) << "load tablet from header failed. status:" << status
-                         << ", tablet=" << tablet_id << "." << schema_hash;
-            failed_tablet_ids.insert(tablet_id);
-        } else {
-            tablet_ids.insert(tablet_id);
-        }
+    struct TabletMetaStr {
+        int64_t tablet_id;
+        int32_t schema_hash;
+        std::string value;
+    };
+    std::vector<TabletMetaStr> tablet_meta_strs;
+    auto load_tablet_func = [&tablet_meta_strs](int64_t tablet_id, int32_t schema_hash,
+                                                const std::string& value) -> bool {
+        tablet_meta_strs.push_back({tablet_id, schema_hash, value});
         return true;
     };
     Status load_tablet_status = TabletMetaManager::traverse_headers(_meta, load_tablet_func);
+
+    std::mutex tablet_ids_lock;
+    std::set<int64_t> tablet_ids;
+    std::set<int64_t> failed_tablet_ids;
+    std::atomic<int64_t> loaded_tablet_num = 0;
+    disks_loaded_tablet_num->set_value(0);
+    for (size_t begin = 0; begin < tablet_meta_strs.size(); begin += LOAD_BATCH_SIZE) {
+        size_t end = std::min(begin + LOAD_BATCH_SIZE, tablet_meta_strs.size());
+        submit([&, begin, end] {
+            for (size_t i = begin; i < end; ++i) {
+                auto& meta_str = tablet_meta_strs[i];
+                _load_tablet_from_meta(meta_str.tablet_id, meta_str.schema_hash, meta_str.value,
+                                       &tablet_ids_lock, &tablet_ids, &failed_tablet_ids);
+                // release the memory of the meta as soon as possible
+                std::string().swap(meta_str.value);
+            }
+            int64_t loaded = loaded_tablet_num.fetch_add(end - begin) + (end - begin);
+            disks_loaded_tablet_num->set_value(loaded);
+            LOG_EVERY_N(INFO, 100) << "loading tablets from " << _path << ", progress: " << loaded
+                                   << "/" << tablet_meta_strs.size();
+        });
+    }
+    if (load_pool != nullptr) {
+        load_pool->wait();
+    }
+    tablet_meta_strs.clear();
     if (failed_tablet_ids.size() != 0) {
         LOG(WARNING) << "load tablets from header failed"
                      << ", loaded tablet: " << tablet_ids.size()
@@ -444,84 +495,63 @@ Status DataDir::load() {
                   << ", error tablet: " << failed_tablet_ids.size() << ", path: " << _path;
     }
 
-    for (int64_t tablet_id : tablet_ids) {
+    // merge the delete bitmaps of the merge-on-write tablets saved after their tablet metas
+    int64_t num_delete_bitmaps = 0;
+    auto load_delete_bitmap_func = [&](int64_t tablet_id, int64_t version,
+                                       const std::string& value) -> bool {
         TabletSharedPtr tablet = _tablet_manager->get_tablet(tablet_id);
-        if (tablet && tablet->set_tablet_schema_into_rowset_meta()) {
-            TabletMetaManager::save(this, tablet->tablet_id(), tablet->schema_hash(),
-                                    tablet->tablet_meta());
+        if (tablet == nullptr || tablet->data_dir() != this ||
+            !tablet->enable_unique_key_merge_on_write()) {
+            return true;
         }
-    }
+        Status st = TabletMetaManager::merge_delete_bitmap(
+                value, &tablet->tablet_meta()->delete_bitmap());
+        if (!st.ok()) {
+            LOG(WARNING) << "failed to load delete bitmap of tablet " << tablet_id
+                         << ", version: " << version << ", status: " << st;
+        }
+        ++num_delete_bitmaps;
+        return true;
+    };
+    Status load_delete_bitmap_status =
+            TabletMetaManager::traverse_delete_bitmaps(_meta, load_delete_bitmap_func);
+    LOG(INFO) << "load delete bitmaps from meta finished, delete bitmaps: " << num_delete_bitmaps
+              << ", status: " << load_delete_bitmap_status << ", path: " << _path;
 
     // traverse rowset
     // 1. add committed rowset to txn map
     // 2. add visible rowset to tablet
-    // ignore any errors when load tablet or rowset, because fe will repair them after report
-    int64_t invalid_rowset_counter = 0;
-    for (auto rowset_meta : dir_rowset_metas) {
-        TabletSharedPtr tablet = _tablet_manager->get_tablet(rowset_meta->tablet_id());
-        // tablet maybe dropped, but not drop related rowset meta
-        if (tablet == nullptr) {
-            VLOG_NOTICE << "could not find tablet id: " << rowset_meta->tablet_id()
-                        << ", schema hash: " << rowset_meta->tablet_schema_hash()
-                        << ", for rowset: " << rowset_meta->rowset_id() << ", skip this rowset";
-            ++invalid_rowset_counter;
-            continue;
-        }
-
-        RowsetSharedPtr rowset;
-        Status create_status = tablet->create_rowset(rowset_meta, &rowset);
-        if (!create_status) {
-            LOG(WARNING) << "could not create rowset from rowsetmeta: "
-                         << " rowset_id: " << rowset_meta->rowset_id()
-                         << " rowset_type: " << rowset_meta->rowset_type()
-                         << " rowset_state: " << rowset_meta->rowset_state();
-            continue;
-        }
-        if (rowset_meta->rowset_state() == RowsetStatePB::COMMITTED &&
-            rowset_meta->tablet_uid() == tablet->tablet_uid()) {
-            if (!rowset_meta->tablet_schema()) {
-                rowset_meta->set_tablet_schema(tablet->tablet_schema());
-                RowsetMetaManager::save(_meta, rowset_meta->tablet_uid(), rowset_meta->rowset_id(),
-                                        rowset_meta->get_rowset_pb());
-            }
-            Status commit_txn_status = _txn_manager->commit_txn(
-                    _meta, rowset_meta->partition_id(), rowset_meta->txn_id(),
-                    rowset_meta->tablet_id(), rowset_meta->tablet_schema_hash(),
-                    rowset_meta->tablet_uid(), rowset_meta->load_id(), rowset, true);
-            if (!commit_txn_status && !commit_txn_status.is<PUSH_TRANSACTION_ALREADY_EXIST>()) {
-                LOG(WARNING) << "failed to add committed rowset: " << rowset_meta->rowset_id()
-                             << " to tablet: " << rowset_meta->tablet_id()
-                             << " for txn: " << rowset_meta->txn_id();
-            } else {
-                LOG(INFO) << "successfully to add committed rowset: " << rowset_meta->rowset_id()
-                          << " to tablet: " << rowset_meta->tablet_id()
-                          << " schema hash: " << rowset_meta->tablet_schema_hash()
-                          << " for txn: " << rowset_meta->txn_id();
-            }
-        } else if (rowset_meta->rowset_state() == RowsetStatePB::VISIBLE &&
-                   rowset_meta->tablet_uid() == tablet->tablet_uid()) {
-            if (!rowset_meta->tablet_schema()) {
-                rowset_meta->set_tablet_schema(tablet->tablet_schema());
-                RowsetMetaManager::save(_meta, rowset_meta->tablet_uid(), rowset_meta->rowset_id(),
-                                        rowset_meta->get_rowset_pb());
-            }
-            Status publish_status = tablet->add_rowset(rowset);
-            if (!publish_status && !publish_status.is<PUSH_VERSION_ALREADY_EXIST>()) {
-                LOG(WARNING) << "add visible rowset to tablet failed rowset_id:"
-                             << rowset->rowset_id() << " tablet id: " << rowset_meta->tablet_id()
-                             << " txn id:" << rowset_meta->txn_id()
-                             << " start_version: " << rowset_meta->version().first
-                             << " end_version: " << rowset_meta->version().second;
+    // ignore any errors when load tablet or rowset, because fe will repair them after report.
+    // The rowsets of one tablet are loaded in the same task to keep the order of them.
+    std::unordered_map<int64_t, std::vector<RowsetMetaSharedPtr>> tablet_rowset_metas;
+    for (auto& rowset_meta : dir_rowset_metas) {
+        tablet_rowset_metas[rowset_meta->tablet_id()].push_back(rowset_meta);
+    }
+    std::atomic<int64_t> invalid_rowset_counter = 0;
+    disks_loaded_rowset_num->set_value(0);
+    std::vector<const std::vector<RowsetMetaSharedPtr>*> rowset_metas_of_tablets;
+    rowset_metas_of_tablets.reserve(tablet_rowset_metas.size());
+    for (auto& [_, rowset_metas] : tablet_rowset_metas) {
+        rowset_metas_of_tablets.push_back(&rowset_metas);
+    }
+    for (size_t begin = 0; begin < rowset_metas_of_tablets.size(); begin += LOAD_BATCH_SIZE) {
+        size_t end = std::min(begin + LOAD_BATCH_SIZE, rowset_metas_of_tablets.size());
+        submit([&, begin, end] {
+            int64_t num_rowsets = 0;
+            for (size_t i = begin; i < end; ++i) {
+                for (auto& rowset_meta : *rowset_metas_of_tablets[i]) {
+                    if (!_load_rowset_from_meta(rowset_meta)) {
+                        ++invalid_rowset_counter;
+                    }
+                }
+                num_rowsets += rowset_metas_of_tablets[i]->size();
             }
-        } else {
-            LOG(WARNING) << "find invalid rowset: " << rowset_meta->rowset_id()
-                         << " with tablet id: " << rowset_meta->tablet_id()
-                         << " tablet uid: " << rowset_meta->tablet_uid()
-                         << " schema hash: " << rowset_meta->tablet_schema_hash()
-                         << " txn: " << rowset_meta->txn_id()
-                         << " current valid tablet uid: " << tablet->tablet_uid();
-            ++invalid_rowset_counter;
-        }
+            disks_loaded_rowset_num->increment(num_rowsets);
+        });
+    }
+    if (load_pool != nullptr) {
+        load_pool->wait();
+        load_pool->shutdown();
     }
 
     // At startup, we only count these invalid rowset, but do not actually delete it.
@@ -529,11 +559,117 @@ Status DataDir::load() {
     // which is cleaned up uniformly by the background cleanup thread.
     LOG(INFO) << "finish to load tablets from " << _path
               << ", total rowset meta: " << dir_rowset_metas.size()
-              << ", invalid rowset num: " << invalid_rowset_counter;
+              << ", invalid rowset num: " << invalid_rowset_counter.load();
 
     return Status::OK();
 }
 
+void DataDir::_load_tablet_from_meta(int64_t tablet_id, int32_t schema_hash,
+                                     const std::string& value, std::mutex* tablet_ids_lock,
+                                     std::set<int64_t>* tablet_ids,
+                                     std::set<int64_t>* failed_tablet_ids) {
+    Status status = _tablet_manager->load_tablet_from_meta(this, tablet_id, schema_hash, value,
+                                                           false, false, false, false);
+    if (!status.ok() && !status.is<TABLE_ALREADY_DELETED_ERROR>() &&
+        !status.is<ENGINE_INSERT_OLD_TABLET>()) {
+        // load_tablet_from_meta() may return Status::Error<TABLE_ALREADY_DELETED_ERROR>()
+        // which means the tablet status is DELETED
+        // This may happen when the tablet was just deleted before the BE restarted,
+        // but it has not been cleared from rocksdb. At this time, restarting the BE
+        // will read the tablet in the DELETE state from rocksdb. These tablets have been
+        // added to the garbage collection queue and will be automatically deleted afterwards.
+        // Therefore, we believe that this situation is not a failure.
+
+        // Besides, load_tablet_from_meta() may return Status::Error<ENGINE_INSERT_OLD_TABLET>()
+        // when BE is restarting and the older tablet have been added to the
+        // garbage collection queue but not deleted yet.
+        // In this case, since the data_dirs are parallel loaded, a later loaded tablet
+        // may be older than previously loaded one, which should not be acknowledged as a
+        // failure.
+        LOG(WARNING) << "load tablet from header failed. status:" << status
+                     << ", tablet=" << tablet_id << "." << schema_hash;
+        std::lock_guard<std::mutex> l(*tablet_ids_lock);
+        failed_tablet_ids->insert(tablet_id);
+        return;
+    }
+    {
+        std::lock_guard<std::mutex> l(*tablet_ids_lock);
+        tablet_ids->insert(tablet_id);
+    }
+    TabletSharedPtr tablet = _tablet_manager->get_tablet(tablet_id);
+    if (tablet && tablet->set_tablet_schema_into_rowset_meta()) {
+        TabletMetaManager::save(this, tablet->tablet_id(), tablet->schema_hash(),
+                                tablet->tablet_meta());
+    }
+}
+
+bool DataDir::_load_rowset_from_meta(const RowsetMetaSharedPtr& rowset_meta) {
+    TabletSharedPtr tablet = _tablet_manager->get_tablet(rowset_meta->tablet_id());
+    // tablet maybe dropped, but not drop related rowset meta
+    if (tablet == nullptr) {
+        VLOG_NOTICE << "could not find tablet id: " << rowset_meta->tablet_id()
+                    << ", schema hash: " << rowset_meta->tablet_schema_hash()
+                    << ", for rowset: " << rowset_meta->rowset_id() << ", skip this rowset";
+        return false;
+    }
+
+    RowsetSharedPtr rowset;
+    Status create_status = tablet->create_rowset(rowset_meta, &rowset);
+    if (!create_status) {
+        LOG(WARNING) << "could not create rowset from rowsetmeta: "
+                     << " rowset_id: " << rowset_meta->rowset_id()
+                     << " rowset_type: " << rowset_meta->rowset_type()
+                     << " rowset_state: " << rowset_meta->rowset_state();
+        return true;
+    }
+    if (rowset_meta->rowset_state() == RowsetStatePB::COMMITTED &&
+        rowset_meta->tablet_uid() == tablet->tablet_uid()) {
+        if (!rowset_meta->tablet_schema()) {
+            rowset_meta->set_tablet_schema(tablet->tablet_schema());
+            RowsetMetaManager::save(_meta, rowset_meta->tablet_uid(), rowset_meta->rowset_id(),
+                                    rowset_meta->get_rowset_pb());
+        }
+        Status commit_txn_status = _txn_manager->commit_txn(
+                _meta, rowset_meta->partition_id(), rowset_meta->txn_id(),
+                rowset_meta->tablet_id(), rowset_meta->tablet_schema_hash(),
+                rowset_meta->tablet_uid(), rowset_meta->load_id(), rowset, true);
+        if (!commit_txn_status && !commit_txn_status.is<PUSH_TRANSACTION_ALREADY_EXIST>()) {
+            LOG(WARNING) << "failed to add committed rowset: " << rowset_meta->rowset_id()
+                         << " to tablet: " << rowset_meta->tablet_id()
+                         << " for txn: " << rowset_meta->txn_id();
+        } else {
+            LOG(INFO) << "successfully to add committed rowset: " << rowset_meta->rowset_id()
+                      << " to tablet: " << rowset_meta->tablet_id()
+                      << " schema hash: " << rowset_meta->tablet_schema_hash()
+                      << " for txn: " << rowset_meta->txn_id();
+        }
+    } else if (rowset_meta->rowset_state() == RowsetStatePB::VISIBLE &&
+               rowset_meta->tablet_uid() == tablet->tablet_uid()) {
+        if (!rowset_meta->tablet_schema()) {
+            rowset_meta->set_tablet_schema(tablet->tablet_schema());
+            RowsetMetaManager::save(_meta, rowset_meta->tablet_uid(), rowset_meta->rowset_id(),
+                                    rowset_meta->get_rowset_pb());
+        }
+        Status publish_status = tablet->add_rowset(rowset);
+        if (!publish_status && !publish_status.is<PUSH_VERSION_ALREADY_EXIST>()) {
+            LOG(WARNING) << "add visible rowset to tablet failed rowset_id:"
+                         << rowset->rowset_id() << " tablet id: " << rowset_meta->tablet_id()
+                         << " txn id:" << rowset_meta->txn_id()
+                         << " start_version: " << rowset_meta->version().first
+                         << " end_version: " << rowset_meta->version().second;
+        }
+    } else {
+        LOG(WARNING) << "find invalid rowset: " << rowset_meta->rowset_id()
+                     << " with tablet id: " << rowset_meta->tablet_id()
+                     << " tablet uid: " << rowset_meta->tablet_uid()
+                     << " schema hash: " << rowset_meta->tablet_schema_hash()
+                     << " txn: " << rowset_meta->txn_id()
+                     << " current valid tablet uid: " << tablet->tablet_uid();
+        return false;
+    }
+    return true;
+}
+
 void DataDir::add_pending_ids(const std::string& id) {
     std::lock_guard<std::shared_mutex> wr_lock(_pending_path_mutex);
     _pending_path_ids.insert(id);
@@ -43,6 +43,9 @@ class TabletManager;
 class TxnManager;
 class OlapMeta;
 class RowsetIdGenerator;
+class RowsetMeta;
+
+using RowsetMetaSharedPtr = std::shared_ptr<RowsetMeta>;
 
 // A DataDir used to manage data in same path.
 // Now, After DataDir was created, it will never be deleted for easy implementation.
@@ -166,6 +169,14 @@ private:
 
     bool _check_pending_ids(const std::string& id);
 
+    // load one tablet and add its id to tablet_ids or failed_tablet_ids by the result
+    void _load_tablet_from_meta(int64_t tablet_id, int32_t schema_hash, const std::string& value,
+                                std::mutex* tablet_ids_lock, std::set<int64_t>* tablet_ids,
+                                std::set<int64_t>* failed_tablet_ids);
+
+    // add the rowset to its tablet or txn, return false if the rowset is invalid
+    bool _load_rowset_from_meta(const RowsetMetaSharedPtr& rowset_meta);
+
 private:
     std::atomic<bool> _stop_bg_worker = false;
 
@@ -213,6 +224,9 @@ private:
     IntGauge* disks_state;
     IntGauge* disks_compaction_score;
     IntGauge* disks_compaction_num;
+    // progress of loading this data dir when be starts
+    IntGauge* disks_loaded_tablet_num;
+    IntGauge* disks_loaded_rowset_num;
 };
 
 } // namespace doris
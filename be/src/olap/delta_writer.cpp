@@ -38,6 +38,7 @@
 #include "gutil/strings/numbers.h"
 #include "io/fs/file_writer.h" // IWYU pragma: keep
 #include "olap/data_dir.h"
+#include "olap/inverted_index_parser.h"
 #include "olap/memtable.h"
 #include "olap/memtable_flush_executor.h"
 #include "olap/olap_define.h"
@@ -205,6 +206,15 @@ Status DeltaWriter::init() {
     context.write_type = DataWriteType::TYPE_DIRECT;
     context.mow_context =
             std::make_shared<MowContext>(_cur_max_version, _rowset_ids, _delete_bitmap);
+    if (config::enable_async_inverted_index_build) {
+        for (const auto& index : _tablet_schema->indexes()) {
+            if (index.index_type() == IndexType::INVERTED &&
+                is_fulltext_inverted_index(index.properties())) {
+                context.skip_inverted_index.insert(index.col_unique_ids()[0]);
+            }
+        }
+        _has_pending_inverted_index = !context.skip_inverted_index.empty();
+    }
     RETURN_IF_ERROR(_tablet->create_rowset_writer(context, &_rowset_writer));
 
     _schema.reset(new Schema(_tablet_schema));
@@ -470,6 +480,10 @@ Status DeltaWriter::close_wait(const PSlaveTabletNodes& slave_tablet_nodes,
                 _req.partition_id, _req.txn_id, _tablet->tablet_id(), _tablet->schema_hash(),
                 _tablet->tablet_uid(), true, _delete_bitmap, _rowset_ids);
     }
+    if (_has_pending_inverted_index) {
+        // the segments are queried without the pending indexes until they are built
+        _storage_engine->submit_async_index_build_task(_tablet, _cur_rowset);
+    }
 
     _delta_written_success = true;
 
@@ -549,6 +563,10 @@ int64_t DeltaWriter::get_memtable_consumption_snapshot() const {
     return _memtable_consumption_snapshot;
 }
 
+const FlushStatistic* DeltaWriter::flush_stats() const {
+    return _flush_token == nullptr ? nullptr : &_flush_token->get_stats();
+}
+
 int64_t DeltaWriter::mem_consumption(MemType mem) {
     if (_flush_token == nullptr) {
         // This method may be called before this writer is initialized.
@@ -655,6 +673,10 @@ void DeltaWriter::_request_slave_tablet_pull_rowset(PNodeInfo node_info) {
             for (auto index_id : indices_ids) {
                 std::string inverted_index_file = InvertedIndexDescriptor::get_index_file_name(
                         tablet_path + "/" + segment_name.str(), index_id);
+                if (_has_pending_inverted_index && !std::filesystem::exists(inverted_index_file)) {
+                    // not built yet, the slave replica reads the segment without the index
+                    continue;
+                }
                 int64_t size = std::filesystem::file_size(inverted_index_file);
                 PTabletWriteSlaveRequest::IndexSize index_size;
                 index_size.set_indexid(index_id);
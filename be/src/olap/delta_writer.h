@@ -134,6 +134,9 @@ public:
 
     int64_t total_received_rows() const { return _total_received_rows; }
 
+    // nullptr if this writer is not initialized yet
+    const FlushStatistic* flush_stats() const;
+
 private:
     DeltaWriter(WriteRequest* req, StorageEngine* storage_engine, RuntimeProfile* profile,
                 const UniqueId& load_id);
@@ -170,6 +173,8 @@ private:
     // every request will have it's own tablet schema so simple schema change can work
     TabletSchemaSPtr _tablet_schema;
     bool _delta_written_success;
+    // the fulltext inverted indexes are not written on flush but built in background
+    bool _has_pending_inverted_index = false;
 
     StorageEngine* _storage_engine;
     UniqueId _load_id;
@@ -0,0 +1,190 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "olap/file_cache_warm_up_mgr.h"
+
+#include <gen_cpp/segment_v2.pb.h>
+#include <glog/logging.h>
+
+#include <algorithm>
+#include <chrono>
+#include <thread>
+#include <utility>
+
+#include "common/config.h"
+#include "io/fs/file_reader.h"
+#include "io/io_common.h"
+#include "olap/rowset/beta_rowset.h"
+#include "olap/rowset/rowset.h"
+#include "olap/rowset/segment_v2/segment.h"
+#include "olap/storage_engine.h"
+#include "olap/tablet.h"
+#include "olap/tablet_manager.h"
+#include "util/slice.h"
+#include "util/time.h"
+
+namespace doris {
+
+FileCacheWarmUpMgr* FileCacheWarmUpMgr::instance() {
+    static FileCacheWarmUpMgr mgr;
+    return &mgr;
+}
+
+Status FileCacheWarmUpMgr::submit(std::vector<int64_t> tablet_ids, int64_t* job_id) {
+    if (!config::enable_file_cache || config::file_cache_type != "file_block_cache") {
+        return Status::NotSupported("block file cache is not enabled");
+    }
+    std::lock_guard l(_lock);
+    if (_pool == nullptr) {
+        RETURN_IF_ERROR(ThreadPoolBuilder("FileCacheWarmUpThreadPool")
+                                .set_min_threads(1)
+                                .set_max_threads(1)
+                                .build(&_pool));
+    }
+    auto job = std::make_shared<Job>();
+    job->job_id = _next_job_id++;
+    job->tablet_ids = std::move(tablet_ids);
+    RETURN_IF_ERROR(_pool->submit_func([this, job] { _run(job); }));
+    _jobs.emplace(job->job_id, job);
+    while (_jobs.size() > MAX_KEPT_JOBS) {
+        _jobs.erase(_jobs.begin());
+    }
+    *job_id = job->job_id;
+    return Status::OK();
+}
+
+std::shared_ptr<const FileCacheWarmUpMgr::Job> FileCacheWarmUpMgr::get_job(int64_t job_id) const {
+    std::lock_guard l(_lock);
+    auto it = _jobs.find(job_id);
+    return it == _jobs.end() ? nullptr : it->second;
+}
+
+void FileCacheWarmUpMgr::_run(std::shared_ptr<Job> job) {
+    int64_t start_ms = MonotonicMillis();
+    Status st = _warm_up(job.get());
+    if (!st.ok()) {
+        LOG(WARNING) << "failed to warm up file cache, job_id=" << job->job_id << ", " << st;
+    }
+    LOG(INFO) << "finish warming up file cache, job_id=" << job->job_id
+              << ", tablets=" << job->tablet_ids.size() << ", segments=" << job->num_segments.load()
+              << ", index_bytes=" << job->index_bytes.load()
+              << ", data_bytes=" << job->data_bytes.load()
+              << ", downloaded_bytes=" << job->downloaded_bytes.load()
+              << ", cost_ms=" << MonotonicMillis() - start_ms;
+    job->set_status(std::move(st));
+    job->finished = true;
+}
+
+Status FileCacheWarmUpMgr::_warm_up(Job* job) {
+    std::vector<segment_v2::SegmentSharedPtr> segments;
+    for (int64_t tablet_id : job->tablet_ids) {
+        TabletSharedPtr tablet = StorageEngine::instance()->tablet_manager()->get_tablet(tablet_id);
+        if (tablet == nullptr) {
+            LOG(WARNING) << "skip warming up file cache of not found tablet " << tablet_id;
+            continue;
+        }
+        std::vector<RowsetSharedPtr> rowsets;
+        tablet->traverse_rowsets([&rowsets](const RowsetSharedPtr& rowset) {
+            if (!rowset->is_local()) {
+                rowsets.push_back(rowset);
+            }
+        });
+        for (auto& rowset : rowsets) {
+            RETURN_IF_ERROR(std::static_pointer_cast<BetaRowset>(rowset)->load_segments(&segments));
+        }
+    }
+    job->num_segments = segments.size();
+
+    // The index pages are written after all data pages, and the first of them is the root
+    // of an ordinal index, see SegmentWriter::finalize. The segment without ordinal index
+    // page only has the footer in its index region.
+    std::vector<size_t> index_starts;
+    for (auto& segment : segments) {
+        size_t file_size = segment->file_reader()->size();
+        const auto& footer = segment->footer();
+        // footer pb, checksum, length and magic number
+        size_t index_start = file_size - std::min(file_size, footer.ByteSizeLong() + 12);
+        for (const auto& column : footer.columns()) {
+            for (const auto& index : column.indexes()) {
+                if (index.type() == segment_v2::ORDINAL_INDEX &&
+                    !index.ordinal_index().root_page().is_root_data_page()) {
+                    index_start = std::min<size_t>(
+                            index_start, index.ordinal_index().root_page().root_page().offset());
+                }
+            }
+        }
+        index_starts.push_back(index_start);
+        job->total_bytes += file_size;
+    }
+
+    if (_buffer == nullptr) {
+        _buffer.reset(new char[config::file_cache_max_file_segment_size]);
+    }
+    _throttle_start_ns = MonotonicNanos();
+    _throttle_bytes = 0;
+    io::FileCacheStatistics stats;
+    io::IOContext io_ctx;
+    io_ctx.file_cache_stats = &stats;
+    io_ctx.read_segment_index = true;
+    for (size_t i = 0; i < segments.size(); ++i) {
+        RETURN_IF_ERROR(_read_range(segments[i].get(), index_starts[i],
+                                    segments[i]->file_reader()->size(), &io_ctx,
+                                    &job->index_bytes));
+        job->downloaded_bytes = stats.bytes_read_from_remote;
+    }
+    io_ctx.read_segment_index = false;
+    for (size_t i = 0; i < segments.size(); ++i) {
+        RETURN_IF_ERROR(
+                _read_range(segments[i].get(), 0, index_starts[i], &io_ctx, &job->data_bytes));
+        job->downloaded_bytes = stats.bytes_read_from_remote;
+    }
+    return Status::OK();
+}
+
+Status FileCacheWarmUpMgr::_read_range(segment_v2::Segment* segment, size_t start, size_t end,
+                                       io::IOContext* io_ctx, std::atomic<int64_t>* read_bytes) {
+    const size_t chunk_size = config::file_cache_max_file_segment_size;
+    auto file_reader = segment->file_reader();
+    for (size_t offset = start; offset < end;) {
+        size_t bytes_read = 0;
+        Slice chunk(_buffer.get(), std::min(chunk_size, end - offset));
+        RETURN_IF_ERROR(file_reader->read_at(offset, chunk, &bytes_read, io_ctx));
+        if (bytes_read == 0) {
+            return Status::IOError("unexpected eof of {} at {}", file_reader->path().native(),
+                                   offset);
+        }
+        offset += bytes_read;
+        *read_bytes += bytes_read;
+        _throttle(bytes_read);
+    }
+    return Status::OK();
+}
+
+void FileCacheWarmUpMgr::_throttle(size_t bytes) {
+    int64_t bytes_per_second = config::file_cache_warm_up_bytes_per_second;
+    if (bytes_per_second <= 0) {
+        return;
+    }
+    _throttle_bytes += bytes;
+    int64_t expected_ns = _throttle_bytes * 1000000000.0 / bytes_per_second;
+    int64_t elapsed_ns = MonotonicNanos() - _throttle_start_ns;
+    if (expected_ns > elapsed_ns) {
+        std::this_thread::sleep_for(std::chrono::nanoseconds(expected_ns - elapsed_ns));
+    }
+}
+
+} // namespace doris
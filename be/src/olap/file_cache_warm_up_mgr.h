@@ -0,0 +1,109 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <atomic>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "common/status.h"
+#include "util/threadpool.h"
+
+namespace doris {
+namespace io {
+class IOContext;
+} // namespace io
+namespace segment_v2 {
+class Segment;
+} // namespace segment_v2
+
+// Warms up the block file cache of the remote rowsets of tablets, e.g. after a BE restart or
+// a tablet is cloned to this BE, so the first queries do not read every block from the
+// remote storage. The index region (index pages and footer) of all segments of a job is
+// cached into the index queue first, then the data pages, within a bandwidth limit.
+// The jobs run one by one in the background.
+class FileCacheWarmUpMgr {
+public:
+    struct Job {
+        int64_t job_id = 0;
+        std::vector<int64_t> tablet_ids;
+        std::atomic<size_t> num_segments = 0;
+        // total size of the segment files to warm up
+        std::atomic<int64_t> total_bytes = 0;
+        // bytes read by the warm up, include the ones already in cache
+        std::atomic<int64_t> index_bytes = 0;
+        std::atomic<int64_t> data_bytes = 0;
+        // bytes downloaded from the remote storage into cache
+        std::atomic<int64_t> downloaded_bytes = 0;
+        std::atomic<bool> finished = false;
+
+        Status status() const {
+            std::lock_guard l(_lock);
+            return _status;
+        }
+
+        void set_status(Status st) {
+            std::lock_guard l(_lock);
+            _status = std::move(st);
+        }
+
+    private:
+        mutable std::mutex _lock;
+        Status _status;
+    };
+
+    static FileCacheWarmUpMgr* instance();
+
+    // submit a job to warm up the tablets in background
+    Status submit(std::vector<int64_t> tablet_ids, int64_t* job_id);
+
+    // nullptr if the job is not found, only the recent jobs are kept
+    std::shared_ptr<const Job> get_job(int64_t job_id) const;
+
+private:
+    static constexpr size_t MAX_KEPT_JOBS = 128;
+
+    void _run(std::shared_ptr<Job> job);
+
+    Status _warm_up(Job* job);
+
+    // read [start, end) of the segment file through the file cache
+    Status _read_range(segment_v2::Segment* segment, size_t start, size_t end,
+                       io::IOContext* io_ctx, std::atomic<int64_t>* read_bytes);
+
+    // sleep to keep the read bandwidth under the limit
+    void _throttle(size_t bytes);
+
+    mutable std::mutex _lock;
+    std::unique_ptr<ThreadPool> _pool;
+    int64_t _next_job_id = 1;
+    std::map<int64_t, std::shared_ptr<Job>> _jobs;
+
+    // accessed by the only warm up thread
+    std::unique_ptr<char[]> _buffer;
+    int64_t _throttle_start_ns = 0;
+    int64_t _throttle_bytes = 0;
+};
+
+} // namespace doris
@@ -77,6 +77,17 @@ void HyperLogLog::update(uint64_t hash_value) {
     }
 }
 
+void HyperLogLog::update_batch(const uint64_t* hash_values, size_t count) {
+    size_t i = 0;
+    // stay in the explicit format while it can hold the values
+    for (; i < count && _type != HLL_DATA_SPARSE && _type != HLL_DATA_FULL; ++i) {
+        update(hash_values[i]);
+    }
+    for (; i < count; ++i) {
+        _update_registers(hash_values[i]);
+    }
+}
+
 void HyperLogLog::merge(const HyperLogLog& other) {
     // fast path
     if (other._type == HLL_DATA_EMPTY) {
@@ -185,9 +196,8 @@ size_t HyperLogLog::serialize(uint8_t* dst) const {
         }
 
         // each register in sparse format will occupy 3bytes, 2 for index and
-        // 1 for register value. So if num_non_zero_registers is greater than
-        // 4K we use full encode format.
-        if (num_non_zero_registers > HLL_SPARSE_THRESHOLD) {
+        // 1 for register value. Use the full format when it is not larger.
+        if (4 + 3 * num_non_zero_registers >= HLL_REGISTERS_COUNT) {
             *ptr++ = HLL_DATA_FULL;
             memcpy(ptr, _registers, HLL_REGISTERS_COUNT);
             ptr += HLL_REGISTERS_COUNT;
@@ -24,10 +24,7 @@
 #include <string>
 #include <utility>
 
-#ifdef __x86_64__
-#include <immintrin.h>
-#endif
-
+#include "util/sse_util.hpp"
 #include "vec/common/hash_table/phmap_fwd_decl.h"
 
 namespace doris {
@@ -37,7 +34,6 @@ struct Slice;
 inline const int HLL_COLUMN_PRECISION = 14;
 inline const int HLL_ZERO_COUNT_BITS = (64 - HLL_COLUMN_PRECISION);
 inline const int HLL_EXPLICIT_INT64_NUM = 160;
-inline const int HLL_SPARSE_THRESHOLD = 4096;
 inline const int HLL_REGISTERS_COUNT = 16 * 1024;
 // maximum size in byte of serialized HLL: type(1) + registers (2^14)
 inline const int HLL_COLUMN_DEFAULT_LEN = HLL_REGISTERS_COUNT + 1;
@@ -63,9 +59,9 @@ inline const int HLL_EMPTY_SIZE = 1;
 // maybe can be other number. If you are interested, you can try other number and see
 // if it will be better.
 //
-// HLL_DATA_SPARSE: only store non-zero registers. If the number of non-zero registers
-// is not greater than 4096, set is encoded in this format. The max space occupied is
-// (1 + 4 + 3 * 4096) = 12293.
+// HLL_DATA_SPARSE: only store non-zero registers, 3 bytes for each. Set is encoded in this
+// format when it is smaller than the full format, that is the number of non-zero registers
+// is less than 5460. The max space occupied is (1 + 4 + 3 * 5459) = 16382.
 //
 // HLL_DATA_FULL: most space-consuming, store all registers
 //
@@ -206,6 +202,9 @@ public:
     // NOTE: input must be a hash_value
     void update(uint64_t hash_value);
 
+    // Add hash values to this HLL value, the same as updating them one by one
+    void update_batch(const uint64_t* hash_values, size_t count);
+
     void merge(const HyperLogLog& other);
 
     // Return max size of serialized binary
@@ -301,6 +300,17 @@ private:
             src += 32;
             dst += 32;
         }
+#elif defined(__SSE2__) || defined(__aarch64__)
+        int loop = HLL_REGISTERS_COUNT / 16; // 16 = 128/8
+        uint8_t* dst = _registers;
+        const uint8_t* src = other_registers;
+        for (int i = 0; i < loop; i++) {
+            __m128i xa = _mm_loadu_si128((const __m128i*)dst);
+            __m128i xb = _mm_loadu_si128((const __m128i*)src);
+            _mm_storeu_si128((__m128i*)dst, _mm_max_epu8(xa, xb));
+            src += 16;
+            dst += 16;
+        }
 #else
         for (int i = 0; i < HLL_REGISTERS_COUNT; ++i) {
             _registers[i] =
@@ -370,27 +370,32 @@ public:
 
     bool evaluate_and(const segment_v2::BloomFilter* bf) const override {
         if constexpr (PT == PredicateType::IN_LIST) {
-            HybridSetBase::IteratorBase* iter = _values->begin();
-            while (iter->has_next()) {
-                if constexpr (std::is_same_v<T, StringRef>) {
-                    const StringRef* value = (const StringRef*)iter->get_value();
-                    if (bf->test_bytes(value->data, value->size)) {
-                        return true;
-                    }
-                } else if constexpr (Type == TYPE_DATE) {
-                    const void* value = iter->get_value();
-                    if (bf->test_bytes(reinterpret_cast<const char*>(value), sizeof(uint24_t))) {
-                        return true;
-                    }
-                } else {
-                    const T* value = (const T*)(iter->get_value());
-                    if (bf->test_bytes(reinterpret_cast<const char*>(value), sizeof(*value))) {
-                        return true;
+            if (bf->is_ngram_bf()) {
+                return true;
+            }
+            // The hash of a value does not depend on the bloom filter, so the values are
+            // hashed once and probed against the bloom filters of all pages in batch.
+            if (!_bf_hashes_ready) {
+                _bf_hashes.clear();
+                HybridSetBase::IteratorBase* iter = _values->begin();
+                while (iter->has_next()) {
+                    if constexpr (std::is_same_v<T, StringRef>) {
+                        const StringRef* value = (const StringRef*)iter->get_value();
+                        _bf_hashes.push_back(bf->hash(value->data, value->size));
+                    } else if constexpr (Type == TYPE_DATE) {
+                        const void* value = iter->get_value();
+                        _bf_hashes.push_back(
+                                bf->hash(reinterpret_cast<const char*>(value), sizeof(uint24_t)));
+                    } else {
+                        const T* value = (const T*)(iter->get_value());
+                        _bf_hashes.push_back(
+                                bf->hash(reinterpret_cast<const char*>(value), sizeof(*value)));
                     }
+                    iter->next();
                 }
-                iter->next();
+                _bf_hashes_ready = true;
             }
-            return false;
+            return bf->test_any_hash(_bf_hashes.data(), _bf_hashes.size());
         } else {
             LOG(FATAL) << "Bloom filter is not supported by predicate type.";
             return true;
@@ -574,6 +579,9 @@ private:
     std::shared_ptr<HybridSetBase> _values;
     mutable std::map<std::pair<RowsetId, uint32_t>, std::vector<vectorized::UInt8>>
             _segment_id_to_value_in_dict_flags;
+    // the hashes of the values to probe bloom filters
+    mutable std::vector<uint64_t> _bf_hashes;
+    mutable bool _bf_hashes_ready = false;
     T _min_value;
     T _max_value;
 
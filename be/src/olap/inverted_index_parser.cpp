@@ -79,4 +79,11 @@ std::string get_parser_phrase_support_string_from_properties(
         return INVERTED_INDEX_PARSER_PHRASE_SUPPORT_NO;
     }
 }
+bool is_fulltext_inverted_index(const std::map<std::string, std::string>& properties) {
+    auto parser_str = get_parser_string_from_properties(properties);
+    auto parser_type = get_inverted_index_parser_type_from_string(parser_str);
+    return parser_type != InvertedIndexParserType::PARSER_NONE &&
+           parser_type != InvertedIndexParserType::PARSER_UNKNOWN;
+}
+
 } // namespace doris
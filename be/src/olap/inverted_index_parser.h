@@ -63,4 +63,7 @@ std::string get_parser_mode_string_from_properties(
 std::string get_parser_phrase_support_string_from_properties(
         const std::map<std::string, std::string>& properties);
 
+// whether the values are tokenized by a parser, i.e. the index is a fulltext index
+bool is_fulltext_inverted_index(const std::map<std::string, std::string>& properties);
+
 } // namespace doris
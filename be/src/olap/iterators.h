@@ -18,11 +18,15 @@
 #pragma once
 
 #include <memory>
+#include <unordered_map>
+#include <utility>
 
 #include "common/status.h"
 #include "io/io_common.h"
 #include "olap/block_column_predicate.h"
 #include "olap/column_predicate.h"
+#include "olap/key_range_lookup_cache.h"
+#include "olap/late_runtime_filter_predicates.h"
 #include "olap/olap_common.h"
 #include "olap/tablet_schema.h"
 #include "runtime/runtime_state.h"
@@ -76,6 +80,10 @@ public:
     // segment_id -> roaring::Roaring*
     std::unordered_map<uint32_t, std::shared_ptr<roaring::Roaring>> delete_bitmap;
 
+    // segment_id -> the rows [first, second) to read of the segment, all rows are read if the
+    // segment is not in it. Used to split a large segment across the scanners.
+    std::unordered_map<uint32_t, std::pair<uint32_t, uint32_t>> segment_row_ranges;
+
     std::shared_ptr<AndBlockColumnPredicate> delete_condition_predicates =
             std::make_shared<AndBlockColumnPredicate>();
     // reader's column predicate, nullptr if not existed
@@ -95,10 +103,16 @@ public:
     bool record_rowids = false;
     // flag for enable topn opt
     bool use_topn_opt = false;
+    // used to prune the row ranges by index, see LateRuntimeFilterPredicates
+    std::shared_ptr<LateRuntimeFilterPredicates> late_runtime_filter_predicates;
+    // shared by the scanners of a scan node, see KeyRangeLookupCache
+    std::shared_ptr<KeyRangeLookupCache> key_range_lookup_cache;
     // used for special optimization for query : ORDER BY key DESC LIMIT n
     bool read_orderby_key_reverse = false;
     // columns for orderby keys
     std::vector<uint32_t>* read_orderby_key_columns = nullptr;
+    // see TabletReader::ReaderParams::read_limit
+    size_t read_limit = 0;
     io::IOContext io_ctx;
     vectorized::VExpr* remaining_vconjunct_root = nullptr;
     std::vector<vectorized::VExprSPtr> remaining_conjunct_roots;
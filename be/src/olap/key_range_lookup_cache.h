@@ -0,0 +1,63 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <parallel_hashmap/phmap.h>
+#include <stddef.h>
+
+#include <mutex>
+#include <string>
+
+#include "olap/rowset/segment_v2/common.h"
+
+namespace doris {
+
+// Ordinals of the key range bounds looked up in the short key index of the segments, shared by
+// the scanners of a scan node. The key ranges of a tablet are split across scanners, so the
+// upper bound of a scanner is usually the lower bound of the next one, and a bound of a small
+// key range, e.g. of an IN-list on the prefix key, is looked up once per segment instead of
+// binary searching the key columns again in every SegmentIterator.
+class KeyRangeLookupCache {
+public:
+    // `key` identifies the segment and the encoded bound, see SegmentIterator::_lookup_ordinal.
+    bool lookup(const std::string& key, segment_v2::rowid_t* rowid) const {
+        std::lock_guard l(_lock);
+        auto it = _ordinals.find(key);
+        if (it == _ordinals.end()) {
+            return false;
+        }
+        *rowid = it->second;
+        return true;
+    }
+
+    void insert(const std::string& key, segment_v2::rowid_t rowid) {
+        std::lock_guard l(_lock);
+        if (_ordinals.size() < MAX_ENTRIES) {
+            _ordinals.emplace(key, rowid);
+        }
+    }
+
+private:
+    // limits the memory of a scan with a huge IN-list on many segments
+    static constexpr size_t MAX_ENTRIES = 1 << 16;
+
+    mutable std::mutex _lock;
+    phmap::flat_hash_map<std::string, segment_v2::rowid_t> _ordinals;
+};
+
+} // namespace doris
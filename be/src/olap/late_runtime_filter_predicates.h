@@ -0,0 +1,53 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+#pragma once
+
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "olap/column_predicate.h"
+#include "vec/common/arena.h"
+
+namespace doris {
+
+// Column predicates converted from the runtime filters which arrive after the segment
+// iterators of a scanner are created. They are shared by these iterators and only used to
+// prune the row ranges of the segments not read yet by zone map and bloom filter index,
+// the rows are still filtered by the runtime filter conjuncts of the scanner.
+class LateRuntimeFilterPredicates {
+public:
+    void add(ColumnPredicate* predicate) {
+        std::lock_guard l(_lock);
+        _predicates.emplace_back(predicate);
+    }
+
+    std::vector<std::shared_ptr<ColumnPredicate>> get() const {
+        std::lock_guard l(_lock);
+        return _predicates;
+    }
+
+    // the arena to allocate the values of predicates, only used by the scanner thread
+    vectorized::Arena* arena() { return &_arena; }
+
+private:
+    mutable std::mutex _lock;
+    std::vector<std::shared_ptr<ColumnPredicate>> _predicates;
+    vectorized::Arena _arena;
+};
+
+} // namespace doris
@@ -17,6 +17,7 @@
 
 #include "olap/like_column_predicate.h"
 
+#include "olap/itoken_extractor.h"
 #include "runtime/define_primitive_type.h"
 #include "udf/udf.h"
 #include "vec/columns/columns_number.h"
@@ -33,6 +34,29 @@ LikeColumnPredicate::LikeColumnPredicate(bool opposite, uint32_t column_id,
     _state->search_state.clone(_like_state);
 }
 
+bool LikeColumnPredicate::evaluate_segment_ngram_bf(const segment_v2::BloomFilter* bf,
+                                                    size_t gram_size) const {
+    // the values which do not contain the grams still match NOT LIKE
+    if (_opposite) {
+        return true;
+    }
+    if (_segment_ng_bf == nullptr || _segment_ng_bf->size() != bf->size() ||
+        _segment_ng_bf_gram_size != gram_size) {
+        std::unique_ptr<segment_v2::BloomFilter> ng_bf;
+        if (!segment_v2::BloomFilter::create(segment_v2::NGRAM_BLOOM_FILTER, &ng_bf, bf->size())
+                     .ok()) {
+            return true;
+        }
+        NgramTokenExtractor extractor(gram_size);
+        _segment_ng_bf_has_gram =
+                extractor.string_like_to_bloom_filter(pattern.data, pattern.size, *ng_bf);
+        _segment_ng_bf = std::move(ng_bf);
+        _segment_ng_bf_gram_size = gram_size;
+    }
+    // the pattern shorter than a gram, e.g. '%ab%', can not be checked
+    return !_segment_ng_bf_has_gram || bf->contains(*_segment_ng_bf);
+}
+
 void LikeColumnPredicate::evaluate_vec(const vectorized::IColumn& column, uint16_t size,
                                        bool* flags) const {
     _evaluate_vec<false>(column, size, flags);
@@ -83,6 +83,10 @@ public:
     }
     bool can_do_bloom_filter() const override { return true; }
 
+    // Return false if no value of a segment matches the pattern, checked by the ngram bloom
+    // filter of all values of the segment, see ColumnMetaPB.segment_ngram_bf.
+    bool evaluate_segment_ngram_bf(const segment_v2::BloomFilter* bf, size_t gram_size) const;
+
 private:
     template <bool is_and>
     void _evaluate_vec(const vectorized::IColumn& column, uint16_t size, bool* flags) const {
@@ -167,6 +171,11 @@ private:
     // LikeColumnPredicate.
     vectorized::LikeSearchState _like_state;
     std::unique_ptr<segment_v2::BloomFilter> _page_ng_bf; // for ngram-bf index
+    // the pattern filter for segment ngram bloom filters, built at the first check since
+    // all segments use the same filter size and gram size in most cases
+    mutable std::unique_ptr<segment_v2::BloomFilter> _segment_ng_bf;
+    mutable size_t _segment_ng_bf_gram_size = 0;
+    mutable bool _segment_ng_bf_has_gram = false;
 };
 
 } // namespace doris
@@ -6,6 +6,7 @@
 
 #include <stdlib.h>
 
+#include <algorithm>
 #include <mutex>
 #include <new>
 #include <sstream>
@@ -26,6 +27,27 @@ DEFINE_GAUGE_METRIC_PROTOTYPE_2ARG(cache_usage_ratio, MetricUnit::NOUNIT);
 DEFINE_COUNTER_METRIC_PROTOTYPE_2ARG(cache_lookup_count, MetricUnit::OPERATIONS);
 DEFINE_COUNTER_METRIC_PROTOTYPE_2ARG(cache_hit_count, MetricUnit::OPERATIONS);
 DEFINE_GAUGE_METRIC_PROTOTYPE_2ARG(cache_hit_ratio, MetricUnit::NOUNIT);
+DEFINE_COUNTER_METRIC_PROTOTYPE_2ARG(cache_admission_reject_count, MetricUnit::OPERATIONS);
+
+CacheAdmissionPolicy parse_cache_admission_policy(const std::string& policy) {
+    if (policy == "tinylfu") {
+        return CacheAdmissionPolicy::TINY_LFU;
+    }
+    if (policy != "lru") {
+        LOG(WARNING) << "unknown cache admission policy: " << policy << ", use lru instead";
+    }
+    return CacheAdmissionPolicy::LRU;
+}
+
+std::string to_string(CacheAdmissionPolicy policy) {
+    switch (policy) {
+    case CacheAdmissionPolicy::TINY_LFU:
+        return "tinylfu";
+    case CacheAdmissionPolicy::LRU:
+    default:
+        return "lru";
+    }
+}
 
 uint32_t CacheKey::hash(const char* data, size_t n, uint32_t seed) const {
     // Similar to murmur hash
@@ -164,6 +186,62 @@ uint32_t HandleTable::element_count() const {
     return _elems;
 }
 
+void FrequencySketch::set_capacity(size_t num_elements) {
+    size_t num_words = 64;
+    while (num_words < num_elements && num_words < (1UL << 22)) {
+        num_words <<= 1;
+    }
+    _table.assign(num_words, 0);
+    _table_mask = num_words - 1;
+    _additions = 0;
+    _sample_size = num_words * 10;
+}
+
+std::pair<size_t, uint32_t> FrequencySketch::_locate(uint32_t hash, int depth) const {
+    static constexpr uint64_t SEEDS[DEPTH] = {0xc3a5c85c97cb3127ULL, 0xb492b66fbe98f273ULL,
+                                              0x9ae16a3b2f90404fULL, 0xcbf29ce484222325ULL};
+    uint64_t h = (static_cast<uint64_t>(hash) + SEEDS[depth]) * SEEDS[depth];
+    h += h >> 32;
+    return {h & _table_mask, static_cast<uint32_t>((h >> 40) & 15) << 2};
+}
+
+void FrequencySketch::increment(uint32_t hash) {
+    if (_table.empty()) {
+        return;
+    }
+    bool added = false;
+    for (int i = 0; i < DEPTH; ++i) {
+        auto [index, offset] = _locate(hash, i);
+        if (((_table[index] >> offset) & MAX_COUNT) != MAX_COUNT) {
+            _table[index] += 1ULL << offset;
+            added = true;
+        }
+    }
+    if (added && ++_additions >= _sample_size) {
+        _reset();
+    }
+}
+
+uint32_t FrequencySketch::frequency(uint32_t hash) const {
+    if (_table.empty()) {
+        return 0;
+    }
+    uint64_t freq = MAX_COUNT;
+    for (int i = 0; i < DEPTH; ++i) {
+        auto [index, offset] = _locate(hash, i);
+        freq = std::min(freq, (_table[index] >> offset) & MAX_COUNT);
+    }
+    return static_cast<uint32_t>(freq);
+}
+
+void FrequencySketch::_reset() {
+    for (auto& word : _table) {
+        // halve all the 16 counters in the word
+        word = (word >> 1) & 0x7777777777777777ULL;
+    }
+    _additions /= 2;
+}
+
 LRUCache::LRUCache(LRUCacheType type) : _type(type) {
     // Make empty circular linked list
     _lru_normal.next = &_lru_normal;
@@ -233,6 +311,9 @@ void LRUCache::_lru_append(LRUHandle* list, LRUHandle* e) {
 Cache::Handle* LRUCache::lookup(const CacheKey& key, uint32_t hash) {
     std::lock_guard l(_mutex);
     ++_lookup_count;
+    if (_admission_policy == CacheAdmissionPolicy::TINY_LFU) {
+        _frequency_sketch.increment(hash);
+    }
     LRUHandle* e = _table.lookup(key, hash);
     if (e != nullptr) {
         // we get it from _table, so in_cache must be true
@@ -347,6 +428,42 @@ bool LRUCache::_check_element_count_limit() {
     return _element_count_capacity != 0 && _table.element_count() >= _element_count_capacity;
 }
 
+void LRUCache::set_admission_policy(CacheAdmissionPolicy policy) {
+    _admission_policy = policy;
+    if (policy == CacheAdmissionPolicy::TINY_LFU) {
+        // The capacity of SIZE cache is in bytes, assume the entries are pages of about 4KB.
+        size_t num_elements = _type == LRUCacheType::NUMBER ? _capacity : _capacity / 4096;
+        if (_element_count_capacity != 0) {
+            num_elements = std::min<size_t>(num_elements, _element_count_capacity);
+        }
+        _frequency_sketch.set_capacity(num_elements);
+    }
+}
+
+// Only called with NORMAL entries, durable entries are always admitted.
+bool LRUCache::_admit(uint32_t hash, size_t total_size) {
+    if (_admission_policy != CacheAdmissionPolicy::TINY_LFU) {
+        return true;
+    }
+    _frequency_sketch.increment(hash);
+    if (_usage + total_size <= _capacity && !_check_element_count_limit()) {
+        return true;
+    }
+    LRUHandle* victim = nullptr;
+    if (_cache_value_check_timestamp) {
+        if (!_sorted_normal_entries_with_timestamp.empty()) {
+            victim = _sorted_normal_entries_with_timestamp.begin()->second;
+        }
+    } else if (_lru_normal.next != &_lru_normal) {
+        victim = _lru_normal.next;
+    }
+    // no normal entry could be evicted, fall back to lru
+    if (victim == nullptr) {
+        return true;
+    }
+    return _frequency_sketch.frequency(hash) > _frequency_sketch.frequency(victim->hash);
+}
+
 Cache::Handle* LRUCache::insert(const CacheKey& key, uint32_t hash, void* value, size_t charge,
                                 void (*deleter)(const CacheKey& key, void* value),
                                 MemTrackerLimiter* tracker, CachePriority priority, size_t bytes) {
@@ -375,6 +492,16 @@ Cache::Handle* LRUCache::insert(const CacheKey& key, uint32_t hash, void* value,
     {
         std::lock_guard l(_mutex);
 
+        if (priority == CachePriority::NORMAL && !_admit(hash, e->total_size)) {
+            // The entry is less frequent than the one it would evict, hand it back to the
+            // caller without caching it, it is freed when the caller releases the handle.
+            e->in_cache = false;
+            e->refs = 1;
+            _usage += e->total_size;
+            ++_admission_reject_count;
+            return reinterpret_cast<Cache::Handle*>(e);
+        }
+
         // Free the space following strict LRU policy until enough space
         // is freed or the lru list is empty
         if (_cache_value_check_timestamp) {
@@ -463,6 +590,42 @@ int64_t LRUCache::prune() {
     return pruned_count;
 }
 
+int64_t LRUCache::evict(int64_t bytes) {
+    LRUHandle* to_remove_head = nullptr;
+    int64_t evicted_bytes = 0;
+    {
+        std::lock_guard l(_mutex);
+        auto evict_from = [&](LRUHandle* list, LRUHandleSortedSet* sorted_entries) {
+            while (evicted_bytes < bytes) {
+                LRUHandle* old = nullptr;
+                if (_cache_value_check_timestamp) {
+                    if (sorted_entries->empty()) {
+                        break;
+                    }
+                    old = sorted_entries->begin()->second;
+                } else {
+                    if (list->next == list) {
+                        break;
+                    }
+                    old = list->next;
+                }
+                evicted_bytes += old->bytes;
+                _evict_one_entry(old);
+                old->next = to_remove_head;
+                to_remove_head = old;
+            }
+        };
+        evict_from(&_lru_normal, &_sorted_normal_entries_with_timestamp);
+        evict_from(&_lru_durable, &_sorted_durable_entries_with_timestamp);
+    }
+    while (to_remove_head != nullptr) {
+        LRUHandle* next = to_remove_head->next;
+        to_remove_head->free();
+        to_remove_head = next;
+    }
+    return evicted_bytes;
+}
+
 int64_t LRUCache::prune_if(CacheValuePredicate pred, bool lazy_mode) {
     LRUHandle* to_remove_head = nullptr;
     {
@@ -516,7 +679,8 @@ inline uint32_t ShardedLRUCache::_hash_slice(const CacheKey& s) {
 }
 
 ShardedLRUCache::ShardedLRUCache(const std::string& name, size_t total_capacity, LRUCacheType type,
-                                 uint32_t num_shards, uint32_t total_element_count_capacity)
+                                 uint32_t num_shards, uint32_t total_element_count_capacity,
+                                 CacheAdmissionPolicy policy)
         : _name(name),
           _num_shard_bits(Bits::FindLSBSetNonZero(num_shards)),
           _num_shards(num_shards),
@@ -536,11 +700,12 @@ ShardedLRUCache::ShardedLRUCache(const std::string& name, size_t total_capacity,
         shards[s] = new LRUCache(type);
         shards[s]->set_capacity(per_shard);
         shards[s]->set_element_count_capacity(per_shard_element_count_capacity);
+        shards[s]->set_admission_policy(policy);
     }
     _shards = shards;
 
     _entity = DorisMetrics::instance()->metric_registry()->register_entity(
-            std::string("lru_cache:") + name, {{"name", name}});
+            std::string("lru_cache:") + name, {{"name", name}, {"policy", to_string(policy)}});
     _entity->register_hook(name, std::bind(&ShardedLRUCache::update_cache_metrics, this));
     INT_GAUGE_METRIC_REGISTER(_entity, cache_capacity);
     INT_GAUGE_METRIC_REGISTER(_entity, cache_usage);
@@ -548,14 +713,17 @@ ShardedLRUCache::ShardedLRUCache(const std::string& name, size_t total_capacity,
     INT_ATOMIC_COUNTER_METRIC_REGISTER(_entity, cache_lookup_count);
     INT_ATOMIC_COUNTER_METRIC_REGISTER(_entity, cache_hit_count);
     INT_DOUBLE_METRIC_REGISTER(_entity, cache_hit_ratio);
+    INT_ATOMIC_COUNTER_METRIC_REGISTER(_entity, cache_admission_reject_count);
 }
 
 ShardedLRUCache::ShardedLRUCache(const std::string& name, size_t total_capacity, LRUCacheType type,
                                  uint32_t num_shards,
                                  CacheValueTimeExtractor cache_value_time_extractor,
                                  bool cache_value_check_timestamp,
-                                 uint32_t total_element_count_capacity)
-        : ShardedLRUCache(name, total_capacity, type, num_shards, total_element_count_capacity) {
+                                 uint32_t total_element_count_capacity,
+                                 CacheAdmissionPolicy policy)
+        : ShardedLRUCache(name, total_capacity, type, num_shards, total_element_count_capacity,
+                          policy) {
     for (int s = 0; s < _num_shards; s++) {
         _shards[s]->set_cache_value_time_extractor(cache_value_time_extractor);
         _shards[s]->set_cache_value_check_timestamp(cache_value_check_timestamp);
@@ -617,6 +785,26 @@ int64_t ShardedLRUCache::prune() {
     return num_prune;
 }
 
+int64_t ShardedLRUCache::evict(int64_t bytes) {
+    // start from a different shard each time, the remaining bytes are evicted from the
+    // following shards if a shard does not have enough entries to evict
+    int64_t evicted_bytes = 0;
+    uint32_t start = _last_evicted_shard++;
+    for (uint32_t i = 0; i < _num_shards && evicted_bytes < bytes; i++) {
+        int64_t shard_bytes = (bytes - evicted_bytes) / (_num_shards - i) + 1;
+        evicted_bytes += _shards[(start + i) % _num_shards]->evict(shard_bytes);
+    }
+    return evicted_bytes;
+}
+
+uint64_t ShardedLRUCache::get_hit_count() {
+    uint64_t hit_count = 0;
+    for (int s = 0; s < _num_shards; s++) {
+        hit_count += _shards[s]->get_hit_count();
+    }
+    return hit_count;
+}
+
 int64_t ShardedLRUCache::prune_if(CacheValuePredicate pred, bool lazy_mode) {
     int64_t num_prune = 0;
     for (int s = 0; s < _num_shards; s++) {
@@ -642,25 +830,28 @@ void ShardedLRUCache::update_cache_metrics() const {
     size_t total_usage = 0;
     size_t total_lookup_count = 0;
     size_t total_hit_count = 0;
+    size_t total_admission_reject_count = 0;
     for (int i = 0; i < _num_shards; i++) {
         total_capacity += _shards[i]->get_capacity();
         total_usage += _shards[i]->get_usage();
         total_lookup_count += _shards[i]->get_lookup_count();
         total_hit_count += _shards[i]->get_hit_count();
+        total_admission_reject_count += _shards[i]->get_admission_reject_count();
     }
 
     cache_capacity->set_value(total_capacity);
     cache_usage->set_value(total_usage);
     cache_lookup_count->set_value(total_lookup_count);
     cache_hit_count->set_value(total_hit_count);
+    cache_admission_reject_count->set_value(total_admission_reject_count);
     cache_usage_ratio->set_value(total_capacity == 0 ? 0 : ((double)total_usage / total_capacity));
     cache_hit_ratio->set_value(
             total_lookup_count == 0 ? 0 : ((double)total_hit_count / total_lookup_count));
 }
 
 Cache* new_lru_cache(const std::string& name, size_t capacity, LRUCacheType type,
-                     uint32_t num_shards) {
-    return new ShardedLRUCache(name, capacity, type, num_shards);
+                     uint32_t num_shards, CacheAdmissionPolicy policy) {
+    return new ShardedLRUCache(name, capacity, type, num_shards, 0, policy);
 }
 
 } // namespace doris
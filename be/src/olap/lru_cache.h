@@ -18,6 +18,7 @@
 #include <set>
 #include <string>
 #include <utility>
+#include <vector>
 
 #include "runtime/memory/mem_tracker_limiter.h"
 #include "runtime/thread_context.h"
@@ -59,10 +60,22 @@ enum LRUCacheType {
     NUMBER // The capacity of cache is based on the number of cache entry.
 };
 
+// Decide whether a new entry is admitted when the cache is full.
+enum class CacheAdmissionPolicy {
+    LRU,     // Always admit the new entry and evict the least recently used ones.
+    TINY_LFU // Admit the new entry only if it is accessed more frequently than the victim,
+             // so that one-off scans can not flush the hot entries out of the cache.
+};
+
+// Parse the admission policy from config, "lru" or "tinylfu", falls back to LRU if unknown.
+CacheAdmissionPolicy parse_cache_admission_policy(const std::string& policy);
+std::string to_string(CacheAdmissionPolicy policy);
+
 // Create a new cache with a specified name and capacity.
 // This implementation of Cache uses a least-recently-used eviction policy.
 extern Cache* new_lru_cache(const std::string& name, size_t capacity,
-                            LRUCacheType type = LRUCacheType::SIZE, uint32_t num_shards = 16);
+                            LRUCacheType type = LRUCacheType::SIZE, uint32_t num_shards = 16,
+                            CacheAdmissionPolicy policy = CacheAdmissionPolicy::LRU);
 
 class CacheKey {
 public:
@@ -227,8 +240,16 @@ public:
     // may hold lock for a long time to execute predicate.
     virtual int64_t prune_if(CacheValuePredicate pred, bool lazy_mode = false) { return 0; }
 
+    // Evict the least recently used entries that are not in use until about bytes of memory
+    // are freed, so that a memory gc does not need to prune the whole cache.
+    // return the memory bytes of the entries being evicted.
+    virtual int64_t evict(int64_t bytes) { return 0; }
+
     virtual int64_t mem_consumption() = 0;
 
+    // the number of lookups which hit the cache since it is created
+    virtual uint64_t get_hit_count() { return 0; }
+
     virtual int64_t get_usage() = 0;
 
     virtual size_t get_total_capacity() = 0;
@@ -323,6 +344,31 @@ private:
 // because the begin element's timestamp is the oldest.
 using LRUHandleSortedSet = std::set<std::pair<int64_t, LRUHandle*>>;
 
+// Estimate the recent access frequency of keys by a count-min sketch with 4-bit counters,
+// all the counters are halved after a sample period so that stale popularity fades out.
+// Not thread safe, used under the lock of LRUCache.
+class FrequencySketch {
+public:
+    // The number of elements the sketch should track with reasonable accuracy.
+    void set_capacity(size_t num_elements);
+    void increment(uint32_t hash);
+    uint32_t frequency(uint32_t hash) const;
+
+private:
+    static constexpr int DEPTH = 4;
+    static constexpr uint64_t MAX_COUNT = 15;
+
+    // Return the index in _table and the bit offset of the counter in the word.
+    std::pair<size_t, uint32_t> _locate(uint32_t hash, int depth) const;
+    void _reset();
+
+    // Each word holds 16 counters of 4 bits.
+    std::vector<uint64_t> _table;
+    size_t _table_mask = 0;
+    size_t _additions = 0;
+    size_t _sample_size = 0;
+};
+
 // A single shard of sharded cache.
 class LRUCache {
 public:
@@ -334,6 +380,8 @@ public:
     void set_element_count_capacity(uint32_t element_count_capacity) {
         _element_count_capacity = element_count_capacity;
     }
+    // Must be called after set_capacity, the frequency sketch is sized by the capacity.
+    void set_admission_policy(CacheAdmissionPolicy policy);
 
     // Like Cache methods, but with an extra "hash" parameter.
     Cache::Handle* insert(const CacheKey& key, uint32_t hash, void* value, size_t charge,
@@ -345,12 +393,14 @@ public:
     void erase(const CacheKey& key, uint32_t hash);
     int64_t prune();
     int64_t prune_if(CacheValuePredicate pred, bool lazy_mode = false);
+    int64_t evict(int64_t bytes);
 
     void set_cache_value_time_extractor(CacheValueTimeExtractor cache_value_time_extractor);
     void set_cache_value_check_timestamp(bool cache_value_check_timestamp);
 
     uint64_t get_lookup_count() const { return _lookup_count; }
     uint64_t get_hit_count() const { return _hit_count; }
+    uint64_t get_admission_reject_count() const { return _admission_reject_count; }
     size_t get_usage() const { return _usage; }
     size_t get_capacity() const { return _capacity; }
 
@@ -362,6 +412,7 @@ private:
     void _evict_from_lru_with_time(size_t total_size, LRUHandle** to_remove_head);
     void _evict_one_entry(LRUHandle* e);
     bool _check_element_count_limit();
+    bool _admit(uint32_t hash, size_t total_size);
 
 private:
     LRUCacheType _type;
@@ -391,16 +442,22 @@ private:
     LRUHandleSortedSet _sorted_durable_entries_with_timestamp;
 
     uint32_t _element_count_capacity = 0;
+
+    CacheAdmissionPolicy _admission_policy = CacheAdmissionPolicy::LRU;
+    FrequencySketch _frequency_sketch;
+    uint64_t _admission_reject_count = 0;
 };
 
 class ShardedLRUCache : public Cache {
 public:
     explicit ShardedLRUCache(const std::string& name, size_t total_capacity, LRUCacheType type,
-                             uint32_t num_shards, uint32_t element_count_capacity = 0);
+                             uint32_t num_shards, uint32_t element_count_capacity = 0,
+                             CacheAdmissionPolicy policy = CacheAdmissionPolicy::LRU);
     explicit ShardedLRUCache(const std::string& name, size_t total_capacity, LRUCacheType type,
                              uint32_t num_shards,
                              CacheValueTimeExtractor cache_value_time_extractor,
-                             bool cache_value_check_timestamp, uint32_t element_count_capacity = 0);
+                             bool cache_value_check_timestamp, uint32_t element_count_capacity = 0,
+                             CacheAdmissionPolicy policy = CacheAdmissionPolicy::LRU);
     // TODO(fdy): 析构时清除所有cache元素
     virtual ~ShardedLRUCache();
     virtual Handle* insert(const CacheKey& key, void* value, size_t charge,
@@ -415,7 +472,9 @@ public:
     virtual uint64_t new_id() override;
     virtual int64_t prune() override;
     int64_t prune_if(CacheValuePredicate pred, bool lazy_mode = false) override;
+    int64_t evict(int64_t bytes) override;
     int64_t mem_consumption() override;
+    uint64_t get_hit_count() override;
     int64_t get_usage() override;
     size_t get_total_capacity() override { return _total_capacity; };
 
@@ -434,6 +493,7 @@ private:
     LRUCache** _shards;
     std::atomic<uint64_t> _last_id;
     size_t _total_capacity;
+    std::atomic<uint32_t> _last_evicted_shard = 0;
 
     std::unique_ptr<MemTrackerLimiter> _mem_tracker;
     std::shared_ptr<MetricEntity> _entity = nullptr;
@@ -443,6 +503,7 @@ private:
     IntAtomicCounter* cache_lookup_count = nullptr;
     IntAtomicCounter* cache_hit_count = nullptr;
     DoubleGauge* cache_hit_ratio = nullptr;
+    IntAtomicCounter* cache_admission_reject_count = nullptr;
 };
 
 } // namespace doris
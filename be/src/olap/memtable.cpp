@@ -32,6 +32,8 @@
 #include "common/config.h"
 #include "common/consts.h"
 #include "common/logging.h"
+#include "gutil/endian.h"
+#include "olap/key_coder.h"
 #include "olap/olap_define.h"
 #include "olap/rowset/beta_rowset.h"
 #include "olap/rowset/rowset_writer.h"
@@ -39,6 +41,7 @@
 #include "olap/schema.h"
 #include "olap/schema_change.h"
 #include "olap/tablet_schema.h"
+#include "olap/types.h"
 #include "runtime/descriptors.h"
 #include "runtime/exec_env.h"
 #include "runtime/load_channel_mgr.h"
@@ -50,6 +53,7 @@
 #include "vec/aggregate_functions/aggregate_function_reader.h"
 #include "vec/aggregate_functions/aggregate_function_simple_factory.h"
 #include "vec/columns/column.h"
+#include "vec/columns/column_nullable.h"
 #include "vec/columns/column_object.h"
 #include "vec/columns/column_string.h"
 #include "vec/common/assert_cast.h"
@@ -251,13 +255,154 @@ void MemTable::_put_into_output(vectorized::Block& in_block) {
                                    row_pos_vec.data() + in_block.rows());
 }
 
+namespace {
+// A key column encoded into the prefix of the sort key.
+struct KeyPrefixColumn {
+    const vectorized::IColumn* column;
+    const vectorized::NullMap* null_map;
+    const KeyCoder* coder;
+    // number of bytes of the encoded value in the prefix
+    size_t width;
+    bool is_string;
+};
+
+bool is_prefix_fixed_length_type(FieldType type) {
+    switch (type) {
+    case FieldType::OLAP_FIELD_TYPE_BOOL:
+    case FieldType::OLAP_FIELD_TYPE_TINYINT:
+    case FieldType::OLAP_FIELD_TYPE_SMALLINT:
+    case FieldType::OLAP_FIELD_TYPE_INT:
+    case FieldType::OLAP_FIELD_TYPE_BIGINT:
+    case FieldType::OLAP_FIELD_TYPE_LARGEINT:
+    case FieldType::OLAP_FIELD_TYPE_DATEV2:
+    case FieldType::OLAP_FIELD_TYPE_DATETIMEV2:
+    case FieldType::OLAP_FIELD_TYPE_DECIMAL32:
+    case FieldType::OLAP_FIELD_TYPE_DECIMAL64:
+    case FieldType::OLAP_FIELD_TYPE_DECIMAL128I:
+        return true;
+    default:
+        return false;
+    }
+}
+
+bool is_prefix_string_type(FieldType type) {
+    return type == FieldType::OLAP_FIELD_TYPE_CHAR || type == FieldType::OLAP_FIELD_TYPE_VARCHAR ||
+           type == FieldType::OLAP_FIELD_TYPE_STRING;
+}
+
+// Encode the key columns of the row into a big endian integer, null is encoded as a zero
+// byte before the value and the strings are padded with zero, which keeps the order of
+// IColumn::compare_at with nulls first.
+uint64_t encode_key_prefix(const std::vector<KeyPrefixColumn>& columns, size_t row,
+                           std::string* buf) {
+    uint8_t key[sizeof(uint64_t)] = {0};
+    size_t pos = 0;
+    for (const auto& column : columns) {
+        if (column.null_map != nullptr) {
+            if ((*column.null_map)[row]) {
+                pos += 1 + column.width;
+                continue;
+            }
+            key[pos++] = 1;
+        }
+        auto value = column.column->get_data_at(row);
+        buf->clear();
+        if (column.is_string) {
+            Slice slice(value.data, value.size);
+            column.coder->encode_ascending(&slice, column.width, buf);
+        } else {
+            column.coder->full_encode_ascending(value.data, buf);
+        }
+        memcpy(key + pos, buf->data(), std::min(buf->size(), column.width));
+        pos += column.width;
+    }
+    uint64_t prefix;
+    memcpy(&prefix, key, sizeof(prefix));
+    return BigEndian::ToHost64(prefix);
+}
+} // namespace
+
+size_t MemTable::_sort_by_key_prefix(Tie& tie) {
+    std::vector<KeyPrefixColumn> columns;
+    size_t num_full_columns = 0;
+    size_t remaining = sizeof(uint64_t);
+    for (size_t cid = 0; cid < _schema->num_key_columns(); ++cid) {
+        auto type = _schema->column(cid)->type();
+        bool is_string = is_prefix_string_type(type);
+        if (!is_string && !is_prefix_fixed_length_type(type)) {
+            break;
+        }
+        const vectorized::IColumn* column = _input_mutable_block.mutable_columns()[cid].get();
+        const vectorized::NullMap* null_map = nullptr;
+        if (column->is_nullable()) {
+            auto nullable = assert_cast<const vectorized::ColumnNullable*>(column);
+            null_map = &nullable->get_null_map_data();
+            column = &nullable->get_nested_column();
+        }
+        size_t null_width = null_map != nullptr ? 1 : 0;
+        if (remaining <= null_width) {
+            break;
+        }
+        size_t width = remaining - null_width;
+        if (is_string) {
+            if (vectorized::check_and_get_column<vectorized::ColumnString>(column) == nullptr) {
+                break;
+            }
+        } else {
+            // the value in column must be the same as in storage to be encoded by KeyCoder
+            if (!column->is_fixed_and_contiguous() ||
+                column->size_of_value_if_fixed() != get_scalar_type_info(type)->size()) {
+                break;
+            }
+            width = std::min(width, column->size_of_value_if_fixed());
+        }
+        columns.push_back({column, null_map, get_key_coder(type), width, is_string});
+        remaining -= null_width + width;
+        if (is_string || width < column->size_of_value_if_fixed()) {
+            // partially encoded
+            break;
+        }
+        ++num_full_columns;
+        if (remaining == 0) {
+            break;
+        }
+    }
+    if (columns.empty()) {
+        return 0;
+    }
+
+    size_t begin = _last_sorted_pos;
+    size_t end = _row_in_blocks.size();
+    std::vector<std::pair<uint64_t, RowInBlock*>> rows;
+    rows.reserve(end - begin);
+    std::string buf;
+    for (size_t i = begin; i < end; ++i) {
+        rows.emplace_back(encode_key_prefix(columns, _row_in_blocks[i]->_row_pos, &buf),
+                          _row_in_blocks[i]);
+    }
+    pdqsort(rows.begin(), rows.end(),
+            [](const auto& lhs, const auto& rhs) { return lhs.first < rhs.first; });
+    tie[begin] = 0;
+    for (size_t i = 0; i < rows.size(); ++i) {
+        _row_in_blocks[begin + i] = rows[i].second;
+        if (i > 0) {
+            tie[begin + i] = rows[i].first == rows[i - 1].first;
+        }
+    }
+    return num_full_columns;
+}
+
 size_t MemTable::_sort() {
     SCOPED_RAW_TIMER(&_stat.sort_ns);
     _stat.sort_times++;
     size_t same_keys_num = 0;
     // sort new rows
     Tie tie = Tie(_last_sorted_pos, _row_in_blocks.size());
-    for (size_t i = 0; i < _schema->num_key_columns(); i++) {
+    size_t sorted_columns = 0;
+    if (_row_in_blocks.size() > _last_sorted_pos) {
+        sorted_columns = _sort_by_key_prefix(tie);
+    }
+    for (size_t i = sorted_columns; i < _schema->num_key_columns(); i++) {
         auto cmp = [&](const RowInBlock* lhs, const RowInBlock* rhs) -> int {
             return _input_mutable_block.compare_one_column(lhs->_row_pos, rhs->_row_pos, i, -1);
         };
@@ -545,7 +690,13 @@ Status MemTable::unfold_variant_column(vectorized::Block& block, FlushContext* c
     }
     object_column.finalize();
     // Has extended columns
-    RETURN_IF_ERROR(vectorized::schema_util::send_fetch_full_base_schema_view_rpc(&schema_view));
+    std::vector<std::string> paths;
+    paths.reserve(object_column.get_subcolumns().size());
+    for (auto& entry : object_column.get_subcolumns()) {
+        paths.push_back(entry->path.get_path());
+    }
+    RETURN_IF_ERROR(_rowset_writer->mutable_schema_change_recorder()->fetch_base_schema_view(
+            paths, &schema_view));
     // Dynamic Block consists of two parts, dynamic part of columns and static part of columns
     //  static   dynamic
     // | ----- | ------- |
@@ -279,6 +279,9 @@ private:
 
     //return number of same keys
     size_t _sort();
+    // Sort the new rows by the memcomparable prefixes of their leading key columns, which
+    // are compared as integers. Return the number of key columns fully ordered by them.
+    size_t _sort_by_key_prefix(Tie& tie);
     void _sort_one_column(std::vector<RowInBlock*>& row_in_blocks, Tie& tie,
                           std::function<int(const RowInBlock*, const RowInBlock*)> cmp);
     template <bool is_final>
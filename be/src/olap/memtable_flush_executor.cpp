@@ -63,6 +63,14 @@ std::ostream& operator<<(std::ostream& os, const FlushStatistic& stat) {
     return os;
 }
 
+int FlushStatistic::latency_bucket(uint64_t latency_ns) {
+    uint64_t latency_ms = latency_ns / NANOS_PER_MILLIS;
+    if (latency_ms == 0) {
+        return 0;
+    }
+    return std::min(64 - __builtin_clzll(latency_ms), NUM_LATENCY_BUCKETS - 1);
+}
+
 Status FlushToken::submit(std::unique_ptr<MemTable> mem_table) {
     auto s = _flush_status.load();
     if (s != OK) {
@@ -111,6 +119,7 @@ void FlushToken::_flush_memtable(MemTable* memtable, int64_t submit_task_time) {
                   << ", finish count: " << _stats.flush_finish_count
                   << ", mem size: " << memory_usage << ", disk size: " << memtable->flush_size();
     _stats.flush_time_ns += timer.elapsed_time();
+    _stats.flush_latency_buckets[FlushStatistic::latency_bucket(timer.elapsed_time())]++;
     _stats.flush_finish_count++;
     _stats.flush_running_count--;
     _stats.flush_size_bytes += memtable->memory_usage();
@@ -134,7 +143,11 @@ void MemTableFlushExecutor::init(const std::vector<DataDir*>& data_dirs) {
             .build(&_high_prio_flush_pool);
 }
 
-// NOTE: we use SERIAL mode here to ensure all mem-tables from one tablet are flushed in order.
+// NOTE: the memtables of a beta rowset are flushed in CONCURRENT mode, so that the sorting,
+// aggregation and segment encoding of consecutive memtables of one tablet run in parallel.
+// The order is kept by the segment id assigned to each memtable before it is submitted,
+// and BetaRowsetWriter only advances the number of segments when all previous segments
+// are flushed. SERIAL mode flushes all memtables of one tablet in order on one thread.
 Status MemTableFlushExecutor::create_flush_token(std::unique_ptr<FlushToken>* flush_token,
                                                  RowsetTypePB rowset_type, bool should_serial,
                                                  bool is_high_priority) {
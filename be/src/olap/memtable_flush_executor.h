@@ -43,6 +43,13 @@ struct FlushStatistic {
     std::atomic_uint64_t flush_size_bytes = 0;
     std::atomic_uint64_t flush_disk_size_bytes = 0;
     std::atomic_uint64_t flush_wait_time_ns = 0;
+
+    // The flushes by latency, bucket i counts the flushes taking [2^(i-1), 2^i) ms, the
+    // first one those under 1ms and the last one those over 2^(NUM_LATENCY_BUCKETS-2) ms.
+    static constexpr int NUM_LATENCY_BUCKETS = 16;
+    std::atomic_uint64_t flush_latency_buckets[NUM_LATENCY_BUCKETS] {};
+
+    static int latency_bucket(uint64_t latency_ns);
 };
 
 std::ostream& operator<<(std::ostream& os, const FlushStatistic& stat);
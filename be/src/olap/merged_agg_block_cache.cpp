@@ -0,0 +1,99 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "olap/merged_agg_block_cache.h"
+
+#include <fmt/format.h>
+#include <glog/logging.h>
+
+#include "olap/tablet_schema.h"
+
+namespace doris {
+
+MergedAggBlockCache* MergedAggBlockCache::_s_instance = nullptr;
+
+MergedAggBlockCache::MergedAggBlockCache(int64_t capacity, uint32_t num_shards)
+        : _num_shards(num_shards) {
+    _cache = std::unique_ptr<Cache>(
+            new_lru_cache("MergedAggBlockCache", capacity, LRUCacheType::SIZE, num_shards));
+}
+
+void MergedAggBlockCache::create_global_cache(int64_t capacity, uint32_t num_shards) {
+    DCHECK(_s_instance == nullptr);
+    static MergedAggBlockCache instance(capacity, num_shards);
+    _s_instance = &instance;
+}
+
+MergedAggBlockCache* MergedAggBlockCache::instance() {
+    return _s_instance;
+}
+
+// format: tabletId-schemaHash-schemaVersion-baseVersion-uniqueId1[n]-uniqueId2[n]...
+// where [n] marks the column converted to nullable
+std::string MergedAggBlockCache::cache_key(
+        int64_t tablet_id, int32_t schema_hash, const TabletSchema& tablet_schema,
+        int64_t base_version, const std::vector<uint32_t>& return_columns,
+        const std::unordered_set<uint32_t>* convert_to_null_set) {
+    std::string key = fmt::format("{}-{}-{}-{}", tablet_id, schema_hash,
+                                  tablet_schema.schema_version(), base_version);
+    for (auto cid : return_columns) {
+        bool to_null = convert_to_null_set != nullptr && convert_to_null_set->count(cid) > 0;
+        key.append(fmt::format("-{}{}", tablet_schema.column(cid).unique_id(), to_null ? "n" : ""));
+    }
+    return key;
+}
+
+bool MergedAggBlockCache::lookup(const std::string& key, std::shared_ptr<const Blocks>* blocks) {
+    auto* handle = _cache->lookup(key);
+    if (handle == nullptr) {
+        return false;
+    }
+    *blocks = *reinterpret_cast<std::shared_ptr<const Blocks>*>(_cache->value(handle));
+    _cache->release(handle);
+    return true;
+}
+
+void MergedAggBlockCache::insert(const std::string& key, std::shared_ptr<const Blocks> blocks) {
+    size_t charge = 0;
+    for (const auto& block : *blocks) {
+        charge += block.allocated_bytes();
+    }
+    auto deleter = [](const doris::CacheKey& key, void* value) {
+        delete reinterpret_cast<std::shared_ptr<const Blocks>*>(value);
+    };
+    auto* handle = _cache->insert(key, new std::shared_ptr<const Blocks>(std::move(blocks)),
+                                  charge, deleter);
+    _cache->release(handle);
+}
+
+Status MergedAggBlockRowsetReader::next_block(vectorized::Block* block) {
+    if (_next_block >= _blocks->size()) {
+        return Status::EndOfFile("no more merged agg blocks");
+    }
+    // the block is cleared and reused by the reader, so the cached columns are copied
+    const auto& cached_block = (*_blocks)[_next_block++];
+    auto columns = block->mutate_columns();
+    DCHECK_EQ(columns.size(), cached_block.columns());
+    for (size_t i = 0; i < columns.size(); ++i) {
+        columns[i]->insert_range_from(*cached_block.get_by_position(i).column, 0,
+                                      cached_block.rows());
+    }
+    block->set_columns(std::move(columns));
+    return Status::OK();
+}
+
+} // namespace doris
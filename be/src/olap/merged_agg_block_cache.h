@@ -0,0 +1,140 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <gen_cpp/olap_file.pb.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include "common/status.h"
+#include "olap/lru_cache.h"
+#include "olap/olap_common.h"
+#include "olap/rowset/rowset.h"
+#include "olap/rowset/rowset_reader.h"
+#include "vec/core/block.h"
+
+namespace doris {
+
+class RuntimeProfile;
+class TabletSchema;
+
+// MergedAggBlockCache keeps the rows of the base versions [0, v] of agg-key tablets after
+// merging and aggregating the versions, so a query on the same tablet only merges the later
+// versions with the cached rows instead of all versions. The base versions are the ones below
+// the cumulative point, which stay unchanged until the next base compaction.
+// The key covers the tablet, its schema and the read columns, the cached blocks have the
+// layout of the blocks read from a rowset, see TabletReader::_return_columns.
+class MergedAggBlockCache {
+public:
+    using Blocks = std::vector<vectorized::Block>;
+
+    // Create global instance of this class
+    static void create_global_cache(int64_t capacity, uint32_t num_shards = kDefaultNumShards);
+
+    static MergedAggBlockCache* instance();
+
+    static std::string cache_key(int64_t tablet_id, int32_t schema_hash,
+                                 const TabletSchema& tablet_schema, int64_t base_version,
+                                 const std::vector<uint32_t>& return_columns,
+                                 const std::unordered_set<uint32_t>* convert_to_null_set);
+
+    // Return true and fill `blocks` if the key is found. The blocks stay valid after the
+    // entry is evicted.
+    bool lookup(const std::string& key, std::shared_ptr<const Blocks>* blocks);
+
+    void insert(const std::string& key, std::shared_ptr<const Blocks> blocks);
+
+    // An entry larger than a shard of the cache is evicted at once, so it is not worth merging.
+    size_t max_charge() { return _cache->get_total_capacity() / _num_shards; }
+
+private:
+    static constexpr uint32_t kDefaultNumShards = 16;
+    MergedAggBlockCache(int64_t capacity, uint32_t num_shards);
+    static MergedAggBlockCache* _s_instance;
+    std::unique_ptr<Cache> _cache;
+    uint32_t _num_shards;
+};
+
+// Reads the cached merged rows of the base versions like a rowset in the merge of
+// VCollectIterator. `rowset` is one of the base rowsets, only used to estimate the size of
+// the input.
+class MergedAggBlockRowsetReader : public RowsetReader {
+public:
+    MergedAggBlockRowsetReader(std::shared_ptr<const MergedAggBlockCache::Blocks> blocks,
+                               Version version, RowsetSharedPtr rowset)
+            : _blocks(std::move(blocks)), _version(version), _rowset(std::move(rowset)) {}
+
+    ~MergedAggBlockRowsetReader() override = default;
+
+    Status init(RowsetReaderContext* read_context,
+                const std::pair<int, int>& segment_offset) override {
+        _next_block = 0;
+        return Status::OK();
+    }
+
+    Status get_segment_iterators(RowsetReaderContext* read_context,
+                                 std::vector<RowwiseIteratorUPtr>* out_iters,
+                                 const std::pair<int, int>& segment_offset,
+                                 bool use_cache = false) override {
+        return Status::NotSupported("merged agg blocks have no segment");
+    }
+
+    void reset_read_options() override {}
+
+    void set_segment_row_ranges(std::unordered_map<uint32_t, std::pair<uint32_t, uint32_t>>
+                                        segment_row_ranges) override {}
+
+    Status next_block(vectorized::Block* block) override;
+
+    Status next_block_view(vectorized::BlockView* block_view) override {
+        return Status::NotSupported("merged agg blocks can not be read by ref");
+    }
+
+    bool delete_flag() override { return false; }
+
+    Version version() override { return _version; }
+
+    RowsetSharedPtr rowset() override { return _rowset; }
+
+    int64_t filtered_rows() override { return 0; }
+
+    RowsetTypePB type() const override { return RowsetTypePB::BETA_ROWSET; }
+
+    int64_t newest_write_timestamp() override { return _rowset->newest_write_timestamp(); }
+
+    bool update_profile(RuntimeProfile* profile) override { return false; }
+
+    RowsetReaderSharedPtr clone() override {
+        return std::make_shared<MergedAggBlockRowsetReader>(_blocks, _version, _rowset);
+    }
+
+private:
+    std::shared_ptr<const MergedAggBlockCache::Blocks> _blocks;
+    Version _version;
+    RowsetSharedPtr _rowset;
+    size_t _next_block = 0;
+};
+
+} // namespace doris
@@ -24,6 +24,7 @@
 #include <algorithm>
 #include <iterator>
 #include <memory>
+#include <mutex>
 #include <numeric>
 #include <ostream>
 #include <shared_mutex>
@@ -40,11 +41,13 @@
 #include "olap/rowset/rowset.h"
 #include "olap/rowset/rowset_meta.h"
 #include "olap/rowset/rowset_writer.h"
+#include "olap/rowset/vertical_beta_rowset_writer.h"
 #include "olap/rowset/segment_v2/segment_writer.h"
 #include "olap/storage_engine.h"
 #include "olap/tablet.h"
 #include "olap/utils.h"
 #include "util/slice.h"
+#include "util/threadpool.h"
 #include "util/trace.h"
 #include "vec/core/block.h"
 #include "vec/olap/block_reader.h"
@@ -189,7 +192,9 @@ Status Merger::vertical_compact_one_group(
         TabletSharedPtr tablet, ReaderType reader_type, TabletSchemaSPtr tablet_schema, bool is_key,
         const std::vector<uint32_t>& column_group, vectorized::RowSourcesBuffer* row_source_buf,
         const std::vector<RowsetReaderSharedPtr>& src_rowset_readers,
-        RowsetWriter* dst_rowset_writer, int64_t max_rows_per_segment, Statistics* stats_output) {
+        RowsetWriter* dst_rowset_writer, int64_t max_rows_per_segment, Statistics* stats_output,
+        VerticalColumnGroupWriter* column_group_writer) {
+    DCHECK(column_group_writer == nullptr || !is_key);
     // build tablet reader
     VLOG_NOTICE << "vertical compact one group, max_rows_per_segment=" << max_rows_per_segment;
     vectorized::VerticalBlockReader reader(row_source_buf);
@@ -244,7 +249,10 @@ Status Merger::vertical_compact_one_group(
                 reader.next_block_with_aggregation(&block, &eof),
                 "failed to read next block when merging rowsets of tablet " + tablet->full_name());
         RETURN_NOT_OK_STATUS_WITH_WARN(
-                dst_rowset_writer->add_columns(&block, column_group, is_key, max_rows_per_segment),
+                column_group_writer != nullptr
+                        ? column_group_writer->add_columns(&block)
+                        : dst_rowset_writer->add_columns(&block, column_group, is_key,
+                                                         max_rows_per_segment),
                 "failed to write block when merging rowsets of tablet " + tablet->full_name());
 
         if (is_key && reader_params.record_rowids && block.rows() > 0) {
@@ -266,7 +274,11 @@ Status Merger::vertical_compact_one_group(
         stats_output->merged_rows = reader.merged_rows();
         stats_output->filtered_rows = reader.filtered_rows();
     }
-    RETURN_IF_ERROR(dst_rowset_writer->flush_columns(is_key));
+    if (column_group_writer != nullptr) {
+        RETURN_IF_ERROR(column_group_writer->flush_columns());
+    } else {
+        RETURN_IF_ERROR(dst_rowset_writer->flush_columns(is_key));
+    }
 
     return Status::OK();
 }
@@ -327,11 +339,78 @@ Status Merger::vertical_compact_one_group(TabletSharedPtr tablet, ReaderType rea
     return Status::OK();
 }
 
+int Merger::vertical_compaction_parallelism(size_t num_value_groups) {
+    int64_t parallelism = std::min<int64_t>(config::vertical_compaction_max_parallel_groups,
+                                            num_value_groups);
+    if (parallelism <= 1) {
+        return 1;
+    }
+    // Every group holds its own readers of the input rowsets, so the parallelism shrinks with
+    // the free permits of compaction, which limit the memory consumption of compaction.
+    int64_t total_permits = config::total_permits_for_compaction_score;
+    if (total_permits > 0) {
+        int64_t used_permits = StorageEngine::instance()->compaction_permit_usage();
+        int64_t free_permits = std::max<int64_t>(0, total_permits - used_permits);
+        parallelism = parallelism * free_permits / total_permits;
+    }
+    return static_cast<int>(std::max<int64_t>(parallelism, 1));
+}
+
 // steps to do vertical merge:
 // 1. split columns into column groups
 // 2. compact groups one by one, generate a row_source_buf when compact key group
-// and use this row_source_buf to compact value column groups
+// and use this row_source_buf to compact value column groups, the value column groups may be
+// compacted in parallel, each with a clone of row_source_buf and input rowset readers
 // 3. build output rowset
+Status Merger::_vertical_compact_value_groups_in_parallel(
+        TabletSharedPtr tablet, ReaderType reader_type, TabletSchemaSPtr tablet_schema,
+        const std::vector<std::vector<uint32_t>>& column_groups, int parallelism,
+        const vectorized::RowSourcesBuffer& row_sources_buf,
+        const std::vector<RowsetReaderSharedPtr>& src_rowset_readers,
+        VerticalBetaRowsetWriter* dst_rowset_writer, int64_t max_rows_per_segment) {
+    std::unique_ptr<ThreadPool> thread_pool;
+    RETURN_IF_ERROR(ThreadPoolBuilder("VerticalCompactionGroupPool")
+                            .set_min_threads(parallelism)
+                            .set_max_threads(parallelism)
+                            .build(&thread_pool));
+    std::mutex status_lock;
+    Status status = Status::OK();
+    for (size_t i = 1; i < column_groups.size(); ++i) {
+        std::unique_ptr<vectorized::RowSourcesBuffer> cloned_row_sources_buf;
+        RETURN_IF_ERROR(row_sources_buf.clone(&cloned_row_sources_buf));
+        std::shared_ptr<vectorized::RowSourcesBuffer> group_row_sources_buf =
+                std::move(cloned_row_sources_buf);
+        std::vector<RowsetReaderSharedPtr> group_rowset_readers;
+        for (const auto& rs_reader : src_rowset_readers) {
+            group_rowset_readers.emplace_back(rs_reader->clone());
+        }
+        auto st = thread_pool->submit_func([&, i, group_buf = std::move(group_row_sources_buf),
+                                            readers = std::move(group_rowset_readers)]() {
+            {
+                std::lock_guard<std::mutex> l(status_lock);
+                if (!status.ok()) {
+                    return;
+                }
+            }
+            auto group_writer = dst_rowset_writer->create_column_group_writer(column_groups[i]);
+            auto group_st = vertical_compact_one_group(
+                    tablet, reader_type, tablet_schema, false, column_groups[i], group_buf.get(),
+                    readers, dst_rowset_writer, max_rows_per_segment, nullptr,
+                    group_writer.get());
+            if (!group_st.ok()) {
+                std::lock_guard<std::mutex> l(status_lock);
+                status = group_st;
+            }
+        });
+        if (!st.ok()) {
+            thread_pool->wait();
+            return st;
+        }
+    }
+    thread_pool->wait();
+    return status;
+}
+
 Status Merger::vertical_merge_rowsets(TabletSharedPtr tablet, ReaderType reader_type,
                                       TabletSchemaSPtr tablet_schema,
                                       const std::vector<RowsetReaderSharedPtr>& src_rowset_readers,
@@ -343,6 +422,21 @@ Status Merger::vertical_merge_rowsets(TabletSharedPtr tablet, ReaderType reader_
 
     vectorized::RowSourcesBuffer row_sources_buf(tablet->tablet_id(), tablet->tablet_path(),
                                                  reader_type);
+    auto* vertical_rowset_writer = dynamic_cast<VerticalBetaRowsetWriter*>(dst_rowset_writer);
+    int parallelism = column_groups.size() > 1
+                              ? vertical_compaction_parallelism(column_groups.size() - 1)
+                              : 1;
+    if (vertical_rowset_writer != nullptr && parallelism > 1) {
+        RETURN_IF_ERROR(vertical_compact_one_group(
+                tablet, reader_type, tablet_schema, true, column_groups[0], &row_sources_buf,
+                src_rowset_readers, dst_rowset_writer, max_rows_per_segment, stats_output));
+        RETURN_IF_ERROR(row_sources_buf.flush());
+        RETURN_IF_ERROR(_vertical_compact_value_groups_in_parallel(
+                tablet, reader_type, tablet_schema, column_groups, parallelism, row_sources_buf,
+                src_rowset_readers, vertical_rowset_writer, max_rows_per_segment));
+        VLOG_NOTICE << "finish compact groups in parallel, parallelism=" << parallelism;
+        return dst_rowset_writer->final_flush();
+    }
     // compact group one by one
     for (auto i = 0; i < column_groups.size(); ++i) {
         VLOG_NOTICE << "row source size: " << row_sources_buf.total_size();
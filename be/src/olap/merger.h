@@ -31,6 +31,8 @@ namespace doris {
 class KeyBoundsPB;
 class RowIdConversion;
 class RowsetWriter;
+class VerticalBetaRowsetWriter;
+class VerticalColumnGroupWriter;
 
 namespace segment_v2 {
 class SegmentWriter;
@@ -67,6 +69,8 @@ public:
 
 public:
     // for vertical compaction
+    // number of threads to merge the value column groups of a vertical compaction
+    static int vertical_compaction_parallelism(size_t num_value_groups);
     static void vertical_split_columns(TabletSchemaSPtr tablet_schema,
                                        std::vector<std::vector<uint32_t>>* column_groups);
     static Status vertical_compact_one_group(
@@ -75,7 +79,7 @@ public:
             vectorized::RowSourcesBuffer* row_source_buf,
             const std::vector<RowsetReaderSharedPtr>& src_rowset_readers,
             RowsetWriter* dst_rowset_writer, int64_t max_rows_per_segment,
-            Statistics* stats_output);
+            Statistics* stats_output, VerticalColumnGroupWriter* column_group_writer = nullptr);
 
     // for segcompaction
     static Status vertical_compact_one_group(TabletSharedPtr tablet, ReaderType reader_type,
@@ -86,6 +90,14 @@ public:
                                              segment_v2::SegmentWriter& dst_segment_writer,
                                              int64_t max_rows_per_segment, Statistics* stats_output,
                                              uint64_t* index_size, KeyBoundsPB& key_bounds);
+
+private:
+    static Status _vertical_compact_value_groups_in_parallel(
+            TabletSharedPtr tablet, ReaderType reader_type, TabletSchemaSPtr tablet_schema,
+            const std::vector<std::vector<uint32_t>>& column_groups, int parallelism,
+            const vectorized::RowSourcesBuffer& row_sources_buf,
+            const std::vector<RowsetReaderSharedPtr>& src_rowset_readers,
+            VerticalBetaRowsetWriter* dst_rowset_writer, int64_t max_rows_per_segment);
 };
 
 } // namespace doris
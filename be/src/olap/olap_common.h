@@ -301,6 +301,9 @@ struct OlapReaderStatistics {
     int64_t second_read_ns = 0;
     int64_t block_first_read_seek_num = 0;
     int64_t block_first_read_seek_ns = 0;
+    int64_t page_prefetch_plan_ns = 0;
+    int64_t page_prefetch_io_count = 0;
+    int64_t page_prefetch_bytes = 0;
     int64_t lazy_read_ns = 0;
     int64_t block_lazy_read_seek_num = 0;
     int64_t block_lazy_read_seek_ns = 0;
@@ -322,8 +325,12 @@ struct OlapReaderStatistics {
     std::map<int, PredicateFilterInfo> filter_info;
 
     int64_t rows_key_range_filtered = 0;
+    // key range bounds found in KeyRangeLookupCache
+    int64_t key_range_lookup_cache_hit = 0;
     int64_t rows_stats_filtered = 0;
     int64_t rows_bf_filtered = 0;
+    // rows pruned by the index with the runtime filters arriving after the reader is created
+    int64_t rows_late_rf_index_filtered = 0;
     // Including the number of rows filtered out according to the Delete information in the Tablet,
     // and the number of rows filtered for marked deleted rows under the unique key model.
     // This metric is mainly used to record the number of rows filtered by the delete condition in Segment V1,
@@ -358,8 +365,17 @@ struct OlapReaderStatistics {
     int64_t filtered_segment_number = 0;
     // total number of segment
     int64_t total_segment_number = 0;
+    // number of rowset filtered by the rowset level zone maps before loading its segments
+    int64_t filtered_rowset_number = 0;
+    // number of segment checked and filtered by the segment ngram bloom filter of LIKE
+    int64_t segment_ngram_bf_checked_number = 0;
+    int64_t segment_ngram_bf_filtered_number = 0;
+    // tablets whose base versions are read from MergedAggBlockCache, or merged and cached
+    int64_t merged_agg_block_cache_hit = 0;
+    int64_t merged_agg_block_cache_miss = 0;
 
     io::FileCacheStatistics file_cache_stats;
+    io::IOStatistics io_stats;
     int64_t load_segments_timer = 0;
 };
 
@@ -25,6 +25,7 @@
 #include <stddef.h>
 #include <stdint.h>
 
+#include <algorithm>
 #include <memory>
 #include <sstream>
 #include <vector>
@@ -202,6 +203,75 @@ Status OlapMeta::put(const int column_family_index, const std::vector<BatchEntry
     return Status::OK();
 }
 
+Status OlapMeta::group_put(const int column_family_index, const std::vector<BatchEntry>& entries) {
+    if (!config::enable_meta_group_write) {
+        return put(column_family_index, entries);
+    }
+    GroupWriter writer {column_family_index, entries};
+    std::unique_lock l(_group_lock);
+    _group_writers.push_back(&writer);
+    _group_cv.wait(l, [&] { return writer.done || _group_writers.front() == &writer; });
+    if (writer.done) {
+        return writer.status;
+    }
+
+    // the leader writes the entries of the writers queued so far, the ones coming during the
+    // write are written by the next leader
+    size_t max_entries = std::max(config::meta_group_write_max_entries, 1);
+    size_t num_entries = 0;
+    std::vector<GroupWriter*> group;
+    for (auto* w : _group_writers) {
+        if (!group.empty() && num_entries + w->entries.size() > max_entries) {
+            break;
+        }
+        group.push_back(w);
+        num_entries += w->entries.size();
+    }
+    l.unlock();
+    Status st = _write_group(group);
+    l.lock();
+    for (auto* w : group) {
+        DCHECK_EQ(_group_writers.front(), w);
+        _group_writers.pop_front();
+        w->status = st;
+        w->done = true;
+    }
+    _group_cv.notify_all();
+    return st;
+}
+
+Status OlapMeta::_write_group(const std::vector<GroupWriter*>& group) {
+    DorisMetrics::instance()->meta_write_request_total->increment(1);
+
+    rocksdb::Status s;
+    {
+        int64_t duration_ns = 0;
+        Defer defer([&] {
+            DorisMetrics::instance()->meta_write_request_duration_us->increment(duration_ns / 1000);
+        });
+        SCOPED_RAW_TIMER(&duration_ns);
+
+        rocksdb::WriteBatch write_batch;
+        for (auto* writer : group) {
+            auto* handle = _handles[writer->column_family_index].get();
+            for (const auto& entry : writer->entries) {
+                write_batch.Put(handle, rocksdb::Slice(entry.key), rocksdb::Slice(entry.value));
+            }
+        }
+
+        WriteOptions write_options;
+        write_options.sync = config::sync_tablet_meta;
+        s = _db->Write(write_options, &write_batch);
+    }
+
+    if (!s.ok()) {
+        LOG(WARNING) << "rocks db write a group of " << group.size()
+                     << " writers failed, reason:" << s.ToString();
+        return Status::Error<META_PUT_ERROR>();
+    }
+    return Status::OK();
+}
+
 Status OlapMeta::remove(const int column_family_index, const std::string& key) {
     DorisMetrics::instance()->meta_write_request_total->increment(1);
     auto& handle = _handles[column_family_index];
@@ -17,8 +17,11 @@
 
 #pragma once
 
+#include <condition_variable>
+#include <deque>
 #include <functional>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <vector>
 
@@ -53,6 +56,10 @@ public:
 
     Status put(const int column_family_index, const std::string& key, const std::string& value);
     Status put(const int column_family_index, const std::vector<BatchEntry>& entries);
+    // Puts the entries in one write batch with the ones of the concurrent callers, written by
+    // the first of them for all, as the rowset and tablet metas saved by the publish of a lot
+    // of tablets at the same time. Same as put() if !config::enable_meta_group_write.
+    Status group_put(const int column_family_index, const std::vector<BatchEntry>& entries);
 
     Status remove(const int column_family_index, const std::string& key);
     Status remove(const int column_family_index, const std::vector<std::string>& keys);
@@ -63,10 +70,24 @@ public:
     std::string get_root_path() const { return _root_path; }
 
 private:
+    struct GroupWriter {
+        const int column_family_index;
+        const std::vector<BatchEntry>& entries;
+        Status status;
+        bool done = false;
+    };
+
+    Status _write_group(const std::vector<GroupWriter*>& group);
+
     std::string _root_path;
     // keep order of _db && _handles, we need destroy _handles before _db
     std::unique_ptr<rocksdb::DB, std::function<void(rocksdb::DB*)>> _db;
     std::vector<std::unique_ptr<rocksdb::ColumnFamilyHandle>> _handles;
+
+    std::mutex _group_lock;
+    std::condition_variable _group_cv;
+    // the writers of group_put(), the one in the front writes for the ones behind it
+    std::deque<GroupWriter*> _group_writers;
 };
 
 } // namespace doris
@@ -70,6 +70,7 @@
 #include "util/doris_metrics.h"
 #include "util/mem_info.h"
 #include "util/priority_thread_pool.hpp"
+#include "util/system_metrics.h"
 #include "util/thread.h"
 #include "util/threadpool.h"
 #include "util/thrift_rpc_helper.h"
@@ -137,6 +138,10 @@ Status StorageEngine::start_bg_threads() {
             .set_min_threads(config::cold_data_compaction_thread_num)
             .set_max_threads(config::cold_data_compaction_thread_num)
             .build(&_cold_data_compaction_thread_pool);
+    ThreadPoolBuilder("AsyncIndexBuildThreadPool")
+            .set_min_threads(config::async_inverted_index_build_thread_num)
+            .set_max_threads(config::async_inverted_index_build_thread_num)
+            .build(&_async_index_build_thread_pool);
 
     // compaction tasks producer thread
     RETURN_IF_ERROR(Thread::create(
@@ -245,6 +250,16 @@ Status StorageEngine::start_bg_threads() {
             .set_max_threads(config::calc_delete_bitmap_max_thread)
             .build(&_calc_delete_bitmap_thread_pool);
 
+    ThreadPoolBuilder("SchemaChangeSortThreadPool")
+            .set_min_threads(1)
+            .set_max_threads(config::schema_change_sort_max_thread)
+            .build(&_schema_change_sort_thread_pool);
+
+    ThreadPoolBuilder("CloneDownloadThreadPool")
+            .set_min_threads(1)
+            .set_max_threads(config::clone_download_max_thread)
+            .build(&_clone_download_thread_pool);
+
     LOG(INFO) << "all storage engine's background threads are started.";
     return Status::OK();
 }
@@ -806,6 +821,14 @@ std::vector<TabletSharedPtr> StorageEngine::_generate_compaction_tasks(
         copied_cumu_map = _tablet_submitted_cumu_compaction;
         copied_base_map = _tablet_submitted_base_compaction;
     }
+    // Under heavy disk io, only keep one slot for cumulative compaction and one slot for
+    // base compaction on each disk, the slot is given to the tablet of top priority.
+    bool disk_io_busy = false;
+    auto* system_metrics = DorisMetrics::instance()->system_metrics();
+    if (config::compaction_disk_io_util_limit_percent > 0 && system_metrics != nullptr) {
+        disk_io_busy = system_metrics->get_max_disk_io_util_percent() >=
+                       config::compaction_disk_io_util_limit_percent;
+    }
     for (auto data_dir : data_dirs) {
         bool need_pick_tablet = true;
         // We need to reserve at least one Slot for cumulative compaction.
@@ -816,6 +839,9 @@ std::vector<TabletSharedPtr> StorageEngine::_generate_compaction_tasks(
         int count = copied_cumu_map[data_dir].size() + copied_base_map[data_dir].size();
         int thread_per_disk = data_dir->is_ssd_disk() ? config::compaction_task_num_per_fast_disk
                                                       : config::compaction_task_num_per_disk;
+        if (disk_io_busy) {
+            thread_per_disk = std::min(thread_per_disk, 2);
+        }
         if (count >= thread_per_disk) {
             // Return if no available slot
             need_pick_tablet = false;
@@ -918,6 +944,20 @@ void StorageEngine::_pop_tablet_from_submitted_compaction(TabletSharedPtr tablet
     }
 }
 
+int64_t StorageEngine::submitted_compaction_num(DataDir* data_dir) {
+    std::unique_lock<std::mutex> lock(_tablet_submitted_compaction_mutex);
+    int64_t num = 0;
+    auto it = _tablet_submitted_cumu_compaction.find(data_dir);
+    if (it != _tablet_submitted_cumu_compaction.end()) {
+        num += it->second.size();
+    }
+    it = _tablet_submitted_base_compaction.find(data_dir);
+    if (it != _tablet_submitted_base_compaction.end()) {
+        num += it->second.size();
+    }
+    return num;
+}
+
 Status StorageEngine::_submit_compaction_task(TabletSharedPtr tablet,
                                               CompactionType compaction_type, bool force) {
     if (tablet->tablet_meta()->tablet_schema()->enable_single_replica_compaction() &&
@@ -1026,6 +1066,20 @@ Status StorageEngine::_handle_index_change(IndexBuilderSharedPtr index_builder)
     return Status::OK();
 }
 
+void StorageEngine::submit_async_index_build_task(TabletSharedPtr tablet, RowsetSharedPtr rowset) {
+    if (_async_index_build_thread_pool == nullptr) {
+        return;
+    }
+    auto st = _async_index_build_thread_pool->submit_func(
+            [tablet = std::move(tablet), rowset = std::move(rowset)]() {
+                // the failed rowset is queried without the index until it is compacted
+                IndexBuilder::build_pending_inverted_index(tablet, rowset);
+            });
+    if (!st.ok()) {
+        LOG(WARNING) << "failed to submit async index build task, error=" << st;
+    }
+}
+
 void StorageEngine::_cooldown_tasks_producer_callback() {
     int64_t interval = config::generate_cooldown_task_interval_sec;
     // the cooldown replica may be slow to upload it's meta file, so we should wait
@@ -21,6 +21,8 @@
 
 #include <ostream>
 
+#include "common/config.h"
+
 namespace doris {
 
 StoragePageCache* StoragePageCache::_s_instance = nullptr;
@@ -36,25 +38,27 @@ void StoragePageCache::create_global_cache(size_t capacity, int32_t index_cache_
 StoragePageCache::StoragePageCache(size_t capacity, int32_t index_cache_percentage,
                                    int64_t pk_index_cache_capacity, uint32_t num_shards)
         : _index_cache_percentage(index_cache_percentage) {
+    auto policy = parse_cache_admission_policy(config::storage_page_cache_admission_policy);
     if (index_cache_percentage == 0) {
         _data_page_cache = std::unique_ptr<Cache>(
-                new_lru_cache("DataPageCache", capacity, LRUCacheType::SIZE, num_shards));
+                new_lru_cache("DataPageCache", capacity, LRUCacheType::SIZE, num_shards, policy));
     } else if (index_cache_percentage == 100) {
         _index_page_cache = std::unique_ptr<Cache>(
-                new_lru_cache("IndexPageCache", capacity, LRUCacheType::SIZE, num_shards));
+                new_lru_cache("IndexPageCache", capacity, LRUCacheType::SIZE, num_shards, policy));
     } else if (index_cache_percentage > 0 && index_cache_percentage < 100) {
         _data_page_cache = std::unique_ptr<Cache>(
                 new_lru_cache("DataPageCache", capacity * (100 - index_cache_percentage) / 100,
-                              LRUCacheType::SIZE, num_shards));
+                              LRUCacheType::SIZE, num_shards, policy));
         _index_page_cache = std::unique_ptr<Cache>(
                 new_lru_cache("IndexPageCache", capacity * index_cache_percentage / 100,
-                              LRUCacheType::SIZE, num_shards));
+                              LRUCacheType::SIZE, num_shards, policy));
     } else {
         CHECK(false) << "invalid index page cache percentage";
     }
     if (pk_index_cache_capacity > 0) {
         _pk_index_page_cache = std::unique_ptr<Cache>(new_lru_cache(
-                "PkIndexPageCache", pk_index_cache_capacity, LRUCacheType::SIZE, num_shards));
+                "PkIndexPageCache", pk_index_cache_capacity, LRUCacheType::SIZE, num_shards,
+                policy));
     }
 }
 
@@ -79,25 +79,19 @@ class StoragePageCache {
 public:
     // The unique key identifying entries in the page cache.
     // Each cached page corresponds to a specific offset within
-    // a file.
-    //
-    // TODO(zc): Now we use file name(std::string) as a part of
-    // key, which is not efficient. We should make it better later
+    // a file, the file is identified by io::FileReader::file_id().
     struct CacheKey {
-        CacheKey(std::string fname_, size_t fsize_, int64_t offset_)
-                : fname(std::move(fname_)), fsize(fsize_), offset(offset_) {}
-        std::string fname;
-        size_t fsize;
+        CacheKey(uint64_t file_id_, int64_t offset_) : file_id(file_id_), offset(offset_) {}
+        uint64_t file_id;
         int64_t offset;
 
-        // Encode to a flat binary which can be used as LRUCache's key
-        std::string encode() const {
-            std::string key_buf(fname);
-            key_buf.append((char*)&fsize, sizeof(fsize));
-            key_buf.append((char*)&offset, sizeof(offset));
-            return key_buf;
+        // The fixed size key refers to this struct directly, so that lookup does not
+        // build or allocate anything. It must not outlive this struct.
+        doris::CacheKey encode() const {
+            return doris::CacheKey(reinterpret_cast<const char*>(this), sizeof(*this));
         }
     };
+    static_assert(sizeof(CacheKey) == sizeof(uint64_t) + sizeof(int64_t));
 
     static constexpr uint32_t kDefaultNumShards = 16;
 
@@ -140,6 +134,15 @@ public:
 
     void prune(segment_v2::PageTypePB page_type);
 
+    // evict the least recently used pages of about bytes, return the bytes evicted
+    int64_t evict(segment_v2::PageTypePB page_type, int64_t bytes) {
+        return _get_page_cache(page_type)->evict(bytes);
+    }
+
+    uint64_t get_page_cache_hit_count(segment_v2::PageTypePB page_type) {
+        return _get_page_cache(page_type)->get_hit_count();
+    }
+
     int64_t get_page_cache_mem_consumption(segment_v2::PageTypePB page_type) {
         return _get_page_cache(page_type)->mem_consumption();
     }
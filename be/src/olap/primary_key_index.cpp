@@ -19,6 +19,8 @@
 
 #include <gen_cpp/segment_v2.pb.h>
 
+#include <algorithm>
+#include <atomic>
 #include <utility>
 
 // IWYU pragma: no_include <opentelemetry/common/threadlocal.h>
@@ -29,9 +31,14 @@
 #include "olap/rowset/segment_v2/bloom_filter_index_writer.h"
 #include "olap/rowset/segment_v2/encoding_info.h"
 #include "olap/types.h"
+#include "util/hash_util.hpp"
+#include "vec/data_types/data_type_factory.hpp"
 
 namespace doris {
 
+// total memory of the fingerprint indexes of all segments
+static std::atomic<int64_t> s_fingerprint_index_bytes {0};
+
 Status PrimaryKeyIndexBuilder::init() {
     // TODO(liaoxin) using the column type directly if there's only one column in unique key columns
     const auto* type_info = get_scalar_type_info<FieldType::OLAP_FIELD_TYPE_VARCHAR>();
@@ -105,4 +112,96 @@ Status PrimaryKeyIndexReader::parse_bf(io::FileReaderSPtr file_reader,
     return Status::OK();
 }
 
+PrimaryKeyIndexReader::~PrimaryKeyIndexReader() {
+    if (!_fingerprints.empty()) {
+        s_fingerprint_index_bytes.fetch_sub(get_fingerprint_index_memory_size());
+    }
+}
+
+uint64_t PrimaryKeyIndexReader::_fingerprint(const Slice& key_without_seq) {
+    return HashUtil::xxHash64WithSeed(key_without_seq.get_data(), key_without_seq.get_size(),
+                                      0);
+}
+
+Status PrimaryKeyIndexReader::build_fingerprint_index(size_t seq_col_length) {
+    DCHECK(_index_parsed);
+    DCHECK(_fingerprints.empty());
+    uint32_t total = num_rows();
+    int64_t limit = config::primary_key_fingerprint_index_memory_limit_mb * 1024 * 1024;
+    int64_t bytes = total * sizeof(KeyFingerprint);
+    if (total == 0) {
+        return Status::OK();
+    }
+    // reserve the memory first, so concurrent builds can not exceed the limit together
+    if (s_fingerprint_index_bytes.fetch_add(bytes) + bytes > limit) {
+        s_fingerprint_index_bytes.fetch_sub(bytes);
+        return Status::OK();
+    }
+
+    std::vector<KeyFingerprint> fingerprints;
+    fingerprints.reserve(total);
+    std::unique_ptr<segment_v2::IndexedColumnIterator> iter;
+    RETURN_IF_ERROR(new_iterator(&iter));
+    auto index_type = vectorized::DataTypeFactory::instance().create_data_type(
+            type_info()->type(), 1, 0);
+    auto index_column = index_type->create_column();
+    Status st;
+    while (fingerprints.size() < total) {
+        uint32_t ordinal = fingerprints.size();
+        size_t num_read = std::min<size_t>(1024, total - ordinal);
+        index_column->clear();
+        st = iter->seek_to_ordinal(ordinal);
+        if (st.ok()) {
+            st = iter->next_batch(&num_read, index_column);
+        }
+        if (!st.ok() || num_read == 0) {
+            break;
+        }
+        for (size_t i = 0; i < num_read; ++i) {
+            auto key = index_column->get_data_at(i);
+            Slice key_without_seq(key.data, key.size - seq_col_length);
+            fingerprints.push_back({_fingerprint(key_without_seq), ordinal++});
+        }
+    }
+    if (!st.ok() || fingerprints.size() != total) {
+        s_fingerprint_index_bytes.fetch_sub(bytes);
+        return st.ok() ? Status::Corruption("read {} of {} primary keys", fingerprints.size(),
+                                            total)
+                       : st;
+    }
+    std::sort(fingerprints.begin(), fingerprints.end());
+    _fingerprints = std::move(fingerprints);
+    _seq_col_length = seq_col_length;
+    return Status::OK();
+}
+
+Status PrimaryKeyIndexReader::seek_by_fingerprint(segment_v2::IndexedColumnIterator* index_iterator,
+                                                  const Slice& key_without_seq,
+                                                  bool* exact_match) const {
+    DCHECK(has_fingerprint_index());
+    *exact_match = false;
+    KeyFingerprint target {_fingerprint(key_without_seq), 0};
+    auto it = std::lower_bound(_fingerprints.begin(), _fingerprints.end(), target);
+    if (it == _fingerprints.end() || it->fingerprint != target.fingerprint) {
+        return Status::OK();
+    }
+    auto index_type = vectorized::DataTypeFactory::instance().create_data_type(
+            type_info()->type(), 1, 0);
+    auto index_column = index_type->create_column();
+    // verify the candidates, the keys are unique in a segment
+    for (; it != _fingerprints.end() && it->fingerprint == target.fingerprint; ++it) {
+        index_column->clear();
+        size_t num_read = 1;
+        RETURN_IF_ERROR(index_iterator->seek_to_ordinal(it->ordinal));
+        RETURN_IF_ERROR(index_iterator->next_batch(&num_read, index_column));
+        DCHECK_EQ(num_read, 1);
+        auto key = index_column->get_data_at(0);
+        if (key_without_seq.compare(Slice(key.data, key.size - _seq_col_length)) == 0) {
+            *exact_match = true;
+            return index_iterator->seek_to_ordinal(it->ordinal);
+        }
+    }
+    return Status::OK();
+}
+
 } // namespace doris
@@ -22,6 +22,7 @@
 #include <stdint.h>
 
 #include <memory>
+#include <vector>
 
 #include "common/status.h"
 #include "io/fs/file_reader_writer_fwd.h"
@@ -81,6 +82,7 @@ private:
 class PrimaryKeyIndexReader {
 public:
     PrimaryKeyIndexReader() : _index_parsed(false), _bf_parsed(false) {}
+    ~PrimaryKeyIndexReader();
 
     Status parse_index(io::FileReaderSPtr file_reader,
                        const segment_v2::PrimaryKeyIndexMetaPB& meta);
@@ -119,11 +121,42 @@ public:
         return _index_reader->get_memory_size();
     }
 
+    // Build an in-memory index from the fingerprint of each key without sequence column to
+    // its ordinal, if it fits in primary_key_fingerprint_index_memory_limit_mb. All index
+    // pages are read once, then a lookup reads only the page of the key.
+    Status build_fingerprint_index(size_t seq_col_length);
+
+    bool has_fingerprint_index() const { return !_fingerprints.empty(); }
+
+    uint64_t get_fingerprint_index_memory_size() const {
+        return _fingerprints.capacity() * sizeof(KeyFingerprint);
+    }
+
+    // Seek the iterator to the key without sequence column by the fingerprint index.
+    // exact_match is false if the key does not exist, and the iterator is not seeked then.
+    Status seek_by_fingerprint(segment_v2::IndexedColumnIterator* index_iterator,
+                               const Slice& key_without_seq, bool* exact_match) const;
+
 private:
+    struct KeyFingerprint {
+        uint64_t fingerprint;
+        uint32_t ordinal;
+
+        bool operator<(const KeyFingerprint& other) const {
+            return fingerprint < other.fingerprint ||
+                   (fingerprint == other.fingerprint && ordinal < other.ordinal);
+        }
+    };
+
+    static uint64_t _fingerprint(const Slice& key_without_seq);
+
     bool _index_parsed;
     bool _bf_parsed;
     std::unique_ptr<segment_v2::IndexedColumnReader> _index_reader;
     std::unique_ptr<segment_v2::BloomFilter> _bf;
+    // sorted by fingerprint, then ordinal
+    std::vector<KeyFingerprint> _fingerprints;
+    size_t _seq_col_length = 0;
 };
 
 } // namespace doris
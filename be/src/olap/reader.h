@@ -35,6 +35,8 @@
 #include "io/io_common.h"
 #include "olap/delete_handler.h"
 #include "olap/iterators.h"
+#include "olap/key_range_lookup_cache.h"
+#include "olap/late_runtime_filter_predicates.h"
 #include "olap/olap_common.h"
 #include "olap/olap_tuple.h"
 #include "olap/row_cursor.h"
@@ -145,6 +147,13 @@ public:
         bool record_rowids = false;
         // flag for enable topn opt
         bool use_topn_opt = false;
+        // read the merged rows of the base versions from MergedAggBlockCache if the read
+        // has no filter, only for the queries on agg-key tables
+        bool use_merged_agg_block_cache = false;
+        // predicates of the runtime filters arriving after the reader is created
+        std::shared_ptr<LateRuntimeFilterPredicates> late_runtime_filter_predicates;
+        // ordinals of the key range bounds shared by the scanners of a scan node
+        std::shared_ptr<KeyRangeLookupCache> key_range_lookup_cache;
         // used for special optimization for query : ORDER BY key LIMIT n
         bool read_orderby_key = false;
         // used for special optimization for query : ORDER BY key DESC LIMIT n
@@ -153,6 +162,10 @@ public:
         size_t read_orderby_key_num_prefix_columns = 0;
         // limit of rows for read_orderby_key
         size_t read_orderby_key_limit = 0;
+        // The scan returns at most so many rows, 0 is no limit. Only set when the rows read
+        // from a segment are neither merged nor filtered afterwards, so a segment can stop
+        // reading after so many rows, see SegmentIterator::_can_stop_inverted_index_by_limit.
+        size_t read_limit = 0;
         // filter_block arguments
         vectorized::VExprContextSPtrs filter_block_conjuncts;
 
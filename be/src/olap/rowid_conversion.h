@@ -66,6 +66,17 @@ public:
         }
     }
 
+    // map the rows of every source segment to the rows of destination segment in the same
+    // order as is, used when the source segments are linked into the destination rowset
+    void add_linked_segments() {
+        for (uint32_t id = 0; id < _segments_rowid_map.size(); ++id) {
+            auto& rowid_map = _segments_rowid_map[id];
+            for (uint32_t row_id = 0; row_id < rowid_map.size(); ++row_id) {
+                rowid_map[row_id] = std::pair<uint32_t, uint32_t>(id, row_id);
+            }
+        }
+    }
+
     // get destination RowLocation
     // return non-zero if the src RowLocation does not exist
     int get(const RowLocation& src, RowLocation* dst) const {
@@ -35,11 +35,16 @@
 #include "io/fs/local_file_system.h"
 #include "io/fs/path.h"
 #include "io/fs/remote_file_system.h"
+#include "olap/data_dir.h"
 #include "olap/olap_common.h"
 #include "olap/olap_define.h"
 #include "olap/rowset/beta_rowset_reader.h"
 #include "olap/rowset/segment_v2/inverted_index_cache.h"
 #include "olap/rowset/segment_v2/inverted_index_desc.h"
+#include "olap/rowset/segment_v2/segment_footer_meta_manager.h"
+#include "olap/storage_engine.h"
+#include "olap/tablet.h"
+#include "olap/tablet_manager.h"
 #include "olap/tablet_schema.h"
 #include "olap/utils.h"
 #include "util/doris_metrics.h"
@@ -142,6 +147,7 @@ Status BetaRowset::load_segments(int64_t seg_id_begin, int64_t seg_id_end,
     if (!fs || _schema == nullptr) {
         return Status::Error<INIT_FAILED>();
     }
+    auto* footer_meta = _segment_footer_meta();
     int64_t seg_id = seg_id_begin;
     while (seg_id < seg_id_end) {
         DCHECK(seg_id >= 0);
@@ -152,7 +158,7 @@ Status BetaRowset::load_segments(int64_t seg_id_begin, int64_t seg_id_end,
         auto type = config::enable_file_cache ? config::file_cache_type : "";
         io::FileReaderOptions reader_options(io::cache_type_from_string(type), cache_policy);
         auto s = segment_v2::Segment::open(fs, seg_path, seg_id, rowset_id(), _schema,
-                                           reader_options, &segment);
+                                           reader_options, &segment, footer_meta);
         if (!s.ok()) {
             LOG(WARNING) << "failed to open segment. " << seg_path << " under rowset "
                          << unique_id() << " : " << s.to_string();
@@ -200,6 +206,10 @@ Status BetaRowset::remove() {
                     success = false;
                 } else {
                     segment_v2::InvertedIndexSearcherCache::instance()->erase(inverted_index_file);
+                    if (segment_v2::InvertedIndexTermCache::instance() != nullptr) {
+                        segment_v2::InvertedIndexTermCache::instance()->erase(
+                                inverted_index_file);
+                    }
                 }
             }
         }
@@ -212,9 +222,30 @@ Status BetaRowset::remove() {
         LOG(WARNING) << "failed to remove files in rowset " << unique_id();
         return Status::Error<ROWSET_DELETE_FILE_FAILED>();
     }
+    if (auto* footer_meta = _segment_footer_meta(); footer_meta != nullptr) {
+        st = segment_v2::SegmentFooterMetaManager::remove(footer_meta, rowset_id(),
+                                                          num_segments());
+        if (!st.ok()) {
+            LOG(WARNING) << "failed to remove segment footers of rowset " << unique_id() << ": "
+                         << st;
+        }
+    }
     return Status::OK();
 }
 
+OlapMeta* BetaRowset::_segment_footer_meta() const {
+    if (!config::enable_segment_footer_meta_cache || !is_local() ||
+        StorageEngine::instance() == nullptr) {
+        return nullptr;
+    }
+    auto tablet = StorageEngine::instance()->tablet_manager()->get_tablet(
+            _rowset_meta->tablet_id(), true /* include_deleted */);
+    if (tablet == nullptr || tablet->data_dir() == nullptr) {
+        return nullptr;
+    }
+    return tablet->data_dir()->get_meta();
+}
+
 void BetaRowset::do_close() {
     // do nothing.
 }
@@ -261,7 +292,9 @@ Status BetaRowset::link_files_to(const std::string& dir, RowsetId new_rowset_id,
                                                                      index_meta->index_id());
 
                 bool need_to_link = true;
-                if (_schema->skip_write_index_on_load()) {
+                // the index may not be written on load, or be built asynchronously
+                if (_schema->skip_write_index_on_load() ||
+                    config::enable_async_inverted_index_build) {
                     local_fs->exists(inverted_index_src_file_path, &need_to_link);
                     if (!need_to_link) {
                         LOG(INFO) << "skip create hard link to not existed file="
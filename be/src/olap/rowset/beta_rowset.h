@@ -35,6 +35,7 @@
 namespace doris {
 
 class BetaRowset;
+class OlapMeta;
 
 namespace io {
 class RemoteFileSystem;
@@ -110,6 +111,10 @@ protected:
     bool check_current_rowset_segment() override;
 
 private:
+    // Return the meta of the data dir to cache the segment footers, or nullptr if the
+    // footers should not be cached.
+    OlapMeta* _segment_footer_meta() const;
+
     friend class RowsetFactory;
     friend class BetaRowsetReader;
 };
@@ -30,6 +30,7 @@
 
 #include "common/logging.h"
 #include "common/status.h"
+#include "io/fs/io_scheduler.h"
 #include "io/io_common.h"
 #include "olap/block_column_predicate.h"
 #include "olap/column_predicate.h"
@@ -38,11 +39,15 @@
 #include "olap/row_cursor.h"
 #include "olap/rowset/rowset_meta.h"
 #include "olap/rowset/rowset_reader_context.h"
+#include "olap/rowset/segment_v2/column_reader.h"
+#include "olap/rowset/segment_v2/inverted_index_cache.h"
+#include "olap/rowset/segment_v2/inverted_index_desc.h"
 #include "olap/rowset/segment_v2/segment.h"
 #include "olap/schema.h"
 #include "olap/schema_cache.h"
 #include "olap/tablet_meta.h"
 #include "olap/tablet_schema.h"
+#include "olap/wrapper_field.h"
 #include "util/runtime_profile.h"
 #include "vec/core/block.h"
 #include "vec/olap/vgeneric_iterators.h"
@@ -197,12 +202,23 @@ Status BetaRowsetReader::get_segment_iterators(RowsetReaderContext* read_context
     _read_options.tablet_schema = read_context->tablet_schema;
     _read_options.record_rowids = read_context->record_rowids;
     _read_options.use_topn_opt = read_context->use_topn_opt;
+    _read_options.late_runtime_filter_predicates = read_context->late_runtime_filter_predicates;
+    _read_options.key_range_lookup_cache = read_context->key_range_lookup_cache;
     _read_options.read_orderby_key_reverse = read_context->read_orderby_key_reverse;
+    _read_options.read_limit = read_context->read_limit;
     _read_options.read_orderby_key_columns = read_context->read_orderby_key_columns;
     _read_options.io_ctx.reader_type = read_context->reader_type;
     _read_options.io_ctx.file_cache_stats = &read_context->stats->file_cache_stats;
+    _read_options.io_ctx.io_stats = &read_context->stats->io_stats;
     _read_options.runtime_state = read_context->runtime_state;
+    io::IOScheduler::set_workload_group(read_context->runtime_state, &_read_options.io_ctx);
     _read_options.output_columns = read_context->output_columns;
+    _read_options.segment_row_ranges = _segment_row_ranges;
+
+    if (!_match_column_zone_maps()) {
+        _stats->filtered_rowset_number++;
+        return Status::OK();
+    }
 
     // load segments
     // use cache is true when do vertica compaction
@@ -218,6 +234,10 @@ Status BetaRowsetReader::get_segment_iterators(RowsetReaderContext* read_context
         seg_end = segments.size();
     }
 
+    if (read_context->reader_type == ReaderType::READER_QUERY) {
+        _prefetch_index_searchers(segments, seg_start, seg_end);
+    }
+
     for (int i = seg_start; i < seg_end; i++) {
         auto& seg_ptr = segments[i];
         std::unique_ptr<RowwiseIterator> iter;
@@ -235,6 +255,42 @@ Status BetaRowsetReader::get_segment_iterators(RowsetReaderContext* read_context
     return Status::OK();
 }
 
+bool BetaRowsetReader::_match_column_zone_maps() const {
+    const auto& column_zone_maps = _rowset->rowset_meta()->column_zone_maps();
+    if (column_zone_maps.empty()) {
+        return true;
+    }
+    const auto& rowset_schema = _rowset->tablet_schema();
+    for (const auto& [column_id, predicates] : _read_options.col_id_to_predicates) {
+        // the same as the segment level zone maps, see Segment::new_iterator
+        if (_read_options.tablet_schema->num_columns() <= column_id) {
+            continue;
+        }
+        int32_t uid = _read_options.tablet_schema->column(column_id).unique_id();
+        auto column_zone_map = std::find_if(
+                column_zone_maps.begin(), column_zone_maps.end(),
+                [uid](const ColumnZoneMapPB& zone_map) { return zone_map.unique_id() == uid; });
+        int32_t index = rowset_schema->field_index(uid);
+        if (column_zone_map == column_zone_maps.end() || index < 0) {
+            continue;
+        }
+        const auto& column = rowset_schema->column(index);
+        std::unique_ptr<WrapperField> min_value(
+                WrapperField::create_by_type(column.type(), column.length()));
+        std::unique_ptr<WrapperField> max_value(
+                WrapperField::create_by_type(column.type(), column.length()));
+        if (min_value == nullptr || max_value == nullptr) {
+            continue;
+        }
+        if (!segment_v2::ColumnReader::match_zone_map(column_zone_map->zone_map(),
+                                                      min_value.get(), max_value.get(),
+                                                      predicates.get())) {
+            return false;
+        }
+    }
+    return true;
+}
+
 Status BetaRowsetReader::init(RowsetReaderContext* read_context,
                               const std::pair<int, int>& segment_offset) {
     _context = read_context;
@@ -307,6 +363,35 @@ Status BetaRowsetReader::next_block_view(vectorized::BlockView* block_view) {
     return Status::OK();
 }
 
+void BetaRowsetReader::_prefetch_index_searchers(
+        const std::vector<segment_v2::SegmentSharedPtr>& segments, int seg_start, int seg_end) {
+    std::set<int64_t> index_ids;
+    for (auto pred : _read_options.column_predicates) {
+        if (pred->type() != PredicateType::MATCH) {
+            continue;
+        }
+        const auto& column = _read_options.tablet_schema->column(pred->column_id());
+        const TabletIndex* index_meta =
+                _read_options.tablet_schema->get_inverted_index(column.unique_id());
+        if (index_meta != nullptr) {
+            index_ids.insert(index_meta->index_id());
+        }
+    }
+    if (index_ids.empty() || seg_end - seg_start < 2) {
+        return;
+    }
+    std::vector<std::string> index_file_paths;
+    for (int i = seg_start; i < seg_end; i++) {
+        auto segment_path = _rowset->segment_file_path(segments[i]->id());
+        for (auto index_id : index_ids) {
+            index_file_paths.push_back(segment_v2::InvertedIndexDescriptor::get_index_file_name(
+                    segment_path, index_id));
+        }
+    }
+    segment_v2::InvertedIndexSearcherCache::instance()->prefetch_index_searchers(
+            _rowset->rowset_meta()->fs(), index_file_paths);
+}
+
 bool BetaRowsetReader::_should_push_down_value_predicates() const {
     // if unique table with rowset [0-x] or [0-1] [2-y] [...],
     // value column predicates can be pushdown on rowset [0-x] or [2-y], [2-y]
@@ -21,6 +21,7 @@
 #include <stdint.h>
 
 #include <memory>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -54,6 +55,10 @@ public:
                                  const std::pair<int, int>& segment_offset,
                                  bool use_cache = false) override;
     void reset_read_options() override;
+    void set_segment_row_ranges(std::unordered_map<uint32_t, std::pair<uint32_t, uint32_t>>
+                                        segment_row_ranges) override {
+        _segment_row_ranges = std::move(segment_row_ranges);
+    }
     Status next_block(vectorized::Block* block) override;
     Status next_block_view(vectorized::BlockView* block_view) override;
     bool support_return_data_by_ref() override { return _iterator->support_return_data_by_ref(); }
@@ -88,6 +93,15 @@ public:
 private:
     bool _should_push_down_value_predicates() const;
 
+    // Return false if the rowset level zone maps show that no row matches the predicates, then
+    // the segments need not be loaded.
+    bool _match_column_zone_maps() const;
+
+    // open the index searchers of the fulltext match predicates for all segments in parallel,
+    // instead of one by one when the segment iterators are initialized
+    void _prefetch_index_searchers(const std::vector<segment_v2::SegmentSharedPtr>& segments,
+                                   int seg_start, int seg_end);
+
     SchemaSPtr _input_schema;
     RowsetReaderContext* _context;
     BetaRowsetSharedPtr _rowset;
@@ -102,6 +116,7 @@ private:
     SegmentCacheHandle _segment_cache_handle;
 
     StorageReadOptions _read_options;
+    std::unordered_map<uint32_t, std::pair<uint32_t, uint32_t>> _segment_row_ranges;
 
     bool _empty = false;
 };
@@ -49,6 +49,7 @@
 #include "olap/storage_engine.h"
 #include "olap/tablet.h"
 #include "olap/tablet_schema.h"
+#include "olap/wrapper_field.h"
 #include "segcompaction.h"
 #include "util/slice.h"
 #include "util/time.h"
@@ -295,6 +296,10 @@ Status BetaRowsetWriter::_rename_compacted_indices(int64_t begin, int64_t end, u
     int ret;
     // rename remaining inverted index files
     for (auto column : _context.tablet_schema->columns()) {
+        // the index is not written, see config::enable_async_inverted_index_build
+        if (_context.skip_inverted_index.count(column.unique_id()) > 0) {
+            continue;
+        }
         if (_context.tablet_schema->has_inverted_index(column.unique_id())) {
             auto index_id =
                     _context.tablet_schema->get_inverted_index(column.unique_id())->index_id();
@@ -464,7 +469,14 @@ Status BetaRowsetWriter::add_rowset(RowsetSharedPtr rowset) {
     _next_segment_id = _num_segment.load();
     // append key_bounds to current rowset
     rowset->get_segments_key_bounds(&_segments_encoded_key_bounds);
-    // TODO update zonemap
+    if (rowset->num_rows() > 0) {
+        const auto& column_zone_maps = rowset->rowset_meta()->column_zone_maps();
+        if (column_zone_maps.empty()) {
+            _column_zone_maps_unknown = true;
+        } else {
+            _column_zone_maps.emplace_back(column_zone_maps.begin(), column_zone_maps.end());
+        }
+    }
     if (rowset->rowset_meta()->has_delete_predicate()) {
         _rowset_meta->set_delete_predicate(rowset->rowset_meta()->delete_predicate());
     }
@@ -472,8 +484,12 @@ Status BetaRowsetWriter::add_rowset(RowsetSharedPtr rowset) {
 }
 
 Status BetaRowsetWriter::add_rowset_for_linked_schema_change(RowsetSharedPtr rowset) {
+    RETURN_IF_ERROR(add_rowset(rowset));
+    // the zone maps are parsed with the rowset schema, which may differ from the one the
+    // segments are written with
     // TODO use schema_mapping to transfer zonemap
-    return add_rowset(rowset);
+    _column_zone_maps_unknown = true;
+    return Status::OK();
 }
 
 Status BetaRowsetWriter::flush() {
@@ -624,7 +640,8 @@ void BetaRowsetWriter::_build_rowset_meta_with_spec_field(
     rowset_meta->set_total_disk_size(spec_rowset_meta->total_disk_size());
     rowset_meta->set_data_disk_size(spec_rowset_meta->total_disk_size());
     rowset_meta->set_index_disk_size(spec_rowset_meta->index_disk_size());
-    // TODO write zonemap to meta
+    const auto& column_zone_maps = spec_rowset_meta->column_zone_maps();
+    rowset_meta->set_column_zone_maps({column_zone_maps.begin(), column_zone_maps.end()});
     rowset_meta->set_empty(spec_rowset_meta->num_rows() == 0);
     rowset_meta->set_creation_time(time(nullptr));
     rowset_meta->set_num_segments(spec_rowset_meta->num_segments());
@@ -636,19 +653,104 @@ void BetaRowsetWriter::_build_rowset_meta_with_spec_field(
     rowset_meta->set_segments_key_bounds(segments_key_bounds);
 }
 
+void BetaRowsetWriter::_merge_column_zone_maps(
+        const std::vector<const std::vector<ColumnZoneMapPB>*>& inputs,
+        std::vector<ColumnZoneMapPB>* column_zone_maps) {
+    if (inputs.empty()) {
+        return;
+    }
+    // only the columns having a zone map in every input are kept
+    std::map<int32_t, ColumnZoneMapPB> merged;
+    for (const auto& column_zone_map : *inputs[0]) {
+        merged.emplace(column_zone_map.unique_id(), column_zone_map);
+    }
+    for (size_t i = 1; i < inputs.size() && !merged.empty(); ++i) {
+        std::map<int32_t, const segment_v2::ZoneMapPB*> zone_maps;
+        for (const auto& column_zone_map : *inputs[i]) {
+            zone_maps.emplace(column_zone_map.unique_id(), &column_zone_map.zone_map());
+        }
+        for (auto it = merged.begin(); it != merged.end();) {
+            auto zone_map = zone_maps.find(it->first);
+            if (zone_map == zone_maps.end() ||
+                !_merge_zone_map(it->first, *zone_map->second, it->second.mutable_zone_map())) {
+                it = merged.erase(it);
+            } else {
+                ++it;
+            }
+        }
+    }
+    for (auto& [_, column_zone_map] : merged) {
+        column_zone_maps->push_back(std::move(column_zone_map));
+    }
+}
+
+bool BetaRowsetWriter::_merge_zone_map(int32_t unique_id, const segment_v2::ZoneMapPB& src,
+                                       segment_v2::ZoneMapPB* dst) {
+    dst->set_has_null(dst->has_null() || src.has_null());
+    if (dst->pass_all() || src.pass_all()) {
+        dst->set_pass_all(true);
+        dst->set_min("");
+        dst->set_max("");
+        dst->set_has_not_null(dst->has_not_null() || src.has_not_null());
+        return true;
+    }
+    if (!src.has_not_null()) {
+        return true;
+    }
+    if (!dst->has_not_null()) {
+        dst->set_min(src.min());
+        dst->set_max(src.max());
+        dst->set_has_not_null(true);
+        return true;
+    }
+    int32_t index = _context.tablet_schema->field_index(unique_id);
+    if (index < 0) {
+        return false;
+    }
+    // the values are compared the same way as the zone maps are read, see ColumnReader
+    const auto& column = _context.tablet_schema->column(index);
+    std::unique_ptr<WrapperField> src_value(
+            WrapperField::create_by_type(column.type(), column.length()));
+    std::unique_ptr<WrapperField> dst_value(
+            WrapperField::create_by_type(column.type(), column.length()));
+    if (src_value == nullptr || dst_value == nullptr ||
+        !src_value->from_string(src.min()).ok() || !dst_value->from_string(dst->min()).ok()) {
+        return false;
+    }
+    if (src_value->cmp(dst_value.get()) < 0) {
+        dst->set_min(src.min());
+    }
+    if (!src_value->from_string(src.max()).ok() || !dst_value->from_string(dst->max()).ok()) {
+        return false;
+    }
+    if (src_value->cmp(dst_value.get()) > 0) {
+        dst->set_max(src.max());
+    }
+    return true;
+}
+
 void BetaRowsetWriter::_build_rowset_meta(std::shared_ptr<RowsetMeta> rowset_meta) {
     int64_t num_seg = _is_segcompacted() ? _num_segcompacted : _num_segment;
     int64_t num_rows_written = 0;
     int64_t total_data_size = 0;
     int64_t total_index_size = 0;
     std::vector<KeyBoundsPB> segments_encoded_key_bounds;
+    std::vector<ColumnZoneMapPB> column_zone_maps;
     {
         std::lock_guard<std::mutex> lock(_segid_statistics_map_mutex);
+        std::vector<const std::vector<ColumnZoneMapPB>*> segments_column_zone_maps;
         for (const auto& itr : _segid_statistics_map) {
             num_rows_written += itr.second.row_num;
             total_data_size += itr.second.data_size;
             total_index_size += itr.second.index_size;
             segments_encoded_key_bounds.push_back(itr.second.key_bounds);
+            segments_column_zone_maps.push_back(&itr.second.column_zone_maps);
+        }
+        for (const auto& zone_maps : _column_zone_maps) {
+            segments_column_zone_maps.push_back(&zone_maps);
+        }
+        if (!_column_zone_maps_unknown) {
+            _merge_column_zone_maps(segments_column_zone_maps, &column_zone_maps);
         }
     }
     for (auto itr = _segments_encoded_key_bounds.begin(); itr != _segments_encoded_key_bounds.end();
@@ -666,7 +768,7 @@ void BetaRowsetWriter::_build_rowset_meta(std::shared_ptr<RowsetMeta> rowset_met
     rowset_meta->set_data_disk_size(total_data_size + _total_data_size);
     rowset_meta->set_index_disk_size(total_index_size + _total_index_size);
     rowset_meta->set_segments_key_bounds(segments_encoded_key_bounds);
-    // TODO write zonemap to meta
+    rowset_meta->set_column_zone_maps(column_zone_maps);
     rowset_meta->set_empty((num_rows_written + _num_rows_written) == 0);
     rowset_meta->set_creation_time(time(nullptr));
 
@@ -805,10 +907,11 @@ Status BetaRowsetWriter::_flush_segment_writer(std::unique_ptr<segment_v2::Segme
     segstat.data_size = segment_size;
     segstat.index_size = index_size;
     segstat.key_bounds = key_bounds;
+    (*writer)->get_column_zone_maps(&segstat.column_zone_maps);
     {
         std::lock_guard<std::mutex> lock(_segid_statistics_map_mutex);
         CHECK_EQ(_segid_statistics_map.find(segid) == _segid_statistics_map.end(), true);
-        _segid_statistics_map.emplace(segid, segstat);
+        _segid_statistics_map.emplace(segid, std::move(segstat));
         _segment_num_rows.resize(_next_segment_id);
         _segment_num_rows[segid_offset] = row_num;
     }
@@ -847,10 +950,11 @@ Status BetaRowsetWriter::flush_segment_writer_for_segcompaction(
     segstat.data_size = segment_size;
     segstat.index_size = index_size;
     segstat.key_bounds = key_bounds;
+    (*writer)->get_column_zone_maps(&segstat.column_zone_maps);
     {
         std::lock_guard<std::mutex> lock(_segid_statistics_map_mutex);
         CHECK_EQ(_segid_statistics_map.find(segid) == _segid_statistics_map.end(), true);
-        _segid_statistics_map.emplace(segid, segstat);
+        _segid_statistics_map.emplace(segid, std::move(segstat));
     }
     VLOG_DEBUG << "_segid_statistics_map add new record. segid:" << segid << " row_num:" << row_num
                << " data_size:" << segment_size << " index_size:" << index_size;
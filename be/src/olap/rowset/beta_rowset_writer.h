@@ -19,6 +19,7 @@
 
 #include <fmt/format.h>
 #include <gen_cpp/olap_file.pb.h>
+#include <gen_cpp/segment_v2.pb.h>
 #include <stddef.h>
 #include <stdint.h>
 
@@ -152,6 +153,11 @@ private:
     void _build_rowset_meta_with_spec_field(RowsetMetaSharedPtr rowset_meta,
                                             const RowsetMetaSharedPtr& spec_rowset_meta);
     bool _is_segment_overlapping(const std::vector<KeyBoundsPB>& segments_encoded_key_bounds);
+    void _merge_column_zone_maps(const std::vector<const std::vector<ColumnZoneMapPB>*>& inputs,
+                                 std::vector<ColumnZoneMapPB>* column_zone_maps);
+    // Return false if the zone maps of the column can not be merged.
+    bool _merge_zone_map(int32_t unique_id, const segment_v2::ZoneMapPB& src,
+                         segment_v2::ZoneMapPB* dst);
     void _clear_statistics_for_deleting_segments_unsafe(uint64_t begin, uint64_t end);
     Status _rename_compacted_segments(int64_t begin, int64_t end);
     Status _rename_compacted_segment_plain(uint64_t seg_id);
@@ -189,7 +195,11 @@ protected:
     std::atomic<int64_t> _num_rows_written;
     std::atomic<int64_t> _total_data_size;
     std::atomic<int64_t> _total_index_size;
-    // TODO rowset Zonemap
+    // column zone maps of the rowsets added by add_rowset or the segments of the vertical
+    // writer, the ones of the other segments are in _segid_statistics_map
+    std::vector<std::vector<ColumnZoneMapPB>> _column_zone_maps;
+    // an added rowset has no zone maps, so the rowset level ones are unknown
+    bool _column_zone_maps_unknown = false;
 
     // written rows by add_block/add_row (not effected by segcompaction)
     std::atomic<int64_t> _raw_num_rows_written;
@@ -199,6 +209,7 @@ protected:
         int64_t data_size;
         int64_t index_size;
         KeyBoundsPB key_bounds;
+        std::vector<ColumnZoneMapPB> column_zone_maps;
     };
     std::map<uint32_t, Statistics> _segid_statistics_map;
     std::mutex _segid_statistics_map_mutex;
@@ -350,6 +350,18 @@ public:
         set_segments_overlap(OVERLAPPING);
     }
 
+    // empty for the rowsets written before the rowset level zone maps
+    const google::protobuf::RepeatedPtrField<ColumnZoneMapPB>& column_zone_maps() const {
+        return _rowset_meta_pb.column_zone_maps();
+    }
+
+    void set_column_zone_maps(const std::vector<ColumnZoneMapPB>& column_zone_maps) {
+        _rowset_meta_pb.clear_column_zone_maps();
+        for (const auto& column_zone_map : column_zone_maps) {
+            *_rowset_meta_pb.add_column_zone_maps() = column_zone_map;
+        }
+    }
+
     void set_newest_write_timestamp(int64_t timestamp) {
         _rowset_meta_pb.set_newest_write_timestamp(timestamp);
     }
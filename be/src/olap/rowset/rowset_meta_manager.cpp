@@ -112,7 +112,7 @@ Status RowsetMetaManager::save(OlapMeta* meta, TabletUid tablet_uid, const Rowse
         return Status::Error<SERIALIZE_PROTOBUF_ERROR>();
     }
 
-    return meta->put(META_COLUMN_FAMILY_INDEX, key, value);
+    return meta->group_put(META_COLUMN_FAMILY_INDEX, {{key, value}});
 }
 
 Status RowsetMetaManager::_save_with_binlog(OlapMeta* meta, TabletUid tablet_uid,
@@ -158,7 +158,7 @@ Status RowsetMetaManager::_save_with_binlog(OlapMeta* meta, TabletUid tablet_uid
             {std::cref(binlog_meta_key), std::cref(binlog_meta_value)},
             {std::cref(binlog_data_key), std::cref(rowset_value)}};
 
-    return meta->put(META_COLUMN_FAMILY_INDEX, entries);
+    return meta->group_put(META_COLUMN_FAMILY_INDEX, entries);
 }
 
 std::vector<std::string> RowsetMetaManager::get_binlog_filenames(OlapMeta* meta,
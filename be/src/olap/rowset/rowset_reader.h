@@ -51,6 +51,11 @@ public:
                                          bool use_cache = false) = 0;
     virtual void reset_read_options() = 0;
 
+    // Only read the rows in the ranges of the segments, should be called before init(),
+    // see StorageReadOptions::segment_row_ranges.
+    virtual void set_segment_row_ranges(
+            std::unordered_map<uint32_t, std::pair<uint32_t, uint32_t>> segment_row_ranges) = 0;
+
     virtual Status next_block(vectorized::Block* block) = 0;
 
     virtual Status next_block_view(vectorized::BlockView* block_view) = 0;
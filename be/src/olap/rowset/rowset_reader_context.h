@@ -20,6 +20,8 @@
 
 #include "io/io_common.h"
 #include "olap/column_predicate.h"
+#include "olap/key_range_lookup_cache.h"
+#include "olap/late_runtime_filter_predicates.h"
 #include "olap/olap_common.h"
 #include "runtime/runtime_state.h"
 #include "vec/exprs/vexpr.h"
@@ -38,6 +40,9 @@ struct RowsetReaderContext {
     TabletSchemaSPtr tablet_schema = nullptr;
     // flag for enable topn opt
     bool use_topn_opt = false;
+    // predicates of the runtime filters arriving after the reader is created
+    std::shared_ptr<LateRuntimeFilterPredicates> late_runtime_filter_predicates;
+    std::shared_ptr<KeyRangeLookupCache> key_range_lookup_cache;
     // whether rowset should return ordered rows.
     bool need_ordered_result = true;
     // used for special optimization for query : ORDER BY key DESC LIMIT n
@@ -46,6 +51,8 @@ struct RowsetReaderContext {
     std::vector<uint32_t>* read_orderby_key_columns = nullptr;
     // limit of rows for read_orderby_key
     size_t read_orderby_key_limit = 0;
+    // see TabletReader::ReaderParams::read_limit
+    size_t read_limit = 0;
     // filter_block arguments
     vectorized::VExprContextSPtrs filter_block_conjuncts;
     // projection columns: the set of columns rowset reader should return
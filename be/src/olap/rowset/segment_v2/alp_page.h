@@ -0,0 +1,281 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+#include <vector>
+
+#include "common/status.h"
+#include "olap/rowset/segment_v2/decoded_page_decoder.h"
+#include "olap/rowset/segment_v2/delta_of_delta_page.h" // for zigzag_encode/zigzag_decode
+#include "olap/rowset/segment_v2/options.h"
+#include "olap/rowset/segment_v2/page_builder.h"
+#include "olap/types.h"
+#include "util/coding.h"
+#include "util/faststring.h"
+#include "util/frame_of_reference_coding.h"
+#include "util/slice.h"
+
+namespace doris {
+namespace segment_v2 {
+
+template <typename T>
+struct AlpTraits {
+    static constexpr uint8_t MAX_EXPONENT = std::is_same_v<T, float> ? 10 : 18;
+    // exponent of a page whose values are stored as is
+    static constexpr uint8_t RAW_EXPONENT = 0xFF;
+    // number of values used to choose the exponent of a page
+    static constexpr size_t SAMPLE_SIZE = 64;
+
+    static double pow10(uint8_t exponent) {
+        static const double POW10[] = {1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,
+                                       1e7,  1e8,  1e9,  1e10, 1e11, 1e12, 1e13,
+                                       1e14, 1e15, 1e16, 1e17, 1e18};
+        return POW10[exponent];
+    }
+
+    // Decoder and encoder must share the exact same expression to be lossless.
+    static T decode(int64_t encoded, uint8_t exponent) {
+        return static_cast<T>(static_cast<double>(encoded) / pow10(exponent));
+    }
+
+    // Return false if the value can not be restored bit by bit from an integer with the
+    // exponent, e.g. NaN, infinity, -0.0 or the value has too many significant digits.
+    static bool encode(T value, uint8_t exponent, int64_t* encoded) {
+        double scaled = static_cast<double>(value) * pow10(exponent);
+        // 2^62, leave room for the zigzag encoding
+        if (!(std::abs(scaled) < 4611686018427387904.0)) {
+            return false;
+        }
+        *encoded = static_cast<int64_t>(std::round(scaled));
+        T restored = decode(*encoded, exponent);
+        return memcmp(&restored, &value, sizeof(T)) == 0;
+    }
+};
+
+// Adaptive lossless floating point encoding, in the spirit of ALP. Most floating
+// point values in practice are decimals with a few digits, e.g. prices or sensor readings,
+// so value * 10^e is an integer for a small e and can be packed by frame-of-reference coding.
+// The exponent is chosen per page by sampling. The values which can not be restored from
+// an integer are stored as exceptions, and the page falls back to store all values as is
+// when there are too many exceptions.
+//
+// The page layout is:
+//   NumValues(4) | Exponent(1) | RawValues(NumValues * sizeof(CppType))      if raw page
+//   NumValues(4) | Exponent(1) | NumExceptions(4) | ExceptionPositions(NumExceptions * 4) |
+//       ExceptionValues(NumExceptions * sizeof(CppType)) | ForEncoded(zigzag(encoded))
+template <FieldType Type>
+class AlpPageBuilder : public PageBuilder {
+public:
+    using CppType = typename TypeTraits<Type>::CppType;
+    using Traits = AlpTraits<CppType>;
+    static_assert(std::is_floating_point_v<CppType>, "alp encoding only supports float types");
+
+    explicit AlpPageBuilder(const PageBuilderOptions& options)
+            : _options(options), _finished(false) {}
+
+    bool is_page_full() override {
+        return _values.size() * sizeof(CppType) >= _options.data_page_size;
+    }
+
+    Status add(const uint8_t* vals, size_t* count) override {
+        DCHECK(!_finished);
+        auto new_vals = reinterpret_cast<const CppType*>(vals);
+        _values.insert(_values.end(), new_vals, new_vals + *count);
+        return Status::OK();
+    }
+
+    OwnedSlice finish() override {
+        DCHECK(!_finished);
+        _finished = true;
+        _buf.clear();
+        uint32_t num_values = static_cast<uint32_t>(_values.size());
+        put_fixed32_le(&_buf, num_values);
+        if (num_values == 0) {
+            return _buf.build();
+        }
+
+        uint8_t exponent = _choose_exponent();
+        std::vector<uint64_t> encoded_values(num_values);
+        std::vector<uint32_t> exception_positions;
+        std::vector<CppType> exception_values;
+        if (exponent != Traits::RAW_EXPONENT) {
+            int64_t last_encoded = 0;
+            for (uint32_t i = 0; i < num_values; ++i) {
+                int64_t encoded = 0;
+                if (Traits::encode(_values[i], exponent, &encoded)) {
+                    last_encoded = encoded;
+                } else {
+                    // fill the hole with the last value to keep the frame range narrow
+                    exception_positions.push_back(i);
+                    exception_values.push_back(_values[i]);
+                }
+                encoded_values[i] = zigzag_encode(static_cast<uint64_t>(last_encoded));
+            }
+            // an exception costs more than a raw value
+            if (exception_positions.size() * 4 > num_values) {
+                exponent = Traits::RAW_EXPONENT;
+            }
+        }
+
+        _buf.push_back(exponent);
+        if (exponent == Traits::RAW_EXPONENT) {
+            _buf.append(_values.data(), num_values * sizeof(CppType));
+            return _buf.build();
+        }
+        put_fixed32_le(&_buf, static_cast<uint32_t>(exception_positions.size()));
+        _buf.append(exception_positions.data(), exception_positions.size() * sizeof(uint32_t));
+        _buf.append(exception_values.data(), exception_values.size() * sizeof(CppType));
+        ForEncoder<uint64_t> encoder(&_buf);
+        encoder.put_batch(encoded_values.data(), encoded_values.size());
+        encoder.flush();
+        return _buf.build();
+    }
+
+    void reset() override {
+        _values.clear();
+        _buf.clear();
+        _finished = false;
+    }
+
+    size_t count() const override { return _values.size(); }
+
+    uint64_t size() const override {
+        return _finished ? _buf.size() : _values.size() * sizeof(CppType);
+    }
+
+    Status get_first_value(void* value) const override {
+        if (_values.empty()) {
+            return Status::NotFound("page is empty");
+        }
+        memcpy(value, &_values.front(), sizeof(CppType));
+        return Status::OK();
+    }
+
+    Status get_last_value(void* value) const override {
+        if (_values.empty()) {
+            return Status::NotFound("page is empty");
+        }
+        memcpy(value, &_values.back(), sizeof(CppType));
+        return Status::OK();
+    }
+
+private:
+    // Choose the smallest exponent which restores the most sampled values.
+    uint8_t _choose_exponent() const {
+        size_t step = std::max<size_t>(1, _values.size() / Traits::SAMPLE_SIZE);
+        size_t best_count = 0;
+        uint8_t best_exponent = Traits::RAW_EXPONENT;
+        for (uint8_t e = 0; e <= Traits::MAX_EXPONENT; ++e) {
+            size_t count = 0;
+            int64_t encoded = 0;
+            for (size_t i = 0; i < _values.size(); i += step) {
+                count += Traits::encode(_values[i], e, &encoded);
+            }
+            if (count > best_count) {
+                best_count = count;
+                best_exponent = e;
+            }
+        }
+        return best_exponent;
+    }
+
+    PageBuilderOptions _options;
+    bool _finished;
+    std::vector<CppType> _values;
+    faststring _buf;
+};
+
+template <FieldType Type>
+class AlpPageDecoder : public DecodedPageDecoder<Type> {
+public:
+    using CppType = typename TypeTraits<Type>::CppType;
+    using Traits = AlpTraits<CppType>;
+
+    AlpPageDecoder(Slice slice, const PageDecoderOptions& options)
+            : DecodedPageDecoder<Type>(slice, options) {}
+
+protected:
+    Status _decode_values() override {
+        const uint8_t* data = (const uint8_t*)this->_data.data;
+        size_t size = this->_data.size;
+        auto& values = this->_values;
+        if (size < sizeof(uint32_t)) {
+            return Status::Corruption("alp page is too small, size={}", size);
+        }
+        uint32_t num_values = decode_fixed32_le(data);
+        if (num_values == 0) {
+            return Status::OK();
+        }
+        if (size < sizeof(uint32_t) + 1) {
+            return Status::Corruption("alp page is too small, size={}", size);
+        }
+        uint8_t exponent = data[sizeof(uint32_t)];
+        size_t offset = sizeof(uint32_t) + 1;
+        values.resize(num_values);
+        if (exponent == Traits::RAW_EXPONENT) {
+            if (size != offset + num_values * sizeof(CppType)) {
+                return Status::Corruption("alp page size {} mismatch with {} values", size,
+                                          num_values);
+            }
+            memcpy(values.data(), data + offset, num_values * sizeof(CppType));
+            return Status::OK();
+        }
+        if (exponent > Traits::MAX_EXPONENT || size < offset + sizeof(uint32_t)) {
+            return Status::Corruption("the alp page metadata maybe broken");
+        }
+        uint32_t num_exceptions = decode_fixed32_le(data + offset);
+        offset += sizeof(uint32_t);
+        size_t exceptions_size = num_exceptions * (sizeof(uint32_t) + sizeof(CppType));
+        if (num_exceptions > num_values || size < offset + exceptions_size) {
+            return Status::Corruption("the alp page metadata maybe broken");
+        }
+        const uint8_t* exception_positions = data + offset;
+        const uint8_t* exception_values = exception_positions + num_exceptions * sizeof(uint32_t);
+        offset += exceptions_size;
+
+        ForDecoder<uint64_t> decoder(data + offset, size - offset);
+        if (!decoder.init() || decoder.count() != num_values) {
+            return Status::Corruption("the alp page metadata maybe broken");
+        }
+        std::vector<uint64_t> encoded_values(num_values);
+        if (!decoder.get_batch(encoded_values.data(), num_values)) {
+            return Status::Corruption("failed to decode alp page");
+        }
+        for (uint32_t i = 0; i < num_values; ++i) {
+            values[i] = Traits::decode(static_cast<int64_t>(zigzag_decode(encoded_values[i])),
+                                       exponent);
+        }
+        for (uint32_t i = 0; i < num_exceptions; ++i) {
+            uint32_t pos = 0;
+            memcpy(&pos, exception_positions + i * sizeof(uint32_t), sizeof(uint32_t));
+            if (pos >= num_values) {
+                return Status::Corruption("invalid exception position {} in alp page", pos);
+            }
+            memcpy(&values[pos], exception_values + i * sizeof(CppType), sizeof(CppType));
+        }
+        return Status::OK();
+    }
+};
+
+} // namespace segment_v2
+} // namespace doris
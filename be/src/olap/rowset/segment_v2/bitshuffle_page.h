@@ -40,6 +40,7 @@
 #include "util/faststring.h"
 #include "util/slice.h"
 #include "vec/columns/column.h"
+#include "vec/columns/column_borrowed_vector.h"
 #include "vec/data_types/data_type.h"
 
 namespace doris {
@@ -366,6 +367,29 @@ public:
         return Status::OK();
     }
 
+    Status borrow_batch(size_t* n, const std::shared_ptr<const void>& owner,
+                        vectorized::ColumnPtr* dst) override {
+        DCHECK(_parsed);
+        if constexpr (Type == FieldType::OLAP_FIELD_TYPE_TINYINT ||
+                      Type == FieldType::OLAP_FIELD_TYPE_SMALLINT ||
+                      Type == FieldType::OLAP_FIELD_TYPE_INT ||
+                      Type == FieldType::OLAP_FIELD_TYPE_BIGINT ||
+                      Type == FieldType::OLAP_FIELD_TYPE_LARGEINT ||
+                      Type == FieldType::OLAP_FIELD_TYPE_FLOAT ||
+                      Type == FieldType::OLAP_FIELD_TYPE_DOUBLE ||
+                      Type == FieldType::OLAP_FIELD_TYPE_DATEV2 ||
+                      Type == FieldType::OLAP_FIELD_TYPE_DATETIMEV2) {
+            size_t max_fetch = std::min(*n, static_cast<size_t>(_num_elements - _cur_index));
+            *dst = vectorized::ColumnBorrowedVector<CppType>::create(
+                    reinterpret_cast<const CppType*>(get_data(_cur_index)), max_fetch, owner);
+            *n = max_fetch;
+            _cur_index += max_fetch;
+            return Status::OK();
+        } else {
+            return Status::NotSupported("borrow_batch is not supported by type {}", Type);
+        }
+    }
+
     template <bool forward_index = true>
     Status next_batch(size_t* n, vectorized::MutableColumnPtr& dst) {
         DCHECK(_parsed);
@@ -398,18 +422,28 @@ public:
         }
 
         auto total = *n;
-        auto read_count = 0;
-        CppType data[total];
-        for (size_t i = 0; i < total; ++i) {
-            ordinal_t ord = rowids[i] - page_first_ordinal;
-            if (UNLIKELY(ord >= _num_elements)) {
-                break;
-            }
-
-            data[read_count++] = *reinterpret_cast<CppType*>(get_data(ord));
+        size_t read_count = 0;
+        // rowids are ascending, stop at the first one out of this page
+        while (read_count < total && rowids[read_count] - page_first_ordinal < _num_elements) {
+            ++read_count;
+        }
+        if (UNLIKELY(read_count == 0)) {
+            *n = 0;
+            return Status::OK();
         }
 
-        if (LIKELY(read_count > 0)) dst->insert_many_fix_len_data((const char*)data, read_count);
+        auto gather = [&](CppType* values) {
+            for (size_t i = 0; i < read_count; ++i) {
+                values[i] = *reinterpret_cast<CppType*>(get_data(rowids[i] - page_first_ordinal));
+            }
+        };
+        if (CppType* values = append_raw_fix_len_data<CppType>(dst, read_count)) {
+            gather(values);
+        } else {
+            CppType data[read_count];
+            gather(data);
+            dst->insert_many_fix_len_data((const char*)data, read_count);
+        }
 
         *n = read_count;
         return Status::OK();
@@ -19,6 +19,10 @@
 
 #include <glog/logging.h>
 
+#ifdef __AVX2__
+#include <immintrin.h>
+#endif
+
 namespace doris {
 namespace segment_v2 {
 
@@ -60,5 +64,29 @@ bool BlockSplitBloomFilter::test_hash(uint64_t hash) const {
     return true;
 }
 
+bool BlockSplitBloomFilter::test_any_hash(const uint64_t* hashes, size_t num_hashes) const {
+#ifdef __AVX2__
+    const uint32_t bucket_mask = _num_bytes / BYTES_PER_BLOCK - 1;
+    const __m256i salt = _mm256_setr_epi32(SALT[0], SALT[1], SALT[2], SALT[3], SALT[4], SALT[5],
+                                           SALT[6], SALT[7]);
+    const __m256i ones = _mm256_set1_epi32(1);
+    const __m256i* buckets = reinterpret_cast<const __m256i*>(_data);
+    for (size_t i = 0; i < num_hashes; ++i) {
+        const uint32_t bucket_index = static_cast<uint32_t>(hashes[i] >> 32) & bucket_mask;
+        // the same masks as _set_masks
+        const __m256i key = _mm256_set1_epi32(static_cast<uint32_t>(hashes[i]));
+        __m256i mask = _mm256_mullo_epi32(key, salt);
+        mask = _mm256_sllv_epi32(ones, _mm256_srli_epi32(mask, 27));
+        // all bits of the masks are set in the block
+        if (_mm256_testc_si256(_mm256_loadu_si256(buckets + bucket_index), mask)) {
+            return true;
+        }
+    }
+    return false;
+#else
+    return BloomFilter::test_any_hash(hashes, num_hashes);
+#endif
+}
+
 } // namespace segment_v2
 } // namespace doris
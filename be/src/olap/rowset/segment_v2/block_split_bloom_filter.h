@@ -17,6 +17,7 @@
 
 #pragma once
 
+#include <stddef.h>
 #include <stdint.h>
 
 #include "olap/rowset/segment_v2/bloom_filter.h"
@@ -34,6 +35,8 @@ public:
     void add_hash(uint64_t hash) override;
 
     bool test_hash(uint64_t hash) const override;
+    // Test a whole tiny Bloom filter block for each hash by AVX2 if available.
+    bool test_any_hash(const uint64_t* hashes, size_t num_hashes) const override;
     bool contains(const BloomFilter&) const override { return true; }
 
 private:
@@ -20,6 +20,7 @@
 #include <gen_cpp/segment_v2.pb.h>
 #include <glog/logging.h>
 
+#include "io/fs/file_reader.h"
 #include "olap/rowset/segment_v2/bloom_filter.h"
 #include "olap/types.h"
 #include "vec/columns/column.h"
@@ -62,5 +63,68 @@ Status BloomFilterIndexIterator::read_bloom_filter(rowid_t ordinal,
     return Status::OK();
 }
 
+Status BloomFilterIndexIterator::read_bloom_filter(rowid_t ordinal, bool use_page_cache,
+                                                   std::shared_ptr<const BloomFilter>* bf) {
+    auto cache = BloomFilterPageCache::instance();
+    if (!use_page_cache || cache == nullptr) {
+        std::unique_ptr<BloomFilter> res;
+        RETURN_IF_ERROR(read_bloom_filter(ordinal, &res));
+        *bf = std::move(res);
+        return Status::OK();
+    }
+    const auto& meta = _reader->_bloom_filter_index_meta->bloom_filter();
+    BloomFilterPageCache::CacheKey key(_reader->_file_reader->file_id(),
+                                       meta.ordinal_index_meta().root_page().offset(), ordinal);
+    *bf = cache->lookup(key);
+    if (*bf == nullptr) {
+        std::unique_ptr<BloomFilter> res;
+        RETURN_IF_ERROR(read_bloom_filter(ordinal, &res));
+        *bf = std::move(res);
+        cache->insert(key, *bf);
+    }
+    return Status::OK();
+}
+
+BloomFilterPageCache* BloomFilterPageCache::_s_instance = nullptr;
+
+void BloomFilterPageCache::create_global_cache(size_t capacity, uint32_t num_shards) {
+    DCHECK(_s_instance == nullptr);
+    static BloomFilterPageCache instance(capacity, num_shards);
+    _s_instance = &instance;
+}
+
+BloomFilterPageCache::BloomFilterPageCache(size_t capacity, uint32_t num_shards) {
+    if (capacity > 0) {
+        _cache = std::unique_ptr<Cache>(
+                new_lru_cache("BloomFilterPageCache", capacity, LRUCacheType::SIZE, num_shards));
+    }
+}
+
+std::shared_ptr<const BloomFilter> BloomFilterPageCache::lookup(const CacheKey& key) {
+    if (_cache == nullptr) {
+        return nullptr;
+    }
+    auto lru_handle = _cache->lookup(key.encode());
+    if (lru_handle == nullptr) {
+        return nullptr;
+    }
+    auto bf = ((CacheValue*)_cache->value(lru_handle))->bf;
+    _cache->release(lru_handle);
+    return bf;
+}
+
+void BloomFilterPageCache::insert(const CacheKey& key, std::shared_ptr<const BloomFilter> bf) {
+    if (_cache == nullptr) {
+        return;
+    }
+    size_t size = bf->size();
+    auto value = std::make_unique<CacheValue>();
+    value->bf = std::move(bf);
+    auto deleter = [](const doris::CacheKey& key, void* value) { delete (CacheValue*)value; };
+    auto lru_handle = _cache->insert(key.encode(), value.release(), size, deleter,
+                                     CachePriority::NORMAL);
+    _cache->release(lru_handle);
+}
+
 } // namespace segment_v2
 } // namespace doris
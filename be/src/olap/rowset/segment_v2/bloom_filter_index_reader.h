@@ -18,12 +18,14 @@
 #pragma once
 
 #include <stddef.h>
+#include <stdint.h>
 
 #include <memory>
 #include <utility>
 
 #include "common/status.h"
 #include "io/fs/file_reader_writer_fwd.h"
+#include "olap/lru_cache.h"
 #include "olap/olap_common.h"
 #include "olap/rowset/segment_v2/common.h"
 #include "olap/rowset/segment_v2/indexed_column_reader.h"
@@ -69,6 +71,10 @@ public:
     // Read bloom filter at the given ordinal into `bf`.
     Status read_bloom_filter(rowid_t ordinal, std::unique_ptr<BloomFilter>* bf);
 
+    // Same as above, but the bloom filter is shared through BloomFilterPageCache.
+    Status read_bloom_filter(rowid_t ordinal, bool use_page_cache,
+                             std::shared_ptr<const BloomFilter>* bf);
+
     size_t current_bloom_filter_index() const { return _bloom_filter_iter.get_current_ordinal(); }
 
 private:
@@ -76,5 +82,53 @@ private:
     IndexedColumnIterator _bloom_filter_iter;
 };
 
+// Cache for the decoded bloom filters of the bloom filter index pages, separated from
+// StoragePageCache which caches the raw pages. A cached bloom filter is probed without
+// reading, decoding and copying its page again.
+class BloomFilterPageCache {
+public:
+    // The bloom filter index is identified by the offset of its ordinal index in the file.
+    struct CacheKey {
+        CacheKey(uint64_t file_id_, uint64_t index_offset_, uint64_t ordinal_)
+                : file_id(file_id_), index_offset(index_offset_), ordinal(ordinal_) {}
+        uint64_t file_id;
+        uint64_t index_offset;
+        uint64_t ordinal;
+
+        doris::CacheKey encode() const {
+            return doris::CacheKey(reinterpret_cast<const char*>(this), sizeof(*this));
+        }
+    };
+    static_assert(sizeof(CacheKey) == 3 * sizeof(uint64_t));
+
+    static void create_global_cache(size_t capacity, uint32_t num_shards = 16);
+
+    // nullptr if the cache is not created, e.g. in tests
+    static BloomFilterPageCache* instance() { return _s_instance; }
+
+    BloomFilterPageCache(size_t capacity, uint32_t num_shards);
+
+    // nullptr if not cached
+    std::shared_ptr<const BloomFilter> lookup(const CacheKey& key);
+
+    void insert(const CacheKey& key, std::shared_ptr<const BloomFilter> bf);
+
+    // evict the least recently used entries of about bytes, return the bytes evicted
+    int64_t evict(int64_t bytes) { return _cache ? _cache->evict(bytes) : 0; }
+
+    int64_t mem_consumption() { return _cache ? _cache->mem_consumption() : 0; }
+
+    uint64_t hit_count() { return _cache ? _cache->get_hit_count() : 0; }
+
+private:
+    struct CacheValue {
+        std::shared_ptr<const BloomFilter> bf;
+    };
+
+    static BloomFilterPageCache* _s_instance;
+    // nullptr if the cache is disabled
+    std::unique_ptr<Cache> _cache;
+};
+
 } // namespace segment_v2
 } // namespace doris
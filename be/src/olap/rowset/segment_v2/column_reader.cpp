@@ -32,7 +32,9 @@
 #include "olap/column_predicate.h"
 #include "olap/decimal12.h"
 #include "olap/inverted_index_parser.h"
+#include "olap/like_column_predicate.h"
 #include "olap/olap_common.h"
+#include "olap/page_cache.h"
 #include "olap/rowset/segment_v2/binary_dict_page.h" // for BinaryDictPageDecoder
 #include "olap/rowset/segment_v2/binary_plain_page.h"
 #include "olap/rowset/segment_v2/bitmap_index_reader.h"
@@ -65,6 +67,8 @@
 #include "vec/common/assert_cast.h"
 #include "vec/common/string_ref.h"
 #include "vec/core/types.h"
+#include "vec/data_types/data_type_factory.hpp"
+#include "vec/data_types/data_type_nullable.h"
 #include "vec/runtime/vdatetime_value.h" //for VecDateTime
 
 namespace doris {
@@ -216,6 +220,29 @@ Status ColumnReader::init() {
                                       _file_reader->path().native(), index_meta.type());
         }
     }
+    if (_meta.has_segment_ngram_bf()) {
+        const auto& ngram_bf = _meta.segment_ngram_bf();
+        size_t bf_size = ngram_bf.bloom_filter().size();
+        if (bf_size == 0 || bf_size % sizeof(uint64_t) != 0 || ngram_bf.gram_size() == 0) {
+            return Status::Corruption(
+                    "Bad file {}: invalid segment ngram bloom filter of column {}",
+                    _file_reader->path().native(), _meta.column_id());
+        }
+        RETURN_IF_ERROR(BloomFilter::create(NGRAM_BLOOM_FILTER, &_segment_ngram_bf, bf_size));
+        RETURN_IF_ERROR(_segment_ngram_bf->init(ngram_bf.bloom_filter().data(), bf_size,
+                                                CITY_HASH_64));
+        _segment_ngram_bf_gram_size = ngram_bf.gram_size();
+        // the decoded filter is kept instead
+        _meta.clear_segment_ngram_bf();
+    }
+    if (_meta.has_compression_dict()) {
+        if (_meta.compression() != ZSTD) {
+            return Status::Corruption("Bad file {}: compression dict of non ZSTD column {}",
+                                      _file_reader->path().native(), _meta.column_id());
+        }
+        RETURN_IF_ERROR(create_zstd_dict_codec(_meta.compression_dict(), &_dict_compress_codec));
+        _meta.clear_compression_dict();
+    }
     // ArrayColumnWriter writes a single empty array and flushes. In this scenario,
     // the item writer doesn't write any data and the corresponding ordinal index is empty.
     if (_ordinal_index_meta == nullptr && !is_empty()) {
@@ -325,8 +352,38 @@ bool ColumnReader::match_condition(const AndBlockColumnPredicate* col_predicates
                                      max_value.get(), col_predicates);
 }
 
+bool ColumnReader::match_segment_ngram_bf(const AndBlockColumnPredicate* col_predicates,
+                                          OlapReaderStatistics* stats) const {
+    if (_segment_ngram_bf == nullptr) {
+        return true;
+    }
+    std::set<const ColumnPredicate*> predicates;
+    col_predicates->get_all_column_predicate(predicates);
+    for (const auto* predicate : predicates) {
+        const auto* like_predicate = dynamic_cast<const LikeColumnPredicate*>(predicate);
+        if (like_predicate == nullptr) {
+            continue;
+        }
+        stats->segment_ngram_bf_checked_number++;
+        if (!like_predicate->evaluate_segment_ngram_bf(_segment_ngram_bf.get(),
+                                                       _segment_ngram_bf_gram_size)) {
+            stats->segment_ngram_bf_filtered_number++;
+            return false;
+        }
+    }
+    return true;
+}
+
+bool ColumnReader::match_zone_map(const ZoneMapPB& zone_map, WrapperField* min_value_container,
+                                  WrapperField* max_value_container,
+                                  const AndBlockColumnPredicate* col_predicates) {
+    _parse_zone_map(zone_map, min_value_container, max_value_container);
+    return _zone_map_match_condition(zone_map, min_value_container, max_value_container,
+                                     col_predicates);
+}
+
 void ColumnReader::_parse_zone_map(const ZoneMapPB& zone_map, WrapperField* min_value_container,
-                                   WrapperField* max_value_container) const {
+                                   WrapperField* max_value_container) {
     // min value and max value are valid if has_not_null is true
     if (zone_map.has_not_null()) {
         min_value_container->from_string(zone_map.min());
@@ -362,7 +419,7 @@ void ColumnReader::_parse_zone_map_skip_null(const ZoneMapPB& zone_map,
 bool ColumnReader::_zone_map_match_condition(const ZoneMapPB& zone_map,
                                              WrapperField* min_value_container,
                                              WrapperField* max_value_container,
-                                             const AndBlockColumnPredicate* col_predicates) const {
+                                             const AndBlockColumnPredicate* col_predicates) {
     if (!zone_map.has_not_null() && !zone_map.has_null()) {
         return false; // no data in this zone
     }
@@ -450,8 +507,8 @@ Status ColumnReader::get_row_ranges_by_bloom_filter(const AndBlockColumnPredicat
         }
     }
     for (auto& pid : page_ids) {
-        std::unique_ptr<BloomFilter> bf;
-        RETURN_IF_ERROR(bf_iter->read_bloom_filter(pid, &bf));
+        std::shared_ptr<const BloomFilter> bf;
+        RETURN_IF_ERROR(bf_iter->read_bloom_filter(pid, _use_index_page_cache, &bf));
         if (col_predicates->evaluate_and(bf.get())) {
             bf_row_ranges.add(RowRange(_ordinal_index->get_first_ordinal(pid),
                                        _ordinal_index->get_last_ordinal(pid) + 1));
@@ -549,12 +606,33 @@ Status ColumnReader::seek_at_or_before(ordinal_t ordinal, OrdinalPageIndexIterat
     return Status::OK();
 }
 
+void ColumnReader::release_iterator(std::unique_ptr<ColumnIterator> iterator) {
+    // only the iterators of the scalar columns keep something worth reusing, the dictionary
+    auto* file_iterator = dynamic_cast<FileColumnIterator*>(iterator.get());
+    if (file_iterator == nullptr || file_iterator->reader() != this) {
+        return;
+    }
+    file_iterator->reset_for_reuse();
+    std::lock_guard l(_iterator_pool_lock);
+    if (_iterator_pool.size() < config::column_iterator_pool_size) {
+        _iterator_pool.push_back(std::move(iterator));
+    }
+}
+
 Status ColumnReader::new_iterator(ColumnIterator** iterator) {
     if (is_empty()) {
         *iterator = new EmptyFileColumnIterator();
         return Status::OK();
     }
     if (is_scalar_type((FieldType)_meta.type())) {
+        {
+            std::lock_guard l(_iterator_pool_lock);
+            if (!_iterator_pool.empty()) {
+                *iterator = _iterator_pool.back().release();
+                _iterator_pool.pop_back();
+                return Status::OK();
+            }
+        }
         *iterator = new FileColumnIterator(this);
         return Status::OK();
     } else {
@@ -913,6 +991,14 @@ Status ArrayFileColumnIterator::read_by_rowids(const rowid_t* rowids, const size
 
 ////////////////////////////////////////////////////////////////////////////////
 
+Status ColumnReader::get_compress_codec(BlockCompressionCodec** codec) const {
+    if (_dict_compress_codec != nullptr) {
+        *codec = _dict_compress_codec.get();
+        return Status::OK();
+    }
+    return get_block_compression_codec(_meta.compression(), codec);
+}
+
 FileColumnIterator::FileColumnIterator(ColumnReader* reader) : _reader(reader) {}
 
 Status FileColumnIterator::init(const ColumnIteratorOptions& opts) {
@@ -920,7 +1006,7 @@ Status FileColumnIterator::init(const ColumnIteratorOptions& opts) {
     if (!_opts.use_page_cache) {
         _reader->disable_index_meta_cache();
     }
-    RETURN_IF_ERROR(get_block_compression_codec(_reader->get_compression(), &_compress_codec));
+    RETURN_IF_ERROR(_reader->get_compress_codec(&_compress_codec));
     if (config::enable_low_cardinality_optimize &&
         opts.io_ctx.reader_type == ReaderType::READER_QUERY &&
         _reader->encoding_info()->encoding() == DICT_ENCODING) {
@@ -940,6 +1026,15 @@ Status FileColumnIterator::init(const ColumnIteratorOptions& opts) {
 
 FileColumnIterator::~FileColumnIterator() = default;
 
+void FileColumnIterator::reset_for_reuse() {
+    // release the data page, the dictionary page is kept with its decoder
+    _page.~ParsedPage();
+    new (&_page) ParsedPage();
+    _page_iter = OrdinalPageIndexIterator();
+    _current_ordinal = 0;
+    _opts = ColumnIteratorOptions();
+}
+
 Status FileColumnIterator::seek_to_first() {
     RETURN_IF_ERROR(_reader->seek_to_first(&_page_iter));
     RETURN_IF_ERROR(_read_data_page(_page_iter));
@@ -1054,6 +1149,29 @@ Status FileColumnIterator::next_batch(size_t* n, vectorized::MutableColumnPtr& d
     return Status::OK();
 }
 
+Status FileColumnIterator::next_batch_borrowed(size_t* n, vectorized::ColumnPtr* dst) {
+    if (!_page.has_remaining()) {
+        bool eos = false;
+        RETURN_IF_ERROR(_load_next_page(&eos));
+        if (eos) {
+            *n = 0;
+            *dst = nullptr;
+            return Status::OK();
+        }
+    }
+    if (_page.has_null) {
+        return Status::NotSupported("can not borrow the rows of page with null");
+    }
+    // only the rows of the current page are borrowed, the column can not span pages
+    size_t nrows_to_read = std::min(*n, _page.remaining());
+    RETURN_IF_ERROR(_page.data_decoder->borrow_batch(&nrows_to_read, _page.page_handle, dst));
+    _page.offset_in_page += nrows_to_read;
+    _current_ordinal += nrows_to_read;
+    *n = nrows_to_read;
+    _opts.stats->bytes_read += (*dst)->byte_size();
+    return Status::OK();
+}
+
 Status FileColumnIterator::read_by_rowids(const rowid_t* rowids, const size_t count,
                                           vectorized::MutableColumnPtr& dst) {
     size_t remaining = count;
@@ -1207,6 +1325,155 @@ Status FileColumnIterator::get_row_ranges_by_bloom_filter(
     return Status::OK();
 }
 
+Status FileColumnIterator::collect_data_pages(
+        const std::vector<std::pair<uint32_t, uint32_t>>& row_ranges,
+        std::vector<PagePointer>* pages) {
+    auto cache = StoragePageCache::instance();
+    bool check_cache = _opts.use_page_cache && cache->is_cache_available(DATA_PAGE);
+    OrdinalPageIndexIterator iter;
+    int32_t last_page_index = -1;
+    for (const auto& [from, to] : row_ranges) {
+        RETURN_IF_ERROR(_reader->seek_at_or_before(from, &iter));
+        for (; iter.valid() && iter.first_ordinal() < to; iter.next()) {
+            // adjacent row ranges may be covered by the same page
+            if (iter.page_index() <= last_page_index) {
+                continue;
+            }
+            last_page_index = iter.page_index();
+            PageCacheHandle cache_handle;
+            if (check_cache &&
+                cache->lookup(StoragePageCache::CacheKey(_opts.file_reader->file_id(),
+                                                         iter.page().offset),
+                              &cache_handle, DATA_PAGE)) {
+                continue;
+            }
+            pages->push_back(iter.page());
+        }
+    }
+    return Status::OK();
+}
+
+template <typename SrcType, typename DstType>
+static void widen_values(const vectorized::IColumn& src, std::vector<char>* values) {
+    const auto& src_data = assert_cast<const vectorized::ColumnVector<SrcType>&>(src).get_data();
+    values->resize(src_data.size() * sizeof(DstType));
+    auto* dst_data = reinterpret_cast<DstType*>(values->data());
+    for (size_t i = 0; i < src_data.size(); ++i) {
+        dst_data[i] = src_data[i];
+    }
+}
+
+template <typename SrcType>
+static WideningColumnIterator::WidenFunc get_integer_widen_func(int src_rank, FieldType to) {
+    // the integer types by their widths
+    switch (to) {
+    case FieldType::OLAP_FIELD_TYPE_SMALLINT:
+        return src_rank < 1 ? &widen_values<SrcType, vectorized::Int16> : nullptr;
+    case FieldType::OLAP_FIELD_TYPE_INT:
+        return src_rank < 2 ? &widen_values<SrcType, vectorized::Int32> : nullptr;
+    case FieldType::OLAP_FIELD_TYPE_BIGINT:
+        return src_rank < 3 ? &widen_values<SrcType, vectorized::Int64> : nullptr;
+    case FieldType::OLAP_FIELD_TYPE_LARGEINT:
+        return &widen_values<SrcType, vectorized::Int128>;
+    default:
+        return nullptr;
+    }
+}
+
+WideningColumnIterator::WidenFunc WideningColumnIterator::get_widen_func(FieldType from,
+                                                                         FieldType to) {
+    switch (from) {
+    case FieldType::OLAP_FIELD_TYPE_TINYINT:
+        return get_integer_widen_func<vectorized::Int8>(0, to);
+    case FieldType::OLAP_FIELD_TYPE_SMALLINT:
+        return get_integer_widen_func<vectorized::Int16>(1, to);
+    case FieldType::OLAP_FIELD_TYPE_INT:
+        return get_integer_widen_func<vectorized::Int32>(2, to);
+    case FieldType::OLAP_FIELD_TYPE_BIGINT:
+        return get_integer_widen_func<vectorized::Int64>(3, to);
+    case FieldType::OLAP_FIELD_TYPE_FLOAT:
+        return to == FieldType::OLAP_FIELD_TYPE_DOUBLE
+                       ? &widen_values<vectorized::Float32, vectorized::Float64>
+                       : nullptr;
+    default:
+        return nullptr;
+    }
+}
+
+WideningColumnIterator::WideningColumnIterator(std::unique_ptr<ColumnIterator> iter,
+                                               FieldType from, WidenFunc widen)
+        : _iter(std::move(iter)),
+          _src_type(vectorized::DataTypeFactory::instance().create_data_type(from, 0, 0)),
+          _widen_func(widen) {}
+
+vectorized::MutableColumnPtr& WideningColumnIterator::_src_column(
+        const vectorized::MutableColumnPtr& dst) {
+    if (_src == nullptr || _src->is_nullable() != dst->is_nullable()) {
+        _src = dst->is_nullable() ? vectorized::make_nullable(_src_type)->create_column()
+                                  : _src_type->create_column();
+    }
+    _src->clear();
+    return _src;
+}
+
+Status WideningColumnIterator::next_batch(size_t* n, vectorized::MutableColumnPtr& dst,
+                                          bool* has_null) {
+    RETURN_IF_ERROR(_iter->next_batch(n, _src_column(dst), has_null));
+    return _widen(dst);
+}
+
+Status WideningColumnIterator::next_batch_of_zone_map(size_t* n,
+                                                      vectorized::MutableColumnPtr& dst) {
+    RETURN_IF_ERROR(_iter->next_batch_of_zone_map(n, _src_column(dst)));
+    return _widen(dst);
+}
+
+Status WideningColumnIterator::read_by_rowids(const rowid_t* rowids, const size_t count,
+                                              vectorized::MutableColumnPtr& dst) {
+    RETURN_IF_ERROR(_iter->read_by_rowids(rowids, count, _src_column(dst)));
+    return _widen(dst);
+}
+
+Status WideningColumnIterator::_widen(vectorized::MutableColumnPtr& dst) {
+    size_t num_rows = _src->size();
+    if (num_rows == 0) {
+        return Status::OK();
+    }
+    const vectorized::IColumn* src_values = _src.get();
+    const vectorized::NullMap* null_map = nullptr;
+    if (const auto* nullable = vectorized::check_and_get_column<vectorized::ColumnNullable>(
+                _src.get())) {
+        src_values = &nullable->get_nested_column();
+        null_map = &nullable->get_null_map_data();
+    }
+    _widen_func(*src_values, &_values);
+    size_t value_size = _values.size() / num_rows;
+    if (null_map == nullptr) {
+        dst->insert_many_fix_len_data(_values.data(), num_rows);
+        return Status::OK();
+    }
+
+    // the runs of nulls and values, inserted as the page decoders do
+    auto* dst_nullable = const_cast<vectorized::ColumnNullable*>(
+            vectorized::check_and_get_column<vectorized::ColumnNullable>(dst.get()));
+    if (dst_nullable == nullptr) {
+        return Status::InternalError("unexpected column type in widening column iterator");
+    }
+    for (size_t begin = 0; begin < num_rows;) {
+        size_t end = begin + 1;
+        while (end < num_rows && (*null_map)[end] == (*null_map)[begin]) {
+            ++end;
+        }
+        if ((*null_map)[begin]) {
+            dst_nullable->insert_null_elements(end - begin);
+        } else {
+            dst->insert_many_fix_len_data(_values.data() + begin * value_size, end - begin);
+        }
+        begin = end;
+    }
+    return Status::OK();
+}
+
 Status DefaultValueColumnIterator::init(const ColumnIteratorOptions& opts) {
     _opts = opts;
     // be consistent with segment v1
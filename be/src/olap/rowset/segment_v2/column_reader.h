@@ -64,6 +64,7 @@ namespace segment_v2 {
 
 class EncodingInfo;
 class ColumnIterator;
+class BloomFilter;
 class BloomFilterIndexReader;
 class BitmapIndexIterator;
 class BitmapIndexReader;
@@ -132,6 +133,10 @@ public:
 
     bool is_nullable() const { return _meta.is_nullable(); }
 
+    // the type the column is written in, which may differ from the one of the tablet schema
+    // after a lazy schema change, see WideningColumnIterator
+    FieldType get_meta_type() const { return (FieldType)_meta.type(); }
+
     const EncodingInfo* encoding_info() const { return _encoding_info; }
 
     bool has_zone_map() const { return _zone_map_index_meta != nullptr; }
@@ -143,6 +148,24 @@ public:
     // Return true if segment zone map is absent or `cond' could be satisfied, false otherwise.
     bool match_condition(const AndBlockColumnPredicate* col_predicates) const;
 
+    // Keep a column iterator created by new_iterator() for reuse by a later new_iterator(),
+    // see config::column_iterator_pool_size.
+    void release_iterator(std::unique_ptr<ColumnIterator> iterator);
+
+    // Same as match_condition() on a zone map of the column type of the containers, e.g. the
+    // rowset level one.
+    static bool match_zone_map(const ZoneMapPB& zone_map, WrapperField* min_value_container,
+                               WrapperField* max_value_container,
+                               const AndBlockColumnPredicate* col_predicates);
+
+    bool has_segment_ngram_bf() const { return _segment_ngram_bf != nullptr; }
+
+    // Check if the LIKE predicates in `col_predicates' could match any value of this column
+    // using the segment ngram bloom filter, without I/O.
+    // Return true if the filter is absent or the predicates could be satisfied, false otherwise.
+    bool match_segment_ngram_bf(const AndBlockColumnPredicate* col_predicates,
+                                OlapReaderStatistics* stats) const;
+
     Status next_batch_of_zone_map(size_t* n, vectorized::MutableColumnPtr& dst) const;
 
     // get row ranges with zone map
@@ -162,6 +185,10 @@ public:
 
     CompressionTypePB get_compression() const { return _meta.compression(); }
 
+    // The codec of the pages, which is owned by this reader if they are compressed with a
+    // ZSTD dictionary.
+    Status get_compress_codec(BlockCompressionCodec** codec) const;
+
     uint64_t num_rows() const { return _num_rows; }
 
     void set_dict_encoding_type(DictEncodingType type) {
@@ -194,12 +221,13 @@ private:
     [[nodiscard]] Status _load_inverted_index_index(const TabletIndex* index_meta);
     [[nodiscard]] Status _load_bloom_filter_index(bool use_page_cache, bool kept_in_memory);
 
-    bool _zone_map_match_condition(const ZoneMapPB& zone_map, WrapperField* min_value_container,
-                                   WrapperField* max_value_container,
-                                   const AndBlockColumnPredicate* col_predicates) const;
+    static bool _zone_map_match_condition(const ZoneMapPB& zone_map,
+                                          WrapperField* min_value_container,
+                                          WrapperField* max_value_container,
+                                          const AndBlockColumnPredicate* col_predicates);
 
-    void _parse_zone_map(const ZoneMapPB& zone_map, WrapperField* min_value_container,
-                         WrapperField* max_value_container) const;
+    static void _parse_zone_map(const ZoneMapPB& zone_map, WrapperField* min_value_container,
+                                WrapperField* max_value_container);
 
     void _parse_zone_map_skip_null(const ZoneMapPB& zone_map, WrapperField* min_value_container,
                                    WrapperField* max_value_container) const;
@@ -231,6 +259,11 @@ private:
     const OrdinalIndexPB* _ordinal_index_meta = nullptr;
     const BitmapIndexPB* _bitmap_index_meta = nullptr;
     const BloomFilterIndexPB* _bf_index_meta = nullptr;
+    // ngram bloom filter of all values in the segment, decoded from _meta
+    std::unique_ptr<BloomFilter> _segment_ngram_bf;
+    size_t _segment_ngram_bf_gram_size = 0;
+    // decoded from the compression dict of _meta
+    std::unique_ptr<BlockCompressionCodec> _dict_compress_codec;
 
     mutable std::mutex _load_index_lock;
     std::unique_ptr<ZoneMapIndexReader> _zone_map_index;
@@ -248,6 +281,10 @@ private:
 
     std::once_flag _set_dict_encoding_type_flag;
     DorisCallOnce<Status> _set_dict_encoding_type_once;
+
+    std::mutex _iterator_pool_lock;
+    // the released FileColumnIterators of this reader
+    std::vector<std::unique_ptr<ColumnIterator>> _iterator_pool;
 };
 
 // Base iterator to read one column data
@@ -279,6 +316,13 @@ public:
         return Status::NotSupported("next_batch not implement");
     }
 
+    // Read at most *n next rows, which are not null and borrowed from the page without being
+    // copied, into a read-only column, see PageDecoder::borrow_batch. Return NotSupported if
+    // the rows can not be borrowed, then the caller should read them by next_batch.
+    virtual Status next_batch_borrowed(size_t* n, vectorized::ColumnPtr* dst) {
+        return Status::NotSupported("next_batch_borrowed not implement");
+    }
+
     virtual Status next_batch_of_zone_map(size_t* n, vectorized::MutableColumnPtr& dst) {
         return Status::NotSupported("next_batch_of_zone_map not implement");
     }
@@ -303,6 +347,14 @@ public:
 
     virtual bool is_all_dict_encoding() const { return false; }
 
+    // Append the data pages covering the row ranges [from, to) to `pages`, which are going to be
+    // read by the following next_batch, so that the caller can prefetch them asynchronously.
+    // Pages already in page cache are skipped.
+    virtual Status collect_data_pages(const std::vector<std::pair<uint32_t, uint32_t>>& row_ranges,
+                                      std::vector<PagePointer>* pages) {
+        return Status::OK();
+    }
+
 protected:
     ColumnIteratorOptions _opts;
 };
@@ -324,6 +376,8 @@ public:
 
     Status next_batch(size_t* n, vectorized::MutableColumnPtr& dst, bool* has_null) override;
 
+    Status next_batch_borrowed(size_t* n, vectorized::ColumnPtr* dst) override;
+
     Status next_batch_of_zone_map(size_t* n, vectorized::MutableColumnPtr& dst) override;
 
     Status read_by_rowids(const rowid_t* rowids, const size_t count,
@@ -347,6 +401,14 @@ public:
 
     bool is_all_dict_encoding() const override { return _is_all_dict_encoding; }
 
+    const ColumnReader* reader() const { return _reader; }
+
+    // Drop the state of the last read except the dictionary, init() must be called again.
+    void reset_for_reuse();
+
+    Status collect_data_pages(const std::vector<std::pair<uint32_t, uint32_t>>& row_ranges,
+                              std::vector<PagePointer>* pages) override;
+
 private:
     void _seek_to_pos_in_page(ParsedPage* page, ordinal_t offset_in_page) const;
     Status _load_next_page(bool* eos);
@@ -585,6 +647,57 @@ private:
     int32_t _segment_id = 0;
 };
 
+// Reads a column of a segment written in a narrower type than the one of the tablet schema, as
+// after a lazy schema change widening INT to BIGINT, converting the values as they are read. The
+// rowsets are rewritten in the new type by their compactions. The zone maps and bloom filters of
+// the column are in the old type, so no row is pruned by them.
+class WideningColumnIterator final : public ColumnIterator {
+public:
+    // converts the values of a column of the old type to an array of the new type
+    using WidenFunc = void (*)(const vectorized::IColumn& src, std::vector<char>* values);
+
+    // nullptr if the values of the type `from` can not be widened to `to` as read
+    static WidenFunc get_widen_func(FieldType from, FieldType to);
+
+    WideningColumnIterator(std::unique_ptr<ColumnIterator> iter, FieldType from, WidenFunc widen);
+
+    Status init(const ColumnIteratorOptions& opts) override { return _iter->init(opts); }
+
+    Status seek_to_first() override { return _iter->seek_to_first(); }
+
+    Status seek_to_ordinal(ordinal_t ord) override { return _iter->seek_to_ordinal(ord); }
+
+    Status next_batch(size_t* n, vectorized::MutableColumnPtr& dst) {
+        bool has_null;
+        return next_batch(n, dst, &has_null);
+    }
+
+    Status next_batch(size_t* n, vectorized::MutableColumnPtr& dst, bool* has_null) override;
+
+    Status next_batch_of_zone_map(size_t* n, vectorized::MutableColumnPtr& dst) override;
+
+    Status read_by_rowids(const rowid_t* rowids, const size_t count,
+                          vectorized::MutableColumnPtr& dst) override;
+
+    ordinal_t get_current_ordinal() const override { return _iter->get_current_ordinal(); }
+
+    Status collect_data_pages(const std::vector<std::pair<uint32_t, uint32_t>>& row_ranges,
+                              std::vector<PagePointer>* pages) override {
+        return _iter->collect_data_pages(row_ranges, pages);
+    }
+
+private:
+    // the column to read the values of the old type into, nullable as `dst`
+    vectorized::MutableColumnPtr& _src_column(const vectorized::MutableColumnPtr& dst);
+    Status _widen(vectorized::MutableColumnPtr& dst);
+
+    std::unique_ptr<ColumnIterator> _iter;
+    vectorized::DataTypePtr _src_type;
+    WidenFunc _widen_func;
+    vectorized::MutableColumnPtr _src;
+    std::vector<char> _values;
+};
+
 // This iterator is used to read default value column
 class DefaultValueColumnIterator : public ColumnIterator {
 public:
@@ -27,6 +27,7 @@
 #include "common/logging.h"
 #include "gutil/strings/substitute.h"
 #include "io/fs/file_writer.h"
+#include "olap/itoken_extractor.h"
 #include "olap/olap_common.h"
 #include "olap/rowset/segment_v2/bitmap_index_writer.h"
 #include "olap/rowset/segment_v2/bloom_filter.h"
@@ -447,13 +448,33 @@ ScalarColumnWriter::~ScalarColumnWriter() {
     }
 }
 
+// Choose the encoding which fits the data of the type better than its default encoding.
+static EncodingTypePB adaptive_encoding(FieldType type, EncodingTypePB encoding) {
+    if (encoding != DEFAULT_ENCODING || !config::enable_adaptive_numeric_encoding) {
+        return encoding;
+    }
+    switch (type) {
+    case FieldType::OLAP_FIELD_TYPE_DATETIME:
+    case FieldType::OLAP_FIELD_TYPE_DATETIMEV2:
+        return DELTA_OF_DELTA_ENCODING;
+    case FieldType::OLAP_FIELD_TYPE_FLOAT:
+    case FieldType::OLAP_FIELD_TYPE_DOUBLE:
+        return ALP_ENCODING;
+    default:
+        return encoding;
+    }
+}
+
 Status ScalarColumnWriter::init() {
     RETURN_IF_ERROR(get_block_compression_codec(_opts.meta->compression(), &_compress_codec));
+    _training_zstd_dict = _opts.need_zstd_dict && _compress_codec != nullptr;
 
     PageBuilder* page_builder = nullptr;
 
-    RETURN_IF_ERROR(
-            EncodingInfo::get(get_field()->type_info(), _opts.meta->encoding(), &_encoding_info));
+    RETURN_IF_ERROR(EncodingInfo::get(get_field()->type_info(),
+                                      adaptive_encoding(get_field()->type(),
+                                                        _opts.meta->encoding()),
+                                      &_encoding_info));
     _opts.meta->set_encoding(_encoding_info->encoding());
     // create page builder
     PageBuilderOptions opts;
@@ -497,6 +518,11 @@ Status ScalarColumnWriter::init() {
                     BloomFilterOptions(), get_field()->type_info(), &_bloom_filter_index_builder));
         }
     }
+    if (_opts.need_segment_ngram_bf) {
+        RETURN_IF_ERROR(BloomFilter::create(NGRAM_BLOOM_FILTER, &_segment_ngram_bf,
+                                            config::segment_ngram_bf_size));
+        _segment_ngram_bf_gram_size = config::segment_ngram_bf_gram_size;
+    }
     return Status::OK();
 }
 
@@ -550,6 +576,9 @@ Status ScalarColumnWriter::append_data_in_current_page(const uint8_t* data, size
     if (_opts.need_bloom_filter) {
         _bloom_filter_index_builder->add_values(data, *num_written);
     }
+    if (_segment_ngram_bf != nullptr) {
+        _add_segment_ngram_bf_values(reinterpret_cast<const Slice*>(data), *num_written);
+    }
 
     _next_rowid += *num_written;
 
@@ -561,6 +590,19 @@ Status ScalarColumnWriter::append_data_in_current_page(const uint8_t* data, size
     return Status::OK();
 }
 
+void ScalarColumnWriter::_add_segment_ngram_bf_values(const Slice* values, size_t count) {
+    NgramTokenExtractor extractor(_segment_ngram_bf_gram_size);
+    for (size_t i = 0; i < count; ++i) {
+        _segment_ngram_bf_value_bytes += values[i].size;
+        if (_segment_ngram_bf_value_bytes > config::segment_ngram_bf_max_column_kb * 1024L) {
+            // the filter of too many values is almost full and can not skip anything
+            _segment_ngram_bf.reset();
+            return;
+        }
+        extractor.string_to_bloom_filter(values[i].data, values[i].size, *_segment_ngram_bf);
+    }
+}
+
 Status ScalarColumnWriter::append_data_in_current_page(const uint8_t** data, size_t* num_written) {
     RETURN_IF_ERROR(append_data_in_current_page(*data, num_written));
     *data += get_field()->size() * (*num_written);
@@ -588,7 +630,15 @@ uint64_t ScalarColumnWriter::estimate_buffer_size() {
 
 Status ScalarColumnWriter::finish() {
     RETURN_IF_ERROR(finish_current_page());
+    if (_training_zstd_dict) {
+        RETURN_IF_ERROR(_train_zstd_dict());
+    }
     _opts.meta->set_num_rows(_next_rowid);
+    if (_segment_ngram_bf != nullptr) {
+        auto* ngram_bf = _opts.meta->mutable_segment_ngram_bf();
+        ngram_bf->set_gram_size(_segment_ngram_bf_gram_size);
+        ngram_bf->set_bloom_filter(_segment_ngram_bf->data(), _segment_ngram_bf->size());
+    }
     return Status::OK();
 }
 
@@ -710,6 +760,17 @@ Status ScalarColumnWriter::finish_current_page() {
     if (_new_page_callback != nullptr) {
         _new_page_callback->put_extra_info_in_page(data_page_footer);
     }
+    if (_training_zstd_dict) {
+        _zstd_dict_sample_bytes += page->footer.uncompressed_size();
+        page->data.emplace_back(std::move(encoded_values));
+        page->data.emplace_back(std::move(nullmap));
+        _push_back_page(page.release());
+        _first_rowid = _next_rowid;
+        if (_zstd_dict_sample_bytes >= config::segment_zstd_dict_sample_kb * 1024L) {
+            RETURN_IF_ERROR(_train_zstd_dict());
+        }
+        return Status::OK();
+    }
     // trying to compress page body
     OwnedSlice compressed_body;
     RETURN_IF_ERROR(PageIO::compress_page_body(_compress_codec, _opts.compression_min_space_saving,
@@ -728,6 +789,51 @@ Status ScalarColumnWriter::finish_current_page() {
     return Status::OK();
 }
 
+Status ScalarColumnWriter::_train_zstd_dict() {
+    _training_zstd_dict = false;
+    // a dictionary helps the small inputs looking alike, so the trainer is given the pieces
+    // of the page bodies instead of the whole ones
+    constexpr size_t SAMPLE_SIZE = 4096;
+    std::vector<Slice> samples;
+    for (Page* page = _pages.head; page != nullptr; page = page->next) {
+        for (auto& data : page->data) {
+            Slice slice = data.slice();
+            for (size_t offset = 0; offset < slice.size; offset += SAMPLE_SIZE) {
+                samples.emplace_back(slice.data + offset,
+                                     std::min(SAMPLE_SIZE, slice.size - offset));
+            }
+        }
+    }
+    std::string dict;
+    RETURN_IF_ERROR(train_zstd_dict(samples, config::segment_zstd_dict_size_kb * 1024L, &dict));
+    if (!dict.empty()) {
+        RETURN_IF_ERROR(create_zstd_dict_codec(dict, &_zstd_dict_codec));
+        _compress_codec = _zstd_dict_codec.get();
+        _opts.meta->set_compression_dict(std::move(dict));
+    }
+
+    // all the pages so far are uncompressed
+    for (Page* page = _pages.head; page != nullptr; page = page->next) {
+        std::vector<Slice> body;
+        for (auto& data : page->data) {
+            if (!data.slice().empty()) {
+                body.push_back(data.slice());
+            }
+        }
+        OwnedSlice compressed_body;
+        RETURN_IF_ERROR(PageIO::compress_page_body(
+                _compress_codec, _opts.compression_min_space_saving, body, &compressed_body));
+        if (compressed_body.slice().empty()) {
+            continue;
+        }
+        _data_size -= Slice::compute_total_size(body);
+        _data_size += compressed_body.slice().size;
+        page->data.clear();
+        page->data.emplace_back(std::move(compressed_body));
+    }
+    return Status::OK();
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 
 StructColumnWriter::StructColumnWriter(
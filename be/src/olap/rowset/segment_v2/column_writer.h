@@ -62,6 +62,10 @@ struct ColumnWriterOptions {
     bool is_ngram_bf_index = false;
     uint8_t gram_size;
     uint16_t gram_bf_size;
+    // build an ngram bloom filter of all values into meta, see segment_ngram_bf_max_column_kb
+    bool need_segment_ngram_bf = false;
+    // train a ZSTD dictionary into meta to compress the pages, see segment_zstd_dict_size_kb
+    bool need_zstd_dict = false;
     std::vector<const TabletIndex*> indexes;
     const TabletIndex* inverted_index = nullptr;
     std::string to_string() const {
@@ -81,6 +85,7 @@ class NullBitmapBuilder;
 class OrdinalIndexWriter;
 class PageBuilder;
 class BloomFilterIndexWriter;
+class BloomFilter;
 class ZoneMapIndexWriter;
 
 class ColumnWriter {
@@ -255,6 +260,11 @@ private:
 
     Status _write_data_page(Page* page);
 
+    void _add_segment_ngram_bf_values(const Slice* values, size_t count);
+
+    // Train the ZSTD dictionary from the pages kept uncompressed so far and compress them.
+    Status _train_zstd_dict();
+
 private:
     io::FileWriter* _file_writer = nullptr;
     // total size of data page list
@@ -271,6 +281,15 @@ private:
     std::unique_ptr<BitmapIndexWriter> _bitmap_index_builder;
     std::unique_ptr<InvertedIndexColumnWriter> _inverted_index_builder;
     std::unique_ptr<BloomFilterIndexWriter> _bloom_filter_index_builder;
+    // ngram bloom filter of all values, reset when the values are too large
+    std::unique_ptr<BloomFilter> _segment_ngram_bf;
+    uint8_t _segment_ngram_bf_gram_size = 0;
+    uint64_t _segment_ngram_bf_value_bytes = 0;
+    // the pages are kept uncompressed as the samples until the dictionary is trained
+    bool _training_zstd_dict = false;
+    uint64_t _zstd_dict_sample_bytes = 0;
+    // replaces _compress_codec if the dictionary is trained
+    std::unique_ptr<BlockCompressionCodec> _zstd_dict_codec;
 
     // call before flush data page.
     FlushPageCallback* _new_page_callback = nullptr;
@@ -0,0 +1,140 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <glog/logging.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+#include "common/compiler_util.h" // IWYU pragma: keep
+#include "common/status.h"
+#include "olap/olap_common.h"
+#include "olap/rowset/segment_v2/common.h"
+#include "olap/rowset/segment_v2/page_decoder.h"
+#include "olap/types.h"
+#include "util/slice.h"
+#include "vec/columns/column.h"
+
+namespace doris {
+namespace segment_v2 {
+
+// Base decoder of the numeric encodings whose values depend on the previous ones, so the
+// values can not be located without decoding the page from the start, e.g. delta-of-delta.
+// The whole page is decoded into a flat array in init(), after which seeking is free and
+// batches are copied from the array into the column.
+//
+// Derived class should implement _decode_values() to fill _values.
+template <FieldType Type>
+class DecodedPageDecoder : public PageDecoder {
+public:
+    using CppType = typename TypeTraits<Type>::CppType;
+
+    DecodedPageDecoder(Slice slice, const PageDecoderOptions& options)
+            : _data(slice), _parsed(false), _cur_index(0) {}
+
+    Status init() override {
+        CHECK(!_parsed);
+        RETURN_IF_ERROR(_decode_values());
+        _parsed = true;
+        return Status::OK();
+    }
+
+    Status seek_to_position_in_page(size_t pos) override {
+        DCHECK(_parsed) << "Must call init() firstly";
+        DCHECK_LE(pos, _values.size())
+                << "Tried to seek to " << pos << " which is > number of elements ("
+                << _values.size() << ") in the block!";
+        _cur_index = pos;
+        return Status::OK();
+    }
+
+    Status next_batch(size_t* n, vectorized::MutableColumnPtr& dst) override {
+        RETURN_IF_ERROR(peek_next_batch(n, dst));
+        _cur_index += *n;
+        return Status::OK();
+    }
+
+    Status peek_next_batch(size_t* n, vectorized::MutableColumnPtr& dst) override {
+        DCHECK(_parsed) << "Must call init() firstly";
+        if (PREDICT_FALSE(*n == 0 || _cur_index >= _values.size())) {
+            *n = 0;
+            return Status::OK();
+        }
+        size_t max_fetch = std::min(*n, _values.size() - _cur_index);
+        CppType* values = append_raw_fix_len_data<CppType>(dst, max_fetch);
+        if (values != nullptr) {
+            memcpy(values, &_values[_cur_index], max_fetch * sizeof(CppType));
+        } else {
+            dst->insert_many_fix_len_data((const char*)&_values[_cur_index], max_fetch);
+        }
+        *n = max_fetch;
+        return Status::OK();
+    }
+
+    Status read_by_rowids(const rowid_t* rowids, ordinal_t page_first_ordinal, size_t* n,
+                          vectorized::MutableColumnPtr& dst) override {
+        DCHECK(_parsed) << "Must call init() firstly";
+        auto total = *n;
+        size_t read_count = 0;
+        // rowids are ascending, stop at the first one out of this page
+        while (read_count < total && rowids[read_count] - page_first_ordinal < _values.size()) {
+            ++read_count;
+        }
+        if (UNLIKELY(read_count == 0)) {
+            *n = 0;
+            return Status::OK();
+        }
+
+        CppType* values = append_raw_fix_len_data<CppType>(dst, read_count);
+        bool decode_to_column = values != nullptr;
+        if (!decode_to_column) {
+            _gathered_values.resize(read_count);
+            values = _gathered_values.data();
+        }
+        for (size_t i = 0; i < read_count; ++i) {
+            values[i] = _values[rowids[i] - page_first_ordinal];
+        }
+        if (!decode_to_column) {
+            dst->insert_many_fix_len_data((const char*)values, read_count);
+        }
+        *n = read_count;
+        return Status::OK();
+    }
+
+    size_t count() const override { return _values.size(); }
+
+    size_t current_index() const override { return _cur_index; }
+
+protected:
+    virtual Status _decode_values() = 0;
+
+    Slice _data;
+    std::vector<CppType> _values;
+
+private:
+    bool _parsed;
+    size_t _cur_index;
+    // used when the values can not be gathered into column directly
+    std::vector<CppType> _gathered_values;
+};
+
+} // namespace segment_v2
+} // namespace doris
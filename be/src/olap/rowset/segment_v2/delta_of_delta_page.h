@@ -0,0 +1,185 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+#include <vector>
+
+#include "common/status.h"
+#include "olap/rowset/segment_v2/decoded_page_decoder.h"
+#include "olap/rowset/segment_v2/options.h"
+#include "olap/rowset/segment_v2/page_builder.h"
+#include "olap/types.h"
+#include "util/coding.h"
+#include "util/faststring.h"
+#include "util/frame_of_reference_coding.h"
+#include "util/slice.h"
+
+namespace doris {
+namespace segment_v2 {
+
+inline uint64_t zigzag_encode(uint64_t v) {
+    return (v << 1) ^ static_cast<uint64_t>(static_cast<int64_t>(v) >> 63);
+}
+
+inline uint64_t zigzag_decode(uint64_t v) {
+    return (v >> 1) ^ (~(v & 1) + 1);
+}
+
+// Delta-of-delta encoding for the integral columns whose values grow at a nearly fixed
+// step, e.g. the timestamps of events. The difference of two adjacent deltas of such
+// values is zero or tiny, so they are packed into a few bits by frame-of-reference coding.
+//
+// The page layout is:
+//   NumValues(4) | FirstValue(sizeof(CppType)) | ForEncoded(zigzag(delta of delta))
+// The first delta is stored as the delta of delta against zero. The arithmetic is done on
+// uint64_t which wraps around, so any value of the type can be encoded losslessly.
+template <FieldType Type>
+class DeltaOfDeltaPageBuilder : public PageBuilder {
+public:
+    using CppType = typename TypeTraits<Type>::CppType;
+    static_assert(std::is_integral_v<CppType> && sizeof(CppType) <= sizeof(uint64_t),
+                  "delta of delta encoding only supports integral types of at most 64 bits");
+
+    explicit DeltaOfDeltaPageBuilder(const PageBuilderOptions& options)
+            : _options(options), _finished(false) {}
+
+    bool is_page_full() override {
+        return _values.size() * sizeof(CppType) >= _options.data_page_size;
+    }
+
+    Status add(const uint8_t* vals, size_t* count) override {
+        DCHECK(!_finished);
+        auto new_vals = reinterpret_cast<const CppType*>(vals);
+        _values.insert(_values.end(), new_vals, new_vals + *count);
+        return Status::OK();
+    }
+
+    OwnedSlice finish() override {
+        DCHECK(!_finished);
+        _finished = true;
+        _buf.clear();
+        put_fixed32_le(&_buf, static_cast<uint32_t>(_values.size()));
+        if (_values.empty()) {
+            return _buf.build();
+        }
+        _buf.append(&_values[0], sizeof(CppType));
+        if (_values.size() > 1) {
+            std::vector<uint64_t> dods(_values.size() - 1);
+            uint64_t prev_delta = 0;
+            for (size_t i = 1; i < _values.size(); ++i) {
+                uint64_t delta = static_cast<uint64_t>(_values[i]) -
+                                 static_cast<uint64_t>(_values[i - 1]);
+                dods[i - 1] = zigzag_encode(delta - prev_delta);
+                prev_delta = delta;
+            }
+            ForEncoder<uint64_t> encoder(&_buf);
+            encoder.put_batch(dods.data(), dods.size());
+            encoder.flush();
+        }
+        return _buf.build();
+    }
+
+    void reset() override {
+        _values.clear();
+        _buf.clear();
+        _finished = false;
+    }
+
+    size_t count() const override { return _values.size(); }
+
+    uint64_t size() const override {
+        return _finished ? _buf.size() : _values.size() * sizeof(CppType);
+    }
+
+    Status get_first_value(void* value) const override {
+        if (_values.empty()) {
+            return Status::NotFound("page is empty");
+        }
+        memcpy(value, &_values.front(), sizeof(CppType));
+        return Status::OK();
+    }
+
+    Status get_last_value(void* value) const override {
+        if (_values.empty()) {
+            return Status::NotFound("page is empty");
+        }
+        memcpy(value, &_values.back(), sizeof(CppType));
+        return Status::OK();
+    }
+
+private:
+    PageBuilderOptions _options;
+    bool _finished;
+    std::vector<CppType> _values;
+    faststring _buf;
+};
+
+template <FieldType Type>
+class DeltaOfDeltaPageDecoder : public DecodedPageDecoder<Type> {
+public:
+    using CppType = typename TypeTraits<Type>::CppType;
+
+    DeltaOfDeltaPageDecoder(Slice slice, const PageDecoderOptions& options)
+            : DecodedPageDecoder<Type>(slice, options) {}
+
+protected:
+    Status _decode_values() override {
+        const Slice& data = this->_data;
+        auto& values = this->_values;
+        if (data.size < sizeof(uint32_t)) {
+            return Status::Corruption("delta of delta page is too small, size={}", data.size);
+        }
+        uint32_t num_values = decode_fixed32_le((const uint8_t*)data.data);
+        if (num_values == 0) {
+            return Status::OK();
+        }
+        size_t header_size = sizeof(uint32_t) + sizeof(CppType);
+        if (data.size < header_size) {
+            return Status::Corruption("delta of delta page is too small, size={}", data.size);
+        }
+        values.resize(num_values);
+        memcpy(&values[0], data.data + sizeof(uint32_t), sizeof(CppType));
+        if (num_values == 1) {
+            return Status::OK();
+        }
+
+        ForDecoder<uint64_t> decoder((const uint8_t*)data.data + header_size,
+                                     data.size - header_size);
+        if (!decoder.init() || decoder.count() != num_values - 1) {
+            return Status::Corruption("the delta of delta page metadata maybe broken");
+        }
+        std::vector<uint64_t> dods(num_values - 1);
+        if (!decoder.get_batch(dods.data(), dods.size())) {
+            return Status::Corruption("failed to decode delta of delta page");
+        }
+        uint64_t prev = static_cast<uint64_t>(values[0]);
+        uint64_t delta = 0;
+        for (uint32_t i = 1; i < num_values; ++i) {
+            delta += zigzag_decode(dods[i - 1]);
+            prev += delta;
+            values[i] = static_cast<CppType>(prev);
+        }
+        return Status::OK();
+    }
+};
+
+} // namespace segment_v2
+} // namespace doris
@@ -25,11 +25,13 @@
 #include <utility>
 
 #include "olap/olap_common.h"
+#include "olap/rowset/segment_v2/alp_page.h"
 #include "olap/rowset/segment_v2/binary_dict_page.h"
 #include "olap/rowset/segment_v2/binary_plain_page.h"
 #include "olap/rowset/segment_v2/binary_prefix_page.h"
 #include "olap/rowset/segment_v2/bitshuffle_page.h"
 #include "olap/rowset/segment_v2/bitshuffle_page_pre_decoder.h"
+#include "olap/rowset/segment_v2/delta_of_delta_page.h"
 #include "olap/rowset/segment_v2/frame_of_reference_page.h"
 #include "olap/rowset/segment_v2/plain_page.h"
 #include "olap/rowset/segment_v2/rle_page.h"
@@ -171,6 +173,35 @@ struct TypeEncodingTraits<type, FOR_ENCODING, CppType,
     }
 };
 
+template <FieldType type, typename CppType>
+struct TypeEncodingTraits<type, DELTA_OF_DELTA_ENCODING, CppType,
+                          typename std::enable_if<std::is_integral<CppType>::value &&
+                                                  sizeof(CppType) <= sizeof(uint64_t)>::type> {
+    static Status create_page_builder(const PageBuilderOptions& opts, PageBuilder** builder) {
+        *builder = new DeltaOfDeltaPageBuilder<type>(opts);
+        return Status::OK();
+    }
+    static Status create_page_decoder(const Slice& data, const PageDecoderOptions& opts,
+                                      PageDecoder** decoder) {
+        *decoder = new DeltaOfDeltaPageDecoder<type>(data, opts);
+        return Status::OK();
+    }
+};
+
+template <FieldType type, typename CppType>
+struct TypeEncodingTraits<type, ALP_ENCODING, CppType,
+                          typename std::enable_if<std::is_floating_point<CppType>::value>::type> {
+    static Status create_page_builder(const PageBuilderOptions& opts, PageBuilder** builder) {
+        *builder = new AlpPageBuilder<type>(opts);
+        return Status::OK();
+    }
+    static Status create_page_decoder(const Slice& data, const PageDecoderOptions& opts,
+                                      PageDecoder** decoder) {
+        *decoder = new AlpPageDecoder<type>(data, opts);
+        return Status::OK();
+    }
+};
+
 template <FieldType type>
 struct TypeEncodingTraits<type, PREFIX_ENCODING, Slice> {
     static Status create_page_builder(const PageBuilderOptions& opts, PageBuilder** builder) {
@@ -249,10 +280,12 @@ EncodingInfoResolver::EncodingInfoResolver() {
 
     _add_map<FieldType::OLAP_FIELD_TYPE_INT, BIT_SHUFFLE>();
     _add_map<FieldType::OLAP_FIELD_TYPE_INT, FOR_ENCODING, true>();
+    _add_map<FieldType::OLAP_FIELD_TYPE_INT, DELTA_OF_DELTA_ENCODING>();
     _add_map<FieldType::OLAP_FIELD_TYPE_INT, PLAIN_ENCODING>();
 
     _add_map<FieldType::OLAP_FIELD_TYPE_BIGINT, BIT_SHUFFLE>();
     _add_map<FieldType::OLAP_FIELD_TYPE_BIGINT, FOR_ENCODING, true>();
+    _add_map<FieldType::OLAP_FIELD_TYPE_BIGINT, DELTA_OF_DELTA_ENCODING>();
     _add_map<FieldType::OLAP_FIELD_TYPE_BIGINT, PLAIN_ENCODING>();
 
     _add_map<FieldType::OLAP_FIELD_TYPE_UNSIGNED_BIGINT, BIT_SHUFFLE>();
@@ -264,9 +297,11 @@ EncodingInfoResolver::EncodingInfoResolver() {
 
     _add_map<FieldType::OLAP_FIELD_TYPE_FLOAT, BIT_SHUFFLE>();
     _add_map<FieldType::OLAP_FIELD_TYPE_FLOAT, PLAIN_ENCODING>();
+    _add_map<FieldType::OLAP_FIELD_TYPE_FLOAT, ALP_ENCODING>();
 
     _add_map<FieldType::OLAP_FIELD_TYPE_DOUBLE, BIT_SHUFFLE>();
     _add_map<FieldType::OLAP_FIELD_TYPE_DOUBLE, PLAIN_ENCODING>();
+    _add_map<FieldType::OLAP_FIELD_TYPE_DOUBLE, ALP_ENCODING>();
 
     _add_map<FieldType::OLAP_FIELD_TYPE_CHAR, DICT_ENCODING>();
     _add_map<FieldType::OLAP_FIELD_TYPE_CHAR, PLAIN_ENCODING>();
@@ -296,14 +331,17 @@ EncodingInfoResolver::EncodingInfoResolver() {
     _add_map<FieldType::OLAP_FIELD_TYPE_DATEV2, BIT_SHUFFLE>();
     _add_map<FieldType::OLAP_FIELD_TYPE_DATEV2, PLAIN_ENCODING>();
     _add_map<FieldType::OLAP_FIELD_TYPE_DATEV2, FOR_ENCODING, true>();
+    _add_map<FieldType::OLAP_FIELD_TYPE_DATEV2, DELTA_OF_DELTA_ENCODING>();
 
     _add_map<FieldType::OLAP_FIELD_TYPE_DATETIMEV2, BIT_SHUFFLE>();
     _add_map<FieldType::OLAP_FIELD_TYPE_DATETIMEV2, PLAIN_ENCODING>();
     _add_map<FieldType::OLAP_FIELD_TYPE_DATETIMEV2, FOR_ENCODING, true>();
+    _add_map<FieldType::OLAP_FIELD_TYPE_DATETIMEV2, DELTA_OF_DELTA_ENCODING>();
 
     _add_map<FieldType::OLAP_FIELD_TYPE_DATETIME, BIT_SHUFFLE>();
     _add_map<FieldType::OLAP_FIELD_TYPE_DATETIME, PLAIN_ENCODING>();
     _add_map<FieldType::OLAP_FIELD_TYPE_DATETIME, FOR_ENCODING, true>();
+    _add_map<FieldType::OLAP_FIELD_TYPE_DATETIME, DELTA_OF_DELTA_ENCODING>();
 
     _add_map<FieldType::OLAP_FIELD_TYPE_DECIMAL, BIT_SHUFFLE>();
     _add_map<FieldType::OLAP_FIELD_TYPE_DECIMAL, PLAIN_ENCODING>();
@@ -17,6 +17,9 @@
 
 #pragma once
 
+#include <algorithm>
+#include <vector>
+
 #include "olap/rowset/segment_v2/options.h"      // for PageBuilderOptions/PageDecoderOptions
 #include "olap/rowset/segment_v2/page_builder.h" // for PageBuilder
 #include "olap/rowset/segment_v2/page_decoder.h" // for PageDecoder
@@ -141,12 +144,81 @@ public:
         return Status::OK();
     }
 
+    template <bool forward_index = true>
+    Status next_batch(size_t* n, vectorized::MutableColumnPtr& dst) {
+        DCHECK(_parsed) << "Must call init() firstly";
+        if (PREDICT_FALSE(*n == 0 || _cur_index >= _num_elements)) {
+            *n = 0;
+            return Status::OK();
+        }
+
+        size_t max_fetch = std::min(*n, static_cast<size_t>(_num_elements - _cur_index));
+        // decode into the column directly if possible
+        CppType* values = append_raw_fix_len_data<CppType>(dst, max_fetch);
+        bool decode_to_column = values != nullptr;
+        if (!decode_to_column) {
+            _decoded_values.resize(max_fetch);
+            values = _decoded_values.data();
+        }
+        if (!_decoder->get_batch(values, max_fetch)) {
+            return Status::Corruption("failed to decode frame of reference page");
+        }
+        if (!decode_to_column) {
+            dst->insert_many_fix_len_data((const char*)values, max_fetch);
+        }
+        *n = max_fetch;
+        if constexpr (forward_index) {
+            _cur_index += max_fetch;
+        } else {
+            _decoder->skip(-static_cast<int32_t>(max_fetch));
+        }
+        return Status::OK();
+    }
+
     Status next_batch(size_t* n, vectorized::MutableColumnPtr& dst) override {
-        return Status::NotSupported("frame page not implement vec op now");
+        return next_batch<>(n, dst);
     }
 
     Status peek_next_batch(size_t* n, vectorized::MutableColumnPtr& dst) override {
-        return Status::NotSupported("frame page not implement vec op now");
+        return next_batch<false>(n, dst);
+    }
+
+    Status read_by_rowids(const rowid_t* rowids, ordinal_t page_first_ordinal, size_t* n,
+                          vectorized::MutableColumnPtr& dst) override {
+        DCHECK(_parsed) << "Must call init() firstly";
+        auto total = *n;
+        size_t read_count = 0;
+        // rowids are ascending, stop at the first one out of this page
+        while (read_count < total && rowids[read_count] - page_first_ordinal < _num_elements) {
+            ++read_count;
+        }
+        if (UNLIKELY(read_count == 0)) {
+            *n = 0;
+            return Status::OK();
+        }
+
+        CppType* values = append_raw_fix_len_data<CppType>(dst, read_count);
+        bool decode_to_column = values != nullptr;
+        if (!decode_to_column) {
+            _decoded_values.resize(read_count);
+            values = _decoded_values.data();
+        }
+        for (size_t i = 0; i < read_count; ++i) {
+            // the decoded frame is kept by decoder, so the rowids in one frame decode it once
+            int64_t ord = rowids[i] - page_first_ordinal;
+            _decoder->skip(static_cast<int32_t>(ord - _decoder->current_index()));
+            if (!_decoder->get(&values[i])) {
+                return Status::Corruption("failed to decode frame of reference page");
+            }
+        }
+        // read by rowids does not change the position of page
+        _decoder->skip(static_cast<int32_t>(static_cast<int64_t>(_cur_index) -
+                                            _decoder->current_index()));
+        if (!decode_to_column) {
+            dst->insert_many_fix_len_data((const char*)values, read_count);
+        }
+        *n = read_count;
+        return Status::OK();
     }
 
     size_t count() const override { return _num_elements; }
@@ -161,6 +233,8 @@ private:
     uint32_t _num_elements;
     size_t _cur_index;
     std::unique_ptr<ForDecoder<CppType>> _decoder;
+    // used when the values can not be decoded into column directly
+    std::vector<CppType> _decoded_values;
 };
 
 } // namespace segment_v2
@@ -18,21 +18,28 @@
 #include "olap/rowset/segment_v2/inverted_index_cache.h"
 
 #include <CLucene/debug/mem.h>
+#include <CLucene/index/IndexReader.h>
+#include <CLucene/index/Term.h>
+#include <CLucene/index/Terms.h>
 #include <CLucene/search/IndexSearcher.h>
 // IWYU pragma: no_include <bthread/errno.h>
 #include <errno.h> // IWYU pragma: keep
 #include <string.h>
 #include <sys/resource.h>
 // IWYU pragma: no_include <bits/chrono.h>
+#include <algorithm>
 #include <chrono> // IWYU pragma: keep
 #include <iostream>
 
+#include "common/config.h"
 #include "common/logging.h"
 #include "olap/olap_common.h"
 #include "olap/rowset/segment_v2/inverted_index_compound_directory.h"
 #include "olap/rowset/segment_v2/inverted_index_compound_reader.h"
 #include "runtime/thread_context.h"
+#include "util/countdown_latch.h"
 #include "util/defer_op.h"
+#include "util/murmur_hash3.h"
 #include "util/runtime_profile.h"
 
 namespace doris {
@@ -81,6 +88,8 @@ InvertedIndexSearcherCache::InvertedIndexSearcherCache(size_t capacity, uint32_t
     open_searcher_limit = 2;
 #endif
 
+    auto policy =
+            parse_cache_admission_policy(config::inverted_index_searcher_cache_admission_policy);
     if (config::enable_inverted_index_cache_check_timestamp) {
         auto get_last_visit_time = [](const void* value) -> int64_t {
             InvertedIndexSearcherCache::CacheValue* cache_value =
@@ -89,11 +98,18 @@ InvertedIndexSearcherCache::InvertedIndexSearcherCache(size_t capacity, uint32_t
         };
         _cache = std::unique_ptr<Cache>(
                 new ShardedLRUCache("InvertedIndexSearcherCache", capacity, LRUCacheType::SIZE,
-                                    num_shards, get_last_visit_time, true, open_searcher_limit));
+                                    num_shards, get_last_visit_time, true, open_searcher_limit,
+                                    policy));
     } else {
         _cache = std::unique_ptr<Cache>(new ShardedLRUCache("InvertedIndexSearcherCache", capacity,
                                                             LRUCacheType::SIZE, num_shards,
-                                                            open_searcher_limit));
+                                                            open_searcher_limit, policy));
+    }
+    if (config::inverted_index_searcher_open_threads > 0) {
+        ThreadPoolBuilder("InvertedIndexOpenThreadPool")
+                .set_min_threads(1)
+                .set_max_threads(config::inverted_index_searcher_open_threads)
+                .build(&_open_thread_pool);
     }
 }
 
@@ -179,6 +195,84 @@ Status InvertedIndexSearcherCache::erase(const std::string& index_file_path) {
     return Status::OK();
 }
 
+void InvertedIndexSearcherCache::prefetch_index_searchers(
+        const io::FileSystemSPtr& fs, const std::vector<std::string>& index_file_paths) {
+    if (_open_thread_pool == nullptr) {
+        return;
+    }
+    std::vector<io::Path> uncached_paths;
+    for (const auto& index_file_path : index_file_paths) {
+        auto lru_handle = _cache->lookup(index_file_path);
+        if (lru_handle != nullptr) {
+            _cache->release(lru_handle);
+            continue;
+        }
+        uncached_paths.emplace_back(index_file_path);
+    }
+    // the only one is opened by the query itself
+    if (uncached_paths.size() < 2) {
+        return;
+    }
+
+    CountDownLatch latch(uncached_paths.size());
+    for (const auto& path : uncached_paths) {
+        auto st = _open_thread_pool->submit_func([this, &fs, &path, &latch]() {
+            Defer defer {[&latch]() { latch.count_down(); }};
+            bool exists = false;
+            if (!fs->exists(path, &exists).ok() || !exists) {
+                return;
+            }
+            try {
+                insert(fs, path.parent_path().native(), path.filename().native());
+                auto term_cache = InvertedIndexTermCache::instance();
+                InvertedIndexCacheHandle handle;
+                if (term_cache != nullptr && _lookup(CacheKey(path.native()), &handle) &&
+                    handle.get_index_searcher() != nullptr) {
+                    term_cache->insert(path.native(),
+                                       handle.get_index_searcher()->getReader());
+                }
+            } catch (const CLuceneError& e) {
+                LOG(WARNING) << "failed to open index searcher of " << path.native()
+                             << ", error=" << e.what();
+            }
+        });
+        if (!st.ok()) {
+            latch.count_down();
+        }
+    }
+    latch.wait();
+}
+
+void InvertedIndexSearcherCache::build_term_filter_async(const std::string& index_file_path,
+                                                         IndexSearcherPtr searcher) {
+    auto term_cache = InvertedIndexTermCache::instance();
+    if (_open_thread_pool == nullptr || term_cache == nullptr || searcher == nullptr) {
+        return;
+    }
+    {
+        std::lock_guard l(_building_lock);
+        if (!_building_term_filters.insert(index_file_path).second) {
+            return;
+        }
+    }
+    auto st = _open_thread_pool->submit_func([this, term_cache, index_file_path, searcher]() {
+        try {
+            if (term_cache->lookup(index_file_path) == nullptr) {
+                term_cache->insert(index_file_path, searcher->getReader());
+            }
+        } catch (const CLuceneError& e) {
+            LOG(WARNING) << "failed to build term filter of " << index_file_path
+                         << ", error=" << e.what();
+        }
+        std::lock_guard l(_building_lock);
+        _building_term_filters.erase(index_file_path);
+    });
+    if (!st.ok()) {
+        std::lock_guard l(_building_lock);
+        _building_term_filters.erase(index_file_path);
+    }
+}
+
 int64_t InvertedIndexSearcherCache::prune() {
     if (_cache) {
         const int64_t curtime = UnixMillis();
@@ -235,6 +329,81 @@ Cache::Handle* InvertedIndexSearcherCache::_insert(const InvertedIndexSearcherCa
     return lru_handle;
 }
 
+InvertedIndexTermCache* InvertedIndexTermCache::_s_instance = nullptr;
+
+void InvertedIndexTermCache::create_global_cache(size_t capacity, uint32_t num_shards) {
+    DCHECK(_s_instance == nullptr);
+    static InvertedIndexTermCache instance(capacity, num_shards);
+    _s_instance = &instance;
+}
+
+InvertedIndexTermCache::InvertedIndexTermCache(size_t capacity, uint32_t num_shards) {
+    if (capacity > 0) {
+        _cache = std::unique_ptr<Cache>(
+                new_lru_cache("InvertedIndexTermCache", capacity, LRUCacheType::SIZE, num_shards));
+    }
+}
+
+std::shared_ptr<const BloomFilter> InvertedIndexTermCache::lookup(
+        const std::string& index_file_path) {
+    if (_cache == nullptr) {
+        return nullptr;
+    }
+    auto lru_handle = _cache->lookup(index_file_path);
+    if (lru_handle == nullptr) {
+        return nullptr;
+    }
+    auto filter = ((CacheValue*)_cache->value(lru_handle))->filter;
+    _cache->release(lru_handle);
+    return filter;
+}
+
+Status InvertedIndexTermCache::insert(const std::string& index_file_path,
+                                      lucene::index::IndexReader* reader) {
+    if (_cache == nullptr) {
+        return Status::OK();
+    }
+    // an index file only has the terms of its column
+    std::vector<uint64_t> hashes;
+    lucene::index::TermEnum* term_enum = reader->terms();
+    Defer close_term_enum {[&term_enum]() {
+        term_enum->close();
+        _CLDELETE(term_enum);
+    }};
+    while (term_enum->next()) {
+        lucene::index::Term* term = term_enum->term();
+        hashes.push_back(_hash(term->text(), term->textLength()));
+        _CLDECDELETE(term);
+    }
+
+    std::unique_ptr<BloomFilter> filter;
+    RETURN_IF_ERROR(BloomFilter::create(BLOCK_BLOOM_FILTER, &filter));
+    RETURN_IF_ERROR(filter->init(std::max<size_t>(hashes.size(), 1), 0.01, HASH_MURMUR3_X64_64));
+    for (auto hash : hashes) {
+        filter->add_hash(hash);
+    }
+    auto value = std::make_unique<CacheValue>();
+    size_t size = filter->size();
+    value->filter = std::move(filter);
+    auto deleter = [](const doris::CacheKey& key, void* value) { delete (CacheValue*)value; };
+    auto lru_handle = _cache->insert(index_file_path, value.release(), size, deleter,
+                                     CachePriority::NORMAL);
+    _cache->release(lru_handle);
+    return Status::OK();
+}
+
+void InvertedIndexTermCache::erase(const std::string& index_file_path) {
+    if (_cache != nullptr) {
+        _cache->erase(index_file_path);
+    }
+}
+
+uint64_t InvertedIndexTermCache::_hash(const wchar_t* text, size_t length) {
+    uint64_t hash_code = 0;
+    murmur_hash3_x64_64(text, length * sizeof(wchar_t), BloomFilter::DEFAULT_SEED, &hash_code);
+    return hash_code;
+}
+
 InvertedIndexQueryCache* InvertedIndexQueryCache::_s_instance = nullptr;
 
 bool InvertedIndexQueryCache::lookup(const CacheKey& key, InvertedIndexQueryCacheHandle* handle) {
@@ -26,20 +26,28 @@
 
 #include <atomic>
 #include <memory>
+#include <mutex>
 #include <roaring/roaring.hh>
 #include <string>
+#include <unordered_set>
 #include <utility>
+#include <vector>
 
 #include "common/config.h"
 #include "common/status.h"
 #include "io/fs/file_system.h"
 #include "io/fs/path.h"
 #include "olap/lru_cache.h"
+#include "olap/rowset/segment_v2/bloom_filter.h"
 #include "runtime/memory/mem_tracker.h"
 #include "util/slice.h"
+#include "util/threadpool.h"
 #include "util/time.h"
 
 namespace lucene {
+namespace index {
+class IndexReader;
+} // namespace index
 namespace search {
 class IndexSearcher;
 } // namespace search
@@ -96,10 +104,23 @@ public:
     // function `erase` called after compaction remove segment
     Status erase(const std::string& index_file_path);
 
+    // Open the index searchers which are not cached in parallel, e.g. of all segments of a
+    // rowset before they are queried one by one. The index files not built are skipped.
+    void prefetch_index_searchers(const io::FileSystemSPtr& fs,
+                                  const std::vector<std::string>& index_file_paths);
+
+    // build the term filter of an opened index searcher in background
+    void build_term_filter_async(const std::string& index_file_path, IndexSearcherPtr searcher);
+
     int64_t prune();
 
+    // evict the least recently visited entries of about bytes, return the bytes evicted
+    int64_t evict(int64_t bytes) { return _cache ? _cache->evict(bytes) : 0; }
+
     int64_t mem_consumption();
 
+    uint64_t hit_count() { return _cache ? _cache->get_hit_count() : 0; }
+
 private:
     InvertedIndexSearcherCache();
 
@@ -118,6 +139,10 @@ private:
     // A LRU cache to cache all opened index_searcher
     std::unique_ptr<Cache> _cache = nullptr;
     std::unique_ptr<MemTracker> _mem_tracker = nullptr;
+    // open the index searchers and build the term filters
+    std::unique_ptr<ThreadPool> _open_thread_pool;
+    std::mutex _building_lock;
+    std::unordered_set<std::string> _building_term_filters;
 };
 
 using IndexCacheValuePtr = std::unique_ptr<InvertedIndexSearcherCache::CacheValue>;
@@ -242,13 +267,62 @@ public:
 
     int64_t prune();
 
+    // evict the least recently visited entries of about bytes, return the bytes evicted
+    int64_t evict(int64_t bytes) { return _cache ? _cache->evict(bytes) : 0; }
+
     int64_t mem_consumption();
 
+    uint64_t hit_count() { return _cache ? _cache->get_hit_count() : 0; }
+
 private:
     static InvertedIndexQueryCache* _s_instance;
     std::unique_ptr<Cache> _cache {nullptr};
 };
 
+// Caches a bloom filter over the terms of a fulltext index file. It takes about 10 bits per
+// term, while an index searcher holds the term index, the file handles and the read buffers
+// of the file, so many more segments fit in the memory. A filter outlives the evicted
+// searcher of its file, and a query of the terms absent from a segment is answered without
+// opening the searcher again.
+class InvertedIndexTermCache {
+public:
+    static void create_global_cache(size_t capacity, uint32_t num_shards = 16);
+
+    static InvertedIndexTermCache* instance() { return _s_instance; }
+
+    InvertedIndexTermCache(size_t capacity, uint32_t num_shards);
+
+    // nullptr if the terms of the index file are not cached
+    std::shared_ptr<const BloomFilter> lookup(const std::string& index_file_path);
+
+    // scan all terms of the reader to build the filter of the index file
+    Status insert(const std::string& index_file_path, lucene::index::IndexReader* reader);
+
+    void erase(const std::string& index_file_path);
+
+    static bool may_contain(const BloomFilter& filter, const std::wstring& term) {
+        return filter.test_hash(_hash(term.data(), term.size()));
+    }
+
+    // evict the least recently visited entries of about bytes, return the bytes evicted
+    int64_t evict(int64_t bytes) { return _cache ? _cache->evict(bytes) : 0; }
+
+    int64_t mem_consumption() { return _cache ? _cache->mem_consumption() : 0; }
+
+    uint64_t hit_count() { return _cache ? _cache->get_hit_count() : 0; }
+
+private:
+    struct CacheValue {
+        std::shared_ptr<const BloomFilter> filter;
+    };
+
+    static uint64_t _hash(const wchar_t* text, size_t length);
+
+    static InvertedIndexTermCache* _s_instance;
+    // nullptr if the cache is disabled
+    std::unique_ptr<Cache> _cache;
+};
+
 class InvertedIndexQueryCacheHandle {
 public:
     InvertedIndexQueryCacheHandle() {}
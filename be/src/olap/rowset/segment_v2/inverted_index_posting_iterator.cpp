@@ -0,0 +1,186 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "olap/rowset/segment_v2/inverted_index_posting_iterator.h"
+
+#include <CLucene.h> // IWYU pragma: keep
+#include <CLucene/index/IndexReader.h>
+
+#include <algorithm>
+#include <roaring/roaring.hh>
+#include <utility>
+
+#include "common/logging.h"
+
+namespace doris {
+namespace segment_v2 {
+
+TermPostingIterator::TermPostingIterator(lucene::index::TermDocs* term_docs, uint64_t doc_freq)
+        : _term_docs(term_docs), _doc_freq(doc_freq) {}
+
+TermPostingIterator::~TermPostingIterator() {
+    if (_term_docs != nullptr) {
+        _term_docs->close();
+        _CLDELETE(_term_docs);
+    }
+}
+
+uint32_t TermPostingIterator::next() {
+    _doc = _term_docs->next() ? _term_docs->doc() : END;
+    return _doc;
+}
+
+uint32_t TermPostingIterator::advance(uint32_t target) {
+    _doc = _term_docs->skipTo(static_cast<int32_t>(target)) ? _term_docs->doc() : END;
+    return _doc;
+}
+
+ConjunctionPostingIterator::ConjunctionPostingIterator(std::vector<PostingIteratorPtr> iterators)
+        : _iterators(std::move(iterators)) {
+    DCHECK(!_iterators.empty());
+    std::sort(_iterators.begin(), _iterators.end(),
+              [](const auto& lhs, const auto& rhs) { return lhs->cost() < rhs->cost(); });
+}
+
+uint32_t ConjunctionPostingIterator::next() {
+    if (!_started) {
+        _started = true;
+        for (auto& iterator : _iterators) {
+            iterator->next();
+        }
+        return _doc = _do_next(_iterators.front()->doc());
+    }
+    return _doc = _do_next(_iterators.front()->next());
+}
+
+uint32_t ConjunctionPostingIterator::advance(uint32_t target) {
+    if (!_started) {
+        _started = true;
+        for (auto& iterator : _iterators) {
+            iterator->next();
+        }
+    }
+    auto& lead = _iterators.front();
+    return _doc = _do_next(lead->doc() >= target ? lead->doc() : lead->advance(target));
+}
+
+uint32_t ConjunctionPostingIterator::_do_next(uint32_t doc) {
+    auto& lead = _iterators.front();
+    while (doc != END) {
+        bool matched = true;
+        for (size_t i = 1; i < _iterators.size(); ++i) {
+            uint32_t other_doc = _iterators[i]->doc();
+            if (other_doc < doc) {
+                other_doc = _iterators[i]->advance(doc);
+            }
+            if (other_doc > doc) {
+                doc = other_doc == END ? END : lead->advance(other_doc);
+                matched = false;
+                break;
+            }
+        }
+        if (matched) {
+            return doc;
+        }
+    }
+    return END;
+}
+
+static bool heap_greater(const PostingIteratorPtr& lhs, const PostingIteratorPtr& rhs) {
+    return lhs->doc() > rhs->doc();
+}
+
+DisjunctionPostingIterator::DisjunctionPostingIterator(std::vector<PostingIteratorPtr> iterators)
+        : _heap(std::move(iterators)) {}
+
+uint64_t DisjunctionPostingIterator::cost() const {
+    uint64_t cost = 0;
+    for (const auto& iterator : _heap) {
+        cost += iterator->cost();
+    }
+    return cost;
+}
+
+uint32_t DisjunctionPostingIterator::next() {
+    if (!_started) {
+        _started = true;
+        for (auto& iterator : _heap) {
+            iterator->next();
+        }
+        std::make_heap(_heap.begin(), _heap.end(), heap_greater);
+    } else {
+        uint32_t doc = _doc;
+        while (!_heap.empty() && _heap.front()->doc() == doc) {
+            std::pop_heap(_heap.begin(), _heap.end(), heap_greater);
+            _heap.back()->next();
+            std::push_heap(_heap.begin(), _heap.end(), heap_greater);
+        }
+    }
+    _update_doc();
+    return _doc;
+}
+
+uint32_t DisjunctionPostingIterator::advance(uint32_t target) {
+    if (!_started) {
+        _started = true;
+        for (auto& iterator : _heap) {
+            iterator->advance(target);
+        }
+        std::make_heap(_heap.begin(), _heap.end(), heap_greater);
+    } else {
+        while (!_heap.empty() && _heap.front()->doc() < target) {
+            std::pop_heap(_heap.begin(), _heap.end(), heap_greater);
+            _heap.back()->advance(target);
+            std::push_heap(_heap.begin(), _heap.end(), heap_greater);
+        }
+    }
+    _update_doc();
+    return _doc;
+}
+
+void DisjunctionPostingIterator::_update_doc() {
+    // the exhausted iterators have the largest docid, they are on the top only if all are
+    while (!_heap.empty() && _heap.front()->doc() == END) {
+        std::pop_heap(_heap.begin(), _heap.end(), heap_greater);
+        _heap.pop_back();
+    }
+    _doc = _heap.empty() ? END : _heap.front()->doc();
+}
+
+uint32_t collect_postings(PostingIterator* iterator, const roaring::Roaring& candidates,
+                          uint32_t limit, roaring::Roaring* result) {
+    uint32_t count = 0;
+    auto candidate = candidates.begin();
+    uint32_t doc = iterator->next();
+    while (doc != PostingIterator::END && count < limit) {
+        candidate.equalorlarger(doc);
+        if (candidate == candidates.end()) {
+            break;
+        }
+        if (*candidate == doc) {
+            result->add(doc);
+            ++count;
+            doc = iterator->next();
+        } else {
+            doc = iterator->advance(*candidate);
+        }
+    }
+    return count;
+}
+
+} // namespace segment_v2
+} // namespace doris
@@ -0,0 +1,126 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <stdint.h>
+
+#include <limits>
+#include <memory>
+#include <vector>
+
+namespace lucene {
+namespace index {
+class TermDocs;
+} // namespace index
+} // namespace lucene
+namespace roaring {
+class Roaring;
+} // namespace roaring
+
+namespace doris {
+namespace segment_v2 {
+
+// Iterates the docids of the postings of a query in ascending order. The docid of an inverted
+// index is the rowid in its segment, so the matched rows can be consumed in rowid order and
+// the iteration stops as soon as enough rows are found, instead of building the bitmap of all
+// matched rows first.
+class PostingIterator {
+public:
+    static constexpr uint32_t END = std::numeric_limits<uint32_t>::max();
+
+    virtual ~PostingIterator() = default;
+
+    // the current docid, END if exhausted, undefined before the first next() or advance()
+    uint32_t doc() const { return _doc; }
+
+    // advance to the next docid
+    virtual uint32_t next() = 0;
+
+    // advance to the first docid >= target, target must be larger than the current docid
+    virtual uint32_t advance(uint32_t target) = 0;
+
+    // the estimated number of docids, to order the iterators of a conjunction
+    virtual uint64_t cost() const = 0;
+
+protected:
+    uint32_t _doc = 0;
+};
+
+using PostingIteratorPtr = std::unique_ptr<PostingIterator>;
+
+// The postings of a term, advance() jumps by the skip list of the posting list.
+// Takes the ownership of term_docs.
+class TermPostingIterator : public PostingIterator {
+public:
+    TermPostingIterator(lucene::index::TermDocs* term_docs, uint64_t doc_freq);
+    ~TermPostingIterator() override;
+
+    uint32_t next() override;
+    uint32_t advance(uint32_t target) override;
+    uint64_t cost() const override { return _doc_freq; }
+
+private:
+    lucene::index::TermDocs* _term_docs;
+    uint64_t _doc_freq;
+};
+
+// The docids in all of the iterators, for MATCH_ALL. The rarest iterator leads and the others
+// advance to its docid, so the cost is bounded by the rarest term.
+class ConjunctionPostingIterator : public PostingIterator {
+public:
+    explicit ConjunctionPostingIterator(std::vector<PostingIteratorPtr> iterators);
+
+    uint32_t next() override;
+    uint32_t advance(uint32_t target) override;
+    uint64_t cost() const override { return _iterators.front()->cost(); }
+
+private:
+    // find the first docid >= target in all of the iterators
+    uint32_t _do_next(uint32_t target);
+
+    bool _started = false;
+    // ordered by cost, the first one leads
+    std::vector<PostingIteratorPtr> _iterators;
+};
+
+// The docids in any of the iterators, for MATCH_ANY.
+class DisjunctionPostingIterator : public PostingIterator {
+public:
+    explicit DisjunctionPostingIterator(std::vector<PostingIteratorPtr> iterators);
+
+    uint32_t next() override;
+    uint32_t advance(uint32_t target) override;
+    uint64_t cost() const override;
+
+private:
+    // restore the min heap of the iterators by their docids and set _doc to the top
+    void _update_doc();
+
+    bool _started = false;
+    // min heap by the current docid
+    std::vector<PostingIteratorPtr> _heap;
+};
+
+// Add the first limit docids of the iterator which are in the candidates to result. The docids
+// not in the candidates, e.g. the deleted rows, are skipped by advancing to the next candidate.
+// Returns the number of docids added.
+uint32_t collect_postings(PostingIterator* iterator, const roaring::Roaring& candidates,
+                          uint32_t limit, roaring::Roaring* result);
+
+} // namespace segment_v2
+} // namespace doris
@@ -53,6 +53,7 @@
 #include "olap/rowset/segment_v2/inverted_index_cache.h"
 #include "olap/rowset/segment_v2/inverted_index_compound_directory.h"
 #include "olap/rowset/segment_v2/inverted_index_desc.h"
+#include "olap/rowset/segment_v2/inverted_index_posting_iterator.h"
 #include "olap/types.h"
 #include "util/faststring.h"
 #include "util/runtime_profile.h"
@@ -261,6 +262,8 @@ Status FullTextIndexReader::query(OlapReaderStatistics* stats, const std::string
             InvertedIndexSearcherCache::instance()->get_index_searcher(
                     _fs, index_dir.c_str(), index_file_name, &inverted_index_cache_handle, stats);
             auto index_searcher = inverted_index_cache_handle.get_index_searcher();
+            InvertedIndexSearcherCache::instance()->build_term_filter_async(
+                    index_file_path.native(), index_searcher);
 
             // try to reuse index_searcher's directory to read null_bitmap to cache
             // to avoid open directory additionally for null_bitmap
@@ -291,6 +294,16 @@ Status FullTextIndexReader::query(OlapReaderStatistics* stats, const std::string
             return Status::OK();
         };
 
+        // the term filter tells the tokens absent from the index file without opening it
+        std::shared_ptr<const BloomFilter> term_filter;
+        if (InvertedIndexTermCache::instance() != nullptr) {
+            term_filter = InvertedIndexTermCache::instance()->lookup(index_file_path.native());
+        }
+        auto absent = [&term_filter](const std::wstring& token) {
+            return term_filter != nullptr &&
+                   !InvertedIndexTermCache::may_contain(*term_filter, token);
+        };
+
         roaring::Roaring query_match_bitmap;
         bool null_bitmap_already_read = false;
         if (query_type == InvertedIndexQueryType::MATCH_PHRASE_QUERY) {
@@ -313,6 +326,10 @@ Status FullTextIndexReader::query(OlapReaderStatistics* stats, const std::string
             } else {
                 stats->inverted_index_query_cache_miss++;
 
+                if (std::any_of(analyse_result.begin(), analyse_result.end(), absent)) {
+                    bit_map->clear();
+                    return Status::OK();
+                }
                 term_match_bitmap = std::make_shared<roaring::Roaring>();
 
                 auto* phrase_query = new lucene::search::PhraseQuery();
@@ -343,6 +360,10 @@ Status FullTextIndexReader::query(OlapReaderStatistics* stats, const std::string
                 if (cache->lookup(cache_key, &cache_handle)) {
                     stats->inverted_index_query_cache_hit++;
                     term_match_bitmap = cache_handle.get_bitmap();
+                } else if (absent(token_ws)) {
+                    stats->inverted_index_query_cache_miss++;
+                    // no row has the token
+                    term_match_bitmap = std::make_shared<roaring::Roaring>();
                 } else {
                     stats->inverted_index_query_cache_miss++;
 
@@ -394,6 +415,90 @@ Status FullTextIndexReader::query(OlapReaderStatistics* stats, const std::string
     }
 }
 
+Status FullTextIndexReader::query_with_limit(OlapReaderStatistics* stats,
+                                             const std::string& column_name,
+                                             const void* query_value,
+                                             InvertedIndexQueryType query_type,
+                                             const roaring::Roaring& candidate_rows,
+                                             uint32_t limit, roaring::Roaring* bit_map) {
+    SCOPED_RAW_TIMER(&stats->inverted_index_query_timer);
+    DCHECK(query_type == InvertedIndexQueryType::MATCH_ANY_QUERY ||
+           query_type == InvertedIndexQueryType::MATCH_ALL_QUERY);
+
+    std::string search_str = reinterpret_cast<const StringRef*>(query_value)->to_string();
+    io::Path path(_path);
+    auto index_dir = path.parent_path();
+    auto index_file_name =
+            InvertedIndexDescriptor::get_index_file_name(path.filename(), _index_meta.index_id());
+    auto index_file_path = index_dir / index_file_name;
+    InvertedIndexCtxSPtr inverted_index_ctx = std::make_shared<InvertedIndexCtx>();
+    inverted_index_ctx->parser_type = get_inverted_index_parser_type_from_string(
+            get_parser_string_from_properties(_index_meta.properties()));
+    inverted_index_ctx->parser_mode =
+            get_parser_mode_string_from_properties(_index_meta.properties());
+    try {
+        std::vector<std::wstring> analyse_result =
+                get_analyse_result(column_name, search_str, query_type, inverted_index_ctx.get());
+        if (analyse_result.empty()) {
+            LOG(WARNING) << "invalid input query_str: " << search_str
+                         << ", please check your query sql";
+            return Status::Error<ErrorCode::INVERTED_INDEX_NO_TERMS>();
+        }
+        if (!indexExists(index_file_path)) {
+            LOG(WARNING) << "inverted index path: " << index_file_path.string() << " not exist.";
+            return Status::Error<ErrorCode::INVERTED_INDEX_FILE_NOT_FOUND>();
+        }
+
+        InvertedIndexCacheHandle inverted_index_cache_handle;
+        InvertedIndexSearcherCache::instance()->get_index_searcher(
+                _fs, index_dir.c_str(), index_file_name, &inverted_index_cache_handle, stats);
+        auto index_searcher = inverted_index_cache_handle.get_index_searcher();
+        auto index_reader = index_searcher->getReader();
+        // read null_bitmap to cache by the directory of the searcher, as query() does
+        InvertedIndexQueryCacheHandle null_bitmap_cache_handle;
+        read_null_bitmap(&null_bitmap_cache_handle, index_reader->directory());
+
+        SCOPED_RAW_TIMER(&stats->inverted_index_searcher_search_timer);
+        std::wstring field_ws = std::wstring(column_name.begin(), column_name.end());
+        std::set<std::wstring> tokens(analyse_result.begin(), analyse_result.end());
+        std::vector<PostingIteratorPtr> iterators;
+        for (const auto& token : tokens) {
+            std::unique_ptr<lucene::index::Term, void (*)(lucene::index::Term*)> term {
+                    _CLNEW lucene::index::Term(field_ws.c_str(), token.c_str()),
+                    [](lucene::index::Term* term) { _CLDECDELETE(term); }};
+            int32_t doc_freq = index_reader->docFreq(term.get());
+            if (doc_freq == 0) {
+                if (query_type == InvertedIndexQueryType::MATCH_ALL_QUERY) {
+                    // no row has all of the terms
+                    bit_map->clear();
+                    return Status::OK();
+                }
+                continue;
+            }
+            iterators.push_back(std::make_unique<TermPostingIterator>(
+                    index_reader->termDocs(term.get()), doc_freq));
+        }
+
+        roaring::Roaring result;
+        if (!iterators.empty()) {
+            PostingIteratorPtr iterator;
+            if (iterators.size() == 1) {
+                iterator = std::move(iterators[0]);
+            } else if (query_type == InvertedIndexQueryType::MATCH_ALL_QUERY) {
+                iterator = std::make_unique<ConjunctionPostingIterator>(std::move(iterators));
+            } else {
+                iterator = std::make_unique<DisjunctionPostingIterator>(std::move(iterators));
+            }
+            collect_postings(iterator.get(), candidate_rows, limit, &result);
+        }
+        bit_map->swap(result);
+        return Status::OK();
+    } catch (const CLuceneError& e) {
+        LOG(WARNING) << "CLuceneError occured, error msg: " << e.what();
+        return Status::Error<ErrorCode::INVERTED_INDEX_CLUCENE_ERROR>();
+    }
+}
+
 InvertedIndexReaderType FullTextIndexReader::type() {
     return InvertedIndexReaderType::FULLTEXT;
 }
@@ -893,6 +998,13 @@ Status InvertedIndexIterator::read_from_inverted_index(const std::string& column
         }
     }
 
+    if (_read_limit > 0 && _reader->type() == InvertedIndexReaderType::FULLTEXT &&
+        (query_type == InvertedIndexQueryType::MATCH_ANY_QUERY ||
+         query_type == InvertedIndexQueryType::MATCH_ALL_QUERY)) {
+        return static_cast<FullTextIndexReader*>(_reader)->query_with_limit(
+                _stats, column_name, query_value, query_type, *_candidate_rows, _read_limit,
+                bit_map);
+    }
     RETURN_IF_ERROR(_reader->query(_stats, column_name, query_value, query_type, bit_map));
     return Status::OK();
 }
@@ -134,6 +134,15 @@ public:
         return Status::Error<ErrorCode::NOT_IMPLEMENTED_ERROR>();
     }
 
+    // Same as query() for MATCH_ANY and MATCH_ALL, but only find the first limit matched rows
+    // in rowid order among the candidate rows. The posting lists of the terms are iterated
+    // from the index lazily and merged or intersected by their skip lists, the result is
+    // not cached since it is partial.
+    Status query_with_limit(OlapReaderStatistics* stats, const std::string& column_name,
+                            const void* query_value, InvertedIndexQueryType query_type,
+                            const roaring::Roaring& candidate_rows, uint32_t limit,
+                            roaring::Roaring* bit_map);
+
     InvertedIndexReaderType type() override;
 };
 
@@ -235,6 +244,14 @@ public:
     Status try_read_from_inverted_index(const std::string& column_name, const void* query_value,
                                         InvertedIndexQueryType query_type, uint32_t* count);
 
+    // Only read the first limit matched rows among the candidate rows by the following match
+    // queries of the fulltext index, see FullTextIndexReader::query_with_limit. 0 is no limit.
+    // The candidate rows must outlive the reads.
+    void set_read_limit(uint32_t limit, const roaring::Roaring* candidate_rows) {
+        _read_limit = limit;
+        _candidate_rows = candidate_rows;
+    }
+
     Status read_null_bitmap(InvertedIndexQueryCacheHandle* cache_handle,
                             lucene::store::Directory* dir = nullptr) {
         return _reader->read_null_bitmap(cache_handle, dir);
@@ -246,6 +263,8 @@ public:
 private:
     OlapReaderStatistics* _stats;
     InvertedIndexReader* _reader;
+    uint32_t _read_limit = 0;
+    const roaring::Roaring* _candidate_rows = nullptr;
 };
 
 } // namespace segment_v2
@@ -17,12 +17,36 @@
 
 #pragma once
 
+#include <memory>
+#include <type_traits>
+
 #include "common/status.h" // for Status
 #include "vec/columns/column.h"
+#include "vec/columns/column_vector.h"
+#include "vec/common/typeid_cast.h"
 
 namespace doris {
 namespace segment_v2 {
 
+// If `dst` is a ColumnVector storing values of `CppType` as is, append `n` uninitialized values
+// to it and return the address of the first one, so that the decoder writes into the column
+// directly. Otherwise return nullptr, and the decoder should insert the values by
+// insert_many_fix_len_data, which converts them to the type of column.
+template <typename CppType>
+CppType* append_raw_fix_len_data(vectorized::MutableColumnPtr& dst, size_t n) {
+    if constexpr ((std::is_integral_v<CppType> && !std::is_same_v<CppType, bool>) ||
+                  std::is_floating_point_v<CppType> || std::is_same_v<CppType, __int128>) {
+        auto* column = typeid_cast<vectorized::ColumnVector<CppType>*>(dst.get());
+        if (column != nullptr && !column->is_date && !column->is_date_time) {
+            auto& data = column->get_data();
+            size_t old_size = data.size();
+            data.resize(old_size + n);
+            return data.data() + old_size;
+        }
+    }
+    return nullptr;
+}
+
 // PageDecoder is used to decode page.
 class PageDecoder {
 public:
@@ -78,6 +102,14 @@ public:
         return Status::NotSupported("not implement vec op now");
     }
 
+    // Borrow at most *n next values of the page without copying them, only supported by the
+    // pages whose memory holds the values in the layout of ColumnVector. The column returned
+    // keeps the memory alive by `owner`.
+    virtual Status borrow_batch(size_t* n, const std::shared_ptr<const void>& owner,
+                                vectorized::ColumnPtr* dst) {
+        return Status::NotSupported("borrow_batch is not supported");
+    }
+
     // Same as `next_batch` except for not moving forward the cursor.
     // When read array's ordinals in `ArrayFileColumnIterator`, we want to read one extra ordinal
     // but do not want to move forward the cursor.
@@ -40,6 +40,7 @@
 #include "util/crc32c.h"
 #include "util/faststring.h"
 #include "util/runtime_profile.h"
+#include "util/time.h"
 
 namespace doris {
 namespace segment_v2 {
@@ -118,13 +119,17 @@ Status PageIO::read_and_decompress_page(const PageReadOptions& opts, PageHandle*
 
     auto cache = StoragePageCache::instance();
     PageCacheHandle cache_handle;
-    StoragePageCache::CacheKey cache_key(opts.file_reader->path().native(),
-                                         opts.file_reader->size(), opts.page_pointer.offset);
+    StoragePageCache::CacheKey cache_key(opts.file_reader->file_id(), opts.page_pointer.offset);
+    int64_t lookup_start_ns = opts.io_ctx.io_stats != nullptr ? MonotonicNanos() : 0;
     if (opts.use_page_cache && cache->is_cache_available(opts.type) &&
         cache->lookup(cache_key, &cache_handle, opts.type)) {
         // we find page in cache, use it
         *handle = PageHandle(std::move(cache_handle));
         opts.stats->cached_pages_num++;
+        if (opts.io_ctx.io_stats != nullptr) {
+            opts.io_ctx.io_stats->record(io::IOTier::PAGE_CACHE, opts.page_pointer.size,
+                                         MonotonicNanos() - lookup_start_ns);
+        }
         // parse body and footer
         Slice page_slice = handle->data();
         uint32_t footer_size = decode_fixed32_le((uint8_t*)page_slice.data + page_slice.size - 4);
@@ -43,7 +43,7 @@ struct ParsedPage {
                          PageDecoderOptions opts = PageDecoderOptions()) {
         result->~ParsedPage();
         ParsedPage* page = new (result)(ParsedPage);
-        page->page_handle = std::move(handle);
+        page->page_handle = std::make_shared<PageHandle>(std::move(handle));
 
         auto null_size = footer.nullmap_size();
         page->has_null = null_size > 0;
@@ -78,7 +78,8 @@ struct ParsedPage {
 
     ~ParsedPage() { data_decoder = nullptr; }
 
-    PageHandle page_handle;
+    // shared with the columns borrowing the memory of the page, see PageDecoder::borrow_batch
+    std::shared_ptr<PageHandle> page_handle;
 
     bool has_null;
     Slice null_bitmap;
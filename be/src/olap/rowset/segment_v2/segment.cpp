@@ -26,8 +26,10 @@
 #include <memory>
 #include <utility>
 
+#include "common/config.h"
 #include "common/logging.h"
 #include "common/status.h"
+#include "io/cache/block/cached_remote_file_reader.h"
 #include "io/fs/file_reader.h"
 #include "io/fs/file_system.h"
 #include "io/io_common.h"
@@ -40,6 +42,7 @@
 #include "olap/rowset/segment_v2/indexed_column_reader.h"
 #include "olap/rowset/segment_v2/page_io.h"
 #include "olap/rowset/segment_v2/page_pointer.h"
+#include "olap/rowset/segment_v2/segment_footer_meta_manager.h"
 #include "olap/rowset/segment_v2/segment_iterator.h"
 #include "olap/rowset/segment_v2/segment_writer.h" // k_segment_magic_length
 #include "olap/schema.h"
@@ -75,7 +78,7 @@ using io::FileCacheManager;
 Status Segment::open(io::FileSystemSPtr fs, const std::string& path, uint32_t segment_id,
                      RowsetId rowset_id, TabletSchemaSPtr tablet_schema,
                      const io::FileReaderOptions& reader_options,
-                     std::shared_ptr<Segment>* output) {
+                     std::shared_ptr<Segment>* output, OlapMeta* footer_meta) {
     io::FileReaderSPtr file_reader;
 #ifndef BE_TEST
     RETURN_IF_ERROR(fs->open_file(path, reader_options, &file_reader));
@@ -91,7 +94,7 @@ Status Segment::open(io::FileSystemSPtr fs, const std::string& path, uint32_t se
 
     std::shared_ptr<Segment> segment(new Segment(segment_id, rowset_id, tablet_schema));
     segment->_file_reader = std::move(file_reader);
-    RETURN_IF_ERROR(segment->_open());
+    RETURN_IF_ERROR(segment->_open(footer_meta));
     *output = std::move(segment);
     return Status::OK();
 }
@@ -109,8 +112,9 @@ Segment::~Segment() {
 #endif
 }
 
-Status Segment::_open() {
-    RETURN_IF_ERROR(_parse_footer());
+Status Segment::_open(OlapMeta* footer_meta) {
+    RETURN_IF_ERROR(_parse_footer(footer_meta));
+    _prefetch_index_region();
     RETURN_IF_ERROR(_create_column_readers());
     return Status::OK();
 }
@@ -126,11 +130,18 @@ Status Segment::new_iterator(SchemaSPtr schema, const StorageReadOptions& read_o
             continue;
         }
         int32_t uid = read_options.tablet_schema->column(column_id).unique_id();
-        if (_column_readers.count(uid) < 1 || !_column_readers.at(uid)->has_zone_map()) {
+        if (_column_readers.count(uid) < 1) {
             continue;
         }
-        if (read_options.col_id_to_predicates.count(column_id) > 0 &&
-            !_column_readers.at(uid)->match_condition(entry.second.get())) {
+        const auto& column_reader = _column_readers.at(uid);
+        // the zone map of a widened column is in its old type
+        if (_is_widened(read_options.tablet_schema->column(column_id))) {
+            continue;
+        }
+        if ((column_reader->has_zone_map() &&
+             !column_reader->match_condition(entry.second.get())) ||
+            (column_reader->has_segment_ngram_bf() && config::enable_query_like_bloom_filter &&
+             !column_reader->match_segment_ngram_bf(entry.second.get(), read_options.stats))) {
             // any condition not satisfied, return.
             iter->reset(new EmptySegmentIterator(*schema));
             read_options.stats->filtered_segment_number++;
@@ -141,7 +152,8 @@ Status Segment::new_iterator(SchemaSPtr schema, const StorageReadOptions& read_o
     if (read_options.use_topn_opt) {
         auto query_ctx = read_options.runtime_state->get_query_ctx();
         auto runtime_predicate = query_ctx->get_runtime_predicate().get_predictate();
-        if (runtime_predicate) {
+        if (runtime_predicate &&
+            !_is_widened(read_options.tablet_schema->column(runtime_predicate->column_id()))) {
             int32_t uid =
                     read_options.tablet_schema->column(runtime_predicate->column_id()).unique_id();
             AndBlockColumnPredicate and_predicate;
@@ -167,7 +179,29 @@ Status Segment::new_iterator(SchemaSPtr schema, const StorageReadOptions& read_o
     return iter->get()->init(read_options);
 }
 
-Status Segment::_parse_footer() {
+Status Segment::_parse_footer(OlapMeta* footer_meta) {
+    if (footer_meta == nullptr) {
+        return _read_footer();
+    }
+    auto file_size = _file_reader->size();
+    if (SegmentFooterMetaManager::get(footer_meta, _rowset_id, _segment_id, file_size, &_footer)
+                .ok()) {
+        auto footer_length = _footer.ByteSizeLong();
+        _meta_mem_usage += footer_length;
+        _segment_meta_mem_tracker->consume(footer_length);
+        return Status::OK();
+    }
+    RETURN_IF_ERROR(_read_footer());
+    auto st = SegmentFooterMetaManager::save(footer_meta, _rowset_id, _segment_id, file_size,
+                                             _footer);
+    if (!st.ok()) {
+        LOG(WARNING) << "failed to save footer of segment " << _file_reader->path().native()
+                     << ": " << st;
+    }
+    return Status::OK();
+}
+
+Status Segment::_read_footer() {
     // Footer := SegmentFooterPB, FooterPBSize(4), FooterPBChecksum(4), MagicNumber(4)
     auto file_size = _file_reader->size();
     if (file_size < 12) {
@@ -175,13 +209,18 @@ Status Segment::_parse_footer() {
                                   _file_reader->path().native(), file_size);
     }
 
-    uint8_t fixed_buf[12];
+    // read the footer together with the fixed part if it is small enough, each read of a remote
+    // segment is a request
+    size_t tail_size =
+            std::min<size_t>(file_size, std::max<int64_t>(12, config::segment_footer_read_bytes));
+    std::string tail_buf;
+    tail_buf.resize(tail_size);
     size_t bytes_read = 0;
     // Block / Whole / Sub file cache will use it while read segment footer
     io::IOContext io_ctx;
-    RETURN_IF_ERROR(
-            _file_reader->read_at(file_size - 12, Slice(fixed_buf, 12), &bytes_read, &io_ctx));
-    DCHECK_EQ(bytes_read, 12);
+    RETURN_IF_ERROR(_file_reader->read_at(file_size - tail_size, tail_buf, &bytes_read, &io_ctx));
+    DCHECK_EQ(bytes_read, tail_size);
+    const auto* fixed_buf = reinterpret_cast<const uint8_t*>(tail_buf.data()) + tail_size - 12;
 
     // validate magic number
     if (memcmp(fixed_buf + 8, k_segment_magic, k_segment_magic_length) != 0) {
@@ -199,10 +238,14 @@ Status Segment::_parse_footer() {
     _segment_meta_mem_tracker->consume(footer_length);
 
     std::string footer_buf;
-    footer_buf.resize(footer_length);
-    RETURN_IF_ERROR(_file_reader->read_at(file_size - 12 - footer_length, footer_buf, &bytes_read,
-                                          &io_ctx));
-    DCHECK_EQ(bytes_read, footer_length);
+    if (12 + footer_length <= tail_size) {
+        footer_buf.assign(tail_buf.data() + tail_size - 12 - footer_length, footer_length);
+    } else {
+        footer_buf.resize(footer_length);
+        RETURN_IF_ERROR(_file_reader->read_at(file_size - 12 - footer_length, footer_buf,
+                                              &bytes_read, &io_ctx));
+        DCHECK_EQ(bytes_read, footer_length);
+    }
 
     // validate footer PB's checksum
     uint32_t expect_checksum = decode_fixed32_le(fixed_buf + 4);
@@ -221,6 +264,39 @@ Status Segment::_parse_footer() {
     return Status::OK();
 }
 
+void Segment::_prefetch_index_region() {
+    // the index pages of the other segments are read from local disk or fetched by block
+    if (config::segment_index_prefetch_max_bytes <= 0 ||
+        dynamic_cast<io::CachedRemoteFileReader*>(_file_reader.get()) == nullptr) {
+        return;
+    }
+    // The indexes of all the columns are written after their data, starting with the ordinal
+    // indexes. A column of a single data page has no ordinal index page.
+    uint64_t file_size = _file_reader->size();
+    uint64_t index_start = file_size;
+    for (const auto& column : _footer.columns()) {
+        for (const auto& index : column.indexes()) {
+            const auto& root = index.ordinal_index().root_page();
+            if (index.type() == ORDINAL_INDEX && !root.is_root_data_page()) {
+                index_start = std::min(index_start, root.root_page().offset());
+            }
+        }
+    }
+    // the data pages of the vertical compaction are interleaved with the indexes
+    size_t size = file_size - index_start;
+    if (size == 0 || size > config::segment_index_prefetch_max_bytes) {
+        return;
+    }
+    std::unique_ptr<char[]> buf(new char[size]);
+    size_t bytes_read = 0;
+    io::IOContext io_ctx;
+    auto st = _file_reader->read_at(index_start, Slice(buf.get(), size), &bytes_read, &io_ctx);
+    if (!st.ok()) {
+        LOG(WARNING) << "failed to prefetch the index of segment " << _file_reader->path().native()
+                     << ": " << st;
+    }
+}
+
 Status Segment::_load_pk_bloom_filter() {
     DCHECK(_tablet_schema->keys_type() == UNIQUE_KEYS);
     DCHECK(_footer.has_primary_key_index_meta());
@@ -233,9 +309,27 @@ Status Segment::_load_pk_bloom_filter() {
     });
 }
 
+Status Segment::_build_pk_fingerprint_index() {
+    DCHECK(_pk_index_reader != nullptr);
+    return _build_pk_fingerprint_once.call([this] {
+        size_t seq_col_length = 0;
+        if (_tablet_schema->has_sequence_col()) {
+            seq_col_length =
+                    _tablet_schema->column(_tablet_schema->sequence_col_idx()).length() + 1;
+        }
+        RETURN_IF_ERROR(_pk_index_reader->build_fingerprint_index(seq_col_length));
+        _meta_mem_usage += _pk_index_reader->get_fingerprint_index_memory_size();
+        _segment_meta_mem_tracker->consume(_pk_index_reader->get_fingerprint_index_memory_size());
+        return Status::OK();
+    });
+}
+
 Status Segment::load_pk_index_and_bf() {
     RETURN_IF_ERROR(load_index());
     RETURN_IF_ERROR(_load_pk_bloom_filter());
+    if (config::primary_key_fingerprint_index_memory_limit_mb > 0) {
+        RETURN_IF_ERROR(_build_pk_fingerprint_index());
+    }
     return Status::OK();
 }
 Status Segment::load_index() {
@@ -320,12 +414,35 @@ Status Segment::new_column_iterator(const TabletColumn& tablet_column,
         *iter = std::move(default_value_iter);
         return Status::OK();
     }
+    const auto& reader = _column_readers.at(tablet_column.unique_id());
     ColumnIterator* it;
-    RETURN_IF_ERROR(_column_readers.at(tablet_column.unique_id())->new_iterator(&it));
+    RETURN_IF_ERROR(reader->new_iterator(&it));
     iter->reset(it);
+    if (_is_widened(tablet_column)) {
+        auto widen = WideningColumnIterator::get_widen_func(reader->get_meta_type(),
+                                                            tablet_column.type());
+        iter->reset(new WideningColumnIterator(std::move(*iter), reader->get_meta_type(), widen));
+    }
     return Status::OK();
 }
 
+bool Segment::_is_widened(const TabletColumn& tablet_column) const {
+    auto reader = _column_readers.find(tablet_column.unique_id());
+    if (reader == _column_readers.end() ||
+        reader->second->get_meta_type() == tablet_column.type()) {
+        return false;
+    }
+    return WideningColumnIterator::get_widen_func(reader->second->get_meta_type(),
+                                                  tablet_column.type()) != nullptr;
+}
+
+void Segment::release_column_iterator(int32_t unique_id, std::unique_ptr<ColumnIterator> iter) {
+    auto reader = _column_readers.find(unique_id);
+    if (reader != _column_readers.end() && iter != nullptr) {
+        reader->second->release_iterator(std::move(iter));
+    }
+}
+
 Status Segment::new_bitmap_index_iterator(const TabletColumn& tablet_column,
                                           std::unique_ptr<BitmapIndexIterator>* iter) {
     auto col_unique_id = tablet_column.unique_id();
@@ -372,9 +489,17 @@ Status Segment::lookup_row_key(const Slice& key, bool with_seq_col, RowLocation*
     bool exact_match = false;
     std::unique_ptr<segment_v2::IndexedColumnIterator> index_iterator;
     RETURN_IF_ERROR(_pk_index_reader->new_iterator(&index_iterator));
-    RETURN_IF_ERROR(index_iterator->seek_at_or_after(&key_without_seq, &exact_match));
-    if (!has_seq_col && !exact_match) {
-        return Status::NotFound("Can't find key in the segment");
+    if (_pk_index_reader->has_fingerprint_index()) {
+        RETURN_IF_ERROR(_pk_index_reader->seek_by_fingerprint(index_iterator.get(),
+                                                              key_without_seq, &exact_match));
+        if (!exact_match) {
+            return Status::NotFound("Can't find key in the segment");
+        }
+    } else {
+        RETURN_IF_ERROR(index_iterator->seek_at_or_after(&key_without_seq, &exact_match));
+        if (!has_seq_col && !exact_match) {
+            return Status::NotFound("Can't find key in the segment");
+        }
     }
     row_location->row_id = index_iterator->get_current_ordinal();
     row_location->segment_id = _segment_id;
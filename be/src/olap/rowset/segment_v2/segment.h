@@ -46,6 +46,7 @@ class ShortKeyIndexDecoder;
 class Schema;
 class StorageReadOptions;
 class MemTracker;
+class OlapMeta;
 class PrimaryKeyIndexReader;
 class RowwiseIterator;
 
@@ -74,7 +75,7 @@ public:
     static Status open(io::FileSystemSPtr fs, const std::string& path, uint32_t segment_id,
                        RowsetId rowset_id, TabletSchemaSPtr tablet_schema,
                        const io::FileReaderOptions& reader_options,
-                       std::shared_ptr<Segment>* output);
+                       std::shared_ptr<Segment>* output, OlapMeta* footer_meta = nullptr);
 
     ~Segment();
 
@@ -90,6 +91,9 @@ public:
     Status new_column_iterator(const TabletColumn& tablet_column,
                                std::unique_ptr<ColumnIterator>* iter);
 
+    // Give back an iterator created by new_column_iterator() for reuse.
+    void release_column_iterator(int32_t unique_id, std::unique_ptr<ColumnIterator> iter);
+
     Status new_bitmap_index_iterator(const TabletColumn& tablet_column,
                                      std::unique_ptr<BitmapIndexIterator>* iter);
 
@@ -134,11 +138,19 @@ public:
 private:
     DISALLOW_COPY_AND_ASSIGN(Segment);
     Segment(uint32_t segment_id, RowsetId rowset_id, TabletSchemaSPtr tablet_schema);
-    // open segment file and read the minimum amount of necessary information (footer)
-    Status _open();
-    Status _parse_footer();
+    // open segment file and read the minimum amount of necessary information (footer).
+    // The footer is loaded from and saved into footer_meta if it is not null.
+    Status _open(OlapMeta* footer_meta);
+    Status _parse_footer(OlapMeta* footer_meta);
+    Status _read_footer();
+    // Fetch the index pages of a remote segment into the file cache in one request.
+    void _prefetch_index_region();
     Status _create_column_readers();
+    // whether the column is written in a narrower type than the one of the schema after a lazy
+    // schema change, and is read by a WideningColumnIterator
+    bool _is_widened(const TabletColumn& tablet_column) const;
     Status _load_pk_bloom_filter();
+    Status _build_pk_fingerprint_index();
 
 private:
     friend class SegmentIterator;
@@ -166,6 +178,8 @@ private:
     DorisCallOnce<Status> _load_index_once;
     // used to guarantee that primary key bloom filter will be loaded at most once in a thread-safe way
     DorisCallOnce<Status> _load_pk_bf_once;
+    // used to guarantee that primary key fingerprint index will be built at most once
+    DorisCallOnce<Status> _build_pk_fingerprint_once;
     // used to hold short key index page in memory
     PageHandle _sk_index_handle;
     // short key index decoder
@@ -0,0 +1,94 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "olap/rowset/segment_v2/segment_footer_meta_manager.h"
+
+#include <fmt/format.h>
+#include <gen_cpp/segment_v2.pb.h>
+
+#include <string>
+#include <vector>
+
+#include "olap/olap_define.h"
+#include "olap/olap_meta.h"
+#include "util/coding.h"
+#include "util/crc32c.h"
+#include "util/faststring.h"
+
+namespace doris {
+namespace segment_v2 {
+namespace {
+const std::string SEGMENT_FOOTER_PREFIX = "sft_";
+// FileSize(8) | FooterPBChecksum(4)
+const size_t HEADER_SIZE = 12;
+
+std::string footer_key(const RowsetId& rowset_id, uint32_t segment_id) {
+    return fmt::format("{}{}_{}", SEGMENT_FOOTER_PREFIX, rowset_id.to_string(), segment_id);
+}
+} // namespace
+
+Status SegmentFooterMetaManager::get(OlapMeta* meta, const RowsetId& rowset_id,
+                                     uint32_t segment_id, uint64_t file_size,
+                                     SegmentFooterPB* footer) {
+    std::string key = footer_key(rowset_id, segment_id);
+    std::string value;
+    RETURN_IF_ERROR(meta->get(META_COLUMN_FAMILY_INDEX, key, &value));
+    if (value.size() < HEADER_SIZE) {
+        return Status::NotFound("invalid segment footer meta, key={}", key);
+    }
+    auto data = reinterpret_cast<const uint8_t*>(value.data());
+    // the file with the same name is replaced, e.g. by a failed clone
+    if (decode_fixed64_le(data) != file_size) {
+        return Status::NotFound("segment footer meta is stale, key={}", key);
+    }
+    uint32_t expect_checksum = decode_fixed32_le(data + 8);
+    uint32_t actual_checksum =
+            crc32c::Value(value.data() + HEADER_SIZE, value.size() - HEADER_SIZE);
+    if (actual_checksum != expect_checksum ||
+        !footer->ParseFromArray(value.data() + HEADER_SIZE, value.size() - HEADER_SIZE)) {
+        return Status::NotFound("segment footer meta is broken, key={}", key);
+    }
+    return Status::OK();
+}
+
+Status SegmentFooterMetaManager::save(OlapMeta* meta, const RowsetId& rowset_id,
+                                      uint32_t segment_id, uint64_t file_size,
+                                      const SegmentFooterPB& footer) {
+    std::string footer_buf;
+    if (!footer.SerializeToString(&footer_buf)) {
+        return Status::InternalError("failed to serialize segment footer");
+    }
+    faststring value;
+    put_fixed64_le(&value, file_size);
+    put_fixed32_le(&value, crc32c::Value(footer_buf.data(), footer_buf.size()));
+    value.append(footer_buf);
+    return meta->put(META_COLUMN_FAMILY_INDEX, footer_key(rowset_id, segment_id),
+                     value.ToString());
+}
+
+Status SegmentFooterMetaManager::remove(OlapMeta* meta, const RowsetId& rowset_id,
+                                        int64_t num_segments) {
+    std::vector<std::string> keys;
+    keys.reserve(num_segments);
+    for (int64_t i = 0; i < num_segments; ++i) {
+        keys.push_back(footer_key(rowset_id, i));
+    }
+    return meta->remove(META_COLUMN_FAMILY_INDEX, keys);
+}
+
+} // namespace segment_v2
+} // namespace doris
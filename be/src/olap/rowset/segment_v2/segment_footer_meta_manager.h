@@ -0,0 +1,51 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <cstdint>
+
+#include "common/status.h"
+#include "olap/olap_common.h"
+
+namespace doris {
+class OlapMeta;
+
+namespace segment_v2 {
+class SegmentFooterPB;
+
+// Helper class for persisting the parsed footers of the local segments in the meta of
+// their data dir, so that opening a segment after restart does not need to read and
+// verify the footer from the segment file again.
+//
+// Key := sft_{rowset_id}_{segment_id}
+// Value := FileSize(8) | FooterPBChecksum(4) | SegmentFooterPB
+class SegmentFooterMetaManager {
+public:
+    // Return NotFound if there is no valid footer of the segment with the file size.
+    static Status get(OlapMeta* meta, const RowsetId& rowset_id, uint32_t segment_id,
+                      uint64_t file_size, SegmentFooterPB* footer);
+
+    static Status save(OlapMeta* meta, const RowsetId& rowset_id, uint32_t segment_id,
+                       uint64_t file_size, const SegmentFooterPB& footer);
+
+    // Remove the footers of all segments of the rowset.
+    static Status remove(OlapMeta* meta, const RowsetId& rowset_id, int64_t num_segments);
+};
+
+} // namespace segment_v2
+} // namespace doris
@@ -18,11 +18,13 @@
 #include "olap/rowset/segment_v2/segment_iterator.h"
 
 #include <assert.h>
+#include <fmt/format.h>
 #include <gen_cpp/Types_types.h>
 #include <gen_cpp/olap_file.pb.h>
 
 #include <algorithm>
 #include <boost/iterator/iterator_facade.hpp>
+#include <limits>
 #include <memory>
 #include <numeric>
 #include <set>
@@ -35,7 +37,10 @@
 #include "common/logging.h"
 #include "common/object_pool.h"
 #include "common/status.h"
+#include "io/fs/buffered_reader.h"
 #include "io/fs/file_reader_writer_fwd.h"
+#include "io/fs/file_system.h"
+#include "io/fs/local_file_reader.h"
 #include "io/io_common.h"
 #include "olap/bloom_filter_predicate.h"
 #include "olap/column_predicate.h"
@@ -59,10 +64,12 @@
 #include "runtime/runtime_predicate.h"
 #include "runtime/runtime_state.h"
 #include "runtime/thread_context.h"
+#include "util/coding.h"
 #include "util/defer_op.h"
 #include "util/doris_metrics.h"
 #include "util/key_util.h"
 #include "util/simd/bits.h"
+#include "util/time.h"
 #include "vec/columns/column.h"
 #include "vec/columns/column_const.h"
 #include "vec/columns/column_nullable.h"
@@ -86,7 +93,12 @@ namespace doris {
 using namespace ErrorCode;
 namespace segment_v2 {
 
-SegmentIterator::~SegmentIterator() = default;
+SegmentIterator::~SegmentIterator() {
+    // the column iterators keep the decoded dictionary pages for the next queries
+    for (auto& [unique_id, iterator] : _column_iterators) {
+        _segment->release_column_iterator(unique_id, std::move(iterator));
+    }
+}
 
 // A fast range iterator for roaring bitmap. Output ranges use closed-open form, like [from, to).
 // Example:
@@ -214,6 +226,16 @@ Status SegmentIterator::init(const StorageReadOptions& opts) {
     _inited = true;
     _file_reader = _segment->_file_reader;
     _opts = opts;
+    if (config::enable_segment_page_prefetch && !_opts.read_orderby_key_reverse &&
+        _file_reader->fs() != nullptr && _file_reader->fs()->type() != io::FileSystemType::LOCAL) {
+        _prefetch_reader = std::make_shared<io::AsyncRangePrefetchReader>(
+                _file_reader, config::segment_page_prefetch_max_inflight,
+                config::segment_page_prefetch_merge_gap_bytes,
+                config::segment_page_prefetch_max_merged_bytes);
+        _file_reader = _prefetch_reader;
+    } else if (config::enable_local_segment_page_readahead && !_opts.read_orderby_key_reverse) {
+        _local_file_reader = dynamic_cast<io::LocalFileReader*>(_file_reader.get());
+    }
     _col_predicates.clear();
     for (auto& predicate : opts.column_predicates) {
         if (predicate->need_to_clone()) {
@@ -272,6 +294,16 @@ Status SegmentIterator::_lazy_init() {
     if (_segment->_tablet_schema->sort_type() != SortType::ZORDER) {
         RETURN_IF_ERROR(_get_row_ranges_by_keys());
     }
+    // only read the rows of the split of this segment
+    auto split = _opts.segment_row_ranges.find(segment_id());
+    if (split != _opts.segment_row_ranges.end()) {
+        roaring::Roaring split_rows;
+        uint32_t last_row = std::min(split->second.second, num_rows());
+        if (split->second.first < last_row) {
+            split_rows.addRange(split->second.first, last_row);
+        }
+        _row_bitmap &= split_rows;
+    }
     RETURN_IF_ERROR(_get_row_ranges_by_column_conditions());
     RETURN_IF_ERROR(_vec_init_lazy_materialization());
     // Remove rows that have been marked deleted
@@ -420,12 +452,52 @@ Status SegmentIterator::_get_row_ranges_by_column_conditions() {
         _row_bitmap &= RowRanges::ranges_to_roaring(condition_row_ranges);
         _opts.stats->rows_conditions_filtered += (pre_size - _row_bitmap.cardinality());
     }
+    RETURN_IF_ERROR(_get_row_ranges_by_late_runtime_filters());
 
     // TODO(hkp): calculate filter rate to decide whether to
     // use zone map/bloom filter/secondary index or not.
     return Status::OK();
 }
 
+// The runtime filters arriving after this iterator is created are not in column predicates,
+// but they can still prune the pages before this segment is read.
+Status SegmentIterator::_get_row_ranges_by_late_runtime_filters() {
+    if (_opts.late_runtime_filter_predicates == nullptr || _row_bitmap.isEmpty()) {
+        return Status::OK();
+    }
+    auto predicates = _opts.late_runtime_filter_predicates->get();
+    if (predicates.empty()) {
+        return Status::OK();
+    }
+
+    RowRanges condition_row_ranges = RowRanges::create_single(num_rows());
+    for (auto& predicate : predicates) {
+        auto cid = predicate->column_id();
+        if (cid >= _schema->num_columns() || _schema->column(cid) == nullptr) {
+            continue;
+        }
+        auto iter = _column_iterators.find(_schema->unique_id(cid));
+        if (iter == _column_iterators.end() || iter->second == nullptr) {
+            continue;
+        }
+        AndBlockColumnPredicate and_predicate;
+        and_predicate.add_column_predicate(new SingleColumnBlockPredicate(predicate.get()));
+        RowRanges column_row_ranges = RowRanges::create_single(num_rows());
+        auto* column_iter = iter->second.get();
+        RETURN_IF_ERROR(column_iter->get_row_ranges_by_zone_map(&and_predicate, nullptr,
+                                                                &column_row_ranges));
+        RETURN_IF_ERROR(
+                column_iter->get_row_ranges_by_bloom_filter(&and_predicate, &column_row_ranges));
+        RowRanges::ranges_intersection(condition_row_ranges, column_row_ranges,
+                                       &condition_row_ranges);
+    }
+
+    size_t pre_size = _row_bitmap.cardinality();
+    _row_bitmap &= RowRanges::ranges_to_roaring(condition_row_ranges);
+    _opts.stats->rows_late_rf_index_filtered += (pre_size - _row_bitmap.cardinality());
+    return Status::OK();
+}
+
 Status SegmentIterator::_get_row_ranges_from_conditions(RowRanges* condition_row_ranges) {
     std::set<int32_t> cids;
     for (auto& entry : _opts.col_id_to_predicates) {
@@ -806,6 +878,18 @@ bool SegmentIterator::_column_has_fulltext_index(int32_t unique_id) {
     return has_fulltext_index;
 }
 
+bool SegmentIterator::_can_stop_inverted_index_by_limit() const {
+    // The rows matched by the predicate are filtered by nothing else before they are returned,
+    // and they are read in ascending rowid order.
+    return _opts.read_limit > 0 && _opts.read_limit <= std::numeric_limits<uint32_t>::max() &&
+           _col_predicates.size() == 1 && _opts.col_id_to_predicates.size() <= 1 &&
+           _col_preds_except_leafnode_of_andnode.empty() && _remaining_conjunct_roots.empty() &&
+           _opts.delete_condition_predicates->num_of_column_predicate() == 0 &&
+           _opts.delete_bitmap.count(segment_id()) == 0 &&
+           _opts.late_runtime_filter_predicates == nullptr && !_opts.use_topn_opt &&
+           !_opts.read_orderby_key_reverse;
+}
+
 inline bool SegmentIterator::_inverted_index_not_support_pred_type(const PredicateType& type) {
     return type == PredicateType::BF || type == PredicateType::BITMAP_FILTER;
 }
@@ -829,8 +913,16 @@ Status SegmentIterator::_apply_inverted_index_on_column_predicate(
         bool need_remaining_after_evaluate = _column_has_fulltext_index(unique_id) &&
                                              PredicateTypeTraits::is_equal_or_list(pred->type());
         roaring::Roaring bitmap = _row_bitmap;
-        Status res = pred->evaluate(*_schema, _inverted_index_iterators[unique_id].get(),
-                                    num_rows(), &bitmap);
+        auto* inverted_index_iterator = _inverted_index_iterators[unique_id].get();
+        bool read_limited =
+                pred->type() == PredicateType::MATCH && _can_stop_inverted_index_by_limit();
+        if (read_limited) {
+            inverted_index_iterator->set_read_limit(_opts.read_limit, &_row_bitmap);
+        }
+        Status res = pred->evaluate(*_schema, inverted_index_iterator, num_rows(), &bitmap);
+        if (read_limited) {
+            inverted_index_iterator->set_read_limit(0, nullptr);
+        }
         if (!res.ok()) {
             if (_downgrade_without_index(res, need_remaining_after_evaluate)) {
                 remaining_predicates.emplace_back(pred);
@@ -1033,7 +1125,37 @@ Status SegmentIterator::_lookup_ordinal(const RowCursor& key, bool is_include, r
         _segment->get_primary_key_index() != nullptr) {
         return _lookup_ordinal_from_pk_index(key, is_include, rowid);
     }
-    return _lookup_ordinal_from_sk_index(key, is_include, upper_bound, rowid);
+    if (_opts.key_range_lookup_cache == nullptr) {
+        return _lookup_ordinal_from_sk_index(key, is_include, upper_bound, rowid);
+    }
+
+    // the bound with the segment, the number of key columns and every cell with its length
+    std::string cache_key = fmt::format("{}-{}-{}-{}", _segment->rowset_id().to_string(),
+                                        _segment->id(), is_include, key.schema()->num_column_ids());
+    for (auto cid : key.schema()->column_ids()) {
+        auto cell = key.cell(cid);
+        if (cell.is_null()) {
+            cache_key.push_back(0);
+            continue;
+        }
+        std::string encoded;
+        key.schema()->column(cid)->full_encode_ascending(cell.cell_ptr(), &encoded);
+        cache_key.push_back(1);
+        put_fixed32_le(&cache_key, encoded.size());
+        cache_key.append(encoded);
+    }
+    rowid_t ordinal = 0;
+    if (_opts.key_range_lookup_cache->lookup(cache_key, &ordinal)) {
+        _opts.stats->key_range_lookup_cache_hit++;
+        *rowid = std::min(ordinal, upper_bound);
+        return Status::OK();
+    }
+    RETURN_IF_ERROR(_lookup_ordinal_from_sk_index(key, is_include, upper_bound, rowid));
+    // the ordinal of the key is not known if the search stops at `upper_bound'
+    if (*rowid < upper_bound || upper_bound == num_rows()) {
+        _opts.key_range_lookup_cache->insert(cache_key, *rowid);
+    }
+    return Status::OK();
 }
 
 // look up one key to get its ordinal at which can get data by using short key index.
@@ -1520,6 +1642,9 @@ void SegmentIterator::_output_non_pred_columns(vectorized::Block* block) {
 Status SegmentIterator::_read_columns_by_index(uint32_t nrows_read_limit, uint32_t& nrows_read,
                                                bool set_block_rowid) {
     SCOPED_RAW_TIMER(&_opts.stats->first_read_ns);
+    if (_prefetch_reader != nullptr || _local_file_reader != nullptr) {
+        RETURN_IF_ERROR(_prefetch_pages(nrows_read_limit - nrows_read));
+    }
     do {
         uint32_t range_from;
         uint32_t range_to;
@@ -1554,6 +1679,58 @@ Status SegmentIterator::_read_columns_by_index(uint32_t nrows_read_limit, uint32
     return Status::OK();
 }
 
+Status SegmentIterator::_prefetch_pages(uint32_t nrows_read_limit) {
+    SCOPED_RAW_TIMER(&_opts.stats->page_prefetch_plan_ns);
+    // walk a copy of the range iterator to get the row ranges of the next batch
+    BitmapRangeIterator range_iter(*_range_iter);
+    std::vector<std::pair<uint32_t, uint32_t>> row_ranges;
+    uint32_t nrows = 0;
+    uint32_t range_from;
+    uint32_t range_to;
+    while (nrows < nrows_read_limit &&
+           range_iter.next_range(nrows_read_limit - nrows, &range_from, &range_to)) {
+        row_ranges.emplace_back(range_from, range_to);
+        nrows += range_to - range_from;
+    }
+    if (row_ranges.empty()) {
+        return Status::OK();
+    }
+
+    std::vector<PagePointer> pages;
+    for (auto cid : _first_read_column_ids) {
+        if (!_need_read_data(cid)) {
+            continue;
+        }
+        RETURN_IF_ERROR(_column_iterators[_schema->unique_id(cid)]->collect_data_pages(row_ranges,
+                                                                                       &pages));
+    }
+    std::vector<io::PrefetchRange> ranges;
+    ranges.reserve(pages.size());
+    for (const auto& page : pages) {
+        ranges.emplace_back(page.offset, page.offset + page.size);
+        _opts.stats->page_prefetch_bytes += page.size;
+    }
+    if (_prefetch_reader != nullptr) {
+        _opts.stats->page_prefetch_io_count +=
+                _prefetch_reader->prefetch(std::move(ranges), &_opts.io_ctx);
+        return Status::OK();
+    }
+    // coalesce the close pages into one hint
+    std::sort(ranges.begin(), ranges.end(),
+              [](const auto& a, const auto& b) { return a.start_offset < b.start_offset; });
+    size_t merge_gap = config::segment_page_prefetch_merge_gap_bytes;
+    for (size_t i = 0; i < ranges.size();) {
+        size_t start = ranges[i].start_offset;
+        size_t end = ranges[i].end_offset;
+        for (++i; i < ranges.size() && ranges[i].start_offset <= end + merge_gap; ++i) {
+            end = std::max(end, ranges[i].end_offset);
+        }
+        _local_file_reader->readahead(start, end - start);
+        ++_opts.stats->page_prefetch_io_count;
+    }
+    return Status::OK();
+}
+
 void SegmentIterator::_replace_version_col(size_t num_rows) {
     // Only the rowset with single version need to replace the version column.
     // Doris can't determine the version before publish_version finished, so
@@ -1639,6 +1816,11 @@ uint16_t SegmentIterator::_evaluate_vectorization_predicate(uint16_t* sel_rowid_
     return new_size;
 }
 
+bool SegmentIterator::_need_reorder_conjuncts(int64_t* num_blocks) {
+    return config::conjunct_reorder_block_interval > 0 &&
+           ++*num_blocks % config::conjunct_reorder_block_interval == 0;
+}
+
 uint16_t SegmentIterator::_evaluate_short_circuit_predicate(uint16_t* vec_sel_rowid_idx,
                                                             uint16_t selected_size) {
     SCOPED_RAW_TIMER(&_opts.stats->short_cond_ns);
@@ -1647,10 +1829,25 @@ uint16_t SegmentIterator::_evaluate_short_circuit_predicate(uint16_t* vec_sel_ro
     }
 
     uint16_t original_size = selected_size;
+    const bool collect_stats =
+            config::enable_adaptive_conjunct_order && _short_cir_eval_predicate.size() > 1;
+    if (collect_stats && _need_reorder_conjuncts(&_num_short_cir_eval_blocks)) {
+        vectorized::reorder_conjuncts_by_rank(
+                &_short_cir_eval_predicate,
+                [](ColumnPredicate* pred) -> vectorized::ConjunctStats& {
+                    return pred->conjunct_stats();
+                });
+    }
     for (auto predicate : _short_cir_eval_predicate) {
         auto column_id = predicate->column_id();
         auto& short_cir_column = _current_return_columns[column_id];
+        int64_t start_ns = collect_stats ? MonotonicNanos() : 0;
+        uint16_t input_size = selected_size;
         selected_size = predicate->evaluate(*short_cir_column, vec_sel_rowid_idx, selected_size);
+        if (collect_stats) {
+            predicate->conjunct_stats().update(input_size, selected_size, input_size,
+                                               MonotonicNanos() - start_ns);
+        }
     }
 
     // collect profile
@@ -1935,6 +2132,10 @@ Status SegmentIterator::_execute_common_expr(uint16_t* sel_rowid_idx, uint16_t&
     DCHECK(!_remaining_conjunct_roots.empty());
     DCHECK(block->rows() != 0);
     size_t prev_columns = block->columns();
+    if (config::enable_adaptive_conjunct_order && _common_expr_ctxs_push_down.size() > 1 &&
+        _need_reorder_conjuncts(&_num_common_expr_blocks)) {
+        vectorized::VExprContext::reorder_conjuncts(&_common_expr_ctxs_push_down);
+    }
 
     vectorized::IColumn::Filter filter;
     RETURN_IF_ERROR(vectorized::VExprContext::execute_conjuncts_and_filter_block(
@@ -2076,6 +2277,11 @@ void SegmentIterator::_update_max_row(const vectorized::Block* block) {
     auto avg_row_size = block->bytes() / block->rows();
 
     int block_row_max = config::doris_scan_block_max_mb / avg_row_size;
+    if (_opts.runtime_state != nullptr) {
+        // keep the block around preferred_block_size_bytes of the query
+        block_row_max =
+                std::min(block_row_max, _opts.runtime_state->adaptive_batch_size(avg_row_size));
+    }
     _opts.block_row_max = std::min(block_row_max, _opts.block_row_max);
 }
 
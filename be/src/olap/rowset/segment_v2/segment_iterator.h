@@ -57,6 +57,10 @@ namespace vectorized {
 class VExpr;
 class VExprContext;
 } // namespace vectorized
+namespace io {
+class AsyncRangePrefetchReader;
+class LocalFileReader;
+} // namespace io
 struct RowLocation;
 
 namespace segment_v2 {
@@ -173,6 +177,7 @@ private:
     // calculate row ranges that satisfy requested column conditions using various column index
     [[nodiscard]] Status _get_row_ranges_by_column_conditions();
     [[nodiscard]] Status _get_row_ranges_from_conditions(RowRanges* condition_row_ranges);
+    [[nodiscard]] Status _get_row_ranges_by_late_runtime_filters();
     [[nodiscard]] Status _apply_bitmap_index();
     [[nodiscard]] Status _apply_inverted_index();
     [[nodiscard]] Status _apply_inverted_index_on_column_predicate(
@@ -188,6 +193,9 @@ private:
     [[nodiscard]] Status _apply_inverted_index_except_leafnode_of_andnode(
             ColumnPredicate* pred, roaring::Roaring* output_result);
     bool _column_has_fulltext_index(int32_t unique_id);
+    // Whether the only predicate decides the rows returned, so that a match predicate only
+    // needs to find the first read_limit matched rows, see StorageReadOptions::read_limit.
+    bool _can_stop_inverted_index_by_limit() const;
     bool _downgrade_without_index(Status res, bool need_remaining = false);
     inline bool _inverted_index_not_support_pred_type(const PredicateType& type);
     bool _can_filter_by_preds_except_leafnode_of_andnode();
@@ -212,11 +220,16 @@ private:
                                        vectorized::MutableColumns& column_block, size_t nrows);
     [[nodiscard]] Status _read_columns_by_index(uint32_t nrows_read_limit, uint32_t& nrows_read,
                                                 bool set_block_rowid);
+    // plan the data pages read by the next `_read_columns_by_index` and prefetch them,
+    // or hint the kernel to read them ahead for local segment
+    [[nodiscard]] Status _prefetch_pages(uint32_t nrows_read_limit);
     void _replace_version_col(size_t num_rows);
     void _init_current_block(vectorized::Block* block,
                              std::vector<vectorized::MutableColumnPtr>& non_pred_vector);
     uint16_t _evaluate_vectorization_predicate(uint16_t* sel_rowid_idx, uint16_t selected_size);
     uint16_t _evaluate_short_circuit_predicate(uint16_t* sel_rowid_idx, uint16_t selected_size);
+    // count a block, true every conjunct_reorder_block_interval blocks
+    bool _need_reorder_conjuncts(int64_t* num_blocks);
     void _output_non_pred_columns(vectorized::Block* block);
     [[nodiscard]] Status _read_columns_by_rowids(std::vector<ColumnId>& read_column_ids,
                                                  std::vector<rowid_t>& rowid_vector,
@@ -370,6 +383,10 @@ private:
     vectorized::MutableColumns _current_return_columns;
     std::vector<ColumnPredicate*> _pre_eval_block_predicate;
     std::vector<ColumnPredicate*> _short_cir_eval_predicate;
+    // num of blocks evaluated by the short circuit predicates and the common exprs, to
+    // reorder them periodically
+    int64_t _num_short_cir_eval_blocks = 0;
+    int64_t _num_common_expr_blocks = 0;
     std::vector<uint32_t> _delete_range_column_ids;
     std::vector<uint32_t> _delete_bloom_filter_column_ids;
     // when lazy materialization is enabled, segmentIter need to read data at least twice
@@ -414,6 +431,11 @@ private:
     vectorized::MutableColumns _short_key;
 
     io::FileReaderSPtr _file_reader;
+    // wraps the segment file reader to read pages of remote segment asynchronously,
+    // nullptr if page prefetch is disabled
+    std::shared_ptr<io::AsyncRangePrefetchReader> _prefetch_reader;
+    // the segment file reader of local segment if the page readahead is enabled
+    io::LocalFileReader* _local_file_reader = nullptr;
 
     // char_type or array<char> type columns cid
     std::vector<size_t> _char_type_idx;
@@ -18,6 +18,7 @@
 #include "olap/rowset/segment_v2/segment_writer.h"
 
 #include <assert.h>
+#include <gen_cpp/olap_file.pb.h>
 #include <gen_cpp/segment_v2.pb.h>
 #include <parallel_hashmap/phmap.h>
 
@@ -46,6 +47,7 @@
 #include "olap/segment_loader.h"
 #include "olap/short_key_index.h"
 #include "olap/tablet_schema.h"
+#include "olap/utils.h"
 #include "runtime/memory/mem_tracker.h"
 #include "service/point_query_executor.h"
 #include "util/coding.h"
@@ -160,11 +162,20 @@ Status SegmentWriter::init(const std::vector<uint32_t>& col_ids, bool has_key,
             opts.gram_size = tablet_index->get_gram_size();
             opts.gram_bf_size = tablet_index->get_gram_bf_size();
         }
+        // the segments written by compaction are large and stable enough to carry a filter,
+        // the columns with ngram bloom filter index are checked by the index pages instead
+        opts.need_segment_ngram_bf = _opts.write_type == DataWriteType::TYPE_COMPACTION &&
+                                     config::segment_ngram_bf_max_column_kb > 0 &&
+                                     tablet_index == nullptr && is_string_type(column.type());
+        opts.need_zstd_dict = _opts.write_type == DataWriteType::TYPE_COMPACTION &&
+                              config::segment_zstd_dict_size_kb > 0 &&
+                              opts.meta->compression() == ZSTD && is_string_type(column.type());
 
         opts.need_bitmap_index = column.has_bitmap_index();
         bool skip_inverted_index = false;
         if (_opts.rowset_ctx != nullptr) {
-            // skip write inverted index for index compaction
+            // skip write inverted index for index compaction, or the index is built
+            // asynchronously after load
             skip_inverted_index =
                     _opts.rowset_ctx->skip_inverted_index.count(column.unique_id()) > 0;
         }
@@ -809,6 +820,27 @@ Status SegmentWriter::finalize(uint64_t* segment_file_size, uint64_t* index_size
     return Status::OK();
 }
 
+void SegmentWriter::merge_column_metas(const SegmentWriter& column_group_writer) {
+    for (const auto& column_meta : column_group_writer._footer.columns()) {
+        *_footer.add_columns() = column_meta;
+    }
+}
+
+void SegmentWriter::get_column_zone_maps(std::vector<ColumnZoneMapPB>* column_zone_maps) const {
+    for (const auto& column_meta : _footer.columns()) {
+        for (const auto& index_meta : column_meta.indexes()) {
+            if (index_meta.type() == ZONE_MAP_INDEX) {
+                ColumnZoneMapPB column_zone_map;
+                column_zone_map.set_unique_id(column_meta.unique_id());
+                *column_zone_map.mutable_zone_map() =
+                        index_meta.zone_map_index().segment_zone_map();
+                column_zone_maps->push_back(std::move(column_zone_map));
+                break;
+            }
+        }
+    }
+}
+
 void SegmentWriter::clear() {
     for (auto& column_writer : _column_writers) {
         column_writer.reset();
@@ -109,6 +109,14 @@ public:
 
     uint32_t num_rows_written() const { return _num_rows_written; }
     uint32_t row_count() const { return _row_count; }
+    // for parallel vertical compaction, a value column group is written by a separate writer
+    // sharing the file of this segment, whose row count is known from the key column group
+    void set_row_count(uint32_t row_count) { _row_count = row_count; }
+    // merge the column metas of the finalized column group writer into the footer of this one
+    void merge_column_metas(const SegmentWriter& column_group_writer);
+    // segment level zone maps of the columns having one, known after the column indexes are
+    // finalized
+    void get_column_zone_maps(std::vector<ColumnZoneMapPB>* column_zone_maps) const;
 
     Status finalize(uint64_t* segment_file_size, uint64_t* index_size);
 
@@ -194,6 +194,65 @@ Status VerticalBetaRowsetWriter::_create_segment_writer(
     return Status::OK();
 }
 
+Status VerticalColumnGroupWriter::add_columns(const vectorized::Block* block) {
+    size_t num_rows = block->rows();
+    size_t row_pos = 0;
+    const auto& segment_num_rows = _rowset_writer->_segment_num_rows;
+    while (row_pos < num_rows) {
+        if (_cur_writer_idx >= segment_num_rows.size()) {
+            return Status::InternalError(
+                    "column group has more rows than key group, segment num={}",
+                    segment_num_rows.size());
+        }
+        if (_segment_writer == nullptr) {
+            auto& key_writer = _rowset_writer->_segment_writers[_cur_writer_idx];
+            segment_v2::SegmentWriterOptions writer_options;
+            writer_options.enable_unique_key_merge_on_write =
+                    _rowset_writer->_context.enable_unique_key_merge_on_write;
+            writer_options.rowset_ctx = &_rowset_writer->_context;
+            _segment_writer.reset(new segment_v2::SegmentWriter(
+                    _rowset_writer->_file_writers[_cur_writer_idx].get(),
+                    key_writer->get_segment_id(), _rowset_writer->_context.tablet_schema,
+                    _rowset_writer->_context.tablet, _rowset_writer->_context.data_dir,
+                    _rowset_writer->_context.max_rows_per_segment, writer_options, nullptr));
+            RETURN_IF_ERROR(_segment_writer->init(_col_ids, false));
+            _segment_writer->set_row_count(segment_num_rows[_cur_writer_idx]);
+        }
+        // split the block at the segment boundaries of key group
+        size_t rows_to_append =
+                std::min<size_t>(num_rows - row_pos, segment_num_rows[_cur_writer_idx] -
+                                                             _segment_writer->num_rows_written());
+        RETURN_IF_ERROR(_segment_writer->append_block(block, row_pos, rows_to_append));
+        row_pos += rows_to_append;
+        if (_segment_writer->num_rows_written() == segment_num_rows[_cur_writer_idx]) {
+            RETURN_IF_ERROR(_flush_segment());
+        }
+    }
+    return Status::OK();
+}
+
+Status VerticalColumnGroupWriter::flush_columns() {
+    if (_segment_writer != nullptr || _cur_writer_idx != _rowset_writer->_segment_num_rows.size()) {
+        return Status::InternalError("column group has less rows than key group, segment idx={}",
+                                     _cur_writer_idx);
+    }
+    return Status::OK();
+}
+
+Status VerticalColumnGroupWriter::_flush_segment() {
+    uint64_t index_size = 0;
+    {
+        std::lock_guard<std::mutex> l(_rowset_writer->_column_group_lock);
+        RETURN_IF_ERROR(_segment_writer->finalize_columns_data());
+        RETURN_IF_ERROR(_segment_writer->finalize_columns_index(&index_size));
+        _rowset_writer->_segment_writers[_cur_writer_idx]->merge_column_metas(*_segment_writer);
+    }
+    _rowset_writer->_total_index_size += static_cast<int64_t>(index_size);
+    _segment_writer.reset();
+    ++_cur_writer_idx;
+    return Status::OK();
+}
+
 Status VerticalBetaRowsetWriter::final_flush() {
     for (auto& segment_writer : _segment_writers) {
         uint64_t segment_size = 0;
@@ -204,6 +263,9 @@ Status VerticalBetaRowsetWriter::final_flush() {
             return st;
         }
         _total_data_size += segment_size;
+        std::vector<ColumnZoneMapPB> column_zone_maps;
+        segment_writer->get_column_zone_maps(&column_zone_maps);
+        _column_zone_maps.push_back(std::move(column_zone_maps));
         segment_writer.reset();
     }
     return Status::OK();
@@ -21,6 +21,7 @@
 #include <stdint.h>
 
 #include <memory>
+#include <mutex>
 #include <vector>
 
 #include "common/status.h"
@@ -32,6 +33,33 @@ namespace vectorized {
 class Block;
 } // namespace vectorized
 
+class VerticalBetaRowsetWriter;
+
+// Writes a value column group of vertical compaction into the segments created by the key
+// column group. The writers of different column groups can be used concurrently: the column
+// data are buffered in memory and only written to the segment file under the lock of the
+// rowset writer when a segment is finished.
+class VerticalColumnGroupWriter {
+public:
+    VerticalColumnGroupWriter(VerticalBetaRowsetWriter* rowset_writer,
+                              const std::vector<uint32_t>& col_ids)
+            : _rowset_writer(rowset_writer), _col_ids(col_ids) {}
+
+    Status add_columns(const vectorized::Block* block);
+
+    // flush last segment's column, all the rows of the key column group must be added
+    Status flush_columns();
+
+private:
+    Status _flush_segment();
+
+    VerticalBetaRowsetWriter* _rowset_writer;
+    std::vector<uint32_t> _col_ids;
+    // writer of current segment
+    std::unique_ptr<segment_v2::SegmentWriter> _segment_writer;
+    size_t _cur_writer_idx = 0;
+};
+
 // for vertical compaction
 class VerticalBetaRowsetWriter : public BetaRowsetWriter {
 public:
@@ -47,7 +75,16 @@ public:
     // flush when all column finished, flush column footer
     Status final_flush();
 
+    // for merging value column groups in parallel, must be called after the key column group
+    // is flushed
+    std::unique_ptr<VerticalColumnGroupWriter> create_column_group_writer(
+            const std::vector<uint32_t>& col_ids) {
+        return std::make_unique<VerticalColumnGroupWriter>(this, col_ids);
+    }
+
 private:
+    friend class VerticalColumnGroupWriter;
+
     // only key group will create segment writer
     Status _create_segment_writer(const std::vector<uint32_t>& column_ids, bool is_key,
                                   std::unique_ptr<segment_v2::SegmentWriter>* writer);
@@ -58,6 +95,8 @@ private:
 private:
     std::vector<std::unique_ptr<segment_v2::SegmentWriter>> _segment_writers;
     size_t _cur_writer_idx = 0;
+    // serialize the writes of column group writers to segment files
+    std::mutex _column_group_lock;
 };
 
 } // namespace doris
\ No newline at end of file
@@ -28,6 +28,7 @@
 #include <roaring/roaring.hh>
 #include <tuple>
 
+#include "common/config.h"
 #include "common/logging.h"
 #include "common/status.h"
 #include "gutil/hash/hash.h"
@@ -63,6 +64,7 @@
 #include "runtime/memory/mem_tracker.h"
 #include "runtime/runtime_state.h"
 #include "util/defer_op.h"
+#include "util/threadpool.h"
 #include "util/trace.h"
 #include "vec/aggregate_functions/aggregate_function.h"
 #include "vec/aggregate_functions/aggregate_function_reader.h"
@@ -103,9 +105,8 @@ public:
                 row_refs.emplace_back(block.get(), i);
             }
         }
-        // TODO: try to use pdqsort to replace std::sort
         // The block version is incremental.
-        std::stable_sort(row_refs.begin(), row_refs.end(), _cmp);
+        _stable_sort(row_refs);
 
         auto finalized_block = _tablet->tablet_schema()->create_block();
         int columns = finalized_block.columns();
@@ -236,6 +237,50 @@ private:
         const size_t _num_columns;
     };
 
+    // Sorts the row refs by chunks on the schema change sort pool, then merges the sorted
+    // chunks pairwise level by level. Both steps are stable, the rows of a key keep the order
+    // of their blocks.
+    void _stable_sort(std::vector<RowRef>& row_refs) {
+        auto* engine = StorageEngine::instance();
+        ThreadPool* pool =
+                engine == nullptr ? nullptr : engine->schema_change_sort_thread_pool().get();
+        size_t min_rows = std::max(1, config::schema_change_sort_min_rows_per_thread);
+        size_t num_chunks = std::min<size_t>(std::max(1, config::schema_change_sort_max_thread),
+                                             row_refs.size() / min_rows);
+        if (pool == nullptr || num_chunks <= 1) {
+            std::stable_sort(row_refs.begin(), row_refs.end(), _cmp);
+            return;
+        }
+
+        std::vector<size_t> bounds(num_chunks + 1);
+        for (size_t i = 0; i <= num_chunks; ++i) {
+            bounds[i] = row_refs.size() * i / num_chunks;
+        }
+        auto begin = row_refs.begin();
+        std::unique_ptr<ThreadPoolToken> token =
+                pool->new_token(ThreadPool::ExecutionMode::CONCURRENT);
+        auto run = [&](std::function<void()> func) {
+            if (!token->submit_func(func).ok()) {
+                // Fall back to sorting in the current thread.
+                func();
+            }
+        };
+        for (size_t i = 0; i < num_chunks; ++i) {
+            run([&, i] { std::stable_sort(begin + bounds[i], begin + bounds[i + 1], _cmp); });
+        }
+        token->wait();
+        for (size_t step = 1; step < num_chunks; step *= 2) {
+            for (size_t i = 0; i + step < num_chunks; i += 2 * step) {
+                size_t last = std::min(i + 2 * step, num_chunks);
+                run([&, i, step, last] {
+                    std::inplace_merge(begin + bounds[i], begin + bounds[i + step],
+                                       begin + bounds[last], _cmp);
+                });
+            }
+            token->wait();
+        }
+    }
+
     TabletSharedPtr _tablet;
     RowRefComparator _cmp;
 };
@@ -1280,6 +1325,10 @@ Status SchemaChangeHandler::_parse_request(const SchemaChangeParams& sc_params,
         } else {
             auto column_new = new_tablet_schema->column(i);
             auto column_old = base_tablet_schema->column(column_mapping->ref_column);
+            if (_can_convert_lazily(*base_tablet_schema, *new_tablet_schema, column_old,
+                                    column_new)) {
+                continue;
+            }
             if (column_new.type() != column_old.type() ||
                 column_new.precision() != column_old.precision() ||
                 column_new.frac() != column_old.frac() ||
@@ -1320,6 +1369,39 @@ Status SchemaChangeHandler::_parse_request(const SchemaChangeParams& sc_params,
     return Status::OK();
 }
 
+bool SchemaChangeHandler::_can_convert_lazily(const TabletSchema& base_tablet_schema,
+                                              const TabletSchema& new_tablet_schema,
+                                              const TabletColumn& column_old,
+                                              const TabletColumn& column_new) {
+    if (column_new.is_nullable() != column_old.is_nullable() ||
+        column_new.aggregation() != column_old.aggregation() ||
+        column_new.precision() != column_old.precision() ||
+        column_new.frac() != column_old.frac()) {
+        return false;
+    }
+    if (column_new.type() == column_old.type()) {
+        // a longer varchar, whose values and indexes are stored the same
+        return column_new.type() == FieldType::OLAP_FIELD_TYPE_VARCHAR &&
+               column_new.length() > column_old.length() &&
+               column_new.is_bf_column() == column_old.is_bf_column() &&
+               column_new.has_bitmap_index() == column_old.has_bitmap_index() &&
+               new_tablet_schema.has_inverted_index(column_new.unique_id()) ==
+                       base_tablet_schema.has_inverted_index(column_old.unique_id());
+    }
+    // a value column without index, of which the type is widened as read, the keys are
+    // sorted and encoded in the short key and primary key indexes in their old types
+    if (!config::enable_lazy_schema_change || column_new.is_key() ||
+        column_new.is_bf_column() || column_new.has_bitmap_index() ||
+        new_tablet_schema.has_inverted_index(column_new.unique_id()) ||
+        (new_tablet_schema.has_sequence_col() &&
+         new_tablet_schema.sequence_col_idx() ==
+                 new_tablet_schema.field_index(column_new.unique_id()))) {
+        return false;
+    }
+    return segment_v2::WideningColumnIterator::get_widen_func(column_old.type(),
+                                                              column_new.type()) != nullptr;
+}
+
 Status SchemaChangeHandler::_init_column_mapping(ColumnMapping* column_mapping,
                                                  const TabletColumn& column_schema,
                                                  const std::string& value) {
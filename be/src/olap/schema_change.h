@@ -278,6 +278,12 @@ private:
                                  bool* sc_sorting, bool* sc_directly);
 
     // Initialization Settings for creating a default value
+    // Whether the data of the column can be kept by a linked schema change, for a longer varchar
+    // or a widened type the old segments are converted as read until they are compacted.
+    static bool _can_convert_lazily(const TabletSchema& base_tablet_schema,
+                                    const TabletSchema& new_tablet_schema,
+                                    const TabletColumn& column_old, const TabletColumn& column_new);
+
     static Status _init_column_mapping(ColumnMapping* column_mapping,
                                        const TabletColumn& column_schema, const std::string& value);
 
@@ -166,6 +166,9 @@ StorageEngine::~StorageEngine() {
     if (_seg_compaction_thread_pool) {
         _seg_compaction_thread_pool->shutdown();
     }
+    if (_async_index_build_thread_pool) {
+        _async_index_build_thread_pool->shutdown();
+    }
     if (_tablet_meta_checkpoint_thread_pool) {
         _tablet_meta_checkpoint_thread_pool->shutdown();
     }
@@ -206,6 +206,10 @@ public:
                                   bool force);
     Status submit_seg_compaction_task(BetaRowsetWriter* writer,
                                       SegCompactionCandidatesSharedPtr segments);
+    // The number of the compactions submitted on the data dir which are queued or running.
+    int64_t submitted_compaction_num(DataDir* data_dir);
+    // permits held by the running compaction tasks
+    int64_t compaction_permit_usage() const { return _permit_limiter.usage(); }
 
     std::unique_ptr<ThreadPool>& tablet_publish_txn_thread_pool() {
         return _tablet_publish_txn_thread_pool;
@@ -213,11 +217,20 @@ public:
     std::unique_ptr<ThreadPool>& calc_delete_bitmap_thread_pool() {
         return _calc_delete_bitmap_thread_pool;
     }
+    std::unique_ptr<ThreadPool>& schema_change_sort_thread_pool() {
+        return _schema_change_sort_thread_pool;
+    }
+    std::unique_ptr<ThreadPool>& clone_download_thread_pool() {
+        return _clone_download_thread_pool;
+    }
     bool stopped() { return _stopped; }
     ThreadPool* get_bg_multiget_threadpool() { return _bg_multi_get_thread_pool.get(); }
 
     Status process_index_change_task(const TAlterInvertedIndexReq& reqest);
 
+    // build the inverted indexes which are skipped on load of the rowset in background
+    void submit_async_index_build_task(TabletSharedPtr tablet, RowsetSharedPtr rowset);
+
 private:
     // Instance should be inited from `static open()`
     // MUST NOT be called in other circumstances.
@@ -412,9 +425,12 @@ private:
     std::unique_ptr<ThreadPool> _single_replica_compaction_thread_pool;
     std::unique_ptr<ThreadPool> _seg_compaction_thread_pool;
     std::unique_ptr<ThreadPool> _cold_data_compaction_thread_pool;
+    std::unique_ptr<ThreadPool> _async_index_build_thread_pool;
 
     std::unique_ptr<ThreadPool> _tablet_publish_txn_thread_pool;
     std::unique_ptr<ThreadPool> _calc_delete_bitmap_thread_pool;
+    std::unique_ptr<ThreadPool> _schema_change_sort_thread_pool;
+    std::unique_ptr<ThreadPool> _clone_download_thread_pool;
 
     std::unique_ptr<ThreadPool> _tablet_meta_checkpoint_thread_pool;
     std::unique_ptr<ThreadPool> _bg_multi_get_thread_pool;
@@ -503,6 +503,7 @@ Status Tablet::modify_rowsets(std::vector<RowsetSharedPtr>& to_add,
             _stale_rs_version_map[rs->version()] = rs;
         }
     }
+    _clear_rowsets_snapshot();
 
     std::vector<RowsetMetaSharedPtr> rs_metas_to_add;
     for (auto& rs : to_add) {
@@ -563,6 +564,7 @@ void Tablet::delete_rowsets(const std::vector<RowsetSharedPtr>& to_delete, bool
         rs_metas.push_back(rs->rowset_meta());
         _rs_version_map.erase(rs->version());
     }
+    _clear_rowsets_snapshot();
     _tablet_meta->modify_rs_metas({}, rs_metas, !move_to_stale);
     if (move_to_stale) {
         for (auto& rs : to_delete) {
@@ -974,6 +976,47 @@ Status Tablet::capture_rs_readers(const std::vector<Version>& version_path,
     return Status::OK();
 }
 
+Status Tablet::capture_rs_readers_of_version(int64_t version,
+                                             std::vector<RowsetReaderSharedPtr>* rs_readers) {
+    DCHECK(rs_readers != nullptr && rs_readers->empty());
+    std::shared_ptr<const RowsetsSnapshot> snapshot;
+    {
+        std::lock_guard<SpinLock> l(_rowsets_snapshot_lock);
+        snapshot = _rowsets_snapshot;
+    }
+    if (snapshot == nullptr || snapshot->version != version) {
+        std::shared_lock rdlock(_meta_lock);
+        std::vector<Version> version_path;
+        RETURN_IF_ERROR(capture_consistent_versions(Version(0, version), &version_path));
+        std::vector<RowsetSharedPtr> rowsets;
+        RETURN_IF_ERROR(_capture_consistent_rowsets_unlocked(version_path, &rowsets));
+        snapshot = std::make_shared<const RowsetsSnapshot>(
+                RowsetsSnapshot {version, std::move(rowsets)});
+        // The writers replacing the rowsets hold the exclusive lock, so it is not stale.
+        if (version == max_version_unlocked().second) {
+            std::lock_guard<SpinLock> l(_rowsets_snapshot_lock);
+            _rowsets_snapshot = snapshot;
+        }
+    }
+
+    rs_readers->reserve(snapshot->rowsets.size());
+    for (const auto& rowset : snapshot->rowsets) {
+        RowsetReaderSharedPtr rs_reader;
+        auto res = rowset->create_reader(&rs_reader);
+        if (!res.ok()) {
+            LOG(WARNING) << "failed to create reader for rowset:" << rowset->rowset_id();
+            return Status::Error<CAPTURE_ROWSET_READER_ERROR>();
+        }
+        rs_readers->push_back(std::move(rs_reader));
+    }
+    return Status::OK();
+}
+
+void Tablet::_clear_rowsets_snapshot() {
+    std::lock_guard<SpinLock> l(_rowsets_snapshot_lock);
+    _rowsets_snapshot.reset();
+}
+
 bool Tablet::version_for_delete_predicate(const Version& version) {
     return _tablet_meta->version_for_delete_predicate(version);
 }
@@ -1183,6 +1226,7 @@ void Tablet::delete_all_files() {
         it.second->remove();
     }
     _rs_version_map.clear();
+    _clear_rowsets_snapshot();
 
     for (auto it : _stale_rs_version_map) {
         it.second->remove();
@@ -2666,11 +2710,27 @@ Status Tablet::lookup_row_data(const Slice& encoded_key, const RowLocation& row_
                                RowsetSharedPtr input_rowset, const TupleDescriptor* desc,
                                OlapReaderStatistics& stats, std::string& values,
                                bool write_to_cache) {
+    vectorized::MutableColumnPtr column_ptr = vectorized::ColumnString::create();
+    std::vector<uint32_t> rowids {row_location.row_id};
+    RETURN_IF_ERROR(lookup_row_data(input_rowset, row_location.segment_id, rowids, stats,
+                                    column_ptr));
+    assert(column_ptr->size() == 1);
+    StringRef value = column_ptr->get_data_at(0);
+    values = value.to_string();
+    if (write_to_cache) {
+        RowCache::instance()->insert({tablet_id(), encoded_key}, Slice {value.data, value.size});
+    }
+    return Status::OK();
+}
+
+Status Tablet::lookup_row_data(RowsetSharedPtr input_rowset, uint32_t segment_id,
+                               const std::vector<uint32_t>& rowids,
+                               OlapReaderStatistics& stats,
+                               vectorized::MutableColumnPtr& values) {
     // read row data
     BetaRowsetSharedPtr rowset = std::static_pointer_cast<BetaRowset>(input_rowset);
     if (!rowset) {
-        return Status::NotFound(
-                fmt::format("rowset {} not found", row_location.rowset_id.to_string()));
+        return Status::NotFound("rowset not found");
     }
 
     const TabletSchemaSPtr tablet_schema = rowset->tablet_schema();
@@ -2678,22 +2738,20 @@ Status Tablet::lookup_row_data(const Slice& encoded_key, const RowLocation& row_
     RETURN_IF_ERROR(SegmentLoader::instance()->load_segments(rowset, &segment_cache, true));
     // find segment
     auto it = std::find_if(segment_cache.get_segments().begin(), segment_cache.get_segments().end(),
-                           [&row_location](const segment_v2::SegmentSharedPtr& seg) {
-                               return seg->id() == row_location.segment_id;
+                           [segment_id](const segment_v2::SegmentSharedPtr& seg) {
+                               return seg->id() == segment_id;
                            });
     if (it == segment_cache.get_segments().end()) {
         return Status::NotFound(fmt::format("rowset {} 's segemnt not found, seg_id {}",
-                                            row_location.rowset_id.to_string(),
-                                            row_location.segment_id));
+                                            rowset->rowset_id().to_string(), segment_id));
     }
     // read from segment column by column, row by row
     segment_v2::SegmentSharedPtr segment = *it;
-    size_t row_size = 0;
     MonotonicStopWatch watch;
     watch.start();
     Defer _defer([&]() {
-        LOG_EVERY_N(INFO, 500) << "get a single_row, cost(us):" << watch.elapsed_time() / 1000
-                               << ", row_size:" << row_size;
+        LOG_EVERY_N(INFO, 500) << "get rows, cost(us):" << watch.elapsed_time() / 1000
+                               << ", num_rows:" << rowids.size();
     });
     CHECK(tablet_schema->store_row_column());
     // create _source column
@@ -2705,17 +2763,48 @@ Status Tablet::lookup_row_data(const Slice& encoded_key, const RowLocation& row_
     opt.stats = &stats;
     opt.use_page_cache = !config::disable_storage_page_cache;
     column_iterator->init(opt);
-    // get and parse tuple row
-    vectorized::MutableColumnPtr column_ptr = vectorized::ColumnString::create();
-    std::vector<segment_v2::rowid_t> rowids {static_cast<segment_v2::rowid_t>(row_location.row_id)};
-    RETURN_IF_ERROR(column_iterator->read_by_rowids(rowids.data(), 1, column_ptr));
-    assert(column_ptr->size() == 1);
-    auto string_column = static_cast<vectorized::ColumnString*>(column_ptr.get());
-    StringRef value = string_column->get_data_at(0);
-    values = value.to_string();
-    if (write_to_cache) {
-        StringRef value = string_column->get_data_at(0);
-        RowCache::instance()->insert({tablet_id(), encoded_key}, Slice {value.data, value.size});
+    // get tuple rows, the rows in the same page are decoded by only one page read
+    RETURN_IF_ERROR(column_iterator->read_by_rowids(rowids.data(), rowids.size(), values));
+    return Status::OK();
+}
+
+Status Tablet::lookup_columns_data(RowsetSharedPtr input_rowset, uint32_t segment_id,
+                                   const std::vector<uint32_t>& rowids,
+                                   const std::vector<int32_t>& col_unique_ids,
+                                   OlapReaderStatistics& stats,
+                                   vectorized::MutableColumns& values) {
+    BetaRowsetSharedPtr rowset = std::static_pointer_cast<BetaRowset>(input_rowset);
+    if (!rowset) {
+        return Status::NotFound("rowset not found");
+    }
+    SegmentCacheHandle segment_cache;
+    RETURN_IF_ERROR(SegmentLoader::instance()->load_segments(rowset, &segment_cache, true));
+    auto it = std::find_if(segment_cache.get_segments().begin(), segment_cache.get_segments().end(),
+                           [segment_id](const segment_v2::SegmentSharedPtr& seg) {
+                               return seg->id() == segment_id;
+                           });
+    if (it == segment_cache.get_segments().end()) {
+        return Status::NotFound(fmt::format("rowset {} 's segemnt not found, seg_id {}",
+                                            rowset->rowset_id().to_string(), segment_id));
+    }
+    segment_v2::SegmentSharedPtr segment = *it;
+    // the columns added after the rowset is written are read as their default values
+    const TabletSchemaSPtr tablet_schema = this->tablet_schema();
+    segment_v2::ColumnIteratorOptions opt;
+    opt.file_reader = segment->file_reader().get();
+    opt.stats = &stats;
+    opt.use_page_cache = !config::disable_storage_page_cache;
+    values.clear();
+    for (int32_t col_unique_id : col_unique_ids) {
+        const TabletColumn& column = tablet_schema->column_by_uid(col_unique_id);
+        std::unique_ptr<segment_v2::ColumnIterator> column_iterator;
+        RETURN_IF_ERROR(segment->new_column_iterator(column, &column_iterator));
+        RETURN_IF_ERROR(column_iterator->init(opt));
+        auto value = vectorized::DataTypeFactory::instance()
+                             .create_data_type(column, column.is_nullable())
+                             ->create_column();
+        RETURN_IF_ERROR(column_iterator->read_by_rowids(rowids.data(), rowids.size(), value));
+        values.push_back(std::move(value));
     }
     return Status::OK();
 }
@@ -2975,13 +3064,34 @@ Status Tablet::calc_delete_bitmap(RowsetSharedPtr rowset,
     }
 
     OlapStopWatch watch;
+    // The segments whose keys can not exist in the specified rowsets need no lookup at all,
+    // which is common for the small delta left to publish.
+    std::vector<segment_v2::SegmentSharedPtr> segments_to_calc;
+    segments_to_calc.reserve(segments.size());
+    for (auto& seg : segments) {
+        bool may_overlap = true;
+        RETURN_IF_ERROR(_segment_may_overlap_rowsets(seg, specified_rowset_ids, end_version,
+                                                     &may_overlap));
+        if (may_overlap) {
+            segments_to_calc.push_back(seg);
+        }
+    }
+    size_t num_skipped = segments.size() - segments_to_calc.size();
+    DorisMetrics::instance()->delete_bitmap_calc_segment_total->increment(segments.size());
+    DorisMetrics::instance()->delete_bitmap_calc_segment_skipped_total->increment(num_skipped);
+    if (segments_to_calc.empty()) {
+        LOG(INFO) << "skip to construct delete bitmap tablet: " << tablet_id()
+                  << " rowset: " << rowset_id << ", no segment overlaps the specified rowsets";
+        return Status::OK();
+    }
+
     std::vector<DeleteBitmapPtr> seg_delete_bitmaps;
     std::unique_ptr<ThreadPoolToken> token =
             StorageEngine::instance()->calc_delete_bitmap_thread_pool()->new_token(
                     ThreadPool::ExecutionMode::CONCURRENT);
     std::atomic<int> calc_status {ErrorCode::OK};
-    for (size_t i = 1; i < segments.size(); i++) {
-        auto& seg = segments[i];
+    for (size_t i = 1; i < segments_to_calc.size(); i++) {
+        auto& seg = segments_to_calc[i];
         DeleteBitmapPtr seg_delete_bitmap = std::make_shared<DeleteBitmap>(tablet_id());
         seg_delete_bitmaps.push_back(seg_delete_bitmap);
         RETURN_IF_ERROR(token->submit_func([=, &calc_status, this]() {
@@ -2997,7 +3107,7 @@ Status Tablet::calc_delete_bitmap(RowsetSharedPtr rowset,
     }
 
     // this thread calc delete bitmap of segment 0
-    RETURN_IF_ERROR(calc_segment_delete_bitmap(rowset, segments[0], specified_rowset_ids,
+    RETURN_IF_ERROR(calc_segment_delete_bitmap(rowset, segments_to_calc[0], specified_rowset_ids,
                                                delete_bitmap, end_version, rowset_writer));
     token->wait();
     auto code = calc_status.load();
@@ -3011,7 +3121,53 @@ Status Tablet::calc_delete_bitmap(RowsetSharedPtr rowset,
     LOG(INFO) << "construct delete bitmap tablet: " << tablet_id() << " rowset: " << rowset_id
               << " dummy_version: " << end_version + 1
               << " bitmap num: " << delete_bitmap->delete_bitmap.size()
+              << " skipped segments: " << num_skipped << "/" << segments.size()
               << " cost: " << watch.get_elapse_time_us() << "(us)";
+    DorisMetrics::instance()->delete_bitmap_calc_duration_us->increment(
+            watch.get_elapse_time_us());
+    return Status::OK();
+}
+
+// caller should hold meta_lock
+Status Tablet::_segment_may_overlap_rowsets(const segment_v2::SegmentSharedPtr& seg,
+                                            const RowsetIdUnorderedSet* rowset_ids,
+                                            int64_t end_version, bool* may_overlap) {
+    *may_overlap = true;
+    if (seg->num_rows() == 0) {
+        return Status::OK();
+    }
+    // compare the bounds the same way as the point lookups in lookup_row_key,
+    // which probe the rowset tree by the keys without sequence column
+    size_t seq_col_length = 0;
+    if (_schema->has_sequence_col()) {
+        seq_col_length = _schema->column(_schema->sequence_col_idx()).length() + 1;
+    }
+    std::string min_key = seg->min_key();
+    std::string max_key = seg->max_key();
+    if (min_key.size() < seq_col_length || max_key.size() < seq_col_length) {
+        return Status::OK();
+    }
+    Slice seg_min_key(min_key.data(), min_key.size() - seq_col_length);
+    Slice seg_max_key(max_key.data(), max_key.size() - seq_col_length);
+    for (const auto& rowset_id : *rowset_ids) {
+        RowsetSharedPtr rs = _rowset_tree->rs_by_id(rowset_id);
+        if (rs == nullptr) {
+            // unknown to the tree, just lookup it
+            return Status::OK();
+        }
+        if (rs->end_version() > end_version || rs->num_rows() == 0) {
+            continue;
+        }
+        std::vector<KeyBoundsPB> segments_key_bounds;
+        RETURN_IF_ERROR(rs->get_segments_key_bounds(&segments_key_bounds));
+        for (const auto& key_bounds : segments_key_bounds) {
+            if (seg_min_key.compare(key_bounds.max_key()) <= 0 &&
+                seg_max_key.compare(key_bounds.min_key()) >= 0) {
+                return Status::OK();
+            }
+        }
+    }
+    *may_overlap = false;
     return Status::OK();
 }
 
@@ -56,6 +56,7 @@
 #include "util/metrics.h"
 #include "util/once.h"
 #include "util/slice.h"
+#include "util/spinlock.h"
 
 namespace doris {
 
@@ -189,6 +190,12 @@ public:
     Status capture_rs_readers(const std::vector<Version>& version_path,
                               std::vector<RowsetReaderSharedPtr>* rs_readers) const;
 
+    // Captures the readers of [0, version] from the rowsets snapshot of the max version if it
+    // is of the version, without the meta lock. Otherwise takes the SHARED `_meta_lock`, and
+    // takes a new snapshot if the version is the max one.
+    Status capture_rs_readers_of_version(int64_t version,
+                                         std::vector<RowsetReaderSharedPtr>* rs_readers);
+
     const std::vector<RowsetMetaSharedPtr> delete_predicates() {
         return _tablet_meta->delete_predicates();
     }
@@ -240,6 +247,10 @@ public:
         _last_cumu_compaction_success_millis = millis;
     }
 
+    // used by compaction to find the hot tablets
+    int64_t last_query_time() { return _last_query_millis; }
+    void set_last_query_time(int64_t millis) { _last_query_millis = millis; }
+
     int64_t last_base_compaction_success_time() { return _last_base_compaction_success_millis; }
     void set_last_base_compaction_success_time(int64_t millis) {
         _last_base_compaction_success_millis = millis;
@@ -411,6 +422,16 @@ public:
                            RowsetSharedPtr rowset, const TupleDescriptor* desc,
                            OlapReaderStatistics& stats, std::string& values,
                            bool write_to_cache = false);
+    // Read the row store column of the rows at the ascending rowids of a segment into values
+    Status lookup_row_data(RowsetSharedPtr rowset, uint32_t segment_id,
+                           const std::vector<uint32_t>& rowids,
+                           OlapReaderStatistics& stats, vectorized::MutableColumnPtr& values);
+    // Read the columns with col_unique_ids of the rows at the ascending rowids of a segment, for
+    // the tablets without row store column. `values` are created with the types of the columns.
+    Status lookup_columns_data(RowsetSharedPtr rowset, uint32_t segment_id,
+                               const std::vector<uint32_t>& rowids,
+                               const std::vector<int32_t>& col_unique_ids,
+                               OlapReaderStatistics& stats, vectorized::MutableColumns& values);
 
     Status fetch_value_by_rowids(RowsetSharedPtr input_rowset, uint32_t segid,
                                  const std::vector<uint32_t>& rowids,
@@ -540,6 +561,8 @@ private:
     void _delete_stale_rowset_by_version(const Version& version);
     Status _capture_consistent_rowsets_unlocked(const std::vector<Version>& version_path,
                                                 std::vector<RowsetSharedPtr>* rowsets) const;
+    // Called when a rowset of the snapshot may be replaced, so it is not held any longer.
+    void _clear_rowsets_snapshot();
 
     uint32_t _calc_cumulative_compaction_score(
             std::shared_ptr<CumulativeCompactionPolicy> cumulative_compaction_policy);
@@ -554,6 +577,11 @@ private:
                                      const std::vector<segment_v2::SegmentSharedPtr>& pre_segments,
                                      const Slice& key, DeleteBitmapPtr delete_bitmap,
                                      RowLocation* loc);
+    // Whether the key range of the segment intersects any segment of the rowsets visible at
+    // end_version, if not, no key of the segment can be found in them.
+    Status _segment_may_overlap_rowsets(const segment_v2::SegmentSharedPtr& seg,
+                                        const RowsetIdUnorderedSet* rowset_ids,
+                                        int64_t end_version, bool* may_overlap);
     void _rowset_ids_difference(const RowsetIdUnorderedSet& cur, const RowsetIdUnorderedSet& pre,
                                 RowsetIdUnorderedSet* to_add, RowsetIdUnorderedSet* to_del);
     Status _load_rowset_segments(const RowsetSharedPtr& rowset,
@@ -604,6 +632,16 @@ private:
     // These _stale rowsets are been removed when rowsets' pathVersion is expired,
     // this policy is judged and computed by TimestampedVersionTracker.
     std::unordered_map<Version, RowsetSharedPtr, HashOfVersion> _stale_rs_version_map;
+
+    // The rowsets of the consistent path of [0, version], immutable once taken under the
+    // `_meta_lock`. It is swapped under a spin lock only held to copy the pointer, so the readers
+    // of the max version don't wait for a publish or a compaction holding the `_meta_lock`.
+    struct RowsetsSnapshot {
+        int64_t version;
+        std::vector<RowsetSharedPtr> rowsets;
+    };
+    SpinLock _rowsets_snapshot_lock;
+    std::shared_ptr<const RowsetsSnapshot> _rowsets_snapshot;
     // RowsetTree is used to locate rowsets containing a key or a key range quickly.
     // It's only used in UNIQUE_KEYS data model.
     std::unique_ptr<RowsetTree> _rowset_tree;
@@ -617,6 +655,8 @@ private:
     std::atomic<int64_t> _last_cumu_compaction_success_millis;
     // timestamp of last base compaction success
     std::atomic<int64_t> _last_base_compaction_success_millis;
+    // timestamp of last query scan
+    std::atomic<int64_t> _last_query_millis {0};
     std::atomic<int64_t> _cumulative_point;
     std::atomic<int64_t> _cumulative_promotion_size;
     std::atomic<int32_t> _newly_created_rowset_num;
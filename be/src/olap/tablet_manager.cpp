@@ -28,6 +28,8 @@
 #include <unistd.h>
 
 #include <algorithm>
+#include <cmath>
+#include <limits>
 #include <list>
 #include <ostream>
 
@@ -246,7 +248,7 @@ Status TabletManager::create_tablet(const TCreateTabletReq& request, std::vector
     int64_t tablet_id = request.tablet_id;
     LOG(INFO) << "begin to create tablet. tablet_id=" << tablet_id;
 
-    std::lock_guard<std::shared_mutex> wrlock(_get_tablets_shard_lock(tablet_id));
+    std::lock_guard wrlock(_get_tablets_shard_lock(tablet_id));
     // Make create_tablet operation to be idempotent:
     // 1. Return true if tablet with same tablet_id and schema_hash exist;
     //           false if tablet with same tablet_id but different schema_hash exist.
@@ -518,7 +520,7 @@ Status TabletManager::drop_tablets_on_error_root_path(
         if (local_tmp_vector[i].empty()) {
             continue;
         }
-        std::lock_guard<std::shared_mutex> wrlock(_tablets_shards[i].lock);
+        std::lock_guard wrlock(_tablets_shards[i].lock);
         for (size_t idx : local_tmp_vector[i]) {
             const TabletInfo& tablet_info = tablet_info_vec[idx];
             TTabletId tablet_id = tablet_info.tablet_id;
@@ -664,6 +666,31 @@ void TabletManager::get_tablet_stat(TTabletStatResult* result) {
     result->__set_tablet_stat_list(*local_cache);
 }
 
+// The benefit of a compaction is the read amplification it removes, which is measured by
+// the compaction score, and the cost is the data it rewrites. Base compaction rewrites the
+// whole tablet, so its score is discounted by the tablet size. Hot tablets are doubled
+// since the queries benefit from their compaction, and the tablets close to the version
+// limit go first to avoid failing the loads with too many versions.
+static double compaction_priority(const TabletSharedPtr& tablet, CompactionType compaction_type,
+                                  uint32_t compaction_score, int64_t now_ms) {
+    int64_t urgent_version_count =
+            config::max_tablet_version_num * config::compaction_urgent_version_count_percent / 100;
+    if (tablet->version_count() >= urgent_version_count) {
+        return static_cast<double>(std::numeric_limits<uint32_t>::max()) +
+               tablet->version_count();
+    }
+    double priority = compaction_score;
+    if (compaction_type == CompactionType::BASE_COMPACTION) {
+        double footprint_gb = static_cast<double>(tablet->tablet_footprint()) / GB_EXCHANGE_BYTE;
+        priority /= 1 + std::log2(1 + footprint_gb);
+    }
+    if (config::compaction_hot_tablet_window_sec > 0 &&
+        now_ms - tablet->last_query_time() <= config::compaction_hot_tablet_window_sec * 1000L) {
+        priority *= 2;
+    }
+    return priority;
+}
+
 TabletSharedPtr TabletManager::find_best_tablet_to_compaction(
         CompactionType compaction_type, DataDir* data_dir,
         const std::unordered_set<TTabletId>& tablet_submitted_compaction, uint32_t* score,
@@ -673,6 +700,7 @@ TabletSharedPtr TabletManager::find_best_tablet_to_compaction(
             compaction_type == CompactionType::BASE_COMPACTION ? "base" : "cumulative";
     uint32_t highest_score = 0;
     uint32_t compaction_score = 0;
+    double highest_priority = 0;
     TabletSharedPtr best_tablet;
     for (const auto& tablets_shard : _tablets_shards) {
         std::shared_lock rdlock(tablets_shard.lock);
@@ -724,8 +752,16 @@ TabletSharedPtr TabletManager::find_best_tablet_to_compaction(
             if (current_compaction_score < 5) {
                 tablet_ptr->set_skip_compaction(true, compaction_type, UnixSeconds());
             }
-            if (current_compaction_score > highest_score) {
-                highest_score = current_compaction_score;
+            if (current_compaction_score == 0) {
+                continue;
+            }
+            double priority = config::enable_compaction_priority_schedule
+                                      ? compaction_priority(tablet_ptr, compaction_type,
+                                                            current_compaction_score, now_ms)
+                                      : current_compaction_score;
+            highest_score = std::max(highest_score, current_compaction_score);
+            if (priority > highest_priority) {
+                highest_priority = priority;
                 compaction_score = current_compaction_score;
                 best_tablet = tablet_ptr;
             }
@@ -737,8 +773,9 @@ TabletSharedPtr TabletManager::find_best_tablet_to_compaction(
                       << "compaction_type=" << compaction_type_str
                       << ", tablet_id=" << best_tablet->tablet_id() << ", path=" << data_dir->path()
                       << ", compaction_score=" << compaction_score
-                      << ", highest_score=" << highest_score;
-        *score = compaction_score;
+                      << ", highest_score=" << highest_score
+                      << ", priority=" << highest_priority;
+        *score = highest_score;
     }
     return best_tablet;
 }
@@ -825,7 +862,7 @@ Status TabletManager::load_tablet_from_meta(DataDir* data_dir, TTabletId tablet_
             tablet->init(),
             strings::Substitute("tablet init failed. tablet=$0", tablet->full_name()));
 
-    std::lock_guard<std::shared_mutex> wrlock(_get_tablets_shard_lock(tablet_id));
+    std::lock_guard wrlock(_get_tablets_shard_lock(tablet_id));
     RETURN_NOT_OK_STATUS_WITH_WARN(
             _add_tablet_unlocked(tablet_id, tablet, update_meta, force),
             strings::Substitute("fail to add tablet. tablet=$0", tablet->full_name()));
@@ -1054,13 +1091,13 @@ Status TabletManager::start_trash_sweep() {
 
 bool TabletManager::register_clone_tablet(int64_t tablet_id) {
     tablets_shard& shard = _get_tablets_shard(tablet_id);
-    std::lock_guard<std::shared_mutex> wrlock(shard.lock);
+    std::lock_guard wrlock(shard.lock);
     return shard.tablets_under_clone.insert(tablet_id).second;
 }
 
 void TabletManager::unregister_clone_tablet(int64_t tablet_id) {
     tablets_shard& shard = _get_tablets_shard(tablet_id);
-    std::lock_guard<std::shared_mutex> wrlock(shard.lock);
+    std::lock_guard wrlock(shard.lock);
     shard.tablets_under_clone.erase(tablet_id);
 }
 
@@ -1256,7 +1293,7 @@ void TabletManager::obtain_specific_quantity_tablets(vector<TabletInfo>& tablets
     }
 }
 
-std::shared_mutex& TabletManager::_get_tablets_shard_lock(TTabletId tabletId) {
+ProfiledMutex<std::shared_mutex>& TabletManager::_get_tablets_shard_lock(TTabletId tabletId) {
     return _get_tablets_shard(tabletId).lock;
 }
 
@@ -1374,7 +1411,7 @@ void TabletManager::get_all_tablets_storage_format(TCheckStorageFormatResult* re
 std::set<int64_t> TabletManager::check_all_tablet_segment(bool repair) {
     std::set<int64_t> bad_tablets;
     for (const auto& tablets_shard : _tablets_shards) {
-        std::lock_guard<std::shared_mutex> wrlock(tablets_shard.lock);
+        std::lock_guard wrlock(tablets_shard.lock);
         for (const auto& item : tablets_shard.tablet_map) {
             TabletSharedPtr tablet = item.second;
             if (!tablet->check_all_rowset_segment()) {
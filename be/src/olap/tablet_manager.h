@@ -39,6 +39,7 @@
 #include "olap/olap_common.h"
 #include "olap/tablet.h"
 #include "olap/tablet_meta.h"
+#include "util/lock_profiler.h"
 
 namespace doris {
 
@@ -208,7 +209,7 @@ private:
 
     void _remove_tablet_from_partition(const TabletSharedPtr& tablet);
 
-    std::shared_mutex& _get_tablets_shard_lock(TTabletId tabletId);
+    ProfiledMutex<std::shared_mutex>& _get_tablets_shard_lock(TTabletId tabletId);
 
 private:
     DISALLOW_COPY_AND_ASSIGN(TabletManager);
@@ -222,7 +223,7 @@ private:
             tablets_under_clone = std::move(shard.tablets_under_clone);
         }
         // protect tablet_map, tablets_under_clone and tablets_under_restore
-        mutable std::shared_mutex lock;
+        mutable ProfiledMutex<std::shared_mutex> lock {"TabletManager::tablets_shard::lock"};
         tablet_map_t tablet_map;
         std::set<int64_t> tablets_under_clone;
     };
@@ -26,6 +26,7 @@
 #include <json2pb/pb_to_json.h>
 #include <time.h>
 
+#include <algorithm>
 #include <set>
 #include <utility>
 
@@ -422,6 +423,16 @@ Status TabletMeta::_save_meta(DataDir* data_dir) {
         LOG(FATAL) << "tablet_uid is invalid"
                    << " tablet=" << full_name() << " _tablet_uid=" << _tablet_uid.to_string();
     }
+    // The delete bitmaps are merged by version order, the saved ones of the versions up to the
+    // max version merged before serializing are in the tablet meta saved.
+    int64_t max_delete_bitmap_version = -1;
+    if (_enable_unique_key_merge_on_write) {
+        std::shared_lock rlock(delete_bitmap().lock);
+        for (const auto& [id, _] : delete_bitmap().delete_bitmap) {
+            max_delete_bitmap_version =
+                    std::max(max_delete_bitmap_version, static_cast<int64_t>(std::get<2>(id)));
+        }
+    }
     string meta_binary;
     RETURN_IF_ERROR(serialize(&meta_binary));
     Status status = TabletMetaManager::save(data_dir, tablet_id(), schema_hash(), meta_binary);
@@ -429,6 +440,10 @@ Status TabletMeta::_save_meta(DataDir* data_dir) {
         LOG(FATAL) << "fail to save tablet_meta. status=" << status << ", tablet_id=" << tablet_id()
                    << ", schema_hash=" << schema_hash();
     }
+    if (max_delete_bitmap_version != -1) {
+        status = TabletMetaManager::remove_delete_bitmaps(data_dir, tablet_id(),
+                                                          max_delete_bitmap_version);
+    }
     return status;
 }
 
@@ -80,7 +80,17 @@ Status TabletMetaManager::get_meta(DataDir* store, TTabletId tablet_id, TSchemaH
                      << " failed.";
         return s;
     }
-    return tablet_meta->deserialize(value);
+    RETURN_IF_ERROR(tablet_meta->deserialize(value));
+    if (!tablet_meta->enable_unique_key_merge_on_write()) {
+        return Status::OK();
+    }
+    Status merge_status;
+    auto merge_func = [&](int64_t, int64_t, const std::string& bitmap_value) -> bool {
+        merge_status = merge_delete_bitmap(bitmap_value, &tablet_meta->delete_bitmap());
+        return merge_status.ok();
+    };
+    RETURN_IF_ERROR(traverse_delete_bitmaps(meta, merge_func, tablet_id));
+    return merge_status;
 }
 
 Status TabletMetaManager::get_json_meta(DataDir* store, TTabletId tablet_id,
@@ -107,7 +117,7 @@ Status TabletMetaManager::save(DataDir* store, TTabletId tablet_id, TSchemaHash
     OlapMeta* meta = store->get_meta();
     VLOG_NOTICE << "save tablet meta"
                 << ", key:" << key << ", meta length:" << value.length();
-    return meta->put(META_COLUMN_FAMILY_INDEX, key, value);
+    return meta->group_put(META_COLUMN_FAMILY_INDEX, {{key, value}});
 }
 
 Status TabletMetaManager::save(DataDir* store, TTabletId tablet_id, TSchemaHash schema_hash,
@@ -128,6 +138,9 @@ Status TabletMetaManager::remove(DataDir* store, TTabletId tablet_id, TSchemaHas
     OlapMeta* meta = store->get_meta();
     Status res = meta->remove(META_COLUMN_FAMILY_INDEX, key);
     VLOG_NOTICE << "remove tablet_meta, key:" << key << ", res:" << res;
+    if (res.ok() && header_prefix == HEADER_PREFIX) {
+        res = remove_delete_bitmaps(store, tablet_id);
+    }
     return res;
 }
 
@@ -151,6 +164,88 @@ Status TabletMetaManager::traverse_headers(
     return status;
 }
 
+Status TabletMetaManager::save_delete_bitmap(DataDir* store, TTabletId tablet_id,
+                                             int64_t version, const DeleteBitmap& delete_bitmap) {
+    DeleteBitmapPB delete_bitmap_pb;
+    for (auto& [id, bitmap] : delete_bitmap.snapshot().delete_bitmap) {
+        auto& [rowset_id, segment_id, _] = id;
+        delete_bitmap_pb.add_rowset_ids(rowset_id.to_string());
+        delete_bitmap_pb.add_segment_ids(segment_id);
+        delete_bitmap_pb.add_versions(version);
+        std::string bitmap_data(bitmap.getSizeInBytes(), '\0');
+        bitmap.write(bitmap_data.data());
+        *(delete_bitmap_pb.add_segment_delete_bitmaps()) = std::move(bitmap_data);
+    }
+    std::string key = fmt::format("{}{}_{}", DELETE_BITMAP_PREFIX, tablet_id, version);
+    std::string value;
+    if (!delete_bitmap_pb.SerializeToString(&value)) {
+        return Status::Error<SERIALIZE_PROTOBUF_ERROR>("failed to serialize delete bitmap of {}",
+                                                       key);
+    }
+    VLOG_NOTICE << "save delete bitmap, key:" << key << ", length:" << value.length();
+    return store->get_meta()->put(META_COLUMN_FAMILY_INDEX, key, value);
+}
+
+Status TabletMetaManager::remove_delete_bitmaps(DataDir* store, TTabletId tablet_id,
+                                                int64_t max_version) {
+    std::vector<std::string> keys;
+    auto collect_func = [&](int64_t, int64_t version, const std::string&) -> bool {
+        if (version <= max_version) {
+            keys.push_back(fmt::format("{}{}_{}", DELETE_BITMAP_PREFIX, tablet_id, version));
+        }
+        return true;
+    };
+    OlapMeta* meta = store->get_meta();
+    RETURN_IF_ERROR(traverse_delete_bitmaps(meta, collect_func, tablet_id));
+    if (keys.empty()) {
+        return Status::OK();
+    }
+    return meta->remove(META_COLUMN_FAMILY_INDEX, keys);
+}
+
+Status TabletMetaManager::traverse_delete_bitmaps(
+        OlapMeta* meta, std::function<bool(int64_t, int64_t, const std::string&)> const& func,
+        TTabletId tablet_id) {
+    auto traverse_func = [&func](const std::string& key, const std::string& value) -> bool {
+        std::vector<std::string> parts;
+        split_string<char>(key, '_', &parts);
+        if (parts.size() != 3) {
+            LOG(WARNING) << "invalid delete bitmap key:" << key << ", split size:" << parts.size();
+            return true;
+        }
+        int64_t tablet_id = std::stol(parts[1], nullptr, 10);
+        int64_t version = std::stol(parts[2], nullptr, 10);
+        return func(tablet_id, version, value);
+    };
+    std::string prefix = DELETE_BITMAP_PREFIX;
+    if (tablet_id != -1) {
+        prefix = fmt::format("{}{}_", DELETE_BITMAP_PREFIX, tablet_id);
+    }
+    return meta->iterate(META_COLUMN_FAMILY_INDEX, prefix, traverse_func);
+}
+
+Status TabletMetaManager::merge_delete_bitmap(const std::string& value,
+                                              DeleteBitmap* delete_bitmap) {
+    DeleteBitmapPB delete_bitmap_pb;
+    if (!delete_bitmap_pb.ParseFromString(value)) {
+        return Status::Error<PARSE_PROTOBUF_ERROR>("failed to parse delete bitmap");
+    }
+    int size = delete_bitmap_pb.rowset_ids_size();
+    if (delete_bitmap_pb.segment_ids_size() != size || delete_bitmap_pb.versions_size() != size ||
+        delete_bitmap_pb.segment_delete_bitmaps_size() != size) {
+        return Status::Corruption("inconsistent sizes of delete bitmap");
+    }
+    for (int i = 0; i < size; ++i) {
+        RowsetId rowset_id;
+        rowset_id.init(delete_bitmap_pb.rowset_ids(i));
+        const auto& bitmap = delete_bitmap_pb.segment_delete_bitmaps(i);
+        DeleteBitmap::Version version = delete_bitmap_pb.versions(i);
+        delete_bitmap->merge({rowset_id, delete_bitmap_pb.segment_ids(i), version},
+                             roaring::Roaring::read(bitmap.data()));
+    }
+    return Status::OK();
+}
+
 Status TabletMetaManager::load_json_meta(DataDir* store, const std::string& meta_path) {
     std::ifstream infile(meta_path);
     char buffer[102400];
@@ -34,6 +34,10 @@ const std::string OLD_HEADER_PREFIX = "hdr_";
 
 const std::string HEADER_PREFIX = "tabletmeta_";
 
+// "dlbm_" + tablet_id + "_" + version: the delete bitmap of a version of a merge-on-write tablet
+// saved after the tablet meta, merged into it on loading.
+const std::string DELETE_BITMAP_PREFIX = "dlbm_";
+
 // Helper Class for managing tablet headers of one root path.
 class TabletMetaManager {
 public:
@@ -57,6 +61,26 @@ public:
                                    const string& header_prefix = "tabletmeta_");
 
     static Status load_json_meta(DataDir* store, const std::string& meta_path);
+
+    // Saves the delete bitmap of a published version of a merge-on-write tablet, instead of
+    // the whole tablet meta with all its delete bitmaps. The bitmaps of delete_bitmap are saved
+    // as the ones of the version. The records are removed by remove_delete_bitmaps() when the
+    // whole tablet meta is saved.
+    static Status save_delete_bitmap(DataDir* store, TTabletId tablet_id, int64_t version,
+                                     const DeleteBitmap& delete_bitmap);
+
+    // Removes the delete bitmaps saved of the versions up to max_version.
+    static Status remove_delete_bitmaps(DataDir* store, TTabletId tablet_id,
+                                        int64_t max_version = INT64_MAX);
+
+    // Calls func(tablet_id, version, value) for the delete bitmaps saved of a tablet, or of all
+    // the tablets if tablet_id is -1.
+    static Status traverse_delete_bitmaps(
+            OlapMeta* meta, std::function<bool(int64_t, int64_t, const std::string&)> const& func,
+            TTabletId tablet_id = -1);
+
+    // Merges a delete bitmap saved by save_delete_bitmap() into delete_bitmap.
+    static Status merge_delete_bitmap(const std::string& value, DeleteBitmap* delete_bitmap);
 };
 
 } // namespace doris
@@ -27,6 +27,9 @@
 #include <gen_cpp/Types_constants.h>
 #include <sys/stat.h>
 
+#include <algorithm>
+#include <atomic>
+#include <cstring>
 #include <filesystem>
 #include <memory>
 #include <mutex>
@@ -44,10 +47,13 @@
 #include "gutil/strings/stringpiece.h"
 #include "gutil/strings/strip.h"
 #include "http/http_client.h"
+#include "io/fs/file_reader.h"
 #include "io/fs/file_system.h"
+#include "io/fs/io_scheduler.h"
 #include "io/fs/local_file_system.h"
 #include "io/fs/path.h"
 #include "olap/data_dir.h"
+#include "olap/file_cache_warm_up_mgr.h"
 #include "olap/olap_common.h"
 #include "olap/olap_define.h"
 #include "olap/rowset/rowset.h"
@@ -60,8 +66,10 @@
 #include "runtime/memory/mem_tracker_limiter.h"
 #include "runtime/thread_context.h"
 #include "util/defer_op.h"
+#include "util/md5.h"
 #include "util/network_util.h"
 #include "util/stopwatch.hpp"
+#include "util/threadpool.h"
 #include "util/thrift_rpc_helper.h"
 #include "util/trace.h"
 
@@ -100,6 +108,15 @@ Status EngineCloneTask::execute() {
     }
     Status st = _do_clone();
     StorageEngine::instance()->tablet_manager()->unregister_clone_tablet(_clone_req.tablet_id);
+    if (st.ok() && config::enable_file_cache_warm_up_after_clone) {
+        int64_t job_id = 0;
+        Status warm_up_st =
+                FileCacheWarmUpMgr::instance()->submit({_clone_req.tablet_id}, &job_id);
+        if (!warm_up_st.ok()) {
+            LOG(WARNING) << "failed to warm up file cache of cloned tablet "
+                         << _clone_req.tablet_id << ", " << warm_up_st;
+        }
+    }
     return st;
 }
 
@@ -423,67 +440,43 @@ Status EngineCloneTask::_download_files(DataDir* data_dir, const std::string& re
         }
     }
 
-    // Get copy from remote
+    // Get the sizes of the files, to split the large files into ranges
+    std::vector<uint64_t> file_sizes(file_name_list.size(), 0);
     uint64_t total_file_size = 0;
-    MonotonicStopWatch watch;
-    watch.start();
-    for (auto& file_name : file_name_list) {
-        auto remote_file_url = remote_url_prefix + file_name;
-
-        // get file length
-        uint64_t file_size = 0;
-        auto get_file_size_cb = [&remote_file_url, &file_size](HttpClient* client) {
+    for (size_t i = 0; i < file_name_list.size(); ++i) {
+        auto remote_file_url = remote_url_prefix + file_name_list[i];
+        auto get_file_size_cb = [&remote_file_url, &file_sizes, i](HttpClient* client) {
             RETURN_IF_ERROR(client->init(remote_file_url));
             client->set_timeout_ms(GET_LENGTH_TIMEOUT * 1000);
             RETURN_IF_ERROR(client->head());
-            RETURN_IF_ERROR(client->get_content_length(&file_size));
+            RETURN_IF_ERROR(client->get_content_length(&file_sizes[i]));
             return Status::OK();
         };
         RETURN_IF_ERROR(
                 HttpClient::execute_with_retry(DOWNLOAD_FILE_MAX_RETRY, 1, get_file_size_cb));
-        // check disk capacity
-        if (data_dir->reach_capacity_limit(file_size)) {
-            return Status::InternalError("Disk reach capacity limit");
-        }
-
-        total_file_size += file_size;
-        uint64_t estimate_timeout = file_size / config::download_low_speed_limit_kbps / 1024;
-        if (estimate_timeout < config::download_low_speed_time) {
-            estimate_timeout = config::download_low_speed_time;
-        }
-
-        std::string local_file_path = local_path + "/" + file_name;
-
-        LOG(INFO) << "clone begin to download file from: " << remote_file_url
-                  << " to: " << local_file_path << ". size(B): " << file_size
-                  << ", timeout(s): " << estimate_timeout;
-
-        auto download_cb = [&remote_file_url, estimate_timeout, &local_file_path,
-                            file_size](HttpClient* client) {
-            RETURN_IF_ERROR(client->init(remote_file_url));
-            client->set_timeout_ms(estimate_timeout * 1000);
-            RETURN_IF_ERROR(client->download(local_file_path));
-
-            std::error_code ec;
-            // Check file length
-            uint64_t local_file_size = std::filesystem::file_size(local_file_path, ec);
-            if (ec) {
-                LOG(WARNING) << "download file error" << ec.message();
-                return Status::IOError("can't retrive file_size of {}, due to {}", local_file_path,
-                                       ec.message());
-            }
-            if (local_file_size != file_size) {
-                LOG(WARNING) << "download file length error"
-                             << ", remote_path=" << remote_file_url << ", file_size=" << file_size
-                             << ", local_file_size=" << local_file_size;
-                return Status::InternalError("downloaded file size is not equal");
-            }
-            chmod(local_file_path.c_str(), S_IRUSR | S_IWUSR);
-            return Status::OK();
-        };
-        RETURN_IF_ERROR(HttpClient::execute_with_retry(DOWNLOAD_FILE_MAX_RETRY, 1, download_cb));
-    } // Clone files from remote backend
+        total_file_size += file_sizes[i];
+    }
+    // check disk capacity
+    if (data_dir->reach_capacity_limit(total_file_size)) {
+        return Status::InternalError("Disk reach capacity limit");
+    }
 
+    MonotonicStopWatch watch;
+    watch.start();
+    // The data files are downloaded by ranges in parallel, then the header file in the end.
+    size_t num_data_files = file_name_list.size();
+    if (num_data_files > 0 && StringPiece(file_name_list.back()).ends_with(".hdr")) {
+        --num_data_files;
+    }
+    bool range_supported = true;
+    RETURN_IF_ERROR(_download_ranges(data_dir, remote_url_prefix, local_path, file_name_list,
+                                     file_sizes, num_data_files, &range_supported));
+    // All the files are downloaded as a whole if the source is of an old version not supporting
+    // ranges.
+    for (size_t i = range_supported ? num_data_files : 0; i < file_name_list.size(); ++i) {
+        RETURN_IF_ERROR(_download_file(remote_url_prefix + file_name_list[i],
+                                       local_path + "/" + file_name_list[i], file_sizes[i]));
+    }
     uint64_t total_time_ms = watch.elapsed_time() / 1000 / 1000;
     total_time_ms = total_time_ms > 0 ? total_time_ms : 0;
     double copy_rate = 0.0;
@@ -499,6 +492,199 @@ Status EngineCloneTask::_download_files(DataDir* data_dir, const std::string& re
     return Status::OK();
 }
 
+Status EngineCloneTask::_download_file(const std::string& remote_file_url,
+                                       const std::string& local_file_path, uint64_t file_size) {
+    uint64_t estimate_timeout = file_size / config::download_low_speed_limit_kbps / 1024;
+    if (estimate_timeout < config::download_low_speed_time) {
+        estimate_timeout = config::download_low_speed_time;
+    }
+
+    LOG(INFO) << "clone begin to download file from: " << remote_file_url
+              << " to: " << local_file_path << ". size(B): " << file_size
+              << ", timeout(s): " << estimate_timeout;
+
+    auto download_cb = [&remote_file_url, estimate_timeout, &local_file_path,
+                        file_size](HttpClient* client) {
+        RETURN_IF_ERROR(client->init(remote_file_url));
+        client->set_timeout_ms(estimate_timeout * 1000);
+        RETURN_IF_ERROR(client->download(local_file_path));
+
+        std::error_code ec;
+        // Check file length
+        uint64_t local_file_size = std::filesystem::file_size(local_file_path, ec);
+        if (ec) {
+            LOG(WARNING) << "download file error" << ec.message();
+            return Status::IOError("can't retrive file_size of {}, due to {}", local_file_path,
+                                   ec.message());
+        }
+        if (local_file_size != file_size) {
+            LOG(WARNING) << "download file length error"
+                         << ", remote_path=" << remote_file_url << ", file_size=" << file_size
+                         << ", local_file_size=" << local_file_size;
+            return Status::InternalError("downloaded file size is not equal");
+        }
+        chmod(local_file_path.c_str(), S_IRUSR | S_IWUSR);
+        return Status::OK();
+    };
+    return HttpClient::execute_with_retry(DOWNLOAD_FILE_MAX_RETRY, 1, download_cb);
+}
+
+Status EngineCloneTask::_download_ranges(DataDir* data_dir, const std::string& remote_url_prefix,
+                                         const std::string& local_path,
+                                         const std::vector<std::string>& file_names,
+                                         const std::vector<uint64_t>& file_sizes,
+                                         size_t num_files, bool* range_supported) {
+    struct DownloadRange {
+        size_t file;
+        uint64_t offset;
+        uint64_t size;
+        uint64_t downloaded = 0;
+        bool resumed = false;
+    };
+    uint64_t range_bytes = std::max<int64_t>(config::clone_download_range_bytes, 1024 * 1024);
+    std::vector<DownloadRange> ranges;
+    std::vector<int> num_file_ranges(num_files, 0);
+    for (size_t i = 0; i < num_files; ++i) {
+        // create the file first, the ranges write into it
+        std::string local_file_path = local_path + "/" + file_names[i];
+        int fd = open(local_file_path.c_str(), O_WRONLY | O_CREAT | O_TRUNC, S_IRUSR | S_IWUSR);
+        if (fd < 0) {
+            return Status::IOError("failed to create {}: {}", local_file_path, strerror(errno));
+        }
+        close(fd);
+        for (uint64_t offset = 0; offset < file_sizes[i]; offset += range_bytes) {
+            ranges.push_back({i, offset, std::min(range_bytes, file_sizes[i] - offset)});
+            ++num_file_ranges[i];
+        }
+    }
+
+    // the writes of the downloaded bytes are scheduled on the disk with the compaction reads
+    struct stat dir_stat;
+    uint64_t device = stat(data_dir->path().c_str(), &dir_stat) == 0 ? dir_stat.st_dev : 0;
+    std::atomic<bool> failed {false};
+    std::atomic<bool> not_supported {false};
+    auto download_range = [&](DownloadRange& range) -> Status {
+        if (failed || not_supported) {
+            return Status::Cancelled("clone is cancelled");
+        }
+        std::string remote_file_url = remote_url_prefix + file_names[range.file];
+        std::string local_file_path = local_path + "/" + file_names[range.file];
+        uint64_t timeout_s = std::max<uint64_t>(
+                range.size / config::download_low_speed_limit_kbps / 1024,
+                config::download_low_speed_time);
+        // A failed download is resumed from the bytes downloaded, and retried as long as it
+        // makes progress.
+        Status st;
+        uint32_t failures = 0;
+        while (true) {
+            uint64_t downloaded = range.downloaded;
+            HttpClient client;
+            st = client.init(remote_file_url);
+            if (st.ok()) {
+                client.set_timeout_ms(timeout_s * 1000);
+                st = client.download_range(
+                        local_file_path, range.offset, range.size, &range.downloaded,
+                        [device](size_t length) {
+                            io::IOScheduler::instance()->schedule_clone(device, length);
+                        });
+            }
+            if (st.ok() || st.is<NOT_IMPLEMENTED_ERROR>() || failed) {
+                break;
+            }
+            failures = range.downloaded > downloaded ? 1 : failures + 1;
+            if (failures >= DOWNLOAD_FILE_MAX_RETRY) {
+                break;
+            }
+            range.resumed |= range.downloaded > 0;
+            LOG(WARNING) << "failed to download range of " << remote_file_url
+                         << ", offset=" << range.offset << ", size=" << range.size
+                         << ", resume from " << range.downloaded << ": " << st;
+            sleep(1);
+        }
+        if (st.is<NOT_IMPLEMENTED_ERROR>()) {
+            not_supported = true;
+        } else if (!st.ok()) {
+            failed = true;
+        }
+        return st;
+    };
+
+    std::vector<Status> range_status(ranges.size());
+    std::unique_ptr<ThreadPoolToken> token =
+            StorageEngine::instance()->clone_download_thread_pool()->new_token(
+                    ThreadPool::ExecutionMode::CONCURRENT,
+                    std::max(1, config::clone_download_concurrency_per_task));
+    for (size_t i = 0; i < ranges.size(); ++i) {
+        auto st = token->submit_func([&, i]() {
+            SCOPED_ATTACH_TASK(_mem_tracker);
+            range_status[i] = download_range(ranges[i]);
+        });
+        if (!st.ok()) {
+            // Fall back to downloading the range in the current thread.
+            range_status[i] = download_range(ranges[i]);
+        }
+    }
+    token->wait();
+    if (not_supported) {
+        LOG(INFO) << "source of " << remote_url_prefix << " does not support range download";
+        *range_supported = false;
+        return Status::OK();
+    }
+    for (auto& st : range_status) {
+        if (!st.ok() && !st.is<CANCELLED>()) {
+            return st;
+        }
+    }
+    // A file downloaded by ranges or resumed is verified by its md5 on the source.
+    std::vector<bool> to_verify(num_files, config::clone_verify_all_checksums);
+    for (auto& range : ranges) {
+        if (range.resumed || num_file_ranges[range.file] > 1) {
+            to_verify[range.file] = true;
+        }
+    }
+    for (size_t i = 0; i < num_files; ++i) {
+        if (to_verify[i] && file_sizes[i] > 0) {
+            RETURN_IF_ERROR(_verify_md5(remote_url_prefix + file_names[i],
+                                        local_path + "/" + file_names[i]));
+        }
+    }
+    return Status::OK();
+}
+
+Status EngineCloneTask::_verify_md5(const std::string& remote_file_url,
+                                    const std::string& local_file_path) {
+    std::string remote_md5;
+    auto get_md5_cb = [&remote_file_url, &remote_md5](HttpClient* client) {
+        RETURN_IF_ERROR(client->init(remote_file_url + "&acquire_md5=true"));
+        client->set_timeout_ms(config::download_low_speed_time * 1000);
+        remote_md5.clear();
+        return client->execute(&remote_md5);
+    };
+    RETURN_IF_ERROR(HttpClient::execute_with_retry(DOWNLOAD_FILE_MAX_RETRY, 1, get_md5_cb));
+
+    io::FileReaderSPtr reader;
+    RETURN_IF_ERROR(io::global_local_filesystem()->open_file(local_file_path, &reader));
+    Md5Digest digest;
+    static constexpr size_t MD5_BUFFER_SIZE = 1024 * 1024;
+    std::unique_ptr<char[]> buf(new char[MD5_BUFFER_SIZE]);
+    for (size_t offset = 0; offset < reader->size();) {
+        size_t bytes_read = 0;
+        RETURN_IF_ERROR(reader->read_at(offset, Slice(buf.get(), MD5_BUFFER_SIZE), &bytes_read));
+        if (bytes_read == 0) {
+            return Status::IOError("unexpected end of {}", local_file_path);
+        }
+        digest.update(buf.get(), bytes_read);
+        offset += bytes_read;
+    }
+    digest.digest();
+    if (digest.hex() != remote_md5) {
+        LOG(WARNING) << "md5 of downloaded file " << local_file_path << " is " << digest.hex()
+                     << ", not equal to " << remote_md5 << " of " << remote_file_url;
+        return Status::InternalError("md5 of downloaded file {} is not equal", local_file_path);
+    }
+    return Status::OK();
+}
+
 /// This method will only be called if tablet already exist in this BE when doing clone.
 /// This method will do the following things:
 /// 1. Linke all files from CLONE dir to tablet dir if file does not exist in tablet dir
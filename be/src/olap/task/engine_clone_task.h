@@ -79,6 +79,20 @@ private:
     Status _download_files(DataDir* data_dir, const std::string& remote_url_prefix,
                            const std::string& local_path);
 
+    Status _download_file(const std::string& remote_file_url, const std::string& local_file_path,
+                          uint64_t file_size);
+
+    // Downloads the first num_files files by ranges in parallel, a range is resumed on failure.
+    // Sets *range_supported to false if the source does not support ranges, then the files have
+    // to be downloaded as a whole.
+    Status _download_ranges(DataDir* data_dir, const std::string& remote_url_prefix,
+                            const std::string& local_path,
+                            const std::vector<std::string>& file_names,
+                            const std::vector<uint64_t>& file_sizes, size_t num_files,
+                            bool* range_supported);
+
+    Status _verify_md5(const std::string& remote_file_url, const std::string& local_file_path);
+
     Status _make_snapshot(const std::string& ip, int port, TTableId tablet_id,
                           TSchemaHash schema_hash, int timeout_s,
                           const std::vector<Version>& missing_versions, std::string* snapshot_path,
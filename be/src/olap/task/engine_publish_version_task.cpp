@@ -63,8 +63,9 @@ void EnginePublishVersionTask::add_succ_tablet_id(int64_t tablet_id) {
 }
 
 void EnginePublishVersionTask::wait() {
+    // the count is checked under the lock notify() takes, so that its notification is not lost
     std::unique_lock<std::mutex> lock(_tablet_finish_mutex);
-    _tablet_finish_cond.wait(lock);
+    _tablet_finish_cond.wait(lock, [this] { return _total_task_num.load() == 0; });
 }
 
 void EnginePublishVersionTask::notify() {
@@ -167,10 +168,9 @@ Status EnginePublishVersionTask::finish() {
             CHECK(submit_st.ok()) << submit_st;
         }
     }
-    // wait for all publish txn finished
-    while (_total_task_num.load() != 0) {
-        wait();
-    }
+    // wait for all publish txn finished, the rowset metas they save are written in groups by
+    // OlapMeta::group_put, while the ones of merge-on-write tablets update their delete bitmaps
+    wait();
 
     // check if the related tablet remained all have the version
     for (auto& par_ver_info : _publish_version_req.partition_version_infos) {
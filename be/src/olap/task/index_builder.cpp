@@ -18,9 +18,12 @@
 #include "olap/task/index_builder.h"
 
 #include "common/status.h"
+#include "io/fs/file_system.h"
+#include "olap/inverted_index_parser.h"
 #include "olap/rowset/beta_rowset.h"
 #include "olap/rowset/rowset_writer.h"
 #include "olap/rowset/rowset_writer_context.h"
+#include "olap/rowset/segment_v2/inverted_index_cache.h"
 #include "olap/segment_loader.h"
 #include "olap/storage_engine.h"
 #include "olap/tablet_schema.h"
@@ -124,108 +127,112 @@ Status IndexBuilder::handle_single_rowset(RowsetMetaSharedPtr output_rowset_meta
         // delete invertd index file by gc thread when gc input rowset
         return Status::OK();
     } else {
-        // create inverted index writer
-        std::string segment_dir = _tablet->tablet_path();
-        auto fs = output_rowset_meta->fs();
-        auto output_rowset_schema = output_rowset_meta->tablet_schema();
         for (auto& seg_ptr : segments) {
             std::string segment_filename = fmt::format(
                     "{}_{}.dat", output_rowset_meta->rowset_id().to_string(), seg_ptr->id());
-            std::vector<ColumnId> return_columns;
-            std::vector<std::pair<int64_t, int64_t>> inverted_index_writer_signs;
-            _olap_data_convertor->reserve(_alter_inverted_indexes.size());
-            // create inverted index writer
-            for (auto i = 0; i < _alter_inverted_indexes.size(); ++i) {
-                auto inverted_index = _alter_inverted_indexes[i];
-                DCHECK_EQ(inverted_index.columns.size(), 1);
-                auto index_id = inverted_index.index_id;
-                auto column_name = inverted_index.columns[0];
-                auto column_idx = output_rowset_schema->field_index(column_name);
-                if (column_idx < 0) {
-                    LOG(WARNING) << "referenced column was missing. "
-                                 << "[column=" << column_name << " referenced_column=" << column_idx
-                                 << "]";
-                    continue;
-                }
-                auto column = output_rowset_schema->column(column_idx);
-                DCHECK(output_rowset_schema->has_inverted_index_with_index_id(index_id));
-                _olap_data_convertor->add_column_data_convertor(column);
-                return_columns.emplace_back(column_idx);
-                std::unique_ptr<Field> field(FieldFactory::create(column));
-                auto index_meta = output_rowset_schema->get_inverted_index(column.unique_id());
-                std::unique_ptr<segment_v2::InvertedIndexColumnWriter> inverted_index_builder;
-                try {
-                    RETURN_IF_ERROR(segment_v2::InvertedIndexColumnWriter::create(
-                            field.get(), &inverted_index_builder, segment_filename, segment_dir,
-                            index_meta, fs));
-                } catch (const std::exception& e) {
-                    LOG(WARNING) << "CLuceneError occured: " << e.what();
-                    return Status::Error<ErrorCode::IO_ERROR>();
-                }
+            RETURN_IF_ERROR(_handle_single_segment(output_rowset_meta, seg_ptr, segment_filename));
+        }
+        LOG(INFO) << "all row nums. source_rows=" << output_rowset_meta->num_rows();
+    }
 
-                if (inverted_index_builder) {
-                    auto writer_sign = std::make_pair(seg_ptr->id(), index_id);
-                    _inverted_index_builders.insert(
-                            std::make_pair(writer_sign, std::move(inverted_index_builder)));
-                    inverted_index_writer_signs.push_back(writer_sign);
-                }
-            }
+    return Status::OK();
+}
 
-            // create iterator for each segment
-            StorageReadOptions read_options;
-            OlapReaderStatistics stats;
-            read_options.stats = &stats;
-            read_options.tablet_schema = output_rowset_schema;
-            std::shared_ptr<Schema> schema =
-                    std::make_shared<Schema>(output_rowset_schema->columns(), return_columns);
-            std::unique_ptr<RowwiseIterator> iter;
-            auto res = seg_ptr->new_iterator(schema, read_options, &iter);
-            if (!res.ok()) {
-                LOG(WARNING) << "failed to create iterator[" << seg_ptr->id()
-                             << "]: " << res.to_string();
-                return Status::Error<ErrorCode::ROWSET_READER_INIT>();
-            }
+Status IndexBuilder::_handle_single_segment(RowsetMetaSharedPtr output_rowset_meta,
+                                            const segment_v2::SegmentSharedPtr& seg_ptr,
+                                            const std::string& segment_filename) {
+    // create inverted index writer
+    std::string segment_dir = _tablet->tablet_path();
+    auto fs = output_rowset_meta->fs();
+    auto output_rowset_schema = output_rowset_meta->tablet_schema();
+    std::vector<ColumnId> return_columns;
+    std::vector<std::pair<int64_t, int64_t>> inverted_index_writer_signs;
+    _olap_data_convertor->reserve(_alter_inverted_indexes.size());
+    // create inverted index writer
+    for (auto i = 0; i < _alter_inverted_indexes.size(); ++i) {
+        auto inverted_index = _alter_inverted_indexes[i];
+        DCHECK_EQ(inverted_index.columns.size(), 1);
+        auto index_id = inverted_index.index_id;
+        auto column_name = inverted_index.columns[0];
+        auto column_idx = output_rowset_schema->field_index(column_name);
+        if (column_idx < 0) {
+            LOG(WARNING) << "referenced column was missing. "
+                         << "[column=" << column_name << " referenced_column=" << column_idx << "]";
+            continue;
+        }
+        auto column = output_rowset_schema->column(column_idx);
+        DCHECK(output_rowset_schema->has_inverted_index_with_index_id(index_id));
+        _olap_data_convertor->add_column_data_convertor(column);
+        return_columns.emplace_back(column_idx);
+        std::unique_ptr<Field> field(FieldFactory::create(column));
+        auto index_meta = output_rowset_schema->get_inverted_index(column.unique_id());
+        std::unique_ptr<segment_v2::InvertedIndexColumnWriter> inverted_index_builder;
+        try {
+            RETURN_IF_ERROR(segment_v2::InvertedIndexColumnWriter::create(
+                    field.get(), &inverted_index_builder, segment_filename, segment_dir, index_meta,
+                    fs));
+        } catch (const std::exception& e) {
+            LOG(WARNING) << "CLuceneError occured: " << e.what();
+            return Status::Error<ErrorCode::IO_ERROR>();
+        }
 
-            std::shared_ptr<vectorized::Block> block = std::make_shared<vectorized::Block>(
-                    output_rowset_schema->create_block(return_columns));
-            while (true) {
-                auto st = iter->next_batch(block.get());
-                if (!st.ok()) {
-                    if (st.is<ErrorCode::END_OF_FILE>()) {
-                        break;
-                    }
-                    LOG(WARNING)
-                            << "failed to read next block when schema change for inverted index."
-                            << ", err=" << st.to_string();
-                }
+        if (inverted_index_builder) {
+            auto writer_sign = std::make_pair(seg_ptr->id(), index_id);
+            _inverted_index_builders.insert(
+                    std::make_pair(writer_sign, std::move(inverted_index_builder)));
+            inverted_index_writer_signs.push_back(writer_sign);
+        }
+    }
 
-                // write inverted index data
-                if (_write_inverted_index_data(output_rowset_schema, iter->data_id(),
-                                               block.get()) != Status::OK()) {
-                    LOG(WARNING) << "failed to write block.";
-                    return Status::Error<ErrorCode::SCHEMA_CHANGE_INFO_INVALID>();
-                }
-                block->clear_column_data();
-            }
+    // create iterator for each segment
+    StorageReadOptions read_options;
+    OlapReaderStatistics stats;
+    read_options.stats = &stats;
+    read_options.tablet_schema = output_rowset_schema;
+    std::shared_ptr<Schema> schema =
+            std::make_shared<Schema>(output_rowset_schema->columns(), return_columns);
+    std::unique_ptr<RowwiseIterator> iter;
+    auto res = seg_ptr->new_iterator(schema, read_options, &iter);
+    if (!res.ok()) {
+        LOG(WARNING) << "failed to create iterator[" << seg_ptr->id() << "]: " << res.to_string();
+        return Status::Error<ErrorCode::ROWSET_READER_INIT>();
+    }
 
-            // finish write inverted index, flush data to compound file
-            for (auto& writer_sign : inverted_index_writer_signs) {
-                try {
-                    if (_inverted_index_builders[writer_sign]) {
-                        _inverted_index_builders[writer_sign]->finish();
-                    }
-                } catch (const std::exception& e) {
-                    LOG(WARNING) << "CLuceneError occured: " << e.what();
-                    return Status::Error<ErrorCode::IO_ERROR>();
-                }
+    std::shared_ptr<vectorized::Block> block =
+            std::make_shared<vectorized::Block>(output_rowset_schema->create_block(return_columns));
+    while (true) {
+        auto st = iter->next_batch(block.get());
+        if (!st.ok()) {
+            if (st.is<ErrorCode::END_OF_FILE>()) {
+                break;
             }
+            LOG(WARNING) << "failed to read next block when schema change for inverted index."
+                         << ", err=" << st.to_string();
+        }
 
-            _olap_data_convertor->reset();
+        // write inverted index data
+        if (_write_inverted_index_data(output_rowset_schema, iter->data_id(), block.get()) !=
+            Status::OK()) {
+            LOG(WARNING) << "failed to write block.";
+            return Status::Error<ErrorCode::SCHEMA_CHANGE_INFO_INVALID>();
         }
-        _inverted_index_builders.clear();
-        LOG(INFO) << "all row nums. source_rows=" << output_rowset_meta->num_rows();
+        block->clear_column_data();
     }
 
+    // finish write inverted index, flush data to compound file
+    for (auto& writer_sign : inverted_index_writer_signs) {
+        try {
+            if (_inverted_index_builders[writer_sign]) {
+                _inverted_index_builders[writer_sign]->finish();
+            }
+        } catch (const std::exception& e) {
+            LOG(WARNING) << "CLuceneError occured: " << e.what();
+            return Status::Error<ErrorCode::IO_ERROR>();
+        }
+    }
+
+    _olap_data_convertor->reset();
+    _inverted_index_builders.clear();
     return Status::OK();
 }
 
@@ -481,4 +488,83 @@ Status IndexBuilder::_calc_alter_column_ids() {
     return Status::OK();
 }
 
+Status IndexBuilder::build_pending_inverted_index(const TabletSharedPtr& tablet,
+                                                  const RowsetSharedPtr& rowset) {
+    if (!rowset->is_local() || rowset->num_segments() == 0) {
+        return Status::OK();
+    }
+    auto beta_rowset = std::static_pointer_cast<BetaRowset>(rowset);
+    auto tablet_schema = rowset->tablet_schema();
+    auto fs = rowset->rowset_meta()->fs();
+    std::vector<TOlapTableIndex> pending_indexes;
+    for (const auto& index : tablet_schema->indexes()) {
+        if (index.index_type() != IndexType::INVERTED ||
+            !is_fulltext_inverted_index(index.properties())) {
+            continue;
+        }
+        // the indexes are skipped by all segments of the rowset
+        auto index_file = segment_v2::InvertedIndexDescriptor::get_index_file_name(
+                beta_rowset->segment_file_path(0), index.index_id());
+        bool exists = true;
+        RETURN_IF_ERROR(fs->exists(index_file, &exists));
+        auto column_idx = tablet_schema->field_index(index.col_unique_ids()[0]);
+        if (exists || column_idx < 0) {
+            continue;
+        }
+        TOlapTableIndex t_index;
+        t_index.index_id = index.index_id();
+        t_index.index_name = index.index_name();
+        t_index.columns.push_back(tablet_schema->column(column_idx).name());
+        t_index.index_type = TIndexType::INVERTED;
+        t_index.__set_properties(index.properties());
+        pending_indexes.push_back(std::move(t_index));
+    }
+    if (pending_indexes.empty()) {
+        return Status::OK();
+    }
+
+    SegmentCacheHandle segment_cache_handle;
+    RETURN_IF_ERROR(SegmentLoader::instance()->load_segments(beta_rowset, &segment_cache_handle));
+    IndexBuilder builder(tablet, {}, {}, pending_indexes);
+    RETURN_IF_ERROR(builder.init());
+    std::vector<std::pair<std::string, std::string>> building_files;
+    Status st;
+    for (auto& segment : segment_cache_handle.get_segments()) {
+        // {rowset_id}_{segment_id}-building.dat, the segment file itself is never written
+        std::string building_filename =
+                fmt::format("{}_{}-building.dat", rowset->rowset_id().to_string(), segment->id());
+        auto segment_path = beta_rowset->segment_file_path(segment->id());
+        for (const auto& index : pending_indexes) {
+            auto building_file = segment_v2::InvertedIndexDescriptor::get_index_file_name(
+                    tablet->tablet_path() + "/" + building_filename, index.index_id);
+            auto index_file = segment_v2::InvertedIndexDescriptor::get_index_file_name(
+                    segment_path, index.index_id);
+            building_files.emplace_back(building_file, index_file);
+        }
+        st = builder._handle_single_segment(rowset->rowset_meta(), segment, building_filename);
+        if (!st.ok()) {
+            break;
+        }
+    }
+    for (auto& [building_file, index_file] : building_files) {
+        if (st.ok()) {
+            st = fs->rename(building_file, index_file);
+        } else {
+            fs->delete_file(building_file);
+        }
+        segment_v2::InvertedIndexSearcherCache::instance()->erase(building_file);
+    }
+    if (!st.ok()) {
+        LOG(WARNING) << "failed to build pending inverted index of rowset "
+                     << rowset->rowset_id().to_string() << ", tablet=" << tablet->tablet_id()
+                     << ", error=" << st;
+        return st;
+    }
+    LOG(INFO) << "finish building pending inverted index of rowset "
+              << rowset->rowset_id().to_string() << ", tablet=" << tablet->tablet_id()
+              << ", indexes=" << pending_indexes.size()
+              << ", segments=" << rowset->num_segments();
+    return Status::OK();
+}
+
 } // namespace doris
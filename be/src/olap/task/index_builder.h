@@ -50,7 +50,16 @@ public:
     Status modify_rowsets(const Merger::Statistics* stats = nullptr);
     void gc_output_rowset();
 
+    // Build the fulltext inverted indexes which are skipped on load of the rowset, see
+    // config::enable_async_inverted_index_build. The index files are built with temporary
+    // names and renamed when finished, so the readers never open a partial index file.
+    static Status build_pending_inverted_index(const TabletSharedPtr& tablet,
+                                               const RowsetSharedPtr& rowset);
+
 private:
+    Status _handle_single_segment(RowsetMetaSharedPtr output_rowset_meta,
+                                  const segment_v2::SegmentSharedPtr& seg_ptr,
+                                  const std::string& segment_filename);
     Status _write_inverted_index_data(TabletSchemaSPtr tablet_schema, int32_t segment_idx,
                                       vectorized::Block* block);
     Status _add_data(const std::string& column_name,
@@ -42,6 +42,7 @@
 #include "olap/storage_engine.h"
 #include "olap/tablet_manager.h"
 #include "olap/tablet_meta.h"
+#include "olap/tablet_meta_manager.h"
 #include "util/time.h"
 
 namespace doris {
@@ -78,7 +79,10 @@ TxnManager::TxnManager(int32_t txn_map_shard_size, int32_t txn_shard_size)
     _txn_map_locks = new std::shared_mutex[_txn_map_shard_size];
     _txn_tablet_maps = new txn_tablet_map_t[_txn_map_shard_size];
     _txn_partition_maps = new txn_partition_map_t[_txn_map_shard_size];
-    _txn_mutex = new std::mutex[_txn_shard_size];
+    _txn_mutex = new ProfiledMutex<std::mutex>[_txn_shard_size];
+    for (int32_t i = 0; i < _txn_shard_size; ++i) {
+        _txn_mutex[i].set_site("TxnManager::_txn_mutex");
+    }
     _txn_tablet_delta_writer_map = new txn_tablet_delta_writer_map_t[_txn_map_shard_size];
     _txn_tablet_delta_writer_map_locks = new std::shared_mutex[_txn_map_shard_size];
 }
@@ -192,7 +196,7 @@ void TxnManager::set_txn_related_delete_bitmap(TPartitionId partition_id,
     pair<int64_t, int64_t> key(partition_id, transaction_id);
     TabletInfo tablet_info(tablet_id, schema_hash, tablet_uid);
 
-    std::unique_lock<std::mutex> txn_lock(_get_txn_lock(transaction_id));
+    std::unique_lock txn_lock(_get_txn_lock(transaction_id));
     {
         // get tx
         std::lock_guard<std::shared_mutex> wrlock(_get_txn_map_lock(transaction_id));
@@ -236,7 +240,7 @@ Status TxnManager::commit_txn(OlapMeta* meta, TPartitionId partition_id,
         return Status::Error<ROWSET_INVALID>();
     }
 
-    std::unique_lock<std::mutex> txn_lock(_get_txn_lock(transaction_id));
+    std::unique_lock txn_lock(_get_txn_lock(transaction_id));
     // this while loop just run only once, just for if break
     do {
         // get tx
@@ -335,7 +339,7 @@ Status TxnManager::publish_txn(OlapMeta* meta, TPartitionId partition_id,
     TabletTxnInfo tablet_txn_info;
     /// Step 1: get rowset, tablet_txn_info by key
     {
-        std::unique_lock<std::mutex> txn_rlock(_get_txn_lock(transaction_id));
+        std::unique_lock txn_rlock(_get_txn_lock(transaction_id));
         std::shared_lock txn_map_rlock(_get_txn_map_lock(transaction_id));
 
         txn_tablet_map_t& txn_tablet_map = _get_txn_tablet_map(transaction_id);
@@ -380,8 +384,17 @@ Status TxnManager::publish_txn(OlapMeta* meta, TPartitionId partition_id,
             // erase segment cache cause we will add a segment to rowset
             SegmentLoader::instance()->erase_segment(rowset->rowset_id());
         }
-        std::shared_lock rlock(tablet->get_header_lock());
-        tablet->save_meta();
+        // only the delete bitmap of the version is saved rather than the whole tablet meta, it
+        // is merged into the tablet meta by the next save of the tablet meta, e.g. a checkpoint
+        auto st = TabletMetaManager::save_delete_bitmap(tablet->data_dir(), tablet_id,
+                                                        version.first,
+                                                        *tablet_txn_info.delete_bitmap);
+        if (!st.ok()) {
+            LOG(WARNING) << "save delete bitmap failed. when publish txn rowset_id:"
+                         << rowset->rowset_id() << ", tablet id: " << tablet_id
+                         << ", txn id:" << transaction_id << ", status: " << st;
+            return st;
+        }
     }
 
     /// Step 3:  add to binlog
@@ -415,7 +428,7 @@ Status TxnManager::publish_txn(OlapMeta* meta, TPartitionId partition_id,
 
     /// Step 5: remove tablet_info from tnx_tablet_map
     // txn_tablet_map[key] empty, remove key from txn_tablet_map
-    std::unique_lock<std::mutex> txn_lock(_get_txn_lock(transaction_id));
+    std::unique_lock txn_lock(_get_txn_lock(transaction_id));
     std::lock_guard<std::shared_mutex> wrlock(_get_txn_map_lock(transaction_id));
     txn_tablet_map_t& txn_tablet_map = _get_txn_tablet_map(transaction_id);
     if (auto it = txn_tablet_map.find(key); it != txn_tablet_map.end()) {
@@ -42,6 +42,7 @@
 #include "olap/rowset/segment_v2/segment_writer.h"
 #include "olap/tablet.h"
 #include "olap/tablet_meta.h"
+#include "util/lock_profiler.h"
 #include "util/time.h"
 #include "vec/core/block.h"
 
@@ -201,7 +202,7 @@ private:
 
     txn_partition_map_t& _get_txn_partition_map(TTransactionId transactionId);
 
-    inline std::mutex& _get_txn_lock(TTransactionId transactionId);
+    inline ProfiledMutex<std::mutex>& _get_txn_lock(TTransactionId transactionId);
 
     std::shared_mutex& _get_txn_tablet_delta_writer_map_lock(TTransactionId transactionId);
 
@@ -231,7 +232,7 @@ private:
 
     std::shared_mutex* _txn_map_locks;
 
-    std::mutex* _txn_mutex;
+    ProfiledMutex<std::mutex>* _txn_mutex;
 
     txn_tablet_delta_writer_map_t* _txn_tablet_delta_writer_map;
     std::shared_mutex* _txn_tablet_delta_writer_map_locks;
@@ -251,7 +252,7 @@ inline TxnManager::txn_partition_map_t& TxnManager::_get_txn_partition_map(
     return _txn_partition_maps[transactionId & (_txn_map_shard_size - 1)];
 }
 
-inline std::mutex& TxnManager::_get_txn_lock(TTransactionId transactionId) {
+inline ProfiledMutex<std::mutex>& TxnManager::_get_txn_lock(TTransactionId transactionId) {
     return _txn_mutex[transactionId & (_txn_shard_size - 1)];
 }
 
@@ -475,6 +475,8 @@ void VersionGraph::reconstruct_version_graph(const std::vector<RowsetMetaSharedP
                                              int64_t* max_version) {
     _version_graph.clear();
     _vertex_index_map.clear();
+    _max_vertex_value = -1;
+    _clear_path_cache();
 
     construct_version_graph(rs_metas, max_version);
 }
@@ -484,6 +486,20 @@ void VersionGraph::add_version_to_graph(const Version& version) {
     int64_t start_vertex_value = version.first;
     int64_t end_vertex_value = version.second + 1;
 
+    {
+        // A version starting right after the cached path at the last vertex is the only edge
+        // reaching past the path, so it extends the path. Any other version may be a shorter path.
+        std::lock_guard<std::mutex> l(_path_cache_lock);
+        if (_cached_path_end >= 0 && version.first == _cached_path_end + 1 &&
+            version.first >= _max_vertex_value) {
+            _cached_path.push_back(version);
+            _cached_path_end = version.second;
+        } else {
+            _cached_path_end = -1;
+            _cached_path.clear();
+        }
+    }
+
     // Add vertex to graph.
     _add_vertex_to_graph(start_vertex_value);
     _add_vertex_to_graph(end_vertex_value);
@@ -526,6 +542,15 @@ Status VersionGraph::delete_version_from_graph(const Version& version) {
         return Status::Error<HEADER_DELETE_VERSION>();
     }
 
+    {
+        // Deleting the edges off the cached path leaves its edges the largest ones.
+        std::lock_guard<std::mutex> l(_path_cache_lock);
+        if (std::find(_cached_path.begin(), _cached_path.end(), version) != _cached_path.end()) {
+            _cached_path_end = -1;
+            _cached_path.clear();
+        }
+    }
+
     int64_t start_vertex_index = _vertex_index_map[start_vertex_value];
     int64_t end_vertex_index = _vertex_index_map[end_vertex_value];
     // Remove edge and its reverse edge.
@@ -562,28 +587,57 @@ void VersionGraph::_add_vertex_to_graph(int64_t vertex_value) {
 
     _version_graph.emplace_back(Vertex(vertex_value));
     _vertex_index_map[vertex_value] = _version_graph.size() - 1;
+    _max_vertex_value = std::max(_max_vertex_value, vertex_value);
+}
+
+void VersionGraph::_clear_path_cache() {
+    std::lock_guard<std::mutex> l(_path_cache_lock);
+    _cached_path_end = -1;
+    _cached_path.clear();
 }
 
 Status VersionGraph::capture_consistent_versions(const Version& spec_version,
                                                  std::vector<Version>* version_path) const {
+    if (spec_version.first != 0 || spec_version.first > spec_version.second) {
+        return _capture_consistent_versions(spec_version, version_path);
+    }
+
+    {
+        std::lock_guard<std::mutex> l(_path_cache_lock);
+        if (_cached_path_end == spec_version.second) {
+            if (version_path != nullptr) {
+                version_path->insert(version_path->end(), _cached_path.begin(),
+                                     _cached_path.end());
+            }
+            return Status::OK();
+        }
+    }
+
+    std::vector<Version> path;
+    RETURN_IF_ERROR(_capture_consistent_versions(spec_version, &path));
+    if (version_path != nullptr) {
+        version_path->insert(version_path->end(), path.begin(), path.end());
+    }
+    std::lock_guard<std::mutex> l(_path_cache_lock);
+    _cached_path_end = spec_version.second;
+    _cached_path = std::move(path);
+    return Status::OK();
+}
+
+Status VersionGraph::_capture_consistent_versions(const Version& spec_version,
+                                                  std::vector<Version>* version_path) const {
     if (spec_version.first > spec_version.second) {
         LOG(WARNING) << "invalid specified version. "
                      << "spec_version=" << spec_version.first << "-" << spec_version.second;
         return Status::Error<INVALID_ARGUMENT>();
     }
 
-    int64_t cur_idx = -1;
-    for (size_t i = 0; i < _version_graph.size(); i++) {
-        if (_version_graph[i].value == spec_version.first) {
-            cur_idx = i;
-            break;
-        }
-    }
-
-    if (cur_idx < 0) {
+    auto start_it = _vertex_index_map.find(spec_version.first);
+    if (start_it == _vertex_index_map.end()) {
         return Status::InternalError("failed to find path in version_graph. spec_version: {}-{}",
                                      spec_version.first, spec_version.second);
     }
+    int64_t cur_idx = start_it->second;
 
     int64_t end_value = spec_version.second + 1;
     while (_version_graph[cur_idx].value < end_value) {
@@ -22,6 +22,7 @@
 
 #include <map>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <unordered_map>
 #include <vector>
@@ -52,6 +53,7 @@ public:
     Status delete_version_from_graph(const Version& version);
     /// Given a spec_version, this method can find a version path which is the shortest path
     /// in the graph. The version paths are added to version_path as return info.
+    /// The last path found from version 0 is cached, a capture of the same version is a copy.
     Status capture_consistent_versions(const Version& spec_version,
                                        std::vector<Version>* version_path) const;
 
@@ -62,6 +64,10 @@ private:
     /// Private method add a version to graph.
     void _add_vertex_to_graph(int64_t vertex_value);
 
+    Status _capture_consistent_versions(const Version& spec_version,
+                                        std::vector<Version>* version_path) const;
+    void _clear_path_cache();
+
     // OLAP version contains two parts, [start_version, end_version]. In order
     // to construct graph, the OLAP version has two corresponding vertex, one
     // vertex's value is version.start_version, the other is
@@ -73,6 +79,14 @@ private:
     // vertex value --> vertex_index of _version_graph
     // It is easy to find vertex index according to vertex value.
     std::unordered_map<int64_t, int64_t> _vertex_index_map;
+    int64_t _max_vertex_value = -1;
+
+    // The path of [0, _cached_path_end] last captured. Captures run concurrently under the read
+    // lock of the tablet meta, so it is guarded by its own lock. A new version following the
+    // path extends it, other changes of the graph on the path clear it.
+    mutable std::mutex _path_cache_lock;
+    mutable int64_t _cached_path_end = -1;
+    mutable std::vector<Version> _cached_path;
 };
 
 /// TimestampedVersion class which is implemented to maintain multi-version path of rowsets.
@@ -135,16 +135,19 @@ void DataQueue::push_block(std::unique_ptr<vectorized::Block> block, int child_i
         _max_bytes_in_queue = std::max(_max_bytes_in_queue, _cur_bytes_in_queue[0].load());
         _max_size_of_queue = std::max(_max_size_of_queue, (int64)_queue_blocks[0].size());
     }
+    _source_dependency.notify();
 }
 
 void DataQueue::set_finish(int child_idx) {
     _is_finished[child_idx] = true;
+    _source_dependency.notify();
 }
 
 void DataQueue::set_canceled(int child_idx) {
     DCHECK(!_is_finished[child_idx]);
     _is_canceled[child_idx] = true;
     _is_finished[child_idx] = true;
+    _source_dependency.notify();
 }
 
 bool DataQueue::is_finish(int child_idx) {
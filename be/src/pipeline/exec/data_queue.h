@@ -25,6 +25,7 @@
 #include <vector>
 
 #include "common/status.h"
+#include "pipeline/exec/dependency.h"
 #include "vec/core/block.h"
 
 namespace doris {
@@ -59,6 +60,9 @@ public:
 
     bool data_exhausted() const { return _data_exhausted; }
 
+    // notified when a block is pushed or a child is finished
+    Dependency* source_dependency() { return &_source_dependency; }
+
 private:
     std::vector<std::unique_ptr<std::mutex>> _queue_blocks_lock;
     std::vector<std::deque<std::unique_ptr<vectorized::Block>>> _queue_blocks;
@@ -83,6 +87,8 @@ private:
     int64_t _max_bytes_in_queue = 0;
     int64_t _max_size_of_queue = 0;
     static constexpr int64_t MAX_BYTE_OF_QUEUE = 1024l * 1024 * 1024 / 10;
+
+    Dependency _source_dependency;
 };
 } // namespace pipeline
 } // namespace doris
\ No newline at end of file
@@ -0,0 +1,64 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "dependency.h"
+
+#include <algorithm>
+
+#include "pipeline/pipeline_task.h"
+
+namespace doris {
+namespace pipeline {
+
+void Dependency::add_waiter(PipelineTask* task) {
+    std::lock_guard<std::mutex> l(_lock);
+    _waiters.push_back(task);
+    _has_waiters = true;
+}
+
+bool Dependency::remove_waiter(PipelineTask* task) {
+    std::lock_guard<std::mutex> l(_lock);
+    auto iter = std::find(_waiters.begin(), _waiters.end(), task);
+    if (iter == _waiters.end()) {
+        return false;
+    }
+    _waiters.erase(iter);
+    _has_waiters = !_waiters.empty();
+    return true;
+}
+
+void Dependency::notify() {
+    if (!_has_waiters) {
+        return;
+    }
+    std::vector<PipelineTask*> waiters;
+    {
+        std::lock_guard<std::mutex> l(_lock);
+        if (_waiters.empty()) {
+            return;
+        }
+        waiters.swap(_waiters);
+        _has_waiters = false;
+    }
+    // the tasks are owned by this thread now, and must not be touched by others until waked up
+    for (auto* task : waiters) {
+        task->wake_up();
+    }
+}
+
+} // namespace pipeline
+} // namespace doris
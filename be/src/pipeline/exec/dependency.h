@@ -0,0 +1,60 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <atomic>
+#include <mutex>
+#include <vector>
+
+namespace doris {
+namespace pipeline {
+
+class PipelineTask;
+
+// A Dependency is signalled by the producer when the operators waiting on it may make
+// progress, e.g. a block is pushed into the data queue, or the rpc queue of exchange sink
+// buffer is drained. The pipeline tasks blocked on it are pushed back to the task queue directly
+// when it is signalled, instead of being polled by BlockedTaskScheduler.
+//
+// The dependency does not record whether it is ready, the task always checks the real condition
+// after registered, so a spurious wakeup only makes the task blocked again.
+class Dependency {
+public:
+    Dependency() = default;
+    ~Dependency() = default;
+
+    Dependency(const Dependency&) = delete;
+    Dependency& operator=(const Dependency&) = delete;
+
+    void add_waiter(PipelineTask* task);
+
+    // Returns false if the task has been taken away by `notify`.
+    bool remove_waiter(PipelineTask* task);
+
+    // Wake up all the tasks waiting on this dependency.
+    void notify();
+
+private:
+    std::mutex _lock;
+    std::vector<PipelineTask*> _waiters;
+    // to skip the lock in `notify` if no task is waiting, which is the common case
+    std::atomic<bool> _has_waiters = false;
+};
+
+} // namespace pipeline
+} // namespace doris
@@ -71,8 +71,14 @@ void ExchangeSinkBuffer::close() {
 bool ExchangeSinkBuffer::can_write() const {
     size_t max_package_size = 64 * _instance_to_package_queue.size();
     size_t total_package_size = 0;
-    for (auto& [_, q] : _instance_to_package_queue) {
+    for (auto& [id, q] : _instance_to_package_queue) {
         total_package_size += q.size();
+        std::unique_lock<std::mutex> lock(*_instance_to_package_queue_mutex.at(id));
+        int64_t credit = _instance_to_credit_bytes.at(id);
+        if (credit >= 0 && _instance_to_queued_bytes.at(id) > credit) {
+            _credit_blocked_count++;
+            return false;
+        }
     }
     return total_package_size <= max_package_size;
 }
@@ -108,6 +114,15 @@ void ExchangeSinkBuffer::register_sink(TUniqueId fragment_instance_id) {
     _instance_to_sending_by_pipeline[low_id] = true;
     _instance_to_receiver_eof[low_id] = false;
     _instance_to_rpc_time[low_id] = 0;
+    _instance_to_credit_bytes[low_id] = -1;
+    _instance_to_queued_bytes[low_id] = 0;
+}
+
+void ExchangeSinkBuffer::register_broadcast_follower(TUniqueId leader_id, TUniqueId follower_id) {
+    PUniqueId finst_id;
+    finst_id.set_hi(follower_id.hi);
+    finst_id.set_lo(follower_id.lo);
+    _instance_to_broadcast_followers[leader_id.lo].push_back(finst_id);
 }
 
 Status ExchangeSinkBuffer::add_block(TransmitInfo&& request) {
@@ -123,7 +138,11 @@ Status ExchangeSinkBuffer::add_block(TransmitInfo&& request) {
             send_now = true;
             _instance_to_sending_by_pipeline[ins_id.lo] = false;
         }
+        if (request.block) {
+            _instance_to_queued_bytes[ins_id.lo] += request.block->column_values().size();
+        }
         _instance_to_package_queue[ins_id.lo].emplace(std::move(request));
+        _update_max_queue_depth(_instance_to_package_queue[ins_id.lo].size());
     }
     if (send_now) {
         RETURN_IF_ERROR(_send_rpc(ins_id.lo));
@@ -150,6 +169,7 @@ Status ExchangeSinkBuffer::add_block(BroadcastTransmitInfo&& request) {
             _instance_to_sending_by_pipeline[ins_id.lo] = false;
         }
         _instance_to_broadcast_package_queue[ins_id.lo].emplace(std::move(request));
+        _update_max_queue_depth(_instance_to_broadcast_package_queue[ins_id.lo].size());
     }
     if (send_now) {
         RETURN_IF_ERROR(_send_rpc(ins_id.lo));
@@ -179,8 +199,11 @@ Status ExchangeSinkBuffer::_send_rpc(InstanceLoId id) {
         auto brpc_request = _instance_to_request[id];
         brpc_request->set_eos(request.eos);
         brpc_request->set_packet_seq(_instance_to_seq[id]++);
+        int64_t block_bytes = 0;
         if (request.block) {
             brpc_request->set_allocated_block(request.block.get());
+            block_bytes = request.block->column_values().size();
+            _rpc_block_bytes += block_bytes;
         }
         auto* closure = request.channel->get_closure(id, request.eos, nullptr);
         closure->cntl.set_timeout_ms(request.channel->_brpc_timeout_ms);
@@ -191,6 +214,7 @@ Status ExchangeSinkBuffer::_send_rpc(InstanceLoId id) {
                                        const PTransmitDataResult& result,
                                        const int64_t& start_rpc_time) {
             set_rpc_time(id, start_rpc_time, result.receive_time());
+            _set_receiver_credit(id, result);
             Status s = Status(result.status());
             if (s.is<ErrorCode::END_OF_FILE>()) {
                 _set_receiver_eof(id);
@@ -205,11 +229,13 @@ Status ExchangeSinkBuffer::_send_rpc(InstanceLoId id) {
         });
         {
             SCOPED_SWITCH_THREAD_MEM_TRACKER_LIMITER(ExecEnv::GetInstance()->orphan_mem_tracker());
+            brpc_request->set_transfer_by_attachment(false);
             if (enable_http_send_block(*brpc_request)) {
                 RETURN_IF_ERROR(transmit_block_http(_context->get_runtime_state(), closure,
                                                     *brpc_request,
                                                     request.channel->_brpc_dest_addr));
             } else {
+                request_block_transfer_attachment_without_copy(brpc_request, closure);
                 transmit_block(*request.channel->_brpc_stub, closure, *brpc_request);
             }
         }
@@ -217,6 +243,8 @@ Status ExchangeSinkBuffer::_send_rpc(InstanceLoId id) {
             brpc_request->release_block();
         }
         q.pop();
+        _instance_to_queued_bytes[id] -= block_bytes;
+        _write_dependency.notify();
     } else if (!broadcast_q.empty()) {
         // If we have data to shuffle which is broadcasted
         auto& request = broadcast_q.front();
@@ -228,6 +256,7 @@ Status ExchangeSinkBuffer::_send_rpc(InstanceLoId id) {
         brpc_request->set_packet_seq(_instance_to_seq[id]++);
         if (request.block_holder->get_block()) {
             brpc_request->set_allocated_block(request.block_holder->get_block());
+            _rpc_block_bytes += request.block_holder->get_block()->column_values().size();
         }
         auto* closure = request.channel->get_closure(id, request.eos, request.block_holder);
         closure->cntl.set_timeout_ms(request.channel->_brpc_timeout_ms);
@@ -238,6 +267,7 @@ Status ExchangeSinkBuffer::_send_rpc(InstanceLoId id) {
                                        const PTransmitDataResult& result,
                                        const int64_t& start_rpc_time) {
             set_rpc_time(id, start_rpc_time, result.receive_time());
+            _set_receiver_credit(id, result);
             Status s = Status(result.status());
             if (s.is<ErrorCode::END_OF_FILE>()) {
                 _set_receiver_eof(id);
@@ -252,6 +282,7 @@ Status ExchangeSinkBuffer::_send_rpc(InstanceLoId id) {
         });
         {
             SCOPED_SWITCH_THREAD_MEM_TRACKER_LIMITER(ExecEnv::GetInstance()->orphan_mem_tracker());
+            brpc_request->set_transfer_by_attachment(false);
             if (enable_http_send_block(*brpc_request)) {
                 RETURN_IF_ERROR(transmit_block_http(_context->get_runtime_state(), closure,
                                                     *brpc_request,
@@ -280,6 +311,12 @@ void ExchangeSinkBuffer::_construct_request(InstanceLoId id) {
     _instance_to_request[id]->set_node_id(_dest_node_id);
     _instance_to_request[id]->set_sender_id(_sender_id);
     _instance_to_request[id]->set_be_number(_be_number);
+    auto iter = _instance_to_broadcast_followers.find(id);
+    if (iter != _instance_to_broadcast_followers.end()) {
+        for (const auto& finst_id : iter->second) {
+            *_instance_to_request[id]->add_broadcast_finst_ids() = finst_id;
+        }
+    }
 }
 
 void ExchangeSinkBuffer::_ended(InstanceLoId id) {
@@ -299,6 +336,27 @@ void ExchangeSinkBuffer::_set_receiver_eof(InstanceLoId id) {
     _instance_to_sending_by_pipeline[id] = true;
 }
 
+void ExchangeSinkBuffer::_set_receiver_credit(InstanceLoId id, const PTransmitDataResult& result) {
+    int64_t credit = result.has_receiver_free_bytes() ? result.receiver_free_bytes() : -1;
+    {
+        std::unique_lock<std::mutex> lock(*_instance_to_package_queue_mutex[id]);
+        _instance_to_credit_bytes[id] = credit;
+    }
+    if (credit < 0) {
+        return;
+    }
+    int64_t min_credit = _min_credit_bytes.load();
+    while ((min_credit < 0 || credit < min_credit) &&
+           !_min_credit_bytes.compare_exchange_weak(min_credit, credit)) {
+    }
+}
+
+void ExchangeSinkBuffer::_update_max_queue_depth(int64_t depth) {
+    int64_t max_depth = _max_queue_depth.load();
+    while (depth > max_depth && !_max_queue_depth.compare_exchange_weak(max_depth, depth)) {
+    }
+}
+
 bool ExchangeSinkBuffer::_is_receiver_eof(InstanceLoId id) {
     std::unique_lock<std::mutex> lock(*_instance_to_package_queue_mutex[id]);
     return _instance_to_receiver_eof[id];
@@ -332,9 +390,18 @@ void ExchangeSinkBuffer::set_rpc_time(InstanceLoId id, int64_t start_rpc_time,
     DCHECK(_instance_to_rpc_time.find(id) != _instance_to_rpc_time.end());
     if (rpc_spend_time > 0) {
         _instance_to_rpc_time[id] += rpc_spend_time;
+        _rpc_block_time_ns += rpc_spend_time;
     }
 }
 
+double ExchangeSinkBuffer::get_rpc_bytes_per_second() const {
+    int64_t time_ns = _rpc_block_time_ns.load();
+    if (time_ns <= 0) {
+        return 0;
+    }
+    return _rpc_block_bytes.load() * 1e9 / time_ns;
+}
+
 void ExchangeSinkBuffer::update_profile(RuntimeProfile* profile) {
     auto* _max_rpc_timer = ADD_TIMER(profile, "RpcMaxTime");
     auto* _min_rpc_timer = ADD_TIMER(profile, "RpcMinTime");
@@ -351,5 +418,12 @@ void ExchangeSinkBuffer::update_profile(RuntimeProfile* profile) {
     int64_t sum_time = get_sum_rpc_time();
     _sum_rpc_timer->set(sum_time);
     _avg_rpc_timer->set(sum_time / std::max(static_cast<int64_t>(1), _rpc_count.load()));
+
+    auto* max_queue_depth = ADD_COUNTER(profile, "MaxQueueDepth", TUnit::UNIT);
+    auto* min_credit = ADD_COUNTER(profile, "MinReceiverCredit", TUnit::BYTES);
+    auto* credit_blocked_count = ADD_COUNTER(profile, "CreditBlockedCount", TUnit::UNIT);
+    max_queue_depth->set(_max_queue_depth.load());
+    min_credit->set(std::max(static_cast<int64_t>(0), _min_credit_bytes.load()));
+    credit_blocked_count->set(_credit_blocked_count.load());
 }
 } // namespace doris::pipeline
@@ -32,6 +32,7 @@
 
 #include "common/global_types.h"
 #include "common/status.h"
+#include "pipeline/exec/dependency.h"
 #include "runtime/runtime_state.h"
 #include "service/backend_options.h"
 
@@ -159,14 +160,21 @@ public:
     ExchangeSinkBuffer(PUniqueId, int, PlanNodeId, int, PipelineFragmentContext*);
     ~ExchangeSinkBuffer();
     void register_sink(TUniqueId);
+    // The blocks sent to the leader instance are delivered to the follower on the same BE too.
+    void register_broadcast_follower(TUniqueId leader_id, TUniqueId follower_id);
     Status add_block(TransmitInfo&& request);
     Status add_block(BroadcastTransmitInfo&& request);
     bool can_write() const;
+    // notified when a package is sent out of the queue
+    Dependency* write_dependency() { return &_write_dependency; }
     bool is_pending_finish() const;
     void close();
     void set_rpc_time(InstanceLoId id, int64_t start_rpc_time, int64_t receive_rpc_time);
     void update_profile(RuntimeProfile* profile);
 
+    // Bytes transferred per second of one rpc, 0 if not measured yet
+    double get_rpc_bytes_per_second() const;
+
 private:
     phmap::flat_hash_map<InstanceLoId, std::unique_ptr<std::mutex>>
             _instance_to_package_queue_mutex;
@@ -182,9 +190,18 @@ private:
     phmap::flat_hash_map<InstanceLoId, PackageSeq> _instance_to_seq;
     phmap::flat_hash_map<InstanceLoId, PTransmitDataParams*> _instance_to_request;
     phmap::flat_hash_map<InstanceLoId, PUniqueId> _instance_to_finst_id;
+    phmap::flat_hash_map<InstanceLoId, std::vector<PUniqueId>> _instance_to_broadcast_followers;
     phmap::flat_hash_map<InstanceLoId, bool> _instance_to_sending_by_pipeline;
     phmap::flat_hash_map<InstanceLoId, bool> _instance_to_receiver_eof;
     phmap::flat_hash_map<InstanceLoId, int64_t> _instance_to_rpc_time;
+    // Credit based flow control: the receiver advertises the bytes it can still buffer in the
+    // response, and no more blocks are queued for it once the queued bytes exceed the credit.
+    // -1 means the credit is unknown, e.g. before the first response.
+    phmap::flat_hash_map<InstanceLoId, int64_t> _instance_to_credit_bytes;
+    phmap::flat_hash_map<InstanceLoId, int64_t> _instance_to_queued_bytes;
+    mutable std::atomic<int64_t> _credit_blocked_count = 0;
+    std::atomic<int64_t> _min_credit_bytes = -1;
+    std::atomic<int64_t> _max_queue_depth = 0;
 
     std::atomic<bool> _is_finishing;
     PUniqueId _query_id;
@@ -193,7 +210,11 @@ private:
     int _sender_id;
     int _be_number;
     std::atomic<int64_t> _rpc_count = 0;
+    // bytes of the blocks sent and time of the rpcs finished, to estimate the network speed
+    std::atomic<int64_t> _rpc_block_bytes = 0;
+    std::atomic<int64_t> _rpc_block_time_ns = 0;
     PipelineFragmentContext* _context;
+    Dependency _write_dependency;
 
     Status _send_rpc(InstanceLoId);
     // must hold the _instance_to_package_queue_mutex[id] mutex to opera
@@ -202,6 +223,8 @@ private:
     inline void _failed(InstanceLoId id, const std::string& err);
     inline void _set_receiver_eof(InstanceLoId id);
     inline bool _is_receiver_eof(InstanceLoId id);
+    void _set_receiver_credit(InstanceLoId id, const PTransmitDataResult& result);
+    void _update_max_queue_depth(int64_t depth);
     void get_max_min_rpc_time(int64_t* max_time, int64_t* min_time);
     int64_t get_sum_rpc_time();
 };
@@ -76,6 +76,11 @@ bool ExchangeSinkOperator::can_write() {
     return _sink_buffer->can_write() && _sink->channel_all_can_write();
 }
 
+Dependency* ExchangeSinkOperator::sink_dependency() {
+    // The local channels do not notify, only wait on the buffer if it is the one blocking.
+    return _sink->channel_all_can_write() ? _sink_buffer->write_dependency() : nullptr;
+}
+
 bool ExchangeSinkOperator::is_pending_finish() const {
     return _sink_buffer->is_pending_finish();
 }
@@ -56,6 +56,7 @@ public:
 
     Status prepare(RuntimeState* state) override;
     bool can_write() override;
+    Dependency* sink_dependency() override;
     bool is_pending_finish() const override;
 
     Status close(RuntimeState* state) override;
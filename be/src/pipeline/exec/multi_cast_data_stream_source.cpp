@@ -55,7 +55,7 @@ bool MultiCastDataStreamerSourceOperator::can_read() {
 Status MultiCastDataStreamerSourceOperator::get_block(RuntimeState* state, vectorized::Block* block,
                                                       SourceState& source_state) {
     bool eos = false;
-    _multi_cast_data_streamer->pull(_consumer_id, block, &eos);
+    RETURN_IF_ERROR(_multi_cast_data_streamer->pull(_consumer_id, block, &eos));
     if (eos) {
         source_state = SourceState::FINISHED;
     }
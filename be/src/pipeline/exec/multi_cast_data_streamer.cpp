@@ -17,52 +17,105 @@
 
 #include "multi_cast_data_streamer.h"
 
+#include <limits>
+
+#include "runtime/block_spill_manager.h"
+#include "runtime/exec_env.h"
 #include "runtime/runtime_state.h"
 
 namespace doris::pipeline {
 
-MultiCastBlock::MultiCastBlock(vectorized::Block* block, int used_count, size_t mem_size)
-        : _used_count(used_count), _mem_size(mem_size) {
+MultiCastBlock::MultiCastBlock(vectorized::Block* block, int used_count, size_t mem_size,
+                               int64_t spill_stream_id)
+        : _used_count(used_count), _mem_size(mem_size), _spill_stream_id(spill_stream_id) {
     _block = vectorized::Block::create_unique(block->get_columns_with_type_and_name());
     block->clear();
 }
 
-void MultiCastDataStreamer::pull(int sender_idx, doris::vectorized::Block* block, bool* eos) {
-    std::lock_guard l(_mutex);
-    auto& pos_to_pull = _sender_pos_to_read[sender_idx];
-    if (pos_to_pull != _multi_cast_blocks.end()) {
-        if (pos_to_pull->_used_count == 1) {
-            DCHECK(pos_to_pull == _multi_cast_blocks.begin());
-            pos_to_pull->_block->swap(*block);
-
-            _cumulative_mem_size -= pos_to_pull->_mem_size;
-            pos_to_pull++;
-            _multi_cast_blocks.pop_front();
-        } else {
-            pos_to_pull->_used_count--;
-            pos_to_pull->_block->create_same_struct_block(0)->swap(*block);
-            (void)vectorized::MutableBlock(block).merge(*pos_to_pull->_block);
-            pos_to_pull++;
+MultiCastDataStreamer::~MultiCastDataStreamer() {
+    // delete the spilled blocks which are not read back, e.g. the query is cancelled
+    std::vector<int64_t> stream_ids;
+    for (const auto& multi_cast_block : _multi_cast_blocks) {
+        if (multi_cast_block._spill_stream_id != -1) {
+            stream_ids.push_back(multi_cast_block._spill_stream_id);
+        }
+    }
+    _remove_spill_streams(stream_ids);
+}
+
+void MultiCastDataStreamer::_remove_spill_streams(const std::vector<int64_t>& stream_ids) {
+    for (auto stream_id : stream_ids) {
+        ExecEnv::GetInstance()->block_spill_mgr()->delete_stream(stream_id);
+    }
+}
+
+Status MultiCastDataStreamer::pull(int sender_idx, doris::vectorized::Block* block, bool* eos) {
+    vectorized::BlockSpillReaderUPtr spill_reader;
+    {
+        std::lock_guard l(_mutex);
+        auto& pos_to_pull = _sender_pos_to_read[sender_idx];
+        if (pos_to_pull != _multi_cast_blocks.end()) {
+            if (pos_to_pull->_spill_stream_id != -1) {
+                // The reader is opened under the lock, so the last consumer deleting the stream
+                // doesn't remove the file before the others open it.
+                RETURN_IF_ERROR(ExecEnv::GetInstance()->block_spill_mgr()->get_reader(
+                        pos_to_pull->_spill_stream_id, spill_reader, _spill_profile,
+                        pos_to_pull->_used_count == 1));
+                if (pos_to_pull->_used_count == 1) {
+                    DCHECK(pos_to_pull == _multi_cast_blocks.begin());
+                    pos_to_pull++;
+                    _multi_cast_blocks.pop_front();
+                } else {
+                    pos_to_pull->_used_count--;
+                    pos_to_pull++;
+                }
+            } else if (pos_to_pull->_used_count == 1) {
+                DCHECK(pos_to_pull == _multi_cast_blocks.begin());
+                pos_to_pull->_block->swap(*block);
+
+                _cumulative_mem_size -= pos_to_pull->_mem_size;
+                pos_to_pull++;
+                _multi_cast_blocks.pop_front();
+            } else {
+                pos_to_pull->_used_count--;
+                pos_to_pull->_block->create_same_struct_block(0)->swap(*block);
+                (void)vectorized::MutableBlock(block).merge(*pos_to_pull->_block);
+                pos_to_pull++;
+            }
         }
+        *eos = _eos and pos_to_pull == _multi_cast_blocks.end();
     }
-    *eos = _eos and pos_to_pull == _multi_cast_blocks.end();
+
+    if (spill_reader != nullptr) {
+        bool spill_eos = false;
+        RETURN_IF_ERROR(spill_reader->read(block, &spill_eos));
+        RETURN_IF_ERROR(spill_reader->close());
+    }
+    return Status::OK();
 }
 
 void MultiCastDataStreamer::close_sender(int sender_idx) {
-    std::lock_guard l(_mutex);
-    auto& pos_to_pull = _sender_pos_to_read[sender_idx];
-    while (pos_to_pull != _multi_cast_blocks.end()) {
-        if (pos_to_pull->_used_count == 1) {
-            DCHECK(pos_to_pull == _multi_cast_blocks.begin());
-            _cumulative_mem_size -= pos_to_pull->_mem_size;
-            pos_to_pull++;
-            _multi_cast_blocks.pop_front();
-        } else {
-            pos_to_pull->_used_count--;
-            pos_to_pull++;
+    std::vector<int64_t> stream_ids;
+    {
+        std::lock_guard l(_mutex);
+        auto& pos_to_pull = _sender_pos_to_read[sender_idx];
+        while (pos_to_pull != _multi_cast_blocks.end()) {
+            if (pos_to_pull->_used_count == 1) {
+                DCHECK(pos_to_pull == _multi_cast_blocks.begin());
+                if (pos_to_pull->_spill_stream_id != -1) {
+                    stream_ids.push_back(pos_to_pull->_spill_stream_id);
+                }
+                _cumulative_mem_size -= pos_to_pull->_mem_size;
+                pos_to_pull++;
+                _multi_cast_blocks.pop_front();
+            } else {
+                pos_to_pull->_used_count--;
+                pos_to_pull++;
+            }
         }
+        _closed_sender_count++;
     }
-    _closed_sender_count++;
+    _remove_spill_streams(stream_ids);
 }
 
 Status MultiCastDataStreamer::push(RuntimeState* state, doris::vectorized::Block* block, bool eos) {
@@ -70,15 +123,43 @@ Status MultiCastDataStreamer::push(RuntimeState* state, doris::vectorized::Block
     COUNTER_UPDATE(_process_rows, rows);
 
     auto block_mem_size = block->allocated_bytes();
+    int64_t spill_threshold = state->external_multi_cast_bytes_threshold();
+    bool need_spill = false;
+    if (spill_threshold > 0 && rows > 0) {
+        std::lock_guard l(_mutex);
+        need_spill = _cumulative_mem_size + block_mem_size > spill_threshold;
+        if (need_spill && _spill_profile == nullptr) {
+            _spill_profile = _profile->create_child("BlockSpill", true, true);
+            _spilled_block_count = ADD_COUNTER(_spill_profile, "SpilledBlockCount", TUnit::UNIT);
+        }
+    }
+
+    // The block is written out of the lock, the consumers keep reading the blocks before it.
+    int64_t spill_stream_id = -1;
+    if (need_spill) {
+        vectorized::BlockSpillWriterUPtr writer;
+        RETURN_IF_ERROR(ExecEnv::GetInstance()->block_spill_mgr()->get_writer(
+                std::numeric_limits<int32_t>::max(), writer, _spill_profile));
+        RETURN_IF_ERROR(writer->write(*block));
+        RETURN_IF_ERROR(writer->close());
+        spill_stream_id = writer->get_id();
+        COUNTER_UPDATE(_spilled_block_count, 1);
+        block->clear_column_data();
+        block_mem_size = 0;
+    }
+
     std::lock_guard l(_mutex);
     int need_process_count = _cast_sender_count - _closed_sender_count;
     if (need_process_count == 0) {
+        if (spill_stream_id != -1) {
+            _remove_spill_streams({spill_stream_id});
+        }
         return Status::EndOfFile("All data streamer is EOF");
     }
     // TODO: if the [queue back block rows + block->rows()] < batch_size, better
     // do merge block. but need check the need_process_count and used_count whether
     // equal
-    _multi_cast_blocks.emplace_back(block, need_process_count, block_mem_size);
+    _multi_cast_blocks.emplace_back(block, need_process_count, block_mem_size, spill_stream_id);
     _cumulative_mem_size += block_mem_size;
     COUNTER_SET(_peak_mem_usage, std::max(_cumulative_mem_size, _peak_mem_usage->value()));
 
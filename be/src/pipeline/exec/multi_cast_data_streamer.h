@@ -22,11 +22,15 @@
 namespace doris::pipeline {
 
 struct MultiCastBlock {
-    MultiCastBlock(vectorized::Block* block, int used_count, size_t mem_size);
+    MultiCastBlock(vectorized::Block* block, int used_count, size_t mem_size,
+                   int64_t spill_stream_id = -1);
 
     std::unique_ptr<vectorized::Block> _block;
     int _used_count;
     size_t _mem_size;
+    // The spill stream of the block if it is spilled to disk, -1 otherwise. The stream is
+    // deleted by the last consumer reading it.
+    int64_t _spill_stream_id;
 };
 
 // TDOD: MultiCastDataStreamer same as the data queue, maybe rethink union and refactor the
@@ -42,15 +46,17 @@ public:
         _process_rows = ADD_COUNTER(profile(), "ProcessRows", TUnit::UNIT);
     };
 
-    ~MultiCastDataStreamer() = default;
+    ~MultiCastDataStreamer();
 
-    void pull(int sender_idx, vectorized::Block* block, bool* eos);
+    Status pull(int sender_idx, vectorized::Block* block, bool* eos);
 
     void close_sender(int sender_idx);
 
     Status push(RuntimeState* state, vectorized::Block* block, bool eos);
 
-    // use sink to check can_write, now always true after we support spill to disk
+    // use sink to check can_write, now always true after we support spill to disk.
+    // The blocks pushed beyond the external_multi_cast_bytes_threshold are spilled, each to a
+    // spill stream, and read back by every consumer independently.
     bool can_write() { return true; }
 
     bool can_read(int sender_idx) {
@@ -68,6 +74,8 @@ public:
     }
 
 private:
+    static void _remove_spill_streams(const std::vector<int64_t>& stream_ids);
+
     const RowDescriptor& _row_desc;
     RuntimeProfile* _profile;
     std::list<MultiCastBlock> _multi_cast_blocks;
@@ -80,5 +88,9 @@ private:
 
     RuntimeProfile::Counter* _process_rows;
     RuntimeProfile::Counter* _peak_mem_usage;
+
+    // created by the first spill
+    RuntimeProfile* _spill_profile = nullptr;
+    RuntimeProfile::Counter* _spilled_block_count = nullptr;
 };
 } // namespace doris::pipeline
\ No newline at end of file
@@ -86,6 +86,7 @@ enum class SinkState : uint8_t {
 
 class OperatorBuilderBase;
 class OperatorBase;
+class Dependency;
 
 using OperatorPtr = std::shared_ptr<OperatorBase>;
 using Operators = std::vector<OperatorPtr>;
@@ -199,6 +200,13 @@ public:
 
     virtual bool can_write() { return false; } // for sink
 
+    // The dependency notified when the source may be readable again, nullptr means the blocked
+    // task is polled by BlockedTaskScheduler.
+    virtual Dependency* source_dependency() { return nullptr; }
+
+    // The dependency notified when the sink may be writable again.
+    virtual Dependency* sink_dependency() { return nullptr; }
+
     /**
      * The main method to execute a pipeline task.
      * Now it is a pull-based pipeline and operators pull data from its child by this method.
@@ -324,6 +332,7 @@ public:
 
     Status sink(RuntimeState* state, vectorized::Block* in_block,
                 SourceState source_state) override {
+        SCOPED_HW_PERF_COUNTERS(_node->hw_perf_counters());
         return _node->sink(state, in_block, source_state == SourceState::FINISHED);
     }
 
@@ -22,6 +22,9 @@
 #include <memory>
 
 #include "pipeline/exec/operator.h"
+#include "runtime/exec_env.h"
+#include "runtime/runtime_state.h"
+#include "vec/exec/scan/scanner_scheduler.h"
 #include "vec/exec/scan/scanner_context.h"
 #include "vec/exec/scan/vscan_node.h"
 
@@ -42,6 +45,9 @@ bool ScanOperator::can_read() {
             // _scanner_ctx->done(): need finish
             // _scanner_ctx->no_schedule(): should schedule _scanner_ctx
             return true;
+        } else if (_node->_scanner_ctx->scan_in_pipeline_task()) {
+            // the task runs a scanner itself in get_block() if there is no block
+            return _node->ready_to_read() || _node->_scanner_ctx->has_idle_scanner();
         } else {
             if (_node->_scanner_ctx->get_num_running_scanners() == 0 &&
                 _node->_scanner_ctx->has_enough_space_in_blocks_queue()) {
@@ -52,6 +58,29 @@ bool ScanOperator::can_read() {
     }
 }
 
+Status ScanOperator::get_block(RuntimeState* state, vectorized::Block* block,
+                               SourceState& source_state) {
+    auto* ctx = _node->_scanner_ctx.get();
+    if (!_node->_eos && ctx != nullptr && ctx->scan_in_pipeline_task() &&
+        !_node->ready_to_read() && !ctx->done()) {
+        state->exec_env()->scanner_scheduler()->scan_in_pipeline_task(ctx);
+        if (!_node->ready_to_read() && !ctx->done()) {
+            // nothing read in this time slice, or all the scanners are run by other tasks
+            source_state = SourceState::DEPEND_ON_SOURCE;
+            return Status::OK();
+        }
+    }
+    return SourceOperator::get_block(state, block, source_state);
+}
+
+Dependency* ScanOperator::source_dependency() {
+    // the task waiting for the scanner context to be created is polled
+    if (!_node->_opened || _node->_scanner_ctx == nullptr) {
+        return nullptr;
+    }
+    return _node->_scanner_ctx->source_dependency(_node->_context_queue_id);
+}
+
 bool ScanOperator::is_pending_finish() const {
     return _node->_scanner_ctx && !_node->_scanner_ctx->no_schedule();
 }
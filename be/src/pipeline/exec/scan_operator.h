@@ -44,6 +44,11 @@ public:
 
     bool can_read() override; // for source
 
+    Status get_block(RuntimeState* state, vectorized::Block* block,
+                     SourceState& source_state) override;
+
+    Dependency* source_dependency() override;
+
     bool is_pending_finish() const override;
 
     bool runtime_filters_are_ready_or_timeout() override;
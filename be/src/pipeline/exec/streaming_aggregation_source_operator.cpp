@@ -39,6 +39,10 @@ bool StreamingAggSourceOperator::can_read() {
     return _data_queue->has_data_or_finished();
 }
 
+Dependency* StreamingAggSourceOperator::source_dependency() {
+    return _data_queue->source_dependency();
+}
+
 Status StreamingAggSourceOperator::get_block(RuntimeState* state, vectorized::Block* block,
                                              SourceState& source_state) {
     bool eos = false;
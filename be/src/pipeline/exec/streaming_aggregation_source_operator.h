@@ -51,6 +51,7 @@ class StreamingAggSourceOperator final : public SourceOperator<StreamingAggSourc
 public:
     StreamingAggSourceOperator(OperatorBuilderBase*, ExecNode*, std::shared_ptr<DataQueue>);
     bool can_read() override;
+    Dependency* source_dependency() override;
     Status get_block(RuntimeState*, vectorized::Block*, SourceState& source_state) override;
     Status open(RuntimeState*) override { return Status::OK(); }
 
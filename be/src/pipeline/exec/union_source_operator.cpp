@@ -52,6 +52,10 @@ bool UnionSourceOperator::can_read() {
     return _need_read_for_const_expr || _data_queue->remaining_has_data();
 }
 
+Dependency* UnionSourceOperator::source_dependency() {
+    return _data_queue->source_dependency();
+}
+
 Status UnionSourceOperator::pull_data(RuntimeState* state, vectorized::Block* block, bool* eos) {
     // here we precess const expr firstly
     if (_need_read_for_const_expr) {
@@ -55,6 +55,7 @@ public:
     Status get_block(RuntimeState* state, vectorized::Block* block,
                      SourceState& source_state) override;
     bool can_read() override;
+    Dependency* source_dependency() override;
 
     Status pull_data(RuntimeState* state, vectorized::Block* output_block, bool* eos);
 
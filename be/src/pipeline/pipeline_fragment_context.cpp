@@ -169,6 +169,9 @@ void PipelineFragmentContext::cancel(const PPlanFragmentCancelReason& reason,
         _cancel_msg = msg;
         // To notify wait_for_start()
         _query_ctx->set_ready_to_execute(true);
+        if (reason == PPlanFragmentCancelReason::MEMORY_LIMIT_EXCEED) {
+            _query_ctx->query_mem_tracker->dump_alloc_profile(_exec_env->bfd_parser());
+        }
 
         // must close stream_mgr to avoid dead lock in Exchange Node
         _exec_env->vstream_mgr()->cancel(_fragment_instance_id);
@@ -24,6 +24,7 @@
 
 #include <ostream>
 
+#include "common/config.h"
 #include "pipeline/exec/operator.h"
 #include "pipeline/pipeline.h"
 #include "pipeline_fragment_context.h"
@@ -31,6 +32,7 @@
 #include "runtime/query_context.h"
 #include "runtime/thread_context.h"
 #include "task_queue.h"
+#include "task_scheduler.h"
 #include "util/defer_op.h"
 
 namespace doris {
@@ -48,6 +50,10 @@ void PipelineTask::_fresh_profile_counter() {
     COUNTER_SET(_wait_sink_timer, (int64_t)_wait_sink_watcher.elapsed_time());
     COUNTER_SET(_wait_worker_timer, (int64_t)_wait_worker_watcher.elapsed_time());
     COUNTER_SET(_wait_schedule_timer, (int64_t)_wait_schedule_watcher.elapsed_time());
+    if (_column_pool) {
+        COUNTER_SET(_column_pool_hit_counts, _column_pool->hit_count());
+        COUNTER_SET(_column_pool_miss_counts, _column_pool->miss_count());
+    }
 }
 
 void PipelineTask::_init_profile() {
@@ -78,6 +84,10 @@ void PipelineTask::_init_profile() {
     _schedule_counts = ADD_COUNTER(_task_profile, "NumScheduleTimes", TUnit::UNIT);
     _yield_counts = ADD_COUNTER(_task_profile, "NumYieldTimes", TUnit::UNIT);
     _core_change_times = ADD_COUNTER(_task_profile, "CoreChangeTimes", TUnit::UNIT);
+    _numa_local_steal_counts = ADD_COUNTER(_task_profile, "NumaLocalStealTimes", TUnit::UNIT);
+    _numa_remote_steal_counts = ADD_COUNTER(_task_profile, "NumaRemoteStealTimes", TUnit::UNIT);
+    _column_pool_hit_counts = ADD_COUNTER(_task_profile, "ColumnPoolHitCount", TUnit::UNIT);
+    _column_pool_miss_counts = ADD_COUNTER(_task_profile, "ColumnPoolMissCount", TUnit::UNIT);
 }
 
 Status PipelineTask::prepare(RuntimeState* state) {
@@ -107,6 +117,10 @@ Status PipelineTask::prepare(RuntimeState* state) {
     _task_profile->add_info_string("OperatorIds(source2root)", fmt::to_string(operator_ids_str));
 
     _block = doris::vectorized::Block::create_unique();
+    if (config::pipeline_task_column_pool_bytes > 0) {
+        _column_pool = std::make_unique<vectorized::ColumnPool>(
+                config::pipeline_task_column_pool_bytes);
+    }
 
     // We should make sure initial state for task are runnable so that we can do some preparation jobs (e.g. initialize runtime filters).
     set_state(PipelineTaskState::RUNNABLE);
@@ -153,11 +167,30 @@ void PipelineTask::set_task_queue(TaskQueue* task_queue) {
     _task_queue = task_queue;
 }
 
+Dependency* PipelineTask::blocked_dependency() {
+    if (!config::enable_pipeline_task_dependency) {
+        return nullptr;
+    }
+    if (_cur_state == PipelineTaskState::BLOCKED_FOR_SOURCE) {
+        return _source->source_dependency();
+    } else if (_cur_state == PipelineTaskState::BLOCKED_FOR_SINK) {
+        return _sink->sink_dependency();
+    }
+    return nullptr;
+}
+
+void PipelineTask::wake_up() {
+    DCHECK(_blocked_task_scheduler != nullptr);
+    _blocked_task_scheduler->wake_up(this);
+}
+
 Status PipelineTask::execute(bool* eos) {
     SCOPED_TIMER(_task_profile->total_time_counter());
     SCOPED_CPU_TIMER(_task_cpu_timer);
     SCOPED_TIMER(_exec_timer);
     SCOPED_ATTACH_TASK(_state);
+    // the operators of the task recycle the columns of their blocks through the pool
+    vectorized::ColumnPool::ScopedAttach attach_column_pool(_column_pool.get());
     int64_t time_spent = 0;
     Defer defer {[&]() {
         if (_task_queue) {
@@ -271,6 +304,9 @@ Status PipelineTask::close() {
         COUNTER_SET(_close_timer, close_ns);
         COUNTER_UPDATE(_task_profile->total_time_counter(), close_ns);
     }
+    if (_column_pool) {
+        _column_pool->clear();
+    }
     return s;
 }
 
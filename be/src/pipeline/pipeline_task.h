@@ -29,6 +29,7 @@
 #include "util/runtime_profile.h"
 #include "util/stopwatch.hpp"
 #include "vec/core/block.h"
+#include "vec/core/column_pool.h"
 
 namespace doris {
 class QueryContext;
@@ -106,6 +107,8 @@ inline const char* get_state_name(PipelineTaskState idx) {
 }
 
 class TaskQueue;
+class BlockedTaskScheduler;
+class Dependency;
 
 // The class do the pipeline task. Minest schdule union by task scheduler
 class PipelineTask {
@@ -143,7 +146,12 @@ public:
         _schedule_time++;
         _wait_worker_watcher.start();
     }
-    void pop_out_runnable_queue() { _wait_worker_watcher.stop(); }
+    void pop_out_runnable_queue() {
+        _last_wait_worker_time_ns = _wait_worker_watcher.elapsed_time();
+        _wait_worker_watcher.stop();
+    }
+    // the time waiting in the runnable queue before the last schedule
+    uint64_t last_wait_worker_time_ns() const { return _last_wait_worker_time_ns; }
     void start_schedule_watcher() { _wait_schedule_watcher.start(); }
     void stop_schedule_watcher() { _wait_schedule_watcher.stop(); }
     PipelineTaskState get_state() { return _cur_state; }
@@ -192,6 +200,26 @@ public:
 
     void set_task_queue(TaskQueue* task_queue);
 
+    // The dependency to wait on in the current blocked state, nullptr if the task should be
+    // polled by BlockedTaskScheduler.
+    Dependency* blocked_dependency();
+
+    // Whether the task could run again in the current BLOCKED_FOR_SOURCE/SINK state.
+    bool blocked_condition_ready() {
+        return _cur_state == PipelineTaskState::BLOCKED_FOR_SOURCE ? source_can_read()
+                                                                   : sink_can_write();
+    }
+
+    void set_waiting_dependency(Dependency* dependency, BlockedTaskScheduler* scheduler) {
+        _waiting_dependency = dependency;
+        _blocked_task_scheduler = scheduler;
+    }
+
+    Dependency* waiting_dependency() const { return _waiting_dependency; }
+
+    // Called when the waiting dependency is notified.
+    void wake_up();
+
     static constexpr auto THREAD_TIME_SLICE = 100'000'000L;
 
     // 1 used for update priority queue
@@ -208,6 +236,15 @@ public:
     void set_core_id(int core_id) { this->_core_id = core_id; }
     int get_core_id() const { return this->_core_id; }
 
+    PipelineId pipeline_id() const { return _pipeline->_pipeline_id; }
+
+    uint32_t index() const { return _index; }
+
+    // 1.4 stolen by an executor of the same or another NUMA node
+    void inc_steal_counts(bool cross_numa_node) {
+        COUNTER_UPDATE(cross_numa_node ? _numa_remote_steal_counts : _numa_local_steal_counts, 1);
+    }
+
 private:
     void _finish_p_dependency() {
         for (const auto& p : _pipeline->_parents) {
@@ -236,8 +273,12 @@ private:
     PipelineTaskState _cur_state;
     SourceState _data_state;
     std::unique_ptr<doris::vectorized::Block> _block;
+    // recycles the columns of the blocks built by the operators in execute()
+    std::unique_ptr<vectorized::ColumnPool> _column_pool;
     PipelineFragmentContext* _fragment_context;
     TaskQueue* _task_queue = nullptr;
+    Dependency* _waiting_dependency = nullptr;
+    BlockedTaskScheduler* _blocked_task_scheduler = nullptr;
 
     // used for priority queue
     // it may be visited by different thread but there is no race condition
@@ -269,11 +310,16 @@ private:
     MonotonicStopWatch _wait_sink_watcher;
     RuntimeProfile::Counter* _wait_sink_timer;
     MonotonicStopWatch _wait_worker_watcher;
+    uint64_t _last_wait_worker_time_ns = 0;
     RuntimeProfile::Counter* _wait_worker_timer;
     // TODO we should calculate the time between when really runnable and runnable
     MonotonicStopWatch _wait_schedule_watcher;
     RuntimeProfile::Counter* _wait_schedule_timer;
     RuntimeProfile::Counter* _yield_counts;
     RuntimeProfile::Counter* _core_change_times;
+    RuntimeProfile::Counter* _numa_local_steal_counts;
+    RuntimeProfile::Counter* _numa_remote_steal_counts;
+    RuntimeProfile::Counter* _column_pool_hit_counts;
+    RuntimeProfile::Counter* _column_pool_miss_counts;
 };
 } // namespace doris::pipeline
\ No newline at end of file
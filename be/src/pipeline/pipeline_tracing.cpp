@@ -0,0 +1,129 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "pipeline/pipeline_tracing.h"
+
+#include <fmt/format.h>
+
+#include <algorithm>
+#include <map>
+
+#include "common/config.h"
+#include "util/easy_json.h"
+#include "util/uid_util.h"
+
+namespace doris::pipeline {
+
+PipelineTracer* PipelineTracer::instance() {
+    static PipelineTracer tracer;
+    return &tracer;
+}
+
+PipelineTracer::Buffer* PipelineTracer::_local_buffer() {
+    static thread_local Buffer* buffer = nullptr;
+    if (buffer == nullptr) {
+        auto new_buffer = std::make_unique<Buffer>();
+        new_buffer->events.resize(std::max(config::pipeline_task_tracing_buffer_size, 1));
+        std::lock_guard l(_lock);
+        buffer = new_buffer.get();
+        _buffers.push_back(std::move(new_buffer));
+    }
+    return buffer;
+}
+
+void PipelineTracer::record(const TaskRunEvent& event) {
+    auto* buffer = _local_buffer();
+    std::lock_guard l(buffer->lock);
+    buffer->events[buffer->next % buffer->events.size()] = event;
+    ++buffer->next;
+}
+
+std::string PipelineTracer::dump_chrome_trace(const TUniqueId& query_id) {
+    std::vector<TaskRunEvent> runs;
+    {
+        std::lock_guard l(_lock);
+        for (auto& buffer : _buffers) {
+            std::lock_guard buffer_lock(buffer->lock);
+            size_t num_events = std::min(buffer->next, buffer->events.size());
+            for (size_t i = 0; i < num_events; ++i) {
+                const auto& event = buffer->events[i];
+                if (event.query_id == query_id) {
+                    runs.push_back(event);
+                }
+            }
+        }
+    }
+    std::sort(runs.begin(), runs.end(), [](const TaskRunEvent& lhs, const TaskRunEvent& rhs) {
+        return lhs.start_ns < rhs.start_ns;
+    });
+    int64_t begin_ns = runs.empty() ? 0 : runs.front().start_ns;
+    auto to_us = [begin_ns](int64_t ns) { return (ns - begin_ns) / 1000.0; };
+
+    // pid 0 is the timeline of the executors, pid 1 of the tasks with a row per task
+    constexpr int EXECUTORS_PID = 0;
+    constexpr int TASKS_PID = 1;
+    EasyJson json;
+    EasyJson events = json.Set("traceEvents", EasyJson::kArray);
+    std::map<const PipelineTask*, std::pair<int, const TaskRunEvent*>> last_runs;
+    for (const auto& run : runs) {
+        auto name = fmt::format("P{}#{}", run.pipeline_id, run.task_index);
+        auto [it, inserted] = last_runs.emplace(
+                run.task, std::make_pair(static_cast<int>(last_runs.size()), &run));
+        int task_tid = it->second.first;
+        if (inserted) {
+            EasyJson meta = events.PushBack(EasyJson::kObject);
+            meta["name"] = "thread_name";
+            meta["ph"] = "M";
+            meta["pid"] = TASKS_PID;
+            meta["tid"] = task_tid;
+            meta["args"]["name"] = fmt::format("{} {}", name, print_id(run.instance_id));
+        } else {
+            // the task waited between its last run and this run
+            const auto* last_run = it->second.second;
+            EasyJson wait = events.PushBack(EasyJson::kObject);
+            wait["name"] = get_state_name(last_run->state);
+            wait["ph"] = "X";
+            wait["pid"] = TASKS_PID;
+            wait["tid"] = task_tid;
+            wait["ts"] = to_us(last_run->end_ns);
+            wait["dur"] = to_us(run.start_ns) - to_us(last_run->end_ns);
+            it->second.second = &run;
+        }
+
+        EasyJson executor_run = events.PushBack(EasyJson::kObject);
+        executor_run["name"] = name;
+        executor_run["ph"] = "X";
+        executor_run["pid"] = EXECUTORS_PID;
+        executor_run["tid"] = run.core_id;
+        executor_run["ts"] = to_us(run.start_ns);
+        executor_run["dur"] = to_us(run.end_ns) - to_us(run.start_ns);
+        executor_run["args"]["instance_id"] = print_id(run.instance_id);
+        executor_run["args"]["state_after_run"] = get_state_name(run.state);
+
+        EasyJson task_run = events.PushBack(EasyJson::kObject);
+        task_run["name"] = "RUNNING";
+        task_run["ph"] = "X";
+        task_run["pid"] = TASKS_PID;
+        task_run["tid"] = task_tid;
+        task_run["ts"] = to_us(run.start_ns);
+        task_run["dur"] = to_us(run.end_ns) - to_us(run.start_ns);
+        task_run["args"]["core_id"] = run.core_id;
+    }
+    return json.ToString();
+}
+
+} // namespace doris::pipeline
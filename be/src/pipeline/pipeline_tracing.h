@@ -0,0 +1,79 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <gen_cpp/Types_types.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "pipeline/pipeline_task.h"
+
+namespace doris::pipeline {
+
+// A run of a pipeline task by an executor of a task scheduler.
+struct TaskRunEvent {
+    TUniqueId query_id;
+    TUniqueId instance_id;
+    // identifies the runs of the same task
+    const PipelineTask* task = nullptr;
+    uint32_t pipeline_id = 0;
+    uint32_t task_index = 0;
+    // the index of the executor
+    uint32_t core_id = 0;
+    // MonotonicNanos
+    int64_t start_ns = 0;
+    int64_t end_ns = 0;
+    // the state after the run, which the task waits in until its next run
+    PipelineTaskState state = PipelineTaskState::RUNNABLE;
+};
+
+// Keeps the latest runs of the pipeline tasks in a ring buffer per executor thread, and exports
+// the runs of a query in the Chrome trace event format, which Perfetto opens too.
+// Only the executor thread writes its buffer, the lock of a buffer is contended by the exports
+// only. Nothing is recorded unless config::enable_pipeline_task_tracing is on.
+class PipelineTracer {
+public:
+    static PipelineTracer* instance();
+
+    void record(const TaskRunEvent& event);
+
+    // The runs of the query still in the buffers are the events on the timeline of the executor
+    // running them, and the gaps between the runs of a task are the waits on the timeline of the
+    // task, named by the state it waited in.
+    std::string dump_chrome_trace(const TUniqueId& query_id);
+
+private:
+    struct Buffer {
+        std::mutex lock;
+        std::vector<TaskRunEvent> events;
+        size_t next = 0;
+    };
+
+    Buffer* _local_buffer();
+
+    std::mutex _lock;
+    // the buffers live as long as the process, as the executor threads do
+    std::vector<std::unique_ptr<Buffer>> _buffers;
+};
+
+} // namespace doris::pipeline
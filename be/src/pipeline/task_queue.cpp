@@ -21,13 +21,22 @@
 #include <chrono> // IWYU pragma: keep
 #include <string>
 
+#include "common/config.h"
 #include "common/logging.h"
 #include "pipeline/pipeline_task.h"
 #include "runtime/task_group/task_group.h"
+#include "util/cpu_info.h"
 
 namespace doris {
 namespace pipeline {
 
+TaskQueue::TaskQueue(size_t core_size) : _core_size(core_size) {
+    _core_to_numa_node.resize(core_size);
+    for (size_t i = 0; i < core_size; ++i) {
+        _core_to_numa_node[i] = CpuInfo::get_numa_node_of_core(i % CpuInfo::num_cores());
+    }
+}
+
 TaskQueue::~TaskQueue() = default;
 
 PipelineTask* SubTaskQueue::try_take(bool is_steal) {
@@ -39,12 +48,14 @@ PipelineTask* SubTaskQueue::try_take(bool is_steal) {
         return nullptr;
     }
     _queue.pop();
+    _size--;
     return task;
 }
 
 ////////////////////  PriorityTaskQueue ////////////////////
 
-PriorityTaskQueue::PriorityTaskQueue() : _closed(false) {
+PriorityTaskQueue::PriorityTaskQueue()
+        : _closed(false), _sharded(config::enable_pipeline_sharded_task_queue) {
     double factor = 1;
     for (int i = 0; i < SUB_QUEUE_LEVEL; ++i) {
         _sub_queues[i].set_level_factor(factor);
@@ -95,12 +106,18 @@ int PriorityTaskQueue::_compute_level(uint64_t runtime) {
 }
 
 PipelineTask* PriorityTaskQueue::try_take(bool is_steal) {
+    if (_sharded) {
+        return _try_take_sharded(is_steal);
+    }
     // TODO other efficient lock? e.g. if get lock fail, return null_ptr
     std::unique_lock<std::mutex> lock(_work_size_mutex);
     return try_take_unprotected(is_steal);
 }
 
 PipelineTask* PriorityTaskQueue::take(uint32_t timeout_ms) {
+    if (_sharded) {
+        return _take_sharded(timeout_ms);
+    }
     std::unique_lock<std::mutex> lock(_work_size_mutex);
     auto task = try_take_unprotected(false);
     if (task) {
@@ -120,6 +137,9 @@ Status PriorityTaskQueue::push(PipelineTask* task) {
         return Status::InternalError("WorkTaskQueue closed");
     }
     auto level = _compute_level(task->get_runtime_ns());
+    if (_sharded) {
+        return _push_sharded(task, level);
+    }
     std::unique_lock<std::mutex> lock(_work_size_mutex);
 
     // update empty queue's  runtime, to avoid too high priority
@@ -134,10 +154,106 @@ Status PriorityTaskQueue::push(PipelineTask* task) {
     return Status::OK();
 }
 
+PipelineTask* PriorityTaskQueue::_try_take_sharded(bool is_steal) {
+    // The chosen level may be emptied by other executors before it is locked, choose again then.
+    for (int retry = 0; retry < SUB_QUEUE_LEVEL; ++retry) {
+        if (_total_task_size == 0 || _closed) {
+            return nullptr;
+        }
+
+        double min_vruntime = 0;
+        int level = -1;
+        for (int i = 0; i < SUB_QUEUE_LEVEL; ++i) {
+            double cur_queue_vruntime = _sub_queues[i].get_vruntime();
+            if (_sub_queues[i].size() > 0) {
+                if (level == -1 || cur_queue_vruntime < min_vruntime) {
+                    level = i;
+                    min_vruntime = cur_queue_vruntime;
+                }
+            }
+        }
+        if (level == -1) {
+            return nullptr;
+        }
+
+        auto& sub_queue = _sub_queues[level];
+        std::unique_lock<SpinLock> lock(sub_queue._lock, std::defer_lock);
+        if (is_steal) {
+            // do not compete with the owner executor for a busy queue
+            if (!lock.try_lock()) {
+                return nullptr;
+            }
+        } else {
+            lock.lock();
+        }
+        if (sub_queue.empty()) {
+            continue;
+        }
+        auto task = sub_queue.try_take(is_steal);
+        lock.unlock();
+        if (!task) {
+            return nullptr;
+        }
+        _queue_level_min_vruntime = min_vruntime;
+        task->update_queue_level(level);
+        _total_task_size--;
+        return task;
+    }
+    return nullptr;
+}
+
+PipelineTask* PriorityTaskQueue::_take_sharded(uint32_t timeout_ms) {
+    auto task = _try_take_sharded(false);
+    if (task) {
+        return task;
+    }
+    {
+        std::unique_lock<std::mutex> lock(_work_size_mutex);
+        // `_num_waiters` must be increased before checking the task size, so that a concurrent
+        // push either sees the waiter or is seen by it.
+        _num_waiters++;
+        if (_total_task_size == 0 && !_closed) {
+            if (timeout_ms > 0) {
+                _wait_task.wait_for(lock, std::chrono::milliseconds(timeout_ms));
+            } else {
+                _wait_task.wait(lock);
+            }
+        }
+        _num_waiters--;
+    }
+    return _try_take_sharded(false);
+}
+
+Status PriorityTaskQueue::_push_sharded(PipelineTask* task, int level) {
+    auto& sub_queue = _sub_queues[level];
+    {
+        std::lock_guard<SpinLock> lock(sub_queue._lock);
+        // update empty queue's  runtime, to avoid too high priority
+        uint64_t min_vruntime = _queue_level_min_vruntime;
+        if (sub_queue.empty() && min_vruntime > sub_queue.get_vruntime()) {
+            sub_queue.adjust_runtime(min_vruntime);
+        }
+        sub_queue.push_back(task);
+    }
+    _total_task_size++;
+    if (_num_waiters > 0) {
+        std::unique_lock<std::mutex> lock(_work_size_mutex);
+        _wait_task.notify_one();
+    }
+    return Status::OK();
+}
+
 MultiCoreTaskQueue::~MultiCoreTaskQueue() = default;
 
 MultiCoreTaskQueue::MultiCoreTaskQueue(size_t core_size) : TaskQueue(core_size), _closed(false) {
     _prio_task_queue_list.reset(new PriorityTaskQueue[core_size]);
+    _numa_node_cores.resize(CpuInfo::get_max_num_numa_nodes());
+    _numa_node_core_idx.resize(core_size);
+    for (size_t i = 0; i < core_size; ++i) {
+        auto& numa_node_cores = _numa_node_cores[_core_to_numa_node[i]];
+        _numa_node_core_idx[i] = numa_node_cores.size();
+        numa_node_cores.push_back(i);
+    }
 }
 
 void MultiCoreTaskQueue::close() {
@@ -173,6 +289,28 @@ PipelineTask* MultiCoreTaskQueue::take(size_t core_id) {
 
 PipelineTask* MultiCoreTaskQueue::_steal_take(size_t core_id) {
     DCHECK(core_id < _core_size);
+    const auto numa_node = _core_to_numa_node[core_id];
+    const auto& local_cores = _numa_node_cores[numa_node];
+    size_t next_idx = _numa_node_core_idx[core_id];
+    for (size_t i = 1; i < local_cores.size(); ++i) {
+        ++next_idx;
+        if (next_idx == local_cores.size()) {
+            next_idx = 0;
+        }
+        auto next_id = local_cores[next_idx];
+        DCHECK(next_id < _core_size);
+        auto task = _prio_task_queue_list[next_id].try_take(true);
+        if (task) {
+            task->set_core_id(next_id);
+            task->inc_steal_counts(false);
+            return task;
+        }
+    }
+
+    if (local_cores.size() == _core_size) {
+        return nullptr;
+    }
+    const size_t cross_numa_steal_threshold = config::pipeline_cross_numa_steal_threshold;
     size_t next_id = core_id;
     for (size_t i = 1; i < _core_size; ++i) {
         ++next_id;
@@ -180,9 +318,14 @@ PipelineTask* MultiCoreTaskQueue::_steal_take(size_t core_id) {
             next_id = 0;
         }
         DCHECK(next_id < _core_size);
+        if (_core_to_numa_node[next_id] == numa_node ||
+            _prio_task_queue_list[next_id].size() < cross_numa_steal_threshold) {
+            continue;
+        }
         auto task = _prio_task_queue_list[next_id].try_take(true);
         if (task) {
             task->set_core_id(next_id);
+            task->inc_steal_counts(true);
             return task;
         }
     }
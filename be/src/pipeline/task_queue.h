@@ -27,10 +27,12 @@
 #include <ostream>
 #include <queue>
 #include <set>
+#include <vector>
 
 #include "common/status.h"
 #include "pipeline_task.h"
 #include "runtime/task_group/task_group.h"
+#include "util/spinlock.h"
 
 namespace doris {
 
@@ -38,7 +40,7 @@ namespace pipeline {
 
 class TaskQueue {
 public:
-    TaskQueue(size_t core_size) : _core_size(core_size) {}
+    TaskQueue(size_t core_size);
     virtual ~TaskQueue();
     virtual void close() = 0;
     // Get the task by core id.
@@ -58,8 +60,12 @@ public:
 
     int cores() const { return _core_size; }
 
+    // The NUMA node of the executor with `core_id`, executors are spread over the cores in order.
+    int numa_node_of_core(size_t core_id) const { return _core_to_numa_node[core_id]; }
+
 protected:
     size_t _core_size;
+    std::vector<int> _core_to_numa_node;
     static constexpr auto WAIT_CORE_TASK_TIMEOUT_MS = 100;
 };
 
@@ -67,7 +73,10 @@ class SubTaskQueue {
     friend class PriorityTaskQueue;
 
 public:
-    void push_back(PipelineTask* task) { _queue.emplace(task); }
+    void push_back(PipelineTask* task) {
+        _queue.emplace(task);
+        _size++;
+    }
 
     PipelineTask* try_take(bool is_steal);
 
@@ -84,8 +93,14 @@ public:
 
     bool empty() { return _queue.empty(); }
 
+    // Could be read without holding the lock of the queue.
+    size_t size() const { return _size; }
+
 private:
     std::queue<PipelineTask*> _queue;
+    std::atomic<size_t> _size = 0;
+    // only used by the sharded PriorityTaskQueue
+    SpinLock _lock;
     // depends on LEVEL_QUEUE_TIME_FACTOR
     double _level_factor = 1;
 
@@ -93,6 +108,9 @@ private:
 };
 
 // A Multilevel Feedback Queue
+// If config::enable_pipeline_sharded_task_queue is set, each level is protected by its own
+// spin lock instead of one mutex for the whole queue, and the executors only wait on the
+// condition variable when the queue is empty.
 class PriorityTaskQueue {
 public:
     explicit PriorityTaskQueue();
@@ -111,6 +129,8 @@ public:
         _sub_queues[level].inc_runtime(runtime);
     }
 
+    size_t size() const { return _total_task_size; }
+
 private:
     static constexpr auto LEVEL_QUEUE_TIME_FACTOR = 2;
     static constexpr size_t SUB_QUEUE_LEVEL = 6;
@@ -121,16 +141,26 @@ private:
     std::mutex _work_size_mutex;
     std::condition_variable _wait_task;
     std::atomic<size_t> _total_task_size = 0;
-    bool _closed;
+    std::atomic<bool> _closed;
+    const bool _sharded;
+    // executors waiting on `_wait_task`, only used by the sharded queue
+    std::atomic<int> _num_waiters = 0;
 
     // used to adjust vruntime of a queue when it's not empty
-    // protected by lock _work_size_mutex
-    uint64_t _queue_level_min_vruntime = 0;
+    std::atomic<uint64_t> _queue_level_min_vruntime = 0;
 
     int _compute_level(uint64_t real_runtime);
+
+    PipelineTask* _try_take_sharded(bool is_steal);
+
+    PipelineTask* _take_sharded(uint32_t timeout_ms);
+
+    Status _push_sharded(PipelineTask* task, int level);
 };
 
-// Need consider NUMA architecture
+// The executors are grouped by NUMA node, an idle executor steals tasks from the executors of
+// the same NUMA node first, and from the other NUMA nodes only when they have enough tasks
+// waiting (config::pipeline_cross_numa_steal_threshold), to avoid remote memory access.
 class MultiCoreTaskQueue : public TaskQueue {
 public:
     explicit MultiCoreTaskQueue(size_t core_size);
@@ -163,6 +193,10 @@ private:
     PipelineTask* _steal_take(size_t core_id);
 
     std::unique_ptr<PriorityTaskQueue[]> _prio_task_queue_list;
+    // executors of each NUMA node
+    std::vector<std::vector<size_t>> _numa_node_cores;
+    // index of each executor in `_numa_node_cores` of its NUMA node
+    std::vector<size_t> _numa_node_core_idx;
     std::atomic<size_t> _next_core = 0;
     std::atomic<bool> _closed;
 };
@@ -21,6 +21,7 @@
 #include <gen_cpp/Types_types.h>
 #include <gen_cpp/types.pb.h>
 #include <glog/logging.h>
+#include <pthread.h>
 #include <sched.h>
 
 #include <algorithm>
@@ -31,14 +32,21 @@
 #include <string>
 #include <thread>
 
+#include "common/config.h"
 #include "common/signal_handler.h"
+#include "pipeline/exec/dependency.h"
 #include "pipeline/pipeline_task.h"
+#include "pipeline/pipeline_tracing.h"
 #include "pipeline/task_queue.h"
 #include "pipeline_fragment_context.h"
 #include "runtime/query_context.h"
+#include "util/cpu_info.h"
+#include "util/doris_metrics.h"
+#include "util/metrics.h"
 #include "util/sse_util.hpp"
 #include "util/thread.h"
 #include "util/threadpool.h"
+#include "util/time.h"
 #include "util/uid_util.h"
 #include "vec/runtime/vdatetime_value.h"
 
@@ -74,12 +82,70 @@ Status BlockedTaskScheduler::add_blocked_task(PipelineTask* task) {
     if (this->_shutdown) {
         return Status::InternalError("BlockedTaskScheduler shutdown");
     }
+    if (auto* dependency = task->blocked_dependency()) {
+        _add_dependency_blocked_task(task, dependency);
+        return Status::OK();
+    }
     std::unique_lock<std::mutex> lock(_task_mutex);
     _blocked_tasks.push_back(task);
     _task_cond.notify_one();
     return Status::OK();
 }
 
+void BlockedTaskScheduler::_add_dependency_blocked_task(PipelineTask* task,
+                                                        Dependency* dependency) {
+    task->set_waiting_dependency(dependency, this);
+    {
+        std::unique_lock<std::mutex> lock(_dependency_mutex);
+        _dependency_blocked_tasks.insert(task);
+        _num_dependency_blocked_tasks = _dependency_blocked_tasks.size();
+    }
+    dependency->add_waiter(task);
+    // The dependency may be notified before the task is added as a waiter, check the condition
+    // again, the task is not waked up twice since only one of us could remove it from waiters.
+    if (task->blocked_condition_ready() && dependency->remove_waiter(task)) {
+        wake_up(task);
+    }
+}
+
+void BlockedTaskScheduler::wake_up(PipelineTask* task) {
+    {
+        std::unique_lock<std::mutex> lock(_dependency_mutex);
+        _dependency_blocked_tasks.erase(task);
+        _num_dependency_blocked_tasks = _dependency_blocked_tasks.size();
+    }
+    task->set_state(PipelineTaskState::RUNNABLE);
+    _task_queue->push_back(task);
+}
+
+bool BlockedTaskScheduler::_should_check_dependency_blocked_tasks() const {
+    return _num_dependency_blocked_tasks > 0 &&
+           MonotonicMillis() - _last_dependency_check_time_ms >=
+                   DEPENDENCY_BLOCKED_TASK_CHECK_INTERVAL_MS;
+}
+
+void BlockedTaskScheduler::_check_dependency_blocked_tasks(
+        std::list<PipelineTask*>& local_blocked_tasks) {
+    _last_dependency_check_time_ms = MonotonicMillis();
+    vectorized::VecDateTimeValue now = vectorized::VecDateTimeValue::local_time();
+    std::unique_lock<std::mutex> lock(_dependency_mutex);
+    auto iter = _dependency_blocked_tasks.begin();
+    while (iter != _dependency_blocked_tasks.end()) {
+        auto* task = *iter;
+        bool need_check = task->fragment_context()->is_canceled() ||
+                          task->query_context()->is_timeout(now) ||
+                          task->blocked_condition_ready();
+        // if the task could not be removed from the waiters, it is being waked up by dependency
+        if (need_check && task->waiting_dependency()->remove_waiter(task)) {
+            iter = _dependency_blocked_tasks.erase(iter);
+            local_blocked_tasks.push_back(task);
+        } else {
+            iter++;
+        }
+    }
+    _num_dependency_blocked_tasks = _dependency_blocked_tasks.size();
+}
+
 void BlockedTaskScheduler::_schedule() {
     _started.store(true);
     std::list<PipelineTask*> local_blocked_tasks;
@@ -91,7 +157,8 @@ void BlockedTaskScheduler::_schedule() {
             std::unique_lock<std::mutex> lock(this->_task_mutex);
             local_blocked_tasks.splice(local_blocked_tasks.end(), _blocked_tasks);
             if (local_blocked_tasks.empty()) {
-                while (!_shutdown.load() && _blocked_tasks.empty()) {
+                while (!_shutdown.load() && _blocked_tasks.empty() &&
+                       !_should_check_dependency_blocked_tasks()) {
                     _task_cond.wait_for(lock, std::chrono::milliseconds(10));
                 }
 
@@ -99,11 +166,14 @@ void BlockedTaskScheduler::_schedule() {
                     break;
                 }
 
-                DCHECK(!_blocked_tasks.empty());
                 local_blocked_tasks.splice(local_blocked_tasks.end(), _blocked_tasks);
             }
         }
 
+        if (_should_check_dependency_blocked_tasks()) {
+            _check_dependency_blocked_tasks(local_blocked_tasks);
+        }
+
         auto iter = local_blocked_tasks.begin();
         vectorized::VecDateTimeValue now = vectorized::VecDateTimeValue::local_time();
         while (iter != local_blocked_tasks.end()) {
@@ -230,13 +300,39 @@ Status TaskScheduler::schedule_task(PipelineTask* task) {
     // TODO control num of task
 }
 
+void TaskScheduler::_bind_numa_node(size_t index) {
+    if (!config::enable_pipeline_numa_affinity || CpuInfo::get_max_num_numa_nodes() <= 1) {
+        return;
+    }
+    const auto numa_node = _task_queue->numa_node_of_core(index);
+    cpu_set_t cpu_set;
+    CPU_ZERO(&cpu_set);
+    for (auto core : CpuInfo::get_cores_of_numa_node(numa_node)) {
+        CPU_SET(core, &cpu_set);
+    }
+    int ret = pthread_setaffinity_np(pthread_self(), sizeof(cpu_set), &cpu_set);
+    if (ret != 0) {
+        LOG(WARNING) << "failed to bind pipeline executor " << index << " to numa node "
+                     << numa_node << ", error: " << ret;
+    }
+}
+
 void TaskScheduler::_do_work(size_t index) {
+    _bind_numa_node(index);
     const auto& marker = _markers[index];
+    // Collect the schedule latency locally and merge it into the global metric in batch,
+    // to avoid contending the lock of the metric for every task.
+    HistogramMetric schedule_latency;
     while (*marker) {
         auto* task = _task_queue->take(index);
         if (!task) {
             continue;
         }
+        schedule_latency.add(task->last_wait_worker_time_ns() / 1000);
+        if (schedule_latency.num() >= SCHEDULE_LATENCY_MERGE_BATCH) {
+            DorisMetrics::instance()->pipeline_task_schedule_latency_us->merge(schedule_latency);
+            schedule_latency.clear();
+        }
         task->set_task_queue(_task_queue.get());
         auto* fragment_ctx = task->fragment_context();
         signal::query_id_hi = fragment_ctx->get_query_id().hi;
@@ -270,11 +366,27 @@ void TaskScheduler::_do_work(size_t index) {
         bool eos = false;
         auto status = Status::OK();
 
+        int64_t start_ns = config::enable_pipeline_task_tracing ? MonotonicNanos() : 0;
         try {
             status = task->execute(&eos);
         } catch (const Exception& e) {
             status = e.to_status();
         }
+        if (start_ns != 0) {
+            TaskRunEvent event;
+            event.query_id = fragment_ctx->get_query_id();
+            event.instance_id = fragment_ctx->get_fragment_instance_id();
+            event.task = task;
+            event.pipeline_id = task->pipeline_id();
+            event.task_index = task->index();
+            event.core_id = index;
+            event.start_ns = start_ns;
+            event.end_ns = MonotonicNanos();
+            event.state = !status.ok() ? PipelineTaskState::CANCELED
+                          : eos        ? PipelineTaskState::FINISHED
+                                       : task->get_state();
+            PipelineTracer::instance()->record(event);
+        }
 
         task->set_previous_core_id(index);
         if (!status.ok()) {
@@ -24,6 +24,7 @@
 #include <list>
 #include <memory>
 #include <mutex>
+#include <unordered_set>
 #include <utility>
 #include <vector>
 
@@ -54,6 +55,10 @@ public:
     void shutdown();
     Status add_blocked_task(PipelineTask* task);
 
+    // Push the task waiting on a dependency back to the task queue, called by the thread
+    // notifying the dependency.
+    void wake_up(PipelineTask* task);
+
 private:
     std::shared_ptr<TaskQueue> _task_queue;
 
@@ -61,14 +66,27 @@ private:
     std::condition_variable _task_cond;
     std::list<PipelineTask*> _blocked_tasks;
 
+    // The tasks waiting on the dependencies are not polled, but still checked every
+    // DEPENDENCY_BLOCKED_TASK_CHECK_INTERVAL_MS for cancellation and timeout, and as a fallback
+    // of a missing notification.
+    std::mutex _dependency_mutex;
+    std::unordered_set<PipelineTask*> _dependency_blocked_tasks;
+    std::atomic<size_t> _num_dependency_blocked_tasks = 0;
+    int64_t _last_dependency_check_time_ms = 0;
+
     scoped_refptr<Thread> _thread;
     std::atomic<bool> _started;
     std::atomic<bool> _shutdown;
 
     static constexpr auto EMPTY_TIMES_TO_YIELD = 64;
+    static constexpr auto DEPENDENCY_BLOCKED_TASK_CHECK_INTERVAL_MS = 100;
 
 private:
     void _schedule();
+    void _add_dependency_blocked_task(PipelineTask* task, Dependency* dependency);
+    bool _should_check_dependency_blocked_tasks() const;
+    // move the tasks should be checked to `local_blocked_tasks`
+    void _check_dependency_blocked_tasks(std::list<PipelineTask*>& local_blocked_tasks);
     void _make_task_run(std::list<PipelineTask*>& local_tasks,
                         std::list<PipelineTask*>::iterator& task_itr,
                         std::vector<PipelineTask*>& ready_tasks,
@@ -101,7 +119,11 @@ private:
     std::shared_ptr<BlockedTaskScheduler> _blocked_task_scheduler;
     std::atomic<bool> _shutdown;
 
+    static constexpr uint64_t SCHEDULE_LATENCY_MERGE_BATCH = 1024;
+
     void _do_work(size_t index);
+    // Pin the executor thread to the cores of its NUMA node.
+    void _bind_numa_node(size_t index);
     // after _try_close_task, task maybe destructed.
     void _try_close_task(PipelineTask* task, PipelineTaskState state);
 };
@@ -139,4 +139,18 @@ void BlockSpillManager::remove(int64_t stream_id) {
     std::lock_guard<std::mutex> l(lock_);
     id_to_file_paths_.erase(stream_id);
 }
+
+void BlockSpillManager::delete_stream(int64_t stream_id) {
+    std::string path;
+    {
+        std::lock_guard<std::mutex> l(lock_);
+        auto it = id_to_file_paths_.find(stream_id);
+        if (it == id_to_file_paths_.end()) {
+            return;
+        }
+        path = std::move(it->second);
+        id_to_file_paths_.erase(it);
+    }
+    static_cast<void>(io::global_local_filesystem()->delete_file(path));
+}
 } // namespace doris
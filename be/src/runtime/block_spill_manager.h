@@ -53,6 +53,9 @@ public:
 
     void remove(int64_t streamid_);
 
+    // Removes a stream which is not read back and deletes its file.
+    void delete_stream(int64_t stream_id);
+
     void gc(int64_t max_file_count);
 
 private:
@@ -17,6 +17,7 @@
 
 #include "runtime/buffer_control_block.h"
 
+#include <arrow/record_batch.h>
 #include <gen_cpp/Data_types.h>
 #include <gen_cpp/PaloInternalService_types.h>
 #include <gen_cpp/internal_service.pb.h>
@@ -35,6 +36,11 @@
 
 namespace doris {
 
+static size_t num_result_rows(const TFetchDataResult& result) {
+    return result.result_batch.__isset.row_lengths ? result.result_batch.row_lengths.size()
+                                                   : result.result_batch.rows.size();
+}
+
 void GetResultBatchCtx::on_failure(const Status& status) {
     DCHECK(!status.ok()) << "status is ok, errmsg=" << status;
     status.to_protobuf(result->mutable_status());
@@ -117,7 +123,7 @@ Status BufferControlBlock::add_batch(std::unique_ptr<TFetchDataResult>& result)
         return Status::Cancelled("Cancelled");
     }
 
-    int num_rows = result->result_batch.rows.size();
+    int num_rows = num_result_rows(*result);
 
     while ((!_batch_queue.empty() && _buffer_rows > _buffer_limit) && !_is_cancelled) {
         _data_removal.wait_for(l, std::chrono::seconds(1));
@@ -128,8 +134,10 @@ Status BufferControlBlock::add_batch(std::unique_ptr<TFetchDataResult>& result)
     }
 
     if (_waiting_rpc.empty()) {
-        // Merge result into batch to reduce rpc times
-        if (!_batch_queue.empty() &&
+        // Merge result into batch to reduce rpc times, the packed rows of a block are big
+        // enough to be sent alone and are not copied
+        if (!_batch_queue.empty() && !result->result_batch.__isset.rows_data &&
+            !_batch_queue.back()->result_batch.__isset.rows_data &&
             ((_batch_queue.back()->result_batch.rows.size() + num_rows) < _buffer_limit) &&
             !result->eos) {
             std::vector<std::string>& back_rows = _batch_queue.back()->result_batch.rows;
@@ -164,7 +172,7 @@ void BufferControlBlock::get_batch(GetResultBatchCtx* ctx) {
         // get result
         std::unique_ptr<TFetchDataResult> result = std::move(_batch_queue.front());
         _batch_queue.pop_front();
-        _buffer_rows -= result->result_batch.rows.size();
+        _buffer_rows -= num_result_rows(*result);
         _data_removal.notify_one();
 
         ctx->on_data(result, _packet_num);
@@ -179,6 +187,58 @@ void BufferControlBlock::get_batch(GetResultBatchCtx* ctx) {
     _waiting_rpc.push_back(ctx);
 }
 
+Status BufferControlBlock::add_arrow_batch(std::shared_ptr<arrow::RecordBatch>& result) {
+    std::unique_lock<std::mutex> l(_lock);
+
+    if (_is_cancelled) {
+        return Status::Cancelled("Cancelled");
+    }
+
+    int num_rows = result->num_rows();
+
+    while ((!_arrow_batch_queue.empty() && _buffer_rows > _buffer_limit) && !_is_cancelled) {
+        _data_removal.wait_for(l, std::chrono::seconds(1));
+    }
+
+    if (_is_cancelled) {
+        return Status::Cancelled("Cancelled");
+    }
+
+    // the batches are not merged, every one is a block which is large enough for a fetch
+    _arrow_batch_queue.push_back(std::move(result));
+    _buffer_rows += num_rows;
+    _data_arrival.notify_one();
+    return Status::OK();
+}
+
+Status BufferControlBlock::get_arrow_batch(std::shared_ptr<arrow::RecordBatch>* result,
+                                           int64_t* packet_seq) {
+    std::unique_lock<std::mutex> l(_lock);
+
+    while (_arrow_batch_queue.empty() && !_is_cancelled && !_is_close) {
+        _data_arrival.wait_for(l, std::chrono::seconds(1));
+    }
+
+    if (_is_cancelled) {
+        return Status::Cancelled("Cancelled");
+    }
+
+    if (!_arrow_batch_queue.empty()) {
+        *result = std::move(_arrow_batch_queue.front());
+        _arrow_batch_queue.pop_front();
+        _buffer_rows -= (*result)->num_rows();
+        _data_removal.notify_one();
+        *packet_seq = _packet_num++;
+        return Status::OK();
+    }
+
+    // closed and no more batches
+    RETURN_IF_ERROR(_status);
+    *result = nullptr;
+    *packet_seq = _packet_num;
+    return Status::OK();
+}
+
 Status BufferControlBlock::close(Status exec_status) {
     std::unique_lock<std::mutex> l(_lock);
     _is_close = true;
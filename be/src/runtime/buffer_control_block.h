@@ -31,6 +31,10 @@
 #include "common/status.h"
 #include "runtime/query_statistics.h"
 
+namespace arrow {
+class RecordBatch;
+} // namespace arrow
+
 namespace google {
 namespace protobuf {
 class Closure;
@@ -72,6 +76,13 @@ public:
 
     void get_batch(GetResultBatchCtx* ctx);
 
+    // The sink of the arrow flight protocol puts arrow batches instead of mysql rows, they are
+    // taken by fetch_arrow_data rpcs.
+    Status add_arrow_batch(std::shared_ptr<arrow::RecordBatch>& result);
+
+    // Wait for the next arrow batch, `result` is nullptr after the last one.
+    Status get_arrow_batch(std::shared_ptr<arrow::RecordBatch>* result, int64_t* packet_seq);
+
     // close buffer block, set _status to exec_status and set _is_close to true;
     // called because data has been read or error happened.
     Status close(Status exec_status);
@@ -101,7 +112,9 @@ public:
     }
 
 protected:
-    virtual bool _get_batch_queue_empty() { return _batch_queue.empty(); }
+    virtual bool _get_batch_queue_empty() {
+        return _batch_queue.empty() && _arrow_batch_queue.empty();
+    }
     virtual void _update_batch_queue_empty() {}
 
     using ResultQueue = std::list<std::unique_ptr<TFetchDataResult>>;
@@ -117,6 +130,7 @@ protected:
 
     // blocking queue for batch
     ResultQueue _batch_queue;
+    std::list<std::shared_ptr<arrow::RecordBatch>> _arrow_batch_queue;
     // protects all subsequent data in this block
     std::mutex _lock;
     // signal arrival of new batch or the eos/cancelled condition
@@ -143,7 +157,9 @@ public:
 
 private:
     bool _get_batch_queue_empty() override { return _batch_queue_empty; }
-    void _update_batch_queue_empty() override { _batch_queue_empty = _batch_queue.empty(); }
+    void _update_batch_queue_empty() override {
+        _batch_queue_empty = _batch_queue.empty() && _arrow_batch_queue.empty();
+    }
 
     std::atomic_bool _batch_queue_empty = false;
 };
@@ -22,6 +22,7 @@
 #include <iostream>
 #include <list>
 #include <utility>
+#include <vector>
 
 #include "olap/olap_define.h"
 #include "runtime/cache/cache_utils.h"
@@ -81,7 +82,7 @@ void ResultNodeList::clear() {
 }
 /**
  * Find the node and update partition data
- * New node, the node updated in the first partition will move to the tail of the list
+ * The updated node is the most recently used one and moves to the tail of the list
  */
 void ResultCache::update(const PUpdateCacheRequest* request, PCacheResponse* response) {
     ResultNode* node;
@@ -104,9 +105,7 @@ void ResultCache::update(const PUpdateCacheRequest* request, PCacheResponse* res
         _node_map[sql_key] = node;
         _node_count += 1;
     }
-    if (update_first) {
-        _node_list.move_tail(node);
-    }
+    _node_list.move_tail(node);
     _cache_size += node->get_data_size();
     _partition_count += node->get_partition_count();
     response->set_status(status);
@@ -133,7 +132,17 @@ void ResultCache::fetch(const PFetchCacheRequest* request, PFetchCacheResult* re
         }
         ResultNode* node = node_it->second;
         PartitionRowBatchList part_rowbatch_list;
-        PCacheStatus status = node->fetch_partition(request, part_rowbatch_list, hit_first);
+        PCacheStatus status;
+        if (request->fetch_partial()) {
+            std::vector<PartitionKey> missed_keys;
+            status = node->fetch_partial_partition(request, part_rowbatch_list, &missed_keys,
+                                                   hit_first);
+            for (auto key : missed_keys) {
+                result->add_missed_partition_keys(key);
+            }
+        } else {
+            status = node->fetch_partition(request, part_rowbatch_list, hit_first);
+        }
 
         for (auto part_it = part_rowbatch_list.begin(); part_it != part_rowbatch_list.end();
              part_it++) {
@@ -154,9 +163,13 @@ void ResultCache::fetch(const PFetchCacheRequest* request, PFetchCacheResult* re
         result->set_status(status);
     }
 
-    if (hit_first) {
+    if (result->status() == PCacheStatus::CACHE_OK) {
         CacheWriteLock write_lock(_cache_mtx);
-        _node_list.move_tail(node_it->second);
+        // the node may be pruned after the read lock is released
+        node_it = _node_map.find(sql_key);
+        if (node_it != _node_map.end()) {
+            _node_list.move_tail(node_it->second);
+        }
     }
 }
 
@@ -196,37 +209,10 @@ void ResultCache::clear(const PClearCacheRequest* request, PCacheResponse* respo
     response->set_status(PCacheStatus::CACHE_OK);
 }
 
-//private method
-ResultNode* find_min_time_node(ResultNode* result_node) {
-    if (result_node->get_prev()) {
-        if (result_node->get_prev()->first_partition_last_time() <=
-            result_node->first_partition_last_time()) {
-            return result_node->get_prev();
-        }
-    }
-
-    if (result_node->get_next()) {
-        if (result_node->get_next()->first_partition_last_time() <
-            result_node->first_partition_last_time()) {
-            return result_node->get_next();
-        }
-    }
-    return result_node;
-}
-
 /*
-* Two-dimensional array, prune the min last_read_time PartitionRowBatch.
-* The following example is the last read time array.
-* 1 and 2 is the read time, nodes with pruning read time < 3
-* Before:
-*   1,2         //_head ResultNode*
-*   1,2,3,4,5   
-*   2,4,3,6,8   
-*   5,7,9,11,13 //_tail ResultNode*
-* After:
-*   4,5         //_head
-*   4,3,6,8
-*   5,7,9,11,13 //_tail
+* The nodes of _node_list are in LRU order, so the partitions of the least recently used node
+* are pruned first, from the smallest partition key, which is the oldest one of time partitions.
+* A node without partitions is removed.
 */
 void ResultCache::prune() {
     if (_cache_size <= (_max_size + _elasticity_size)) {
@@ -234,24 +220,14 @@ void ResultCache::prune() {
     }
     LOG(INFO) << "begin prune cache, cache_size : " << _cache_size << ", max_size : " << _max_size
               << ", elasticity_size : " << _elasticity_size;
-    ResultNode* result_node = _node_list.get_head();
     while (_cache_size > _max_size) {
+        ResultNode* result_node = _node_list.get_head();
         if (result_node == nullptr) {
             break;
         }
-        result_node = find_min_time_node(result_node);
         _cache_size -= result_node->prune_first();
-        if (result_node->get_data_size() == 0) {
-            ResultNode* next_node;
-            if (result_node->get_next()) {
-                next_node = result_node->get_next();
-            } else if (result_node->get_prev()) {
-                next_node = result_node->get_prev();
-            } else {
-                next_node = _node_list.get_head();
-            }
+        if (result_node->get_partition_count() == 0) {
             remove(result_node);
-            result_node = next_node;
         }
     }
     LOG(INFO) << "finish prune, cache_size : " << _cache_size;
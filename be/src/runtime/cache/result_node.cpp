@@ -45,7 +45,7 @@ void PartitionRowBatch::set_row_batch(const PCacheValue& value) {
     }
     SAFE_DELETE(_cache_value);
     _cache_value = new PCacheValue(value);
-    _data_size += _cache_value->data_size();
+    _data_size = _cache_value->data_size();
     _cache_stat.update();
     LOG(INFO) << "finish set row batch, row num:" << _cache_value->rows_size()
               << ", data size:" << _data_size;
@@ -291,6 +291,36 @@ PCacheStatus ResultNode::fetch_partition(const PFetchCacheRequest* request,
     return status;
 }
 
+PCacheStatus ResultNode::fetch_partial_partition(const PFetchCacheRequest* request,
+                                                 PartitionRowBatchList& row_batch_list,
+                                                 std::vector<PartitionKey>* missed_keys,
+                                                 bool& is_hit_firstkey) {
+    is_hit_firstkey = false;
+    if (request->params_size() == 0) {
+        return PCacheStatus::PARAM_ERROR;
+    }
+
+    CacheReadLock read_lock(_node_mtx);
+
+    if (_partition_list.size() == 0) {
+        return PCacheStatus::NO_PARTITION_KEY;
+    }
+
+    const PartitionRowBatch* first = *_partition_list.begin();
+    for (const auto& param : request->params()) {
+        auto it = _partition_map.find(param.partition_key());
+        if (it == _partition_map.end() || !it->second->is_hit_cache(param)) {
+            missed_keys->push_back(param.partition_key());
+            continue;
+        }
+        if (it->second == first) {
+            is_hit_firstkey = true;
+        }
+        row_batch_list.push_back(it->second);
+    }
+    return row_batch_list.empty() ? PCacheStatus::NO_PARTITION_KEY : PCacheStatus::CACHE_OK;
+}
+
 /*
 * prune first partition result
 */
@@ -23,6 +23,7 @@
 #include <list>
 #include <shared_mutex>
 #include <unordered_map>
+#include <vector>
 
 #include "gutil/integral_types.h"
 #include "runtime/cache/cache_utils.h"
@@ -109,6 +110,12 @@ public:
     PCacheStatus update_partition(const PUpdateCacheRequest* request, bool& is_update_firstkey);
     PCacheStatus fetch_partition(const PFetchCacheRequest* request,
                                  PartitionRowBatchList& rowBatchList, bool& is_hit_firstkey);
+    // Fetch every cached partition of the request with a matching version, the others are
+    // computed by the query and added to the cache by update_partition.
+    PCacheStatus fetch_partial_partition(const PFetchCacheRequest* request,
+                                         PartitionRowBatchList& row_batch_list,
+                                         std::vector<PartitionKey>* missed_keys,
+                                         bool& is_hit_firstkey);
     PCacheStatus update_sql_cache(const PUpdateCacheRequest* request, bool& is_update_firstkey);
     PCacheStatus update_partition_cache(const PUpdateCacheRequest* request,
                                         bool& is_update_firstkey);
@@ -0,0 +1,75 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "runtime/descriptor_tbl_cache.h"
+
+#include <gen_cpp/Descriptors_types.h>
+#include <glog/logging.h>
+
+#include <string>
+
+#include "runtime/descriptors.h"
+#include "util/thrift_util.h"
+
+namespace doris {
+
+DescriptorTblCache* DescriptorTblCache::_s_instance = nullptr;
+
+DescriptorTblCache::DescriptorTblCache(int64_t capacity, uint32_t num_shards) {
+    _cache = std::unique_ptr<Cache>(
+            new_lru_cache("DescriptorTblCache", capacity, LRUCacheType::SIZE, num_shards));
+}
+
+void DescriptorTblCache::create_global_cache(int64_t capacity, uint32_t num_shards) {
+    DCHECK(_s_instance == nullptr);
+    static DescriptorTblCache instance(capacity, num_shards);
+    _s_instance = &instance;
+}
+
+DescriptorTblCache* DescriptorTblCache::instance() {
+    return _s_instance;
+}
+
+Status DescriptorTblCache::get_or_create(const TDescriptorTable& thrift_tbl,
+                                         std::shared_ptr<CachedDescriptorTbl>* tbl) {
+    ThriftSerializer ser(false, 4096);
+    uint8_t* buf = nullptr;
+    uint32_t len = 0;
+    RETURN_IF_ERROR(ser.serialize(const_cast<TDescriptorTable*>(&thrift_tbl), &len, &buf));
+    CacheKey key(reinterpret_cast<const char*>(buf), len);
+
+    auto* handle = _cache->lookup(key);
+    if (handle != nullptr) {
+        *tbl = *reinterpret_cast<std::shared_ptr<CachedDescriptorTbl>*>(_cache->value(handle));
+        _cache->release(handle);
+        return Status::OK();
+    }
+
+    auto value = std::make_shared<CachedDescriptorTbl>();
+    RETURN_IF_ERROR(DescriptorTbl::create(&value->pool, thrift_tbl, &value->tbl));
+    auto deleter = [](const doris::CacheKey& key, void* value) {
+        delete reinterpret_cast<std::shared_ptr<CachedDescriptorTbl>*>(value);
+    };
+    // the descriptors take about twice the size of their thrift encoding
+    handle = _cache->insert(key, new std::shared_ptr<CachedDescriptorTbl>(value), len * 2,
+                            deleter);
+    _cache->release(handle);
+    *tbl = std::move(value);
+    return Status::OK();
+}
+
+} // namespace doris
@@ -0,0 +1,63 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <memory>
+
+#include "common/object_pool.h"
+#include "common/status.h"
+#include "olap/lru_cache.h"
+
+namespace doris {
+
+class DescriptorTbl;
+class TDescriptorTable;
+
+// A descriptor table shared by the queries with the same TDescriptorTable. The descriptors are
+// never modified after DescriptorTbl::create.
+struct CachedDescriptorTbl {
+    ObjectPool pool;
+    DescriptorTbl* tbl = nullptr;
+};
+
+// DescriptorTblCache keeps the descriptor tables built for previous queries, keyed by the
+// serialized TDescriptorTable. The repeated short queries of a dashboard or a point lookup
+// send the same descriptor table, so the tuple, slot and table descriptors are built once
+// instead of for every query.
+class DescriptorTblCache {
+public:
+    // Create global instance of this class
+    static void create_global_cache(int64_t capacity, uint32_t num_shards = kDefaultNumShards);
+
+    static DescriptorTblCache* instance();
+
+    // Return the cached descriptor table of `thrift_tbl`, or create and cache it.
+    Status get_or_create(const TDescriptorTable& thrift_tbl,
+                         std::shared_ptr<CachedDescriptorTbl>* tbl);
+
+private:
+    static constexpr uint32_t kDefaultNumShards = 16;
+    DescriptorTblCache(int64_t capacity, uint32_t num_shards);
+    static DescriptorTblCache* _s_instance;
+    std::unique_ptr<Cache> _cache;
+};
+
+} // namespace doris
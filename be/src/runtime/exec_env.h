@@ -57,6 +57,7 @@ class ResultQueueMgr;
 class TMasterInfo;
 class LoadChannelMgr;
 class StreamLoadExecutor;
+class GroupCommitMgr;
 class RoutineLoadTaskExecutor;
 class SmallFileMgr;
 class BlockSpillManager;
@@ -128,6 +129,8 @@ public:
     ThreadPool* buffered_reader_prefetch_thread_pool() {
         return _buffered_reader_prefetch_thread_pool.get();
     }
+    ThreadPool* s3_file_upload_thread_pool() { return _s3_file_upload_thread_pool.get(); }
+    ThreadPool* snapshot_upload_thread_pool() { return _snapshot_upload_thread_pool.get(); }
     ThreadPool* send_report_thread_pool() { return _send_report_thread_pool.get(); }
     ThreadPool* join_node_thread_pool() { return _join_node_thread_pool.get(); }
 
@@ -170,6 +173,7 @@ public:
     void set_storage_engine(StorageEngine* storage_engine) { _storage_engine = storage_engine; }
 
     std::shared_ptr<StreamLoadExecutor> stream_load_executor() { return _stream_load_executor; }
+    GroupCommitMgr* group_commit_mgr() { return _group_commit_mgr; }
     RoutineLoadTaskExecutor* routine_load_task_executor() { return _routine_load_task_executor; }
     HeartbeatFlags* heartbeat_flags() { return _heartbeat_flags; }
     doris::vectorized::ScannerScheduler* scanner_scheduler() { return _scanner_scheduler; }
@@ -226,6 +230,10 @@ private:
     std::unique_ptr<ThreadPool> _download_cache_thread_pool;
     // Threadpool used to prefetch remote file for buffered reader
     std::unique_ptr<ThreadPool> _buffered_reader_prefetch_thread_pool;
+    // Threadpool used to upload the parts of s3 file writers
+    std::unique_ptr<ThreadPool> _s3_file_upload_thread_pool;
+    // Threadpool used to upload the tablet snapshots of all the backup upload tasks
+    std::unique_ptr<ThreadPool> _snapshot_upload_thread_pool;
     // A token used to submit download cache task serially
     std::unique_ptr<ThreadPoolToken> _serial_download_cache_thread_token;
     // Pool used by fragment manager to send profile or status to FE coordinator
@@ -252,6 +260,7 @@ private:
     StorageEngine* _storage_engine = nullptr;
 
     std::shared_ptr<StreamLoadExecutor> _stream_load_executor;
+    GroupCommitMgr* _group_commit_mgr = nullptr;
     RoutineLoadTaskExecutor* _routine_load_task_executor = nullptr;
     SmallFileMgr* _small_file_mgr = nullptr;
     HeartbeatFlags* _heartbeat_flags = nullptr;
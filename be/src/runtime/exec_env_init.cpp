@@ -24,6 +24,7 @@
 #include <string.h>
 #include <sys/resource.h>
 
+#include <algorithm>
 #include <limits>
 #include <map>
 #include <memory>
@@ -39,9 +40,11 @@
 #include "common/status.h"
 #include "io/fs/file_meta_cache.h"
 #include "io/fs/stream_load_pipe.h"
+#include "olap/merged_agg_block_cache.h"
 #include "olap/olap_define.h"
 #include "olap/options.h"
 #include "olap/page_cache.h"
+#include "olap/rowset/segment_v2/bloom_filter_index_reader.h"
 #include "olap/rowset/segment_v2/inverted_index_cache.h"
 #include "olap/schema_cache.h"
 #include "olap/segment_loader.h"
@@ -51,9 +54,11 @@
 #include "runtime/broker_mgr.h"
 #include "runtime/cache/result_cache.h"
 #include "runtime/client_cache.h"
+#include "runtime/descriptor_tbl_cache.h"
 #include "runtime/exec_env.h"
 #include "runtime/external_scan_context_mgr.h"
 #include "runtime/fragment_mgr.h"
+#include "runtime/group_commit_mgr.h"
 #include "runtime/heartbeat_flags.h"
 #include "runtime/load_channel_mgr.h"
 #include "runtime/load_path_mgr.h"
@@ -63,6 +68,7 @@
 #include "runtime/memory/thread_mem_tracker_mgr.h"
 #include "runtime/result_buffer_mgr.h"
 #include "runtime/result_queue_mgr.h"
+#include "runtime/runtime_filter_cache.h"
 #include "runtime/routine_load/routine_load_task_executor.h"
 #include "runtime/small_file_mgr.h"
 #include "runtime/stream_load/new_load_stream_mgr.h"
@@ -73,6 +79,7 @@
 #include "util/bit_util.h"
 #include "util/brpc_client_cache.h"
 #include "util/cpu_info.h"
+#include "util/cpu_sampler.h"
 #include "util/doris_metrics.h"
 #include "util/mem_info.h"
 #include "util/metrics.h"
@@ -146,6 +153,16 @@ Status ExecEnv::_init(const std::vector<StorePath>& store_paths) {
             .set_max_threads(64)
             .build(&_buffered_reader_prefetch_thread_pool);
 
+    ThreadPoolBuilder("S3FileUploadThreadPool")
+            .set_min_threads(16)
+            .set_max_threads(std::max(16, config::s3_file_upload_thread_num))
+            .build(&_s3_file_upload_thread_pool);
+
+    ThreadPoolBuilder("SnapshotUploadThreadPool")
+            .set_min_threads(1)
+            .set_max_threads(config::snapshot_upload_max_thread)
+            .build(&_snapshot_upload_thread_pool);
+
     // min num equal to fragment pool's min num
     // max num is useless because it will start as many as requested in the past
     // queue size is useless because the max thread num is very large
@@ -169,16 +186,24 @@ Status ExecEnv::_init(const std::vector<StorePath>& store_paths) {
     _master_info = new TMasterInfo();
     _load_path_mgr = new LoadPathMgr(this);
     _bfd_parser = BfdParser::create();
+    if (config::enable_cpu_sampler) {
+        Status st = CpuSampler::instance()->start(config::cpu_sampler_frequency, _bfd_parser);
+        if (!st.ok()) {
+            LOG(WARNING) << "failed to start cpu sampler: " << st;
+        }
+    }
     _broker_mgr = new BrokerMgr(this);
     _load_channel_mgr = new LoadChannelMgr();
     _new_load_stream_mgr = NewLoadStreamMgr::create_shared();
     _internal_client_cache = new BrpcClientCache<PBackendService_Stub>();
     _function_client_cache = new BrpcClientCache<PFunctionService_Stub>();
     _stream_load_executor = StreamLoadExecutor::create_shared(this);
+    _group_commit_mgr = new GroupCommitMgr(this);
     _routine_load_task_executor = new RoutineLoadTaskExecutor(this);
     _small_file_mgr = new SmallFileMgr(this, config::small_file_dir);
     _block_spill_mgr = new BlockSpillManager(_store_paths);
-    _file_meta_cache = new FileMetaCache(config::max_external_file_meta_cache_num);
+    _file_meta_cache = new FileMetaCache(config::max_external_file_meta_cache_bytes,
+                                         config::max_external_file_meta_cache_num);
 
     _backend_client_cache->init_metrics("backend");
     _frontend_client_cache->init_metrics("frontend");
@@ -191,6 +216,11 @@ Status ExecEnv::_init(const std::vector<StorePath>& store_paths) {
     }
     _broker_mgr->init();
     _small_file_mgr->init();
+    status = _group_commit_mgr->init();
+    if (!status.ok()) {
+        LOG(ERROR) << "group commit mgr init failed." << status;
+        exit(-1);
+    }
     _scanner_scheduler->init(this);
 
     _init_mem_env();
@@ -291,6 +321,18 @@ Status ExecEnv::_init_mem_env() {
               << PrettyPrinter::print(storage_cache_limit, TUnit::BYTES)
               << ", origin config value: " << config::storage_page_cache_limit;
 
+    int64_t bloom_filter_page_cache_limit =
+            ParseUtil::parse_mem_spec(config::bloom_filter_page_cache_limit, MemInfo::mem_limit(),
+                                      MemInfo::physical_mem(), &is_percent);
+    while (!is_percent && bloom_filter_page_cache_limit > MemInfo::mem_limit() / 2) {
+        bloom_filter_page_cache_limit = bloom_filter_page_cache_limit / 2;
+    }
+    segment_v2::BloomFilterPageCache::create_global_cache(bloom_filter_page_cache_limit,
+                                                          num_shards);
+    LOG(INFO) << "Bloom filter page cache memory limit: "
+              << PrettyPrinter::print(bloom_filter_page_cache_limit, TUnit::BYTES)
+              << ", origin config value: " << config::bloom_filter_page_cache_limit;
+
     // Init row cache
     int64_t row_cache_mem_limit =
             ParseUtil::parse_mem_spec(config::row_cache_mem_limit, MemInfo::mem_limit(),
@@ -304,6 +346,22 @@ Status ExecEnv::_init_mem_env() {
               << PrettyPrinter::print(row_cache_mem_limit, TUnit::BYTES)
               << ", origin config value: " << config::row_cache_mem_limit;
 
+    RuntimeFilterCache::create_global_cache(config::runtime_filter_cache_capacity);
+
+    int64_t merged_agg_block_cache_limit =
+            ParseUtil::parse_mem_spec(config::merged_agg_block_cache_limit, MemInfo::mem_limit(),
+                                      MemInfo::physical_mem(), &is_percent);
+    while (!is_percent && merged_agg_block_cache_limit > MemInfo::mem_limit() / 2) {
+        // Reason same as buffer_pool_limit
+        merged_agg_block_cache_limit = merged_agg_block_cache_limit / 2;
+    }
+    MergedAggBlockCache::create_global_cache(merged_agg_block_cache_limit);
+    LOG(INFO) << "Merged agg block cache memory limit: "
+              << PrettyPrinter::print(merged_agg_block_cache_limit, TUnit::BYTES)
+              << ", origin config value: " << config::merged_agg_block_cache_limit;
+
+    DescriptorTblCache::create_global_cache(config::descriptor_tbl_cache_capacity);
+
     uint64_t fd_number = config::min_file_descriptor_number;
     struct rlimit l;
     int ret = getrlimit(RLIMIT_NOFILE, &l);
@@ -348,6 +406,19 @@ Status ExecEnv::_init_mem_env() {
               << PrettyPrinter::print(inverted_index_cache_limit, TUnit::BYTES)
               << ", origin config value: " << config::inverted_index_query_cache_limit;
 
+    // use memory limit
+    int64_t inverted_index_term_cache_limit =
+            ParseUtil::parse_mem_spec(config::inverted_index_term_cache_limit,
+                                      MemInfo::mem_limit(), MemInfo::physical_mem(), &is_percent);
+    while (!is_percent && inverted_index_term_cache_limit > MemInfo::mem_limit() / 2) {
+        // Reason same as buffer_pool_limit
+        inverted_index_term_cache_limit = inverted_index_term_cache_limit / 2;
+    }
+    InvertedIndexTermCache::create_global_cache(inverted_index_term_cache_limit);
+    LOG(INFO) << "Inverted index term cache memory limit: "
+              << PrettyPrinter::print(inverted_index_term_cache_limit, TUnit::BYTES)
+              << ", origin config value: " << config::inverted_index_term_cache_limit;
+
     // 4. init other managers
     RETURN_IF_ERROR(_block_spill_mgr->init());
 
@@ -427,10 +498,13 @@ void ExecEnv::_destroy() {
         return;
     }
     _deregister_metrics();
+    // stop committing the batches before the fragments and the clients are destroyed
+    SAFE_DELETE(_group_commit_mgr);
     SAFE_DELETE(_internal_client_cache);
     SAFE_DELETE(_function_client_cache);
     SAFE_DELETE(_load_channel_mgr);
     SAFE_DELETE(_broker_mgr);
+    CpuSampler::instance()->stop();
     SAFE_DELETE(_bfd_parser);
     SAFE_DELETE(_load_path_mgr);
     SAFE_DELETE(_pipeline_task_scheduler);
@@ -455,6 +529,8 @@ void ExecEnv::_destroy() {
     _new_load_stream_mgr.reset();
     _send_batch_thread_pool.reset(nullptr);
     _buffered_reader_prefetch_thread_pool.reset(nullptr);
+    _s3_file_upload_thread_pool.reset(nullptr);
+    _snapshot_upload_thread_pool.reset(nullptr);
     _send_report_thread_pool.reset(nullptr);
     _join_node_thread_pool.reset(nullptr);
     _serial_download_cache_thread_token.reset(nullptr);
@@ -57,6 +57,7 @@
 #include "opentelemetry/trace/scope.h"
 #include "pipeline/pipeline_fragment_context.h"
 #include "runtime/client_cache.h"
+#include "runtime/descriptor_tbl_cache.h"
 #include "runtime/descriptors.h"
 #include "runtime/exec_env.h"
 #include "runtime/memory/mem_tracker_limiter.h"
@@ -670,8 +671,14 @@ Status FragmentMgr::_get_query_ctx(const Params& params, TUniqueId query_id, boo
         query_ctx = QueryContext::create_shared(params.fragment_num_on_host, _exec_env,
                                                 params.query_options);
         query_ctx->query_id = query_id;
-        RETURN_IF_ERROR(DescriptorTbl::create(&(query_ctx->obj_pool), params.desc_tbl,
-                                              &(query_ctx->desc_tbl)));
+        if (config::enable_descriptor_tbl_cache) {
+            RETURN_IF_ERROR(DescriptorTblCache::instance()->get_or_create(
+                    params.desc_tbl, &query_ctx->cached_desc_tbl));
+            query_ctx->desc_tbl = query_ctx->cached_desc_tbl->tbl;
+        } else {
+            RETURN_IF_ERROR(DescriptorTbl::create(&(query_ctx->obj_pool), params.desc_tbl,
+                                                  &(query_ctx->desc_tbl)));
+        }
         query_ctx->coord_addr = params.coord;
         LOG(INFO) << "query_id: " << UniqueId(query_ctx->query_id.hi, query_ctx->query_id.lo)
                   << " coord_addr " << query_ctx->coord_addr
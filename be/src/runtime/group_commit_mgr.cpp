@@ -0,0 +1,467 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+
+#include "runtime/group_commit_mgr.h"
+
+#include <errno.h>
+#include <fcntl.h>
+#include <gen_cpp/FrontendService.h>
+#include <gen_cpp/HeartbeatService_types.h>
+#include <thrift/protocol/TDebugProtocol.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+#include <utility>
+
+#include "common/config.h"
+#include "common/logging.h"
+#include "io/fs/local_file_system.h"
+#include "io/fs/stream_load_pipe.h"
+#include "runtime/client_cache.h"
+#include "runtime/exec_env.h"
+#include "runtime/stream_load/new_load_stream_mgr.h"
+#include "runtime/stream_load/stream_load_context.h"
+#include "runtime/stream_load/stream_load_executor.h"
+#include "util/coding.h"
+#include "util/defer_op.h"
+#include "util/thread.h"
+#include "util/threadpool.h"
+#include "util/thrift_rpc_helper.h"
+#include "util/thrift_util.h"
+#include "util/time.h"
+#include "util/uid_util.h"
+
+namespace doris {
+using namespace ErrorCode;
+
+static const std::string WAL_SUFFIX = ".wal";
+static const std::string FAILED_WAL_SUFFIX = ".failed";
+
+GroupCommitMgr::Batch::~Batch() {
+    if (fd >= 0) {
+        ::close(fd);
+    }
+}
+
+int64_t GroupCommitMgr::Table::queued_bytes() const {
+    int64_t bytes = current == nullptr ? 0 : current->bytes;
+    for (auto& batch : sealed) {
+        bytes += batch->bytes;
+    }
+    return bytes;
+}
+
+GroupCommitMgr::GroupCommitMgr(ExecEnv* exec_env) : _exec_env(exec_env), _stop_latch(1) {}
+
+GroupCommitMgr::~GroupCommitMgr() {
+    stop();
+}
+
+Status GroupCommitMgr::init() {
+    RETURN_IF_ERROR(io::global_local_filesystem()->create_directory(config::group_commit_wal_dir));
+    RETURN_IF_ERROR(ThreadPoolBuilder("GroupCommitThreadPool")
+                            .set_min_threads(1)
+                            .set_max_threads(std::max(1, config::group_commit_thread_num))
+                            .build(&_commit_pool));
+    RETURN_IF_ERROR(_recover());
+    return Thread::create(
+            "GroupCommitMgr", "schedule_group_commits",
+            [this]() {
+                while (!_stop_latch.wait_for(std::chrono::milliseconds(
+                        std::max(10, config::group_commit_interval_ms / 4)))) {
+                    _schedule_commits();
+                }
+            },
+            &_schedule_thread);
+}
+
+void GroupCommitMgr::stop() {
+    if (_stop_latch.count() == 0) {
+        return;
+    }
+    _stop_latch.count_down();
+    if (_schedule_thread) {
+        _schedule_thread->join();
+    }
+    if (_commit_pool) {
+        _commit_pool->shutdown();
+    }
+}
+
+std::string GroupCommitMgr::_table_key(const TStreamLoadPutRequest& request) {
+    return apache::thrift::ThriftDebugString(request);
+}
+
+Status GroupCommitMgr::append(StreamLoadContext* ctx, TStreamLoadPutRequest request,
+                              std::string body) {
+    // the loads of a batch differ only in these fields
+    request.user.clear();
+    request.passwd.clear();
+    request.__isset.user_ip = false;
+    request.user_ip.clear();
+    request.__isset.auth_code = false;
+    request.__isset.token = false;
+    request.token.clear();
+    request.txnId = -1;
+    request.__isset.loadId = false;
+    std::string line_delimiter = request.__isset.line_delimiter ? request.line_delimiter : "\n";
+    if (body.size() < line_delimiter.size() ||
+        body.compare(body.size() - line_delimiter.size(), line_delimiter.size(),
+                     line_delimiter) != 0) {
+        body.append(line_delimiter);
+    }
+    std::string key = _table_key(request);
+
+    std::unique_lock l(_lock);
+    TableSPtr& table = _tables[key];
+    if (table == nullptr) {
+        table = std::make_shared<Table>();
+        table->request = std::move(request);
+    }
+    table->auth = ctx->auth;
+    table->has_auth = true;
+    table->last_append_time_ms = MonotonicMillis();
+    if (table->current == nullptr) {
+        if (table->queued_bytes() >= 2 * config::group_commit_max_batch_bytes) {
+            return Status::TooManyTasks(
+                    "too many data of table {} waiting to be group committed, retry later",
+                    table->request.tbl);
+        }
+        RETURN_IF_ERROR(_create_batch(table.get()));
+    }
+    BatchSPtr batch = table->current;
+    Status st = _write_wal(batch.get(), body);
+    if (!st.ok()) {
+        batch->wal_status = st;
+        _seal(table.get());
+        return st;
+    }
+    batch->bytes += body.size();
+    batch->bodies.push_back(std::move(body));
+    uint64_t seq = ++batch->written_seq;
+    ctx->group_commit_label = batch->label();
+    if (batch->bytes >= config::group_commit_max_batch_bytes) {
+        _seal(table.get());
+    }
+
+    // the first waiter syncs the loads written by all the waiters
+    while (batch->synced_seq < seq && batch->wal_status.ok()) {
+        if (batch->syncing) {
+            _sync_cv.wait(l);
+            continue;
+        }
+        batch->syncing = true;
+        uint64_t target_seq = batch->written_seq;
+        l.unlock();
+        int res = ::fdatasync(batch->fd);
+        l.lock();
+        batch->syncing = false;
+        if (res == 0) {
+            batch->synced_seq = target_seq;
+        } else {
+            batch->wal_status = Status::IOError("failed to sync {}: {}", batch->path,
+                                                std::strerror(errno));
+        }
+        _sync_cv.notify_all();
+    }
+    return batch->wal_status;
+}
+
+Status GroupCommitMgr::_create_batch(Table* table) {
+    auto batch = std::make_shared<Batch>();
+    batch->id = generate_uuid_string();
+    batch->path = config::group_commit_wal_dir + "/" + batch->id + WAL_SUFFIX;
+    batch->create_time_ms = MonotonicMillis();
+    batch->fd = ::open(batch->path.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+    if (batch->fd < 0) {
+        return Status::IOError("failed to create {}: {}", batch->path, std::strerror(errno));
+    }
+    // the first record is the put request, synced with the first load
+    ThriftSerializer serializer(false, 1024);
+    std::vector<uint8_t> buf;
+    RETURN_IF_ERROR(serializer.serialize(&table->request, &buf));
+    RETURN_IF_ERROR(_write_wal(batch.get(), std::string(buf.begin(), buf.end())));
+    int dir_fd = ::open(config::group_commit_wal_dir.c_str(), O_RDONLY | O_CLOEXEC);
+    if (dir_fd >= 0) {
+        ::fsync(dir_fd);
+        ::close(dir_fd);
+    }
+    table->current = std::move(batch);
+    return Status::OK();
+}
+
+Status GroupCommitMgr::_write_wal(Batch* batch, const std::string& record) {
+    uint8_t size_buf[sizeof(uint32_t)];
+    encode_fixed32_le(size_buf, record.size());
+    std::string buf(reinterpret_cast<char*>(size_buf), sizeof(size_buf));
+    buf.append(record);
+    size_t written = 0;
+    while (written < buf.size()) {
+        ssize_t res = ::write(batch->fd, buf.data() + written, buf.size() - written);
+        if (res < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            return Status::IOError("failed to write {}: {}", batch->path, std::strerror(errno));
+        }
+        written += res;
+    }
+    return Status::OK();
+}
+
+void GroupCommitMgr::_seal(Table* table) {
+    if (table->current != nullptr) {
+        table->sealed.push_back(std::move(table->current));
+        table->current = nullptr;
+    }
+}
+
+Status GroupCommitMgr::_recover() {
+    std::vector<io::FileInfo> files;
+    bool exists = false;
+    RETURN_IF_ERROR(io::global_local_filesystem()->list(config::group_commit_wal_dir, true,
+                                                        &files, &exists));
+    std::lock_guard l(_lock);
+    for (auto& file : files) {
+        const std::string& name = file.file_name;
+        if (name.size() <= WAL_SUFFIX.size() ||
+            name.compare(name.size() - WAL_SUFFIX.size(), WAL_SUFFIX.size(), WAL_SUFFIX) != 0) {
+            continue;
+        }
+        auto batch = std::make_shared<Batch>();
+        batch->id = name.substr(0, name.size() - WAL_SUFFIX.size());
+        batch->path = config::group_commit_wal_dir + "/" + name;
+        TStreamLoadPutRequest request;
+        Status st = _read_wal(batch->path, &request, batch.get());
+        if (!st.ok()) {
+            LOG(WARNING) << "failed to recover group commit wal " << batch->path << ": " << st;
+            continue;
+        }
+        if (batch->bodies.empty()) {
+            static_cast<void>(io::global_local_filesystem()->delete_file(batch->path));
+            continue;
+        }
+        LOG(INFO) << "recover group commit wal " << batch->path << ", table=" << request.db
+                  << "." << request.tbl << ", loads=" << batch->bodies.size()
+                  << ", bytes=" << batch->bytes;
+        TableSPtr& table = _tables[_table_key(request)];
+        if (table == nullptr) {
+            table = std::make_shared<Table>();
+            table->request = std::move(request);
+            table->last_append_time_ms = MonotonicMillis();
+        }
+        table->sealed.push_back(std::move(batch));
+    }
+    return Status::OK();
+}
+
+Status GroupCommitMgr::_read_wal(const std::string& path, TStreamLoadPutRequest* request,
+                                 Batch* batch) {
+    std::ifstream in(path, std::ios::binary);
+    if (!in) {
+        return Status::IOError("failed to open {}", path);
+    }
+    std::stringstream ss;
+    ss << in.rdbuf();
+    std::string data = ss.str();
+    size_t pos = 0;
+    bool has_request = false;
+    // a record partially written before a crash is not acknowledged, so it is dropped
+    while (pos + sizeof(uint32_t) <= data.size()) {
+        uint32_t size = decode_fixed32_le(reinterpret_cast<const uint8_t*>(data.data() + pos));
+        pos += sizeof(uint32_t);
+        if (pos + size > data.size()) {
+            break;
+        }
+        if (!has_request) {
+            uint32_t len = size;
+            RETURN_IF_ERROR(deserialize_thrift_msg(
+                    reinterpret_cast<const uint8_t*>(data.data() + pos), &len, false, request));
+            has_request = true;
+        } else {
+            batch->bodies.emplace_back(data, pos, size);
+            batch->bytes += size;
+        }
+        pos += size;
+    }
+    if (!has_request) {
+        return Status::Corruption("no put request in {}", path);
+    }
+    return Status::OK();
+}
+
+void GroupCommitMgr::_schedule_commits() {
+    std::lock_guard l(_lock);
+    int64_t now = MonotonicMillis();
+    for (auto it = _tables.begin(); it != _tables.end();) {
+        TableSPtr table = it->second;
+        if (table->current != nullptr &&
+            now - table->current->create_time_ms >= config::group_commit_interval_ms) {
+            _seal(table.get());
+        }
+        if (table->current == nullptr && table->sealed.empty() && !table->committing &&
+            now - table->last_append_time_ms >= 10 * config::group_commit_interval_ms) {
+            it = _tables.erase(it);
+            continue;
+        }
+        ++it;
+        if (table->committing || table->sealed.empty() || !table->has_auth) {
+            continue;
+        }
+        BatchSPtr batch = table->sealed.front();
+        // the loads whose sync failed are committed too, as they can not be told apart from
+        // the synced ones in the wal
+        if (batch->syncing || (batch->synced_seq < batch->written_seq && batch->wal_status.ok()) ||
+            now < batch->next_commit_time_ms) {
+            continue;
+        }
+        table->committing = true;
+        Status st = _commit_pool->submit_func([this, table, batch]() { _commit(table, batch); });
+        if (!st.ok()) {
+            table->committing = false;
+            LOG(WARNING) << "failed to submit group commit of " << batch->label() << ": " << st;
+        }
+    }
+}
+
+void GroupCommitMgr::_commit(TableSPtr table, BatchSPtr batch) {
+    AuthInfo auth;
+    TStreamLoadPutRequest request;
+    {
+        std::lock_guard l(_lock);
+        auth = table->auth;
+        request = table->request;
+    }
+    Status st = _load_batch(*batch, auth, std::move(request));
+
+    std::lock_guard l(_lock);
+    table->committing = false;
+    if (st.ok()) {
+        table->sealed.pop_front();
+        static_cast<void>(io::global_local_filesystem()->delete_file(batch->path));
+        return;
+    }
+    if (++batch->retries < config::group_commit_max_retries) {
+        LOG(WARNING) << "failed to group commit " << batch->label() << ", retries="
+                     << batch->retries << ": " << st;
+        batch->next_commit_time_ms =
+                MonotonicMillis() + batch->retries * config::group_commit_interval_ms;
+        return;
+    }
+    LOG(WARNING) << "give up group commit " << batch->label() << ", the wal is kept in "
+                 << batch->path << FAILED_WAL_SUFFIX << ": " << st;
+    table->sealed.pop_front();
+    static_cast<void>(io::global_local_filesystem()->rename(batch->path,
+                                                            batch->path + FAILED_WAL_SUFFIX));
+}
+
+Status GroupCommitMgr::_load_batch(const Batch& batch, const AuthInfo& auth,
+                                   TStreamLoadPutRequest request) {
+    auto ctx = std::make_shared<StreamLoadContext>(_exec_env);
+    ctx->load_type = TLoadType::MANUL_LOAD;
+    ctx->load_src_type = TLoadSourceType::RAW;
+    ctx->db = request.db;
+    ctx->table = request.tbl;
+    ctx->label = batch.label();
+    ctx->auth = auth;
+    ctx->format = request.formatType;
+    ctx->compress_type = request.compress_type;
+    ctx->use_streaming = true;
+    ctx->body_bytes = batch.bytes;
+    ctx->receive_bytes = batch.bytes;
+    if (request.__isset.timeout) {
+        ctx->timeout_second = request.timeout;
+    }
+    if (request.__isset.max_filter_ratio) {
+        ctx->max_filter_ratio = request.max_filter_ratio;
+    }
+
+    Status st = _exec_env->stream_load_executor()->begin_txn(ctx.get());
+    if (st.is<LABEL_ALREADY_EXISTS>() && ctx->existing_job_status == "FINISHED") {
+        // committed before a restart, or the reply of the commit is lost
+        LOG(INFO) << "group commit " << batch.label() << " is already committed";
+        return Status::OK();
+    }
+    RETURN_IF_ERROR(st);
+    st = _execute(ctx, batch, std::move(request));
+    if (!st.ok() && ctx->need_rollback) {
+        ctx->status = st;
+        _exec_env->stream_load_executor()->rollback_txn(ctx.get());
+        ctx->need_rollback = false;
+    }
+    return st;
+}
+
+Status GroupCommitMgr::_execute(std::shared_ptr<StreamLoadContext> ctx, const Batch& batch,
+                                TStreamLoadPutRequest request) {
+    set_request_auth(&request, ctx->auth);
+    request.txnId = ctx->txn_id;
+    request.__set_loadId(ctx->id.to_thrift());
+    request.fileType = TFileType::FILE_STREAM;
+    request.__set_thrift_rpc_timeout_ms(config::thrift_rpc_timeout_ms);
+    auto pipe = std::make_shared<io::StreamLoadPipe>(
+            io::kMaxPipeBufferedBytes /* max_buffered_bytes */, 64 * 1024 /* min_chunk_size */,
+            ctx->body_bytes /* total_length */, false, ctx->id);
+    ctx->body_sink = pipe;
+    ctx->pipe = pipe;
+    RETURN_IF_ERROR(_exec_env->new_load_stream_mgr()->put(ctx->id, ctx));
+    Defer defer {[&]() { _exec_env->new_load_stream_mgr()->remove(ctx->id); }};
+
+    TNetworkAddress master_addr = _exec_env->master_info()->network_address;
+    RETURN_IF_ERROR(ThriftRpcHelper::rpc<FrontendServiceClient>(
+            master_addr.hostname, master_addr.port,
+            [&request, ctx](FrontendServiceConnection& client) {
+                client->streamLoadPut(ctx->put_result, request);
+            }));
+    Status plan_status(ctx->put_result.status);
+    if (!plan_status.ok()) {
+        return plan_status;
+    }
+    RETURN_IF_ERROR(_exec_env->stream_load_executor()->execute_plan_fragment(ctx));
+
+    Status st;
+    for (auto& body : batch.bodies) {
+        st = pipe->append(body.data(), body.size());
+        if (!st.ok()) {
+            break;
+        }
+    }
+    if (st.ok()) {
+        st = pipe->finish();
+    } else {
+        pipe->cancel(st.to_string());
+    }
+    RETURN_IF_ERROR(ctx->future.get());
+    RETURN_IF_ERROR(st);
+
+    st = _exec_env->stream_load_executor()->commit_txn(ctx.get());
+    if (!st.ok() && !st.is<PUBLISH_TIMEOUT>()) {
+        return st;
+    }
+    LOG(INFO) << "group commit " << batch.label() << ", txn_id=" << ctx->txn_id
+              << ", table=" << ctx->db << "." << ctx->table << ", loads=" << batch.bodies.size()
+              << ", bytes=" << batch.bytes << ", loaded_rows=" << ctx->number_loaded_rows
+              << ", filtered_rows=" << ctx->number_filtered_rows;
+    return Status::OK();
+}
+
+} // namespace doris
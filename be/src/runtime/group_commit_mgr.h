@@ -0,0 +1,128 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+
+#pragma once
+
+#include <gen_cpp/FrontendService_types.h>
+#include <stdint.h>
+
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "common/status.h"
+#include "common/utils.h"
+#include "gutil/ref_counted.h"
+#include "util/countdown_latch.h"
+
+namespace doris {
+
+class ExecEnv;
+class StreamLoadContext;
+class Thread;
+class ThreadPool;
+
+// Group commit merges the small stream loads of a table into batches, each committed as one
+// transaction and so one rowset per tablet, instead of a transaction and a rowset per load.
+//
+// The loads with the same put request, except the auth and the ids, are appended to the batch
+// of their table. A load is acknowledged once it is synced to the write-ahead log of its batch,
+// and the concurrent loads share one fdatasync. A batch is committed by a background thread
+// every config::group_commit_interval_ms, as a stream load from the BE itself with the label
+// group_commit_<batch id>, so that a batch committed before a restart is not loaded again.
+//
+// The write-ahead log of a batch is removed after it is committed. The logs left by the last run
+// are loaded again, with the credentials of the next load of the same table, which are never
+// written into the logs.
+class GroupCommitMgr {
+public:
+    GroupCommitMgr(ExecEnv* exec_env);
+    ~GroupCommitMgr();
+
+    Status init();
+    void stop();
+
+    // Appends the body of a load to the batch of its table and syncs it to the write-ahead log,
+    // sets the label of the batch in ctx.
+    Status append(StreamLoadContext* ctx, TStreamLoadPutRequest request, std::string body);
+
+private:
+    struct Batch {
+        std::string id;
+        std::string path;
+        int fd = -1;
+        std::vector<std::string> bodies;
+        int64_t bytes = 0;
+        int64_t create_time_ms = 0;
+        // the loads written to the wal and synced
+        uint64_t written_seq = 0;
+        uint64_t synced_seq = 0;
+        bool syncing = false;
+        Status wal_status;
+        int retries = 0;
+        int64_t next_commit_time_ms = 0;
+
+        std::string label() const { return "group_commit_" + id; }
+        ~Batch();
+    };
+    using BatchSPtr = std::shared_ptr<Batch>;
+
+    struct Table {
+        TStreamLoadPutRequest request;
+        // the batches are committed with the credentials of the last load of the table
+        AuthInfo auth;
+        bool has_auth = false;
+        BatchSPtr current;
+        // committed in order, the first one may be being committed
+        std::deque<BatchSPtr> sealed;
+        bool committing = false;
+        int64_t last_append_time_ms = 0;
+
+        int64_t queued_bytes() const;
+    };
+    using TableSPtr = std::shared_ptr<Table>;
+
+    static std::string _table_key(const TStreamLoadPutRequest& request);
+    Status _create_batch(Table* table);
+    Status _write_wal(Batch* batch, const std::string& record);
+    void _seal(Table* table);
+    Status _recover();
+    Status _read_wal(const std::string& path, TStreamLoadPutRequest* request, Batch* batch);
+
+    void _schedule_commits();
+    void _commit(TableSPtr table, BatchSPtr batch);
+    Status _load_batch(const Batch& batch, const AuthInfo& auth, TStreamLoadPutRequest request);
+    Status _execute(std::shared_ptr<StreamLoadContext> ctx, const Batch& batch,
+                    TStreamLoadPutRequest request);
+
+    ExecEnv* _exec_env;
+
+    std::mutex _lock;
+    std::condition_variable _sync_cv;
+    std::unordered_map<std::string, TableSPtr> _tables;
+
+    std::unique_ptr<ThreadPool> _commit_pool;
+    CountDownLatch _stop_latch;
+    scoped_refptr<Thread> _schedule_thread;
+};
+
+} // namespace doris
@@ -75,6 +75,15 @@ public:
 
     const UniqueId& load_id() const { return _load_id; }
 
+    const std::string& sender_ip() const { return _sender_ip; }
+
+    void get_stats(TabletsChannelStats* stats) {
+        std::lock_guard<SpinLock> l(_tablets_channels_lock);
+        for (auto& it : _tablets_channels) {
+            it.second->add_stats(stats);
+        }
+    }
+
     int64_t mem_consumption() {
         int64_t mem_usage = 0;
         {
@@ -87,6 +96,15 @@ public:
         return mem_usage;
     }
 
+    int64_t write_mem_consumption() {
+        int64_t mem_usage = 0;
+        std::lock_guard<SpinLock> l(_tablets_channels_lock);
+        for (auto& it : _tablets_channels) {
+            mem_usage += it.second->write_mem_consumption();
+        }
+        return mem_usage;
+    }
+
     void get_writers_mem_consumption_snapshot(
             std::vector<std::pair<int64_t, std::multimap<int64_t, int64_t, std::greater<int64_t>>>>*
                     writers_mem_snap) {
@@ -304,6 +304,103 @@ Status LoadChannelMgr::_start_load_channels_clean() {
     return Status::OK();
 }
 
+int64_t LoadChannelMgr::_pick_writers_to_reduce_mem(
+        int64_t mem_to_flush, std::vector<WriterToReduceMem>* writers_to_reduce_mem) {
+    // tuple<LoadChannel, index_id, multimap<mem size, tablet_id>>
+    using WritersMem = std::tuple<std::shared_ptr<LoadChannel>, int64_t,
+                                  std::multimap<int64_t, int64_t, std::greater<int64_t>>>;
+    std::vector<WritersMem> all_writers_mem;
+
+    // tuple<current iterator in multimap, end iterator in multimap, pos in all_writers_mem>
+    using WriterMemItem =
+            std::tuple<std::multimap<int64_t, int64_t, std::greater<int64_t>>::iterator,
+                       std::multimap<int64_t, int64_t, std::greater<int64_t>>::iterator,
+                       size_t>;
+    auto cmp = [](WriterMemItem& lhs, WriterMemItem& rhs) {
+        return std::get<0>(lhs)->first < std::get<0>(rhs)->first;
+    };
+    std::priority_queue<WriterMemItem, std::vector<WriterMemItem>, decltype(cmp)>
+            tablets_mem_heap(cmp);
+
+    for (auto& kv : _load_channels) {
+        if (kv.second->is_high_priority()) {
+            // do not select high priority channel to reduce memory
+            // to avoid blocking them.
+            continue;
+        }
+        std::vector<std::pair<int64_t, std::multimap<int64_t, int64_t, std::greater<int64_t>>>>
+                writers_mem_snap;
+        kv.second->get_writers_mem_consumption_snapshot(&writers_mem_snap);
+        for (auto item : writers_mem_snap) {
+            // multimap is empty
+            if (item.second.empty()) {
+                continue;
+            }
+            all_writers_mem.emplace_back(kv.second, item.first, std::move(item.second));
+            size_t pos = all_writers_mem.size() - 1;
+            tablets_mem_heap.emplace(std::get<2>(all_writers_mem[pos]).begin(),
+                                     std::get<2>(all_writers_mem[pos]).end(), pos);
+        }
+    }
+
+    int64_t mem_consumption_in_picked_writer = 0;
+    while (!tablets_mem_heap.empty()) {
+        WriterMemItem tablet_mem_item = tablets_mem_heap.top();
+        size_t pos = std::get<2>(tablet_mem_item);
+        auto load_channel = std::get<0>(all_writers_mem[pos]);
+        int64_t index_id = std::get<1>(all_writers_mem[pos]);
+        int64_t tablet_id = std::get<0>(tablet_mem_item)->second;
+        int64_t mem_size = std::get<0>(tablet_mem_item)->first;
+        writers_to_reduce_mem->emplace_back(load_channel, index_id, tablet_id, mem_size);
+        load_channel->flush_memtable_async(index_id, tablet_id);
+        mem_consumption_in_picked_writer += std::get<0>(tablet_mem_item)->first;
+        if (mem_consumption_in_picked_writer > mem_to_flush) {
+            break;
+        }
+        tablets_mem_heap.pop();
+        if (std::get<0>(tablet_mem_item)++ != std::get<1>(tablet_mem_item)) {
+            tablets_mem_heap.push(tablet_mem_item);
+        }
+    }
+    return mem_consumption_in_picked_writer;
+}
+
+void LoadChannelMgr::_flush_proactively_if_necessary() {
+    int64_t proactive_limit =
+            _load_hard_mem_limit * config::load_process_proactive_flush_mem_limit_percent / 100;
+    if (proactive_limit <= 0 || _mem_tracker->consumption() < proactive_limit) {
+        return;
+    }
+    // do not block the load if other thread is reducing memory
+    std::unique_lock<std::mutex> l(_lock, std::try_to_lock);
+    if (!l.owns_lock() || _should_wait_flush || _soft_reduce_mem_in_progress) {
+        return;
+    }
+    // The memory of memtables being flushed will be freed soon, only flush the memtables
+    // being written if the consumption is still above the limit after that.
+    int64_t write_mem = 0;
+    for (auto& kv : _load_channels) {
+        if (kv.second->is_high_priority()) {
+            continue;
+        }
+        write_mem += kv.second->write_mem_consumption();
+    }
+    int64_t mem_to_flush = write_mem - proactive_limit;
+    if (mem_to_flush <= 0) {
+        return;
+    }
+    std::vector<WriterToReduceMem> writers_to_reduce_mem;
+    int64_t picked_mem = _pick_writers_to_reduce_mem(mem_to_flush, &writers_to_reduce_mem);
+    DorisMetrics::instance()->load_mem_proactive_flush_total->increment(
+            writers_to_reduce_mem.size());
+    DorisMetrics::instance()->load_mem_flush_picked_bytes->increment(picked_mem);
+    VLOG_NOTICE << "proactively flush " << writers_to_reduce_mem.size()
+                << " memtables, total mem: " << PrettyPrinter::print_bytes(picked_mem)
+                << ", load mem consumption: "
+                << PrettyPrinter::print_bytes(_mem_tracker->consumption())
+                << ", proactive flush limit: " << PrettyPrinter::print_bytes(proactive_limit);
+}
+
 void LoadChannelMgr::_handle_mem_exceed_limit() {
     // Check the soft limit.
     DCHECK(_load_soft_mem_limit > 0);
@@ -316,13 +413,12 @@ void LoadChannelMgr::_handle_mem_exceed_limit() {
             proc_mem_no_allocator_cache >= process_soft_mem_limit &&
             _mem_tracker->consumption() >= _load_hard_mem_limit / 10;
     if (_mem_tracker->consumption() < _load_soft_mem_limit && !reduce_on_process_soft_mem_limit) {
+        _flush_proactively_if_necessary();
         return;
     }
     // Indicate whether current thread is reducing mem on hard limit.
     bool reducing_mem_on_hard_limit = false;
-    // tuple<LoadChannel, index_id, tablet_id, mem_size>
-    std::vector<std::tuple<std::shared_ptr<LoadChannel>, int64_t, int64_t, int64_t>>
-            writers_to_reduce_mem;
+    std::vector<WriterToReduceMem> writers_to_reduce_mem;
     {
         MonotonicStopWatch timer;
         timer.start();
@@ -341,64 +437,10 @@ void LoadChannelMgr::_handle_mem_exceed_limit() {
             return;
         }
 
-        // tuple<LoadChannel, index_id, multimap<mem size, tablet_id>>
-        using WritersMem = std::tuple<std::shared_ptr<LoadChannel>, int64_t,
-                                      std::multimap<int64_t, int64_t, std::greater<int64_t>>>;
-        std::vector<WritersMem> all_writers_mem;
-
-        // tuple<current iterator in multimap, end iterator in multimap, pos in all_writers_mem>
-        using WriterMemItem =
-                std::tuple<std::multimap<int64_t, int64_t, std::greater<int64_t>>::iterator,
-                           std::multimap<int64_t, int64_t, std::greater<int64_t>>::iterator,
-                           size_t>;
-        auto cmp = [](WriterMemItem& lhs, WriterMemItem& rhs) {
-            return std::get<0>(lhs)->first < std::get<0>(rhs)->first;
-        };
-        std::priority_queue<WriterMemItem, std::vector<WriterMemItem>, decltype(cmp)>
-                tablets_mem_heap(cmp);
-
-        for (auto& kv : _load_channels) {
-            if (kv.second->is_high_priority()) {
-                // do not select high priority channel to reduce memory
-                // to avoid blocking them.
-                continue;
-            }
-            std::vector<std::pair<int64_t, std::multimap<int64_t, int64_t, std::greater<int64_t>>>>
-                    writers_mem_snap;
-            kv.second->get_writers_mem_consumption_snapshot(&writers_mem_snap);
-            for (auto item : writers_mem_snap) {
-                // multimap is empty
-                if (item.second.empty()) {
-                    continue;
-                }
-                all_writers_mem.emplace_back(kv.second, item.first, std::move(item.second));
-                size_t pos = all_writers_mem.size() - 1;
-                tablets_mem_heap.emplace(std::get<2>(all_writers_mem[pos]).begin(),
-                                         std::get<2>(all_writers_mem[pos]).end(), pos);
-            }
-        }
-
         // reduce 1/10 memory every time
         int64_t mem_to_flushed = _mem_tracker->consumption() / 10;
-        int64_t mem_consumption_in_picked_writer = 0;
-        while (!tablets_mem_heap.empty()) {
-            WriterMemItem tablet_mem_item = tablets_mem_heap.top();
-            size_t pos = std::get<2>(tablet_mem_item);
-            auto load_channel = std::get<0>(all_writers_mem[pos]);
-            int64_t index_id = std::get<1>(all_writers_mem[pos]);
-            int64_t tablet_id = std::get<0>(tablet_mem_item)->second;
-            int64_t mem_size = std::get<0>(tablet_mem_item)->first;
-            writers_to_reduce_mem.emplace_back(load_channel, index_id, tablet_id, mem_size);
-            load_channel->flush_memtable_async(index_id, tablet_id);
-            mem_consumption_in_picked_writer += std::get<0>(tablet_mem_item)->first;
-            if (mem_consumption_in_picked_writer > mem_to_flushed) {
-                break;
-            }
-            tablets_mem_heap.pop();
-            if (std::get<0>(tablet_mem_item)++ != std::get<1>(tablet_mem_item)) {
-                tablets_mem_heap.push(tablet_mem_item);
-            }
-        }
+        int64_t mem_consumption_in_picked_writer =
+                _pick_writers_to_reduce_mem(mem_to_flushed, &writers_to_reduce_mem);
 
         if (writers_to_reduce_mem.empty()) {
             // should not happen, add log to observe
@@ -437,6 +479,12 @@ void LoadChannelMgr::_handle_mem_exceed_limit() {
                 << ", vm_rss: " << PerfCounters::get_vm_rss_str();
         }
         LOG(INFO) << oss.str();
+        auto* flush_counter = reducing_mem_on_hard_limit
+                                      ? DorisMetrics::instance()->load_mem_hard_limit_flush_total
+                                      : DorisMetrics::instance()->load_mem_soft_limit_flush_total;
+        flush_counter->increment(writers_to_reduce_mem.size());
+        DorisMetrics::instance()->load_mem_flush_picked_bytes->increment(
+                mem_consumption_in_picked_writer);
     }
 
     // wait all writers flush without lock
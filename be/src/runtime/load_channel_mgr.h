@@ -23,8 +23,10 @@
 #include <condition_variable>
 #include <memory>
 #include <mutex>
+#include <tuple>
 #include <unordered_map>
 #include <utility>
+#include <vector>
 // IWYU pragma: no_include <opentelemetry/common/threadlocal.h>
 #include "common/compiler_util.h" // IWYU pragma: keep
 #include "common/status.h"
@@ -68,6 +70,15 @@ public:
     }
     MemTrackerLimiter* mem_tracker() { return _mem_tracker.get(); }
 
+    std::vector<std::shared_ptr<LoadChannel>> get_load_channels() {
+        std::lock_guard<std::mutex> l(_lock);
+        std::vector<std::shared_ptr<LoadChannel>> channels;
+        for (auto& kv : _load_channels) {
+            channels.push_back(kv.second);
+        }
+        return channels;
+    }
+
 private:
     Status _get_load_channel(std::shared_ptr<LoadChannel>& channel, bool& is_eof,
                              const UniqueId& load_id, const PTabletWriterAddBlockRequest& request);
@@ -77,6 +88,17 @@ private:
     // If yes, it will pick a load channel to try to reduce memory consumption.
     void _handle_mem_exceed_limit();
 
+    // tuple<LoadChannel, index_id, tablet_id, mem_size>
+    using WriterToReduceMem = std::tuple<std::shared_ptr<LoadChannel>, int64_t, int64_t, int64_t>;
+    // Flush the memtables of the writers with the largest memtables being written until more
+    // than mem_to_flush memory is picked, return the memory picked. lock should be held.
+    int64_t _pick_writers_to_reduce_mem(int64_t mem_to_flush,
+                                        std::vector<WriterToReduceMem>* writers_to_reduce_mem);
+
+    // Flush the largest memtables without waiting when the load mem consumption exceeds
+    // the proactive flush limit, so that the soft limit is reached less often.
+    void _flush_proactively_if_necessary();
+
     Status _start_bg_worker();
 
     // lock should be held when calling this method
@@ -0,0 +1,81 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "runtime/memory/alloc_profile.h"
+
+#include <algorithm>
+#include <utility>
+
+#include "util/folded_stacks.h"
+
+namespace doris {
+
+void AllocProfile::record(int64_t bytes, void* const* frames, int depth) {
+    std::string key(reinterpret_cast<const char*>(frames),
+                    std::clamp(depth, 0, MAX_DEPTH) * sizeof(void*));
+    std::lock_guard l(_lock);
+    _sampled_bytes += bytes;
+    auto it = _stack_bytes.find(key);
+    if (it != _stack_bytes.end()) {
+        it->second += bytes;
+    } else if (_stack_bytes.size() < MAX_STACKS) {
+        _stack_bytes.emplace(std::move(key), bytes);
+    } else {
+        _truncated_bytes += bytes;
+    }
+}
+
+void AllocProfile::merge(const AllocProfile& other) {
+    std::scoped_lock l(_lock, other._lock);
+    _sampled_bytes += other._sampled_bytes;
+    _truncated_bytes += other._truncated_bytes;
+    for (const auto& [key, bytes] : other._stack_bytes) {
+        auto it = _stack_bytes.find(key);
+        if (it != _stack_bytes.end()) {
+            it->second += bytes;
+        } else if (_stack_bytes.size() < MAX_STACKS) {
+            _stack_bytes.emplace(key, bytes);
+        } else {
+            _truncated_bytes += bytes;
+        }
+    }
+}
+
+std::string AllocProfile::folded_stacks(BfdParser* bfd_parser) const {
+    std::unordered_map<std::string, int64_t> stack_bytes;
+    int64_t truncated_bytes = 0;
+    {
+        std::lock_guard l(_lock);
+        stack_bytes = _stack_bytes;
+        truncated_bytes = _truncated_bytes;
+    }
+    FoldedStacksBuilder builder(bfd_parser);
+    for (const auto& [key, bytes] : stack_bytes) {
+        builder.add(key.data(), key.size() / sizeof(void*), bytes);
+    }
+    if (truncated_bytes > 0) {
+        builder.add_line("[truncated]", truncated_bytes);
+    }
+    return std::move(builder.result());
+}
+
+int64_t AllocProfile::sampled_bytes() const {
+    std::lock_guard l(_lock);
+    return _sampled_bytes;
+}
+
+} // namespace doris
@@ -0,0 +1,60 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <stdint.h>
+
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+namespace doris {
+
+class BfdParser;
+
+// The sampled allocations of the threads attached to a query or load MemTrackerLimiter, by
+// allocation stack. The memory hook of a thread takes a sample about every
+// config::mem_alloc_profile_sample_bytes bytes it allocates, weighted by the bytes allocated
+// since its last sample, so the bytes of a stack estimate the bytes it allocated. The frees
+// are not attributed, the profile shows where a query allocates rather than what it holds.
+class AllocProfile {
+public:
+    static constexpr int MAX_DEPTH = 32;
+    static constexpr size_t MAX_STACKS = 10000;
+
+    // Called by the memory hook, which must not enter the hook again meanwhile.
+    void record(int64_t bytes, void* const* frames, int depth);
+
+    // Adds the samples of `other`, e.g. to symbolize a copy out of a lock.
+    void merge(const AllocProfile& other);
+
+    // The sampled bytes by stack as folded stacks, see FoldedStacksBuilder.
+    std::string folded_stacks(BfdParser* bfd_parser) const;
+
+    int64_t sampled_bytes() const;
+
+private:
+    mutable std::mutex _lock;
+    // the frames of a stack -> bytes
+    std::unordered_map<std::string, int64_t> _stack_bytes;
+    // the bytes of the stacks over MAX_STACKS
+    int64_t _truncated_bytes = 0;
+    int64_t _sampled_bytes = 0;
+};
+
+} // namespace doris
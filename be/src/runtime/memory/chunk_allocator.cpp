@@ -46,6 +46,7 @@ ChunkAllocator* ChunkAllocator::_s_instance = nullptr;
 
 DEFINE_COUNTER_METRIC_PROTOTYPE_2ARG(chunk_pool_local_core_alloc_count, MetricUnit::NOUNIT);
 DEFINE_COUNTER_METRIC_PROTOTYPE_2ARG(chunk_pool_other_core_alloc_count, MetricUnit::NOUNIT);
+DEFINE_COUNTER_METRIC_PROTOTYPE_2ARG(chunk_pool_other_numa_node_alloc_count, MetricUnit::NOUNIT);
 DEFINE_COUNTER_METRIC_PROTOTYPE_2ARG(chunk_pool_system_alloc_count, MetricUnit::NOUNIT);
 DEFINE_COUNTER_METRIC_PROTOTYPE_2ARG(chunk_pool_system_free_count, MetricUnit::NOUNIT);
 DEFINE_COUNTER_METRIC_PROTOTYPE_2ARG(chunk_pool_system_alloc_cost_ns, MetricUnit::NANOSECONDS);
@@ -54,6 +55,7 @@ DEFINE_GAUGE_METRIC_PROTOTYPE_2ARG(chunk_pool_reserved_bytes, MetricUnit::NOUNIT
 
 static IntCounter* chunk_pool_local_core_alloc_count;
 static IntCounter* chunk_pool_other_core_alloc_count;
+static IntCounter* chunk_pool_other_numa_node_alloc_count;
 static IntCounter* chunk_pool_system_alloc_count;
 static IntCounter* chunk_pool_system_free_count;
 static IntCounter* chunk_pool_system_alloc_cost_ns;
@@ -148,6 +150,7 @@ void ChunkAllocator::init_instance(size_t reserve_limit) {
 ChunkAllocator::ChunkAllocator(size_t reserve_limit)
         : _reserve_bytes_limit(reserve_limit),
           _steal_arena_limit(reserve_limit * 0.1),
+          _steal_numa_node_limit(reserve_limit * 0.5),
           _reserved_bytes(0),
           _arenas(CpuInfo::get_max_num_cores()) {
     _mem_tracker =
@@ -160,6 +163,8 @@ ChunkAllocator::ChunkAllocator(size_t reserve_limit)
             DorisMetrics::instance()->metric_registry()->register_entity("chunk_allocator");
     INT_COUNTER_METRIC_REGISTER(_chunk_allocator_metric_entity, chunk_pool_local_core_alloc_count);
     INT_COUNTER_METRIC_REGISTER(_chunk_allocator_metric_entity, chunk_pool_other_core_alloc_count);
+    INT_COUNTER_METRIC_REGISTER(_chunk_allocator_metric_entity,
+                                chunk_pool_other_numa_node_alloc_count);
     INT_COUNTER_METRIC_REGISTER(_chunk_allocator_metric_entity, chunk_pool_system_alloc_count);
     INT_COUNTER_METRIC_REGISTER(_chunk_allocator_metric_entity, chunk_pool_system_free_count);
     INT_COUNTER_METRIC_REGISTER(_chunk_allocator_metric_entity, chunk_pool_system_alloc_cost_ns);
@@ -189,21 +194,31 @@ Status ChunkAllocator::allocate_align(size_t size, Chunk* chunk) {
         THREAD_MEM_TRACKER_TRANSFER_FROM(size, _mem_tracker.get());
         return Status::OK();
     }
-    // Second path: try to allocate from other core's arena
+    // Second path: try to allocate from other core's arena of the same NUMA node.
     // When the reserved bytes is greater than the limit, the chunk is stolen from other arena.
     // Otherwise, it is allocated from the system first, which can reserve enough memory as soon as possible.
     // After that, allocate from current core arena as much as possible.
+    // A freed chunk returns to the arena of its core_id, so the chunks stay in the free lists
+    // of the node whose memory they are in.
+    int numa_node = CpuInfo::get_numa_node_of_core(core_id);
     if (_reserved_bytes > _steal_arena_limit) {
-        ++core_id;
-        for (int i = 1; i < _arenas.size(); ++i, ++core_id) {
-            if (_arenas[core_id % _arenas.size()]->pop_free_chunk(size, &chunk->data)) {
-                DCHECK_GE(_reserved_bytes, 0);
-                _reserved_bytes.fetch_sub(size);
+        const auto& node_cores = CpuInfo::get_cores_of_numa_node(numa_node);
+        int core_idx = CpuInfo::get_numa_node_core_idx(core_id);
+        for (int i = 1; i < node_cores.size(); ++i) {
+            if (_steal_chunk(node_cores[(core_idx + i) % node_cores.size()], size, chunk)) {
                 chunk_pool_other_core_alloc_count->increment(1);
-                // reset chunk's core_id to other
-                chunk->core_id = core_id % _arenas.size();
-                // transfer the memory ownership of allocate from ChunkAllocator::tracker to the tls tracker.
-                THREAD_MEM_TRACKER_TRANSFER_FROM(size, _mem_tracker.get());
+                return Status::OK();
+            }
+        }
+    }
+    // Third path: only steal the chunks of other NUMA nodes under pressure, the remote memory
+    // is slower to access than the memory newly allocated on the current node.
+    if (CpuInfo::get_max_num_numa_nodes() > 1 && _reserved_bytes > _steal_numa_node_limit) {
+        for (int i = 1; i < _arenas.size(); ++i) {
+            int other_core = (core_id + i) % _arenas.size();
+            if (CpuInfo::get_numa_node_of_core(other_core) != numa_node &&
+                _steal_chunk(other_core, size, chunk)) {
+                chunk_pool_other_numa_node_alloc_count->increment(1);
                 return Status::OK();
             }
         }
@@ -214,6 +229,9 @@ Status ChunkAllocator::allocate_align(size_t size, Chunk* chunk) {
         SCOPED_RAW_TIMER(&cost_ns);
         // allocate from system allocator
         chunk->data = SystemAllocator::allocate(size);
+        if (chunk->data != nullptr && _is_numa_bound(size)) {
+            SystemAllocator::set_numa_node(chunk->data, size, numa_node);
+        }
     }
     chunk_pool_system_alloc_count->increment(1);
     chunk_pool_system_alloc_cost_ns->increment(cost_ns);
@@ -223,6 +241,25 @@ Status ChunkAllocator::allocate_align(size_t size, Chunk* chunk) {
     return Status::OK();
 }
 
+bool ChunkAllocator::_steal_chunk(int core_id, size_t size, Chunk* chunk) {
+    if (!_arenas[core_id]->pop_free_chunk(size, &chunk->data)) {
+        return false;
+    }
+    DCHECK_GE(_reserved_bytes, 0);
+    _reserved_bytes.fetch_sub(size);
+    // reset chunk's core_id to other
+    chunk->core_id = core_id;
+    // transfer the memory ownership of allocate from ChunkAllocator::tracker to the tls tracker.
+    THREAD_MEM_TRACKER_TRANSFER_FROM(size, _mem_tracker.get());
+    return true;
+}
+
+bool ChunkAllocator::_is_numa_bound(size_t size) {
+    // only the chunks cached by the allocator, the others are freed to the system soon
+    return CpuInfo::get_max_num_numa_nodes() > 1 && size > MIN_CHUNK_SIZE &&
+           size < MAX_CHUNK_SIZE;
+}
+
 void ChunkAllocator::free(const Chunk& chunk) {
     DCHECK(chunk.core_id != -1);
     CHECK((chunk.size & (chunk.size - 1)) == 0);
@@ -240,6 +277,10 @@ void ChunkAllocator::free(const Chunk& chunk) {
             int64_t cost_ns = 0;
             {
                 SCOPED_RAW_TIMER(&cost_ns);
+                // do not leave the preference to the memory reused by malloc
+                if (_is_numa_bound(chunk.size)) {
+                    SystemAllocator::set_numa_node(chunk.data, chunk.size, -1);
+                }
                 SystemAllocator::free(chunk.data);
             }
             chunk_pool_system_free_count->increment(1);
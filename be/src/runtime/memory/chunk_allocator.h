@@ -39,7 +39,9 @@ class Status;
 // ChunkAllocator has one ChunkArena for each CPU core, it will try to allocate
 // memory from current core arena firstly. In this way, there will be no lock contention
 // between concurrently-running threads. If this fails, ChunkAllocator will try to allocate
-// memory from other core's arena.
+// memory from other core's arena of the same NUMA node, and only from the arenas of other
+// NUMA nodes when it reserves too many chunks. The chunks allocated from the system prefer
+// the memory of the current NUMA node.
 //
 // Memory Reservation
 // ChunkAllocator has a limit about how much free chunk bytes it can reserve, above which
@@ -80,6 +82,12 @@ public:
 private:
     ChunkAllocator(size_t reserve_limit);
 
+    // pop a free chunk of size from the arena of core_id
+    bool _steal_chunk(int core_id, size_t size, Chunk* chunk);
+
+    // whether the chunk allocated from the system is bound to the NUMA node
+    static bool _is_numa_bound(size_t size);
+
 private:
     static ChunkAllocator* _s_instance;
 
@@ -87,6 +95,9 @@ private:
     // When the reserved chunk memory size is greater than the limit,
     // it is allowed to steal the chunks of other arenas.
     size_t _steal_arena_limit;
+    // When the reserved chunk memory size is greater than the limit,
+    // it is allowed to steal the chunks of the arenas of other NUMA nodes.
+    size_t _steal_numa_node_limit;
     std::atomic<int64_t> _reserved_bytes;
     // each core has a ChunkArena
     std::vector<std::unique_ptr<ChunkArena>> _arenas;
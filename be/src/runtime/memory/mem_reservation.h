@@ -0,0 +1,81 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <stdint.h>
+
+#include <memory>
+
+#include "runtime/memory/mem_tracker_limiter.h"
+
+namespace doris {
+
+// The memory reserved by an operator on the MemTrackerLimiter of its query for the
+// allocations of its next step, e.g. the next block to buffer. The operator resizes the
+// reservation before each step and spills or shrinks when it is denied. The reservation is
+// released when the object is destroyed. Not thread safe.
+//
+// The allocations of a step are also tracked by the memory hook, so they are counted twice
+// until the reservation is resized for the next step. The error is bounded by the size of
+// one step of each operator and errs on the side of spilling earlier.
+class MemReservation {
+public:
+    MemReservation() = default;
+    ~MemReservation() { release(); }
+
+    MemReservation(const MemReservation&) = delete;
+    MemReservation& operator=(const MemReservation&) = delete;
+
+    void init(std::shared_ptr<MemTrackerLimiter> tracker) {
+        release();
+        _tracker = std::move(tracker);
+    }
+
+    // Make the reservation exactly bytes. Shrinking always succeeds. Returns false and keeps
+    // the current reservation if growing is denied. Always succeeds if not initialized.
+    bool try_resize(int64_t bytes) {
+        if (_tracker == nullptr || bytes == _bytes) {
+            return true;
+        }
+        if (bytes < _bytes) {
+            _tracker->release_reservation(_bytes - bytes);
+        } else if (!_tracker->try_reserve(bytes - _bytes)) {
+            ++_denied_count;
+            return false;
+        }
+        _bytes = bytes;
+        return true;
+    }
+
+    void release() {
+        if (_tracker != nullptr && _bytes > 0) {
+            _tracker->release_reservation(_bytes);
+        }
+        _bytes = 0;
+    }
+
+    int64_t bytes() const { return _bytes; }
+    int64_t denied_count() const { return _denied_count; }
+
+private:
+    std::shared_ptr<MemTrackerLimiter> _tracker;
+    int64_t _bytes = 0;
+    int64_t _denied_count = 0;
+};
+
+} // namespace doris
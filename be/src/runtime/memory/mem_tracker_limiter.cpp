@@ -21,6 +21,7 @@
 #include <gen_cpp/types.pb.h>
 #include <stdlib.h>
 
+#include <fstream>
 #include <functional>
 #include <mutex>
 #include <queue>
@@ -29,12 +30,14 @@
 #include "runtime/exec_env.h"
 #include "runtime/fragment_mgr.h"
 #include "runtime/load_channel_mgr.h"
+#include "runtime/memory/alloc_profile.h"
 #include "runtime/task_group/task_group.h"
 #include "service/backend_options.h"
 #include "util/mem_info.h"
 #include "util/perf_counters.h"
 #include "util/pretty_printer.h"
 #include "util/stack_util.h"
+#include "util/time.h"
 
 namespace doris {
 
@@ -58,6 +61,15 @@ MemTrackerLimiter::MemTrackerLimiter(Type type, const std::string& label, int64_
     _type = type;
     _label = label;
     _limit = byte_limit;
+    // bound the error of the limit check to a small part of the limit
+    _core_local_slack = config::mem_tracker_core_local_slack_bytes;
+    if (_limit > 0) {
+        _core_local_slack = std::min<int64_t>(
+                _core_local_slack, _limit / (64 * (int64_t)_core_local_untracked.size()));
+    }
+    if (config::enable_query_memory_profile && is_overcommit_tracker()) {
+        _alloc_profile = std::make_unique<AllocProfile>();
+    }
     if (_type == Type::GLOBAL) {
         _group_num = 0;
     } else {
@@ -73,6 +85,9 @@ MemTrackerLimiter::MemTrackerLimiter(Type type, const std::string& label, int64_
 MemTrackerLimiter::~MemTrackerLimiter() {
     if (_type == Type::GLOBAL) return;
     consume(_untracked_mem);
+    for (size_t i = 0; i < _core_local_untracked.size(); ++i) {
+        consume(*_core_local_untracked.access_at_core(i));
+    }
     // mem hook record tracker cannot guarantee that the final consumption is 0,
     // nor can it guarantee that the memory alloc and free are recorded in a one-to-one correspondence.
     // In order to ensure `consumption of all limiter trackers` + `orphan tracker consumption` = `process tracker consumption`
@@ -98,6 +113,47 @@ MemTracker::Snapshot MemTrackerLimiter::make_snapshot() const {
     return snapshot;
 }
 
+Status MemTrackerLimiter::alloc_profile_folded_stacks(const TUniqueId& query_id,
+                                                      BfdParser* bfd_parser,
+                                                      std::string* folded_stacks) {
+    AllocProfile profile;
+    bool found = false;
+    for (unsigned i = 1; i < mem_tracker_limiter_pool.size(); ++i) {
+        std::lock_guard<std::mutex> l(mem_tracker_limiter_pool[i].group_lock);
+        for (auto tracker : mem_tracker_limiter_pool[i].trackers) {
+            if (tracker->alloc_profile() != nullptr &&
+                label_to_queryid(tracker->label()) == query_id) {
+                // symbolized out of the lock
+                profile.merge(*tracker->alloc_profile());
+                found = true;
+            }
+        }
+    }
+    if (!found) {
+        return Status::NotFound("no memory profile of {}, enable_query_memory_profile is {}",
+                                print_id(query_id), config::enable_query_memory_profile);
+    }
+    *folded_stacks = profile.folded_stacks(bfd_parser);
+    return Status::OK();
+}
+
+void MemTrackerLimiter::dump_alloc_profile(BfdParser* bfd_parser) {
+    if (_alloc_profile == nullptr || _alloc_profile_dumped.exchange(true)) {
+        return;
+    }
+    std::string path = fmt::format("{}/query_memory_profile.{}.{}", config::jeprofile_dir,
+                                   print_id(label_to_queryid(_label)), UnixMillis());
+    std::ofstream out(path);
+    out << _alloc_profile->folded_stacks(bfd_parser);
+    out.close();
+    if (out.fail()) {
+        LOG(WARNING) << "failed to write memory profile of " << _label << " to " << path;
+        return;
+    }
+    LOG(INFO) << "memory profile of " << _label << " written to " << path
+              << ", sampled bytes: " << PrettyPrinter::print_bytes(_alloc_profile->sampled_bytes());
+}
+
 void MemTrackerLimiter::refresh_global_counter() {
     std::unordered_map<Type, int64_t> type_mem_sum = {
             {Type::GLOBAL, 0},        {Type::QUERY, 0}, {Type::LOAD, 0}, {Type::COMPACTION, 0},
@@ -253,6 +309,49 @@ void MemTrackerLimiter::print_log_process_usage(const std::string& msg, bool wit
     }
 }
 
+int64_t MemTrackerLimiter::precise_consumption() const {
+    int64_t consumption = _consumption->current_value();
+    for (size_t i = 0; i < _core_local_untracked.size(); ++i) {
+        consumption += __atomic_load_n(_core_local_untracked.access_at_core(i), __ATOMIC_RELAXED);
+    }
+    return consumption;
+}
+
+bool MemTrackerLimiter::can_reserve(int64_t bytes) const {
+    if (bytes <= 0) {
+        return true;
+    }
+    if (sys_mem_exceed_limit_check(bytes)) {
+        return false;
+    }
+    if (_limit > 0 && _consumption->current_value() + reserved_consumption() + bytes > _limit) {
+        return false;
+    }
+    auto task_group = _task_group.lock();
+    return task_group == nullptr || task_group->can_reserve_memory(bytes);
+}
+
+bool MemTrackerLimiter::try_reserve(int64_t bytes) {
+    if (bytes <= 0) {
+        return true;
+    }
+    if (sys_mem_exceed_limit_check(bytes)) {
+        return false;
+    }
+    int64_t reserved = _reserved.load(std::memory_order_relaxed);
+    do {
+        if (_limit > 0 && _consumption->current_value() + reserved + bytes > _limit) {
+            return false;
+        }
+    } while (!_reserved.compare_exchange_weak(reserved, reserved + bytes));
+    auto task_group = _task_group.lock();
+    if (task_group != nullptr && !task_group->try_reserve_memory(bytes)) {
+        _reserved.fetch_sub(bytes);
+        return false;
+    }
+    return true;
+}
+
 bool MemTrackerLimiter::sys_mem_exceed_limit_check(int64_t bytes) {
     if (!_oom_avoidance) {
         return false;
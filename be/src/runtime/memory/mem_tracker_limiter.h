@@ -36,6 +36,7 @@
 #include "common/config.h"
 #include "common/status.h"
 #include "runtime/memory/mem_tracker.h"
+#include "util/core_local.h"
 #include "util/runtime_profile.h"
 #include "util/string_util.h"
 #include "util/uid_util.h"
@@ -50,6 +51,8 @@ class TaskGroup;
 using TaskGroupPtr = std::shared_ptr<TaskGroup>;
 } // namespace taskgroup
 
+class AllocProfile;
+class BfdParser;
 class MemTrackerLimiter;
 
 struct TrackerLimiterGroup {
@@ -136,7 +139,24 @@ public:
 
     // Returns the maximum consumption that can be made without exceeding the limit on
     // this tracker limiter.
-    int64_t spare_capacity() const { return _limit - consumption(); }
+    int64_t spare_capacity() const { return _limit - consumption() - reserved_consumption(); }
+
+    // Reserve memory before allocating it, e.g. before an operator buffers more blocks or
+    // grows its hash table, see MemReservation. The consumption tracked by the memory hook is
+    // only known after allocating, so the operator reserves first and spills or shrinks if
+    // the reservation is denied, instead of the query being cancelled. The reserved bytes
+    // count toward the limit until released, whether or not the query may overcommit.
+    // Returns false if the bytes exceed the limit of this tracker or of the process.
+    bool try_reserve(int64_t bytes);
+    void release_reservation(int64_t bytes) { _reserved.fetch_sub(bytes); }
+    // whether try_reserve(bytes) would succeed now, without reserving
+    bool can_reserve(int64_t bytes) const;
+    // The reservations of a query in a workload group are also limited by the group, see
+    // TaskGroup::try_reserve_memory. Set once when the query joins the group.
+    void set_task_group(std::weak_ptr<taskgroup::TaskGroup> task_group) {
+        _task_group = std::move(task_group);
+    }
+    int64_t reserved_consumption() const { return _reserved.load(std::memory_order_relaxed); }
 
     bool is_query_cancelled() { return _is_query_cancelled; }
 
@@ -144,10 +164,30 @@ public:
 
     static void disable_oom_avoidance() { _oom_avoidance = false; }
 
+    // The sampled allocation stacks of a query or load created with
+    // config::enable_query_memory_profile, nullptr otherwise.
+    AllocProfile* alloc_profile() const { return _alloc_profile.get(); }
+    // The allocation profile of the query or load as folded stacks.
+    static Status alloc_profile_folded_stacks(const TUniqueId& query_id, BfdParser* bfd_parser,
+                                              std::string* folded_stacks);
+    // Writes the allocation profile into config::jeprofile_dir, once, e.g. when the query is
+    // cancelled for exceeding its memory limit.
+    void dump_alloc_profile(BfdParser* bfd_parser);
+
 public:
     // If need to consume the tracker frequently, use it
     void cache_consume(int64_t bytes);
 
+    // Consume through the slab of the current core. The shared counter is only updated when
+    // the slab accumulates more than _core_local_slack bytes, so the threads of a big query
+    // on many cores do not contend on its cache line. The consumption lags behind by at most
+    // max_pending_bytes(), the limit checks sum up the slabs when they are that close to the
+    // limit.
+    void core_local_consume(int64_t bytes);
+    // the consumption including the bytes still in the core local slabs
+    int64_t precise_consumption() const;
+    int64_t max_pending_bytes() const { return _core_local_slack * _core_local_untracked.size(); }
+
     // Transfer 'bytes' of consumption from this tracker to 'dst'.
     void transfer_to(int64_t size, MemTrackerLimiter* dst) {
         cache_consume(-size);
@@ -232,6 +272,7 @@ public:
         std::stringstream msg;
         msg << "limit: " << _limit << "; "
             << "consumption: " << _consumption->current_value() << "; "
+            << "reserved: " << reserved_consumption() << "; "
             << "label: " << _label << "; "
             << "type: " << type_string(_type) << "; ";
         return msg.str();
@@ -258,9 +299,21 @@ private:
     // to avoid frequent calls to consume/release of MemTracker.
     std::atomic<int64_t> _untracked_mem = 0;
 
+    // bytes reserved by try_reserve and not released yet
+    std::atomic<int64_t> _reserved = 0;
+
+    // see core_local_consume
+    CoreLocalValue<int64_t> _core_local_untracked;
+    int64_t _core_local_slack = 0;
+
     // query or load
     std::atomic<bool> _is_query_cancelled = false;
 
+    std::weak_ptr<taskgroup::TaskGroup> _task_group;
+
+    std::unique_ptr<AllocProfile> _alloc_profile;
+    std::atomic<bool> _alloc_profile_dumped = false;
+
     // Avoid frequent printing.
     bool _enable_print_log_usage = false;
     static std::atomic<bool> _enable_print_log_process_usage;
@@ -284,12 +337,25 @@ inline void MemTrackerLimiter::cache_consume(int64_t bytes) {
     consume(consume_bytes);
 }
 
+inline void MemTrackerLimiter::core_local_consume(int64_t bytes) {
+    int64_t* slab = _core_local_untracked.access();
+    int64_t untracked = __atomic_add_fetch(slab, bytes, __ATOMIC_RELAXED);
+    if (std::abs(untracked) >= _core_local_slack) {
+        consume(__atomic_exchange_n(slab, 0, __ATOMIC_RELAXED));
+    }
+}
+
 inline Status MemTrackerLimiter::check_limit(int64_t bytes) {
     if (bytes <= 0 || (is_overcommit_tracker() && config::enable_query_memory_overcommit)) {
         return Status::OK();
     }
-    if (_limit > 0 && _consumption->current_value() + bytes > _limit) {
-        return Status::MemoryLimitExceeded(tracker_limit_exceeded_str(bytes));
+    if (_limit > 0) {
+        int64_t used = _consumption->current_value() + reserved_consumption() + bytes;
+        // only sum up the core local slabs when they may reach the limit
+        if (used + max_pending_bytes() > _limit &&
+            used - _consumption->current_value() + precise_consumption() > _limit) {
+            return Status::MemoryLimitExceeded(tracker_limit_exceeded_str(bytes));
+        }
     }
     return Status::OK();
 }
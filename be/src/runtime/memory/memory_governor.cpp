@@ -0,0 +1,222 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "runtime/memory/memory_governor.h"
+
+#include <fmt/format.h>
+#include <gen_cpp/segment_v2.pb.h>
+#include <glog/logging.h>
+
+#include <algorithm>
+#include <utility>
+
+#include "common/config.h"
+#include "common/logging.h"
+#include "olap/page_cache.h"
+#include "olap/rowset/segment_v2/bloom_filter_index_reader.h"
+#include "olap/rowset/segment_v2/inverted_index_cache.h"
+#include "runtime/memory/chunk_allocator.h"
+#include "runtime/memory/mem_tracker.h"
+#include "util/mem_info.h"
+#include "util/time.h"
+
+namespace doris {
+
+// a source holding less memory is not worth evicting from
+static constexpr int64_t MIN_SOURCE_BYTES = 32L * 1024 * 1024;
+static constexpr int64_t RANK_INTERVAL_MS = 1000;
+static constexpr double HIT_RATE_DECAY = 0.5;
+
+MemoryGovernor* MemoryGovernor::instance() {
+    static MemoryGovernor governor;
+    return &governor;
+}
+
+MemoryGovernor::MemoryGovernor() {
+    // The cached chunks are reused without reloading anything.
+    register_source({"ChunkAllocator", 0,
+                     [] {
+                         return ChunkAllocator::instance() ? ChunkAllocator::instance()
+                                                                     ->mem_consumption()
+                                                           : 0;
+                     },
+                     [] { return 0; },
+                     [](int64_t) {
+                         int64_t freed = ChunkAllocator::instance()->mem_consumption();
+                         ChunkAllocator::instance()->clear();
+                         return freed;
+                     }});
+    auto page_cache_source = [](std::string name, double reload_cost,
+                                segment_v2::PageTypePB page_type) {
+        auto available = [page_type] {
+            return StoragePageCache::instance() != nullptr &&
+                   StoragePageCache::instance()->is_cache_available(page_type);
+        };
+        return Source {std::move(name), reload_cost,
+                       [=] {
+                           return available() ? StoragePageCache::instance()
+                                                        ->get_page_cache_mem_consumption(page_type)
+                                              : 0;
+                       },
+                       [=]() -> uint64_t {
+                           return available() ? StoragePageCache::instance()
+                                                        ->get_page_cache_hit_count(page_type)
+                                              : 0;
+                       },
+                       [=](int64_t bytes) {
+                           return StoragePageCache::instance()->evict(page_type, bytes);
+                       }};
+    };
+    // A data page is read and decompressed again.
+    register_source(page_cache_source("DataPageCache", 1, segment_v2::DATA_PAGE));
+    // The primary key index pages are looked up by every row of a merge-on-write load.
+    register_source(
+            page_cache_source("PrimaryKeyIndexPageCache", 4, segment_v2::PRIMARY_KEY_INDEX_PAGE));
+    // A query cache entry is a bitmap of a term, which is searched again.
+    register_source({"InvertedIndexQueryCache", 2,
+                     [] {
+                         auto cache = segment_v2::InvertedIndexQueryCache::instance();
+                         return cache ? cache->mem_consumption() : 0;
+                     },
+                     []() -> uint64_t {
+                         auto cache = segment_v2::InvertedIndexQueryCache::instance();
+                         return cache ? cache->hit_count() : 0;
+                     },
+                     [](int64_t bytes) {
+                         return segment_v2::InvertedIndexQueryCache::instance()->evict(bytes);
+                     }});
+    // An index searcher opens and reads the whole index files.
+    register_source({"InvertedIndexSearcherCache", 8,
+                     [] {
+                         auto cache = segment_v2::InvertedIndexSearcherCache::instance();
+                         return cache ? cache->mem_consumption() : 0;
+                     },
+                     []() -> uint64_t {
+                         auto cache = segment_v2::InvertedIndexSearcherCache::instance();
+                         return cache ? cache->hit_count() : 0;
+                     },
+                     [](int64_t bytes) {
+                         return segment_v2::InvertedIndexSearcherCache::instance()->evict(bytes);
+                     }});
+    // A decoded bloom filter is read from an index page, which may be in the page cache.
+    register_source({"BloomFilterPageCache", 2,
+                     [] {
+                         auto cache = segment_v2::BloomFilterPageCache::instance();
+                         return cache ? cache->mem_consumption() : 0;
+                     },
+                     []() -> uint64_t {
+                         auto cache = segment_v2::BloomFilterPageCache::instance();
+                         return cache ? cache->hit_count() : 0;
+                     },
+                     [](int64_t bytes) {
+                         return segment_v2::BloomFilterPageCache::instance()->evict(bytes);
+                     }});
+    // A term filter is built by scanning all terms of an index file.
+    register_source({"InvertedIndexTermCache", 8,
+                     [] {
+                         auto cache = segment_v2::InvertedIndexTermCache::instance();
+                         return cache ? cache->mem_consumption() : 0;
+                     },
+                     []() -> uint64_t {
+                         auto cache = segment_v2::InvertedIndexTermCache::instance();
+                         return cache ? cache->hit_count() : 0;
+                     },
+                     [](int64_t bytes) {
+                         return segment_v2::InvertedIndexTermCache::instance()->evict(bytes);
+                     }});
+}
+
+void MemoryGovernor::register_source(Source source) {
+    std::lock_guard l(_lock);
+    SourceState state;
+    state.last_hit_count = source.hit_count();
+    state.source = std::move(source);
+    _sources.push_back(std::move(state));
+}
+
+void MemoryGovernor::_rank_sources() {
+    int64_t now_ms = MonotonicMillis();
+    int64_t elapsed_ms = now_ms - _last_rank_time_ms;
+    if (elapsed_ms >= RANK_INTERVAL_MS) {
+        _last_rank_time_ms = now_ms;
+        for (auto& state : _sources) {
+            uint64_t hit_count = state.source.hit_count();
+            double hit_rate = (hit_count - state.last_hit_count) * 1000.0 / elapsed_ms;
+            state.last_hit_count = hit_count;
+            state.hit_rate = state.hit_rate * HIT_RATE_DECAY + hit_rate * (1 - HIT_RATE_DECAY);
+        }
+    }
+    for (auto& state : _sources) {
+        int64_t consumption = std::max<int64_t>(1, state.source.mem_consumption());
+        state.value_per_byte = state.hit_rate * state.source.reload_cost / consumption;
+    }
+    std::stable_sort(_sources.begin(), _sources.end(), [](const auto& lhs, const auto& rhs) {
+        return lhs.value_per_byte < rhs.value_per_byte;
+    });
+}
+
+int64_t MemoryGovernor::_free_memory(int64_t request_bytes, bool incremental) {
+    std::lock_guard l(_lock);
+    _rank_sources();
+    int64_t freed = 0;
+    for (auto& state : _sources) {
+        if (freed >= request_bytes) {
+            break;
+        }
+        int64_t consumption = state.source.mem_consumption();
+        if (consumption < MIN_SOURCE_BYTES) {
+            continue;
+        }
+        int64_t bytes =
+                std::min(request_bytes - freed, incremental ? consumption / 2 : consumption);
+        int64_t source_freed = state.source.evict(bytes);
+        freed += source_freed;
+        VLOG_NOTICE << fmt::format("memory governor freed {} of {}, value per byte {:.3g}",
+                                   MemTracker::print_bytes(source_freed), state.source.name,
+                                   state.value_per_byte);
+    }
+    return freed;
+}
+
+int64_t MemoryGovernor::free_above_high_watermark(int64_t process_memory) {
+    int64_t high_watermark =
+            MemInfo::mem_limit() / 100 * config::memory_governor_high_watermark_percent;
+    if (process_memory <= high_watermark) {
+        return 0;
+    }
+    return _free_memory(std::min(process_memory - high_watermark,
+                                 config::memory_governor_max_free_bytes_per_round),
+                        true);
+}
+
+int64_t MemoryGovernor::free_memory(int64_t request_bytes) {
+    return _free_memory(request_bytes, false);
+}
+
+std::string MemoryGovernor::debug_string() {
+    std::lock_guard l(_lock);
+    std::string str = "MemoryGovernor sources:";
+    for (const auto& state : _sources) {
+        str += fmt::format(" [{}, memory {}, hit rate {:.1f}/s, value per byte {:.3g}]",
+                           state.source.name,
+                           MemTracker::print_bytes(state.source.mem_consumption()), state.hit_rate,
+                           state.value_per_byte);
+    }
+    return str;
+}
+
+} // namespace doris
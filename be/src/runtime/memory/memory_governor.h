@@ -0,0 +1,86 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <stdint.h>
+
+#include <functional>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace doris {
+
+// Frees the memory of caches incrementally before the process memory reaches the soft mem
+// limit, so that the process memory gc rarely has to prune whole caches or cancel queries.
+//
+// The sources are freed from the least valuable one. The value of a byte of a source is its
+// recent hit rate times the cost to reload the data of a hit, divided by the memory of the
+// source, i.e. the reload cost saved per second by keeping a byte. The memory gc thread calls
+// free_above_high_watermark every round, which frees the process memory above the high
+// watermark by at most config::memory_governor_max_free_bytes_per_round, and at most half of
+// a source, so the ranking is re-evaluated as the sources shrink.
+class MemoryGovernor {
+public:
+    struct Source {
+        std::string name;
+        // the relative cost of reloading a byte, e.g. reading and decompressing a data page
+        double reload_cost;
+        std::function<int64_t()> mem_consumption;
+        // the accumulated number of hits
+        std::function<uint64_t()> hit_count;
+        // free about the bytes, returns the bytes freed
+        std::function<int64_t(int64_t)> evict;
+    };
+
+    static MemoryGovernor* instance();
+
+    void register_source(Source source);
+
+    // Free the process memory above the high watermark incrementally.
+    // Returns the bytes freed.
+    int64_t free_above_high_watermark(int64_t process_memory);
+
+    // Free request_bytes from the sources by their ranking. Not incremental, used by the
+    // process memory gc when the memory is already beyond the soft mem limit.
+    int64_t free_memory(int64_t request_bytes);
+
+    std::string debug_string();
+
+private:
+    struct SourceState {
+        Source source;
+        uint64_t last_hit_count = 0;
+        // exponential moving average of hits per second
+        double hit_rate = 0;
+        // the reload cost saved per second by keeping a byte
+        double value_per_byte = 0;
+    };
+
+    MemoryGovernor();
+
+    // update the hit rates and sort _sources by value_per_byte
+    void _rank_sources();
+    int64_t _free_memory(int64_t request_bytes, bool incremental);
+
+    std::mutex _lock;
+    std::vector<SourceState> _sources;
+    int64_t _last_rank_time_ms = 0;
+};
+
+} // namespace doris
@@ -20,6 +20,9 @@
 #include <fmt/format.h>
 #include <stdlib.h>
 #include <string.h>
+#if defined(__linux__)
+#include <sys/syscall.h>
+#endif
 
 #include <new>
 #include <string>
@@ -57,6 +60,26 @@ void SystemAllocator::free(uint8_t* ptr) {
     ::free(ptr);
 }
 
+void SystemAllocator::set_numa_node(uint8_t* ptr, size_t length, int numa_node) {
+#if defined(__linux__) && defined(SYS_mbind)
+    // the constants of linux/mempolicy.h, avoid depending on libnuma
+    constexpr int MPOL_DEFAULT_MODE = 0;
+    constexpr int MPOL_PREFERRED_MODE = 1;
+    constexpr int MAX_NODES = 64 * 16;
+    if (numa_node >= MAX_NODES) {
+        return;
+    }
+    unsigned long node_mask[MAX_NODES / 64] = {0};
+    int mode = MPOL_DEFAULT_MODE;
+    if (numa_node >= 0) {
+        node_mask[numa_node / 64] = 1UL << (numa_node % 64);
+        mode = MPOL_PREFERRED_MODE;
+    }
+    syscall(SYS_mbind, ptr, length, mode, numa_node >= 0 ? node_mask : nullptr,
+            numa_node >= 0 ? MAX_NODES : 0, 0);
+#endif
+}
+
 uint8_t* SystemAllocator::allocate_via_malloc(size_t length) {
     void* ptr = nullptr;
     // try to use a whole page instead of parts of one page
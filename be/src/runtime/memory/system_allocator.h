@@ -30,6 +30,11 @@ public:
 
     static void free(uint8_t* ptr);
 
+    // Prefer the pages of [ptr, ptr + length) not touched yet to be placed on the NUMA node,
+    // or reset the preference if numa_node is -1. ptr and length must be aligned to pages.
+    // Best effort, the errors are ignored.
+    static void set_numa_node(uint8_t* ptr, size_t length, int numa_node);
+
 private:
     static uint8_t* allocate_via_mmap(size_t length);
     static uint8_t* allocate_via_malloc(size_t length);
@@ -18,6 +18,7 @@
 #include "runtime/memory/thread_mem_tracker_mgr.h"
 
 #include <gen_cpp/types.pb.h>
+#include <gperftools/stacktrace.h>
 
 #include "runtime/exec_env.h"
 #include "runtime/fragment_mgr.h"
@@ -33,6 +34,7 @@ void ThreadMemTrackerMgr::attach_limiter_tracker(
     _fragment_instance_id = fragment_instance_id;
     _limiter_tracker = mem_tracker;
     _limiter_tracker_raw = mem_tracker.get();
+    _alloc_since_sample = 0;
     _wait_gc = true;
 }
 
@@ -46,6 +48,17 @@ void ThreadMemTrackerMgr::detach_limiter_tracker(
     _wait_gc = false;
 }
 
+void ThreadMemTrackerMgr::sample_alloc(AllocProfile* alloc_profile) {
+    // the profile allocates while recording
+    _stop_consume = true;
+    void* frames[AllocProfile::MAX_DEPTH];
+    // skip the frames of the memory hook
+    int depth = GetStackTrace(frames, AllocProfile::MAX_DEPTH, 3);
+    alloc_profile->record(_alloc_since_sample, frames, depth);
+    _alloc_since_sample = 0;
+    _stop_consume = false;
+}
+
 void ThreadMemTrackerMgr::cancel_fragment(const std::string& exceed_msg) {
     ExecEnv::GetInstance()->fragment_mgr()->cancel(
             _fragment_instance_id, PPlanFragmentCancelReason::MEMORY_LIMIT_EXCEED, exceed_msg);
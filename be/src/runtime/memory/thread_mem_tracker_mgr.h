@@ -30,6 +30,7 @@
 
 #include "common/config.h"
 #include "runtime/exec_env.h"
+#include "runtime/memory/alloc_profile.h"
 #include "runtime/memory/mem_tracker.h"
 #include "runtime/memory/mem_tracker_limiter.h"
 #include "util/stack_util.h"
@@ -78,6 +79,8 @@ public:
     // Returns whether the memory exceeds limit, and will consume mem trcker no matter whether the limit is exceeded.
     void consume(int64_t size);
     void flush_untracked_mem();
+    // Records the stack of the current allocation in the profile of the limiter tracker.
+    void sample_alloc(AllocProfile* alloc_profile);
 
     bool is_attach_query() { return _fragment_instance_id != TUniqueId(); }
 
@@ -128,6 +131,8 @@ private:
     // If there is a memory new/delete operation in the consume method, it may enter infinite recursion.
     bool _stop_consume = false;
     TUniqueId _fragment_instance_id = TUniqueId();
+    // the bytes allocated since the last sample of the allocation profile
+    int64_t _alloc_since_sample = 0;
 };
 
 inline bool ThreadMemTrackerMgr::init() {
@@ -171,6 +176,15 @@ inline void ThreadMemTrackerMgr::consume(int64_t size) {
         !_stop_consume && ExecEnv::GetInstance()->initialized()) {
         flush_untracked_mem();
     }
+    if (size > 0 && _limiter_tracker_raw != nullptr && !_stop_consume) {
+        AllocProfile* alloc_profile = _limiter_tracker_raw->alloc_profile();
+        if (alloc_profile != nullptr) {
+            _alloc_since_sample += size;
+            if (_alloc_since_sample >= config::mem_alloc_profile_sample_bytes) {
+                sample_alloc(alloc_profile);
+            }
+        }
+    }
     // Large memory alloc should use allocator.h
     // Direct malloc or new large memory, unable to catch std::bad_alloc, BE may OOM.
     if (size > 4294967296) { // 4G
@@ -190,7 +204,7 @@ inline void ThreadMemTrackerMgr::flush_untracked_mem() {
 
     old_untracked_mem = _untracked_mem;
     if (_count_scope_mem) _scope_mem += _untracked_mem;
-    _limiter_tracker_raw->consume(old_untracked_mem);
+    _limiter_tracker_raw->core_local_consume(old_untracked_mem);
     for (auto tracker : _consumer_tracker_stack) {
         tracker->consume(old_untracked_mem);
     }
@@ -46,6 +46,20 @@ protected:
     std::string _cancelled_reason = "";
 };
 
+// buffer message in memory, for the small loads of group commit
+class MessageBodyStringSink : public MessageBodySink {
+public:
+    Status append(const char* data, size_t size) override {
+        _data.append(data, size);
+        return Status::OK();
+    }
+
+    std::string& data() { return _data; }
+
+private:
+    std::string _data;
+};
+
 // write message to a local file
 class MessageBodyFileSink : public MessageBodySink {
 public:
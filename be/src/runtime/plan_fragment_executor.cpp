@@ -501,6 +501,10 @@ void PlanFragmentExecutor::cancel(const PPlanFragmentCancelReason& reason, const
     _runtime_state->set_is_cancelled(true);
     // To notify wait_for_start()
     _runtime_state->get_query_ctx()->set_ready_to_execute(true);
+    if (reason == PPlanFragmentCancelReason::MEMORY_LIMIT_EXCEED) {
+        _runtime_state->get_query_ctx()->query_mem_tracker->dump_alloc_profile(
+                _exec_env->bfd_parser());
+    }
 
     // must close stream_mgr to avoid dead lock in Exchange Node
     auto env = _runtime_state->exec_env();
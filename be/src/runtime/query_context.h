@@ -28,6 +28,7 @@
 #include "common/factory_creator.h"
 #include "common/object_pool.h"
 #include "runtime/datetime_value.h"
+#include "runtime/descriptor_tbl_cache.h"
 #include "runtime/exec_env.h"
 #include "runtime/memory/mem_tracker_limiter.h"
 #include "runtime/runtime_filter_mgr.h"
@@ -176,6 +177,8 @@ public:
 public:
     TUniqueId query_id;
     DescriptorTbl* desc_tbl;
+    // keeps `desc_tbl` alive if it is shared with other queries
+    std::shared_ptr<CachedDescriptorTbl> cached_desc_tbl;
     bool set_rsc_info = false;
     std::string user;
     std::string group;
@@ -117,6 +117,20 @@ void ResultBufferMgr::fetch_data(const PUniqueId& finst_id, GetResultBatchCtx* c
     cb->get_batch(ctx);
 }
 
+Status ResultBufferMgr::fetch_arrow_data(const PUniqueId& finst_id,
+                                         std::shared_ptr<arrow::RecordBatch>* result,
+                                         int64_t* packet_seq) {
+    TUniqueId tid;
+    tid.__set_hi(finst_id.hi());
+    tid.__set_lo(finst_id.lo());
+    std::shared_ptr<BufferControlBlock> cb = find_control_block(tid);
+    if (cb == nullptr) {
+        LOG(WARNING) << "no result for this query, id=" << tid;
+        return Status::InternalError("no result for this query");
+    }
+    return cb->get_arrow_batch(result, packet_seq);
+}
+
 Status ResultBufferMgr::cancel(const TUniqueId& query_id) {
     std::lock_guard<std::mutex> l(_lock);
     BufferMap::iterator iter = _buffer_map.find(query_id);
@@ -31,6 +31,10 @@
 #include "util/countdown_latch.h"
 #include "util/hash_util.hpp"
 
+namespace arrow {
+class RecordBatch;
+} // namespace arrow
+
 namespace doris {
 
 class BufferControlBlock;
@@ -54,6 +58,10 @@ public:
 
     void fetch_data(const PUniqueId& finst_id, GetResultBatchCtx* ctx);
 
+    // fetch the next arrow batch of the sink of the arrow flight protocol, nullptr after eos
+    Status fetch_arrow_data(const PUniqueId& finst_id, std::shared_ptr<arrow::RecordBatch>* result,
+                            int64_t* packet_seq);
+
     // cancel
     Status cancel(const TUniqueId& fragment_id);
 
@@ -182,7 +182,7 @@ Status KafkaDataConsumer::assign_topic_partitions(
     return Status::OK();
 }
 
-Status KafkaDataConsumer::group_consume(BlockingQueue<RdKafka::Message*>* queue,
+Status KafkaDataConsumer::group_consume(BlockingQueue<KafkaMessageBatch*>* queue,
                                         int64_t max_running_time_ms) {
     static constexpr int MAX_RETRY_TIMES_FOR_TRANSPORT_FAILURE = 3;
     int64_t left_time = max_running_time_ms;
@@ -209,43 +209,58 @@ Status KafkaDataConsumer::group_consume(BlockingQueue<RdKafka::Message*>* queue,
         }
 
         bool done = false;
-        // consume 1 message at a time
+        // consume a batch of messages, only the first one waits for the messages to be fetched
+        auto batch = std::make_unique<KafkaMessageBatch>();
+        bool batch_end = false;
         consumer_watch.start();
-        std::unique_ptr<RdKafka::Message> msg(_k_consumer->consume(1000 /* timeout, ms */));
-        consumer_watch.stop();
-        switch (msg->err()) {
-        case RdKafka::ERR_NO_ERROR:
-            if (msg->len() == 0) {
+        while (!batch_end && batch->size() < config::routine_load_consume_batch_size) {
+            std::unique_ptr<RdKafka::Message> msg(
+                    _k_consumer->consume(batch->empty() ? 1000 : 0 /* timeout, ms */));
+            switch (msg->err()) {
+            case RdKafka::ERR_NO_ERROR:
                 // ignore msg with length 0.
                 // put empty msg into queue will cause the load process shutting down.
+                if (msg->len() > 0) {
+                    batch->push_back(std::move(msg));
+                }
+                ++received_rows;
+                break;
+            case RdKafka::ERR__TIMED_OUT:
+                // leave the status as OK, because this may happened
+                // if there is no data in kafka.
+                if (batch->empty()) {
+                    LOG(INFO) << "kafka consume timeout: " << _id;
+                }
+                batch_end = true;
                 break;
-            } else if (!queue->blocking_put(msg.get())) {
+            case RdKafka::ERR__TRANSPORT:
+                LOG(INFO) << "kafka consume Disconnected: " << _id
+                          << ", retry times: " << retry_times++;
+                batch_end = true;
+                if (retry_times <= MAX_RETRY_TIMES_FOR_TRANSPORT_FAILURE) {
+                    std::this_thread::sleep_for(std::chrono::milliseconds(200));
+                    break;
+                }
+                [[fallthrough]];
+            default:
+                LOG(WARNING) << "kafka consume failed: " << _id << ", msg: " << msg->errstr();
+                done = true;
+                batch_end = true;
+                st = Status::InternalError(msg->errstr());
+                break;
+            }
+        }
+        consumer_watch.stop();
+        if (!batch->empty()) {
+            size_t batch_rows = batch->size();
+            if (!queue->blocking_put(batch.get())) {
                 // queue is shutdown
                 done = true;
             } else {
-                ++put_rows;
-                msg.release(); // release the ownership, msg will be deleted after being processed
+                put_rows += batch_rows;
+                // release the ownership, the batch will be deleted after being processed
+                static_cast<void>(batch.release());
             }
-            ++received_rows;
-            break;
-        case RdKafka::ERR__TIMED_OUT:
-            // leave the status as OK, because this may happened
-            // if there is no data in kafka.
-            LOG(INFO) << "kafka consume timeout: " << _id;
-            break;
-        case RdKafka::ERR__TRANSPORT:
-            LOG(INFO) << "kafka consume Disconnected: " << _id
-                      << ", retry times: " << retry_times++;
-            if (retry_times <= MAX_RETRY_TIMES_FOR_TRANSPORT_FAILURE) {
-                std::this_thread::sleep_for(std::chrono::milliseconds(200));
-                break;
-            }
-            [[fallthrough]];
-        default:
-            LOG(WARNING) << "kafka consume failed: " << _id << ", msg: " << msg->errstr();
-            done = true;
-            st = Status::InternalError(msg->errstr());
-            break;
         }
 
         left_time = max_running_time_ms - watch.elapsed_time() / 1000 / 1000;
@@ -254,15 +269,40 @@ Status KafkaDataConsumer::group_consume(BlockingQueue<RdKafka::Message*>* queue,
         }
     }
 
+    _lag = _get_lag();
     LOG(INFO) << "kafka consumer done: " << _id << ", grp: " << _grp_id
               << ". cancelled: " << _cancelled << ", left time(ms): " << left_time
               << ", total cost(ms): " << watch.elapsed_time() / 1000 / 1000
               << ", consume cost(ms): " << consumer_watch.elapsed_time() / 1000 / 1000
-              << ", received rows: " << received_rows << ", put rows: " << put_rows;
+              << ", received rows: " << received_rows << ", put rows: " << put_rows
+              << ", lag: " << _lag;
 
     return st;
 }
 
+int64_t KafkaDataConsumer::_get_lag() {
+    std::vector<RdKafka::TopicPartition*> partitions;
+    Defer delete_partitions {[&partitions]() { RdKafka::TopicPartition::destroy(partitions); }};
+    if (_k_consumer->assignment(partitions) != RdKafka::ERR_NO_ERROR ||
+        _k_consumer->position(partitions) != RdKafka::ERR_NO_ERROR) {
+        return -1;
+    }
+    int64_t lag = 0;
+    for (auto* partition : partitions) {
+        int64_t low = 0;
+        int64_t high = 0;
+        // the cached watermarks, not to query the brokers
+        if (partition->offset() < 0 ||
+            _k_consumer->get_watermark_offsets(partition->topic(), partition->partition(), &low,
+                                               &high) != RdKafka::ERR_NO_ERROR ||
+            high < 0) {
+            return -1;
+        }
+        lag += std::max<int64_t>(0, high - partition->offset());
+    }
+    return lag;
+}
+
 Status KafkaDataConsumer::get_partition_meta(std::vector<int32_t>* partition_ids) {
     // create topic conf
     RdKafka::Conf* tconf = RdKafka::Conf::create(RdKafka::Conf::CONF_TOPIC);
@@ -39,6 +39,9 @@ namespace doris {
 template <typename T>
 class BlockingQueue;
 
+// the kafka messages taken by a consumer at a time
+using KafkaMessageBatch = std::vector<std::unique_ptr<RdKafka::Message>>;
+
 class DataConsumer {
 public:
     DataConsumer()
@@ -144,8 +147,12 @@ public:
                                    const std::string& topic,
                                    std::shared_ptr<StreamLoadContext> ctx);
 
-    // start the consumer and put msgs to queue
-    Status group_consume(BlockingQueue<RdKafka::Message*>* queue, int64_t max_running_time_ms);
+    // start the consumer and put batches of msgs to queue
+    Status group_consume(BlockingQueue<KafkaMessageBatch*>* queue, int64_t max_running_time_ms);
+
+    // the messages left in the assigned partitions when group_consume returns, from the high
+    // watermarks cached by the consumer, -1 if unknown
+    int64_t lag() const { return _lag; }
 
     // get the partitions ids of the topic
     Status get_partition_meta(std::vector<int32_t>* partition_ids);
@@ -157,12 +164,15 @@ public:
                                              std::vector<PIntegerPair>* offsets);
 
 private:
+    int64_t _get_lag();
+
     std::string _brokers;
     std::string _topic;
     std::unordered_map<std::string, std::string> _custom_properties;
 
     KafkaEventCb _k_event_cb;
     RdKafka::KafkaConsumer* _k_consumer = nullptr;
+    int64_t _lag = -1;
 };
 
 } // end namespace doris
@@ -24,11 +24,13 @@
 #include <string>
 #include <utility>
 
+#include "common/config.h"
 #include "common/logging.h"
 #include "io/fs/kafka_consumer_pipe.h"
 #include "librdkafka/rdkafkacpp.h"
 #include "runtime/routine_load/data_consumer.h"
 #include "runtime/stream_load/stream_load_context.h"
+#include "util/doris_metrics.h"
 #include "util/stopwatch.hpp"
 
 namespace doris {
@@ -61,10 +63,10 @@ KafkaDataConsumerGroup::~KafkaDataConsumerGroup() {
     // clean the msgs left in queue
     _queue.shutdown();
     while (true) {
-        RdKafka::Message* msg;
-        if (_queue.blocking_get(&msg)) {
-            delete msg;
-            msg = nullptr;
+        KafkaMessageBatch* batch;
+        if (_queue.blocking_get(&batch)) {
+            delete batch;
+            batch = nullptr;
         } else {
             break;
         }
@@ -122,6 +124,10 @@ Status KafkaDataConsumerGroup::start_all(std::shared_ptr<StreamLoadContext> ctx)
     } else {
         append_data = &io::KafkaConsumerPipe::append_with_line_delimiter;
     }
+    // a json message is a buffer of the pipe, which can reference its payload. The csv
+    // messages are small lines better coalesced into the chunks of the pipe.
+    bool json_by_reference = ctx->format == TFileFormatType::FORMAT_JSON &&
+                             !ctx->is_multi_table && config::enable_stream_load_zero_copy;
 
     MonotonicStopWatch watch;
     watch.start();
@@ -148,6 +154,19 @@ Status KafkaDataConsumerGroup::start_all(std::shared_ptr<StreamLoadContext> ctx)
             // waiting all threads finished
             _thread_pool.shutdown();
             _thread_pool.join();
+            ctx->kafka_info->lag = 0;
+            for (auto& consumer : _consumers) {
+                int64_t lag = std::static_pointer_cast<KafkaDataConsumer>(consumer)->lag();
+                if (lag < 0) {
+                    ctx->kafka_info->lag = -1;
+                    break;
+                }
+                ctx->kafka_info->lag += lag;
+            }
+            DorisMetrics::instance()->routine_load_consume_rows_total->increment(
+                    ctx->max_batch_rows - left_rows);
+            DorisMetrics::instance()->routine_load_consume_bytes_total->increment(
+                    ctx->max_batch_size - left_bytes);
             if (!result_st.ok()) {
                 kafka_pipe->cancel(result_st.to_string());
                 return result_st;
@@ -158,33 +177,46 @@ Status KafkaDataConsumerGroup::start_all(std::shared_ptr<StreamLoadContext> ctx)
             return Status::OK();
         }
 
-        RdKafka::Message* msg;
-        bool res = _queue.blocking_get(&msg);
+        KafkaMessageBatch* batch;
+        bool res = _queue.blocking_get(&batch);
         if (res) {
-            VLOG_NOTICE << "get kafka message"
-                        << ", partition: " << msg->partition() << ", offset: " << msg->offset()
-                        << ", len: " << msg->len();
-
-            Status st = (kafka_pipe.get()->*append_data)(static_cast<const char*>(msg->payload()),
-                                                         static_cast<size_t>(msg->len()));
-            if (st.ok()) {
-                left_rows--;
-                left_bytes -= msg->len();
-                cmt_offset[msg->partition()] = msg->offset();
-                VLOG_NOTICE << "consume partition[" << msg->partition() << " - " << msg->offset()
-                            << "]";
-            } else {
-                // failed to append this msg, we must stop
-                LOG(WARNING) << "failed to append msg to pipe. grp: " << _grp_id;
-                eos = true;
-                {
-                    std::unique_lock<std::mutex> lock(_mutex);
-                    if (result_st.ok()) {
-                        result_st = st;
+            std::unique_ptr<KafkaMessageBatch> batch_holder(batch);
+            // the rest of the batch is dropped once the limits are reached, to be consumed by
+            // the next task as its offsets are not committed
+            for (size_t i = 0; i < batch->size() && !eos && left_rows > 0 && left_bytes > 0;
+                 ++i) {
+                auto& msg = (*batch)[i];
+                int32_t partition = msg->partition();
+                int64_t offset = msg->offset();
+                size_t len = msg->len();
+                VLOG_NOTICE << "get kafka message"
+                            << ", partition: " << partition << ", offset: " << offset
+                            << ", len: " << len;
+
+                Status st;
+                if (json_by_reference) {
+                    st = kafka_pipe->append_json_message(std::move(msg));
+                } else {
+                    st = (kafka_pipe.get()->*append_data)(
+                            static_cast<const char*>(msg->payload()), len);
+                }
+                if (st.ok()) {
+                    left_rows--;
+                    left_bytes -= len;
+                    cmt_offset[partition] = offset;
+                    VLOG_NOTICE << "consume partition[" << partition << " - " << offset << "]";
+                } else {
+                    // failed to append this msg, we must stop
+                    LOG(WARNING) << "failed to append msg to pipe. grp: " << _grp_id;
+                    eos = true;
+                    {
+                        std::unique_lock<std::mutex> lock(_mutex);
+                        if (result_st.ok()) {
+                            result_st = st;
+                        }
                     }
                 }
             }
-            delete msg;
         } else {
             // queue is empty and shutdown
             eos = true;
@@ -197,7 +229,7 @@ Status KafkaDataConsumerGroup::start_all(std::shared_ptr<StreamLoadContext> ctx)
 }
 
 void KafkaDataConsumerGroup::actual_consume(std::shared_ptr<DataConsumer> consumer,
-                                            BlockingQueue<RdKafka::Message*>* queue,
+                                            BlockingQueue<KafkaMessageBatch*>* queue,
                                             int64_t max_running_time_ms, ConsumeFinishCallback cb) {
     Status st = std::static_pointer_cast<KafkaDataConsumer>(consumer)->group_consume(
             queue, max_running_time_ms);
@@ -19,21 +19,19 @@
 
 #include <stdint.h>
 
+#include <algorithm>
 #include <functional>
 #include <memory>
 #include <mutex>
 #include <vector>
 
+#include "common/config.h"
 #include "common/status.h"
 #include "runtime/routine_load/data_consumer.h"
 #include "util/blocking_queue.hpp"
 #include "util/priority_thread_pool.hpp"
 #include "util/uid_util.h"
 
-namespace RdKafka {
-class Message;
-} // namespace RdKafka
-
 namespace doris {
 class StreamLoadContext;
 
@@ -78,7 +76,10 @@ protected:
 // for kafka
 class KafkaDataConsumerGroup : public DataConsumerGroup {
 public:
-    KafkaDataConsumerGroup() : DataConsumerGroup(), _queue(500) {}
+    // the queue holds about 500 messages as before the batches
+    KafkaDataConsumerGroup()
+            : DataConsumerGroup(),
+              _queue(std::max(1, 500 / std::max(1, config::routine_load_consume_batch_size))) {}
 
     virtual ~KafkaDataConsumerGroup();
 
@@ -89,12 +90,12 @@ public:
 private:
     // start a single consumer
     void actual_consume(std::shared_ptr<DataConsumer> consumer,
-                        BlockingQueue<RdKafka::Message*>* queue, int64_t max_running_time_ms,
+                        BlockingQueue<KafkaMessageBatch*>* queue, int64_t max_running_time_ms,
                         ConsumeFinishCallback cb);
 
 private:
-    // blocking queue to receive msgs from all consumers
-    BlockingQueue<RdKafka::Message*> _queue;
+    // blocking queue to receive the batches of msgs from all consumers
+    BlockingQueue<KafkaMessageBatch*> _queue;
 };
 
 } // end namespace doris
@@ -61,6 +61,7 @@ namespace doris {
 using namespace ErrorCode;
 
 DEFINE_GAUGE_METRIC_PROTOTYPE_2ARG(routine_load_task_count, MetricUnit::NOUNIT);
+DEFINE_GAUGE_METRIC_PROTOTYPE_2ARG(routine_load_consume_lag, MetricUnit::NOUNIT);
 
 RoutineLoadTaskExecutor::RoutineLoadTaskExecutor(ExecEnv* exec_env)
         : _exec_env(exec_env),
@@ -71,12 +72,14 @@ RoutineLoadTaskExecutor::RoutineLoadTaskExecutor(ExecEnv* exec_env)
         // std::lock_guard<std::mutex> l(_lock);
         return _task_map.size();
     });
+    REGISTER_HOOK_METRIC(routine_load_consume_lag, [this]() { return _consume_lag(); });
 
     _data_consumer_pool.start_bg_worker();
 }
 
 RoutineLoadTaskExecutor::~RoutineLoadTaskExecutor() {
     DEREGISTER_HOOK_METRIC(routine_load_task_count);
+    DEREGISTER_HOOK_METRIC(routine_load_consume_lag);
     _thread_pool.shutdown();
     _thread_pool.join();
 
@@ -346,6 +349,11 @@ void RoutineLoadTaskExecutor::exec_task(std::shared_ptr<StreamLoadContext> ctx,
 
     // wait for all consumers finished
     HANDLE_ERROR(ctx->future.get(), "consume failed");
+    DorisMetrics::instance()->routine_load_decode_rows_total->increment(ctx->number_total_rows);
+    if (ctx->kafka_info != nullptr && ctx->kafka_info->lag >= 0) {
+        std::lock_guard<std::mutex> l(_lag_lock);
+        _job_lags[ctx->job_id] = {ctx->kafka_info->lag, MonotonicSeconds()};
+    }
 
     ctx->load_cost_millis = UnixMillis() - ctx->start_millis;
 
@@ -396,6 +404,22 @@ void RoutineLoadTaskExecutor::exec_task(std::shared_ptr<StreamLoadContext> ctx,
     cb(ctx);
 }
 
+uint64_t RoutineLoadTaskExecutor::_consume_lag() {
+    static constexpr int64_t LAG_EXPIRE_SECONDS = 600;
+    int64_t now = MonotonicSeconds();
+    uint64_t lag = 0;
+    std::lock_guard<std::mutex> l(_lag_lock);
+    for (auto it = _job_lags.begin(); it != _job_lags.end();) {
+        if (now - it->second.second > LAG_EXPIRE_SECONDS) {
+            it = _job_lags.erase(it);
+        } else {
+            lag += it->second.first;
+            ++it;
+        }
+    }
+    return lag;
+}
+
 void RoutineLoadTaskExecutor::err_handler(std::shared_ptr<StreamLoadContext> ctx, const Status& st,
                                           const std::string& err_msg) {
     LOG(WARNING) << err_msg << ", routine load task: " << ctx->brief(true);
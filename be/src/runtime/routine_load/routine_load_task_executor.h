@@ -24,6 +24,7 @@
 #include <mutex>
 #include <string>
 #include <unordered_map>
+#include <utility>
 #include <vector>
 
 #include "runtime/routine_load/data_consumer_pool.h"
@@ -85,6 +86,13 @@ private:
     std::mutex _lock;
     // task id -> load context
     std::unordered_map<UniqueId, std::shared_ptr<StreamLoadContext>> _task_map;
+
+    // the sum of the lags left by the last tasks of the jobs in the last 10 minutes
+    uint64_t _consume_lag();
+
+    std::mutex _lag_lock;
+    // job id -> (lag of its last task, monotonic seconds of the task)
+    std::unordered_map<int64_t, std::pair<int64_t, int64_t>> _job_lags;
 };
 
 } // namespace doris
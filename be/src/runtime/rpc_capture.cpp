@@ -0,0 +1,177 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "runtime/rpc_capture.h"
+
+#include <google/protobuf/message.h>
+#include <unistd.h>
+
+#include <sstream>
+
+#include "common/config.h"
+#include "common/logging.h"
+#include "http/http_request.h"
+#include "io/fs/local_file_system.h"
+#include "util/coding.h"
+#include "util/easy_json.h"
+#include "util/slice.h"
+#include "util/time.h"
+
+namespace doris {
+
+RpcCapture* RpcCapture::instance() {
+    static RpcCapture capture;
+    return &capture;
+}
+
+Status RpcCapture::start(int64_t duration_s) {
+    if (duration_s <= 0) {
+        return Status::InvalidArgument("invalid duration of rpc capture: {}", duration_s);
+    }
+    std::lock_guard l(_lock);
+    if (_capturing) {
+        return Status::AlreadyExist("rpc capture {} is running", _path);
+    }
+    RETURN_IF_ERROR(io::global_local_filesystem()->create_directory(config::rpc_capture_dir));
+    std::stringstream path;
+    path << config::rpc_capture_dir << "/rpc_capture." << UnixMillis() << "." << getpid();
+    _path = path.str();
+    RETURN_IF_ERROR(io::global_local_filesystem()->create_file(_path, &_writer));
+    _start_us = MonotonicMicros();
+    _end_us = _start_us + duration_s * 1000 * 1000;
+    _num_records = 0;
+    _last_error = Status::OK();
+    _capturing = true;
+    LOG(INFO) << "start rpc capture " << _path << ", duration_s=" << duration_s;
+    return Status::OK();
+}
+
+Status RpcCapture::stop() {
+    std::lock_guard l(_lock);
+    return _stop_locked();
+}
+
+Status RpcCapture::_stop_locked() {
+    if (!_capturing) {
+        return Status::OK();
+    }
+    _capturing = false;
+    Status st = _writer->close();
+    _writer.reset();
+    LOG(INFO) << "stop rpc capture " << _path << ", records=" << _num_records
+              << ", status=" << st;
+    if (!st.ok() && _last_error.ok()) {
+        _last_error = st;
+    }
+    return st;
+}
+
+void RpcCapture::_capture(PCapturedRequestType type, const google::protobuf::Message& request) {
+    PCapturedRequest record;
+    record.set_type(type);
+    if (!request.SerializeToString(record.mutable_request())) {
+        LOG_EVERY_N(WARNING, 100) << "failed to serialize captured request, type=" << type;
+        return;
+    }
+    _write(&record);
+}
+
+void RpcCapture::capture_stream_load_begin(HttpRequest* req, const std::string& label,
+                                           const std::string& db, const std::string& table) {
+    if (!capturing()) {
+        return;
+    }
+    PCapturedRequest record;
+    record.set_type(CAPTURED_STREAM_LOAD_BEGIN);
+    record.set_label(label);
+    record.set_db(db);
+    record.set_table(table);
+    for (const auto& [key, value] : req->headers()) {
+        (*record.mutable_headers())[key] = value;
+    }
+    _write(&record);
+}
+
+void RpcCapture::capture_stream_load_body(const std::string& label, const char* data,
+                                          size_t size) {
+    if (!capturing()) {
+        return;
+    }
+    PCapturedRequest record;
+    record.set_type(CAPTURED_STREAM_LOAD_BODY);
+    record.set_label(label);
+    record.set_body(data, size);
+    _write(&record);
+}
+
+void RpcCapture::capture_stream_load_end(const std::string& label) {
+    if (!capturing()) {
+        return;
+    }
+    PCapturedRequest record;
+    record.set_type(CAPTURED_STREAM_LOAD_END);
+    record.set_label(label);
+    _write(&record);
+}
+
+void RpcCapture::_write(PCapturedRequest* record) {
+    std::lock_guard l(_lock);
+    if (!_capturing) {
+        return;
+    }
+    int64_t now_us = MonotonicMicros();
+    if (now_us >= _end_us) {
+        static_cast<void>(_stop_locked());
+        return;
+    }
+    record->set_offset_us(now_us - _start_us);
+    std::string buf;
+    record->SerializeToString(&buf);
+    uint8_t size_buf[sizeof(uint32_t)];
+    encode_fixed32_le(size_buf, buf.size());
+    Slice slices[2] = {Slice(size_buf, sizeof(size_buf)), Slice(buf)};
+    Status st = _writer->appendv(slices, 2);
+    if (!st.ok()) {
+        LOG(WARNING) << "failed to write rpc capture " << _path << ": " << st;
+        _last_error = st;
+        static_cast<void>(_stop_locked());
+        return;
+    }
+    ++_num_records;
+    if (_writer->bytes_appended() >= config::rpc_capture_max_bytes) {
+        static_cast<void>(_stop_locked());
+    }
+}
+
+void RpcCapture::to_json(EasyJson* json) {
+    std::lock_guard l(_lock);
+    if (_capturing && MonotonicMicros() >= _end_us) {
+        static_cast<void>(_stop_locked());
+    }
+    (*json)["capturing"] = _capturing.load();
+    (*json)["path"] = _path;
+    (*json)["records"] = _num_records;
+    if (_capturing) {
+        (*json)["remaining_s"] = (_end_us - MonotonicMicros()) / (1000 * 1000);
+        (*json)["bytes"] = static_cast<int64_t>(_writer->bytes_appended());
+    }
+    if (!_last_error.ok()) {
+        (*json)["error"] = _last_error.to_string();
+    }
+}
+
+} // namespace doris
@@ -0,0 +1,90 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <gen_cpp/internal_service.pb.h>
+#include <stdint.h>
+
+#include <atomic>
+#include <mutex>
+#include <string>
+
+#include "common/status.h"
+#include "io/fs/file_writer.h"
+
+namespace google {
+namespace protobuf {
+class Message;
+} // namespace protobuf
+} // namespace google
+
+namespace doris {
+
+class EasyJson;
+class HttpRequest;
+
+// Captures the fragment and load requests received by this BE in a time window, to be
+// replayed against a test BE by tools/rpc_replay_tool.
+//
+// A capture file of config::rpc_capture_dir is a sequence of records, each one a fixed32 of
+// the size of a serialized PCapturedRequest followed by it. The records are written under a
+// lock by the threads receiving the requests, a capture is meant to be short.
+class RpcCapture {
+public:
+    static RpcCapture* instance();
+
+    // Starts a capture of `duration_s` seconds, stopped earlier by stop() or when its file
+    // reaches config::rpc_capture_max_bytes.
+    Status start(int64_t duration_s);
+    Status stop();
+
+    bool capturing() const { return _capturing.load(std::memory_order_relaxed); }
+
+    // Records an rpc request, its block has to be moved out of the attachment already.
+    void capture(PCapturedRequestType type, const google::protobuf::Message& request) {
+        if (capturing()) {
+            _capture(type, request);
+        }
+    }
+
+    // The records of a stream load, the body is recorded by chunks as received.
+    void capture_stream_load_begin(HttpRequest* req, const std::string& label,
+                                   const std::string& db, const std::string& table);
+    void capture_stream_load_body(const std::string& label, const char* data, size_t size);
+    void capture_stream_load_end(const std::string& label);
+
+    // The state of the current or the last capture, which is stopped if expired.
+    void to_json(EasyJson* json);
+
+private:
+    void _capture(PCapturedRequestType type, const google::protobuf::Message& request);
+    void _write(PCapturedRequest* record);
+    Status _stop_locked();
+
+    std::atomic<bool> _capturing {false};
+
+    std::mutex _lock;
+    io::FileWriterPtr _writer;
+    std::string _path;
+    int64_t _start_us = 0;
+    int64_t _end_us = 0;
+    int64_t _num_records = 0;
+    Status _last_error;
+};
+
+} // namespace doris
@@ -0,0 +1,60 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+
+#include "runtime/runtime_filter_cache.h"
+
+#include <glog/logging.h>
+
+namespace doris {
+
+RuntimeFilterCache* RuntimeFilterCache::_s_instance = nullptr;
+
+RuntimeFilterCache::RuntimeFilterCache(int64_t capacity, uint32_t num_shards) {
+    _cache = std::unique_ptr<Cache>(
+            new_lru_cache("RuntimeFilterCache", capacity, LRUCacheType::SIZE, num_shards));
+}
+
+void RuntimeFilterCache::create_global_cache(int64_t capacity, uint32_t num_shards) {
+    DCHECK(_s_instance == nullptr);
+    static RuntimeFilterCache instance(capacity, num_shards);
+    _s_instance = &instance;
+}
+
+RuntimeFilterCache* RuntimeFilterCache::instance() {
+    return _s_instance;
+}
+
+bool RuntimeFilterCache::lookup(const std::string& key, CacheValue* value) {
+    auto* handle = _cache->lookup(key);
+    if (handle == nullptr) {
+        return false;
+    }
+    *value = *reinterpret_cast<CacheValue*>(_cache->value(handle));
+    _cache->release(handle);
+    return true;
+}
+
+void RuntimeFilterCache::insert(const std::string& key, const CacheValue& value, size_t charge) {
+    auto deleter = [](const doris::CacheKey& key, void* value) {
+        delete reinterpret_cast<CacheValue*>(value);
+    };
+    auto* handle = _cache->insert(key, new CacheValue(value), charge, deleter);
+    _cache->release(handle);
+}
+
+} // namespace doris
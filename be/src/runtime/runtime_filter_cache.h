@@ -0,0 +1,63 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <memory>
+#include <string>
+
+#include "olap/lru_cache.h"
+#include "vec/runtime/shared_hash_table_controller.h"
+
+namespace doris {
+
+// RuntimeFilterCache keeps the runtime filters published by previous queries, keyed by the
+// fingerprint of the build side computed by FE (see TRuntimeFilterDesc.cache_key), which covers
+// the scanned tablets and their versions. A consumer whose filter is found in the cache applies
+// it at once instead of waiting for its own join to finish the build.
+// The cached filter functions are shared by all the queries and never modified after publish.
+class RuntimeFilterCache {
+public:
+    struct CacheValue {
+        vectorized::SharedRuntimeFilterContext context;
+        // the real type of an IN_OR_BLOOM filter
+        bool is_bloomfilter = false;
+    };
+
+    // Create global instance of this class
+    static void create_global_cache(int64_t capacity, uint32_t num_shards = kDefaultNumShards);
+
+    static RuntimeFilterCache* instance();
+
+    // Return true and fill `value` if the key is found.
+    bool lookup(const std::string& key, CacheValue* value);
+
+    // `charge` is the estimated memory used by the filter.
+    void insert(const std::string& key, const CacheValue& value, size_t charge);
+
+private:
+    static constexpr uint32_t kDefaultNumShards = 16;
+    RuntimeFilterCache(int64_t capacity, uint32_t num_shards);
+    static RuntimeFilterCache* _s_instance;
+    std::unique_ptr<Cache> _cache;
+};
+
+} // namespace doris
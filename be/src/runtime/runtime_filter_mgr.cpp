@@ -288,11 +288,20 @@ Status RuntimeFilterMergeControllerEntity::merge(const PMergeFilterRequest* requ
         if (auto bf = cntVal->filter->get_bloomfilter()) {
             RETURN_IF_ERROR(bf->init_with_fixed_length());
         }
-        MergeRuntimeFilterParams params(request, attach_data);
-        ObjectPool* pool = iter->second->pool.get();
-        RuntimeFilterWrapperHolder holder;
-        RETURN_IF_ERROR(IRuntimeFilter::create_wrapper(_state, &params, pool, holder.getHandle()));
-        RETURN_IF_ERROR(cntVal->filter->merge_from(holder.getHandle()->get()));
+        if (request->filter_type() == PFilterType::BLOOM_FILTER &&
+            cntVal->filter->type() == RuntimeFilterType::BLOOM_FILTER) {
+            // or the bloom filter of the producer into the merged one as it is received
+            DCHECK(request->has_bloom_filter());
+            RETURN_IF_ERROR(cntVal->filter->get_bloomfilter()->merge(
+                    attach_data, request->bloom_filter().filter_length()));
+        } else {
+            MergeRuntimeFilterParams params(request, attach_data);
+            ObjectPool* pool = iter->second->pool.get();
+            RuntimeFilterWrapperHolder holder;
+            RETURN_IF_ERROR(
+                    IRuntimeFilter::create_wrapper(_state, &params, pool, holder.getHandle()));
+            RETURN_IF_ERROR(cntVal->filter->merge_from(holder.getHandle()->get()));
+        }
         cntVal->arrive_id.insert(UniqueId(request->fragment_id()).to_string());
         merged_size = cntVal->arrive_id.size();
         // TODO: avoid log when we had acquired a lock
@@ -354,7 +363,7 @@ Status RuntimeFilterMergeControllerEntity::merge(const PMergeFilterRequest* requ
                 }
 
                 std::shared_ptr<PBackendService_Stub> stub(
-                        ExecEnv::GetInstance()->brpc_internal_client_cache()->get_client(
+                        ExecEnv::GetInstance()->brpc_internal_client_cache()->get_control_client(
                                 targets[i].target_fragment_instance_addr));
                 VLOG_NOTICE << "send filter " << rpc_contexts[cur]->request.filter_id()
                             << " to:" << targets[i].target_fragment_instance_addr.hostname << ":"
@@ -415,7 +424,7 @@ Status RuntimeFilterMergeControllerEntity::merge(const PMergeFilterRequest* requ
                 request_fragment_id->set_lo(targets[cur].target_fragment_instance_id.lo);
 
                 std::shared_ptr<PBackendService_Stub> stub(
-                        ExecEnv::GetInstance()->brpc_internal_client_cache()->get_client(
+                        ExecEnv::GetInstance()->brpc_internal_client_cache()->get_control_client(
                                 targets[i].target_fragment_instance_addr));
                 VLOG_NOTICE << "send filter " << rpc_contexts[cur]->request.filter_id()
                             << " to:" << targets[i].target_fragment_instance_addr.hostname << ":"
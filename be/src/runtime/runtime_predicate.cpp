@@ -132,11 +132,6 @@ Status RuntimePredicate::update(const Field& value, const String& col_name, bool
 
     std::unique_lock<std::shared_mutex> wlock(_rwlock);
 
-    // TODO why null
-    if (!_tablet_schema) {
-        return Status::OK();
-    }
-
     bool updated = false;
 
     if (UNLIKELY(_orderby_extrem.is_null())) {
@@ -157,6 +152,14 @@ Status RuntimePredicate::update(const Field& value, const String& col_name, bool
     if (!updated) {
         return Status::OK();
     }
+    _col_name = col_name;
+    _is_reverse = is_reverse;
+
+    // TODO why null
+    // the boundary is still kept for the scans without tablet schema, e.g. file scans
+    if (!_tablet_schema) {
+        return Status::OK();
+    }
 
     // update _predictate
     int32_t col_unique_id = _tablet_schema->column(col_name).unique_id();
@@ -187,5 +190,77 @@ Status RuntimePredicate::update(const Field& value, const String& col_name, bool
     return Status::OK();
 }
 
+template <typename T>
+struct ValueRangeTraits;
+
+template <PrimitiveType type>
+struct ValueRangeTraits<ColumnValueRange<type>> {
+    static constexpr PrimitiveType primitive_type = type;
+};
+
+template <PrimitiveType primitive_type>
+static bool get_cpp_value(const Field& field,
+                          typename PrimitiveTypeTraits<primitive_type>::CppType* value) {
+    using ValueType = typename PrimitiveTypeTraits<primitive_type>::CppType;
+    if constexpr (primitive_type == TYPE_TINYINT || primitive_type == TYPE_SMALLINT ||
+                  primitive_type == TYPE_INT || primitive_type == TYPE_BIGINT ||
+                  primitive_type == TYPE_LARGEINT) {
+        *value = field.get<ValueType>();
+    } else if constexpr (primitive_type == TYPE_DATE) {
+        Int64 v = field.get<Int64>();
+        value->from_olap_date(((VecDateTimeValue*)&v)->to_olap_date());
+        value->cast_to_date();
+    } else if constexpr (primitive_type == TYPE_DATETIME) {
+        Int64 v = field.get<Int64>();
+        value->from_olap_datetime(((VecDateTimeValue*)&v)->to_olap_datetime());
+        value->to_datetime();
+    } else if constexpr (primitive_type == TYPE_DATEV2) {
+        *value = binary_cast<UInt32, ValueType>(field.get<UInt32>());
+    } else if constexpr (primitive_type == TYPE_DATETIMEV2) {
+        *value = binary_cast<UInt64, ValueType>(field.get<UInt64>());
+    } else if constexpr (primitive_type == TYPE_DECIMALV2) {
+        *value = DecimalV2Value(field.get<DecimalField<Decimal128>>().get_value().value);
+    } else if constexpr (primitive_type == TYPE_DECIMAL32) {
+        *value = field.get<DecimalField<Decimal32>>().get_value().value;
+    } else if constexpr (primitive_type == TYPE_DECIMAL64) {
+        *value = field.get<DecimalField<Decimal64>>().get_value().value;
+    } else if constexpr (primitive_type == TYPE_DECIMAL128I) {
+        *value = field.get<DecimalField<Decimal128I>>().get_value().value;
+    } else {
+        // the topn opt is not planned for the float and string types
+        return false;
+    }
+    return true;
+}
+
+bool RuntimePredicate::narrow_value_range(
+        std::unordered_map<std::string, ColumnValueRangeType>* colname_to_value_range) {
+    std::shared_lock<std::shared_mutex> rlock(_rwlock);
+    if (_orderby_extrem.is_null() || _nulls_first) {
+        return false;
+    }
+    auto it = colname_to_value_range->find(_col_name);
+    if (it == colname_to_value_range->end()) {
+        return false;
+    }
+    bool narrowed = false;
+    std::visit(
+            [&](auto& range) {
+                constexpr PrimitiveType primitive_type =
+                        ValueRangeTraits<std::decay_t<decltype(range)>>::primitive_type;
+                typename PrimitiveTypeTraits<primitive_type>::CppType value {};
+                if (!get_cpp_value<primitive_type>(_orderby_extrem, &value)) {
+                    return;
+                }
+                // the same as the column predicate created by update
+                narrowed = range.add_range(_is_reverse ? FILTER_LARGER_OR_EQUAL
+                                                       : FILTER_LESS_OR_EQUAL,
+                                           value)
+                                   .ok();
+            },
+            it->second);
+    return narrowed;
+}
+
 } // namespace vectorized
 } // namespace doris
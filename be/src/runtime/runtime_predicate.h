@@ -22,6 +22,7 @@
 #include <mutex>
 #include <shared_mutex>
 #include <string>
+#include <unordered_map>
 
 #include "common/status.h"
 #include "exec/olap_common.h"
@@ -62,9 +63,20 @@ public:
 
     Status update(const Field& value, const String& col_name, bool is_reverse);
 
+    // Narrow the value range of the order by column to the values which may still enter the
+    // topn, for the scans which prune data by statistics but can not evaluate the column
+    // predicate, e.g. the row groups of parquet and the stripes of orc. The nulls are not
+    // kept in the range, so nothing is narrowed for NULLS FIRST.
+    // Return false if there is no boundary yet.
+    bool narrow_value_range(
+            std::unordered_map<std::string, ColumnValueRangeType>* colname_to_value_range);
+
 private:
     mutable std::shared_mutex _rwlock;
     Field _orderby_extrem {Field::Types::Null};
+    // the order by column and direction of the boundary
+    std::string _col_name;
+    bool _is_reverse = false;
     std::shared_ptr<ColumnPredicate> _predictate {nullptr};
     TabletSchemaSPtr _tablet_schema;
     std::unique_ptr<Arena> _predicate_arena;
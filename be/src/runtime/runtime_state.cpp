@@ -24,6 +24,7 @@
 #include <gen_cpp/PaloInternalService_types.h>
 #include <gen_cpp/Types_types.h>
 
+#include <algorithm>
 #include <string>
 
 #include "common/config.h"
@@ -251,6 +252,18 @@ std::shared_ptr<MemTrackerLimiter> RuntimeState::query_mem_tracker() const {
     return _query_mem_tracker;
 }
 
+int RuntimeState::adaptive_batch_size(size_t avg_row_bytes) const {
+    // too small blocks make the per block overhead dominate
+    static constexpr int64_t MIN_ADAPTIVE_BATCH_SIZE = 64;
+    int64_t preferred_bytes = preferred_block_size_bytes();
+    if (preferred_bytes <= 0 || avg_row_bytes == 0) {
+        return batch_size();
+    }
+    int64_t rows = preferred_bytes / avg_row_bytes;
+    rows = std::max(rows, MIN_ADAPTIVE_BATCH_SIZE);
+    return std::min(rows, static_cast<int64_t>(batch_size()));
+}
+
 bool RuntimeState::log_error(const std::string& error) {
     std::lock_guard<std::mutex> l(_error_log_lock);
 
@@ -316,6 +316,12 @@ public:
         return segment_v2::CompressionTypePB::SNAPPY;
     }
 
+    // Whether to choose the codec of the exchanged blocks at runtime among none, lz4 and zstd
+    bool fragment_transmission_compression_adaptive() const {
+        return _query_options.__isset.fragment_transmission_compression_codec &&
+               _query_options.fragment_transmission_compression_codec == "adaptive";
+    }
+
     bool skip_storage_engine_merge() const {
         return _query_options.__isset.skip_storage_engine_merge &&
                _query_options.skip_storage_engine_merge;
@@ -373,6 +379,11 @@ public:
 
     bool enable_profile() const { return _query_options.is_report_success; }
 
+    bool enable_operator_perf_counters() const {
+        return _query_options.__isset.enable_operator_perf_counters &&
+               _query_options.enable_operator_perf_counters;
+    }
+
     bool enable_scan_node_run_serial() const {
         return _query_options.__isset.enable_scan_node_run_serial &&
                _query_options.enable_scan_node_run_serial;
@@ -409,6 +420,46 @@ public:
                        : 0;
     }
 
+    int64_t external_join_bytes_threshold() const {
+        return _query_options.__isset.external_join_bytes_threshold
+                       ? _query_options.external_join_bytes_threshold
+                       : 0;
+    }
+
+    int external_join_partition_bits() const {
+        return _query_options.__isset.external_join_partition_bits
+                       ? _query_options.external_join_partition_bits
+                       : 4;
+    }
+
+    int64_t external_analytic_bytes_threshold() const {
+        return _query_options.__isset.external_analytic_bytes_threshold
+                       ? _query_options.external_analytic_bytes_threshold
+                       : 0;
+    }
+
+    int64_t external_set_operation_bytes_threshold() const {
+        return _query_options.__isset.external_set_operation_bytes_threshold
+                       ? _query_options.external_set_operation_bytes_threshold
+                       : 0;
+    }
+
+    int64_t external_multi_cast_bytes_threshold() const {
+        return _query_options.__isset.external_multi_cast_bytes_threshold
+                       ? _query_options.external_multi_cast_bytes_threshold
+                       : 0;
+    }
+
+    int64_t preferred_block_size_bytes() const {
+        return _query_options.__isset.preferred_block_size_bytes
+                       ? _query_options.preferred_block_size_bytes
+                       : 0;
+    }
+
+    // The rows of a block to keep it around preferred_block_size_bytes with rows of
+    // `avg_row_bytes`, at most batch_size.
+    int adaptive_batch_size(size_t avg_row_bytes) const;
+
     bool enable_insert_strict() const {
         return _query_options.__isset.enable_insert_strict && _query_options.enable_insert_strict;
     }
@@ -506,7 +557,7 @@ private:
     std::vector<TTabletCommitInfo> _tablet_commit_infos;
     std::vector<TErrorTabletInfo> _error_tablet_infos;
 
-    QueryContext* _query_ctx;
+    QueryContext* _query_ctx = nullptr;
 
     // true if max_filter_ratio is 0
     bool _load_zero_tolerance = false;
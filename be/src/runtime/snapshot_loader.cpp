@@ -31,6 +31,8 @@
 #include <unistd.h>
 
 #include <algorithm>
+#include <atomic>
+#include <chrono>
 #include <cstring>
 #include <filesystem>
 #include <istream>
@@ -55,12 +57,17 @@
 #include "olap/tablet_manager.h"
 #include "runtime/client_cache.h"
 #include "runtime/exec_env.h"
+#include "util/countdown_latch.h"
 #include "util/s3_uri.h"
 #include "util/s3_util.h"
+#include "util/threadpool.h"
 #include "util/thrift_rpc_helper.h"
 
 namespace doris {
 
+// the interval to report the progress of an upload task to frontend
+static constexpr int UPLOAD_REPORT_INTERVAL_S = 5;
+
 SnapshotLoader::SnapshotLoader(ExecEnv* env, int64_t job_id, int64_t task_id)
         : _env(env),
           _job_id(job_id),
@@ -101,6 +108,7 @@ Status SnapshotLoader::init(TStorageBackendType::type type, const std::string& l
 SnapshotLoader::~SnapshotLoader() = default;
 
 Status SnapshotLoader::upload(const std::map<std::string, std::string>& src_to_dest_path,
+                              const std::map<std::string, std::string>& src_to_base_path,
                               std::map<int64_t, std::vector<std::string>>* tablet_files) {
     if (!_remote_fs) {
         return Status::InternalError("Storage backend not initialized.");
@@ -112,86 +120,177 @@ Status SnapshotLoader::upload(const std::map<std::string, std::string>& src_to_d
     int tmp_counter = 1;
     RETURN_IF_ERROR(_report_every(0, &tmp_counter, 0, 0, TTaskType::type::UPLOAD));
 
-    Status status = Status::OK();
     // 1. validate local tablet snapshot paths
     RETURN_IF_ERROR(_check_local_snapshot_paths(src_to_dest_path, true));
 
-    // 2. for each src path, upload it to remote storage
-    // we report to frontend for every 10 files, and we will cancel the job if
-    // the job has already been cancelled in frontend.
-    int report_counter = 0;
-    int total_num = src_to_dest_path.size();
-    int finished_num = 0;
-    for (auto iter = src_to_dest_path.begin(); iter != src_to_dest_path.end(); iter++) {
-        const std::string& src_path = iter->first;
-        const std::string& dest_path = iter->second;
-
+    // 2. upload the tablets in parallel on the upload pool shared by all the upload tasks.
+    // we report to frontend while waiting, and we will cancel the job if the job has already
+    // been cancelled in frontend.
+    struct TabletUpload {
+        const std::string* src_path;
+        const std::string* dest_path;
+        std::string base_path;
         int64_t tablet_id = 0;
+        std::vector<std::string> files;
+        Status status;
+    };
+    std::vector<TabletUpload> uploads;
+    for (const auto& [src_path, dest_path] : src_to_dest_path) {
+        TabletUpload upload;
+        upload.src_path = &src_path;
+        upload.dest_path = &dest_path;
+        auto base = src_to_base_path.find(src_path);
+        if (base != src_to_base_path.end()) {
+            upload.base_path = base->second;
+        }
         int32_t schema_hash = 0;
-        RETURN_IF_ERROR(
-                _get_tablet_id_and_schema_hash_from_file_path(src_path, &tablet_id, &schema_hash));
-
-        // 2.1 get existing files from remote path
-        std::map<std::string, FileStat> remote_files;
-        RETURN_IF_ERROR(_list_with_checksum(dest_path, &remote_files));
+        RETURN_IF_ERROR(_get_tablet_id_and_schema_hash_from_file_path(src_path, &upload.tablet_id,
+                                                                      &schema_hash));
+        uploads.push_back(std::move(upload));
+    }
 
-        for (auto& tmp : remote_files) {
-            VLOG_CRITICAL << "get remote file: " << tmp.first << ", checksum: " << tmp.second.md5;
+    int total_num = uploads.size();
+    std::atomic<int> finished_num {0};
+    std::atomic<bool> cancelled {false};
+    CountDownLatch latch(total_num);
+    auto upload_tablet = [&](TabletUpload& upload) {
+        if (cancelled) {
+            upload.status = Status::Cancelled("Cancelled");
+        } else {
+            upload.status = _upload_tablet(*upload.src_path, *upload.dest_path, upload.base_path,
+                                           &upload.files, &cancelled);
         }
+        if (!upload.status.ok()) {
+            cancelled = true;
+        } else {
+            finished_num++;
+            LOG(INFO) << "finished to write tablet to remote. local path: " << *upload.src_path
+                      << ", remote path: " << *upload.dest_path;
+        }
+        latch.count_down();
+    };
+    ThreadPool* pool = _env->snapshot_upload_thread_pool();
+    for (auto& upload : uploads) {
+        if (pool == nullptr || !pool->submit_func([&]() { upload_tablet(upload); }).ok()) {
+            upload_tablet(upload);
+        }
+    }
+    int report_counter = 0;
+    Status status = Status::OK();
+    while (!latch.wait_for(std::chrono::seconds(UPLOAD_REPORT_INTERVAL_S))) {
+        if (status.ok()) {
+            status = _report_every(0, &report_counter, finished_num, total_num,
+                                   TTaskType::type::UPLOAD);
+            if (!status.ok()) {
+                cancelled = true;
+            }
+        }
+    }
+    RETURN_IF_ERROR(status);
+    for (auto& upload : uploads) {
+        if (!upload.status.ok() && !upload.status.is<CANCELLED>()) {
+            return upload.status;
+        }
+    }
+    for (auto& upload : uploads) {
+        RETURN_IF_ERROR(upload.status);
+        tablet_files->emplace(upload.tablet_id, std::move(upload.files));
+    }
 
-        // 2.2 list local files
-        std::vector<std::string> local_files;
-        std::vector<std::string> local_files_with_checksum;
-        RETURN_IF_ERROR(_get_existing_files_from_local(src_path, &local_files));
+    LOG(INFO) << "finished to upload snapshots. job: " << _job_id << ", task id: " << _task_id;
+    return status;
+}
 
-        // 2.3 iterate local files
-        for (auto it = local_files.begin(); it != local_files.end(); it++) {
-            RETURN_IF_ERROR(_report_every(10, &report_counter, finished_num, total_num,
-                                          TTaskType::type::UPLOAD));
+Status SnapshotLoader::_upload_tablet(const std::string& src_path, const std::string& dest_path,
+                                      const std::string& base_path,
+                                      std::vector<std::string>* local_files_with_checksum,
+                                      const std::atomic<bool>* cancelled) {
+    // 1 get existing files from remote path, and from the remote path of the tablet in the
+    // last backup to the repository
+    std::map<std::string, FileStat> remote_files;
+    RETURN_IF_ERROR(_list_with_checksum(dest_path, &remote_files));
+
+    for (auto& tmp : remote_files) {
+        VLOG_CRITICAL << "get remote file: " << tmp.first << ", checksum: " << tmp.second.md5;
+    }
+    std::map<std::string, FileStat> base_files;
+    if (!base_path.empty()) {
+        Status st = _list_with_checksum(base_path, &base_files);
+        if (!st.ok()) {
+            LOG(WARNING) << "failed to list the base of incremental backup " << base_path << ": "
+                         << st;
+            base_files.clear();
+        }
+    }
 
-            const std::string& local_file = *it;
-            // calc md5sum of localfile
-            std::string md5sum;
-            RETURN_IF_ERROR(
-                    io::global_local_filesystem()->md5sum(src_path + "/" + local_file, &md5sum));
-            VLOG_CRITICAL << "get file checksum: " << local_file << ": " << md5sum;
-            local_files_with_checksum.push_back(local_file + "." + md5sum);
+    // 2 list local files
+    std::vector<io::FileInfo> local_files;
+    bool exists = true;
+    RETURN_IF_ERROR(io::global_local_filesystem()->list(src_path, true, &local_files, &exists));
 
-            // check if this local file need upload
-            bool need_upload = false;
-            auto find = remote_files.find(local_file);
-            if (find != remote_files.end()) {
-                if (md5sum != find->second.md5) {
-                    // remote storage file exist, but with different checksum
-                    LOG(WARNING) << "remote file checksum is invalid. remote: " << find->first
-                                 << ", local: " << md5sum;
-                    // TODO(cmy): save these files and delete them later
-                    need_upload = true;
-                }
-            } else {
+    // 3 iterate local files
+    for (const auto& local_file_info : local_files) {
+        if (*cancelled) {
+            return Status::Cancelled("Cancelled");
+        }
+        const std::string& local_file = local_file_info.file_name;
+        std::string full_local_file = src_path + "/" + local_file;
+        std::string full_remote_file = dest_path + "/" + local_file;
+
+        // A rowset file is immutable and named by its rowset id, so a file of the same name
+        // and size in the last backup has the same content. The md5 of the base is trusted,
+        // and the file is copied in the remote storage if supported.
+        auto base = base_files.find(local_file);
+        bool in_base = base != base_files.end() && !_end_with(local_file, ".hdr") &&
+                       base->second.size == local_file_info.file_size;
+
+        // calc md5sum of localfile
+        std::string md5sum;
+        if (in_base) {
+            md5sum = base->second.md5;
+        } else {
+            RETURN_IF_ERROR(io::global_local_filesystem()->md5sum(full_local_file, &md5sum));
+        }
+        VLOG_CRITICAL << "get file checksum: " << local_file << ": " << md5sum;
+        local_files_with_checksum->push_back(local_file + "." + md5sum);
+
+        // check if this local file need upload
+        bool need_upload = false;
+        auto find = remote_files.find(local_file);
+        if (find != remote_files.end()) {
+            if (md5sum != find->second.md5) {
+                // remote storage file exist, but with different checksum
+                LOG(WARNING) << "remote file checksum is invalid. remote: " << find->first
+                             << ", local: " << md5sum;
+                // TODO(cmy): save these files and delete them later
                 need_upload = true;
             }
+        } else {
+            need_upload = true;
+        }
 
-            if (!need_upload) {
-                VLOG_CRITICAL << "file exist in remote path, no need to upload: " << local_file;
+        if (!need_upload) {
+            VLOG_CRITICAL << "file exist in remote path, no need to upload: " << local_file;
+            continue;
+        }
+
+        if (in_base && _remote_fs->type() == io::FileSystemType::S3) {
+            Status st = static_cast<io::S3FileSystem*>(_remote_fs.get())
+                                ->copy(base_path + "/" + local_file + "." + md5sum,
+                                       full_remote_file + "." + md5sum);
+            if (st.ok()) {
+                VLOG_CRITICAL << "copy file from the base of incremental backup: " << local_file;
                 continue;
             }
+            LOG(WARNING) << "failed to copy " << local_file << " from " << base_path
+                         << ", upload it: " << st;
+        }
 
-            // upload
-            std::string full_remote_file = dest_path + "/" + local_file;
-            std::string full_local_file = src_path + "/" + local_file;
-            RETURN_IF_ERROR(
-                    _remote_fs->upload_with_checksum(full_local_file, full_remote_file, md5sum));
-        } // end for each tablet's local files
-
-        tablet_files->emplace(tablet_id, local_files_with_checksum);
-        finished_num++;
-        LOG(INFO) << "finished to write tablet to remote. local path: " << src_path
-                  << ", remote path: " << dest_path;
-    } // end for each tablet path
-
-    LOG(INFO) << "finished to upload snapshots. job: " << _job_id << ", task id: " << _task_id;
-    return status;
+        // upload
+        RETURN_IF_ERROR(
+                _remote_fs->upload_with_checksum(full_local_file, full_remote_file, md5sum));
+    } // end for each tablet's local files
+    return Status::OK();
 }
 
 /*
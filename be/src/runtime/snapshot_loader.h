@@ -20,6 +20,7 @@
 #include <gen_cpp/Types_types.h>
 #include <stdint.h>
 
+#include <atomic>
 #include <map>
 #include <memory>
 #include <string>
@@ -50,6 +51,8 @@ class ExecEnv;
  *
  * It will try to get the existing files in remote storage,
  * and only upload the incremental part of files.
+ * The tablets are uploaded in parallel, and the immutable rowset files
+ * already in the last backup to the repository are copied remotely.
  *
  * Download:
  * download() will download the remote tablet snapshot files
@@ -73,7 +76,10 @@ public:
 
     Status init(TStorageBackendType::type type, const std::string& location);
 
+    // The files of a tablet in src_to_base_path, its remote path in the last backup to the
+    // repository, are copied remotely or at least not read for their md5 again.
     Status upload(const std::map<std::string, std::string>& src_to_dest_path,
+                  const std::map<std::string, std::string>& src_to_base_path,
                   std::map<int64_t, std::vector<std::string>>* tablet_files);
 
     Status download(const std::map<std::string, std::string>& src_to_dest_path,
@@ -88,6 +94,11 @@ private:
     Status _get_tablet_id_and_schema_hash_from_file_path(const std::string& src_path,
                                                          int64_t* tablet_id, int32_t* schema_hash);
 
+    Status _upload_tablet(const std::string& src_path, const std::string& dest_path,
+                          const std::string& base_path,
+                          std::vector<std::string>* local_files_with_checksum,
+                          const std::atomic<bool>* cancelled);
+
     Status _check_local_snapshot_paths(const std::map<std::string, std::string>& src_to_dest_path,
                                        bool check_src);
 
@@ -83,6 +83,8 @@ public:
     std::map<int32_t, int64_t> cmt_offset;
     //custom kafka property key -> value
     std::map<std::string, std::string> properties;
+    // the messages left in the partitions after consuming, -1 if unknown
+    int64_t lag = -1;
 };
 
 class MessageBodySink;
@@ -143,6 +145,10 @@ public:
     int32_t timeout_second = -1;
     AuthInfo auth;
     bool two_phase_commit = false;
+    // the load is merged into a batch of the loads of its table, committed by GroupCommitMgr
+    bool group_commit = false;
+    TStreamLoadPutRequest group_commit_request;
+    std::string group_commit_label;
     std::string load_comment;
 
     // the following members control the max progress of a consuming
@@ -270,8 +270,9 @@ int64_t TabletsChannel::mem_consumption() {
             if (flush_mem > max_tablet_flush_mem_usage) max_tablet_flush_mem_usage = flush_mem;
             if (write_mem + flush_mem > max_tablet_mem_usage)
                 max_tablet_mem_usage = write_mem + flush_mem;
-            _mem_consumptions.emplace(write_mem + flush_mem, it.first);
+            _mem_consumptions.emplace(write_mem, it.first);
         }
+        _write_mem_usage = write_mem_usage;
     }
     COUNTER_SET(_memory_usage_counter, write_mem_usage + flush_mem_usage);
     COUNTER_SET(_write_memory_usage_counter, write_mem_usage);
@@ -597,6 +598,30 @@ void TabletsChannel::flush_memtable_async(int64_t tablet_id) {
     }
 }
 
+void TabletsChannelStats::add(const FlushStatistic& stat) {
+    flush_running_count += stat.flush_running_count;
+    flush_finish_count += stat.flush_finish_count;
+    flush_size_bytes += stat.flush_size_bytes;
+    flush_disk_size_bytes += stat.flush_disk_size_bytes;
+    flush_time_ns += stat.flush_time_ns;
+    flush_wait_time_ns += stat.flush_wait_time_ns;
+    for (int i = 0; i < FlushStatistic::NUM_LATENCY_BUCKETS; ++i) {
+        flush_latency_buckets[i] += stat.flush_latency_buckets[i];
+    }
+}
+
+void TabletsChannel::add_stats(TabletsChannelStats* stats) {
+    std::lock_guard<SpinLock> l(_tablet_writers_lock);
+    stats->num_indexes++;
+    stats->num_tablets += _tablet_writers.size();
+    for (auto& it : _tablet_writers) {
+        const FlushStatistic* flush_stats = it.second->flush_stats();
+        if (flush_stats != nullptr) {
+            stats->add(*flush_stats);
+        }
+    }
+}
+
 void TabletsChannel::wait_flush(int64_t tablet_id) {
     {
         std::lock_guard<std::mutex> l(_lock);
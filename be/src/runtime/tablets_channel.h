@@ -33,6 +33,7 @@
 #include <vector>
 
 #include "common/status.h"
+#include "olap/memtable_flush_executor.h"
 #include "util/bitmap.h"
 #include "util/runtime_profile.h"
 #include "util/spinlock.h"
@@ -80,6 +81,21 @@ class DeltaWriter;
 class OlapTableSchemaParam;
 class LoadChannel;
 
+// The tablet writers of a load and their flushes, served by information_schema.load_channels.
+struct TabletsChannelStats {
+    int64_t num_indexes = 0;
+    int64_t num_tablets = 0;
+    uint64_t flush_running_count = 0;
+    uint64_t flush_finish_count = 0;
+    uint64_t flush_size_bytes = 0;
+    uint64_t flush_disk_size_bytes = 0;
+    uint64_t flush_time_ns = 0;
+    uint64_t flush_wait_time_ns = 0;
+    uint64_t flush_latency_buckets[FlushStatistic::NUM_LATENCY_BUCKETS] = {};
+
+    void add(const FlushStatistic& stat);
+};
+
 // Write channel for a particular (load, index).
 class TabletsChannel {
 public:
@@ -115,6 +131,12 @@ public:
 
     int64_t mem_consumption();
 
+    // memory of the memtables being written, which is freed by flushing them
+    int64_t write_mem_consumption() {
+        std::lock_guard<SpinLock> l(_tablet_writers_lock);
+        return _write_mem_usage;
+    }
+
     void get_writers_mem_consumption_snapshot(
             std::multimap<int64_t, int64_t, std::greater<int64_t>>* mem_consumptions) {
         std::lock_guard<SpinLock> l(_tablet_writers_lock);
@@ -124,6 +146,8 @@ public:
     void flush_memtable_async(int64_t tablet_id);
     void wait_flush(int64_t tablet_id);
 
+    void add_stats(TabletsChannelStats* stats);
+
 private:
     template <typename Request>
     Status _get_current_seq(int64_t& cur_seq, const Request& request);
@@ -198,9 +222,10 @@ private:
 
     bool _write_single_replica = false;
 
-    // mem -> tablet_id
-    // sort by memory size
+    // write mem -> tablet_id
+    // sort by the memory of memtable being written, which is the memory freed by a flush
     std::multimap<int64_t, int64_t, std::greater<int64_t>> _mem_consumptions;
+    int64_t _write_mem_usage = 0;
 
     RuntimeProfile* _profile;
     RuntimeProfile::Counter* _add_batch_number_counter = nullptr;
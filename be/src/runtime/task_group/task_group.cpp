@@ -26,14 +26,49 @@
 #include <ostream>
 #include <utility>
 
+#include "common/config.h"
 #include "common/logging.h"
 #include "pipeline/task_scheduler.h"
 #include "runtime/exec_env.h"
 #include "runtime/memory/mem_tracker_limiter.h"
+#include "runtime/task_group/task_group_manager.h"
+#include "util/doris_metrics.h"
 #include "util/mem_info.h"
+#include "util/metrics.h"
 #include "util/parse_util.h"
 
 namespace doris {
+DEFINE_GAUGE_METRIC_PROTOTYPE_2ARG(workload_group_memory_used_bytes, MetricUnit::BYTES);
+DEFINE_GAUGE_METRIC_PROTOTYPE_2ARG(workload_group_memory_borrowed_bytes, MetricUnit::BYTES);
+DEFINE_GAUGE_METRIC_PROTOTYPE_2ARG(workload_group_memory_limit_bytes, MetricUnit::BYTES);
+DEFINE_GAUGE_METRIC_PROTOTYPE_2ARG(workload_group_memory_soft_limit_bytes, MetricUnit::BYTES);
+
+#define DEFINE_WORKLOAD_GROUP_IO_METRICS(tier)                                                 \
+    DEFINE_COUNTER_METRIC_PROTOTYPE_5ARG(workload_group_io_##tier##_bytes, MetricUnit::BYTES, \
+                                         "", workload_group_io_bytes,                          \
+                                         Labels({{"tier", #tier}}));                           \
+    DEFINE_COUNTER_METRIC_PROTOTYPE_5ARG(workload_group_io_##tier##_reads,                     \
+                                         MetricUnit::OPERATIONS, "", workload_group_io_reads,  \
+                                         Labels({{"tier", #tier}}));                           \
+    DEFINE_COUNTER_METRIC_PROTOTYPE_5ARG(workload_group_io_##tier##_read_us,                   \
+                                         MetricUnit::MICROSECONDS, "",                          \
+                                         workload_group_io_read_us, Labels({{"tier", #tier}}))
+
+// in the order of io::IOTier
+DEFINE_WORKLOAD_GROUP_IO_METRICS(page_cache);
+DEFINE_WORKLOAD_GROUP_IO_METRICS(os_page_cache);
+DEFINE_WORKLOAD_GROUP_IO_METRICS(local_disk);
+DEFINE_WORKLOAD_GROUP_IO_METRICS(file_cache);
+DEFINE_WORKLOAD_GROUP_IO_METRICS(remote);
+
+#define REGISTER_WORKLOAD_GROUP_IO_METRICS(tier, i)                                      \
+    _io_bytes[i] = (IntCounter*)(_entity->register_metric<IntCounter>(                   \
+            &METRIC_workload_group_io_##tier##_bytes));                                  \
+    _io_reads[i] = (IntCounter*)(_entity->register_metric<IntCounter>(                   \
+            &METRIC_workload_group_io_##tier##_reads));                                  \
+    _io_read_us[i] = (IntCounter*)(_entity->register_metric<IntCounter>(                 \
+            &METRIC_workload_group_io_##tier##_read_us))
+
 namespace taskgroup {
 
 const static std::string CPU_SHARE = "cpu_share";
@@ -84,7 +119,34 @@ TaskGroup::TaskGroup(const TaskGroupInfo& tg_info)
           _enable_memory_overcommit(tg_info.enable_memory_overcommit),
           _version(tg_info.version),
           _task_entity(this),
-          _mem_tracker_limiter_pool(MEM_TRACKER_GROUP_NUM) {}
+          _mem_tracker_limiter_pool(MEM_TRACKER_GROUP_NUM) {
+    _entity = DorisMetrics::instance()->metric_registry()->register_entity(
+            "workload_group." + std::to_string(_id), {{"workload_group_id", std::to_string(_id)}});
+    INT_GAUGE_METRIC_REGISTER(_entity, workload_group_memory_used_bytes);
+    INT_GAUGE_METRIC_REGISTER(_entity, workload_group_memory_borrowed_bytes);
+    INT_GAUGE_METRIC_REGISTER(_entity, workload_group_memory_limit_bytes);
+    INT_GAUGE_METRIC_REGISTER(_entity, workload_group_memory_soft_limit_bytes);
+    REGISTER_WORKLOAD_GROUP_IO_METRICS(page_cache, 0);
+    REGISTER_WORKLOAD_GROUP_IO_METRICS(os_page_cache, 1);
+    REGISTER_WORKLOAD_GROUP_IO_METRICS(local_disk, 2);
+    REGISTER_WORKLOAD_GROUP_IO_METRICS(file_cache, 3);
+    REGISTER_WORKLOAD_GROUP_IO_METRICS(remote, 4);
+}
+
+TaskGroup::~TaskGroup() {
+    DorisMetrics::instance()->metric_registry()->deregister_entity(_entity);
+}
+
+void TaskGroup::update_io_statistics(const io::IOStatistics& stats) {
+    for (int i = 0; i < NUM_IO_TIERS; ++i) {
+        if (stats.tiers[i].num_reads == 0) {
+            continue;
+        }
+        _io_bytes[i]->increment(stats.tiers[i].bytes_read);
+        _io_reads[i]->increment(stats.tiers[i].num_reads);
+        _io_read_us[i]->increment(stats.tiers[i].read_timer / 1000);
+    }
+}
 
 std::string TaskGroup::debug_string() const {
     std::shared_lock<std::shared_mutex> rl {_mutex};
@@ -123,19 +185,53 @@ void TaskGroup::update_cpu_share_unlock(const TaskGroupInfo& tg_info) {
     _cpu_share = tg_info.cpu_share;
 }
 
+int64_t TaskGroup::memory_soft_limit() const {
+    return memory_limit() / 100 * config::workload_group_memory_soft_limit_percent;
+}
+
 int64_t TaskGroup::memory_used() {
     int64_t used_memory = 0;
     for (auto& mem_tracker_group : _mem_tracker_limiter_pool) {
         std::lock_guard<std::mutex> l(mem_tracker_group.group_lock);
         for (const auto& tracker : mem_tracker_group.trackers) {
-            used_memory += tracker->is_query_cancelled() ? 0 : tracker->consumption();
+            if (!tracker->is_query_cancelled()) {
+                used_memory += tracker->consumption() + tracker->reserved_consumption();
+            }
         }
     }
+    _cached_memory_used = used_memory;
+    workload_group_memory_used_bytes->set_value(used_memory);
+    workload_group_memory_borrowed_bytes->set_value(borrowed_memory());
+    workload_group_memory_limit_bytes->set_value(memory_limit());
+    workload_group_memory_soft_limit_bytes->set_value(memory_soft_limit());
     return used_memory;
 }
 
+bool TaskGroup::try_reserve_memory(int64_t bytes) {
+    // The cached usage lags behind by one memory gc interval, the reservations made during it
+    // are added up so that the queries of a group can not reserve all at once.
+    int64_t used = _cached_memory_used.fetch_add(bytes) + bytes;
+    if (used <= memory_soft_limit()) {
+        return true;
+    }
+    if (enable_memory_overcommit() &&
+        TaskGroupManager::instance()->try_borrow_memory(
+                std::min(bytes, used - memory_soft_limit()))) {
+        return true;
+    }
+    _cached_memory_used.fetch_sub(bytes);
+    return false;
+}
+
+bool TaskGroup::can_reserve_memory(int64_t bytes) const {
+    int64_t exceeded = cached_memory_used() + bytes - memory_soft_limit();
+    return exceeded <= 0 || (enable_memory_overcommit() &&
+                             TaskGroupManager::instance()->lendable_memory() >= exceeded);
+}
+
 void TaskGroup::add_mem_tracker_limiter(std::shared_ptr<MemTrackerLimiter> mem_tracker_ptr) {
     auto group_num = mem_tracker_ptr->group_num();
+    mem_tracker_ptr->set_task_group(weak_from_this());
     std::lock_guard<std::mutex> l(_mem_tracker_limiter_pool[group_num].group_lock);
     _mem_tracker_limiter_pool[group_num].trackers.insert(mem_tracker_ptr);
 }
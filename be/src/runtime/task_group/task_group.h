@@ -20,14 +20,18 @@
 #include <stddef.h>
 #include <stdint.h>
 
+#include <algorithm>
 #include <atomic>
 #include <memory>
 #include <queue>
 #include <shared_mutex>
 #include <string>
 #include <unordered_set>
+#include <vector>
 
 #include "common/status.h"
+#include "io/io_common.h"
+#include "util/metrics.h"
 
 namespace doris {
 
@@ -80,6 +84,7 @@ struct TgTrackerLimiterGroup {
 class TaskGroup : public std::enable_shared_from_this<TaskGroup> {
 public:
     explicit TaskGroup(const TaskGroupInfo& tg_info);
+    ~TaskGroup();
 
     TaskGroupEntity* task_entity() { return &_task_entity; }
 
@@ -92,13 +97,33 @@ public:
         return _enable_memory_overcommit;
     };
 
-    bool memory_limit() const {
+    int64_t memory_limit() const {
         std::shared_lock<std::shared_mutex> r_lock(_mutex);
         return _memory_limit;
     };
 
+    // config::workload_group_memory_soft_limit_percent of the memory limit
+    int64_t memory_soft_limit() const;
+
+    // Sum up the consumption and reservations of the queries of the group that are not
+    // cancelled, and cache it for can_reserve.
     int64_t memory_used();
 
+    // the memory used when memory_used() was called last time, by the memory gc thread
+    int64_t cached_memory_used() const { return _cached_memory_used.load(); }
+
+    // Whether a query of the group may reserve more bytes, see MemTrackerLimiter::try_reserve.
+    // Granted below the soft limit. Above it, only a group that enables memory overcommit may
+    // borrow the idle memory of the other groups, see TaskGroupManager::try_borrow_memory.
+    // Otherwise the operator spills.
+    bool try_reserve_memory(int64_t bytes);
+    bool can_reserve_memory(int64_t bytes) const;
+
+    // the memory used beyond the soft limit, i.e. borrowed from the other groups
+    int64_t borrowed_memory() const {
+        return std::max<int64_t>(0, cached_memory_used() - memory_soft_limit());
+    }
+
     std::string debug_string() const;
 
     void check_and_update(const TaskGroupInfo& tg_info);
@@ -111,6 +136,9 @@ public:
 
     void task_group_info(TaskGroupInfo* tg_info) const;
 
+    // Adds the reads of a scanner of the group to the IO metrics by tier.
+    void update_io_statistics(const io::IOStatistics& stats);
+
     std::vector<TgTrackerLimiterGroup>& mem_tracker_limiter_pool() {
         return _mem_tracker_limiter_pool;
     }
@@ -126,6 +154,17 @@ private:
     TaskGroupEntity _task_entity;
 
     std::vector<TgTrackerLimiterGroup> _mem_tracker_limiter_pool;
+    std::atomic<int64_t> _cached_memory_used = 0;
+
+    std::shared_ptr<MetricEntity> _entity;
+    IntGauge* workload_group_memory_used_bytes = nullptr;
+    IntGauge* workload_group_memory_borrowed_bytes = nullptr;
+    IntGauge* workload_group_memory_limit_bytes = nullptr;
+    IntGauge* workload_group_memory_soft_limit_bytes = nullptr;
+    static constexpr int NUM_IO_TIERS = static_cast<int>(io::IOTier::NUM_TIERS);
+    IntCounter* _io_bytes[NUM_IO_TIERS] = {};
+    IntCounter* _io_reads[NUM_IO_TIERS] = {};
+    IntCounter* _io_read_us[NUM_IO_TIERS] = {};
 };
 
 using TaskGroupPtr = std::shared_ptr<TaskGroup>;
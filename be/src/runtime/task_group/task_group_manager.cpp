@@ -17,11 +17,13 @@
 
 #include "task_group_manager.h"
 
+#include <algorithm>
 #include <memory>
 #include <mutex>
 
 #include "runtime/memory/mem_tracker_limiter.h"
 #include "runtime/task_group/task_group.h"
+#include "util/mem_info.h"
 
 namespace doris::taskgroup {
 
@@ -64,4 +66,33 @@ void TaskGroupManager::get_resource_groups(const std::function<bool(const TaskGr
     }
 }
 
+void TaskGroupManager::refresh_memory_usage() {
+    std::vector<TaskGroupPtr> task_groups;
+    get_resource_groups([](const TaskGroupPtr&) { return true; }, &task_groups);
+    int64_t idle_memory = 0;
+    int64_t borrowed_memory = 0;
+    for (const auto& task_group : task_groups) {
+        int64_t used = task_group->memory_used();
+        int64_t soft_limit = task_group->memory_soft_limit();
+        if (used < soft_limit) {
+            idle_memory += soft_limit - used;
+        } else if (task_group->enable_memory_overcommit()) {
+            borrowed_memory += used - soft_limit;
+        }
+    }
+    int64_t process_free_memory = std::max<int64_t>(
+            0, MemInfo::soft_mem_limit() - MemInfo::proc_mem_no_allocator_cache());
+    _lendable_memory = std::min(idle_memory - borrowed_memory, process_free_memory);
+}
+
+bool TaskGroupManager::try_borrow_memory(int64_t bytes) {
+    int64_t lendable = _lendable_memory.load(std::memory_order_relaxed);
+    do {
+        if (lendable < bytes) {
+            return false;
+        }
+    } while (!_lendable_memory.compare_exchange_weak(lendable, lendable - bytes));
+    return true;
+}
+
 } // namespace doris::taskgroup
@@ -18,6 +18,7 @@
 
 #include <stdint.h>
 
+#include <atomic>
 #include <shared_mutex>
 #include <unordered_map>
 
@@ -36,9 +37,24 @@ public:
     void get_resource_groups(const std::function<bool(const TaskGroupPtr& ptr)>& pred,
                              std::vector<TaskGroupPtr>* task_groups);
 
+    // Refresh the memory used by each group and the memory the groups may lend to each other,
+    // called by the memory gc thread. The lendable memory is the sum of the idle memory under
+    // the soft limit of each group minus the memory already borrowed, and at most the free
+    // memory under the process soft limit. When a lender needs its memory back, the lendable memory
+    // becomes negative, the borrowing groups can not reserve any more and spill, and the
+    // process memory gc cancels their queries first, see MemInfo::tg_soft_memory_limit_gc.
+    void refresh_memory_usage();
+
+    // Borrow bytes of the lendable memory until the next refresh_memory_usage.
+    bool try_borrow_memory(int64_t bytes);
+
+    int64_t lendable_memory() const { return _lendable_memory.load(); }
+
 private:
     std::shared_mutex _group_mutex;
     std::unordered_map<uint64_t, TaskGroupPtr> _task_groups;
+
+    std::atomic<int64_t> _lendable_memory = 0;
 };
 
 } // namespace doris::taskgroup
@@ -18,7 +18,9 @@
 #include "runtime/thread_context.h"
 
 #include "common/signal_handler.h"
+#include "runtime/query_context.h"
 #include "runtime/runtime_state.h"
+#include "util/cpu_sampler.h"
 
 namespace doris {
 class MemTracker;
@@ -34,6 +36,8 @@ AttachTask::AttachTask(const std::shared_ptr<MemTrackerLimiter>& mem_tracker,
                        const TUniqueId& task_id, const TUniqueId& fragment_instance_id) {
     SwitchBthreadLocal::switch_to_bthread_local();
     thread_context()->attach_task(task_id, fragment_instance_id, mem_tracker);
+    cpu_sample_tag.query_id_hi = task_id.hi;
+    cpu_sample_tag.query_id_lo = task_id.lo;
 }
 
 AttachTask::AttachTask(RuntimeState* runtime_state) {
@@ -42,9 +46,15 @@ AttachTask::AttachTask(RuntimeState* runtime_state) {
     doris::signal::query_id_lo = runtime_state->query_id().lo;
     thread_context()->attach_task(runtime_state->query_id(), runtime_state->fragment_instance_id(),
                                   runtime_state->query_mem_tracker());
+    cpu_sample_tag.query_id_hi = runtime_state->query_id().hi;
+    cpu_sample_tag.query_id_lo = runtime_state->query_id().lo;
+    auto* query_ctx = runtime_state->get_query_ctx();
+    auto* task_group = query_ctx != nullptr ? query_ctx->get_task_group() : nullptr;
+    cpu_sample_tag.workload_group_id = task_group != nullptr ? task_group->id() : 0;
 }
 
 AttachTask::~AttachTask() {
+    cpu_sample_tag = CpuSampleTag();
     thread_context()->detach_task();
     SwitchBthreadLocal::switch_back_pthread_local();
 }
@@ -239,6 +239,9 @@ Status UserFunctionCache::_load_cache_entry(const std::string& url,
     }
 
     std::unique_lock<std::mutex> l(entry->load_lock);
+    if (entry->is_loaded.load()) {
+        return Status::OK();
+    }
     if (!entry->is_downloaded) {
         RETURN_IF_ERROR(_download_lib(url, entry));
     }
@@ -355,4 +358,23 @@ Status UserFunctionCache::get_jarpath(int64_t fid, const std::string& url,
     return Status::OK();
 }
 
+Status UserFunctionCache::get_function_ptr(int64_t fid, const std::string& url,
+                                           const std::string& checksum,
+                                           const std::string& symbol, void** fn_ptr) {
+    std::shared_ptr<UserFunctionCacheEntry> entry = nullptr;
+    RETURN_IF_ERROR(_get_cache_entry(fid, url, checksum, entry, LibType::SO));
+    {
+        std::lock_guard<SpinLock> l(entry->map_lock);
+        auto it = entry->fptr_map.find(symbol);
+        if (it != entry->fptr_map.end()) {
+            *fn_ptr = it->second;
+            return Status::OK();
+        }
+    }
+    RETURN_IF_ERROR(dynamic_lookup(entry->lib_handle, symbol.c_str(), fn_ptr));
+    std::lock_guard<SpinLock> l(entry->map_lock);
+    entry->fptr_map.emplace(symbol, *fn_ptr);
+    return Status::OK();
+}
+
 } // namespace doris
@@ -59,6 +59,12 @@ public:
     Status get_jarpath(int64_t fid, const std::string& url, const std::string& checksum,
                        std::string* libpath);
 
+    // Get the address of the symbol in the shared library of a native user function.
+    // The library is downloaded and opened at the first call, the address of each symbol
+    // is cached in the entry.
+    Status get_function_ptr(int64_t fid, const std::string& url, const std::string& checksum,
+                            const std::string& symbol, void** fn_ptr);
+
 private:
     Status _load_cached_lib();
     Status _load_entry_from_lib(const std::string& dir, const std::string& file);
@@ -27,18 +27,23 @@
 #include "http/action/checksum_action.h"
 #include "http/action/compaction_action.h"
 #include "http/action/config_action.h"
+#include "http/action/cpu_sampler_action.h"
 #include "http/action/download_action.h"
 #include "http/action/download_binlog_action.h"
 #include "http/action/file_cache_action.h"
 #include "http/action/health_action.h"
 #include "http/action/jeprofile_actions.h"
+#include "http/action/lock_profile_action.h"
 #include "http/action/meta_action.h"
 #include "http/action/metrics_action.h"
 #include "http/action/pad_rowset_action.h"
+#include "http/action/pipeline_trace_action.h"
 #include "http/action/pprof_actions.h"
+#include "http/action/query_memory_profile_action.h"
 #include "http/action/reload_tablet_action.h"
 #include "http/action/reset_rpc_channel_action.h"
 #include "http/action/restore_tablet_action.h"
+#include "http/action/rpc_capture_action.h"
 #include "http/action/snapshot_action.h"
 #include "http/action/stream_load.h"
 #include "http/action/stream_load_2pc.h"
@@ -147,6 +152,21 @@ Status HttpService::start() {
     // register jeprof actions
     JeprofileActions::setup(_env, _ev_http_server.get(), _pool);
 
+    CpuSamplerAction* cpu_sampler_action = _pool.add(new CpuSamplerAction());
+    _ev_http_server->register_handler(HttpMethod::GET, "/api/cpu_sampler", cpu_sampler_action);
+
+    LockProfileAction* lock_profile_action = _pool.add(new LockProfileAction());
+    _ev_http_server->register_handler(HttpMethod::GET, "/api/lock_profile", lock_profile_action);
+
+    RpcCaptureAction* rpc_capture_action = _pool.add(new RpcCaptureAction());
+    _ev_http_server->register_handler(HttpMethod::GET, "/api/rpc_capture", rpc_capture_action);
+    _ev_http_server->register_handler(HttpMethod::POST, "/api/rpc_capture", rpc_capture_action);
+
+    QueryMemoryProfileAction* query_memory_profile_action =
+            _pool.add(new QueryMemoryProfileAction(_env));
+    _ev_http_server->register_handler(HttpMethod::GET, "/api/query_memory_profile",
+                                      query_memory_profile_action);
+
     // register metrics
     {
         auto action = _pool.add(new MetricsAction(DorisMetrics::instance()->metric_registry(), _env,
@@ -161,6 +181,10 @@ Status HttpService::start() {
     FileCacheAction* file_cache_action = _pool.add(new FileCacheAction());
     _ev_http_server->register_handler(HttpMethod::GET, "/api/file_cache", file_cache_action);
 
+    PipelineTraceAction* pipeline_trace_action = _pool.add(new PipelineTraceAction());
+    _ev_http_server->register_handler(HttpMethod::GET, "/api/pipeline_trace",
+                                      pipeline_trace_action);
+
 #ifndef BE_TEST
     // Register BE checksum action
     ChecksumAction* checksum_action =
@@ -17,6 +17,7 @@
 
 #include "service/internal_service.h"
 
+#include <arrow/record_batch.h>
 #include <assert.h>
 #include <brpc/closure_guard.h>
 #include <brpc/controller.h>
@@ -82,12 +83,14 @@
 #include "runtime/fragment_mgr.h"
 #include "runtime/load_channel_mgr.h"
 #include "runtime/result_buffer_mgr.h"
+#include "runtime/rpc_capture.h"
 #include "runtime/routine_load/routine_load_task_executor.h"
 #include "runtime/stream_load/new_load_stream_mgr.h"
 #include "runtime/stream_load/stream_load_context.h"
 #include "runtime/thread_context.h"
 #include "runtime/types.h"
 #include "service/point_query_executor.h"
+#include "util/arrow/row_batch.h"
 #include "util/async_io.h"
 #include "util/brpc_client_cache.h"
 #include "util/doris_metrics.h"
@@ -230,6 +233,7 @@ void PInternalServiceImpl::tablet_writer_open(google::protobuf::RpcController* c
                                               const PTabletWriterOpenRequest* request,
                                               PTabletWriterOpenResult* response,
                                               google::protobuf::Closure* done) {
+    RpcCapture::instance()->capture(CAPTURED_TABLET_WRITER_OPEN, *request);
     bool ret = _light_work_pool.try_offer([this, request, response, done]() {
         VLOG_RPC << "tablet writer open, id=" << request->id()
                  << ", index_id=" << request->index_id() << ", txn_id=" << request->txn_id();
@@ -280,6 +284,8 @@ void PInternalServiceImpl::exec_plan_fragment(google::protobuf::RpcController* c
     auto span = telemetry::start_rpc_server_span("exec_plan_fragment", controller);
     auto scope = OpentelemetryScope {span};
     brpc::ClosureGuard closure_guard(done);
+    // also the prepare of a fragment, which runs the same once replayed
+    RpcCapture::instance()->capture(CAPTURED_EXEC_PLAN_FRAGMENT, *request);
     auto st = Status::OK();
     bool compact = request->has_compact() ? request->compact() : false;
     PFragmentRequestVersion version =
@@ -320,6 +326,7 @@ void PInternalServiceImpl::exec_plan_fragment_start(google::protobuf::RpcControl
         auto span = telemetry::start_rpc_server_span("exec_plan_fragment_start", controller);
         auto scope = OpentelemetryScope {span};
         brpc::ClosureGuard closure_guard(done);
+        RpcCapture::instance()->capture(CAPTURED_EXEC_PLAN_FRAGMENT_START, *request);
         auto st = _exec_env->fragment_mgr()->start_query_execution(request);
         st.to_protobuf(result->mutable_status());
     });
@@ -379,6 +386,7 @@ void PInternalServiceImpl::_tablet_writer_add_block(google::protobuf::RpcControl
                                                     const PTabletWriterAddBlockRequest* request,
                                                     PTabletWriterAddBlockResult* response,
                                                     google::protobuf::Closure* done) {
+    RpcCapture::instance()->capture(CAPTURED_TABLET_WRITER_ADD_BLOCK, *request);
     int64_t submit_task_time_ns = MonotonicNanos();
     bool ret = _heavy_work_pool.try_offer([request, response, done, submit_task_time_ns, this]() {
         int64_t wait_execution_time_ns = MonotonicNanos() - submit_task_time_ns;
@@ -410,6 +418,7 @@ void PInternalServiceImpl::tablet_writer_cancel(google::protobuf::RpcController*
                                                 const PTabletWriterCancelRequest* request,
                                                 PTabletWriterCancelResult* response,
                                                 google::protobuf::Closure* done) {
+    RpcCapture::instance()->capture(CAPTURED_TABLET_WRITER_CANCEL, *request);
     bool ret = _light_work_pool.try_offer([this, request, done]() {
         VLOG_RPC << "tablet writer cancel, id=" << request->id()
                  << ", index_id=" << request->index_id() << ", sender_id=" << request->sender_id();
@@ -453,7 +462,21 @@ Status PInternalServiceImpl::_exec_plan_fragment(const std::string& ser_request,
             RETURN_IF_ERROR(deserialize_thrift_msg(buf, &len, compact, &t_request));
         }
 
-        for (const TExecPlanFragmentParams& params : t_request.paramsList) {
+        auto& params_list = t_request.paramsList;
+        for (size_t i = 1; i < params_list.size(); ++i) {
+            auto& params = params_list[i];
+            if (!params.is_delta_param) {
+                continue;
+            }
+            // the instances of a fragment only carry the fragment and options once
+            if (!params.__isset.fragment) {
+                params.__set_fragment(params_list[i - 1].fragment);
+            }
+            if (!params.__isset.query_options) {
+                params.__set_query_options(params_list[i - 1].query_options);
+            }
+        }
+        for (const TExecPlanFragmentParams& params : params_list) {
             RETURN_IF_ERROR(_exec_env->fragment_mgr()->exec_plan_fragment(params));
         }
         return Status::OK();
@@ -522,6 +545,43 @@ void PInternalServiceImpl::fetch_data(google::protobuf::RpcController* controlle
     }
 }
 
+void PInternalServiceImpl::fetch_arrow_data(google::protobuf::RpcController* controller,
+                                            const PFetchArrowDataRequest* request,
+                                            PFetchArrowDataResult* result,
+                                            google::protobuf::Closure* done) {
+    bool ret = _heavy_work_pool.try_offer([this, controller, request, result, done]() {
+        brpc::ClosureGuard closure_guard(done);
+        auto* cntl = static_cast<brpc::Controller*>(controller);
+        std::shared_ptr<arrow::RecordBatch> record_batch;
+        int64_t packet_seq = 0;
+        Status st = _exec_env->result_mgr()->fetch_arrow_data(request->finst_id(), &record_batch,
+                                                              &packet_seq);
+        if (st.ok() && record_batch != nullptr) {
+            std::string record_batch_str;
+            st = serialize_record_batch(*record_batch, &record_batch_str);
+            if (st.ok()) {
+                if (record_batch_str.size() >= MIN_ZERO_COPY_ATTACHMENT_SIZE) {
+                    IOBufStringKeeper::instance()->append(&cntl->response_attachment(),
+                                                          std::move(record_batch_str));
+                } else {
+                    cntl->response_attachment().append(record_batch_str);
+                }
+            }
+        }
+        if (st.ok()) {
+            result->set_packet_seq(packet_seq);
+            result->set_eos(record_batch == nullptr);
+        }
+        st.to_protobuf(result->mutable_status());
+    });
+    if (!ret) {
+        LOG(WARNING) << "fail to offer request to the work pool";
+        brpc::ClosureGuard closure_guard(done);
+        result->mutable_status()->set_status_code(TStatusCode::CANCELLED);
+        result->mutable_status()->add_error_msgs("fail to offer request to the work pool");
+    }
+}
+
 void PInternalServiceImpl::fetch_table_schema(google::protobuf::RpcController* controller,
                                               const PFetchTableSchemaRequest* request,
                                               PFetchTableSchemaResult* result,
@@ -1078,8 +1138,10 @@ void PInternalServiceImpl::_transmit_block(google::protobuf::RpcController* cont
     // give response a default value to avoid null pointers in high concurrency.
     Status st;
     st.to_protobuf(response->mutable_status());
+    int64_t receiver_free_bytes = -1;
     if (extract_st.ok()) {
-        st = _exec_env->vstream_mgr()->transmit_block(request, &done);
+        RpcCapture::instance()->capture(CAPTURED_TRANSMIT_BLOCK, *request);
+        st = _exec_env->vstream_mgr()->transmit_block(request, &done, &receiver_free_bytes);
         if (!st.ok()) {
             LOG(WARNING) << "transmit_block failed, message=" << st
                          << ", fragment_instance_id=" << print_id(request->finst_id())
@@ -1089,6 +1151,10 @@ void PInternalServiceImpl::_transmit_block(google::protobuf::RpcController* cont
         st = extract_st;
     }
     if (done != nullptr) {
+        // the response held by the receiver is sent when the buffer drains, without credit
+        if (receiver_free_bytes >= 0) {
+            response->set_receiver_free_bytes(receiver_free_bytes);
+        }
         st.to_protobuf(response->mutable_status());
         done->Run();
     }
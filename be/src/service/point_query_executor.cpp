@@ -23,9 +23,12 @@
 #include <gen_cpp/internal_service.pb.h>
 #include <stdlib.h>
 
+#include <algorithm>
+#include <numeric>
 #include <unordered_map>
 #include <vector>
 
+#include "common/config.h"
 #include "gutil/integral_types.h"
 #include "olap/lru_cache.h"
 #include "olap/olap_tuple.h"
@@ -37,6 +40,8 @@
 #include "util/key_util.h"
 #include "util/runtime_profile.h"
 #include "util/thrift_util.h"
+#include "vec/columns/column_nullable.h"
+#include "vec/columns/column_string.h"
 #include "vec/data_types/serde/data_type_serde.h"
 #include "vec/exprs/vexpr.h"
 #include "vec/exprs/vexpr_context.h"
@@ -95,7 +100,8 @@ RowCache* RowCache::_s_instance = nullptr;
 RowCache::RowCache(int64_t capacity, int num_shards) {
     // Create Row Cache
     _cache = std::unique_ptr<Cache>(
-            new_lru_cache("RowCache", capacity, LRUCacheType::SIZE, num_shards));
+            new_lru_cache("RowCache", capacity, LRUCacheType::SIZE, num_shards,
+                          parse_cache_admission_policy(config::row_cache_admission_policy)));
 }
 
 // Create global instance of this class
@@ -246,9 +252,22 @@ Status PointQueryExecutor::_lookup_row_key() {
     // 2. lookup row location
     Status st;
     std::unordered_map<RowsetId, SegmentCacheHandle, HashOfRowsetId> segment_caches;
-    for (size_t i = 0; i < _row_read_ctxs.size(); ++i) {
+    // Lookup the keys in the encoded order, so the primary key index pages are walked forward
+    // and a page is likely still cached for the next key. The same key is looked up only once.
+    std::vector<size_t> key_order(_row_read_ctxs.size());
+    std::iota(key_order.begin(), key_order.end(), 0);
+    std::sort(key_order.begin(), key_order.end(), [this](size_t lhs, size_t rhs) {
+        return _row_read_ctxs[lhs]._primary_key < _row_read_ctxs[rhs]._primary_key;
+    });
+    for (size_t k = 0; k < key_order.size(); ++k) {
+        size_t i = key_order[k];
+        if (k > 0 &&
+            _row_read_ctxs[key_order[k - 1]]._primary_key == _row_read_ctxs[i]._primary_key &&
+            _copy_row_read_ctx(_row_read_ctxs[key_order[k - 1]], &_row_read_ctxs[i])) {
+            continue;
+        }
         RowLocation location;
-        if (!config::disable_storage_row_cache) {
+        if (!config::disable_storage_row_cache && _tablet->tablet_schema()->store_row_column()) {
             RowCache::CacheHandle cache_handle;
             auto hit_cache = RowCache::instance()->lookup(
                     {_tablet->tablet_id(), _row_read_ctxs[i]._primary_key}, &cache_handle);
@@ -276,9 +295,89 @@ Status PointQueryExecutor::_lookup_row_key() {
     return Status::OK();
 }
 
+bool PointQueryExecutor::_copy_row_read_ctx(const RowReadContext& src, RowReadContext* dst) {
+    if (src._cached_row_data.valid()) {
+        RowCache::CacheHandle cache_handle;
+        // the entry may be evicted in the meantime, then the key is looked up again
+        if (!RowCache::instance()->lookup({_tablet->tablet_id(), src._primary_key},
+                                          &cache_handle)) {
+            return false;
+        }
+        dst->_cached_row_data = std::move(cache_handle);
+        ++_profile_metrics.row_cache_hits;
+        return true;
+    }
+    if (!src._row_location.has_value()) {
+        return true;
+    }
+    dst->_row_location = src._row_location;
+    auto rowset_ptr = std::make_unique<RowsetSharedPtr>(*(src._rowset_ptr));
+    (*rowset_ptr)->acquire();
+    dst->_rowset_ptr = std::unique_ptr<RowsetSharedPtr, decltype(&release_rowset)>(
+            rowset_ptr.release(), &release_rowset);
+    return true;
+}
+
 Status PointQueryExecutor::_lookup_row_data() {
     // 3. get values
     SCOPED_TIMER(&_profile_metrics.lookup_data_ns);
+    // The keys of a batch located in the same segment are read by one column iterator in
+    // rowid order, so the rows in the same page share one page read and decoding.
+    std::vector<size_t> rows_to_read;
+    rows_to_read.reserve(_row_read_ctxs.size());
+    for (size_t i = 0; i < _row_read_ctxs.size(); ++i) {
+        if (!_row_read_ctxs[i]._cached_row_data.valid() &&
+            _row_read_ctxs[i]._row_location.has_value()) {
+            rows_to_read.push_back(i);
+        }
+    }
+    std::sort(rows_to_read.begin(), rows_to_read.end(), [this](size_t lhs, size_t rhs) {
+        return _row_read_ctxs[lhs]._row_location.value() <
+               _row_read_ctxs[rhs]._row_location.value();
+    });
+    if (!_tablet->tablet_schema()->store_row_column()) {
+        return _lookup_column_data(rows_to_read);
+    }
+    // refer to the values in the columns read without copying them
+    std::vector<StringRef> row_values(_row_read_ctxs.size());
+    std::vector<vectorized::MutableColumnPtr> value_columns;
+    for (size_t begin = 0; begin < rows_to_read.size();) {
+        const RowLocation& first = _row_read_ctxs[rows_to_read[begin]]._row_location.value();
+        size_t end = begin;
+        std::vector<uint32_t> rowids;
+        for (; end < rows_to_read.size(); ++end) {
+            const RowLocation& loc = _row_read_ctxs[rows_to_read[end]]._row_location.value();
+            if (loc.rowset_id != first.rowset_id || loc.segment_id != first.segment_id) {
+                break;
+            }
+            // the same key may be requested more than once
+            if (rowids.empty() || rowids.back() != loc.row_id) {
+                rowids.push_back(loc.row_id);
+            }
+        }
+        vectorized::MutableColumnPtr column = vectorized::ColumnString::create();
+        RETURN_IF_ERROR(_tablet->lookup_row_data(*(_row_read_ctxs[rows_to_read[begin]]._rowset_ptr),
+                                                 first.segment_id, rowids,
+                                                 _profile_metrics.read_stats, column));
+        DCHECK_EQ(column->size(), rowids.size());
+        size_t pos = 0;
+        for (size_t j = begin; j < end; ++j) {
+            auto& ctx = _row_read_ctxs[rows_to_read[j]];
+            while (rowids[pos] != ctx._row_location->row_id) {
+                ++pos;
+            }
+            row_values[rows_to_read[j]] = column->get_data_at(pos);
+            if (!config::disable_storage_row_cache) {
+                RowCache::instance()->insert(
+                        {_tablet->tablet_id(), ctx._primary_key},
+                        Slice {row_values[rows_to_read[j]].data, row_values[rows_to_read[j]].size});
+            }
+        }
+        value_columns.push_back(std::move(column));
+        begin = end;
+    }
+
+    // serilize value to block in the order of keys, currently only jsonb row formt
     for (size_t i = 0; i < _row_read_ctxs.size(); ++i) {
         if (_row_read_ctxs[i]._cached_row_data.valid()) {
             vectorized::JsonbSerializeUtil::jsonb_to_block(
@@ -291,20 +390,67 @@ Status PointQueryExecutor::_lookup_row_data() {
         if (!_row_read_ctxs[i]._row_location.has_value()) {
             continue;
         }
-        std::string value;
-        RETURN_IF_ERROR(_tablet->lookup_row_data(
-                _row_read_ctxs[i]._primary_key, _row_read_ctxs[i]._row_location.value(),
-                *(_row_read_ctxs[i]._rowset_ptr), _reusable->tuple_desc(),
-                _profile_metrics.read_stats, value,
-                !config::disable_storage_row_cache /*whether write row cache*/));
-        // serilize value to block, currently only jsonb row formt
         vectorized::JsonbSerializeUtil::jsonb_to_block(
-                _reusable->get_data_type_serdes(), value.data(), value.size(),
+                _reusable->get_data_type_serdes(), row_values[i].data, row_values[i].size,
                 _reusable->get_col_uid_to_idx(), *_result_block);
     }
     return Status::OK();
 }
 
+Status PointQueryExecutor::_lookup_column_data(const std::vector<size_t>& rows_to_read) {
+    // Without the row store, only the output columns are read from their column pages, which
+    // also makes a projection of a few columns cheaper than decoding the whole row.
+    const auto& slots = _reusable->tuple_desc()->slots();
+    std::vector<int32_t> col_unique_ids;
+    col_unique_ids.reserve(slots.size());
+    for (const auto* slot : slots) {
+        col_unique_ids.push_back(slot->col_unique_id());
+    }
+    // the columns read from a segment, and the segment and position of the row of every key
+    std::vector<vectorized::MutableColumns> segment_columns;
+    std::vector<std::pair<size_t, size_t>> row_positions(_row_read_ctxs.size());
+    for (size_t begin = 0; begin < rows_to_read.size();) {
+        const RowLocation& first = _row_read_ctxs[rows_to_read[begin]]._row_location.value();
+        size_t end = begin;
+        std::vector<uint32_t> rowids;
+        for (; end < rows_to_read.size(); ++end) {
+            const RowLocation& loc = _row_read_ctxs[rows_to_read[end]]._row_location.value();
+            if (loc.rowset_id != first.rowset_id || loc.segment_id != first.segment_id) {
+                break;
+            }
+            if (rowids.empty() || rowids.back() != loc.row_id) {
+                rowids.push_back(loc.row_id);
+            }
+            row_positions[rows_to_read[end]] = {segment_columns.size(), rowids.size() - 1};
+        }
+        vectorized::MutableColumns columns;
+        RETURN_IF_ERROR(_tablet->lookup_columns_data(
+                *(_row_read_ctxs[rows_to_read[begin]]._rowset_ptr), first.segment_id, rowids,
+                col_unique_ids, _profile_metrics.read_stats, columns));
+        segment_columns.push_back(std::move(columns));
+        begin = end;
+    }
+
+    auto dst_columns = _result_block->mutate_columns();
+    for (size_t i = 0; i < _row_read_ctxs.size(); ++i) {
+        if (!_row_read_ctxs[i]._row_location.has_value()) {
+            continue;
+        }
+        const auto& [segment, pos] = row_positions[i];
+        for (size_t j = 0; j < dst_columns.size(); ++j) {
+            const auto& src = *segment_columns[segment][j];
+            if (dst_columns[j]->is_nullable() && !src.is_nullable()) {
+                assert_cast<vectorized::ColumnNullable&>(*dst_columns[j])
+                        .insert_from_not_nullable(src, pos);
+            } else {
+                dst_columns[j]->insert_from(src, pos);
+            }
+        }
+    }
+    _result_block->set_columns(std::move(dst_columns));
+    return Status::OK();
+}
+
 template <typename MysqlWriter>
 Status _serialize_block(MysqlWriter& mysql_writer, vectorized::Block& block,
                         PTabletKeyLookupResponse* response) {
@@ -292,6 +292,9 @@ private:
 
     Status _lookup_row_data();
 
+    // Read the output columns of the keys of the tablets without row store column
+    Status _lookup_column_data(const std::vector<size_t>& rows_to_read);
+
     Status _output_data();
 
     static void release_rowset(RowsetSharedPtr* r) {
@@ -313,6 +316,9 @@ private:
         std::unique_ptr<RowsetSharedPtr, decltype(&release_rowset)> _rowset_ptr;
     };
 
+    // Share the lookup result of a key with the duplicated one, return false if it can't
+    bool _copy_row_read_ctx(const RowReadContext& src, RowReadContext* dst);
+
     PTabletKeyLookupResponse* _response;
     TabletSharedPtr _tablet;
     std::vector<RowReadContext> _row_read_ctxs;
@@ -0,0 +1,497 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+// Replays a capture of /api/rpc_capture against a test BE, which is expected to hold a
+// snapshot of the tablets of the captured BE, and reports the latency and the throughput
+// of the replayed requests by type.
+//
+// The fragments are rewritten to keep the replay away from the captured cluster: their
+// destinations, runtime filter targets and tablet sink nodes are pointed to the test BE and
+// their coordinator to --fe_host. The ids of the queries, fragment instances and loads are
+// salted by --id_salt consistently, so a capture can be replayed again on the same BE, and
+// the labels of the stream loads get the salt as suffix. The loads of the fragments and of
+// the tablet writers run the write path of the test BE, their transactions are never
+// published.
+
+#include <brpc/channel.h>
+#include <brpc/controller.h>
+#include <fmt/format.h>
+#include <gen_cpp/DataSinks_types.h>
+#include <gen_cpp/Descriptors_types.h>
+#include <gen_cpp/PaloInternalService_types.h>
+#include <gen_cpp/Planner_types.h>
+#include <gen_cpp/Types_types.h>
+#include <gen_cpp/internal_service.pb.h>
+#include <gen_cpp/types.pb.h>
+#include <gflags/gflags.h>
+#include <google/protobuf/stubs/callback.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "common/status.h"
+#include "http/http_client.h"
+#include "util/coding.h"
+#include "util/threadpool.h"
+#include "util/thrift_util.h"
+#include "util/time.h"
+
+using doris::PCapturedRequest;
+using doris::Status;
+
+DEFINE_string(capture_file, "", "the capture file of /api/rpc_capture");
+DEFINE_string(be_host, "", "host of the test BE");
+DEFINE_int32(be_port, 9060, "thrift port of the test BE");
+DEFINE_int32(brpc_port, 8060, "brpc port of the test BE");
+DEFINE_int32(webserver_port, 8040, "http port of the test BE, for the stream loads");
+DEFINE_string(fe_host, "", "host of the FE of the test BE, the coordinator of the fragments");
+DEFINE_int32(fe_rpc_port, 9020, "thrift port of the FE of the test BE");
+DEFINE_string(user, "root", "user of the stream loads");
+DEFINE_string(password, "", "password of the stream loads");
+DEFINE_double(speed, 1.0, "speed of the replay relative to the capture, 0 to replay at once");
+DEFINE_int64(id_salt, 0, "xor-ed into the ids of the replayed requests, the time by default");
+DEFINE_int32(stream_load_threads, 16, "max concurrent stream loads");
+DEFINE_int32(timeout_ms, 60000, "timeout of a replayed request");
+
+namespace doris {
+
+// The latency of the replayed requests of a type.
+class ReplayStats {
+public:
+    void record(int64_t latency_us, int64_t bytes, bool failed) {
+        std::lock_guard l(_lock);
+        _latencies_us.push_back(latency_us);
+        _bytes += bytes;
+        _errors += failed;
+    }
+
+    void report(const std::string& name, double elapsed_s) {
+        std::lock_guard l(_lock);
+        if (_latencies_us.empty()) {
+            return;
+        }
+        std::sort(_latencies_us.begin(), _latencies_us.end());
+        auto percentile = [&](double p) {
+            return _latencies_us[static_cast<size_t>(p * (_latencies_us.size() - 1))];
+        };
+        std::cout << std::left << std::setw(28) << name << " count=" << _latencies_us.size()
+                  << " errors=" << _errors << " p50_us=" << percentile(0.5)
+                  << " p99_us=" << percentile(0.99) << " max_us=" << _latencies_us.back()
+                  << std::fixed << std::setprecision(1)
+                  << " qps=" << _latencies_us.size() / elapsed_s
+                  << " MB/s=" << _bytes / elapsed_s / 1024 / 1024 << std::endl;
+    }
+
+private:
+    std::mutex _lock;
+    std::vector<int64_t> _latencies_us;
+    int64_t _bytes = 0;
+    int64_t _errors = 0;
+};
+
+static ReplayStats s_stats[PCapturedRequestType_ARRAYSIZE];
+static std::atomic<int64_t> s_inflight {0};
+
+template <typename Request, typename Response>
+class ReplayCall : public google::protobuf::Closure {
+public:
+    explicit ReplayCall(PCapturedRequestType type) : _type(type) {
+        cntl.set_timeout_ms(FLAGS_timeout_ms);
+        s_inflight++;
+    }
+
+    void Run() override {
+        bool failed = cntl.Failed();
+        if constexpr (!std::is_same_v<Response, PTabletWriterCancelResult>) {
+            failed = failed || response.status().status_code() != 0;
+        }
+        s_stats[_type].record(MonotonicMicros() - _start_us, request.ByteSizeLong(), failed);
+        s_inflight--;
+        delete this;
+    }
+
+    brpc::Controller cntl;
+    Request request;
+    Response response;
+
+private:
+    const PCapturedRequestType _type;
+    const int64_t _start_us = MonotonicMicros();
+};
+
+static void salt_id(TUniqueId* id) {
+    id->hi ^= FLAGS_id_salt;
+}
+
+static void salt_id(PUniqueId* id) {
+    id->set_hi(id->hi() ^ FLAGS_id_salt);
+}
+
+static void to_test_be(TNetworkAddress* addr, int port) {
+    addr->hostname = FLAGS_be_host;
+    addr->port = port;
+}
+
+static void rewrite_destinations(std::vector<TPlanFragmentDestination>* destinations) {
+    for (auto& destination : *destinations) {
+        salt_id(&destination.fragment_instance_id);
+        to_test_be(&destination.server, FLAGS_be_port);
+        if (destination.__isset.brpc_server) {
+            to_test_be(&destination.brpc_server, FLAGS_brpc_port);
+        }
+    }
+}
+
+static void rewrite_runtime_filters(TRuntimeFilterParams* params) {
+    if (params->__isset.runtime_filter_merge_addr) {
+        to_test_be(&params->runtime_filter_merge_addr, FLAGS_brpc_port);
+    }
+    for (auto& [_, targets] : params->rid_to_target_param) {
+        for (auto& target : targets) {
+            salt_id(&target.target_fragment_instance_id);
+            to_test_be(&target.target_fragment_instance_addr, FLAGS_brpc_port);
+        }
+    }
+    for (auto& [_, targets] : params->rid_to_target_paramv2) {
+        for (auto& target : targets) {
+            for (auto& id : target.target_fragment_instance_ids) {
+                salt_id(&id);
+            }
+            to_test_be(&target.target_fragment_instance_addr, FLAGS_brpc_port);
+        }
+    }
+}
+
+static void rewrite_fragment(TPlanFragment* fragment) {
+    if (!fragment->__isset.output_sink || !fragment->output_sink.__isset.olap_table_sink) {
+        return;
+    }
+    auto& sink = fragment->output_sink.olap_table_sink;
+    salt_id(&sink.load_id);
+    for (auto& node : sink.nodes_info.nodes) {
+        node.host = FLAGS_be_host;
+        node.async_internal_port = FLAGS_brpc_port;
+    }
+}
+
+static void rewrite_coord(TNetworkAddress* coord) {
+    coord->hostname = FLAGS_fe_host;
+    coord->port = FLAGS_fe_rpc_port;
+}
+
+static void rewrite_params(TExecPlanFragmentParams* params) {
+    if (params->__isset.fragment) {
+        rewrite_fragment(&params->fragment);
+    }
+    if (params->__isset.coord) {
+        rewrite_coord(&params->coord);
+    }
+    if (params->__isset.params) {
+        auto& exec_params = params->params;
+        salt_id(&exec_params.query_id);
+        salt_id(&exec_params.fragment_instance_id);
+        rewrite_destinations(&exec_params.destinations);
+        if (exec_params.__isset.runtime_filter_params) {
+            rewrite_runtime_filters(&exec_params.runtime_filter_params);
+        }
+    }
+}
+
+static void rewrite_params(TPipelineFragmentParams* params) {
+    salt_id(&params->query_id);
+    if (params->__isset.fragment) {
+        rewrite_fragment(&params->fragment);
+    }
+    if (params->__isset.coord) {
+        rewrite_coord(&params->coord);
+    }
+    rewrite_destinations(&params->destinations);
+    for (auto& id : params->instances_sharing_hash_table) {
+        salt_id(&id);
+    }
+    for (auto& local_params : params->local_params) {
+        salt_id(&local_params.fragment_instance_id);
+        if (local_params.__isset.runtime_filter_params) {
+            rewrite_runtime_filters(&local_params.runtime_filter_params);
+        }
+    }
+}
+
+template <typename T>
+static Status rewrite_thrift(PExecPlanFragmentRequest* request,
+                             const std::function<void(T*)>& rewrite) {
+    T params;
+    const auto* buf = reinterpret_cast<const uint8_t*>(request->request().data());
+    uint32_t len = request->request().size();
+    RETURN_IF_ERROR(deserialize_thrift_msg(buf, &len, request->compact(), &params));
+    rewrite(&params);
+    ThriftSerializer serializer(request->compact(), 4096);
+    return serializer.serialize(&params, request->mutable_request());
+}
+
+static Status rewrite_exec_plan_fragment(PExecPlanFragmentRequest* request) {
+    switch (request->version()) {
+    case PFragmentRequestVersion::VERSION_1:
+        return rewrite_thrift<TExecPlanFragmentParams>(
+                request, [](auto* params) { rewrite_params(params); });
+    case PFragmentRequestVersion::VERSION_2:
+        return rewrite_thrift<TExecPlanFragmentParamsList>(request, [](auto* list) {
+            for (auto& params : list->paramsList) {
+                rewrite_params(&params);
+            }
+        });
+    case PFragmentRequestVersion::VERSION_3:
+        return rewrite_thrift<TPipelineFragmentParamsList>(request, [](auto* list) {
+            for (auto& params : list->params_list) {
+                rewrite_params(&params);
+            }
+        });
+    default:
+        return Status::NotSupported("unknown fragment request version {}", request->version());
+    }
+}
+
+template <typename Request, typename Response, typename Method>
+static void send_rpc(PBackendService_Stub* stub, Method method, const PCapturedRequest& record,
+                     const std::function<Status(Request*)>& rewrite) {
+    auto* call = new ReplayCall<Request, Response>(record.type());
+    Status st;
+    if (!call->request.ParseFromString(record.request())) {
+        st = Status::Corruption("failed to parse captured request");
+    } else {
+        st = rewrite(&call->request);
+    }
+    if (!st.ok()) {
+        std::cerr << "skip captured request of type " << record.type() << ": " << st
+                  << std::endl;
+        call->cntl.SetFailed(st.to_string());
+        call->Run();
+        return;
+    }
+    (stub->*method)(&call->cntl, &call->request, &call->response, call);
+}
+
+// The body of a stream load is kept until its end record.
+struct CapturedStreamLoad {
+    std::string db;
+    std::string table;
+    std::map<std::string, std::string> headers;
+    std::string body;
+};
+
+static void send_stream_load(std::shared_ptr<CapturedStreamLoad> load, std::string label) {
+    HttpClient client;
+    std::string url = fmt::format("http://{}:{}/api/{}/{}/_stream_load", FLAGS_be_host,
+                                  FLAGS_webserver_port, load->db, load->table);
+    int64_t start_us = MonotonicMicros();
+    Status st = client.init(url);
+    if (st.ok()) {
+        client.set_basic_auth(FLAGS_user, FLAGS_password);
+        client.set_timeout_ms(FLAGS_timeout_ms);
+        for (const auto& [key, value] : load->headers) {
+            // set by the client or rewritten
+            static const std::set<std::string> skipped = {
+                    "host", "content-length", "transfer-encoding", "expect", "authorization",
+                    "label"};
+            std::string lower_key = key;
+            std::transform(lower_key.begin(), lower_key.end(), lower_key.begin(), ::tolower);
+            if (skipped.count(lower_key) == 0) {
+                client.set_header(key, value);
+            }
+        }
+        client.set_header("label", label);
+        std::string response;
+        st = client.execute_put_request(load->body, &response);
+        if (st.ok() && response.find("\"Status\": \"Success\"") == std::string::npos) {
+            st = Status::InternalError(response);
+        }
+    }
+    if (!st.ok()) {
+        std::cerr << "stream load " << label << " failed: " << st << std::endl;
+    }
+    s_stats[CAPTURED_STREAM_LOAD_END].record(MonotonicMicros() - start_us, load->body.size(),
+                                             !st.ok());
+}
+
+static Status replay() {
+    std::ifstream in(FLAGS_capture_file, std::ios::binary);
+    if (!in) {
+        return Status::IOError("failed to open {}", FLAGS_capture_file);
+    }
+    brpc::ChannelOptions options;
+    options.timeout_ms = FLAGS_timeout_ms;
+    brpc::Channel channel;
+    if (channel.Init(FLAGS_be_host.c_str(), FLAGS_brpc_port, &options) != 0) {
+        return Status::InternalError("failed to init brpc channel to {}:{}", FLAGS_be_host,
+                                     FLAGS_brpc_port);
+    }
+    PBackendService_Stub stub(&channel);
+    std::unique_ptr<ThreadPool> stream_load_pool;
+    RETURN_IF_ERROR(ThreadPoolBuilder("StreamLoadReplay")
+                            .set_max_threads(FLAGS_stream_load_threads)
+                            .build(&stream_load_pool));
+    std::map<std::string, std::shared_ptr<CapturedStreamLoad>> stream_loads;
+    std::string label_suffix = fmt::format("_replay_{}", FLAGS_id_salt);
+
+    auto salt_request_id = [](auto* request) {
+        salt_id(request->mutable_id());
+        return Status::OK();
+    };
+    int64_t start_us = MonotonicMicros();
+    int64_t num_records = 0;
+    std::string buf;
+    uint8_t size_buf[sizeof(uint32_t)];
+    while (in.read(reinterpret_cast<char*>(size_buf), sizeof(size_buf))) {
+        buf.resize(decode_fixed32_le(size_buf));
+        PCapturedRequest record;
+        if (!in.read(buf.data(), buf.size()) || !record.ParseFromString(buf)) {
+            return Status::Corruption("truncated capture file after {} records", num_records);
+        }
+        ++num_records;
+        if (FLAGS_speed > 0) {
+            int64_t wait_us =
+                    start_us + static_cast<int64_t>(record.offset_us() / FLAGS_speed) -
+                    MonotonicMicros();
+            if (wait_us > 0) {
+                std::this_thread::sleep_for(std::chrono::microseconds(wait_us));
+            }
+        }
+        switch (record.type()) {
+        case CAPTURED_EXEC_PLAN_FRAGMENT:
+            send_rpc<PExecPlanFragmentRequest, PExecPlanFragmentResult>(
+                    &stub, &PBackendService_Stub::exec_plan_fragment, record,
+                    rewrite_exec_plan_fragment);
+            break;
+        case CAPTURED_EXEC_PLAN_FRAGMENT_START:
+            send_rpc<PExecPlanFragmentStartRequest, PExecPlanFragmentResult>(
+                    &stub, &PBackendService_Stub::exec_plan_fragment_start, record,
+                    [](auto* request) {
+                        salt_id(request->mutable_query_id());
+                        return Status::OK();
+                    });
+            break;
+        case CAPTURED_TRANSMIT_BLOCK:
+            send_rpc<PTransmitDataParams, PTransmitDataResult>(
+                    &stub, &PBackendService_Stub::transmit_block, record, [](auto* request) {
+                        // the block was moved out of the attachment when captured
+                        request->set_transfer_by_attachment(false);
+                        salt_id(request->mutable_finst_id());
+                        if (request->has_query_id()) {
+                            salt_id(request->mutable_query_id());
+                        }
+                        return Status::OK();
+                    });
+            break;
+        case CAPTURED_TABLET_WRITER_OPEN:
+            send_rpc<PTabletWriterOpenRequest, PTabletWriterOpenResult>(
+                    &stub, &PBackendService_Stub::tablet_writer_open, record, salt_request_id);
+            break;
+        case CAPTURED_TABLET_WRITER_ADD_BLOCK:
+            send_rpc<PTabletWriterAddBlockRequest, PTabletWriterAddBlockResult>(
+                    &stub, &PBackendService_Stub::tablet_writer_add_block, record,
+                    [](auto* request) {
+                        request->set_transfer_by_attachment(false);
+                        salt_id(request->mutable_id());
+                        return Status::OK();
+                    });
+            break;
+        case CAPTURED_TABLET_WRITER_CANCEL:
+            send_rpc<PTabletWriterCancelRequest, PTabletWriterCancelResult>(
+                    &stub, &PBackendService_Stub::tablet_writer_cancel, record, salt_request_id);
+            break;
+        case CAPTURED_STREAM_LOAD_BEGIN: {
+            auto load = std::make_shared<CapturedStreamLoad>();
+            load->db = record.db();
+            load->table = record.table();
+            load->headers.insert(record.headers().begin(), record.headers().end());
+            stream_loads[record.label()] = std::move(load);
+            break;
+        }
+        case CAPTURED_STREAM_LOAD_BODY: {
+            auto it = stream_loads.find(record.label());
+            // the load began before the capture
+            if (it != stream_loads.end()) {
+                it->second->body.append(record.body());
+            }
+            break;
+        }
+        case CAPTURED_STREAM_LOAD_END: {
+            auto it = stream_loads.find(record.label());
+            if (it == stream_loads.end()) {
+                break;
+            }
+            RETURN_IF_ERROR(stream_load_pool->submit_func(
+                    [load = it->second, label = record.label() + label_suffix]() {
+                        send_stream_load(load, label);
+                    }));
+            stream_loads.erase(it);
+            break;
+        }
+        default:
+            std::cerr << "skip unknown captured request type " << record.type() << std::endl;
+        }
+    }
+    stream_load_pool->wait();
+    while (s_inflight > 0) {
+        SleepForMs(10);
+    }
+    double elapsed_s = (MonotonicMicros() - start_us) / 1000000.0;
+    std::cout << "replayed " << num_records << " records in " << elapsed_s << "s" << std::endl;
+    for (int i = 0; i < PCapturedRequestType_ARRAYSIZE; ++i) {
+        auto type = static_cast<PCapturedRequestType>(i);
+        // a stream load is recorded by its end record
+        s_stats[i].report(type == CAPTURED_STREAM_LOAD_END ? "stream_load"
+                                                           : PCapturedRequestType_Name(type),
+                          elapsed_s);
+    }
+    return Status::OK();
+}
+
+} // namespace doris
+
+int main(int argc, char** argv) {
+    gflags::SetUsageMessage(
+            "Replay a capture of /api/rpc_capture against a test BE.\n"
+            "Usage: rpc_replay_tool --capture_file=/path/to/rpc_capture.xxx "
+            "--be_host=test_be --fe_host=test_fe [--speed=1.0]");
+    google::ParseCommandLineFlags(&argc, &argv, true);
+    if (FLAGS_capture_file.empty() || FLAGS_be_host.empty() || FLAGS_fe_host.empty()) {
+        std::cerr << "capture_file, be_host and fe_host are required" << std::endl;
+        return -1;
+    }
+    if (FLAGS_id_salt == 0) {
+        FLAGS_id_salt = doris::UnixMillis();
+    }
+    Status st = doris::replay();
+    if (!st.ok()) {
+        std::cerr << "replay failed: " << st << std::endl;
+        return -1;
+    }
+    return 0;
+}
@@ -0,0 +1,106 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+// The stable C ABI of the native vectorized UDF. A native UDF is a shared library loaded
+// into the BE process, it gets the column buffers of a whole block without any copy,
+// which avoids the JNI crossing of Java UDF and the serialization of RPC UDF.
+// This header only depends on the C standard library, plugins should include it as is.
+//
+// A plugin exports the following symbols, all with C linkage:
+//   int32_t doris_udf_abi_version(void);       required, returns DORIS_UDF_ABI_VERSION
+//   DorisUdfPrepareFn <prepare_fn_symbol>;     optional
+//   DorisUdfEvaluateFn <symbol>;               required
+//   DorisUdfCloseFn <close_fn_symbol>;         optional
+// The symbols are given by the properties of CREATE FUNCTION with "type"="NATIVE".
+//
+// Each execution thread has its own DorisUdfContext, so the functions are never called
+// concurrently with the same context. The memory allocated through the context is
+// accounted to the query and is freed by the host after close if the plugin leaks it.
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define DORIS_UDF_ABI_VERSION 1
+#define DORIS_UDF_ABI_VERSION_SYMBOL "doris_udf_abi_version"
+
+// Return code of the functions.
+#define DORIS_UDF_OK 0
+#define DORIS_UDF_ERROR 1
+
+// An input column of a block, which is read only and only valid during the evaluate call.
+// Constant columns are expanded to num_rows values by the host.
+typedef struct DorisUdfColumn {
+    // num_rows fixed width values, e.g. int32_t for INT or double for DOUBLE,
+    // or the concatenated chars of all rows for a string column.
+    const void* data;
+    // num_rows bytes, 1 means the row is null, NULL if the column is not nullable.
+    // The data of a null row is undefined.
+    const uint8_t* null_map;
+    // num_rows + 1 offsets into data for a string column, offsets[0] is 0 and
+    // row i is [offsets[i], offsets[i + 1]). NULL for a fixed width column.
+    const uint32_t* offsets;
+} DorisUdfColumn;
+
+// The result column of a block, filled by the evaluate function.
+typedef struct DorisUdfResult {
+    // num_rows fixed width values allocated by the host for a fixed width result.
+    // The chars buffer for a string result, NULL until reserve_chars is called.
+    void* data;
+    // num_rows bytes initialized to 0, set to 1 for a null row,
+    // NULL if the result is not nullable.
+    uint8_t* null_map;
+    // num_rows + 1 offsets of a string result, offsets[0] is set to 0 by the host and must
+    // not be changed. NULL for a fixed width result.
+    uint32_t* offsets;
+    // Make the chars buffer of a string result hold at least size bytes, the written chars
+    // are kept. Returns the new buffer which is also set to data, or NULL if the memory
+    // limit is exceeded.
+    void* (*reserve_chars)(struct DorisUdfResult* result, size_t size);
+    // owned by the host
+    void* host;
+} DorisUdfResult;
+
+typedef struct DorisUdfContext {
+    // Allocate memory accounted to the query, returns NULL if the memory limit is exceeded.
+    void* (*allocate)(struct DorisUdfContext* ctx, size_t size);
+    // Free the memory returned by allocate.
+    void (*free)(struct DorisUdfContext* ctx, void* ptr);
+    // Report the error message of a failed call, the message is copied.
+    void (*set_error)(struct DorisUdfContext* ctx, const char* message);
+    // The arguments of the function, known since prepare.
+    int32_t num_args;
+    // Owned by the plugin, e.g. set in prepare and released in close.
+    void* user_state;
+    // owned by the host
+    void* host;
+} DorisUdfContext;
+
+typedef int32_t (*DorisUdfAbiVersionFn)(void);
+typedef int32_t (*DorisUdfPrepareFn)(DorisUdfContext* ctx);
+typedef int32_t (*DorisUdfEvaluateFn)(DorisUdfContext* ctx, const DorisUdfColumn* args,
+                                      int64_t num_rows, DorisUdfResult* result);
+typedef void (*DorisUdfCloseFn)(DorisUdfContext* ctx);
+
+#ifdef __cplusplus
+}
+#endif
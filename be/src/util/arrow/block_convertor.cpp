@@ -22,7 +22,11 @@
 #include <arrow/array/builder_decimal.h>
 #include <arrow/array/builder_nested.h>
 #include <arrow/array/builder_primitive.h>
+#include <arrow/array/data.h>
+#include <arrow/array/util.h>
+#include <arrow/buffer.h>
 #include <arrow/record_batch.h>
+#include <arrow/result.h>
 #include <arrow/status.h>
 #include <arrow/type.h>
 #include <arrow/util/decimal.h>
@@ -30,6 +34,7 @@
 #include <arrow/visitor.h>
 #include <glog/logging.h>
 #include <stdint.h>
+#include <string.h>
 
 #include <algorithm>
 #include <ctime>
@@ -63,14 +68,49 @@ class Array;
 
 namespace doris {
 
+// Keeps the column moved out of the block alive as long as the arrow array sharing its data.
+class ColumnBuffer : public arrow::Buffer {
+public:
+    ColumnBuffer(vectorized::ColumnPtr column, const uint8_t* data, int64_t size)
+            : arrow::Buffer(data, size), _column(std::move(column)) {}
+
+private:
+    vectorized::ColumnPtr _column;
+};
+
+// The arrow types whose arrays have the layout of the ColumnVector of the doris type.
+static bool is_same_numeric_layout(arrow::Type::type arrow_type, vectorized::TypeIndex type) {
+    switch (arrow_type) {
+    case arrow::Type::INT8:
+        return type == vectorized::TypeIndex::Int8;
+    case arrow::Type::INT16:
+        return type == vectorized::TypeIndex::Int16;
+    case arrow::Type::INT32:
+        return type == vectorized::TypeIndex::Int32;
+    case arrow::Type::INT64:
+        return type == vectorized::TypeIndex::Int64;
+    case arrow::Type::FLOAT:
+        return type == vectorized::TypeIndex::Float32;
+    case arrow::Type::DOUBLE:
+        return type == vectorized::TypeIndex::Float64;
+    default:
+        return false;
+    }
+}
+
 // Convert Block to an Arrow::Array
 // We should keep this function to keep compatible with arrow's type visitor
 // Now we inherit TypeVisitor to use default Visit implementation
 class FromBlockConverter : public arrow::TypeVisitor {
 public:
+    // The numeric columns only referenced by `movable_block` are moved into the arrays.
     FromBlockConverter(const vectorized::Block& block, const std::shared_ptr<arrow::Schema>& schema,
-                       arrow::MemoryPool* pool)
-            : _block(block), _schema(schema), _pool(pool), _cur_field_idx(-1) {
+                       arrow::MemoryPool* pool, vectorized::Block* movable_block = nullptr)
+            : _block(block),
+              _movable_block(movable_block),
+              _schema(schema),
+              _pool(pool),
+              _cur_field_idx(-1) {
         // obtain local time zone
         time_t ts = 0;
         struct tm t;
@@ -353,7 +393,10 @@ private:
         return arrow::Status::OK();
     }
 
+    Status _convert_numeric_column(size_t idx, size_t num_rows, bool* converted);
+
     const vectorized::Block& _block;
+    vectorized::Block* _movable_block;
     const std::shared_ptr<arrow::Schema>& _schema;
     arrow::MemoryPool* _pool;
 
@@ -376,13 +419,20 @@ Status FromBlockConverter::convert(std::shared_ptr<arrow::RecordBatch>* out) {
     }
 
     _arrays.resize(num_fields);
+    // the columns may be moved out of the block
+    size_t num_rows = _block.rows();
 
     for (size_t idx = 0; idx < num_fields; ++idx) {
         _cur_field_idx = idx;
         _cur_start = 0;
-        _cur_rows = _block.rows();
-        _cur_col = _block.get_by_position(idx).column;
+        _cur_rows = num_rows;
         _cur_type = _block.get_by_position(idx).type;
+        bool converted = false;
+        RETURN_IF_ERROR(_convert_numeric_column(idx, num_rows, &converted));
+        if (converted) {
+            continue;
+        }
+        _cur_col = _block.get_by_position(idx).column;
         std::unique_ptr<arrow::ArrayBuilder> builder;
         auto arrow_st = arrow::MakeBuilder(_pool, _schema->field(idx)->type(), &builder);
         if (!arrow_st.ok()) {
@@ -396,7 +446,71 @@ Status FromBlockConverter::convert(std::shared_ptr<arrow::RecordBatch>* out) {
             return to_status(arrow_st);
         }
     }
-    *out = arrow::RecordBatch::Make(_schema, _block.rows(), std::move(_arrays));
+    *out = arrow::RecordBatch::Make(_schema, num_rows, std::move(_arrays));
+    return Status::OK();
+}
+
+// The values of a numeric column are copied at once instead of appended to a builder, or
+// shared with the array if the column can be moved, only the validity bitmap is built.
+Status FromBlockConverter::_convert_numeric_column(size_t idx, size_t num_rows, bool* converted) {
+    *converted = false;
+    const auto& arrow_type = _schema->field(idx)->type();
+    if (!is_same_numeric_layout(arrow_type->id(),
+                                vectorized::remove_nullable(_cur_type)->get_type_id())) {
+        return Status::OK();
+    }
+    const auto& column = _block.get_by_position(idx).column;
+    if (vectorized::is_column_const(*column)) {
+        return Status::OK();
+    }
+    const vectorized::ColumnPtr* nested = &column;
+    const vectorized::NullMap* null_map = nullptr;
+    if (column->is_nullable()) {
+        const auto& nullable_column = assert_cast<const vectorized::ColumnNullable&>(*column);
+        nested = &nullable_column.get_nested_column_ptr();
+        null_map = &nullable_column.get_null_map_data();
+    }
+    if (!(*nested)->is_numeric()) {
+        return Status::OK();
+    }
+
+    std::shared_ptr<arrow::Buffer> validity;
+    int64_t null_count = 0;
+    if (null_map != nullptr) {
+        auto bitmap_res = arrow::AllocateBuffer((num_rows + 7) / 8, _pool);
+        if (!bitmap_res.ok()) {
+            return to_status(bitmap_res.status());
+        }
+        validity = std::move(bitmap_res).ValueOrDie();
+        uint8_t* bits = validity->mutable_data();
+        memset(bits, 0, validity->size());
+        const auto* nulls = null_map->data();
+        for (size_t i = 0; i < num_rows; ++i) {
+            bits[i >> 3] |= static_cast<uint8_t>(!nulls[i]) << (i & 7);
+            null_count += nulls[i] != 0;
+        }
+        if (null_count == 0) {
+            validity = nullptr;
+        }
+    }
+
+    const auto* data = reinterpret_cast<const uint8_t*>((*nested)->get_raw_data().data);
+    int64_t data_size = num_rows * (*nested)->size_of_value_if_fixed();
+    std::shared_ptr<arrow::Buffer> values;
+    if (_movable_block != nullptr && column->use_count() == 1 && (*nested)->use_count() == 1) {
+        values = std::make_shared<ColumnBuffer>(
+                std::move(_movable_block->get_by_position(idx).column), data, data_size);
+    } else {
+        auto values_res = arrow::AllocateBuffer(data_size, _pool);
+        if (!values_res.ok()) {
+            return to_status(values_res.status());
+        }
+        values = std::move(values_res).ValueOrDie();
+        memcpy(values->mutable_data(), data, data_size);
+    }
+    _arrays[idx] = arrow::MakeArray(
+            arrow::ArrayData::Make(arrow_type, num_rows, {validity, values}, null_count));
+    *converted = true;
     return Status::OK();
 }
 
@@ -407,4 +521,11 @@ Status convert_to_arrow_batch(const vectorized::Block& block,
     return converter.convert(result);
 }
 
+Status convert_to_arrow_batch(vectorized::Block&& block,
+                              const std::shared_ptr<arrow::Schema>& schema, arrow::MemoryPool* pool,
+                              std::shared_ptr<arrow::RecordBatch>* result) {
+    FromBlockConverter converter(block, schema, pool, &block);
+    return converter.convert(result);
+}
+
 } // namespace doris
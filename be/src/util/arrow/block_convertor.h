@@ -40,4 +40,10 @@ Status convert_to_arrow_batch(const vectorized::Block& block,
                               const std::shared_ptr<arrow::Schema>& schema, arrow::MemoryPool* pool,
                               std::shared_ptr<arrow::RecordBatch>* result);
 
+// Same as above, but the numeric columns only referenced by `block` are moved into `result`
+// and their data is shared with the arrays instead of being copied.
+Status convert_to_arrow_batch(vectorized::Block&& block,
+                              const std::shared_ptr<arrow::Schema>& schema, arrow::MemoryPool* pool,
+                              std::shared_ptr<arrow::RecordBatch>* result);
+
 } // namespace doris
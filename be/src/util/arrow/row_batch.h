@@ -28,6 +28,7 @@
 
 namespace arrow {
 
+class DataType;
 class RecordBatch;
 class Schema;
 
@@ -36,6 +37,9 @@ class Schema;
 namespace doris {
 
 class RowDescriptor;
+struct TypeDescriptor;
+
+Status convert_to_arrow_type(const TypeDescriptor& type, std::shared_ptr<arrow::DataType>* result);
 
 // Convert Doris RowDescriptor to Arrow Schema.
 Status convert_to_arrow_schema(const RowDescriptor& row_desc,
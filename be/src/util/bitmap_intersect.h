@@ -17,6 +17,8 @@
 #pragma once
 #include <parallel_hashmap/phmap.h>
 
+#include <vector>
+
 #include "util/bitmap_value.h"
 #include "vec/common/string_ref.h"
 
@@ -166,11 +168,22 @@ public:
     }
 
     void update(const T& key, const BitmapValue& bitmap) {
-        if (_bitmaps.find(key) != _bitmaps.end()) {
-            _bitmaps[key] |= bitmap;
+        auto it = _bitmaps.find(key);
+        if (it != _bitmaps.end()) {
+            it->second |= bitmap;
         }
     }
 
+    // union all bitmaps of the key at once
+    void update(const T& key, const std::vector<const BitmapValue*>& bitmaps) {
+        auto it = _bitmaps.find(key);
+        if (it != _bitmaps.end()) {
+            it->second.fastunion(bitmaps);
+        }
+    }
+
+    bool contains_key(const T& key) const { return _bitmaps.find(key) != _bitmaps.end(); }
+
     void merge(const BitmapIntersect& other) {
         for (auto& kv : other._bitmaps) {
             if (_bitmaps.find(kv.first) != _bitmaps.end()) {
@@ -253,11 +266,24 @@ public:
     }
 
     void update(const std::string_view& key, const BitmapValue& bitmap) {
-        if (_bitmaps.find(key) != _bitmaps.end()) {
-            _bitmaps[key] |= bitmap;
+        auto it = _bitmaps.find(key);
+        if (it != _bitmaps.end()) {
+            it->second |= bitmap;
         }
     }
 
+    // union all bitmaps of the key at once
+    void update(const std::string_view& key, const std::vector<const BitmapValue*>& bitmaps) {
+        auto it = _bitmaps.find(key);
+        if (it != _bitmaps.end()) {
+            it->second.fastunion(bitmaps);
+        }
+    }
+
+    bool contains_key(const std::string_view& key) const {
+        return _bitmaps.find(key) != _bitmaps.end();
+    }
+
     void merge(const BitmapIntersect& other) {
         for (auto& kv : other._bitmaps) {
             if (_bitmaps.find(kv.first) != _bitmaps.end()) {
@@ -27,12 +27,14 @@
 #include <snappy/snappy.h>
 #include <stdint.h>
 #include <zconf.h>
+#include <zdict.h>
 #include <zlib.h>
 #include <zstd.h>
 #include <zstd_errors.h>
 
 #include <algorithm>
 #include <limits>
+#include <memory>
 #include <mutex>
 #include <new>
 #include <ostream>
@@ -616,6 +618,20 @@ public:
         for (auto ctx : _ctx_d_pool) {
             _delete_decompression_ctx(ctx);
         }
+        ZSTD_freeCDict(_cdict);
+        ZSTD_freeDDict(_ddict);
+    }
+
+    // Compress and decompress with the dictionary, which is copied. Only for the codecs created
+    // by create_zstd_dict_codec(), whose contexts are not shared with the instance().
+    Status init_dict(const Slice& dict) {
+        _cdict = ZSTD_createCDict(dict.data, dict.size, ZSTD_CLEVEL_DEFAULT);
+        _ddict = ZSTD_createDDict(dict.data, dict.size);
+        if (_cdict == nullptr || _ddict == nullptr) {
+            return Status::InvalidArgument("failed to create ZSTD dictionary of {} bytes",
+                                           dict.size);
+        }
+        return Status::OK();
     }
 
     size_t max_compressed_len(size_t len) override { return ZSTD_compressBound(len); }
@@ -667,6 +683,13 @@ public:
             return Status::InvalidArgument("ZSTD_CCtx_setParameter checksumFlag error: {}",
                                            ZSTD_getErrorString(ZSTD_getErrorCode(ret)));
         }
+        if (_cdict != nullptr) {
+            ret = ZSTD_CCtx_refCDict(context->ctx, _cdict);
+            if (ZSTD_isError(ret)) {
+                return Status::InvalidArgument("ZSTD_CCtx_refCDict error: {}",
+                                               ZSTD_getErrorString(ZSTD_getErrorCode(ret)));
+            }
+        }
 
         ZSTD_outBuffer out_buf = {compressed_buf.data, compressed_buf.size, 0};
 
@@ -720,6 +743,14 @@ public:
             }
         }};
 
+        if (_ddict != nullptr) {
+            auto ret = ZSTD_DCtx_refDDict(context->ctx, _ddict);
+            if (ZSTD_isError(ret)) {
+                return Status::InvalidArgument("ZSTD_DCtx_refDDict error: {}",
+                                               ZSTD_getErrorString(ZSTD_getErrorCode(ret)));
+            }
+        }
+
         ZSTD_inBuffer in_buf = {input.data, input.size, 0};
         ZSTD_outBuffer out_buf = {output->data, output->size, 0};
 
@@ -817,6 +848,9 @@ private:
 
     mutable std::mutex _ctx_d_mutex;
     mutable std::vector<DContext*> _ctx_d_pool;
+
+    ZSTD_CDict* _cdict = nullptr;
+    ZSTD_DDict* _ddict = nullptr;
 };
 
 class GzipBlockCompression final : public ZlibBlockCompression {
@@ -924,6 +958,34 @@ Status get_block_compression_codec(segment_v2::CompressionTypePB type,
     return Status::OK();
 }
 
+Status create_zstd_dict_codec(const Slice& dict, std::unique_ptr<BlockCompressionCodec>* codec) {
+    auto zstd_codec = std::make_unique<ZstdBlockCompression>();
+    RETURN_IF_ERROR(zstd_codec->init_dict(dict));
+    *codec = std::move(zstd_codec);
+    return Status::OK();
+}
+
+Status train_zstd_dict(const std::vector<Slice>& samples, size_t dict_size, std::string* dict) {
+    dict->clear();
+    std::string samples_buffer;
+    std::vector<size_t> sample_sizes;
+    sample_sizes.reserve(samples.size());
+    for (const auto& sample : samples) {
+        samples_buffer.append(sample.data, sample.size);
+        sample_sizes.push_back(sample.size);
+    }
+    dict->resize(dict_size);
+    auto ret = ZDICT_trainFromBuffer(dict->data(), dict_size, samples_buffer.data(),
+                                     sample_sizes.data(), sample_sizes.size());
+    if (ZDICT_isError(ret)) {
+        // too few or too small samples, they are compressed without a dictionary
+        dict->clear();
+        return Status::OK();
+    }
+    dict->resize(ret);
+    return Status::OK();
+}
+
 Status get_block_compression_codec(tparquet::CompressionCodec::type parquet_codec,
                                    BlockCompressionCodec** codec) {
     switch (parquet_codec) {
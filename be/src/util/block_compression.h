@@ -20,6 +20,8 @@
 #include <gen_cpp/parquet_types.h>
 
 #include <cstddef>
+#include <memory>
+#include <string>
 #include <vector>
 
 #include "common/status.h"
@@ -86,4 +88,12 @@ Status get_block_compression_codec(segment_v2::CompressionTypePB type,
 Status get_block_compression_codec(tparquet::CompressionCodec::type parquet_codec,
                                    BlockCompressionCodec** codec);
 
+// Create a ZSTD codec compressing with the dictionary trained by train_zstd_dict(), which may
+// be shared by threads like the ZSTD codec of get_block_compression_codec().
+Status create_zstd_dict_codec(const Slice& dict, std::unique_ptr<BlockCompressionCodec>* codec);
+
+// Train a ZSTD dictionary of at most `dict_size` bytes from the samples, `dict` is empty if
+// the samples are not enough to train one.
+Status train_zstd_dict(const std::vector<Slice>& samples, size_t dict_size, std::string* dict);
+
 } // namespace doris
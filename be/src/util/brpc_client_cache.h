@@ -30,6 +30,7 @@
 #include <parallel_hashmap/phmap.h>
 #include <stddef.h>
 
+#include <algorithm>
 #include <functional>
 #include <memory>
 #include <mutex>
@@ -91,22 +92,74 @@ public:
     }
 
     std::shared_ptr<T> get_client(const std::string& host_port) {
+        std::shared_ptr<Stubs> stubs;
+        auto get_value = [&stubs](const auto& v) { stubs = v.second; };
+        if (LIKELY(_stub_map.if_contains(host_port, get_value))) {
+            return _least_used(*stubs);
+        }
+
+        // new stubs and insert into map
+        stubs = std::make_shared<Stubs>();
+        std::string connect_type;
+        int num_channels = 1;
+        if constexpr (std::is_same_v<T, PBackendService_Stub>) {
+            connect_type = config::brpc_connection_type;
+            num_channels = std::max(config::brpc_num_channels_per_host, 1);
+        }
+        for (int i = 0; i < num_channels; ++i) {
+            // the channels of different connection groups do not share connections
+            auto stub = get_new_client_no_cache(host_port, "baidu_std", connect_type,
+                                                num_channels > 1 ? std::to_string(i) : "");
+            if (stub == nullptr) {
+                return nullptr;
+            }
+            stubs->push_back(std::move(stub));
+        }
+        _stub_map.try_emplace_l(
+                host_port, [&stubs](const auto& v) { stubs = v.second; }, stubs);
+        return _least_used(*stubs);
+    }
+
+#ifdef BE_TEST
+    virtual std::shared_ptr<T> get_control_client(const TNetworkAddress& taddr) {
+        return get_control_client(fmt::format("{}:{}", taddr.hostname, taddr.port));
+    }
+#else
+    std::shared_ptr<T> get_control_client(const TNetworkAddress& taddr) {
+        std::string realhost = taddr.hostname;
+        if (!is_valid_ip(taddr.hostname)) {
+            Status status = hostname_to_ip(taddr.hostname, realhost);
+            if (!status.ok()) {
+                LOG(WARNING) << "failed to get ip from host:" << status.to_string();
+                return nullptr;
+            }
+        }
+        return get_control_client(get_host_port(realhost, taddr.port));
+    }
+#endif
+
+    // The client for the small control RPCs such as runtime filters, which has its own
+    // connection, so they are not queued behind the blocks sent to the same host.
+    std::shared_ptr<T> get_control_client(const std::string& host_port) {
         std::shared_ptr<T> stub_ptr;
         auto get_value = [&stub_ptr](const auto& v) { stub_ptr = v.second; };
-        if (LIKELY(_stub_map.if_contains(host_port, get_value))) {
+        if (LIKELY(_control_stub_map.if_contains(host_port, get_value))) {
             return stub_ptr;
         }
 
-        // new one stub and insert into map
-        auto stub = get_new_client_no_cache(host_port);
-        _stub_map.try_emplace_l(
+        auto stub = get_new_client_no_cache(host_port, "baidu_std", "single", "control");
+        if (stub == nullptr) {
+            return nullptr;
+        }
+        _control_stub_map.try_emplace_l(
                 host_port, [&stub](const auto& v) { stub = v.second; }, stub);
         return stub;
     }
 
     std::shared_ptr<T> get_new_client_no_cache(const std::string& host_port,
                                                const std::string& protocol = "baidu_std",
-                                               const std::string& connect_type = "") {
+                                               const std::string& connect_type = "",
+                                               const std::string& connection_group = "") {
         brpc::ChannelOptions options;
         if constexpr (std::is_same_v<T, PFunctionService_Stub>) {
             options.protocol = config::function_service_protocol;
@@ -116,6 +169,7 @@ public:
         if (connect_type != "") {
             options.connection_type = connect_type;
         }
+        options.connection_group = connection_group;
         options.connect_timeout_ms = 2000;
         options.max_retry = 10;
 
@@ -135,9 +189,15 @@ public:
 
     size_t size() { return _stub_map.size(); }
 
-    void clear() { _stub_map.clear(); }
+    void clear() {
+        _stub_map.clear();
+        _control_stub_map.clear();
+    }
 
-    size_t erase(const std::string& host_port) { return _stub_map.erase(host_port); }
+    size_t erase(const std::string& host_port) {
+        _control_stub_map.erase(host_port);
+        return _stub_map.erase(host_port);
+    }
 
     size_t erase(const std::string& host, int port) {
         std::string host_port = fmt::format("{}:{}", host, port);
@@ -145,7 +205,7 @@ public:
     }
 
     size_t erase(const butil::EndPoint& endpoint) {
-        return _stub_map.erase(butil::endpoint2str(endpoint).c_str());
+        return erase(std::string(butil::endpoint2str(endpoint).c_str()));
     }
 
     bool exist(const std::string& host_port) {
@@ -193,7 +253,19 @@ public:
     }
 
 private:
-    StubMap<T> _stub_map;
+    using Stubs = std::vector<std::shared_ptr<T>>;
+
+    // The stubs are held by the senders for their whole life, so the one with the fewest
+    // holders is likely the one with the least load on its connections.
+    static std::shared_ptr<T> _least_used(const Stubs& stubs) {
+        auto it = std::min_element(stubs.begin(), stubs.end(), [](const auto& a, const auto& b) {
+            return a.use_count() < b.use_count();
+        });
+        return *it;
+    }
+
+    StubMap<Stubs> _stub_map;
+    StubMap<T> _control_stub_map;
 };
 
 using InternalServiceClientCache = BrpcClientCache<PBackendService_Stub>;
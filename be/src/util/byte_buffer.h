@@ -20,7 +20,9 @@
 #include <string.h>
 
 #include <cstddef>
+#include <functional>
 #include <memory>
+#include <utility>
 
 #include "bvar/bvar.h"
 #include "common/logging.h"
@@ -39,8 +41,19 @@ struct ByteBuffer {
         return ptr;
     }
 
+    // references the bytes owned by others instead of allocating, `release` is called
+    // when the buffer is destroyed.
+    static ByteBufferPtr reference(char* data, size_t size, std::function<void()> release) {
+        ByteBufferPtr ptr(new ByteBuffer(data, size, std::move(release)));
+        return ptr;
+    }
+
     ~ByteBuffer() {
-        delete[] ptr;
+        if (_release) {
+            _release();
+        } else {
+            delete[] ptr;
+        }
         g_byte_buffer_allocate_kb << -(capacity / 1024);
         g_byte_buffer_cnt << -1;
     }
@@ -75,6 +88,14 @@ private:
         g_byte_buffer_allocate_kb << capacity / 1024;
         g_byte_buffer_cnt << 1;
     }
+
+    ByteBuffer(char* data, size_t size, std::function<void()> release)
+            : ptr(data), pos(0), limit(size), capacity(size), _release(std::move(release)) {
+        g_byte_buffer_allocate_kb << capacity / 1024;
+        g_byte_buffer_cnt << 1;
+    }
+
+    std::function<void()> _release;
 };
 
 } // namespace doris
@@ -0,0 +1,190 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "util/cpu_sampler.h"
+
+#include <errno.h>
+#include <glog/logging.h>
+#include <gperftools/stacktrace.h>
+#include <string.h>
+
+#include <algorithm>
+#include <chrono>
+
+#include "common/config.h"
+#include "util/folded_stacks.h"
+#include "util/thread.h"
+#include "util/time.h"
+
+namespace doris {
+
+// the realtime signals below SIGRTMIN + 2 are reserved by glibc on some platforms
+static const int kSampleSignal = SIGRTMIN + 2;
+
+CpuSampler* CpuSampler::instance() {
+    static CpuSampler sampler;
+    return &sampler;
+}
+
+Status CpuSampler::start(int frequency, BfdParser* bfd_parser) {
+    if (_started) {
+        return Status::OK();
+    }
+    if (frequency <= 0) {
+        return Status::InvalidArgument("invalid cpu sampler frequency {}", frequency);
+    }
+    _bfd_parser = bfd_parser;
+    _samples.reset(new Sample[NUM_SAMPLE_SLOTS]);
+
+    struct sigaction sa;
+    memset(&sa, 0, sizeof(sa));
+    sa.sa_sigaction = _signal_handler;
+    sa.sa_flags = SA_SIGINFO | SA_RESTART;
+    sigemptyset(&sa.sa_mask);
+    if (sigaction(kSampleSignal, &sa, nullptr) != 0) {
+        return Status::InternalError("failed to install the cpu sampler signal handler: {}",
+                                     strerror(errno));
+    }
+
+    // the timer of the CPU time of the process signals the thread consuming the CPU
+    struct sigevent sev;
+    memset(&sev, 0, sizeof(sev));
+    sev.sigev_notify = SIGEV_SIGNAL;
+    sev.sigev_signo = kSampleSignal;
+    if (timer_create(CLOCK_PROCESS_CPUTIME_ID, &sev, &_timer) != 0) {
+        return Status::InternalError("failed to create the cpu sampler timer: {}",
+                                     strerror(errno));
+    }
+    struct itimerspec its;
+    memset(&its, 0, sizeof(its));
+    its.it_interval.tv_nsec = 1000000000L / frequency;
+    its.it_value = its.it_interval;
+    if (timer_settime(_timer, 0, &its, nullptr) != 0) {
+        timer_delete(_timer);
+        return Status::InternalError("failed to start the cpu sampler timer: {}", strerror(errno));
+    }
+    _started = true;
+    RETURN_IF_ERROR(Thread::create(
+            "CpuSampler", "drain_cpu_samples", [this]() { this->_drain_thread(); }, &_thread));
+    LOG(INFO) << "cpu sampler started, frequency " << frequency;
+    return Status::OK();
+}
+
+void CpuSampler::stop() {
+    if (!_started) {
+        return;
+    }
+    timer_delete(_timer);
+    _stop_latch.count_down();
+    if (_thread) {
+        _thread->join();
+    }
+    _started = false;
+}
+
+void CpuSampler::_signal_handler(int signo, siginfo_t* info, void* context) {
+    int saved_errno = errno;
+    auto* sampler = instance();
+    uint64_t pos = sampler->_next.fetch_add(1, std::memory_order_relaxed);
+    auto& sample = sampler->_samples[pos % NUM_SAMPLE_SLOTS];
+    sample.seq.store(0, std::memory_order_relaxed);
+    std::atomic_signal_fence(std::memory_order_seq_cst);
+    sample.tag = cpu_sample_tag;
+    // skip the frames of the handler and the signal trampoline
+    sample.depth = GetStackTrace(sample.frames, MAX_DEPTH, 2);
+    sample.seq.store(pos + 1, std::memory_order_release);
+    errno = saved_errno;
+}
+
+void CpuSampler::_drain_thread() {
+    do {
+        _drain();
+    } while (!_stop_latch.wait_for(std::chrono::seconds(1)));
+}
+
+void CpuSampler::_drain() {
+    int64_t minute = UnixSeconds() / 60;
+    uint64_t next = _next.load(std::memory_order_relaxed);
+    // the samples older than the ring buffer are overwritten
+    _drained = std::max(_drained, next > NUM_SAMPLE_SLOTS ? next - NUM_SAMPLE_SLOTS : 0);
+
+    std::lock_guard l(_lock);
+    auto& profile = _profiles[minute];
+    for (; _drained < next; ++_drained) {
+        auto& sample = _samples[_drained % NUM_SAMPLE_SLOTS];
+        if (sample.seq.load(std::memory_order_acquire) != _drained + 1) {
+            // being written, or overwritten by a later sample
+            continue;
+        }
+        StackKey key(reinterpret_cast<const char*>(&sample.tag), sizeof(CpuSampleTag));
+        key.append(reinterpret_cast<const char*>(sample.frames),
+                   std::clamp(sample.depth, 0, MAX_DEPTH) * sizeof(void*));
+        if (sample.seq.load(std::memory_order_acquire) != _drained + 1) {
+            continue;
+        }
+        auto it = profile.stack_counts.find(key);
+        if (it != profile.stack_counts.end()) {
+            ++it->second;
+        } else if (profile.stack_counts.size() <
+                   static_cast<size_t>(config::cpu_sampler_max_stacks_per_minute)) {
+            profile.stack_counts.emplace(std::move(key), 1);
+        } else {
+            ++profile.truncated;
+        }
+    }
+    while (!_profiles.empty() &&
+           _profiles.begin()->first <= minute - config::cpu_sampler_retention_minutes) {
+        _profiles.erase(_profiles.begin());
+    }
+}
+
+std::string CpuSampler::folded_stacks(const TUniqueId& query_id, uint64_t workload_group_id,
+                                      int64_t start_s, int64_t end_s) {
+    std::unordered_map<StackKey, uint64_t> stack_counts;
+    uint64_t truncated = 0;
+    {
+        std::lock_guard l(_lock);
+        for (auto it = _profiles.lower_bound(start_s / 60);
+             it != _profiles.end() && it->first <= end_s / 60; ++it) {
+            for (const auto& [key, count] : it->second.stack_counts) {
+                CpuSampleTag tag;
+                memcpy(&tag, key.data(), sizeof(CpuSampleTag));
+                if ((query_id.hi != 0 || query_id.lo != 0) &&
+                    (tag.query_id_hi != query_id.hi || tag.query_id_lo != query_id.lo)) {
+                    continue;
+                }
+                if (workload_group_id != 0 && tag.workload_group_id != workload_group_id) {
+                    continue;
+                }
+                stack_counts[key] += count;
+            }
+            truncated += it->second.truncated;
+        }
+    }
+
+    FoldedStacksBuilder builder(_bfd_parser);
+    for (const auto& [key, count] : stack_counts) {
+        builder.add(key.data() + sizeof(CpuSampleTag),
+                    (key.size() - sizeof(CpuSampleTag)) / sizeof(void*), count);
+    }
+    if (truncated > 0) {
+        builder.add_line("[truncated]", truncated);
+    }
+    return std::move(builder.result());
+}
+
+} // namespace doris
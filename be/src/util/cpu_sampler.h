@@ -0,0 +1,116 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <gen_cpp/Types_types.h>
+#include <signal.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <time.h>
+
+#include <atomic>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "common/status.h"
+#include "gutil/ref_counted.h"
+#include "util/countdown_latch.h"
+
+namespace doris {
+
+class BfdParser;
+class Thread;
+
+// The tags of the CPU samples of the current thread, set while the thread works for a query,
+// see AttachTask.
+struct CpuSampleTag {
+    uint64_t query_id_hi = 0;
+    uint64_t query_id_lo = 0;
+    uint64_t workload_group_id = 0;
+};
+
+inline thread_local CpuSampleTag cpu_sample_tag;
+
+// CpuSampler samples the stacks of the threads burning CPU at a frequency of the CPU time of
+// the process. The signal handler writes the samples into a lock free ring buffer, which is
+// drained by a background thread every second into the counts of the distinct stacks per
+// minute, so the profile of a query or a workload group in the last hours is served without
+// reproducing the workload.
+// It uses a CPU time timer with a realtime signal instead of SIGPROF, which is taken by the
+// profiler of gperftools behind /pprof/profile.
+class CpuSampler {
+public:
+    static CpuSampler* instance();
+
+    Status start(int frequency, BfdParser* bfd_parser);
+
+    void stop();
+
+    // The samples of [start_s, end_s] in unix seconds as folded stacks, one "f1;f2;f3 count" per
+    // line with the outermost frame first, which flamegraph.pl and speedscope read. A query id
+    // or workload group id of 0 matches all.
+    std::string folded_stacks(const TUniqueId& query_id, uint64_t workload_group_id,
+                              int64_t start_s, int64_t end_s);
+
+private:
+    static constexpr int MAX_DEPTH = 64;
+    static constexpr size_t NUM_SAMPLE_SLOTS = 1 << 14;
+
+    struct Sample {
+        // the position of the sample + 1 when the sample is written, 0 while writing
+        std::atomic<uint64_t> seq {0};
+        CpuSampleTag tag;
+        int depth = 0;
+        void* frames[MAX_DEPTH];
+    };
+
+    // tag followed by the frames
+    using StackKey = std::string;
+    struct MinuteProfile {
+        std::unordered_map<StackKey, uint64_t> stack_counts;
+        uint64_t truncated = 0;
+    };
+
+    CpuSampler() : _stop_latch(1) {}
+
+    static void _signal_handler(int signo, siginfo_t* info, void* context);
+
+    void _drain_thread();
+
+    void _drain();
+
+    std::unique_ptr<Sample[]> _samples;
+    std::atomic<uint64_t> _next {0};
+    uint64_t _drained = 0;
+
+    BfdParser* _bfd_parser = nullptr;
+    bool _started = false;
+    timer_t _timer;
+    CountDownLatch _stop_latch;
+    scoped_refptr<Thread> _thread;
+
+    std::mutex _lock;
+    // minute in unix time -> profile
+    std::map<int64_t, MinuteProfile> _profiles;
+};
+
+} // namespace doris
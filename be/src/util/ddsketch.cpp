@@ -0,0 +1,231 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+
+#include "util/ddsketch.h"
+
+#include <string.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include "util/coding.h"
+#include "util/slice.h"
+
+namespace doris {
+
+static constexpr uint8_t DDSKETCH_SERIALIZE_VERSION = 1;
+
+static uint64_t zigzag_encode32(int32_t v) {
+    return (static_cast<uint32_t>(v) << 1) ^ static_cast<uint32_t>(v >> 31);
+}
+
+static int32_t zigzag_decode32(uint64_t v) {
+    return static_cast<int32_t>((v >> 1) ^ (~(v & 1) + 1));
+}
+
+DDSketch::DDSketch(double relative_accuracy) {
+    if (!(relative_accuracy >= MIN_RELATIVE_ACCURACY && relative_accuracy < 1)) {
+        relative_accuracy = DEFAULT_RELATIVE_ACCURACY;
+    }
+    _relative_accuracy = relative_accuracy;
+    _gamma = (1 + relative_accuracy) / (1 - relative_accuracy);
+    _multiplier = 1 / std::log(_gamma);
+    _min_indexable_value = std::numeric_limits<double>::min() * _gamma;
+}
+
+int32_t DDSketch::_index(double value) const {
+    return static_cast<int32_t>(std::ceil(std::log(value) * _multiplier));
+}
+
+double DDSketch::_value(int32_t index) const {
+    return 2 * std::pow(_gamma, index) / (_gamma + 1);
+}
+
+void DDSketch::add(double value) {
+    if (!std::isfinite(value)) {
+        return;
+    }
+    if (value >= _min_indexable_value) {
+        _positive.add(_index(value), 1);
+    } else if (value <= -_min_indexable_value) {
+        _negative.add(_index(-value), 1);
+    } else {
+        _zero_count++;
+    }
+}
+
+void DDSketch::add_batch(const double* values, size_t count) {
+    for (size_t i = 0; i < count; ++i) {
+        add(values[i]);
+    }
+}
+
+void DDSketch::merge(const DDSketch& other) {
+    _zero_count += other._zero_count;
+    if (other._gamma == _gamma) {
+        _positive.merge(other._positive);
+        _negative.merge(other._negative);
+        return;
+    }
+    // re-map the buckets of the other accuracy by their estimated values
+    if (!other._positive.empty()) {
+        for (int32_t i = other._positive.min_index(); i <= other._positive.max_index(); ++i) {
+            if (other._positive.count_at(i) > 0) {
+                _positive.add(_index(other._value(i)), other._positive.count_at(i));
+            }
+        }
+    }
+    if (!other._negative.empty()) {
+        for (int32_t i = other._negative.min_index(); i <= other._negative.max_index(); ++i) {
+            if (other._negative.count_at(i) > 0) {
+                _negative.add(_index(other._value(i)), other._negative.count_at(i));
+            }
+        }
+    }
+}
+
+double DDSketch::quantile(double quantile) const {
+    uint64_t total = count();
+    if (total == 0 || !(quantile >= 0 && quantile <= 1)) {
+        return std::nan("");
+    }
+    double rank = quantile * (total - 1);
+    uint64_t seen = 0;
+    // from the negative value of the largest magnitude
+    if (!_negative.empty()) {
+        for (int32_t i = _negative.max_index(); i >= _negative.min_index(); --i) {
+            seen += _negative.count_at(i);
+            if (seen > rank) {
+                return -_value(i);
+            }
+        }
+    }
+    seen += _zero_count;
+    if (seen > rank) {
+        return 0;
+    }
+    for (int32_t i = _positive.min_index(); i < _positive.max_index(); ++i) {
+        seen += _positive.count_at(i);
+        if (seen > rank) {
+            return _value(i);
+        }
+    }
+    return _value(_positive.max_index());
+}
+
+void DDSketch::clear() {
+    _zero_count = 0;
+    _positive.clear();
+    _negative.clear();
+}
+
+void DDSketch::serialize(std::string* dst) const {
+    dst->push_back(DDSKETCH_SERIALIZE_VERSION);
+    dst->append((const char*)&_relative_accuracy, sizeof(_relative_accuracy));
+    put_varint64(dst, _zero_count);
+    _positive.serialize(dst);
+    _negative.serialize(dst);
+}
+
+bool DDSketch::deserialize(const Slice& slice) {
+    Slice input = slice;
+    if (input.size < 1 + sizeof(double) || input.data[0] != DDSKETCH_SERIALIZE_VERSION) {
+        return false;
+    }
+    double relative_accuracy = 0;
+    memcpy(&relative_accuracy, input.data + 1, sizeof(double));
+    input.remove_prefix(1 + sizeof(double));
+    *this = DDSketch(relative_accuracy);
+    if (!get_varint64(&input, &_zero_count) || !_positive.deserialize(&input) ||
+        !_negative.deserialize(&input) || input.size != 0) {
+        clear();
+        return false;
+    }
+    return true;
+}
+
+void DDSketch::Store::merge(const Store& other) {
+    if (other.empty()) {
+        return;
+    }
+    if (empty()) {
+        *this = other;
+        return;
+    }
+    // The buckets under the lowest one kept are collapsed into it. The result only depends on
+    // the max index, so it is the same for any order of adds and merges.
+    int32_t max_index = std::max(this->max_index(), other.max_index());
+    int32_t min_index =
+            std::max(std::min(_offset, other._offset), max_index - MAX_NUM_BUCKETS + 1);
+    std::vector<uint64_t> counts(max_index - min_index + 1, 0);
+    for (const Store* store : {static_cast<const Store*>(this), &other}) {
+        for (size_t i = 0; i < store->_counts.size(); ++i) {
+            int32_t index = std::max<int32_t>(store->_offset + i, min_index);
+            counts[index - min_index] += store->_counts[i];
+        }
+    }
+    _offset = min_index;
+    _count += other._count;
+    _counts.swap(counts);
+}
+
+void DDSketch::Store::_extend_and_add(int32_t index, uint64_t count) {
+    Store store;
+    store._offset = index;
+    store._count = count;
+    store._counts.push_back(count);
+    merge(store);
+}
+
+void DDSketch::Store::serialize(std::string* dst) const {
+    put_varint64(dst, _counts.size());
+    if (_counts.empty()) {
+        return;
+    }
+    put_varint64(dst, zigzag_encode32(_offset));
+    for (auto count : _counts) {
+        put_varint64(dst, count);
+    }
+}
+
+bool DDSketch::Store::deserialize(Slice* input) {
+    clear();
+    uint64_t num_buckets = 0;
+    if (!get_varint64(input, &num_buckets) || num_buckets > MAX_NUM_BUCKETS) {
+        return false;
+    }
+    if (num_buckets == 0) {
+        return true;
+    }
+    uint64_t offset = 0;
+    if (!get_varint64(input, &offset)) {
+        return false;
+    }
+    _offset = zigzag_decode32(offset);
+    _counts.resize(num_buckets);
+    for (auto& count : _counts) {
+        if (!get_varint64(input, &count)) {
+            return false;
+        }
+        _count += count;
+    }
+    return true;
+}
+
+} // namespace doris
@@ -0,0 +1,127 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <string>
+#include <vector>
+
+namespace doris {
+
+struct Slice;
+
+// A quantile sketch with relative error guarantee, see "DDSketch: A Fast and Fully-Mergeable
+// Quantile Sketch with Relative-Error Guarantees" (VLDB 2019). A value v is counted in the
+// bucket ceil(log_gamma(|v|)) of its sign, gamma = (1 + alpha) / (1 - alpha), so an estimated
+// quantile is within the relative error alpha of the exact one. Sketches of the same alpha
+// merge by adding the counts of the buckets, the result does not depend on the order of the
+// merges unlike TDigest. The buckets of the values closest to zero are collapsed when there
+// are more than MAX_NUM_BUCKETS buckets of a sign, which covers about 40 orders of magnitude
+// with the default alpha.
+//
+// The serialized layout is:
+//   Version(1) | Alpha(8) | ZeroCount(varint) | PositiveStore | NegativeStore
+// a store is:
+//   NumBuckets(varint) | [MinIndex(zigzag varint) | Counts(varint * NumBuckets)]
+class DDSketch {
+public:
+    static constexpr double DEFAULT_RELATIVE_ACCURACY = 0.01;
+    static constexpr int32_t MAX_NUM_BUCKETS = 2048;
+
+    static constexpr double MIN_RELATIVE_ACCURACY = 0.0001;
+
+    // fall back to the default one if relative_accuracy is not in [0.0001, 1)
+    explicit DDSketch(double relative_accuracy = DEFAULT_RELATIVE_ACCURACY);
+
+    double relative_accuracy() const { return _relative_accuracy; }
+
+    // NaN and infinity are ignored
+    void add(double value);
+
+    void add_batch(const double* values, size_t count);
+
+    void merge(const DDSketch& other);
+
+    // Return NaN if the sketch is empty or quantile is not in [0, 1]
+    double quantile(double quantile) const;
+
+    uint64_t count() const { return _zero_count + _positive.count() + _negative.count(); }
+
+    void clear();
+
+    void serialize(std::string* dst) const;
+
+    // Return false if the slice is not a valid serialized sketch
+    bool deserialize(const Slice& slice);
+
+private:
+    // counts of the continuous buckets starting from _offset
+    class Store {
+    public:
+        void add(int32_t index, uint64_t count) {
+            if (index >= _offset && index < _offset + (int32_t)_counts.size()) {
+                _counts[index - _offset] += count;
+                _count += count;
+                return;
+            }
+            _extend_and_add(index, count);
+        }
+
+        void merge(const Store& other);
+
+        bool empty() const { return _counts.empty(); }
+        uint64_t count() const { return _count; }
+        int32_t min_index() const { return _offset; }
+        int32_t max_index() const { return _offset + (int32_t)_counts.size() - 1; }
+        uint64_t count_at(int32_t index) const { return _counts[index - _offset]; }
+
+        void clear() {
+            _offset = 0;
+            _count = 0;
+            _counts.clear();
+        }
+
+        void serialize(std::string* dst) const;
+        bool deserialize(Slice* input);
+
+    private:
+        void _extend_and_add(int32_t index, uint64_t count);
+
+        int32_t _offset = 0;
+        uint64_t _count = 0;
+        std::vector<uint64_t> _counts;
+    };
+
+    int32_t _index(double value) const;
+    // the estimated value of the bucket, which is within the relative error of its values
+    double _value(int32_t index) const;
+
+    double _relative_accuracy;
+    double _gamma;
+    double _multiplier;
+    // the values whose magnitudes are less than it are counted as zero
+    double _min_indexable_value;
+    uint64_t _zero_count = 0;
+    Store _positive;
+    Store _negative;
+};
+
+} // namespace doris
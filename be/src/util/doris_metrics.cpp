@@ -29,6 +29,7 @@
 #include <functional>
 #include <ostream>
 
+#include "common/config.h"
 #include "common/status.h"
 #include "io/fs/local_file_system.h"
 #include "util/system_metrics.h"
@@ -128,6 +129,12 @@ DEFINE_COUNTER_METRIC_PROTOTYPE_5ARG(stream_receive_bytes_total, MetricUnit::BYT
                                      Labels({{"type", "receive_bytes"}}));
 DEFINE_COUNTER_METRIC_PROTOTYPE_5ARG(stream_load_rows_total, MetricUnit::ROWS, "", stream_load,
                                      Labels({{"type", "load_rows"}}));
+DEFINE_COUNTER_METRIC_PROTOTYPE_5ARG(routine_load_consume_rows_total, MetricUnit::ROWS, "",
+                                     routine_load, Labels({{"type", "consume_rows"}}));
+DEFINE_COUNTER_METRIC_PROTOTYPE_5ARG(routine_load_consume_bytes_total, MetricUnit::BYTES, "",
+                                     routine_load, Labels({{"type", "consume_bytes"}}));
+DEFINE_COUNTER_METRIC_PROTOTYPE_5ARG(routine_load_decode_rows_total, MetricUnit::ROWS, "",
+                                     routine_load, Labels({{"type", "decode_rows"}}));
 
 DEFINE_COUNTER_METRIC_PROTOTYPE_2ARG(load_rows, MetricUnit::ROWS);
 DEFINE_COUNTER_METRIC_PROTOTYPE_2ARG(load_bytes, MetricUnit::BYTES);
@@ -135,11 +142,21 @@ DEFINE_COUNTER_METRIC_PROTOTYPE_2ARG(load_bytes, MetricUnit::BYTES);
 DEFINE_COUNTER_METRIC_PROTOTYPE_2ARG(memtable_flush_total, MetricUnit::OPERATIONS);
 DEFINE_COUNTER_METRIC_PROTOTYPE_2ARG(memtable_flush_duration_us, MetricUnit::MICROSECONDS);
 
+DEFINE_COUNTER_METRIC_PROTOTYPE_2ARG(delete_bitmap_calc_segment_total, MetricUnit::NOUNIT);
+DEFINE_COUNTER_METRIC_PROTOTYPE_2ARG(delete_bitmap_calc_segment_skipped_total, MetricUnit::NOUNIT);
+DEFINE_COUNTER_METRIC_PROTOTYPE_2ARG(delete_bitmap_calc_duration_us, MetricUnit::MICROSECONDS);
+DEFINE_COUNTER_METRIC_PROTOTYPE_2ARG(load_mem_proactive_flush_total, MetricUnit::OPERATIONS);
+DEFINE_COUNTER_METRIC_PROTOTYPE_2ARG(load_mem_soft_limit_flush_total, MetricUnit::OPERATIONS);
+DEFINE_COUNTER_METRIC_PROTOTYPE_2ARG(load_mem_hard_limit_flush_total, MetricUnit::OPERATIONS);
+DEFINE_COUNTER_METRIC_PROTOTYPE_2ARG(load_mem_flush_picked_bytes, MetricUnit::BYTES);
+
 DEFINE_GAUGE_METRIC_PROTOTYPE_2ARG(memory_pool_bytes_total, MetricUnit::BYTES);
 DEFINE_GAUGE_CORE_METRIC_PROTOTYPE_2ARG(process_thread_num, MetricUnit::NOUNIT);
 DEFINE_GAUGE_CORE_METRIC_PROTOTYPE_2ARG(process_fd_num_used, MetricUnit::NOUNIT);
 DEFINE_GAUGE_METRIC_PROTOTYPE_2ARG(process_fd_num_limit_soft, MetricUnit::NOUNIT);
 DEFINE_GAUGE_METRIC_PROTOTYPE_2ARG(process_fd_num_limit_hard, MetricUnit::NOUNIT);
+DEFINE_GAUGE_METRIC_PROTOTYPE_2ARG(huge_page_alloc_bytes, MetricUnit::BYTES);
+DEFINE_GAUGE_METRIC_PROTOTYPE_2ARG(process_anon_huge_page_bytes, MetricUnit::BYTES);
 
 DEFINE_GAUGE_METRIC_PROTOTYPE_2ARG(tablet_cumulative_max_compaction_score, MetricUnit::NOUNIT);
 DEFINE_GAUGE_METRIC_PROTOTYPE_2ARG(tablet_base_max_compaction_score, MetricUnit::NOUNIT);
@@ -151,6 +168,7 @@ DEFINE_GAUGE_METRIC_PROTOTYPE_2ARG(compaction_used_permits, MetricUnit::NOUNIT);
 DEFINE_GAUGE_METRIC_PROTOTYPE_2ARG(compaction_waitting_permits, MetricUnit::NOUNIT);
 
 DEFINE_HISTOGRAM_METRIC_PROTOTYPE_2ARG(tablet_version_num_distribution, MetricUnit::NOUNIT);
+DEFINE_HISTOGRAM_METRIC_PROTOTYPE_2ARG(pipeline_task_schedule_latency_us, MetricUnit::MICROSECONDS);
 
 DEFINE_GAUGE_CORE_METRIC_PROTOTYPE_2ARG(query_scan_bytes_per_second, MetricUnit::BYTES);
 
@@ -267,15 +285,28 @@ DorisMetrics::DorisMetrics() : _metric_registry(_s_registry_name) {
     INT_COUNTER_METRIC_REGISTER(_server_metric_entity, stream_load_txn_rollback_request_total);
     INT_COUNTER_METRIC_REGISTER(_server_metric_entity, stream_receive_bytes_total);
     INT_COUNTER_METRIC_REGISTER(_server_metric_entity, stream_load_rows_total);
+    INT_COUNTER_METRIC_REGISTER(_server_metric_entity, routine_load_consume_rows_total);
+    INT_COUNTER_METRIC_REGISTER(_server_metric_entity, routine_load_consume_bytes_total);
+    INT_COUNTER_METRIC_REGISTER(_server_metric_entity, routine_load_decode_rows_total);
 
     INT_COUNTER_METRIC_REGISTER(_server_metric_entity, memtable_flush_total);
     INT_COUNTER_METRIC_REGISTER(_server_metric_entity, memtable_flush_duration_us);
 
+    INT_COUNTER_METRIC_REGISTER(_server_metric_entity, delete_bitmap_calc_segment_total);
+    INT_COUNTER_METRIC_REGISTER(_server_metric_entity, delete_bitmap_calc_segment_skipped_total);
+    INT_COUNTER_METRIC_REGISTER(_server_metric_entity, delete_bitmap_calc_duration_us);
+    INT_COUNTER_METRIC_REGISTER(_server_metric_entity, load_mem_proactive_flush_total);
+    INT_COUNTER_METRIC_REGISTER(_server_metric_entity, load_mem_soft_limit_flush_total);
+    INT_COUNTER_METRIC_REGISTER(_server_metric_entity, load_mem_hard_limit_flush_total);
+    INT_COUNTER_METRIC_REGISTER(_server_metric_entity, load_mem_flush_picked_bytes);
+
     INT_GAUGE_METRIC_REGISTER(_server_metric_entity, memory_pool_bytes_total);
     INT_GAUGE_METRIC_REGISTER(_server_metric_entity, process_thread_num);
     INT_GAUGE_METRIC_REGISTER(_server_metric_entity, process_fd_num_used);
     INT_GAUGE_METRIC_REGISTER(_server_metric_entity, process_fd_num_limit_soft);
     INT_GAUGE_METRIC_REGISTER(_server_metric_entity, process_fd_num_limit_hard);
+    INT_GAUGE_METRIC_REGISTER(_server_metric_entity, huge_page_alloc_bytes);
+    INT_GAUGE_METRIC_REGISTER(_server_metric_entity, process_anon_huge_page_bytes);
 
     INT_GAUGE_METRIC_REGISTER(_server_metric_entity, tablet_cumulative_max_compaction_score);
     INT_GAUGE_METRIC_REGISTER(_server_metric_entity, tablet_base_max_compaction_score);
@@ -287,6 +318,7 @@ DorisMetrics::DorisMetrics() : _metric_registry(_s_registry_name) {
     INT_GAUGE_METRIC_REGISTER(_server_metric_entity, compaction_waitting_permits);
 
     HISTOGRAM_METRIC_REGISTER(_server_metric_entity, tablet_version_num_distribution);
+    HISTOGRAM_METRIC_REGISTER(_server_metric_entity, pipeline_task_schedule_latency_us);
 
     INT_GAUGE_METRIC_REGISTER(_server_metric_entity, query_scan_bytes_per_second);
 
@@ -338,6 +370,7 @@ void DorisMetrics::initialize(bool init_system_metrics, const std::set<std::stri
 void DorisMetrics::_update() {
     _update_process_thread_num();
     _update_process_fd_num();
+    _update_process_huge_page_bytes();
 }
 
 // get num of thread of doris_be process
@@ -420,4 +453,32 @@ void DorisMetrics::_update_process_fd_num() {
     fclose(fp);
 }
 
+// get the anonymous memory of doris_be process backed by transparent huge pages,
+// compared with huge_page_alloc_bytes it shows how much of the advised memory is covered.
+void DorisMetrics::_update_process_huge_page_bytes() {
+    if (!config::enable_huge_page_alloc) {
+        return;
+    }
+    FILE* fp = fopen("/proc/self/smaps_rollup", "r");
+    if (fp == nullptr) {
+        return;
+    }
+
+    // AnonHugePages:     20480 kB
+    int64_t value = 0;
+    size_t line_buf_size = 0;
+    char* line_ptr = nullptr;
+    while (getline(&line_ptr, &line_buf_size, fp) > 0) {
+        if (sscanf(line_ptr, "AnonHugePages: %" PRId64, &value) == 1) {
+            process_anon_huge_page_bytes->set_value(value * 1024);
+            break;
+        }
+    }
+
+    if (line_ptr != nullptr) {
+        free(line_ptr);
+    }
+    fclose(fp);
+}
+
 } // namespace doris
@@ -115,17 +115,35 @@ public:
     IntCounter* stream_load_txn_rollback_request_total;
     IntCounter* stream_receive_bytes_total;
     IntCounter* stream_load_rows_total;
+    IntCounter* routine_load_consume_rows_total;
+    IntCounter* routine_load_consume_bytes_total;
+    // the rows parsed by the scanners of the routine loads
+    IntCounter* routine_load_decode_rows_total;
     IntCounter* load_rows;
     IntCounter* load_bytes;
 
     IntCounter* memtable_flush_total;
     IntCounter* memtable_flush_duration_us;
 
+    IntCounter* delete_bitmap_calc_segment_total;
+    IntCounter* delete_bitmap_calc_segment_skipped_total;
+    IntCounter* delete_bitmap_calc_duration_us;
+
+    // memtables flushed to reduce load memory
+    IntCounter* load_mem_proactive_flush_total;
+    IntCounter* load_mem_soft_limit_flush_total;
+    IntCounter* load_mem_hard_limit_flush_total;
+    IntCounter* load_mem_flush_picked_bytes;
+
     IntGauge* memory_pool_bytes_total;
     IntGauge* process_thread_num;
     IntGauge* process_fd_num_used;
     IntGauge* process_fd_num_limit_soft;
     IntGauge* process_fd_num_limit_hard;
+    // bytes allocated by Allocator and advised to be backed by huge pages
+    IntGauge* huge_page_alloc_bytes;
+    // bytes of the process actually backed by transparent huge pages
+    IntGauge* process_anon_huge_page_bytes;
 
     // the max compaction score of all tablets.
     // Record base and cumulative scores separately, because
@@ -142,6 +160,8 @@ public:
     IntGauge* compaction_waitting_permits;
 
     HistogramMetric* tablet_version_num_distribution;
+    // the time of pipeline tasks waiting in the runnable queue to be executed
+    HistogramMetric* pipeline_task_schedule_latency_us;
 
     // The following metrics will be calculated
     // by metric calculator
@@ -179,6 +199,7 @@ public:
     UIntGauge* result_buffer_block_count;
     UIntGauge* result_block_queue_count;
     UIntGauge* routine_load_task_count;
+    UIntGauge* routine_load_consume_lag;
     UIntGauge* small_file_cache_count;
     UIntGauge* stream_load_pipe_count;
     UIntGauge* new_stream_load_pipe_count;
@@ -249,6 +270,7 @@ private:
     void _update();
     void _update_process_thread_num();
     void _update_process_fd_num();
+    void _update_process_huge_page_bytes();
 
 private:
     static const std::string _s_registry_name;
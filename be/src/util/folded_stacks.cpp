@@ -0,0 +1,70 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "util/folded_stacks.h"
+
+#include <fmt/format.h>
+#include <string.h>
+
+#include <algorithm>
+
+#include "util/bfd_parser.h"
+
+namespace doris {
+
+void FoldedStacksBuilder::add(const void* frames, size_t depth, uint64_t weight) {
+    const char* data = static_cast<const char*>(frames);
+    for (size_t i = depth; i > 0; --i) {
+        void* frame = nullptr;
+        memcpy(&frame, data + (i - 1) * sizeof(void*), sizeof(void*));
+        _result.append(_symbolize(frame));
+        _result.push_back(i > 1 ? ';' : ' ');
+    }
+    if (depth == 0) {
+        _result.append("[unknown] ");
+    }
+    _result.append(std::to_string(weight));
+    _result.push_back('\n');
+}
+
+void FoldedStacksBuilder::add_line(const std::string& name, uint64_t weight) {
+    _result.append(fmt::format("{} {}\n", name, weight));
+}
+
+const std::string& FoldedStacksBuilder::_symbolize(void* frame) {
+    auto it = _symbols.find(frame);
+    if (it != _symbols.end()) {
+        return it->second;
+    }
+    std::string address = fmt::format("{}", frame);
+    std::string symbol = address;
+    std::string file_name;
+    std::string function_name;
+    unsigned int lineno = 0;
+    const char* end = nullptr;
+    if (_bfd_parser != nullptr &&
+        _bfd_parser->decode_address(address.c_str(), &end, &file_name, &function_name,
+                                    &lineno) == 0 &&
+        !function_name.empty()) {
+        symbol = function_name;
+    }
+    // ';' separates the frames in the folded stacks
+    std::replace(symbol.begin(), symbol.end(), ';', ':');
+    return _symbols.emplace(frame, std::move(symbol)).first->second;
+}
+
+} // namespace doris
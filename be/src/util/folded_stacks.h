@@ -0,0 +1,54 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <string>
+#include <unordered_map>
+
+namespace doris {
+
+class BfdParser;
+
+// Builds folded stacks, one "f1;f2;f3 weight" per line with the outermost frame first, which
+// flamegraph.pl and speedscope read. The frames are named by their function if the BfdParser
+// knows it, else by their address, and each distinct frame is decoded once.
+class FoldedStacksBuilder {
+public:
+    explicit FoldedStacksBuilder(BfdParser* bfd_parser) : _bfd_parser(bfd_parser) {}
+
+    // `frames` points to `depth` frames with the innermost first, as GetStackTrace returns
+    // them, and needs not be aligned.
+    void add(const void* frames, size_t depth, uint64_t weight);
+
+    // A line without stack, e.g. "[truncated] 12".
+    void add_line(const std::string& name, uint64_t weight);
+
+    std::string& result() { return _result; }
+
+private:
+    const std::string& _symbolize(void* frame);
+
+    BfdParser* _bfd_parser;
+    std::unordered_map<void*, std::string> _symbols;
+    std::string _result;
+};
+
+} // namespace doris
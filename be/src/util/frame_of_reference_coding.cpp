@@ -268,7 +268,6 @@ bool ForDecoder<T>::init() {
     return true;
 }
 
-// todo(kks): improve this method by SIMD instructions
 // The reverse of bit_pack method, get original integer data list from packed bits
 // param[in] input: the packed bits need to unpack
 // param[in] in_num: the integer number in packed bits
@@ -276,6 +275,23 @@ bool ForDecoder<T>::init() {
 // param[out] output: the original integer data list
 template <typename T>
 void ForDecoder<T>::bit_unpack(const uint8_t* input, uint8_t in_num, int bit_width, T* output) {
+    if (bit_width <= 56) {
+        // The bits are packed from the highest bit of each byte, shift whole bytes into a 64 bits
+        // window and take bit_width bits at a time, instead of one bit at a time.
+        const uint64_t mask = (1ULL << bit_width) - 1;
+        uint64_t window = 0;
+        int window_bits = 0;
+        for (uint8_t i = 0; i < in_num; i++) {
+            while (window_bits < bit_width) {
+                window = (window << 8) | *input++;
+                window_bits += 8;
+            }
+            window_bits -= bit_width;
+            output[i] = static_cast<T>((window >> window_bits) & mask);
+        }
+        return;
+    }
+
     unsigned char in_mask = 0x80;
     int bit_index = 0;
     while (in_num > 0) {
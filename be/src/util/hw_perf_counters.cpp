@@ -0,0 +1,138 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "util/hw_perf_counters.h"
+
+#include <errno.h>
+#include <glog/logging.h>
+#ifndef __APPLE__
+#include <linux/perf_event.h>
+#include <sys/syscall.h>
+#endif
+#include <string.h>
+#include <unistd.h>
+
+#include <functional>
+#include <memory>
+
+#include "util/binary_cast.hpp"
+
+namespace doris {
+
+#ifndef __APPLE__
+static int sys_perf_event_open(struct perf_event_attr* attr, pid_t pid, int cpu, int group_fd,
+                               unsigned long flags) {
+    attr->size = sizeof(*attr);
+    return syscall(__NR_perf_event_open, attr, pid, cpu, group_fd, flags);
+}
+#endif
+
+HwPerfCounterGroup* HwPerfCounterGroup::thread_local_group() {
+    static thread_local bool opened = false;
+    static thread_local std::unique_ptr<HwPerfCounterGroup> group;
+    if (!opened) {
+        opened = true;
+        group.reset(new HwPerfCounterGroup());
+        if (!group->open()) {
+            group.reset();
+        }
+    }
+    return group.get();
+}
+
+HwPerfCounterGroup::~HwPerfCounterGroup() {
+    for (int fd : _fds) {
+        if (fd >= 0) {
+            close(fd);
+        }
+    }
+}
+
+bool HwPerfCounterGroup::open() {
+#ifdef __APPLE__
+    return false;
+#else
+    // PERF_COUNT_HW_CACHE_MISSES counts the misses of the last level cache on most CPUs
+    static constexpr uint64_t configs[NUM_EVENTS] = {
+            PERF_COUNT_HW_CPU_CYCLES, PERF_COUNT_HW_INSTRUCTIONS, PERF_COUNT_HW_CACHE_MISSES,
+            PERF_COUNT_HW_BRANCH_MISSES};
+    for (int i = 0; i < NUM_EVENTS; ++i) {
+        perf_event_attr attr;
+        memset(&attr, 0, sizeof(attr));
+        attr.type = PERF_TYPE_HARDWARE;
+        attr.config = configs[i];
+        attr.read_format = PERF_FORMAT_GROUP;
+        // user space only, which is allowed with kernel.perf_event_paranoid = 2
+        attr.exclude_kernel = 1;
+        attr.exclude_hv = 1;
+        // counts the calling thread on any cpu, the first event leads the group
+        _fds[i] = sys_perf_event_open(&attr, 0, -1, i == 0 ? -1 : _fds[0], 0);
+        if (_fds[i] < 0) {
+            LOG_FIRST_N(INFO, 1) << "hardware perf counters are not available: "
+                                 << strerror(errno);
+            return false;
+        }
+    }
+    return true;
+#endif
+}
+
+bool HwPerfCounterGroup::read(Values* values) const {
+    // layout of PERF_FORMAT_GROUP: the number of events followed by their values
+    uint64_t buf[1 + NUM_EVENTS];
+    if (::read(_fds[0], buf, sizeof(buf)) != sizeof(buf) || buf[0] != NUM_EVENTS) {
+        return false;
+    }
+    for (int i = 0; i < NUM_EVENTS; ++i) {
+        values->values[i] = buf[1 + i];
+    }
+    return true;
+}
+
+void HwPerfProfileCounters::init(RuntimeProfile* profile) {
+    if (HwPerfCounterGroup::thread_local_group() == nullptr) {
+        return;
+    }
+    _cycles = ADD_COUNTER(profile, "HwCycles", TUnit::UNIT);
+    _instructions = ADD_COUNTER(profile, "HwInstructions", TUnit::UNIT);
+    _llc_misses = ADD_COUNTER(profile, "HwLLCMisses", TUnit::UNIT);
+    _branch_misses = ADD_COUNTER(profile, "HwBranchMisses", TUnit::UNIT);
+    profile->add_derived_counter("HwIPC", TUnit::DOUBLE_VALUE,
+                                 std::bind<int64_t>(&instructions_per_cycle, _instructions,
+                                                    _cycles),
+                                 "");
+}
+
+void HwPerfProfileCounters::update(const HwPerfCounterGroup::Values& start,
+                                   const HwPerfCounterGroup::Values& end) {
+    using Group = HwPerfCounterGroup;
+    COUNTER_UPDATE(_cycles, end.values[Group::CYCLES] - start.values[Group::CYCLES]);
+    COUNTER_UPDATE(_instructions,
+                   end.values[Group::INSTRUCTIONS] - start.values[Group::INSTRUCTIONS]);
+    COUNTER_UPDATE(_llc_misses, end.values[Group::LLC_MISSES] - start.values[Group::LLC_MISSES]);
+    COUNTER_UPDATE(_branch_misses,
+                   end.values[Group::BRANCH_MISSES] - start.values[Group::BRANCH_MISSES]);
+}
+
+int64_t HwPerfProfileCounters::instructions_per_cycle(const RuntimeProfile::Counter* instructions,
+                                                      const RuntimeProfile::Counter* cycles) {
+    double ipc = cycles->value() == 0 ? 0 : static_cast<double>(instructions->value()) /
+                                                    static_cast<double>(cycles->value());
+    return binary_cast<double, int64_t>(ipc);
+}
+
+} // namespace doris
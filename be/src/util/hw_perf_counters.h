@@ -0,0 +1,102 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <stdint.h>
+
+#include "util/runtime_profile.h"
+
+namespace doris {
+
+// A group of hardware counters of the calling thread, opened with perf_event_open and read
+// with one syscall, so the counters cover the same instructions.
+class HwPerfCounterGroup {
+public:
+    enum Event { CYCLES = 0, INSTRUCTIONS, LLC_MISSES, BRANCH_MISSES, NUM_EVENTS };
+
+    struct Values {
+        int64_t values[NUM_EVENTS] = {};
+    };
+
+    // The group of the calling thread, opened at the first call. Returns nullptr if the
+    // counters are not available, e.g. in a container without perf_event access or when
+    // kernel.perf_event_paranoid is too strict.
+    static HwPerfCounterGroup* thread_local_group();
+
+    ~HwPerfCounterGroup();
+
+    bool read(Values* values) const;
+
+private:
+    HwPerfCounterGroup() = default;
+    bool open();
+
+    int _fds[NUM_EVENTS] = {-1, -1, -1, -1};
+};
+
+// The hardware counters of an operator in its profile. The counters are read at the
+// boundaries of the operator, so they include the work of the children in the non-pipeline
+// engine, where the operators pull from their children in get_next.
+class HwPerfProfileCounters {
+public:
+    // Does nothing if the counters are not available on this backend.
+    void init(RuntimeProfile* profile);
+
+    bool enabled() const { return _cycles != nullptr; }
+
+    void update(const HwPerfCounterGroup::Values& start, const HwPerfCounterGroup::Values& end);
+
+private:
+    static int64_t instructions_per_cycle(const RuntimeProfile::Counter* instructions,
+                                          const RuntimeProfile::Counter* cycles);
+
+    RuntimeProfile::Counter* _cycles = nullptr;
+    RuntimeProfile::Counter* _instructions = nullptr;
+    RuntimeProfile::Counter* _llc_misses = nullptr;
+    RuntimeProfile::Counter* _branch_misses = nullptr;
+};
+
+// Adds the hardware counters of the current thread during its scope to `counters`.
+class ScopedHwPerfCounters {
+public:
+    ScopedHwPerfCounters(HwPerfProfileCounters* counters) {
+        if (counters != nullptr && counters->enabled()) {
+            _group = HwPerfCounterGroup::thread_local_group();
+            if (_group != nullptr && _group->read(&_start)) {
+                _counters = counters;
+            }
+        }
+    }
+
+    ~ScopedHwPerfCounters() {
+        HwPerfCounterGroup::Values end;
+        if (_counters != nullptr && _group->read(&end)) {
+            _counters->update(_start, end);
+        }
+    }
+
+private:
+    HwPerfProfileCounters* _counters = nullptr;
+    HwPerfCounterGroup* _group = nullptr;
+    HwPerfCounterGroup::Values _start;
+};
+
+#define SCOPED_HW_PERF_COUNTERS(counters) \
+    ScopedHwPerfCounters MACRO_CONCAT(SCOPED_HW_PERF_COUNTERS, __COUNTER__)(counters)
+
+} // namespace doris
@@ -75,6 +75,7 @@
 #include <limits>
 #include <string>
 #include <type_traits>
+#include <vector>
 
 // IWYU pragma: no_include <opentelemetry/common/threadlocal.h>
 #include "common/compiler_util.h" // IWYU pragma: keep
@@ -388,6 +389,41 @@ typedef int (*hDictFind)(const char* key, unsigned len);
 
 typedef std::underlying_type<JsonbType>::type JsonbTypeUnder;
 
+/*
+ * JsonbParsedPath is a JSON path parsed once by the parser of JsonbValue::findPath, e.g. the
+ * constant path of jsonb_extract, so each value only walks the parsed legs. find() returns
+ * the same value as findPath for the same path.
+ */
+class JsonbParsedPath {
+public:
+    // Return false if the path can not be parsed ahead, e.g. an array index findPath fails
+    // to convert, then findPath should be used for each value instead.
+    bool parse(const char* key_path, unsigned int kp_len);
+
+    JsonbValue* find(JsonbValue* root, hDictFind handler = nullptr) const;
+
+private:
+    enum class LegType {
+        MEMBER,
+        MEMBER_WILDCARD,
+        ARRAY_INDEX,
+        // [last] or [last-N], index is N
+        ARRAY_LAST,
+        ARRAY_WILDCARD,
+        // the path is invalid from this leg on, nothing is found
+        NOT_FOUND
+    };
+
+    struct Leg {
+        LegType type;
+        std::string key;
+        int index = 0;
+    };
+
+    bool is_null_ = true;
+    std::vector<Leg> legs_;
+};
+
 /*
  * JsonbKeyValue class defines JSONB key type, as described below.
  *
@@ -1259,6 +1295,116 @@ inline JsonbValue* JsonbValue::findPath(const char* key_path, unsigned int kp_le
     return pval;
 }
 
+inline bool JsonbParsedPath::parse(const char* key_path, unsigned int kp_len) {
+    is_null_ = key_path == nullptr;
+    legs_.clear();
+    if (is_null_ || kp_len == 0) {
+        return true;
+    }
+    // the parser removes the escapes in place
+    std::string path(key_path, kp_len);
+    Stream stream(path.data(), path.size());
+    stream.skip_whitespace();
+    if (stream.exhausted() || stream.read() != SCOPE) {
+        legs_.push_back({LegType::NOT_FOUND});
+        return true;
+    }
+
+    while (!stream.exhausted()) {
+        stream.skip_whitespace();
+        stream.clear_legPtr();
+        stream.clear_legLen();
+        if (stream.exhausted()) {
+            break;
+        }
+
+        bool is_array = stream.peek() == BEGIN_ARRAY;
+        if ((!is_array && stream.peek() != BEGIN_MEMBER) ||
+            !(is_array ? JsonbPath::parse_array(&stream) : JsonbPath::parse_member(&stream)) ||
+            stream.get_legLen() == 0) {
+            legs_.push_back({LegType::NOT_FOUND});
+            return true;
+        }
+
+        if (!is_array) {
+            if (stream.get_legLen() == 1 && *stream.get_legPtr() == WILDCARD) {
+                legs_.push_back({LegType::MEMBER_WILDCARD});
+                return true;
+            } else if (stream.get_hasEscapes()) {
+                stream.remove_escapes();
+            }
+            legs_.push_back(
+                    {LegType::MEMBER, std::string(stream.get_legPtr(), stream.get_legLen())});
+            continue;
+        }
+
+        std::string idx_string(stream.get_legPtr(), stream.get_legLen());
+        try {
+            if (stream.get_legLen() == 1 && *stream.get_legPtr() == WILDCARD) {
+                legs_.push_back({LegType::ARRAY_WILDCARD});
+                return true;
+            } else if (idx_string.size() >= 4 && idx_string.compare(0, 4, LAST) == 0) {
+                auto pos = idx_string.find(MINUS);
+                if (pos != std::string::npos) {
+                    legs_.push_back(
+                            {LegType::ARRAY_LAST, "", std::stoi(idx_string.substr(pos + 1))});
+                } else if (stream.get_legLen() == 4) {
+                    legs_.push_back({LegType::ARRAY_LAST});
+                } else {
+                    legs_.push_back({LegType::NOT_FOUND});
+                    return true;
+                }
+            } else {
+                std::string::size_type pos;
+                int index = std::stoi(idx_string, &pos, 10);
+                if (pos != idx_string.size()) {
+                    legs_.push_back({LegType::NOT_FOUND});
+                    return true;
+                }
+                legs_.push_back({LegType::ARRAY_INDEX, "", index});
+            }
+        } catch (...) {
+            return false;
+        }
+    }
+    return true;
+}
+
+inline JsonbValue* JsonbParsedPath::find(JsonbValue* root, hDictFind handler) const {
+    if (is_null_) return nullptr;
+    JsonbValue* pval = root;
+    for (const auto& leg : legs_) {
+        if (!pval) return nullptr;
+        switch (leg.type) {
+        case LegType::MEMBER:
+            if (pval->type() != JsonbType::T_Object) return nullptr;
+            pval = ((ObjectVal*)pval)->find(leg.key.data(), leg.key.size(), handler);
+            break;
+        case LegType::MEMBER_WILDCARD:
+            return pval->type() == JsonbType::T_Object ? pval : nullptr;
+        case LegType::ARRAY_WILDCARD:
+            return pval->type() == JsonbType::T_Array ? pval : nullptr;
+        case LegType::ARRAY_INDEX:
+            if (pval->type() != JsonbType::T_Array ||
+                static_cast<unsigned int>(leg.index) >= ((ArrayVal*)pval)->numElem()) {
+                return nullptr;
+            }
+            pval = ((ArrayVal*)pval)->get(leg.index);
+            break;
+        case LegType::ARRAY_LAST: {
+            if (pval->type() != JsonbType::T_Array) return nullptr;
+            size_t num = ((ArrayVal*)pval)->numElem();
+            if (static_cast<size_t>(leg.index) > num) return nullptr;
+            pval = ((ArrayVal*)pval)->get(static_cast<int>(num) - 1 - leg.index);
+            break;
+        }
+        case LegType::NOT_FOUND:
+            return nullptr;
+        }
+    }
+    return pval;
+}
+
 inline bool JsonbPath::parsePath(Stream* stream, JsonbValue* value) {
     if (stream->peek() == BEGIN_ARRAY && value->type() == JsonbType::T_Array) {
         return parse_array(stream);
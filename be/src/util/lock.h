@@ -32,10 +32,13 @@ class BthreadSharedMutex;
 #if !defined(USE_BTHREAD_SCANNER)
 using Mutex = std::mutex;
 using ConditionVariable = std::condition_variable;
+// waits with any lockable, e.g. a ProfiledMutex
+using ConditionVariableAny = std::condition_variable_any;
 using SharedMutex = std::shared_mutex;
 #else
 using Mutex = bthread::Mutex;
 using ConditionVariable = bthread::ConditionVariable;
+using ConditionVariableAny = bthread::ConditionVariable;
 using SharedMutex = BthreadSharedMutex;
 #endif
 
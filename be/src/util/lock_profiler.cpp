@@ -0,0 +1,99 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "util/lock_profiler.h"
+
+#include <utility>
+
+#include "util/doris_metrics.h"
+#include "util/easy_json.h"
+
+namespace doris {
+
+DEFINE_COUNTER_METRIC_PROTOTYPE_2ARG(lock_contentions, MetricUnit::OPERATIONS);
+DEFINE_COUNTER_METRIC_PROTOTYPE_2ARG(lock_wait_ns, MetricUnit::NANOSECONDS);
+DEFINE_COUNTER_METRIC_PROTOTYPE_2ARG(lock_sampled_acquisitions, MetricUnit::OPERATIONS);
+DEFINE_COUNTER_METRIC_PROTOTYPE_2ARG(lock_sampled_hold_ns, MetricUnit::NANOSECONDS);
+
+LockSite::LockSite(std::string name) : _name(std::move(name)) {
+    _entity = DorisMetrics::instance()->metric_registry()->register_entity(
+            "lock_site." + _name, {{"lock_site", _name}});
+    INT_COUNTER_METRIC_REGISTER(_entity, lock_contentions);
+    INT_COUNTER_METRIC_REGISTER(_entity, lock_wait_ns);
+    INT_COUNTER_METRIC_REGISTER(_entity, lock_sampled_acquisitions);
+    INT_COUNTER_METRIC_REGISTER(_entity, lock_sampled_hold_ns);
+}
+
+LockSite::~LockSite() {
+    DorisMetrics::instance()->metric_registry()->deregister_entity(_entity);
+}
+
+static void histogram_to_json(const std::atomic<int64_t>* buckets, int num_buckets,
+                              EasyJson* json) {
+    json->SetArray();
+    for (int i = 0; i < num_buckets; ++i) {
+        int64_t count = buckets[i].load(std::memory_order_relaxed);
+        if (count == 0) {
+            continue;
+        }
+        EasyJson bucket = json->PushBack(EasyJson::kObject);
+        bucket["ge_ns"] = int64_t(1) << i;
+        bucket["count"] = count;
+    }
+}
+
+void LockSite::to_json(EasyJson* json) const {
+    (*json)["name"] = _name;
+    (*json)["contentions"] = lock_contentions->value();
+    (*json)["wait_ns"] = lock_wait_ns->value();
+    (*json)["sampled_acquisitions"] = lock_sampled_acquisitions->value();
+    (*json)["sampled_hold_ns"] = lock_sampled_hold_ns->value();
+    EasyJson wait_histogram = (*json)["wait_histogram"];
+    histogram_to_json(_wait_buckets, NUM_BUCKETS, &wait_histogram);
+    EasyJson hold_histogram = (*json)["hold_histogram"];
+    histogram_to_json(_hold_buckets, NUM_BUCKETS, &hold_histogram);
+}
+
+LockProfiler* LockProfiler::instance() {
+    // never destroyed, the mutexes of the static objects may be unlocked at exit
+    static LockProfiler* profiler = new LockProfiler();
+    return profiler;
+}
+
+LockSite* LockProfiler::get_site(const std::string& name) {
+    std::lock_guard l(_lock);
+    auto& site = _sites[name];
+    if (site == nullptr) {
+        site = std::make_unique<LockSite>(name);
+    }
+    return site.get();
+}
+
+std::string LockProfiler::to_json() const {
+    EasyJson json;
+    json["enabled"] = config::enable_lock_profiling;
+    json["sample_every"] = config::lock_profiling_sample_every;
+    EasyJson sites = json.Set("sites", EasyJson::kArray);
+    std::lock_guard l(_lock);
+    for (const auto& [name, site] : _sites) {
+        EasyJson site_json = sites.PushBack(EasyJson::kObject);
+        site->to_json(&site_json);
+    }
+    return json.ToString();
+}
+
+} // namespace doris
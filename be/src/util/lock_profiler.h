@@ -0,0 +1,186 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <stdint.h>
+
+#include <atomic>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+
+#include "common/config.h"
+#include "util/metrics.h"
+#include "util/time.h"
+
+namespace doris {
+
+class EasyJson;
+
+// The contention of the mutexes of a lock site, e.g. of all the shard locks of TabletManager.
+// The wait time is recorded for every contended acquisition, the hold time for a sample of
+// the acquisitions, one of config::lock_profiling_sample_every.
+class LockSite {
+public:
+    // bucket i counts the durations in [2^i, 2^(i+1)) ns, the last one the longer ones
+    static constexpr int NUM_BUCKETS = 32;
+
+    explicit LockSite(std::string name);
+    ~LockSite();
+
+    const std::string& name() const { return _name; }
+
+    void record_wait(int64_t wait_ns) {
+        lock_contentions->increment(1);
+        lock_wait_ns->increment(wait_ns);
+        _wait_buckets[_bucket(wait_ns)].fetch_add(1, std::memory_order_relaxed);
+    }
+
+    void record_hold(int64_t hold_ns) {
+        lock_sampled_acquisitions->increment(1);
+        lock_sampled_hold_ns->increment(hold_ns);
+        _hold_buckets[_bucket(hold_ns)].fetch_add(1, std::memory_order_relaxed);
+    }
+
+    // Adds the counters and the non-empty buckets of the histograms to `json`.
+    void to_json(EasyJson* json) const;
+
+private:
+    static int _bucket(int64_t ns) {
+        if (ns <= 1) {
+            return 0;
+        }
+        int bucket = 63 - __builtin_clzll(static_cast<uint64_t>(ns));
+        return bucket < NUM_BUCKETS ? bucket : NUM_BUCKETS - 1;
+    }
+
+    const std::string _name;
+    std::atomic<int64_t> _wait_buckets[NUM_BUCKETS] = {};
+    std::atomic<int64_t> _hold_buckets[NUM_BUCKETS] = {};
+
+    std::shared_ptr<MetricEntity> _entity;
+    IntCounter* lock_contentions = nullptr;
+    IntCounter* lock_wait_ns = nullptr;
+    IntCounter* lock_sampled_acquisitions = nullptr;
+    IntCounter* lock_sampled_hold_ns = nullptr;
+};
+
+// The registry of the lock sites, served by /api/lock_profile.
+class LockProfiler {
+public:
+    static LockProfiler* instance();
+
+    // The site of `name`, created at the first call and kept until the process exits.
+    LockSite* get_site(const std::string& name);
+
+    // The profile of all the sites as a JSON object.
+    std::string to_json() const;
+
+private:
+    mutable std::mutex _lock;
+    std::map<std::string, std::unique_ptr<LockSite>> _sites;
+};
+
+// A mutex profiled by its lock site when config::enable_lock_profiling is set. It wraps
+// std::mutex, std::shared_mutex or doris::Mutex and can be used by std::lock_guard,
+// std::unique_lock, std::shared_lock and std::condition_variable_any.
+// Only the exclusive locks record the hold time, a shared lock records its wait.
+template <typename MutexType>
+class ProfiledMutex {
+public:
+    // A mutex without site, e.g. an element of an array of shard locks, is not profiled
+    // until set_site.
+    explicit ProfiledMutex(const char* site = nullptr) {
+        if (site != nullptr) {
+            set_site(site);
+        }
+    }
+
+    void set_site(const char* site) { _site = LockProfiler::instance()->get_site(site); }
+
+    void lock() {
+        if (!config::enable_lock_profiling || _site == nullptr) {
+            _mutex.lock();
+            return;
+        }
+        if (!_mutex.try_lock()) {
+            int64_t start_ns = MonotonicNanos();
+            _mutex.lock();
+            _site->record_wait(MonotonicNanos() - start_ns);
+        }
+        _start_hold();
+    }
+
+    bool try_lock() {
+        if (!_mutex.try_lock()) {
+            return false;
+        }
+        if (config::enable_lock_profiling && _site != nullptr) {
+            _start_hold();
+        }
+        return true;
+    }
+
+    void unlock() {
+        // only read by the owner of the lock
+        int64_t hold_start_ns = _hold_start_ns;
+        if (hold_start_ns != 0) {
+            _hold_start_ns = 0;
+            int64_t hold_ns = MonotonicNanos() - hold_start_ns;
+            // the mutex may be destroyed by the next owner
+            LockSite* site = _site;
+            _mutex.unlock();
+            site->record_hold(hold_ns);
+            return;
+        }
+        _mutex.unlock();
+    }
+
+    void lock_shared() {
+        if (!config::enable_lock_profiling || _site == nullptr) {
+            _mutex.lock_shared();
+            return;
+        }
+        if (!_mutex.try_lock_shared()) {
+            int64_t start_ns = MonotonicNanos();
+            _mutex.lock_shared();
+            _site->record_wait(MonotonicNanos() - start_ns);
+        }
+    }
+
+    bool try_lock_shared() { return _mutex.try_lock_shared(); }
+
+    void unlock_shared() { _mutex.unlock_shared(); }
+
+private:
+    void _start_hold() {
+        static thread_local uint32_t s_acquisitions = 0;
+        int32_t sample_every = config::lock_profiling_sample_every;
+        if (sample_every <= 1 || ++s_acquisitions % sample_every == 0) {
+            _hold_start_ns = MonotonicNanos();
+        }
+    }
+
+    MutexType _mutex;
+    LockSite* _site = nullptr;
+    // set when the hold time of the current owner is sampled
+    int64_t _hold_start_ns = 0;
+};
+
+} // namespace doris
@@ -26,7 +26,6 @@
 
 #include <fmt/format.h>
 #include <gen_cpp/Metrics_types.h>
-#include <gen_cpp/segment_v2.pb.h>
 #include <jemalloc/jemalloc.h>
 
 #include <algorithm>
@@ -38,11 +37,9 @@
 #include "common/config.h"
 #include "common/status.h"
 #include "gutil/strings/split.h"
-#include "olap/page_cache.h"
-#include "olap/rowset/segment_v2/inverted_index_cache.h"
 #include "olap/segment_loader.h"
-#include "runtime/memory/chunk_allocator.h"
 #include "runtime/memory/mem_tracker_limiter.h"
+#include "runtime/memory/memory_governor.h"
 #include "runtime/task_group/task_group.h"
 #include "runtime/task_group/task_group_manager.h"
 #include "util/cgroup_util.h"
@@ -101,38 +98,13 @@ void MemInfo::refresh_allocator_mem() {
 #endif
 }
 
-void MemInfo::process_cache_gc(int64_t& freed_mem) {
-    // TODO, free more cache, and should free a certain percentage of capacity, not all.
-    int32_t min_free_size = 33554432; // 32M
-    if (ChunkAllocator::instance()->mem_consumption() > min_free_size) {
-        freed_mem += ChunkAllocator::instance()->mem_consumption();
-        ChunkAllocator::instance()->clear();
-    }
-
-    if (StoragePageCache::instance()->get_page_cache_mem_consumption(segment_v2::DATA_PAGE) >
-        min_free_size) {
-        freed_mem +=
-                StoragePageCache::instance()->get_page_cache_mem_consumption(segment_v2::DATA_PAGE);
-        StoragePageCache::instance()->prune(segment_v2::DATA_PAGE);
-    }
-
-    if (segment_v2::InvertedIndexSearcherCache::instance()->mem_consumption() > min_free_size) {
-        freed_mem += segment_v2::InvertedIndexSearcherCache::instance()->prune();
-    }
-
-    if (segment_v2::InvertedIndexQueryCache::instance()->mem_consumption() > min_free_size) {
-        freed_mem += segment_v2::InvertedIndexQueryCache::instance()->prune();
-    }
-
-    if (StoragePageCache::instance()->get_page_cache_mem_consumption(
-                segment_v2::PRIMARY_KEY_INDEX_PAGE) > min_free_size) {
-        freed_mem += StoragePageCache::instance()->get_page_cache_mem_consumption(
-                segment_v2::PRIMARY_KEY_INDEX_PAGE);
-        StoragePageCache::instance()->prune(segment_v2::PRIMARY_KEY_INDEX_PAGE);
-    }
+void MemInfo::process_cache_gc(int64_t request_free_mem, int64_t& freed_mem) {
+    // Free the caches by their value instead of pruning all of them, the cache that is hit
+    // most often relative to its size and reload cost is freed last, see MemoryGovernor.
+    freed_mem += MemoryGovernor::instance()->free_memory(request_free_mem - freed_mem);
 }
 
-// step1: free all cache
+// step1: free cache
 // step2: free resource groups memory that enable overcommit
 // step3: free global top overcommit query, if enable query memory overcommit
 // TODO Now, the meaning is different from java minor gc + full gc, more like small gc + large gc.
@@ -148,7 +120,7 @@ bool MemInfo::process_minor_gc() {
                                  watch.elapsed_time() / 1000);
     }};
 
-    MemInfo::process_cache_gc(freed_mem);
+    MemInfo::process_cache_gc(_s_process_minor_gc_size, freed_mem);
     if (freed_mem > _s_process_minor_gc_size) {
         return true;
     }
@@ -173,7 +145,7 @@ bool MemInfo::process_minor_gc() {
     return false;
 }
 
-// step1: free all cache
+// step1: free cache
 // step2: free resource groups memory that enable overcommit
 // step3: free global top memory query
 // step4: free top overcommit load, load retries are more expensive, So cancel at the end.
@@ -190,7 +162,7 @@ bool MemInfo::process_full_gc() {
                                  watch.elapsed_time() / 1000);
     }};
 
-    MemInfo::process_cache_gc(freed_mem);
+    MemInfo::process_cache_gc(_s_process_full_gc_size, freed_mem);
     if (freed_mem > _s_process_full_gc_size) {
         return true;
     }
@@ -266,36 +238,38 @@ int64_t MemInfo::tg_soft_memory_limit_gc(int64_t request_free_memory) {
             },
             &task_groups);
 
-    int64_t total_exceeded_memory = 0;
-    std::vector<int64_t> used_memorys;
-    std::vector<int64_t> exceeded_memorys;
+    // The groups return the memory borrowed beyond their soft limit, from the group that
+    // borrowed the most relative to its soft limit, so a runaway query only hurts its own group.
+    struct BorrowedMemory {
+        taskgroup::TaskGroupPtr task_group;
+        int64_t used_memory;
+        int64_t exceeded_memory;
+        double exceeded_ratio;
+    };
+    std::vector<BorrowedMemory> borrowers;
     for (const auto& task_group : task_groups) {
         auto used_memory = task_group->memory_used();
-        auto exceeded = used_memory - task_group->memory_limit();
-        auto exceeded_memory = exceeded > 0 ? exceeded : 0;
-        total_exceeded_memory += exceeded_memory;
-        used_memorys.emplace_back(used_memory);
-        exceeded_memorys.emplace_back(exceeded_memory);
+        auto soft_limit = std::max<int64_t>(1, task_group->memory_soft_limit());
+        if (used_memory > soft_limit) {
+            borrowers.push_back({task_group, used_memory, used_memory - soft_limit,
+                                 static_cast<double>(used_memory - soft_limit) / soft_limit});
+        }
     }
+    std::sort(borrowers.begin(), borrowers.end(), [](const auto& lhs, const auto& rhs) {
+        return lhs.exceeded_ratio > rhs.exceeded_ratio;
+    });
 
     int64_t total_free_memory = 0;
-    bool gc_all_exceeded = request_free_memory >= total_exceeded_memory;
-    for (int i = 0; i < task_groups.size(); ++i) {
-        if (exceeded_memorys[i] == 0) {
-            continue;
+    for (const auto& borrower : borrowers) {
+        if (total_free_memory >= request_free_memory) {
+            break;
         }
-
-        // todo: GC according to resource group priority
-        int64_t tg_need_free_memory =
-                gc_all_exceeded ? exceeded_memorys[i]
-                                : static_cast<double>(exceeded_memorys[i]) / total_exceeded_memory *
-                                          request_free_memory /* exceeded memory as a weight */;
-        auto task_group = task_groups[i];
         taskgroup::TaskGroupInfo tg_info;
-        task_group->task_group_info(&tg_info);
+        borrower.task_group->task_group_info(&tg_info);
         total_free_memory += MemTrackerLimiter::tg_memory_limit_gc(
-                tg_need_free_memory, used_memorys[i], tg_info.id, tg_info.name,
-                tg_info.memory_limit, task_group->mem_tracker_limiter_pool());
+                std::min(borrower.exceeded_memory, request_free_memory - total_free_memory),
+                borrower.used_memory, tg_info.id, tg_info.name, tg_info.memory_limit,
+                borrower.task_group->mem_tracker_limiter_pool());
     }
     return total_free_memory;
 }
@@ -122,7 +122,7 @@ public:
 
     static std::string debug_string();
 
-    static void process_cache_gc(int64_t& freed_mem);
+    static void process_cache_gc(int64_t request_free_mem, int64_t& freed_mem);
     static bool process_minor_gc();
     static bool process_full_gc();
 
@@ -0,0 +1,195 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <atomic>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <utility>
+
+namespace doris {
+
+// Fixed capacity lock-free FIFO ring buffer for multiple producers and multiple consumers,
+// see Dmitry Vyukov's bounded MPMC queue. The capacity is rounded up to a power of two.
+// Every cell has a sequence number telling whether it is ready to be written or read
+// in the current lap, so a push or pop is one CAS on the position in the common case.
+template <typename T>
+class BoundedMpmcQueue {
+public:
+    explicit BoundedMpmcQueue(size_t capacity) {
+        size_t size = 2;
+        while (size < capacity) {
+            size <<= 1;
+        }
+        _mask = size - 1;
+        _cells.reset(new Cell[size]);
+        for (size_t i = 0; i < size; ++i) {
+            _cells[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    BoundedMpmcQueue(const BoundedMpmcQueue&) = delete;
+    BoundedMpmcQueue& operator=(const BoundedMpmcQueue&) = delete;
+
+    // Return false and leave `value' untouched if the queue is full.
+    bool try_push(T&& value) {
+        Cell* cell = nullptr;
+        size_t pos = _enqueue_pos.load(std::memory_order_relaxed);
+        while (true) {
+            cell = &_cells[pos & _mask];
+            size_t seq = cell->sequence.load(std::memory_order_acquire);
+            auto diff = static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos);
+            if (diff == 0) {
+                if (_enqueue_pos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    break;
+                }
+            } else if (diff < 0) {
+                return false;
+            } else {
+                pos = _enqueue_pos.load(std::memory_order_relaxed);
+            }
+        }
+        cell->value = std::move(value);
+        cell->sequence.store(pos + 1, std::memory_order_release);
+        return true;
+    }
+
+    // Return false if the queue is empty.
+    bool try_pop(T* value) {
+        Cell* cell = nullptr;
+        size_t pos = _dequeue_pos.load(std::memory_order_relaxed);
+        while (true) {
+            cell = &_cells[pos & _mask];
+            size_t seq = cell->sequence.load(std::memory_order_acquire);
+            auto diff = static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos + 1);
+            if (diff == 0) {
+                if (_dequeue_pos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    break;
+                }
+            } else if (diff < 0) {
+                return false;
+            } else {
+                pos = _dequeue_pos.load(std::memory_order_relaxed);
+            }
+        }
+        *value = std::move(cell->value);
+        cell->value = T();
+        cell->sequence.store(pos + _mask + 1, std::memory_order_release);
+        return true;
+    }
+
+    // Only a hint when there are concurrent producers or consumers.
+    size_t size_approx() const {
+        size_t enqueue_pos = _enqueue_pos.load(std::memory_order_acquire);
+        size_t dequeue_pos = _dequeue_pos.load(std::memory_order_acquire);
+        return enqueue_pos > dequeue_pos ? enqueue_pos - dequeue_pos : 0;
+    }
+
+    // Return true if the next element to pop is not ready, so a try_pop after empty() returns
+    // false always succeeds if there is only one consumer.
+    bool empty() const {
+        size_t pos = _dequeue_pos.load(std::memory_order_acquire);
+        return _cells[pos & _mask].sequence.load(std::memory_order_acquire) != pos + 1;
+    }
+
+    size_t capacity() const { return _mask + 1; }
+
+private:
+    struct Cell {
+        std::atomic<size_t> sequence;
+        T value;
+    };
+
+    std::unique_ptr<Cell[]> _cells;
+    size_t _mask;
+    // on separate cache lines so that producers and consumers do not share the line
+    alignas(64) std::atomic<size_t> _enqueue_pos = 0;
+    alignas(64) std::atomic<size_t> _dequeue_pos = 0;
+};
+
+// Unbounded FIFO queue for multiple producers and multiple consumers, which is lock-free
+// as long as the elements fit in the ring buffer. When the ring buffer is full, the elements
+// go to an overflow list under a lock until the list is drained, so the elements of one
+// producer are still popped in the order they are pushed.
+template <typename T>
+class MpmcQueue {
+public:
+    explicit MpmcQueue(size_t ring_capacity) : _ring(ring_capacity) {}
+
+    void push(T value) {
+        if (_num_overflow.load(std::memory_order_acquire) == 0 &&
+            _ring.try_push(std::move(value))) {
+            return;
+        }
+        std::lock_guard l(_overflow_lock);
+        _overflow.push_back(std::move(value));
+        _num_overflow.fetch_add(1, std::memory_order_release);
+    }
+
+    // Return false if the queue is empty.
+    bool try_pop(T* value) {
+        // the elements in the ring buffer are pushed before the ones in the overflow list
+        if (_ring.try_pop(value)) {
+            return true;
+        }
+        if (_num_overflow.load(std::memory_order_acquire) == 0) {
+            return false;
+        }
+        // the ring buffer may be filled after the first check, by the elements pushed before
+        // the ones in the overflow list
+        if (_ring.try_pop(value)) {
+            return true;
+        }
+        std::lock_guard l(_overflow_lock);
+        if (_overflow.empty()) {
+            return false;
+        }
+        *value = std::move(_overflow.front());
+        _overflow.pop_front();
+        _num_overflow.fetch_sub(1, std::memory_order_release);
+        return true;
+    }
+
+    // Only a hint when there are concurrent producers or consumers.
+    size_t size_approx() const {
+        return _ring.size_approx() + _num_overflow.load(std::memory_order_acquire);
+    }
+
+    // See BoundedMpmcQueue::empty().
+    bool empty() const {
+        return _ring.empty() && _num_overflow.load(std::memory_order_acquire) == 0;
+    }
+
+    void clear() {
+        T value;
+        while (try_pop(&value)) {
+        }
+    }
+
+private:
+    BoundedMpmcQueue<T> _ring;
+    std::mutex _overflow_lock;
+    std::list<T> _overflow;
+    std::atomic<size_t> _num_overflow = 0;
+};
+
+} // namespace doris
@@ -17,6 +17,10 @@
 
 #include "util/obj_lru_cache.h"
 
+#include <stdint.h>
+
+#include <algorithm>
+
 namespace doris {
 
 ObjLRUCache::ObjLRUCache(int64_t capacity, uint32_t num_shards) {
@@ -27,6 +31,16 @@ ObjLRUCache::ObjLRUCache(int64_t capacity, uint32_t num_shards) {
     }
 }
 
+ObjLRUCache::ObjLRUCache(const std::string& name, int64_t capacity,
+                         int64_t element_count_capacity, uint32_t num_shards) {
+    _enabled = capacity > 0 && element_count_capacity > 0;
+    if (_enabled) {
+        _cache = std::unique_ptr<Cache>(new ShardedLRUCache(
+                name, capacity, LRUCacheType::SIZE, num_shards,
+                static_cast<uint32_t>(std::min<int64_t>(element_count_capacity, UINT32_MAX))));
+    }
+}
+
 bool ObjLRUCache::lookup(const ObjKey& key, CacheHandle* handle) {
     if (!_enabled) {
         return false;
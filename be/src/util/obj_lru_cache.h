@@ -68,6 +68,13 @@ public:
 
     ObjLRUCache(int64_t capacity, uint32_t num_shards = kDefaultNumShards);
 
+    // A cache whose capacity is the memory charged by the cached objects, the number of the
+    // objects is limited by element_count_capacity too. It is disabled if any of them is 0.
+    ObjLRUCache(const std::string& name, int64_t capacity, int64_t element_count_capacity,
+                uint32_t num_shards = kDefaultNumShards);
+
+    bool enabled() const { return _enabled; }
+
     bool lookup(const ObjKey& key, CacheHandle* handle);
 
     template <typename T>
@@ -79,6 +86,20 @@ public:
         insert(key, value, cache_handle, deleter);
     }
 
+    // insert with the memory size of the object as charge
+    template <typename T>
+    void insert(const ObjKey& key, const T* value, size_t charge, CacheHandle* cache_handle) {
+        auto deleter = [](const doris::CacheKey& key, void* value) {
+            T* v = (T*)value;
+            delete v;
+        };
+        if (_enabled) {
+            auto handle = _cache->insert(key.key, (void*)value, charge, deleter,
+                                         CachePriority::NORMAL, charge);
+            *cache_handle = CacheHandle {_cache.get(), handle};
+        }
+    }
+
     template <typename T>
     void insert(const ObjKey& key, const T* value, CacheHandle* cache_handle,
                 void (*deleter)(const CacheKey& key, void* value)) {
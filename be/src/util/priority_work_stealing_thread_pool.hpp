@@ -17,6 +17,9 @@
 
 #pragma once
 
+#include <algorithm>
+#include <atomic>
+#include <memory>
 #include <mutex>
 #include <thread>
 
@@ -28,6 +31,10 @@ namespace doris {
 
 // Work-Stealing threadpool which processes items (of type T) in parallel which were placed on multi
 // blocking queues by Offer(). Each item is processed by a single user-supplied method.
+//
+// The threads of a queue steal the items of the other queues when theirs is empty, except the
+// reserved threads of the queue, which only run its items. So a queue flooded with items can
+// not take all the threads from the others.
 class PriorityWorkStealingThreadPool : public PriorityThreadPool {
 public:
     // Creates a new thread pool and start num_threads threads.
@@ -36,9 +43,15 @@ public:
     //  -- queue_size: the maximum size of the queue on which work items are offered. If the
     //     queue exceeds this size, subsequent calls to Offer will block until there is
     //     capacity available.
+    //  -- num_reserved_threads_per_queue: how many threads of each queue never steal, capped
+    //     by num_threads / num_queues
     PriorityWorkStealingThreadPool(uint32_t num_threads, uint32_t num_queues, uint32_t queue_size,
-                                   const std::string& name)
-            : PriorityThreadPool(0, 0, name) {
+                                   const std::string& name,
+                                   uint32_t num_reserved_threads_per_queue = 0)
+            : PriorityThreadPool(0, 0, name),
+              _num_reserved_threads_per_queue(
+                      std::min(num_reserved_threads_per_queue, num_threads / num_queues)),
+              _queue_stats(new QueueStats[num_queues]) {
         DCHECK_GT(num_queues, 0);
         DCHECK_GE(num_threads, num_queues);
         // init _work_queues first because the work thread needs it
@@ -93,6 +106,18 @@ public:
         return size;
     }
 
+    uint32_t get_num_queues() const { return _work_queues.size(); }
+    uint32_t get_queue_size(uint32_t queue_id) const {
+        return _work_queues[queue_id]->get_size();
+    }
+    // The items of the queue run, and the ones of them run by the threads of the other queues.
+    uint64_t get_finished_tasks(uint32_t queue_id) const {
+        return _queue_stats[queue_id].finished_tasks.load(std::memory_order_relaxed);
+    }
+    uint64_t get_stolen_tasks(uint32_t queue_id) const {
+        return _queue_stats[queue_id].stolen_tasks.load(std::memory_order_relaxed);
+    }
+
     // Blocks until the work queue is empty, and then calls shutdown to stop the worker
     // threads and Join to wait until they are finished.
     // Any work Offer()'ed during DrainAndshutdown may or may not be processed.
@@ -113,16 +138,22 @@ private:
     void work_thread(int thread_id) {
         auto queue_id = thread_id % _work_queues.size();
         auto steal_queue_id = (queue_id + 1) % _work_queues.size();
+        const bool is_reserved =
+                thread_id / _work_queues.size() < _num_reserved_threads_per_queue;
         while (!is_shutdown()) {
             Task task;
             // avoid blocking get
             bool is_other_queues_empty = true;
             // steal work in round-robin if nothing to do
-            while (_work_queues[queue_id]->get_size() == 0 && queue_id != steal_queue_id &&
-                   !is_shutdown()) {
+            while (!is_reserved && _work_queues[queue_id]->get_size() == 0 &&
+                   queue_id != steal_queue_id && !is_shutdown()) {
                 if (_work_queues[steal_queue_id]->non_blocking_get(&task)) {
                     is_other_queues_empty = false;
                     task.work_function();
+                    _queue_stats[steal_queue_id].finished_tasks.fetch_add(
+                            1, std::memory_order_relaxed);
+                    _queue_stats[steal_queue_id].stolen_tasks.fetch_add(
+                            1, std::memory_order_relaxed);
                 }
                 steal_queue_id = (steal_queue_id + 1) % _work_queues.size();
             }
@@ -133,6 +164,7 @@ private:
                 _work_queues[queue_id]->blocking_get(
                         &task, config::doris_blocking_priority_queue_wait_timeout_ms)) {
                 task.work_function();
+                _queue_stats[queue_id].finished_tasks.fetch_add(1, std::memory_order_relaxed);
             }
             if (_work_queues[queue_id]->get_size() == 0) {
                 _empty_cv.notify_all();
@@ -143,6 +175,13 @@ private:
     // Queue on which work items are held until a thread is available to process them in
     // FIFO order.
     std::vector<std::shared_ptr<BlockingPriorityQueue<Task>>> _work_queues;
+
+    const uint32_t _num_reserved_threads_per_queue;
+    struct QueueStats {
+        std::atomic<uint64_t> finished_tasks {0};
+        std::atomic<uint64_t> stolen_tasks {0};
+    };
+    std::unique_ptr<QueueStats[]> _queue_stats;
 };
 
 } // namespace doris
@@ -18,8 +18,14 @@
 #pragma once
 
 #include <brpc/http_method.h>
+#include <butil/iobuf.h>
 #include <gen_cpp/internal_service.pb.h>
 
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
 #include "common/config.h"
 #include "common/status.h"
 #include "network_util.h"
@@ -60,6 +66,76 @@ inline bool enable_http_send_block(
     return true;
 }
 
+// brpc passes only the data pointer to the deleter of the user data appended to IOBuf,
+// so the strings handed to IOBuf without copy are kept here until brpc releases them.
+class IOBufStringKeeper {
+public:
+    static IOBufStringKeeper* instance() {
+        static IOBufStringKeeper keeper;
+        return &keeper;
+    }
+
+    void append(butil::IOBuf* buf, std::string&& data) {
+        auto holder = std::make_unique<std::string>(std::move(data));
+        void* ptr = holder->data();
+        size_t size = holder->size();
+        {
+            std::lock_guard<std::mutex> l(_lock);
+            _strings.emplace(ptr, std::move(holder));
+        }
+        if (buf->append_user_data(ptr, size, &IOBufStringKeeper::_release) != 0) {
+            std::unique_ptr<std::string> failed;
+            {
+                std::lock_guard<std::mutex> l(_lock);
+                auto it = _strings.find(ptr);
+                failed = std::move(it->second);
+                _strings.erase(it);
+            }
+            buf->append(*failed);
+        }
+    }
+
+private:
+    static void _release(void* data) {
+        auto keeper = instance();
+        // freed after the lock is released
+        std::unique_ptr<std::string> released;
+        std::lock_guard<std::mutex> l(keeper->_lock);
+        auto it = keeper->_strings.find(data);
+        DCHECK(it != keeper->_strings.end());
+        if (it != keeper->_strings.end()) {
+            released = std::move(it->second);
+            keeper->_strings.erase(it);
+        }
+    }
+
+    std::mutex _lock;
+    std::unordered_map<void*, std::unique_ptr<std::string>> _strings;
+};
+
+// Copying small blocks is cheaper than tracking them in IOBufStringKeeper.
+constexpr size_t MIN_ZERO_COPY_ATTACHMENT_SIZE = 64 * 1024;
+
+// Move the column values of the block into the controller attachment without copy, if the
+// block is large enough and not shared with other requests, e.g. a broadcast block. The
+// receiver moves them back into the block in attachment_transfer_request_block.
+template <typename Closure>
+void request_block_transfer_attachment_without_copy(PTransmitDataParams* brpc_request,
+                                                     Closure* closure) {
+    brpc_request->set_transfer_by_attachment(false);
+    if (!config::exchange_transfer_block_by_attachment || !brpc_request->has_block() ||
+        brpc_request->block().column_values().size() < MIN_ZERO_COPY_ATTACHMENT_SIZE) {
+        return;
+    }
+    auto block = brpc_request->mutable_block();
+    brpc_request->set_transfer_by_attachment(true);
+    butil::IOBuf attachment;
+    IOBufStringKeeper::instance()->append(&attachment,
+                                          std::move(*block->mutable_column_values()));
+    block->set_column_values("");
+    closure->cntl.request_attachment().swap(attachment);
+}
+
 template <typename Closure>
 void transmit_block(PBackendService_Stub& stub, Closure* closure,
                     const PTransmitDataParams& params) {
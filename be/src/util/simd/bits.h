@@ -55,6 +55,33 @@ inline uint32_t bytes32_mask_to_bits32_mask(const bool* data) {
     return bytes32_mask_to_bits32_mask(reinterpret_cast<const uint8_t*>(data));
 }
 
+/// Transform 64 bytes to a 64-bit mask, whose i-th bit is set if data[i] equals to byte.
+inline uint64_t bytes64_equal_mask(const char* data, char byte) {
+#ifdef __AVX2__
+    const auto target32 = _mm256_set1_epi8(byte);
+    uint64_t mask = static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(
+            _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data)), target32)));
+    mask |= static_cast<uint64_t>(static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(
+                    _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + 32)), target32))))
+            << 32;
+#elif defined(__SSE2__) || defined(__aarch64__)
+    const auto target16 = _mm_set1_epi8(byte);
+    uint64_t mask = 0;
+    for (int i = 0; i < 4; ++i) {
+        mask |= static_cast<uint64_t>(static_cast<uint16_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(
+                        _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i * 16)),
+                        target16))))
+                << (i * 16);
+    }
+#else
+    uint64_t mask = 0;
+    for (std::size_t i = 0; i < 64; ++i) {
+        mask |= static_cast<uint64_t>(byte == *(data + i)) << i;
+    }
+#endif
+    return mask;
+}
+
 inline size_t count_zero_num(const int8_t* __restrict data, size_t size) {
     size_t num = 0;
     const int8_t* end = data + size;
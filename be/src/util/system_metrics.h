@@ -59,6 +59,7 @@ public:
 
     void update_max_disk_io_util_percent(const std::map<std::string, int64_t>& lst_value,
                                          int64_t interval_sec);
+    int64_t get_max_disk_io_util_percent() const { return max_disk_io_util_percent->value(); }
     void update_max_network_send_bytes_rate(int64_t max_send_bytes_rate);
     void update_max_network_receive_bytes_rate(int64_t max_receive_bytes_rate);
     void update_allocator_metrics();
@@ -0,0 +1,63 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+
+#include "util/timezone_transitions.h"
+
+#include <cctz/civil_time.h>
+#include <cctz/time_zone.h>
+
+#include <algorithm>
+#include <chrono>
+
+namespace doris {
+
+bool TimezoneTransitions::init(const cctz::time_zone& ctz) {
+    static const auto epoch = std::chrono::time_point_cast<cctz::sys_seconds>(
+            std::chrono::system_clock::from_time_t(0));
+    _utc_transitions.clear();
+    _local_transitions.clear();
+    _offsets.clear();
+
+    auto tp = epoch + cctz::seconds(MIN_SECONDS);
+    int32_t offset = ctz.lookup(tp).offset;
+    _offsets.push_back(offset);
+    cctz::time_zone::civil_transition trans;
+    while (ctz.next_transition(tp, &trans)) {
+        tp = ctz.lookup(trans.to).trans;
+        int64_t utc_seconds = (tp - epoch).count();
+        if (utc_seconds >= MAX_SECONDS) {
+            break;
+        }
+        int32_t next_offset = ctz.lookup(tp).offset;
+        if (next_offset == offset) {
+            continue;
+        }
+        // a skipped or repeated civil time takes the offset before the transition
+        int64_t local_seconds = utc_seconds + std::max(offset, next_offset);
+        if (!_local_transitions.empty() && local_seconds <= _local_transitions.back()) {
+            return false;
+        }
+        _utc_transitions.push_back(utc_seconds);
+        _local_transitions.push_back(local_seconds);
+        _offsets.push_back(next_offset);
+        offset = next_offset;
+    }
+    return true;
+}
+
+} // namespace doris
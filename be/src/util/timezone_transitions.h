@@ -0,0 +1,93 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+
+#pragma once
+
+#include <stdint.h>
+
+#include <vector>
+
+namespace cctz {
+class time_zone;
+} // namespace cctz
+
+namespace doris {
+
+// The UTC offsets of a time zone precomputed from cctz, so converting a value between UTC
+// and the civil time of the time zone is a binary search over the sorted transitions
+// instead of a cctz lookup for each value. Only the seconds in [MIN_SECONDS, MAX_SECONDS)
+// are tabulated, the others should still be converted by cctz.
+class TimezoneTransitions {
+public:
+    // 1900-01-01 00:00:00 and 2100-01-01 00:00:00 UTC
+    static constexpr int64_t MIN_SECONDS = -2208988800L;
+    static constexpr int64_t MAX_SECONDS = 4102444800L;
+
+    // Return false if the time zone can not be tabulated, e.g. the civil times of two
+    // transitions overlap.
+    bool init(const cctz::time_zone& ctz);
+
+    // The offset of the UTC seconds since epoch, the same as cctz::convert(time_point, ctz).
+    // Return false if the seconds are not tabulated.
+    bool utc_offset(int64_t utc_seconds, int32_t* offset) const {
+        if (utc_seconds < MIN_SECONDS || utc_seconds >= MAX_SECONDS) {
+            return false;
+        }
+        *offset = _offsets[_upper_bound(_utc_transitions, utc_seconds)];
+        return true;
+    }
+
+    // The offset of the civil seconds since the civil epoch, the same as the pre-transition
+    // offset taken by cctz::convert(civil_second, ctz) for a skipped or repeated civil time.
+    // Return false if the seconds are not tabulated.
+    bool local_offset(int64_t local_seconds, int32_t* offset) const {
+        // the civil times around the bounds may be out of range in UTC
+        if (local_seconds < MIN_SECONDS + SECONDS_PER_DAY ||
+            local_seconds >= MAX_SECONDS - SECONDS_PER_DAY) {
+            return false;
+        }
+        *offset = _offsets[_upper_bound(_local_transitions, local_seconds)];
+        return true;
+    }
+
+private:
+    static constexpr int64_t SECONDS_PER_DAY = 86400;
+
+    // the number of transitions not after the seconds
+    static size_t _upper_bound(const std::vector<int64_t>& transitions, int64_t seconds) {
+        size_t lo = 0;
+        size_t hi = transitions.size();
+        while (lo < hi) {
+            size_t mid = (lo + hi) / 2;
+            if (transitions[mid] <= seconds) {
+                lo = mid + 1;
+            } else {
+                hi = mid;
+            }
+        }
+        return lo;
+    }
+
+    // _offsets[i + 1] applies from the UTC seconds _utc_transitions[i], and from the civil
+    // seconds _local_transitions[i], which is the later civil time of the two offsets
+    std::vector<int64_t> _utc_transitions;
+    std::vector<int64_t> _local_transitions;
+    std::vector<int32_t> _offsets;
+};
+
+} // namespace doris
@@ -83,6 +83,24 @@ public:
       */
     virtual void create(AggregateDataPtr __restrict place) const = 0;
 
+    /** Create the states at places[i] + place_offset for i in [0, num_rows) at once.
+      * The states created by this call are destroyed if it throws.
+      */
+    virtual void create_batch(AggregateDataPtr* places, size_t num_rows,
+                              size_t place_offset) const {
+        size_t i = 0;
+        try {
+            for (; i < num_rows; ++i) {
+                create(places[i] + place_offset);
+            }
+        } catch (...) {
+            for (size_t j = 0; j < i; ++j) {
+                destroy(places[j] + place_offset);
+            }
+            throw;
+        }
+    }
+
     /// Delete data for aggregation.
     virtual void destroy(AggregateDataPtr __restrict place) const noexcept = 0;
 
@@ -437,6 +455,21 @@ public:
 
     void create(AggregateDataPtr __restrict place) const override { new (place) Data; }
 
+    void create_batch(AggregateDataPtr* places, size_t num_rows,
+                      size_t place_offset) const override {
+        // the states are constructed in place without the virtual call of create, unless it
+        // is overridden by the function
+        if constexpr (std::is_same_v<decltype(&Derived::create),
+                                     decltype(&IAggregateFunctionDataHelper::create)> &&
+                      std::is_nothrow_default_constructible_v<Data>) {
+            for (size_t i = 0; i < num_rows; ++i) {
+                new (places[i] + place_offset) Data;
+            }
+        } else {
+            IAggregateFunctionHelper<Derived>::create_batch(places, num_rows, place_offset);
+        }
+    }
+
     void destroy(AggregateDataPtr __restrict place) const noexcept override { data(place).~Data(); }
 
     bool has_trivial_destructor() const override { return std::is_trivially_destructible_v<Data>; }
@@ -24,6 +24,7 @@
 #include <boost/iterator/iterator_facade.hpp>
 #include <memory>
 #include <string>
+#include <vector>
 
 #include "olap/hll.h"
 #include "util/hash_util.hpp"
@@ -56,6 +57,10 @@ struct AggregateFunctionApproxCountDistinctData {
         }
     }
 
+    void add_batch(const uint64_t* hash_values, size_t count) {
+        hll_data.update_batch(hash_values, count);
+    }
+
     void merge(const AggregateFunctionApproxCountDistinctData& rhs) {
         hll_data.merge(rhs.hll_data);
     }
@@ -110,6 +115,29 @@ public:
         }
     }
 
+    void add_batch_single_place(size_t batch_size, AggregateDataPtr place, const IColumn** columns,
+                                Arena*) const override {
+        // hash the whole column first, then update the registers in a tight loop
+        std::vector<uint64_t> hash_values;
+        hash_values.reserve(batch_size);
+        for (size_t i = 0; i < batch_size; ++i) {
+            uint64_t hash_value = 0;
+            if constexpr (IsFixLenColumnType<ColumnDataType>::value) {
+                auto value = assert_cast<const ColumnDataType*>(columns[0])->get_element(i);
+                hash_value = HashUtil::murmur_hash64A((char*)&value, sizeof(value),
+                                                      HashUtil::MURMUR_SEED);
+            } else {
+                auto value = assert_cast<const ColumnDataType*>(columns[0])->get_data_at(i);
+                hash_value =
+                        HashUtil::murmur_hash64A(value.data, value.size, HashUtil::MURMUR_SEED);
+            }
+            if (hash_value != 0) {
+                hash_values.push_back(hash_value);
+            }
+        }
+        this->data(place).add_batch(hash_values.data(), hash_values.size());
+    }
+
     void reset(AggregateDataPtr place) const override { this->data(place).reset(); }
 
     void merge(AggregateDataPtr __restrict place, ConstAggregateDataPtr rhs,
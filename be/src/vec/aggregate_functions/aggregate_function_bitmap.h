@@ -66,6 +66,19 @@ struct AggregateFunctionBitmapUnionOp {
     }
 
     static void add_batch(BitmapValue& res, std::vector<const BitmapValue*>& data, bool& is_first) {
+        if (data.empty()) {
+            return;
+        }
+        if (UNLIKELY(is_first)) {
+            is_first = false;
+            if (data.size() == 1) {
+                // share the bitmap until it is modified
+                res = *data[0];
+                return;
+            }
+            // the value may be left by the previous group after reset
+            res = BitmapValue();
+        }
         res.fastunion(data);
     }
 
@@ -181,6 +194,24 @@ public:
         }
     }
 
+    void add_batch_single_place(size_t batch_size, AggregateDataPtr place, const IColumn** columns,
+                                Arena* arena) const override {
+        if constexpr (std::is_same_v<Op, AggregateFunctionBitmapUnionOp>) {
+            // union all bitmaps of the batch at once instead of one by one
+            const auto& column = assert_cast<const ColVecType&>(*columns[0]);
+            std::vector<const BitmapValue*> values;
+            values.reserve(batch_size);
+            for (size_t i = 0; i < batch_size; ++i) {
+                values.push_back(&(column.get_data()[i]));
+            }
+            this->data(place).add_batch(values);
+        } else {
+            for (size_t i = 0; i < batch_size; ++i) {
+                add(place, columns, i, arena);
+            }
+        }
+    }
+
     void merge(AggregateDataPtr __restrict place, ConstAggregateDataPtr rhs,
                Arena*) const override {
         this->data(place).merge(
@@ -261,6 +292,32 @@ public:
         }
     }
 
+    void add_batch_single_place(size_t batch_size, AggregateDataPtr place, const IColumn** columns,
+                                Arena* arena) const override {
+        if constexpr (std::is_same_v<ColVecType, ColumnBitmap>) {
+            // union all bitmaps of the batch at once instead of one by one
+            const IColumn* nested_column = columns[0];
+            const ColumnNullable* nullable_column = nullptr;
+            if constexpr (arg_is_nullable) {
+                nullable_column = assert_cast<const ColumnNullable*>(columns[0]);
+                nested_column = &nullable_column->get_nested_column();
+            }
+            const auto& column = assert_cast<const ColVecType&>(*nested_column);
+            std::vector<const BitmapValue*> values;
+            values.reserve(batch_size);
+            for (size_t i = 0; i < batch_size; ++i) {
+                if (nullable_column == nullptr || !nullable_column->is_null_at(i)) {
+                    values.push_back(&(column.get_data()[i]));
+                }
+            }
+            this->data(place).add_batch(values);
+        } else {
+            for (size_t i = 0; i < batch_size; ++i) {
+                add(place, columns, i, arena);
+            }
+        }
+    }
+
     void merge(AggregateDataPtr __restrict place, ConstAggregateDataPtr rhs,
                Arena*) const override {
         this->data(place).merge(const_cast<AggFunctionData&>(this->data(rhs)).get());
@@ -0,0 +1,117 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "vec/aggregate_functions/aggregate_function_fused.h"
+
+#include "vec/aggregate_functions/aggregate_function_count.h"
+#include "vec/aggregate_functions/aggregate_function_min_max.h"
+#include "vec/aggregate_functions/aggregate_function_sum.h"
+#include "vec/core/types.h"
+
+namespace doris::vectorized {
+
+namespace {
+
+template <typename T>
+using FusedMin = AggregateFunctionsSingleValue<AggregateFunctionMinData<SingleValueDataFixed<T>>>;
+template <typename T>
+using FusedMax = AggregateFunctionsSingleValue<AggregateFunctionMaxData<SingleValueDataFixed<T>>>;
+template <typename T>
+using FusedSum = AggregateFunctionSumSimple<T>;
+using FusedCount = AggregateFunctionCount;
+
+template <typename... Functions, size_t... I>
+std::unique_ptr<IFusedAggregateFunctions> try_create_impl(
+        const std::vector<const IAggregateFunction*>& functions, std::index_sequence<I...>) {
+    std::tuple<const Functions*...> casted {dynamic_cast<const Functions*>(functions[I])...};
+    if (((std::get<I>(casted) == nullptr) || ...)) {
+        return nullptr;
+    }
+    return std::make_unique<FusedAggregateFunctions<Functions...>>(std::get<I>(casted)...);
+}
+
+template <typename... Functions>
+std::unique_ptr<IFusedAggregateFunctions> try_create(
+        const std::vector<const IAggregateFunction*>& functions) {
+    if (functions.size() != sizeof...(Functions)) {
+        return nullptr;
+    }
+    return try_create_impl<Functions...>(functions, std::index_sequence_for<Functions...>());
+}
+
+template <typename TSum>
+std::unique_ptr<IFusedAggregateFunctions> create_sum_count(
+        const std::vector<const IAggregateFunction*>& functions) {
+    if (auto fused = try_create<FusedSum<TSum>, FusedCount>(functions)) {
+        return fused;
+    }
+    return try_create<FusedCount, FusedSum<TSum>>(functions);
+}
+
+template <typename T>
+std::unique_ptr<IFusedAggregateFunctions> create_min_max(
+        const std::vector<const IAggregateFunction*>& functions) {
+    if (auto fused = try_create<FusedMin<T>, FusedMax<T>>(functions)) {
+        return fused;
+    }
+    return try_create<FusedCount, FusedMin<T>, FusedMax<T>>(functions);
+}
+
+template <typename TSum, typename T>
+std::unique_ptr<IFusedAggregateFunctions> create_sum_min_max(
+        const std::vector<const IAggregateFunction*>& functions) {
+    if (auto fused = try_create<FusedSum<TSum>, FusedCount, FusedMin<T>, FusedMax<T>>(functions)) {
+        return fused;
+    }
+    if (auto fused = try_create<FusedCount, FusedSum<TSum>, FusedMin<T>, FusedMax<T>>(functions)) {
+        return fused;
+    }
+    return try_create<FusedSum<TSum>, FusedMin<T>, FusedMax<T>>(functions);
+}
+
+} // namespace
+
+std::unique_ptr<IFusedAggregateFunctions> create_fused_aggregate_functions(
+        const std::vector<const IAggregateFunction*>& functions) {
+    std::unique_ptr<IFusedAggregateFunctions> fused;
+    switch (functions.size()) {
+    case 2:
+        if ((fused = create_sum_count<Int32>(functions)) ||
+            (fused = create_sum_count<Int64>(functions)) ||
+            (fused = create_min_max<Int32>(functions)) ||
+            (fused = create_min_max<Int64>(functions))) {
+            return fused;
+        }
+        break;
+    case 3:
+    case 4:
+        if ((fused = create_min_max<Int32>(functions)) ||
+            (fused = create_min_max<Int64>(functions)) ||
+            (fused = create_sum_min_max<Int32, Int32>(functions)) ||
+            (fused = create_sum_min_max<Int32, Int64>(functions)) ||
+            (fused = create_sum_min_max<Int64, Int32>(functions)) ||
+            (fused = create_sum_min_max<Int64, Int64>(functions))) {
+            return fused;
+        }
+        break;
+    default:
+        break;
+    }
+    return nullptr;
+}
+
+} // namespace doris::vectorized
@@ -0,0 +1,80 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <stddef.h>
+
+#include <memory>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include "vec/aggregate_functions/aggregate_function.h"
+
+namespace doris::vectorized {
+class Arena;
+class IColumn;
+
+// Adds a batch of rows into the states of all aggregate functions of an aggregation in
+// a single pass over the places, instead of one add_batch loop per function which
+// re-reads the places array and pays a virtual call per row.
+class IFusedAggregateFunctions {
+public:
+    virtual ~IFusedAggregateFunctions() = default;
+
+    // columns[i] are the argument columns of the i-th function and
+    // place_offsets[i] is the offset of its state in a place
+    virtual void add_batch(size_t batch_size, AggregateDataPtr* places,
+                           const size_t* place_offsets, const IColumn** const* columns,
+                           Arena* arena) const = 0;
+};
+
+// The functions are the concrete final classes, so the add calls are devirtualized and
+// may be inlined into one loop.
+template <typename... Functions>
+class FusedAggregateFunctions final : public IFusedAggregateFunctions {
+public:
+    explicit FusedAggregateFunctions(const Functions*... functions) : _functions(functions...) {}
+
+    void add_batch(size_t batch_size, AggregateDataPtr* places, const size_t* place_offsets,
+                   const IColumn** const* columns, Arena* arena) const override {
+        _add_batch(batch_size, places, place_offsets, columns, arena,
+                   std::index_sequence_for<Functions...>());
+    }
+
+private:
+    template <size_t... I>
+    void _add_batch(size_t batch_size, AggregateDataPtr* places, const size_t* place_offsets,
+                    const IColumn** const* columns, Arena* arena,
+                    std::index_sequence<I...>) const {
+        for (size_t i = 0; i < batch_size; ++i) {
+            AggregateDataPtr place = places[i];
+            (std::get<I>(_functions)->add(place + place_offsets[I], columns[I], i, arena), ...);
+        }
+    }
+
+    std::tuple<const Functions*...> _functions;
+};
+
+// Return nullptr if the functions are not one of the supported combinations, i.e.
+// sum, count, min and max over not nullable int and bigint columns, then the caller
+// should fall back to add the batch function by function.
+std::unique_ptr<IFusedAggregateFunctions> create_fused_aggregate_functions(
+        const std::vector<const IAggregateFunction*>& functions);
+
+} // namespace doris::vectorized
@@ -206,9 +206,21 @@ public:
     void add_batch(size_t batch_size, AggregateDataPtr* places, size_t place_offset,
                    const IColumn** columns, Arena* arena, bool agg_many) const override {
         const ColumnNullable* column = assert_cast<const ColumnNullable*>(columns[0]);
+        const IColumn* nested_column = &column->get_nested_column();
+        if (!column->has_null()) {
+            // dispatch to the batch of the nested function for the column without null
+            for (size_t i = 0; i < batch_size; ++i) {
+                this->set_flag(places[i] + place_offset);
+            }
+            this->nested_function->add_batch(batch_size, places, place_offset + this->prefix_size,
+                                             &nested_column, arena, agg_many);
+            return;
+        }
+        if (column->all_null()) {
+            return;
+        }
         // The overhead introduced is negligible here, just an extra memory read from NullMap
         const auto* __restrict null_map_data = column->get_null_map_data().data();
-        const IColumn* nested_column = &column->get_nested_column();
         for (int i = 0; i < batch_size; ++i) {
             if (!null_map_data[i]) {
                 AggregateDataPtr __restrict place = places[i] + place_offset;
@@ -224,6 +236,9 @@ public:
         bool has_null = column->has_null();
 
         if (has_null) {
+            if (column->all_null()) {
+                return;
+            }
             for (size_t i = 0; i < batch_size; ++i) {
                 this->add(place, columns, i, arena);
             }
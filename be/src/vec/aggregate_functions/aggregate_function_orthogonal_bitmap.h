@@ -27,6 +27,7 @@
 #include <string>
 #include <string_view>
 #include <type_traits>
+#include <vector>
 
 #include "util/bitmap_expr_calculation.h"
 #include "util/bitmap_intersect.h"
@@ -34,6 +35,7 @@
 #include "vec/aggregate_functions/aggregate_function.h"
 #include "vec/columns/column_complex.h"
 #include "vec/columns/column_vector.h"
+#include "vec/common/hash_table/phmap_fwd_decl.h"
 #include "vec/core/types.h"
 #include "vec/data_types/data_type_bitmap.h"
 #include "vec/data_types/data_type_number.h"
@@ -71,6 +73,28 @@ public:
         }
     }
 
+    // group the bitmaps of the batch by their keys to union each group at once
+    void add_batch(const IColumn** columns, size_t batch_size) {
+        const auto& bitmap_col = assert_cast<const ColumnBitmap&>(*columns[0]);
+        const auto& data_col = assert_cast<const ColVecData&>(*columns[1]);
+        flat_hash_map<T, std::vector<const BitmapValue*>> key_bitmaps;
+        for (size_t i = 0; i < batch_size; ++i) {
+            T key;
+            if constexpr (IsNumber<T>) {
+                key = data_col.get_element(i);
+            } else {
+                auto sr = data_col.get_data_at(i);
+                key = std::string_view {sr.data, sr.size};
+            }
+            if (bitmap.contains_key(key)) {
+                key_bitmaps[key].push_back(&bitmap_col.get_element(i));
+            }
+        }
+        for (const auto& [key, bitmaps] : key_bitmaps) {
+            bitmap.update(key, bitmaps);
+        }
+    }
+
     void init_add_key(const IColumn** columns, size_t row_num, int argument_size) {
         if (first_init) {
             DCHECK(argument_size > 1);
@@ -210,6 +234,12 @@ public:
         bitmap_expr_cal.update(update_key, bitmap_value);
     }
 
+    void add_batch(const IColumn** columns, size_t batch_size) {
+        for (size_t i = 0; i < batch_size; ++i) {
+            add(columns, i);
+        }
+    }
+
     void init_add_key(const IColumn** columns, size_t row_num, int argument_size) {
         if (first_init) {
             DCHECK(argument_size > 1);
@@ -310,6 +340,16 @@ struct OrthBitmapUnionCountData {
         const auto& column = assert_cast<const ColumnBitmap&>(*columns[0]);
         value |= column.get_data()[row_num];
     }
+
+    void add_batch(const IColumn** columns, size_t batch_size) {
+        const auto& column = assert_cast<const ColumnBitmap&>(*columns[0]);
+        std::vector<const BitmapValue*> values;
+        values.reserve(batch_size);
+        for (size_t i = 0; i < batch_size; ++i) {
+            values.push_back(&column.get_data()[i]);
+        }
+        value.fastunion(values);
+    }
     void merge(const OrthBitmapUnionCountData& rhs) { result += rhs.result; }
 
     void write(BufferWritable& buf) {
@@ -347,6 +387,16 @@ public:
         this->data(place).add(columns, row_num);
     }
 
+    void add_batch_single_place(size_t batch_size, AggregateDataPtr place, const IColumn** columns,
+                                Arena*) const override {
+        if (batch_size == 0) {
+            return;
+        }
+        // the filter keys are constant arguments
+        this->data(place).init_add_key(columns, 0, _argument_size);
+        this->data(place).add_batch(columns, batch_size);
+    }
+
     void merge(AggregateDataPtr __restrict place, ConstAggregateDataPtr rhs,
                Arena*) const override {
         this->data(place).merge(this->data(rhs));
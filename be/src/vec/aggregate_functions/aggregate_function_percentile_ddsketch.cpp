@@ -0,0 +1,43 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+
+#include "vec/aggregate_functions/aggregate_function_percentile_ddsketch.h"
+
+#include "vec/aggregate_functions/aggregate_function_simple_factory.h"
+#include "vec/aggregate_functions/helpers.h"
+
+namespace doris::vectorized {
+
+template <bool is_nullable>
+AggregateFunctionPtr create_aggregate_function_percentile_ddsketch(const std::string& name,
+                                                                   const DataTypes& argument_types,
+                                                                   const bool result_is_nullable) {
+    if (argument_types.size() != 2 && argument_types.size() != 3) {
+        return nullptr;
+    }
+    return creator_without_type::create<AggregateFunctionPercentileDDSketch<is_nullable>>(
+            remove_nullable(argument_types), result_is_nullable);
+}
+
+void register_aggregate_function_percentile_ddsketch(AggregateFunctionSimpleFactory& factory) {
+    factory.register_function("percentile_ddsketch",
+                              create_aggregate_function_percentile_ddsketch<false>, false);
+    factory.register_function("percentile_ddsketch",
+                              create_aggregate_function_percentile_ddsketch<true>, true);
+}
+} // namespace doris::vectorized
@@ -0,0 +1,208 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+
+#pragma once
+
+#include <stddef.h>
+
+#include <cmath>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "util/ddsketch.h"
+#include "util/slice.h"
+#include "vec/aggregate_functions/aggregate_function.h"
+#include "vec/columns/column_nullable.h"
+#include "vec/columns/column_vector.h"
+#include "vec/columns/columns_number.h"
+#include "vec/common/assert_cast.h"
+#include "vec/common/string_ref.h"
+#include "vec/core/types.h"
+#include "vec/data_types/data_type_nullable.h"
+#include "vec/data_types/data_type_number.h"
+#include "vec/io/io_helper.h"
+
+namespace doris {
+namespace vectorized {
+class Arena;
+class BufferReadable;
+class BufferWritable;
+} // namespace vectorized
+} // namespace doris
+
+namespace doris::vectorized {
+
+struct PercentileDDSketchState {
+    static constexpr double INIT_QUANTILE = -1.0;
+
+    void init(double relative_accuracy = DDSketch::DEFAULT_RELATIVE_ACCURACY) {
+        if (!init_flag) {
+            sketch = DDSketch(relative_accuracy);
+            init_flag = true;
+        }
+    }
+
+    void write(BufferWritable& buf) const {
+        write_binary(init_flag, buf);
+        if (!init_flag) {
+            return;
+        }
+        write_binary(target_quantile, buf);
+        std::string result;
+        sketch.serialize(&result);
+        write_binary(result, buf);
+    }
+
+    void read(BufferReadable& buf) {
+        read_binary(init_flag, buf);
+        if (!init_flag) {
+            return;
+        }
+        read_binary(target_quantile, buf);
+        StringRef ref;
+        read_binary(ref, buf);
+        sketch.deserialize(Slice(ref.data, ref.size));
+    }
+
+    double get() const { return init_flag ? sketch.quantile(target_quantile) : std::nan(""); }
+
+    void merge(const PercentileDDSketchState& rhs) {
+        if (!rhs.init_flag) {
+            return;
+        }
+        init(rhs.sketch.relative_accuracy());
+        sketch.merge(rhs.sketch);
+        if (target_quantile == INIT_QUANTILE) {
+            target_quantile = rhs.target_quantile;
+        }
+    }
+
+    void add(double source, double quantile) {
+        sketch.add(source);
+        target_quantile = quantile;
+    }
+
+    void add_batch(const double* sources, size_t count, double quantile) {
+        sketch.add_batch(sources, count);
+        target_quantile = quantile;
+    }
+
+    void reset() {
+        target_quantile = INIT_QUANTILE;
+        init_flag = false;
+        sketch.clear();
+    }
+
+    bool init_flag = false;
+    DDSketch sketch;
+    double target_quantile = INIT_QUANTILE;
+};
+
+// percentile_ddsketch(expr, quantile [, relative_accuracy]), an approximate percentile whose
+// relative error is bounded and whose merges are deterministic, see DDSketch.
+template <bool is_nullable>
+class AggregateFunctionPercentileDDSketch final
+        : public IAggregateFunctionDataHelper<PercentileDDSketchState,
+                                              AggregateFunctionPercentileDDSketch<is_nullable>> {
+public:
+    AggregateFunctionPercentileDDSketch(const DataTypes& argument_types_)
+            : IAggregateFunctionDataHelper<PercentileDDSketchState,
+                                           AggregateFunctionPercentileDDSketch<is_nullable>>(
+                      argument_types_) {}
+
+    String get_name() const override { return "percentile_ddsketch"; }
+
+    DataTypePtr get_return_type() const override {
+        return make_nullable(std::make_shared<DataTypeFloat64>());
+    }
+
+    void add(AggregateDataPtr __restrict place, const IColumn** columns, size_t row_num,
+             Arena*) const override {
+        double args[3] = {0, 0, DDSketch::DEFAULT_RELATIVE_ACCURACY};
+        size_t num_args = this->argument_types.size();
+        for (size_t i = 0; i < num_args; ++i) {
+            const IColumn* column = columns[i];
+            if constexpr (is_nullable) {
+                if (const auto* nullable_column = check_and_get_column<ColumnNullable>(column)) {
+                    if (nullable_column->is_null_at(row_num)) {
+                        if (i == 0) {
+                            return;
+                        }
+                        continue;
+                    }
+                    column = &nullable_column->get_nested_column();
+                }
+            }
+            args[i] = assert_cast<const ColumnFloat64&>(*column).get_data()[row_num];
+        }
+        this->data(place).init(args[2]);
+        this->data(place).add(args[0], args[1]);
+    }
+
+    void add_batch_single_place(size_t batch_size, AggregateDataPtr place, const IColumn** columns,
+                                Arena* arena) const override {
+        if (batch_size == 0) {
+            return;
+        }
+        if constexpr (is_nullable) {
+            for (size_t i = 0; i < batch_size; ++i) {
+                add(place, columns, i, arena);
+            }
+        } else {
+            // the quantile and the accuracy are constant arguments
+            const auto& sources = assert_cast<const ColumnFloat64&>(*columns[0]).get_data();
+            const auto& quantile = assert_cast<const ColumnFloat64&>(*columns[1]).get_data();
+            this->data(place).init(
+                    this->argument_types.size() == 3
+                            ? assert_cast<const ColumnFloat64&>(*columns[2]).get_data()[0]
+                            : DDSketch::DEFAULT_RELATIVE_ACCURACY);
+            this->data(place).add_batch(sources.data(), batch_size, quantile[0]);
+        }
+    }
+
+    void reset(AggregateDataPtr __restrict place) const override { this->data(place).reset(); }
+
+    void merge(AggregateDataPtr __restrict place, ConstAggregateDataPtr rhs,
+               Arena*) const override {
+        this->data(place).merge(this->data(rhs));
+    }
+
+    void serialize(ConstAggregateDataPtr __restrict place, BufferWritable& buf) const override {
+        this->data(place).write(buf);
+    }
+
+    void deserialize(AggregateDataPtr __restrict place, BufferReadable& buf,
+                     Arena*) const override {
+        this->data(place).read(buf);
+    }
+
+    void insert_result_into(ConstAggregateDataPtr __restrict place, IColumn& to) const override {
+        auto& nullable_column = assert_cast<ColumnNullable&>(to);
+        double result = this->data(place).get();
+        if (std::isnan(result)) {
+            nullable_column.insert_default();
+        } else {
+            auto& col = assert_cast<ColumnFloat64&>(nullable_column.get_nested_column());
+            col.get_data().push_back(result);
+            nullable_column.get_null_map_data().push_back(0);
+        }
+    }
+};
+
+} // namespace doris::vectorized
@@ -0,0 +1,234 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+
+#pragma once
+
+#include <glog/logging.h>
+#include <stddef.h>
+#include <string.h>
+
+#include <algorithm>
+#include <memory>
+#include <typeinfo>
+
+#include "util/hash_util.hpp"
+#include "vec/columns/column.h"
+#include "vec/columns/column_vector.h"
+#include "vec/columns/columns_common.h"
+#include "vec/common/arena.h"
+#include "vec/common/assert_cast.h"
+#include "vec/common/cow.h"
+#include "vec/common/sip_hash.h"
+#include "vec/common/string_ref.h"
+#include "vec/core/field.h"
+
+namespace doris::vectorized {
+
+// A read-only column of fixed width values which borrows the buffer of someone else, e.g.
+// the page of StoragePageCache whose plain layout already matches ColumnVector, so the values
+// are read without being copied. The owner keeps the buffer alive as long as the column, and
+// any copy of it, is referenced.
+//
+// It can not be mutated: the rows are only copied into a ColumnVector by the operations which
+// create new columns, e.g. filter and permute, and convert_to_full_column_if_const
+// materializes the whole column for the code which requires a ColumnVector.
+template <typename T>
+class ColumnBorrowedVector final : public COWHelper<IColumn, ColumnBorrowedVector<T>> {
+private:
+    using Self = ColumnBorrowedVector;
+    friend class COWHelper<IColumn, Self>;
+
+    ColumnBorrowedVector(const T* data, size_t size, std::shared_ptr<const void> owner)
+            : _data(data), _size(size), _owner(std::move(owner)) {}
+    ColumnBorrowedVector(const ColumnBorrowedVector&) = default;
+
+public:
+    using value_type = T;
+    using Materialized = ColumnVector<T>;
+
+    const char* get_family_name() const override { return "BorrowedVector"; }
+
+    size_t size() const override { return _size; }
+
+    // the borrowed buffer is accounted by its owner
+    size_t byte_size() const override { return _size * sizeof(T); }
+    size_t allocated_bytes() const override { return 0; }
+
+    const T* get_data() const { return _data; }
+
+    T get_element(size_t n) const { return _data[n]; }
+
+    Int64 get_int(size_t n) const override { return Int64(_data[n]); }
+
+    typename Materialized::MutablePtr materialize() const {
+        auto res = Materialized::create(_size);
+        if (_size > 0) {
+            memcpy(res->get_data().data(), _data, _size * sizeof(T));
+        }
+        return res;
+    }
+
+    ColumnPtr convert_to_full_column_if_const() const override { return materialize(); }
+
+    MutableColumnPtr clone_resized(size_t to_size) const override {
+        auto res = Materialized::create(to_size, T());
+        memcpy(res->get_data().data(), _data, std::min(_size, to_size) * sizeof(T));
+        return res;
+    }
+
+    Field operator[](size_t n) const override {
+        DCHECK_LT(n, _size);
+        return _data[n];
+    }
+
+    void get(size_t n, Field& res) const override { res = (*this)[n]; }
+
+    StringRef get_data_at(size_t n) const override {
+        return StringRef(reinterpret_cast<const char*>(&_data[n]), sizeof(T));
+    }
+
+    void insert(const Field&) override { _read_only("insert"); }
+    void insert_range_from(const IColumn&, size_t, size_t) override {
+        _read_only("insert_range_from");
+    }
+    void insert_indices_from(const IColumn&, const int*, const int*) override {
+        _read_only("insert_indices_from");
+    }
+    void insert_data(const char*, size_t) override { _read_only("insert_data"); }
+    void insert_default() override { _read_only("insert_default"); }
+    void pop_back(size_t) override { _read_only("pop_back"); }
+    const char* deserialize_and_insert_from_arena(const char*) override {
+        _read_only("deserialize_and_insert_from_arena");
+        return nullptr;
+    }
+    size_t filter(const IColumn::Filter&) override {
+        _read_only("filter");
+        return 0;
+    }
+    void replace_column_data(const IColumn&, size_t, size_t) override {
+        _read_only("replace_column_data");
+    }
+    void replace_column_data_default(size_t) override {
+        _read_only("replace_column_data_default");
+    }
+
+    StringRef serialize_value_into_arena(size_t n, Arena& arena,
+                                         char const*& begin) const override {
+        auto pos = arena.alloc_continue(sizeof(T), begin);
+        memcpy(pos, &_data[n], sizeof(T));
+        return {pos, sizeof(T)};
+    }
+
+    void update_hash_with_value(size_t n, SipHash& hash) const override {
+        hash.update(_data[n]);
+    }
+
+    void update_hashes_with_value(std::vector<SipHash>& hashes,
+                                  const uint8_t* __restrict null_data) const override {
+        SIP_HASHES_FUNCTION_COLUMN_IMPL();
+    }
+
+    void update_hashes_with_value(uint64_t* __restrict hashes,
+                                  const uint8_t* __restrict null_data) const override {
+        for (size_t i = 0; i < _size; i++) {
+            if (null_data == nullptr || null_data[i] == 0) {
+                hashes[i] = HashUtil::xxHash64WithSeed(reinterpret_cast<const char*>(&_data[i]),
+                                                       sizeof(T), hashes[i]);
+            }
+        }
+    }
+
+    ColumnPtr filter(const IColumn::Filter& filt, ssize_t result_size_hint) const override {
+        column_match_filter_size(_size, filt.size());
+        auto res = Materialized::create();
+        auto& res_data = res->get_data();
+        res_data.reserve(result_size_hint > 0 ? result_size_hint : _size);
+        for (size_t i = 0; i < _size; ++i) {
+            if (filt[i]) {
+                res_data.push_back(_data[i]);
+            }
+        }
+        return res;
+    }
+
+    ColumnPtr permute(const IColumn::Permutation& perm, size_t limit) const override {
+        limit = limit == 0 ? _size : std::min(_size, limit);
+        if (perm.size() < limit) {
+            LOG(FATAL) << "Size of permutation is less than required.";
+        }
+        auto res = Materialized::create(limit);
+        auto& res_data = res->get_data();
+        for (size_t i = 0; i < limit; ++i) {
+            res_data[i] = _data[perm[i]];
+        }
+        return res;
+    }
+
+    int compare_at(size_t n, size_t m, const IColumn& rhs_, int) const override {
+        T lhs = _data[n];
+        T rhs = assert_cast<const Self&>(rhs_)._data[m];
+        return lhs < rhs ? -1 : (lhs == rhs ? 0 : 1);
+    }
+
+    void get_permutation(bool reverse, size_t limit, int nan_direction_hint,
+                         IColumn::Permutation& res) const override {
+        materialize()->get_permutation(reverse, limit, nan_direction_hint, res);
+    }
+
+    ColumnPtr replicate(const IColumn::Offsets& offsets) const override {
+        return materialize()->replicate(offsets);
+    }
+
+    MutableColumns scatter(IColumn::ColumnIndex num_columns,
+                           const IColumn::Selector& selector) const override {
+        return materialize()->scatter(num_columns, selector);
+    }
+
+    void append_data_by_selector(MutableColumnPtr& res,
+                                 const IColumn::Selector& selector) const override {
+        materialize()->append_data_by_selector(res, selector);
+    }
+
+    void get_extremes(Field& min, Field& max) const override {
+        materialize()->get_extremes(min, max);
+    }
+
+    bool can_be_inside_nullable() const override { return true; }
+
+    bool structure_equals(const IColumn& rhs) const override {
+        return typeid(rhs) == typeid(Self);
+    }
+
+    void clear() override {
+        _data = nullptr;
+        _size = 0;
+        _owner.reset();
+    }
+
+private:
+    [[noreturn]] void _read_only(const char* method) const {
+        LOG(FATAL) << method << " is not supported by the read-only " << get_family_name();
+        __builtin_unreachable();
+    }
+
+    const T* _data;
+    size_t _size;
+    std::shared_ptr<const void> _owner;
+};
+
+} // namespace doris::vectorized
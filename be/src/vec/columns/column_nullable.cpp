@@ -598,6 +598,14 @@ void ColumnNullable::_update_has_null() {
     _need_update_has_null = false;
 }
 
+bool ColumnNullable::all_null() const {
+    if (size() == 0 || !has_null()) {
+        return false;
+    }
+    const auto& null_map_data = get_null_map_data();
+    return !simd::contain_byte(null_map_data.data(), null_map_data.size(), 0);
+}
+
 bool ColumnNullable::has_null(size_t size) const {
     if (!_has_null && !_need_update_has_null) {
         return false;
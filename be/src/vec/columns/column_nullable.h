@@ -330,6 +330,10 @@ public:
 
     bool has_null(size_t size) const override;
 
+    // Whether all the rows are null, so the kernels can skip the nested column. The null map is
+    // only scanned if the column has null, and the scan stops at the first not null row.
+    bool all_null() const;
+
     void replace_column_data(const IColumn& rhs, size_t row, size_t self_row = 0) override {
         DCHECK(size() > self_row);
         const ColumnNullable& nullable_rhs = assert_cast<const ColumnNullable&>(rhs);
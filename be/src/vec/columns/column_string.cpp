@@ -434,14 +434,16 @@ void ColumnString::replicate(const uint32_t* counts, size_t target_size, IColumn
 
     Chars& res_chars = res.chars;
     Offsets& res_offsets = res.offsets;
-    res_chars.reserve(chars.size() / col_size * target_size);
-    res_offsets.reserve(target_size);
-
     size_t base = begin > 0 ? offsets[begin - 1] : 0;
+    size_t end = begin + col_size;
+    // estimated by the chars of the rows replicated, the column may be much larger
+    res_chars.reserve(res_chars.size() + (offsets[end - 1] - base) / col_size * target_size);
+    res_offsets.reserve(res_offsets.size() + target_size);
+
     Offset prev_string_offset = 0 + base;
-    Offset current_new_offset = 0;
+    // appended to the rows of res
+    Offset current_new_offset = res_chars.size();
 
-    size_t end = begin + col_size;
     for (size_t i = begin; i < end; ++i) {
         size_t size_to_replicate = counts[i];
         size_t string_size = offsets[i] - prev_string_offset;
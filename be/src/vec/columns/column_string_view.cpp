@@ -0,0 +1,296 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+
+#include "vec/columns/column_string_view.h"
+
+#include <fmt/format.h>
+
+#include <algorithm>
+#include <utility>
+
+#include "util/hash_util.hpp"
+#include "util/simd/bits.h"
+#include "vec/columns/column_string.h"
+#include "vec/columns/columns_common.h"
+#include "vec/common/unaligned.h"
+
+namespace doris::vectorized {
+
+ColumnStringView::ColumnStringView(const ColumnStringView& src)
+        : _views(src._views.begin(), src._views.end()) {
+    _share_buffers(src);
+}
+
+ColumnStringView::MutablePtr ColumnStringView::create_from(const ColumnString& src) {
+    auto res = ColumnStringView::create();
+    size_t num_rows = src.size();
+    res->_views.resize(num_rows);
+    for (size_t i = 0; i < num_rows; ++i) {
+        StringRef str = src.get_data_at(i);
+        res->_views[i] = StringView(str.data, str.size);
+    }
+    // the chars of src are referenced by the views of the long strings
+    ColumnPtr holder = src.get_ptr();
+    res->_add_buffer(std::shared_ptr<const void>(holder.get(), [holder](const void*) {}));
+    return res;
+}
+
+MutableColumnPtr ColumnStringView::to_column_string() const {
+    auto res = ColumnString::create();
+    res->reserve(size());
+    for (const auto& view : _views) {
+        res->insert_data(view.data(), view.size());
+    }
+    return res;
+}
+
+size_t ColumnStringView::byte_size() const {
+    size_t res = _views.size() * sizeof(StringView);
+    for (const auto& view : _views) {
+        res += view.is_inline() ? 0 : view.size();
+    }
+    return res;
+}
+
+size_t ColumnStringView::allocated_bytes() const {
+    // the shared buffers are accounted by their owners
+    return _views.allocated_bytes() + (_arena ? _arena->size() : 0);
+}
+
+MutableColumnPtr ColumnStringView::clone_resized(size_t to_size) const {
+    auto res = ColumnStringView::create();
+    size_t copy_size = std::min(to_size, size());
+    res->_views.assign(_views.begin(), _views.begin() + copy_size);
+    res->_views.resize_fill(to_size);
+    res->_share_buffers(*this);
+    return res;
+}
+
+void ColumnStringView::insert_from(const IColumn& src_, size_t n) {
+    const auto& src = assert_cast<const ColumnStringView&>(src_);
+    const auto& view = src._views[n];
+    if (!view.is_inline()) {
+        _share_buffers(src);
+    }
+    _views.push_back(view);
+}
+
+void ColumnStringView::insert_data(const char* pos, size_t length) {
+    if (length <= StringView::INLINE_SIZE) {
+        _views.emplace_back(pos, length);
+        return;
+    }
+    if (_arena == nullptr) {
+        _arena = std::make_shared<Arena>();
+    }
+    const char* data = _arena->insert(pos, length);
+    _views.emplace_back(data, length);
+}
+
+void ColumnStringView::insert_range_from(const IColumn& src_, size_t start, size_t length) {
+    if (length == 0) {
+        return;
+    }
+    const auto& src = assert_cast<const ColumnStringView&>(src_);
+    if (start + length > src.size()) {
+        LOG(FATAL) << fmt::format(
+                "Parameter out of bound in IColumnStringView::insert_range_from method! "
+                "[start({}) + length({}) > offsets.size({})]",
+                start, length, src.size());
+    }
+    _views.insert(src._views.begin() + start, src._views.begin() + start + length);
+    _share_buffers(src);
+}
+
+void ColumnStringView::insert_indices_from(const IColumn& src_, const int* indices_begin,
+                                           const int* indices_end) {
+    const auto& src = assert_cast<const ColumnStringView&>(src_);
+    _views.reserve(size() + (indices_end - indices_begin));
+    for (const int* x = indices_begin; x != indices_end; ++x) {
+        if (*x == -1) {
+            _views.emplace_back();
+        } else {
+            _views.push_back(src._views[*x]);
+        }
+    }
+    _share_buffers(src);
+}
+
+StringRef ColumnStringView::serialize_value_into_arena(size_t n, Arena& arena,
+                                                       char const*& begin) const {
+    // the same format as ColumnString
+    uint32_t string_size = _views[n].size();
+    StringRef res;
+    res.size = sizeof(string_size) + string_size;
+    char* pos = arena.alloc_continue(res.size, begin);
+    memcpy(pos, &string_size, sizeof(string_size));
+    memcpy(pos + sizeof(string_size), _views[n].data(), string_size);
+    res.data = pos;
+    return res;
+}
+
+const char* ColumnStringView::deserialize_and_insert_from_arena(const char* pos) {
+    const uint32_t string_size = unaligned_load<uint32_t>(pos);
+    pos += sizeof(string_size);
+    insert_data(pos, string_size);
+    return pos + string_size;
+}
+
+void ColumnStringView::update_hashes_with_value(uint64_t* __restrict hashes,
+                                                const uint8_t* __restrict null_data) const {
+    size_t s = size();
+    for (size_t i = 0; i < s; i++) {
+        if (null_data == nullptr || null_data[i] == 0) {
+            hashes[i] = HashUtil::xxHash64WithSeed(_views[i].data(), _views[i].size(), hashes[i]);
+        }
+    }
+}
+
+ColumnPtr ColumnStringView::filter(const Filter& filt, ssize_t result_size_hint) const {
+    column_match_filter_size(size(), filt.size());
+    auto res = ColumnStringView::create();
+    if (result_size_hint > 0) {
+        res->_views.reserve(result_size_hint);
+    } else {
+        res->_views.reserve(size() - simd::count_zero_num((const int8_t*)filt.data(), size()));
+    }
+    for (size_t i = 0; i < filt.size(); ++i) {
+        if (filt[i]) {
+            res->_views.push_back(_views[i]);
+        }
+    }
+    res->_share_buffers(*this);
+    return res;
+}
+
+size_t ColumnStringView::filter(const Filter& filter) {
+    column_match_filter_size(size(), filter.size());
+    size_t pos = 0;
+    for (size_t i = 0; i < filter.size(); ++i) {
+        if (filter[i]) {
+            _views[pos++] = _views[i];
+        }
+    }
+    _views.resize_assume_reserved(pos);
+    return pos;
+}
+
+ColumnPtr ColumnStringView::permute(const Permutation& perm, size_t limit) const {
+    limit = limit == 0 ? size() : std::min(size(), limit);
+    if (perm.size() < limit) {
+        LOG(FATAL) << "Size of permutation is less than required.";
+    }
+    auto res = ColumnStringView::create();
+    res->_views.resize(limit);
+    for (size_t i = 0; i < limit; ++i) {
+        res->_views[i] = _views[perm[i]];
+    }
+    res->_share_buffers(*this);
+    return res;
+}
+
+void ColumnStringView::get_permutation(bool reverse, size_t limit, int /*nan_direction_hint*/,
+                                       Permutation& res) const {
+    size_t s = size();
+    res.resize(s);
+    for (size_t i = 0; i < s; ++i) {
+        res[i] = i;
+    }
+    if (limit >= s) {
+        limit = 0;
+    }
+    auto less = [this, reverse](size_t lhs, size_t rhs) {
+        int cmp = _views[lhs].compare(_views[rhs]);
+        return reverse ? cmp > 0 : cmp < 0;
+    };
+    if (limit) {
+        std::partial_sort(res.begin(), res.begin() + limit, res.end(), less);
+    } else {
+        std::sort(res.begin(), res.end(), less);
+    }
+}
+
+ColumnPtr ColumnStringView::replicate(const Offsets& replicate_offsets) const {
+    size_t col_size = size();
+    column_match_offsets_size(col_size, replicate_offsets.size());
+    auto res = ColumnStringView::create();
+    if (col_size == 0) {
+        return res;
+    }
+    res->_views.reserve(replicate_offsets.back());
+    for (size_t i = 0; i < col_size; ++i) {
+        res->_views.resize_fill(replicate_offsets[i], _views[i]);
+    }
+    res->_share_buffers(*this);
+    return res;
+}
+
+void ColumnStringView::get_extremes(Field& min, Field& max) const {
+    min = String();
+    max = String();
+    if (empty()) {
+        return;
+    }
+    size_t min_idx = 0;
+    size_t max_idx = 0;
+    for (size_t i = 1; i < size(); ++i) {
+        if (_views[i].compare(_views[min_idx]) < 0) {
+            min_idx = i;
+        } else if (_views[i].compare(_views[max_idx]) > 0) {
+            max_idx = i;
+        }
+    }
+    get(min_idx, min);
+    get(max_idx, max);
+}
+
+void ColumnStringView::replace_column_data(const IColumn& rhs, size_t row, size_t self_row) {
+    DCHECK(size() > self_row);
+    const auto& src = assert_cast<const ColumnStringView&>(rhs);
+    if (!src._views[row].is_inline()) {
+        _share_buffers(src);
+    }
+    _views[self_row] = src._views[row];
+}
+
+void ColumnStringView::_share_buffers(const ColumnStringView& src) {
+    if (&src == this) {
+        return;
+    }
+    if (src._arena != nullptr) {
+        _add_buffer(src._arena);
+    }
+    for (const auto& buffer : src._buffers) {
+        _add_buffer(buffer);
+    }
+}
+
+void ColumnStringView::_add_buffer(std::shared_ptr<const void> buffer) {
+    if (buffer.get() == _arena.get()) {
+        return;
+    }
+    // there are only a few sources of the strings of a column
+    for (const auto& b : _buffers) {
+        if (b.get() == buffer.get()) {
+            return;
+        }
+    }
+    _buffers.emplace_back(std::move(buffer));
+}
+
+} // namespace doris::vectorized
@@ -0,0 +1,270 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+
+#pragma once
+
+#include <glog/logging.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include <algorithm>
+#include <memory>
+#include <typeinfo>
+#include <vector>
+
+#include "vec/columns/column.h"
+#include "vec/columns/column_impl.h"
+#include "vec/common/arena.h"
+#include "vec/common/assert_cast.h"
+#include "vec/common/cow.h"
+#include "vec/common/pod_array.h"
+#include "vec/common/sip_hash.h"
+#include "vec/common/string_ref.h"
+#include "vec/core/field.h"
+#include "vec/core/types.h"
+
+namespace doris::vectorized {
+
+class ColumnString;
+
+// A 16 bytes view of a string, in the layout of the German strings of Umbra:
+//   Size(4) | Prefix(4) | Suffix(8)                      if size <= 12
+//   Size(4) | Prefix(4) | Pointer to the whole string(8) otherwise
+// The size and prefix are compared as one word, so most of the comparisons of the short
+// strings, e.g. codes and ids, and the comparisons of the strings of different size or prefix
+// never touch any memory out of the view.
+struct StringView {
+    static constexpr uint32_t PREFIX_SIZE = 4;
+    static constexpr uint32_t INLINE_SIZE = 12;
+
+    StringView() = default;
+
+    // the string is copied into the view if short, or referenced by it otherwise
+    StringView(const char* data, uint32_t size) : _size(size) {
+        if (size <= INLINE_SIZE) {
+            if (size > 0) {
+                memcpy(_prefix, data, size);
+            }
+        } else {
+            memcpy(_prefix, data, PREFIX_SIZE);
+            _value.data = data;
+        }
+    }
+
+    bool is_inline() const { return _size <= INLINE_SIZE; }
+    uint32_t size() const { return _size; }
+    // points into the view itself for an inline string
+    const char* data() const { return is_inline() ? _prefix : _value.data; }
+    StringRef to_string_ref() const { return {data(), _size}; }
+
+    bool operator==(const StringView& rhs) const {
+        if (_size_and_prefix() != rhs._size_and_prefix()) {
+            return false;
+        }
+        if (is_inline()) {
+            return _value.suffix == rhs._value.suffix;
+        }
+        return memcmp(_value.data + PREFIX_SIZE, rhs._value.data + PREFIX_SIZE,
+                      _size - PREFIX_SIZE) == 0;
+    }
+    bool operator!=(const StringView& rhs) const { return !(*this == rhs); }
+
+    int compare(const StringView& rhs) const {
+        uint32_t min_size = std::min(_size, rhs._size);
+        int res = memcmp(_prefix, rhs._prefix, std::min(min_size, PREFIX_SIZE));
+        if (res != 0 || min_size <= PREFIX_SIZE) {
+            return res != 0 ? res : (_size > rhs._size) - (_size < rhs._size);
+        }
+        res = memcmp(data() + PREFIX_SIZE, rhs.data() + PREFIX_SIZE, min_size - PREFIX_SIZE);
+        return res != 0 ? res : (_size > rhs._size) - (_size < rhs._size);
+    }
+
+private:
+    uint64_t _size_and_prefix() const {
+        uint64_t word;
+        memcpy(&word, this, sizeof(word));
+        return word;
+    }
+
+    uint32_t _size = 0;
+    // zero filled so that the short strings can be compared by words
+    char _prefix[PREFIX_SIZE] = {};
+    union {
+        // the rest of an inline string follows the prefix
+        char inlined[8];
+        uint64_t suffix;
+        const char* data;
+    } _value {};
+};
+
+static_assert(sizeof(StringView) == 16, "StringView must be 16 bytes");
+
+// A string column of StringViews. The long strings are referenced by the views and kept alive
+// by the column, so filter, permute, insert_range_from and so on only move the 16 bytes views,
+// the result columns share the buffers of the long strings with the source.
+//
+// The buffers are never modified once written: the strings inserted are appended to the own
+// arena of the column, and the column which shares them with others starts a new arena when
+// cleared. A ColumnString borrowed by create_from must not be modified while it is referenced.
+class ColumnStringView final : public COWHelper<IColumn, ColumnStringView> {
+private:
+    friend class COWHelper<IColumn, ColumnStringView>;
+
+    ColumnStringView() = default;
+    ColumnStringView(const ColumnStringView& src);
+
+public:
+    using Container = PaddedPODArray<StringView>;
+
+    // The views of the strings of the column without copying the long strings, which are
+    // referenced in the chars of the column.
+    static MutablePtr create_from(const ColumnString& src);
+
+    // copy the strings into a ColumnString
+    MutableColumnPtr to_column_string() const;
+
+    const char* get_family_name() const override { return "StringView"; }
+
+    size_t size() const override { return _views.size(); }
+
+    size_t byte_size() const override;
+
+    size_t allocated_bytes() const override;
+
+    MutableColumnPtr clone_resized(size_t to_size) const override;
+
+    Field operator[](size_t n) const override {
+        DCHECK_LT(n, size());
+        return Field(_views[n].data(), _views[n].size());
+    }
+
+    void get(size_t n, Field& res) const override {
+        DCHECK_LT(n, size());
+        res.assign_string(_views[n].data(), _views[n].size());
+    }
+
+    StringRef get_data_at(size_t n) const override {
+        DCHECK_LT(n, size());
+        return _views[n].to_string_ref();
+    }
+
+    const Container& get_data() const { return _views; }
+
+    void insert(const Field& x) override {
+        const String& s = vectorized::get<const String&>(x);
+        insert_data(s.data(), s.size());
+    }
+
+    void insert_from(const IColumn& src, size_t n) override;
+
+    void insert_data(const char* pos, size_t length) override;
+
+    void insert_default() override { _views.emplace_back(); }
+
+    void insert_many_defaults(size_t length) override { _views.resize_fill(size() + length); }
+
+    void insert_range_from(const IColumn& src, size_t start, size_t length) override;
+
+    void insert_indices_from(const IColumn& src, const int* indices_begin,
+                             const int* indices_end) override;
+
+    void pop_back(size_t n) override { _views.resize_assume_reserved(size() - n); }
+
+    StringRef serialize_value_into_arena(size_t n, Arena& arena, char const*& begin) const override;
+
+    const char* deserialize_and_insert_from_arena(const char* pos) override;
+
+    void update_hash_with_value(size_t n, SipHash& hash) const override {
+        size_t string_size = _views[n].size();
+        hash.update(reinterpret_cast<const char*>(&string_size), sizeof(string_size));
+        hash.update(_views[n].data(), string_size);
+    }
+
+    void update_hashes_with_value(std::vector<SipHash>& hashes,
+                                  const uint8_t* __restrict null_data) const override {
+        SIP_HASHES_FUNCTION_COLUMN_IMPL();
+    }
+
+    void update_hashes_with_value(uint64_t* __restrict hashes,
+                                  const uint8_t* __restrict null_data) const override;
+
+    ColumnPtr filter(const Filter& filt, ssize_t result_size_hint) const override;
+
+    size_t filter(const Filter& filter) override;
+
+    ColumnPtr permute(const Permutation& perm, size_t limit) const override;
+
+    int compare_at(size_t n, size_t m, const IColumn& rhs_,
+                   int /*nan_direction_hint*/) const override {
+        const auto& rhs = assert_cast<const ColumnStringView&>(rhs_);
+        return _views[n].compare(rhs._views[m]);
+    }
+
+    void get_permutation(bool reverse, size_t limit, int nan_direction_hint,
+                         Permutation& res) const override;
+
+    ColumnPtr replicate(const Offsets& replicate_offsets) const override;
+
+    MutableColumns scatter(ColumnIndex num_columns, const Selector& selector) const override {
+        return scatter_impl(num_columns, selector);
+    }
+
+    void append_data_by_selector(MutableColumnPtr& res,
+                                 const IColumn::Selector& selector) const override {
+        append_data_by_selector_impl(res, selector);
+    }
+
+    void get_extremes(Field& min, Field& max) const override;
+
+    void reserve(size_t n) override { _views.reserve(n); }
+
+    void resize(size_t n) override { _views.resize_fill(n); }
+
+    bool can_be_inside_nullable() const override { return true; }
+
+    bool structure_equals(const IColumn& rhs) const override {
+        return typeid(rhs) == typeid(ColumnStringView);
+    }
+
+    void clear() override {
+        _views.clear();
+        _arena.reset();
+        _buffers.clear();
+    }
+
+    void replace_column_data(const IColumn& rhs, size_t row, size_t self_row = 0) override;
+
+    void replace_column_data_default(size_t self_row = 0) override {
+        DCHECK(size() > self_row);
+        _views[self_row] = StringView();
+    }
+
+private:
+    // keep the buffers of the long strings of src alive with this column
+    void _share_buffers(const ColumnStringView& src);
+    void _add_buffer(std::shared_ptr<const void> buffer);
+
+    Container _views;
+    // the long strings inserted into this column
+    std::shared_ptr<Arena> _arena;
+    // the buffers of the long strings shared with other columns
+    std::vector<std::shared_ptr<const void>> _buffers;
+};
+
+} // namespace doris::vectorized
@@ -31,6 +31,7 @@
 #include "runtime/memory/mem_tracker_limiter.h"
 #include "runtime/memory/thread_mem_tracker_mgr.h"
 #include "runtime/thread_context.h"
+#include "util/doris_metrics.h"
 #include "util/mem_info.h"
 #include "util/uid_util.h"
 
@@ -137,6 +138,54 @@ void Allocator<clear_memory_, mmap_populate, use_mmap>::release_memory(size_t si
     RELEASE_THREAD_MEM_TRACKER(size);
 }
 
+template <bool clear_memory_, bool mmap_populate, bool use_mmap>
+void* Allocator<clear_memory_, mmap_populate, use_mmap>::mmap_huge_page(size_t size) const {
+    // Over-map by a huge page and unmap the unaligned head and tail, the kernel can only back
+    // the 2MB aligned ranges by huge pages. MAP_POPULATE is not used, the pages must not be
+    // faulted in before madvise.
+    size_t map_size = size + HUGE_PAGE_SIZE;
+    void* buf = mmap(nullptr, map_size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (MAP_FAILED == buf) {
+        return buf;
+    }
+    auto begin = reinterpret_cast<uintptr_t>(buf);
+    uintptr_t aligned = (begin + HUGE_PAGE_SIZE - 1) & ~(HUGE_PAGE_SIZE - 1);
+    uintptr_t end = aligned + ((size + MMAP_MIN_ALIGNMENT - 1) & ~(MMAP_MIN_ALIGNMENT - 1));
+    if (aligned > begin) {
+        munmap(buf, aligned - begin);
+    }
+    if (begin + map_size > end) {
+        munmap(reinterpret_cast<void*>(end), begin + map_size - end);
+    }
+    buf = reinterpret_cast<void*>(aligned);
+#ifdef MADV_HUGEPAGE
+    // EINVAL if the transparent huge pages are disabled, the memory is still usable.
+    madvise(buf, size, MADV_HUGEPAGE);
+#endif
+    if constexpr (mmap_populate) {
+        memset(buf, 0, size);
+    }
+    doris::DorisMetrics::instance()->huge_page_alloc_bytes->increment(size);
+    return buf;
+}
+
+template <bool clear_memory_, bool mmap_populate, bool use_mmap>
+void Allocator<clear_memory_, mmap_populate, use_mmap>::remap_huge_page(void* buf, size_t old_size,
+                                                                       size_t new_size) const {
+    // The memory may be moved to an address not aligned to huge pages by mremap, but the
+    // aligned part of it can still be backed by huge pages.
+#ifdef MADV_HUGEPAGE
+    madvise(buf, new_size, MADV_HUGEPAGE);
+#endif
+    doris::DorisMetrics::instance()->huge_page_alloc_bytes->increment(
+            static_cast<int64_t>(new_size) - static_cast<int64_t>(old_size));
+}
+
+template <bool clear_memory_, bool mmap_populate, bool use_mmap>
+void Allocator<clear_memory_, mmap_populate, use_mmap>::munmap_huge_page(size_t size) const {
+    doris::DorisMetrics::instance()->huge_page_alloc_bytes->increment(-static_cast<int64_t>(size));
+}
+
 template <bool clear_memory_, bool mmap_populate, bool use_mmap>
 void Allocator<clear_memory_, mmap_populate, use_mmap>::throw_bad_alloc(
         const std::string& err) const {
@@ -77,6 +77,9 @@ static constexpr size_t CHUNK_THRESHOLD = 4096;
 static constexpr size_t MMAP_MIN_ALIGNMENT = 4096;
 static constexpr size_t MALLOC_MIN_ALIGNMENT = 8;
 
+// The size of the transparent huge pages on x86_64 and most aarch64 kernels.
+static constexpr size_t HUGE_PAGE_SIZE = 2 * 1024 * 1024;
+
 // The memory for __int128 should be aligned to 16 bytes.
 // By the way, in 64-bit system, the address of a block returned by malloc or realloc in GNU systems
 // is always a multiple of sixteen. (https://www.gnu.org/software/libc/manual/html_node/Aligned-Memory-Blocks.html)
@@ -105,12 +108,30 @@ public:
     void release_memory(size_t size) const;
     void throw_bad_alloc(const std::string& err) const;
 
+    // The large allocations, e.g. of hash tables, are mmapped so that they can be backed by
+    // huge pages to reduce the TLB misses of random access.
+    static bool use_huge_page(size_t size) {
+        return use_mmap && doris::config::enable_huge_page_alloc &&
+               size >= std::max<size_t>(HUGE_PAGE_SIZE, doris::config::huge_page_alloc_threshold);
+    }
+
+    static bool is_mmapped(size_t size) {
+        return use_mmap && (size >= doris::config::mmap_threshold || use_huge_page(size));
+    }
+
+    // mmap the memory aligned to huge pages and advise the kernel to back it by huge pages,
+    // returns MAP_FAILED if failed.
+    void* mmap_huge_page(size_t size) const;
+    // advise the huge pages for the memory range remapped from old_size to new_size
+    void remap_huge_page(void* buf, size_t old_size, size_t new_size) const;
+    void munmap_huge_page(size_t size) const;
+
     /// Allocate memory range.
     void* alloc(size_t size, size_t alignment = 0) {
         memory_check(size);
         void* buf;
 
-        if (size >= doris::config::mmap_threshold && use_mmap) {
+        if (is_mmapped(size)) {
             if (alignment > MMAP_MIN_ALIGNMENT)
                 throw doris::Exception(
                         doris::ErrorCode::INVALID_ARGUMENT,
@@ -118,7 +139,11 @@ public:
                         alignment, size);
 
             consume_memory(size);
-            buf = mmap(nullptr, size, PROT_READ | PROT_WRITE, mmap_flags, -1, 0);
+            if (use_huge_page(size)) {
+                buf = mmap_huge_page(size);
+            } else {
+                buf = mmap(nullptr, size, PROT_READ | PROT_WRITE, mmap_flags, -1, 0);
+            }
             if (MAP_FAILED == buf) {
                 release_memory(size);
                 throw_bad_alloc(fmt::format("Allocator: Cannot mmap {}.", size));
@@ -159,11 +184,14 @@ public:
 
     /// Free memory range.
     void free(void* buf, size_t size) {
-        if (size >= doris::config::mmap_threshold && use_mmap) {
+        if (is_mmapped(size)) {
             if (0 != munmap(buf, size)) {
                 throw_bad_alloc(fmt::format("Allocator: Cannot munmap {}.", size));
             } else {
                 release_memory(size);
+                if (use_huge_page(size)) {
+                    munmap_huge_page(size);
+                }
             }
         } else if (!doris::config::disable_chunk_allocator_in_vec && size >= CHUNK_THRESHOLD &&
                    ((size & (size - 1)) == 0)) {
@@ -202,8 +230,8 @@ public:
             if constexpr (clear_memory)
                 if (new_size > old_size)
                     memset(reinterpret_cast<char*>(buf) + old_size, 0, new_size - old_size);
-        } else if (old_size >= doris::config::mmap_threshold &&
-                   new_size >= doris::config::mmap_threshold && use_mmap) {
+        } else if (is_mmapped(old_size) && is_mmapped(new_size) &&
+                   use_huge_page(old_size) == use_huge_page(new_size)) {
             memory_check(new_size);
             /// Resize mmap'd memory region.
             consume_memory(new_size - old_size);
@@ -218,6 +246,10 @@ public:
 
             /// No need for zero-fill, because mmap guarantees it.
 
+            if (use_huge_page(new_size)) {
+                remap_huge_page(buf, old_size, new_size);
+            }
+
             if constexpr (mmap_populate) {
                 // MAP_POPULATE seems have no effect for mremap as for mmap,
                 // Clear enlarged memory range explicitly to pre-fault the pages
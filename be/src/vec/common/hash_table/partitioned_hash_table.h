@@ -548,7 +548,34 @@ public:
     }
 
     bool add_elem_size_overflow(size_t row) const {
-        return !_is_partitioned && level0_sub_table.add_elem_size_overflow(row);
+        if (_is_partitioned) {
+            // the rows are assumed to be spread evenly over the sub tables
+            for (size_t i = 0; i < NUM_LEVEL1_SUB_TABLES; ++i) {
+                if (level1_sub_tables[i].add_elem_size_overflow(row / NUM_LEVEL1_SUB_TABLES)) {
+                    return true;
+                }
+            }
+            return false;
+        } else {
+            return level0_sub_table.add_elem_size_overflow(row);
+        }
+    }
+
+    /// The count of the level1 sub tables, which could be filled by different threads concurrently
+    /// as long as every sub table is only accessed by one thread.
+    static constexpr size_t get_sub_table_count() { return NUM_LEVEL1_SUB_TABLES; }
+
+    /// Make sure all the following inserts go to the level1 sub tables, it is required before
+    /// emplacing disjoint sub tables in parallel, since the conversion is not thread safe.
+    void ensure_partitioned() {
+        if (!_is_partitioned) {
+            convert_to_partitioned();
+        }
+    }
+
+    /// NOTE Bad for hash tables with more than 2^32 cells.
+    static size_t get_sub_table_from_hash(size_t hash_value) {
+        return (hash_value >> (32 - BITS_FOR_SUB_TABLE)) & MAX_SUB_TABLE;
     }
 
 private:
@@ -587,9 +614,4 @@ private:
         _is_partitioned = true;
         level0_sub_table.clear_and_shrink();
     }
-
-    /// NOTE Bad for hash tables with more than 2^32 cells.
-    static size_t get_sub_table_from_hash(size_t hash_value) {
-        return (hash_value >> (32 - BITS_FOR_SUB_TABLE)) & MAX_SUB_TABLE;
-    }
 };
@@ -21,6 +21,7 @@
 
 #include <boost/noncopyable.hpp>
 
+#include "util/runtime_profile.h"
 #include "vec/common/hash_table/hash.h"
 #include "vec/common/hash_table/hash_table_utils.h"
 #include "vec/common/hash_table/phmap_fwd_decl.h"
@@ -60,6 +61,7 @@ public:
         _hash_map = std::move(rhs._hash_map);
         std::swap(_need_partition, rhs._need_partition);
         std::swap(_partitioned_threshold, rhs._partitioned_threshold);
+        std::swap(_resize_timer_ns, rhs._resize_timer_ns);
 
         return *this;
     }
@@ -132,7 +134,7 @@ public:
         it = &*_hash_map.lazy_emplace(key, [&](const auto& ctor) {
             inserted = true;
             key_holder_persist_key(key_holder);
-            ctor(key_holder_get_key(key_holder), nullptr);
+            ctor(key_holder_get_key(key_holder), Mapped());
         });
 
         if constexpr (PartitionedHashTable) {
@@ -161,7 +163,7 @@ public:
         it = &*_hash_map.lazy_emplace_with_hash(key, hash_value, [&](const auto& ctor) {
             inserted = true;
             key_holder_persist_key(key_holder);
-            ctor(key, nullptr);
+            ctor(key, Mapped());
         });
 
         if constexpr (PartitionedHashTable) {
@@ -169,6 +171,12 @@ public:
         }
     }
 
+    template <typename KeyHolder>
+    void ALWAYS_INLINE emplace(KeyHolder&& key_holder, LookupResult& it, bool& inserted,
+                               size_t hash_value) {
+        emplace(key_holder, it, hash_value, inserted);
+    }
+
     template <typename KeyHolder, typename Func>
     void ALWAYS_INLINE lazy_emplace(KeyHolder&& key_holder, LookupResult& it, size_t hash_value,
                                     Func&& f) {
@@ -208,8 +216,23 @@ public:
 
     void ALWAYS_INLINE prefetch_by_hash(size_t hash_value) { _hash_map.prefetch_hash(hash_value); }
 
+    template <bool READ>
+    void ALWAYS_INLINE prefetch_by_hash(size_t hash_value) {
+        _hash_map.prefetch_hash(hash_value);
+    }
+
     void ALWAYS_INLINE prefetch_by_key(Key key) { _hash_map.prefetch(key); }
 
+    template <typename KeyHolder>
+    void ALWAYS_INLINE prefetch(KeyHolder& key_holder) {
+        _hash_map.prefetch(key_holder_get_key(key_holder));
+    }
+
+    template <bool READ, typename KeyHolder>
+    void ALWAYS_INLINE prefetch(KeyHolder& key_holder) {
+        _hash_map.prefetch(key_holder_get_key(key_holder));
+    }
+
     /// Call func(const Key &, Mapped &) for each hash map element.
     template <typename Func>
     void for_each_value(Func&& func) {
@@ -237,6 +260,42 @@ public:
 
     size_t size() const { return _hash_map.size(); }
 
+    /// The count of the rows referenced by the mapped row lists, used by the hash join.
+    size_t get_size() {
+        size_t count = 0;
+        for (auto& v : *this) {
+            count += v.get_second().get_row_count();
+        }
+        return count;
+    }
+
+    void expanse_for_add_elem(size_t num_elem) {
+        if (add_elem_size_overflow(num_elem)) {
+            if (check_if_need_partition(_hash_map.size() + num_elem)) {
+                _need_partition = true;
+                return;
+            }
+            SCOPED_RAW_TIMER(&_resize_timer_ns);
+            _hash_map.reserve(_hash_map.size() + num_elem);
+        }
+    }
+
+    void init_buf_size(size_t reserve_for_num_elements) {
+        _hash_map.clear();
+        _hash_map.reserve(reserve_for_num_elements);
+    }
+
+    bool should_be_shrink(int64_t valid_row) const {
+        return valid_row < 7.0 / 8 * (size() / 2.0);
+    }
+
+    /// The zero key is stored as the other keys, nothing to do.
+    void delete_zero_key(Key) {}
+
+    /// Only the time of expanse_for_add_elem is counted, phmap resizes itself on inserting.
+    void reset_resize_timer() { _resize_timer_ns = 0; }
+    int64_t get_resize_timer_value() const { return _resize_timer_ns; }
+
     char* get_null_key_data() { return nullptr; }
     bool has_null_key_data() const { return false; }
 
@@ -271,7 +330,8 @@ private:
     // if need resize and bucket count after resize will be >= _partitioned_threshold,
     // this flag is set to true, and resize does not actually happen,
     // PartitionedHashTable will convert this hash table to partitioned hash table
-    bool _need_partition;
+    bool _need_partition = false;
+    int64_t _resize_timer_ns = 0;
 };
 
 template <typename Key, typename Mapped, typename Hash, bool PartitionedHashTable>
@@ -372,4 +372,29 @@ int32_t LocalSchemaChangeRecorder::schema_version() {
     return _schema_version;
 }
 
+Status LocalSchemaChangeRecorder::fetch_base_schema_view(const std::vector<std::string>& paths,
+                                                         FullBaseSchemaView* schema_view) {
+    std::shared_ptr<const FullBaseSchemaView> cached;
+    {
+        std::lock_guard<std::mutex> lock(_lock);
+        cached = _base_schema_view;
+    }
+    if (cached != nullptr &&
+        std::all_of(paths.begin(), paths.end(), [&](const std::string& path) {
+            return cached->column_name_to_column.find(path) !=
+                   cached->column_name_to_column.end();
+        })) {
+        schema_view->column_name_to_column = cached->column_name_to_column;
+        schema_view->schema_version = cached->schema_version;
+        return Status::OK();
+    }
+    RETURN_IF_ERROR(send_fetch_full_base_schema_view_rpc(schema_view));
+    std::lock_guard<std::mutex> lock(_lock);
+    if (_base_schema_view == nullptr ||
+        _base_schema_view->schema_version <= schema_view->schema_version) {
+        _base_schema_view = FullBaseSchemaView::create_shared(*schema_view);
+    }
+    return Status::OK();
+}
+
 } // namespace doris::vectorized::schema_util
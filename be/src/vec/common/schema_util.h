@@ -23,8 +23,10 @@
 #include <stdint.h>
 
 #include <map>
+#include <memory>
 #include <mutex>
 #include <string>
+#include <vector>
 
 #include "common/status.h"
 #include "olap/tablet_schema.h"
@@ -111,10 +113,17 @@ public:
     const TabletColumn& column(const std::string& col_name);
     int32_t schema_version();
 
+    // Sets the full base schema view of the table. The view fetched by a flush of the load is
+    // reused by the next flushes, it is fetched again only if one of the subcolumn paths to flush
+    // is not in it, e.g. added by the load after the last fetch.
+    Status fetch_base_schema_view(const std::vector<std::string>& paths,
+                                  FullBaseSchemaView* schema_view);
+
 private:
     std::mutex _lock;
     int32_t _schema_version = -1;
     std::map<std::string, TabletColumn> _extended_columns;
+    std::shared_ptr<const FullBaseSchemaView> _base_schema_view;
 };
 
 } // namespace  doris::vectorized::schema_util
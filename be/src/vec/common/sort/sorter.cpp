@@ -26,10 +26,12 @@
 #include <string>
 #include <utility>
 
+#include "common/config.h"
 #include "common/object_pool.h"
 #include "runtime/block_spill_manager.h"
 #include "runtime/exec_env.h"
 #include "runtime/thread_context.h"
+#include "util/countdown_latch.h"
 #include "vec/columns/column.h"
 #include "vec/columns/column_nullable.h"
 #include "vec/core/block_spill_reader.h"
@@ -71,9 +73,12 @@ Status MergeSorterState::add_sorted_block(Block& block) {
 
     auto bytes_used = data_size();
     auto total_bytes_used = bytes_used + block.bytes();
+    // expect the next sorted block is as large as this one
     if (is_spilled_ || (external_sort_bytes_threshold_ > 0 &&
-                        total_bytes_used >= external_sort_bytes_threshold_)) {
+                        (total_bytes_used >= external_sort_bytes_threshold_ ||
+                         !reservation_.try_resize(block.bytes())))) {
         is_spilled_ = true;
+        reservation_.release();
         BlockSpillWriterUPtr spill_block_writer;
         RETURN_IF_ERROR(ExecEnv::GetInstance()->block_spill_mgr()->get_writer(
                 spill_block_batch_size_, spill_block_writer, block_spill_profile_));
@@ -107,6 +112,7 @@ void MergeSorterState::_build_merge_tree_not_spilled(const SortDescription& sort
 }
 
 Status MergeSorterState::build_merge_tree(const SortDescription& sort_description) {
+    reservation_.release();
     _build_merge_tree_not_spilled(sort_description);
 
     if (spilled_sorted_block_streams_.size() > 0) {
@@ -136,9 +142,169 @@ Status MergeSorterState::build_merge_tree(const SortDescription& sort_descriptio
     return Status::OK();
 }
 
+bool MergeSorterState::should_merge_in_parallel() const {
+    return !is_spilled_ && limit_ < 0 && offset_ == 0 && sorted_blocks_.size() > 1 &&
+           config::parallel_sort_merge_threads > 1 &&
+           num_rows_ >= config::parallel_sort_merge_min_rows;
+}
+
+Status MergeSorterState::merge_in_parallel(RuntimeState* state,
+                                           const SortDescription& sort_description) {
+    SCOPED_TIMER(parallel_merge_timer_);
+    for (const auto& block : sorted_blocks_) {
+        cursors_.emplace_back(block, sort_description);
+    }
+    const int num_partitions = config::parallel_sort_merge_threads;
+    auto bounds = _split_partitions(num_partitions);
+    merged_partitions_.resize(num_partitions);
+
+    std::vector<Status> partition_status(num_partitions);
+    auto merge_partition = [&](int partition) -> Status {
+        RETURN_IF_CATCH_EXCEPTION(_merge_partition(bounds, partition));
+        return Status::OK();
+    };
+    {
+        CountDownLatch latch(num_partitions - 1);
+        for (int i = 1; i < num_partitions; ++i) {
+            auto st = ExecEnv::GetInstance()->join_node_thread_pool()->submit_func([&, i] {
+                SCOPED_ATTACH_TASK(state);
+                partition_status[i] = merge_partition(i);
+                latch.count_down();
+            });
+            if (!st.ok()) {
+                // Fall back to merging the partition in the current thread.
+                partition_status[i] = merge_partition(i);
+                latch.count_down();
+            }
+        }
+        partition_status[0] = merge_partition(0);
+        latch.wait();
+    }
+    for (auto& st : partition_status) {
+        RETURN_IF_ERROR(st);
+    }
+
+    merged_in_parallel_ = true;
+    cursors_.clear();
+    sorted_blocks_.clear();
+    return Status::OK();
+}
+
+std::vector<std::vector<size_t>> MergeSorterState::_split_partitions(int num_partitions) {
+    struct RowPosition {
+        size_t block;
+        size_t row;
+    };
+    auto compare = [&](const RowPosition& lhs, const RowPosition& rhs) {
+        return MergeSortCursor(&cursors_[lhs.block])
+                .greater_at(MergeSortCursor(&cursors_[rhs.block]), lhs.row, rhs.row);
+    };
+
+    // Sample evenly from every sorted block, so the splitters follow the distribution of
+    // all the rows, and the partitions are about the same size.
+    static constexpr size_t SAMPLES_PER_PARTITION = 32;
+    std::vector<RowPosition> samples;
+    for (size_t i = 0; i < cursors_.size(); ++i) {
+        size_t rows = cursors_[i].rows;
+        size_t step = std::max<size_t>(1, rows / (SAMPLES_PER_PARTITION * num_partitions));
+        for (size_t row = step / 2; row < rows; row += step) {
+            samples.push_back({i, row});
+        }
+    }
+    std::sort(samples.begin(), samples.end(), [&](const RowPosition& lhs, const RowPosition& rhs) {
+        return compare(lhs, rhs) < 0;
+    });
+
+    // The rows equal to a splitter go to the partition after it, in all the blocks.
+    std::vector<std::vector<size_t>> bounds(cursors_.size(),
+                                            std::vector<size_t>(num_partitions + 1, 0));
+    for (size_t i = 0; i < cursors_.size(); ++i) {
+        bounds[i][num_partitions] = cursors_[i].rows;
+        for (int partition = 1; partition < num_partitions; ++partition) {
+            const auto& splitter = samples[partition * samples.size() / num_partitions];
+            size_t low = bounds[i][partition - 1];
+            size_t high = cursors_[i].rows;
+            while (low < high) {
+                size_t mid = low + (high - low) / 2;
+                if (compare({i, mid}, splitter) < 0) {
+                    low = mid + 1;
+                } else {
+                    high = mid;
+                }
+            }
+            bounds[i][partition] = low;
+        }
+    }
+    return bounds;
+}
+
+void MergeSorterState::_merge_partition(const std::vector<std::vector<size_t>>& bounds,
+                                        int partition) {
+    std::vector<MergeSortCursorImpl> cursors;
+    cursors.reserve(cursors_.size());
+    for (size_t i = 0; i < cursors_.size(); ++i) {
+        if (bounds[i][partition] < bounds[i][partition + 1]) {
+            cursors.push_back(cursors_[i]);
+            cursors.back().pos = bounds[i][partition];
+            cursors.back().rows = bounds[i][partition + 1];
+        }
+    }
+    std::priority_queue<MergeSortCursor> queue;
+    for (auto& cursor : cursors) {
+        queue.push(MergeSortCursor(&cursor));
+    }
+
+    size_t num_columns = sorted_blocks_[0].columns();
+    auto& merged_blocks = merged_partitions_[partition];
+    while (!queue.empty()) {
+        MutableColumns merged_columns = sorted_blocks_[0].clone_empty_columns();
+        size_t merged_rows = 0;
+        while (!queue.empty() && merged_rows < batch_size_) {
+            auto current = queue.top();
+            if (queue.size() == 1) {
+                // the rest of the only cursor left are in order already
+                size_t length = std::min(batch_size_ - merged_rows, current->rows - current->pos);
+                for (size_t i = 0; i < num_columns; ++i) {
+                    merged_columns[i]->insert_range_from(*current->all_columns[i], current->pos,
+                                                         length);
+                }
+                merged_rows += length;
+                current->pos += length;
+                if (current->pos >= current->rows) {
+                    queue.pop();
+                }
+                continue;
+            }
+            queue.pop();
+            for (size_t i = 0; i < num_columns; ++i) {
+                merged_columns[i]->insert_from(*current->all_columns[i], current->pos);
+            }
+            ++merged_rows;
+            if (!current->isLast()) {
+                current->next();
+                queue.push(current);
+            }
+        }
+        merged_blocks.emplace_back(sorted_blocks_[0].clone_with_columns(std::move(merged_columns)));
+    }
+}
+
 Status MergeSorterState::merge_sort_read(doris::RuntimeState* state,
                                          doris::vectorized::Block* block, bool* eos) {
-    if (is_spilled_) {
+    if (merged_in_parallel_) {
+        while (read_partition_ < merged_partitions_.size() &&
+               read_block_ >= merged_partitions_[read_partition_].size()) {
+            // release the partition read out
+            merged_partitions_[read_partition_].clear();
+            ++read_partition_;
+            read_block_ = 0;
+        }
+        if (read_partition_ == merged_partitions_.size()) {
+            *eos = true;
+        } else {
+            block->swap(merged_partitions_[read_partition_][read_block_++]);
+        }
+    } else if (is_spilled_) {
         RETURN_IF_ERROR(merger_->get_next(block, eos));
     } else {
         if (sorted_blocks_.empty()) {
@@ -313,7 +479,8 @@ FullSorter::FullSorter(VSortExecExprs& vsort_exec_exprs, int limit, int64_t offs
                        std::vector<bool>& nulls_first, const RowDescriptor& row_desc,
                        RuntimeState* state, RuntimeProfile* profile)
         : Sorter(vsort_exec_exprs, limit, offset, pool, is_asc_order, nulls_first),
-          _state(MergeSorterState::create_unique(row_desc, offset, limit, state, profile)) {}
+          _state(MergeSorterState::create_unique(row_desc, offset, limit, state, profile)),
+          _runtime_state(state) {}
 
 Status FullSorter::append_block(Block* block) {
     DCHECK(block->rows() > 0);
@@ -342,6 +509,9 @@ Status FullSorter::prepare_for_read() {
     if (_state->unsorted_block_->rows() > 0) {
         RETURN_IF_ERROR(_do_sort());
     }
+    if (_state->should_merge_in_parallel()) {
+        return _state->merge_in_parallel(_runtime_state, _sort_description);
+    }
     return _state->build_merge_tree(_sort_description);
 }
 
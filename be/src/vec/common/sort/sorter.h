@@ -26,6 +26,7 @@
 #include <vector>
 
 #include "common/status.h"
+#include "runtime/memory/mem_reservation.h"
 #include "runtime/runtime_state.h"
 #include "util/runtime_profile.h"
 #include "vec/common/sort/vsort_exec_exprs.h"
@@ -60,6 +61,10 @@ public:
               limit_(limit),
               profile_(profile) {
         external_sort_bytes_threshold_ = state->external_sort_bytes_threshold();
+        if (external_sort_bytes_threshold_ > 0) {
+            reservation_.init(state->query_mem_tracker());
+        }
+        batch_size_ = state->batch_size();
         if (profile != nullptr) {
             block_spill_profile_ = profile->create_child("BlockSpill", true, true);
             profile->add_child(block_spill_profile_, false, nullptr);
@@ -67,6 +72,7 @@ public:
             spilled_block_count_ = ADD_COUNTER(block_spill_profile_, "BlockCount", TUnit::UNIT);
             spilled_original_block_size_ =
                     ADD_COUNTER(block_spill_profile_, "BlockBytes", TUnit::BYTES);
+            parallel_merge_timer_ = ADD_TIMER(profile, "ParallelMergeTime");
         }
     }
 
@@ -76,6 +82,16 @@ public:
 
     Status build_merge_tree(const SortDescription& sort_description);
 
+    // Whether the sorted blocks are so many rows in memory that merging them on one thread
+    // is too slow, and there is no limit which could stop the merge early.
+    bool should_merge_in_parallel() const;
+
+    // Instead of build_merge_tree, split the sorted blocks into the ranges between splitters
+    // sampled from the blocks, merge the ranges concurrently, and let merge_sort_read return
+    // the merged ranges one by one in order. The merged ranges take as much memory again as
+    // the sorted blocks, which are released after the merge.
+    Status merge_in_parallel(RuntimeState* state, const SortDescription& sort_description);
+
     Status merge_sort_read(doris::RuntimeState* state, doris::vectorized::Block* block, bool* eos);
 
     size_t data_size() const {
@@ -83,6 +99,11 @@ public:
         for (const auto& block : sorted_blocks_) {
             size += block.allocated_bytes();
         }
+        for (const auto& blocks : merged_partitions_) {
+            for (const auto& block : blocks) {
+                size += block.allocated_bytes();
+            }
+        }
         return size;
     }
 
@@ -109,6 +130,11 @@ private:
 
     Status _create_intermediate_merger(int num_blocks, const SortDescription& sort_description);
 
+    // the first row of every sorted block in each partition, plus the end of the blocks
+    std::vector<std::vector<size_t>> _split_partitions(int num_partitions);
+
+    void _merge_partition(const std::vector<std::vector<size_t>>& bounds, int partition);
+
     std::priority_queue<MergeSortCursor> priority_queue_;
     std::vector<MergeSortCursorImpl> cursors_;
     std::vector<Block> sorted_blocks_;
@@ -120,6 +146,8 @@ private:
     size_t avg_row_bytes_ = 0;
     int spill_block_batch_size_ = 0;
     int64_t external_sort_bytes_threshold_;
+    // reserved for the next sorted block, the blocks are spilled if denied
+    MemReservation reservation_;
 
     bool is_spilled_ = false;
     bool init_merge_sorted_block_ = true;
@@ -128,10 +156,18 @@ private:
     Block merge_sorted_block_;
     std::unique_ptr<VSortedRunMerger> merger_;
 
+    size_t batch_size_;
+    bool merged_in_parallel_ = false;
+    // the merged blocks of every partition, read one by one
+    std::vector<std::vector<Block>> merged_partitions_;
+    size_t read_partition_ = 0;
+    size_t read_block_ = 0;
+
     RuntimeProfile* profile_;
     RuntimeProfile* block_spill_profile_;
     RuntimeProfile::Counter* spilled_block_count_;
     RuntimeProfile::Counter* spilled_original_block_size_;
+    RuntimeProfile::Counter* parallel_merge_timer_ = nullptr;
 };
 
 class Sorter {
@@ -214,6 +250,7 @@ private:
     Status _do_sort();
 
     std::unique_ptr<MergeSorterState> _state;
+    RuntimeState* _runtime_state;
 
     static constexpr size_t INITIAL_BUFFERED_BLOCK_SIZE = 1024 * 1024;
     static constexpr size_t INITIAL_BUFFERED_BLOCK_BYTES = 64 << 20;
@@ -180,6 +180,32 @@ private:
         if (needle == needle_end) return haystack;
 
         const auto needle_size = needle_end - needle;
+#if defined(__AVX2__)
+        /// Filter 32 positions at a time by the first and the last characters of needle, which
+        /// are less likely to match together than the first two, then compare the middle ones.
+        /// The loads never pass haystack_end, the tail is left to the paths below.
+        if (needle_size >= 2) {
+            const auto v_first = _mm256_set1_epi8(first);
+            const auto v_last = _mm256_set1_epi8(needle[needle_size - 1]);
+            while (haystack + needle_size - 1 + sizeof(__m256i) <= haystack_end) {
+                const auto v_haystack_first =
+                        _mm256_loadu_si256(reinterpret_cast<const __m256i*>(haystack));
+                const auto v_haystack_last = _mm256_loadu_si256(
+                        reinterpret_cast<const __m256i*>(haystack + needle_size - 1));
+                uint32_t mask = _mm256_movemask_epi8(
+                        _mm256_and_si256(_mm256_cmpeq_epi8(v_haystack_first, v_first),
+                                         _mm256_cmpeq_epi8(v_haystack_last, v_last)));
+                while (mask != 0) {
+                    const auto offset = __builtin_ctz(mask);
+                    if (memcmp(haystack + offset + 1, needle + 1, needle_size - 2) == 0) {
+                        return haystack + offset;
+                    }
+                    mask &= mask - 1;
+                }
+                haystack += sizeof(__m256i);
+            }
+        }
+#endif
 #if defined(__SSE4_1__) || defined(__aarch64__)
         /// Here is the quick path when needle_size is 1.
         if (needle_size == 1) {
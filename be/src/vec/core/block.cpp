@@ -51,6 +51,7 @@
 #include "vec/columns/column_vector.h"
 #include "vec/columns/columns_number.h"
 #include "vec/common/assert_cast.h"
+#include "vec/core/column_pool.h"
 #include "vec/data_types/data_type_factory.hpp"
 
 class SipHash;
@@ -521,8 +522,13 @@ std::string Block::dump_structure() const {
 
 Block Block::clone_empty() const {
     Block res;
+    auto* pool = ColumnPool::current();
     for (const auto& elem : data) {
-        res.insert(elem.clone_empty());
+        if (pool != nullptr && elem.column && elem.type) {
+            res.insert({pool->clone_empty(*elem.column, elem.type), elem.type, elem.name});
+        } else {
+            res.insert(elem.clone_empty());
+        }
     }
     return res;
 }
@@ -530,8 +536,15 @@ Block Block::clone_empty() const {
 MutableColumns Block::clone_empty_columns() const {
     size_t num_columns = data.size();
     MutableColumns columns(num_columns);
+    auto* pool = ColumnPool::current();
     for (size_t i = 0; i < num_columns; ++i) {
-        columns[i] = data[i].column ? data[i].column->clone_empty() : data[i].type->create_column();
+        if (pool != nullptr) {
+            columns[i] = data[i].column ? pool->clone_empty(*data[i].column, data[i].type)
+                                        : pool->take(data[i].type);
+        } else {
+            columns[i] = data[i].column ? data[i].column->clone_empty()
+                                        : data[i].type->create_column();
+        }
     }
     return columns;
 }
@@ -548,9 +561,13 @@ Columns Block::get_columns() const {
 MutableColumns Block::mutate_columns() {
     size_t num_columns = data.size();
     MutableColumns columns(num_columns);
+    auto* pool = ColumnPool::current();
     for (size_t i = 0; i < num_columns; ++i) {
-        columns[i] = data[i].column ? (*std::move(data[i].column)).assume_mutable()
-                                    : data[i].type->create_column();
+        if (data[i].column) {
+            columns[i] = (*std::move(data[i].column)).assume_mutable();
+        } else {
+            columns[i] = pool != nullptr ? pool->take(data[i].type) : data[i].type->create_column();
+        }
     }
     return columns;
 }
@@ -647,6 +664,11 @@ DataTypes Block::get_data_types() const {
 }
 
 void Block::clear() {
+    if (auto* pool = ColumnPool::current(); pool != nullptr) {
+        for (auto& d : data) {
+            pool->give_back(std::move(d.column), d.type);
+        }
+    }
     data.clear();
     index_by_name.clear();
     row_same_bit.clear();
@@ -656,7 +678,11 @@ void Block::clear_column_data(int column_size) noexcept {
     // data.size() greater than column_size, means here have some
     // function exec result in block, need erase it here
     if (column_size != -1 and data.size() > column_size) {
+        auto* pool = ColumnPool::current();
         for (int i = data.size() - 1; i >= column_size; --i) {
+            if (pool != nullptr) {
+                pool->give_back(std::move(data[i].column), data[i].type);
+            }
             erase(i);
         }
     }
@@ -819,7 +845,8 @@ Status Block::serialize(int be_exec_version, PBlock* pblock,
     *uncompressed_bytes = content_uncompressed_size;
 
     // compress
-    if (config::compress_rowbatches && content_uncompressed_size > 0) {
+    if (config::compress_rowbatches && content_uncompressed_size > 0 &&
+        compression_type != segment_v2::CompressionTypePB::NO_COMPRESSION) {
         SCOPED_RAW_TIMER(&_compress_time_ns);
         pblock->set_compression_type(compression_type);
         pblock->set_uncompressed_size(content_uncompressed_size);
@@ -861,7 +888,9 @@ MutableBlock::MutableBlock(const std::vector<TupleDescriptor*>& tuple_descs, int
                 continue;
             }
             _data_types.emplace_back(slot_desc->get_data_type_ptr());
-            _columns.emplace_back(_data_types.back()->create_column());
+            auto* pool = ColumnPool::current();
+            _columns.emplace_back(pool != nullptr ? pool->take(_data_types.back())
+                                                  : _data_types.back()->create_column());
             if (reserve_size != 0) {
                 _columns.back()->reserve(reserve_size);
             }
@@ -150,9 +150,10 @@ Status BlockSpillReader::close() {
     if (!file_reader_) {
         return Status::OK();
     }
-    ExecEnv::GetInstance()->block_spill_mgr()->remove(stream_id_);
     file_reader_.reset();
+    // a stream not deleted may be read again
     if (delete_after_read_) {
+        ExecEnv::GetInstance()->block_spill_mgr()->remove(stream_id_);
         io::global_local_filesystem()->delete_file(file_path_);
     }
     return Status::OK();
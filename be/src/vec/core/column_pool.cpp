@@ -0,0 +1,87 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+
+#include "vec/core/column_pool.h"
+
+#include <utility>
+
+namespace doris::vectorized {
+
+thread_local ColumnPool* ColumnPool::_current = nullptr;
+
+ColumnPool::Entry& ColumnPool::_get_entry(const DataTypePtr& type) {
+    auto [it, inserted] = _entries.try_emplace(type.get());
+    if (inserted) {
+        it->second.type = type;
+        // an empty column holds no buffers, so it is cheap to create
+        auto column = type->create_column();
+        it->second.column_type = &typeid(*column);
+    }
+    return it->second;
+}
+
+MutableColumnPtr ColumnPool::_pop(Entry& entry) {
+    auto column = std::move(entry.columns.back());
+    entry.columns.pop_back();
+    _pooled_bytes -= column->allocated_bytes();
+    ++_hit_count;
+    return column;
+}
+
+MutableColumnPtr ColumnPool::take(const DataTypePtr& type) {
+    auto& entry = _get_entry(type);
+    if (!entry.columns.empty()) {
+        return _pop(entry);
+    }
+    ++_miss_count;
+    return type->create_column();
+}
+
+MutableColumnPtr ColumnPool::clone_empty(const IColumn& column, const DataTypePtr& type) {
+    auto& entry = _get_entry(type);
+    if (!entry.columns.empty() && typeid(column) == *entry.column_type) {
+        return _pop(entry);
+    }
+    ++_miss_count;
+    return column.clone_empty();
+}
+
+void ColumnPool::give_back(ColumnPtr&& column, const DataTypePtr& type) {
+    if (column == nullptr || type == nullptr || column->use_count() != 1) {
+        return;
+    }
+    auto& entry = _get_entry(type);
+    if (entry.columns.size() >= MAX_COLUMNS_PER_TYPE || typeid(*column) != *entry.column_type) {
+        return;
+    }
+    auto mutable_column = IColumn::mutate(std::move(column));
+    mutable_column->clear();
+    size_t bytes = mutable_column->allocated_bytes();
+    if (_pooled_bytes + bytes > _max_bytes) {
+        return;
+    }
+    _pooled_bytes += bytes;
+    entry.columns.emplace_back(std::move(mutable_column));
+}
+
+void ColumnPool::clear() {
+    _entries.clear();
+    _pooled_bytes = 0;
+}
+
+} // namespace doris::vectorized
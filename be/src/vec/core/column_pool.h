@@ -0,0 +1,101 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+
+#pragma once
+
+#include <parallel_hashmap/phmap.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include <typeinfo>
+#include <vector>
+
+#include "vec/columns/column.h"
+#include "vec/data_types/data_type.h"
+
+namespace doris::vectorized {
+
+// A pool of the empty columns of a pipeline task. The columns dropped by
+// Block::clear_column_data and Block::clear are cleared and kept with their capacity, and
+// handed out again when the next batch builds its columns by Block::mutate_columns,
+// Block::clone_empty and so on, so a steady state query allocates nearly nothing per block.
+//
+// The pool is only used by the thread which attaches it by ColumnPool::ScopedAttach, the
+// blocks built or cleared in other threads are not affected.
+class ColumnPool {
+public:
+    // keep at most this number of columns of a data type
+    static constexpr size_t MAX_COLUMNS_PER_TYPE = 8;
+
+    explicit ColumnPool(size_t max_bytes) : _max_bytes(max_bytes) {}
+    ~ColumnPool() = default;
+
+    ColumnPool(const ColumnPool&) = delete;
+    ColumnPool& operator=(const ColumnPool&) = delete;
+
+    // the pool attached to the current thread, nullptr if none
+    static ColumnPool* current() { return _current; }
+
+    // an empty column of the type, whose buffers may be recycled ones
+    MutableColumnPtr take(const DataTypePtr& type);
+
+    // an empty column like the column of the type, e.g. for Block::clone_empty
+    MutableColumnPtr clone_empty(const IColumn& column, const DataTypePtr& type);
+
+    // Keep the buffers of the column for the later take of the type. The column is ignored
+    // if it is shared with others or not created by the type, e.g. a const column.
+    void give_back(ColumnPtr&& column, const DataTypePtr& type);
+
+    // free all the kept columns
+    void clear();
+
+    int64_t hit_count() const { return _hit_count; }
+    int64_t miss_count() const { return _miss_count; }
+    size_t pooled_bytes() const { return _pooled_bytes; }
+
+    class ScopedAttach {
+    public:
+        explicit ScopedAttach(ColumnPool* pool) : _prev(_current) { _current = pool; }
+        ~ScopedAttach() { _current = _prev; }
+
+    private:
+        ColumnPool* _prev;
+    };
+
+private:
+    struct Entry {
+        // holds the data type so that its address is not reused by another one
+        DataTypePtr type;
+        const std::type_info* column_type = nullptr;
+        std::vector<MutableColumnPtr> columns;
+    };
+
+    Entry& _get_entry(const DataTypePtr& type);
+    MutableColumnPtr _pop(Entry& entry);
+
+    static thread_local ColumnPool* _current;
+
+    const size_t _max_bytes;
+    size_t _pooled_bytes = 0;
+    int64_t _hit_count = 0;
+    int64_t _miss_count = 0;
+    // keyed by the address of the data type, which avoids building the name of the type
+    phmap::flat_hash_map<const IDataType*, Entry> _entries;
+};
+
+} // namespace doris::vectorized
@@ -0,0 +1,191 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <glog/logging.h>
+#include <stddef.h>
+
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+namespace doris::vectorized {
+
+// Tournament tree of losers for K-way merge. Every internal node keeps the loser of the match
+// between the winners of its two subtrees, so restoring the tree after the winner moves to its
+// next row replays only the path from its leaf to the root, which is log K comparisons instead
+// of about 2 * log K of a binary heap.
+//
+// Merged inputs are usually made of long runs from one child, so the tree also keeps the
+// runner-up, the best of the losers on the path of the winner, once the winner wins twice in
+// a row. As long as the winner does not go after the runner-up it still wins every match on
+// its path, then restoring the tree costs one comparison. The runner-up is also exposed to let
+// the caller find the whole run of the winner and copy it as a row range.
+//
+// `Compare` has the same meaning as the one of std::priority_queue: compare(a, b) returns
+// true if a goes after b, so the comparators of the merge heaps can be used as is. Some of them
+// mark the row which goes after an equal key as a duplicate, which is still right here: a
+// child becomes the winner only after it is compared with the previous winner directly or
+// through a runner-up with the same key.
+template <typename T, typename Compare>
+class LoserTree {
+public:
+    explicit LoserTree(Compare compare = Compare()) : _compare(std::move(compare)) {}
+
+    // Build the tree with K - 1 comparisons.
+    void init(std::vector<T> children) {
+        _children = std::move(children);
+        _num_children = _children.size();
+        _num_alive = _num_children;
+        _alive.assign(_num_children, true);
+        _losers.assign(std::max<size_t>(_num_children, 1), 0);
+        _runner_up = NONE;
+        if (_num_children == 0) {
+            return;
+        }
+        // node n has children 2n and 2n + 1, leaf i is node K + i
+        std::vector<size_t> winners(_num_children * 2);
+        for (size_t i = 0; i < _num_children; ++i) {
+            winners[_num_children + i] = i;
+        }
+        for (size_t node = _num_children - 1; node >= 1; --node) {
+            size_t left = winners[node * 2];
+            size_t right = winners[node * 2 + 1];
+            if (_goes_after(left, right)) {
+                std::swap(left, right);
+            }
+            winners[node] = left;
+            _losers[node] = right;
+        }
+        _losers[0] = winners[1];
+    }
+
+    bool empty() const { return _num_alive == 0; }
+
+    size_t size() const { return _num_alive; }
+
+    T& top() {
+        DCHECK(!empty());
+        return _children[_losers[0]];
+    }
+
+    // The top has moved to its next row.
+    void update_top() {
+        DCHECK(!empty());
+        size_t winner = _losers[0];
+        if (_runner_up != NONE) {
+            if (!_goes_after(winner, _runner_up)) {
+                return;
+            }
+            _runner_up = NONE;
+        }
+        _replay(winner);
+        if (_losers[0] == winner) {
+            _find_runner_up();
+        }
+    }
+
+    // The top is exhausted, remove it from the tree.
+    void pop_top() {
+        DCHECK(!empty());
+        size_t winner = _losers[0];
+        _alive[winner] = false;
+        --_num_alive;
+        _runner_up = NONE;
+        _replay(winner);
+    }
+
+    // The top is exhausted, replace it with another child, e.g. the next segment of the same
+    // rowset, which does not go before any row already taken from the tree.
+    void replace_top(T child) {
+        DCHECK(!empty());
+        size_t winner = _losers[0];
+        _children[winner] = std::move(child);
+        _runner_up = NONE;
+        _replay(winner);
+    }
+
+    // The best of the others than the top, nullptr if the top is the only one left. Then all
+    // the rows of the top up to the ones which go after the runner-up can be taken at once.
+    T* runner_up() {
+        DCHECK(!empty());
+        if (_runner_up == NONE) {
+            _find_runner_up();
+        }
+        return _runner_up == NONE ? nullptr : &_children[_runner_up];
+    }
+
+    // All the children still in the tree.
+    template <typename Func>
+    void for_each(Func&& func) {
+        for (size_t i = 0; i < _num_children; ++i) {
+            if (_alive[i]) {
+                func(_children[i]);
+            }
+        }
+    }
+
+private:
+    static constexpr size_t NONE = static_cast<size_t>(-1);
+
+    // the removed children go after all the others
+    bool _goes_after(size_t lhs, size_t rhs) {
+        if (!_alive[lhs]) {
+            return _alive[rhs];
+        }
+        if (!_alive[rhs]) {
+            return false;
+        }
+        return _compare(_children[lhs], _children[rhs]);
+    }
+
+    void _replay(size_t leaf) {
+        size_t winner = leaf;
+        for (size_t node = (_num_children + leaf) / 2; node >= 1; node /= 2) {
+            if (_goes_after(winner, _losers[node])) {
+                std::swap(winner, _losers[node]);
+            }
+        }
+        _losers[0] = winner;
+    }
+
+    void _find_runner_up() {
+        size_t best = NONE;
+        for (size_t node = (_num_children + _losers[0]) / 2; node >= 1; node /= 2) {
+            size_t loser = _losers[node];
+            if (!_alive[loser]) {
+                continue;
+            }
+            if (best == NONE || _goes_after(best, loser)) {
+                best = loser;
+            }
+        }
+        _runner_up = best;
+    }
+
+    Compare _compare;
+    std::vector<T> _children;
+    std::vector<bool> _alive;
+    // _losers[0] is the winner
+    std::vector<size_t> _losers;
+    size_t _num_children = 0;
+    size_t _num_alive = 0;
+    size_t _runner_up = NONE;
+};
+
+} // namespace doris::vectorized
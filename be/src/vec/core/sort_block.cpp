@@ -20,6 +20,10 @@
 
 #include "vec/core/sort_block.h"
 
+#include "common/config.h"
+#include "vec/columns/column_decimal.h"
+#include "vec/columns/columns_number.h"
+#include "vec/common/pod_array.h"
 #include "vec/core/column_with_type_and_name.h"
 
 namespace doris::vectorized {
@@ -62,6 +66,276 @@ struct PartialSortingLess {
     }
 };
 
+namespace {
+
+// The normalized key of a row concatenates its sort columns encoded into bytes, so that the
+// keys compare by memcmp in the same order as the rows compare by the sort description:
+// integers are stored big endian with the sign bit flipped, the bytes of a descending column
+// are inverted, and a nullable column is prefixed by a byte placing the nulls first or last.
+// A string column only contributes a fixed-length prefix, so it is the last column of the key.
+constexpr size_t NORMALIZED_KEY_STRING_PREFIX = 8;
+constexpr size_t NORMALIZED_KEY_MAX_WIDTH = 32;
+// size of the buckets sorted by the insertion sort instead of another radix pass
+constexpr size_t NORMALIZED_KEY_INSERTION_SORT_THRESHOLD = 32;
+
+struct NormalizedKeyColumn {
+    const IColumn* column = nullptr;
+    // nullptr if the column is not nullable or has no null
+    const NullMap* null_map = nullptr;
+    bool nulls_first = false;
+    bool descending = false;
+    // width of the value, exclude the null byte
+    size_t width = 0;
+    bool is_string = false;
+};
+
+template <typename Func>
+bool visit_normalized_key_column(const IColumn& column, Func&& func) {
+    if (const auto* c = check_and_get_column<ColumnString>(column)) {
+        func(*c);
+    } else if (const auto* c = check_and_get_column<ColumnInt8>(column)) {
+        func(*c);
+    } else if (const auto* c = check_and_get_column<ColumnInt16>(column)) {
+        func(*c);
+    } else if (const auto* c = check_and_get_column<ColumnInt32>(column)) {
+        func(*c);
+    } else if (const auto* c = check_and_get_column<ColumnInt64>(column)) {
+        func(*c);
+    } else if (const auto* c = check_and_get_column<ColumnInt128>(column)) {
+        func(*c);
+    } else if (const auto* c = check_and_get_column<ColumnUInt8>(column)) {
+        func(*c);
+    } else if (const auto* c = check_and_get_column<ColumnUInt16>(column)) {
+        func(*c);
+    } else if (const auto* c = check_and_get_column<ColumnUInt32>(column)) {
+        func(*c);
+    } else if (const auto* c = check_and_get_column<ColumnUInt64>(column)) {
+        func(*c);
+    } else if (const auto* c = check_and_get_column<ColumnDecimal32>(column)) {
+        func(*c);
+    } else if (const auto* c = check_and_get_column<ColumnDecimal64>(column)) {
+        func(*c);
+    } else if (const auto* c = check_and_get_column<ColumnDecimal128>(column)) {
+        func(*c);
+    } else if (const auto* c = check_and_get_column<ColumnDecimal128I>(column)) {
+        func(*c);
+    } else {
+        return false;
+    }
+    return true;
+}
+
+template <typename T>
+void encode_normalized_integer(T value, bool descending, uint8_t* __restrict dst) {
+    using UnsignedT = std::conditional_t<
+            sizeof(T) == 16, unsigned __int128,
+            std::conditional_t<sizeof(T) == 8, uint64_t,
+                               std::conditional_t<sizeof(T) == 4, uint32_t,
+                                                  std::conditional_t<sizeof(T) == 2, uint16_t,
+                                                                     uint8_t>>>>;
+    auto bits = static_cast<UnsignedT>(value);
+    if constexpr (std::is_signed_v<T> || std::is_same_v<T, Int128>) {
+        bits ^= UnsignedT(1) << (sizeof(T) * 8 - 1);
+    }
+    if (descending) {
+        bits = ~bits;
+    }
+    for (size_t i = 0; i < sizeof(T); ++i) {
+        dst[i] = static_cast<uint8_t>(bits >> ((sizeof(T) - 1 - i) * 8));
+    }
+}
+
+// Encode the column into [offset, offset + width) of every key, the value of null is left zero.
+template <typename ColumnType>
+void encode_normalized_key_column(const ColumnType& column, bool descending, size_t rows,
+                                  size_t stride, uint8_t* __restrict keys) {
+    if constexpr (std::is_same_v<ColumnType, ColumnString>) {
+        for (size_t i = 0; i < rows; ++i) {
+            StringRef value = column.get_data_at(i);
+            uint8_t* dst = keys + i * stride;
+            size_t size = std::min(value.size, NORMALIZED_KEY_STRING_PREFIX);
+            memcpy(dst, value.data, size);
+            memset(dst + size, 0, NORMALIZED_KEY_STRING_PREFIX - size);
+            if (descending) {
+                for (size_t j = 0; j < NORMALIZED_KEY_STRING_PREFIX; ++j) {
+                    dst[j] = ~dst[j];
+                }
+            }
+        }
+    } else {
+        const auto& data = column.get_data();
+        for (size_t i = 0; i < rows; ++i) {
+            if constexpr (IsDecimalNumber<typename ColumnType::value_type>) {
+                encode_normalized_integer(data[i].value, descending, keys + i * stride);
+            } else {
+                encode_normalized_integer(data[i], descending, keys + i * stride);
+            }
+        }
+    }
+}
+
+// Choose the leading sort columns which can be encoded into the normalized key, return false
+// if the key does not cover all the sort columns, i.e. the rows with equal keys are not sorted.
+bool get_normalized_key_columns(const ColumnsWithSortDescriptions& columns_with_sort_desc,
+                                std::vector<NormalizedKeyColumn>* key_columns, size_t* key_width) {
+    *key_width = 0;
+    for (const auto& [column, sort_desc] : columns_with_sort_desc) {
+        NormalizedKeyColumn key_column;
+        key_column.column = column;
+        if (const auto* nullable = check_and_get_column<ColumnNullable>(*column)) {
+            key_column.column = &nullable->get_nested_column();
+            if (nullable->has_null()) {
+                key_column.null_map = &nullable->get_null_map_data();
+            }
+        }
+        key_column.nulls_first = sort_desc.nulls_direction * sort_desc.direction < 0;
+        key_column.descending = sort_desc.direction < 0;
+        if (!visit_normalized_key_column(*key_column.column, [&](const auto& c) {
+                using ColumnType = std::decay_t<decltype(c)>;
+                if constexpr (std::is_same_v<ColumnType, ColumnString>) {
+                    key_column.width = NORMALIZED_KEY_STRING_PREFIX;
+                    key_column.is_string = true;
+                } else {
+                    key_column.width = sizeof(typename ColumnType::value_type);
+                }
+            })) {
+            return false;
+        }
+        size_t width = key_column.width + (key_column.null_map != nullptr);
+        if (*key_width + width > NORMALIZED_KEY_MAX_WIDTH) {
+            return false;
+        }
+        *key_width += width;
+        key_columns->push_back(key_column);
+        if (key_column.is_string) {
+            return false;
+        }
+    }
+    return true;
+}
+
+void insertion_sort_normalized_keys(uint8_t* __restrict data, size_t rows, size_t stride,
+                                    size_t depth, size_t key_width) {
+    uint8_t current[NORMALIZED_KEY_MAX_WIDTH + sizeof(uint32_t)];
+    for (size_t i = 1; i < rows; ++i) {
+        memcpy(current, data + i * stride, stride);
+        size_t j = i;
+        while (j > 0 &&
+               memcmp(current + depth, data + (j - 1) * stride + depth, key_width - depth) < 0) {
+            memcpy(data + j * stride, data + (j - 1) * stride, stride);
+            --j;
+        }
+        memcpy(data + j * stride, current, stride);
+    }
+}
+
+// MSD radix sort of the rows whose keys are equal before depth.
+void radix_sort_normalized_keys(uint8_t* __restrict data, uint8_t* __restrict tmp, size_t rows,
+                                size_t stride, size_t depth, size_t key_width) {
+    while (depth < key_width) {
+        if (rows <= NORMALIZED_KEY_INSERTION_SORT_THRESHOLD) {
+            insertion_sort_normalized_keys(data, rows, stride, depth, key_width);
+            return;
+        }
+        size_t offsets[257] = {0};
+        for (size_t i = 0; i < rows; ++i) {
+            ++offsets[data[i * stride + depth] + 1];
+        }
+        // all the rows fall into one bucket, go to the next byte directly
+        if (offsets[data[depth] + 1] == rows) {
+            ++depth;
+            continue;
+        }
+        for (size_t b = 1; b <= 256; ++b) {
+            offsets[b] += offsets[b - 1];
+        }
+        size_t positions[256];
+        memcpy(positions, offsets, sizeof(positions));
+        for (size_t i = 0; i < rows; ++i) {
+            memcpy(tmp + positions[data[i * stride + depth]]++ * stride, data + i * stride, stride);
+        }
+        memcpy(data, tmp, rows * stride);
+        for (size_t b = 0; b < 256; ++b) {
+            size_t bucket_rows = offsets[b + 1] - offsets[b];
+            if (bucket_rows > 1) {
+                radix_sort_normalized_keys(data + offsets[b] * stride, tmp + offsets[b] * stride,
+                                           bucket_rows, stride, depth + 1, key_width);
+            }
+        }
+        return;
+    }
+}
+
+// Return false if the block can not be sorted by the normalized keys.
+bool sort_by_normalized_keys(const ColumnsWithSortDescriptions& columns_with_sort_desc,
+                             size_t rows, IColumn::Permutation& perm) {
+    std::vector<NormalizedKeyColumn> key_columns;
+    size_t key_width = 0;
+    bool is_complete_key = get_normalized_key_columns(columns_with_sort_desc, &key_columns,
+                                                      &key_width);
+    if (key_columns.empty()) {
+        return false;
+    }
+
+    // every row is the normalized key followed by the row id
+    size_t stride = key_width + sizeof(uint32_t);
+    PaddedPODArray<uint8_t> keys(rows * stride);
+    PaddedPODArray<uint8_t> tmp(rows * stride);
+    size_t offset = 0;
+    for (const auto& key_column : key_columns) {
+        uint8_t* data = keys.data() + offset;
+        if (key_column.null_map != nullptr) {
+            const auto& null_map = *key_column.null_map;
+            uint8_t null_byte = key_column.nulls_first ? 0 : 1;
+            for (size_t i = 0; i < rows; ++i) {
+                data[i * stride] = null_map[i] ? null_byte : 1 - null_byte;
+            }
+            ++data;
+        }
+        visit_normalized_key_column(*key_column.column, [&](const auto& c) {
+            encode_normalized_key_column(c, key_column.descending, rows, stride, data);
+        });
+        if (key_column.null_map != nullptr) {
+            const auto& null_map = *key_column.null_map;
+            for (size_t i = 0; i < rows; ++i) {
+                if (null_map[i]) {
+                    memset(data + i * stride, 0, key_column.width);
+                }
+            }
+        }
+        offset += key_column.width + (key_column.null_map != nullptr);
+    }
+    for (size_t i = 0; i < rows; ++i) {
+        auto row_id = static_cast<uint32_t>(i);
+        memcpy(keys.data() + i * stride + key_width, &row_id, sizeof(row_id));
+    }
+
+    radix_sort_normalized_keys(keys.data(), tmp.data(), rows, stride, 0, key_width);
+
+    for (size_t i = 0; i < rows; ++i) {
+        uint32_t row_id = 0;
+        memcpy(&row_id, keys.data() + i * stride + key_width, sizeof(row_id));
+        perm[i] = row_id;
+    }
+    if (!is_complete_key) {
+        // the rows with equal keys are sorted by the comparator
+        PartialSortingLess less(columns_with_sort_desc);
+        size_t range_begin = 0;
+        for (size_t i = 1; i <= rows; ++i) {
+            if (i == rows || memcmp(keys.data() + i * stride,
+                                    keys.data() + range_begin * stride, key_width) != 0) {
+                if (i - range_begin > 1) {
+                    pdqsort(perm.begin() + range_begin, perm.begin() + i, less);
+                }
+                range_begin = i;
+            }
+        }
+    }
+    return true;
+}
+
+} // namespace
+
 void sort_block(Block& src_block, Block& dest_block, const SortDescription& description,
                 UInt64 limit) {
     if (!src_block) {
@@ -98,7 +372,10 @@ void sort_block(Block& src_block, Block& dest_block, const SortDescription& desc
 
         ColumnsWithSortDescriptions columns_with_sort_desc =
                 get_columns_with_sort_description(src_block, description);
-        {
+        // a partial sort is cheaper than sorting all the rows when the limit is small
+        bool sorted = config::enable_normalized_key_sort && (limit == 0 || limit > size / 5) &&
+                      sort_by_normalized_keys(columns_with_sort_desc, size, perm);
+        if (!sorted) {
             EqualFlags flags(size, 1);
             EqualRange range {0, size};
 
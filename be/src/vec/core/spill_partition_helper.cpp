@@ -0,0 +1,59 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "vec/core/spill_partition_helper.h"
+
+#include <glog/logging.h>
+
+#include "vec/columns/column.h"
+
+namespace doris::vectorized {
+
+void SpillPartitionHelper::split_block(const Block& block,
+                                       const std::vector<size_t>& partition_indices,
+                                       std::vector<Block>& partitioned_blocks) const {
+    DCHECK_EQ(block.rows(), partition_indices.size());
+
+    std::vector<size_t> blocks_rows(partition_count);
+    for (auto index : partition_indices) {
+        DCHECK_LT(index, partition_count);
+        blocks_rows[index]++;
+    }
+
+    std::vector<IColumn::Selector> selectors(partition_count);
+    for (size_t i = 0; i < partition_count; ++i) {
+        selectors[i].reserve(blocks_rows[i]);
+    }
+    for (size_t i = 0; i < partition_indices.size(); ++i) {
+        selectors[partition_indices[i]].push_back(i);
+    }
+
+    partitioned_blocks.resize(partition_count);
+    for (size_t i = 0; i < partition_count; ++i) {
+        if (blocks_rows[i] == 0) {
+            partitioned_blocks[i] = block.clone_empty();
+            continue;
+        }
+
+        MutableBlock mutable_block(block.clone_empty());
+        block.append_block_by_selector(&mutable_block, selectors[i]);
+        DCHECK_EQ(mutable_block.rows(), blocks_rows[i]);
+        partitioned_blocks[i] = mutable_block.to_block();
+    }
+}
+
+} // namespace doris::vectorized
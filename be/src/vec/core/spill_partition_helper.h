@@ -0,0 +1,60 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <stddef.h>
+
+#include <vector>
+
+#include "vec/core/block.h"
+
+namespace doris::vectorized {
+
+// Hash partitioning shared by the operators which spill hash partitioned data to disk
+// (aggregation, hash join, set operation).
+//
+// The partition index is taken from the high bits of the 32 bits hash value. `skipped_hash_bits`
+// high bits are skipped first, so that the operators which later build a `PartitionedHashTable`
+// (which takes its sub table index from the highest bits) from one spilled partition do not put
+// all the rows of the partition into the same sub table.
+struct SpillPartitionHelper {
+    const size_t partition_count_bits;
+    const size_t partition_count;
+    const size_t max_partition_index;
+    const size_t skipped_hash_bits;
+
+    SpillPartitionHelper(const size_t partition_count_bits_, const size_t skipped_hash_bits_ = 0)
+            : partition_count_bits(partition_count_bits_),
+              partition_count(1 << partition_count_bits),
+              max_partition_index(partition_count - 1),
+              skipped_hash_bits(skipped_hash_bits_) {}
+
+    size_t get_index(size_t hash_value) const {
+        return (hash_value >> (32 - partition_count_bits - skipped_hash_bits)) &
+               max_partition_index;
+    }
+
+    // Split `block` into `partition_count` blocks, the i-th row of `block` is appended to
+    // `partitioned_blocks[partition_indices[i]]`. Blocks of partitions without any row are
+    // empty blocks with the same structure as `block`.
+    // The columns of `block` should not be const columns.
+    void split_block(const Block& block, const std::vector<size_t>& partition_indices,
+                     std::vector<Block>& partitioned_blocks) const;
+};
+
+} // namespace doris::vectorized
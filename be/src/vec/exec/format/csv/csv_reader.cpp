@@ -44,6 +44,7 @@
 #include "runtime/descriptors.h"
 #include "runtime/runtime_state.h"
 #include "runtime/types.h"
+#include "util/simd/bits.h"
 #include "util/string_util.h"
 #include "util/utf8_check.h"
 #include "vec/common/typeid_cast.h"
@@ -483,46 +484,49 @@ void CsvReader::_split_line_for_proto_format(const Slice& line) {
     }
 }
 
+void CsvReader::_emplace_split_value(const char* value, size_t start, size_t end) {
+    if (_state != nullptr && _state->trim_tailing_spaces_for_external_table_query()) {
+        while (end > start && *(value + end - 1) == ' ') {
+            end--;
+        }
+    }
+    if (_trim_double_quotes && end > (start + 1) && *(value + start) == '\"' &&
+        *(value + end - 1) == '\"') {
+        start++;
+        end--;
+    }
+    _split_values.emplace_back(value + start, end - start);
+}
+
 void CsvReader::_split_line_for_single_char_delimiter(const Slice& line) {
     _split_values.clear();
     if (_file_format_type == TFileFormatType::FORMAT_PROTO) {
         _split_line_for_proto_format(line);
     } else {
         const char* value = line.data;
+        const char separator = _value_separator[0];
         size_t cur_pos = 0;
         size_t start_field = 0;
         const size_t size = line.size;
+        // locate the separators of 64 bytes at a time by the bit mask of the matched bytes
+        for (; cur_pos + 64 <= size; cur_pos += 64) {
+            uint64_t mask = simd::bytes64_equal_mask(value + cur_pos, separator);
+            while (mask != 0) {
+                size_t separator_pos = cur_pos + __builtin_ctzll(mask);
+                mask &= mask - 1;
+                _emplace_split_value(value, start_field, separator_pos);
+                start_field = separator_pos + 1;
+            }
+        }
         for (; cur_pos < size; ++cur_pos) {
-            if (*(value + cur_pos) == _value_separator[0]) {
-                size_t non_space = cur_pos;
-                if (_state != nullptr && _state->trim_tailing_spaces_for_external_table_query()) {
-                    while (non_space > start_field && *(value + non_space - 1) == ' ') {
-                        non_space--;
-                    }
-                }
-                if (_trim_double_quotes && non_space > (start_field + 1) &&
-                    *(value + start_field) == '\"' && *(value + non_space - 1) == '\"') {
-                    start_field++;
-                    non_space--;
-                }
-                _split_values.emplace_back(value + start_field, non_space - start_field);
+            if (*(value + cur_pos) == separator) {
+                _emplace_split_value(value, start_field, cur_pos);
                 start_field = cur_pos + 1;
             }
         }
 
         CHECK(cur_pos == line.size) << cur_pos << " vs " << line.size;
-        size_t non_space = cur_pos;
-        if (_state != nullptr && _state->trim_tailing_spaces_for_external_table_query()) {
-            while (non_space > start_field && *(value + non_space - 1) == ' ') {
-                non_space--;
-            }
-        }
-        if (_trim_double_quotes && non_space > (start_field + 1) &&
-            *(value + start_field) == '\"' && *(value + non_space - 1) == '\"') {
-            start_field++;
-            non_space--;
-        }
-        _split_values.emplace_back(value + start_field, non_space - start_field);
+        _emplace_split_value(value, start_field, cur_pos);
     }
 }
 
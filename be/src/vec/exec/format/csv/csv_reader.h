@@ -88,6 +88,8 @@ private:
     Status _line_split_to_values(const Slice& line, bool* success);
     void _split_line(const Slice& line);
     void _split_line_for_single_char_delimiter(const Slice& line);
+    // add value[start, end) to _split_values, trimming the tailing spaces and double quotes
+    void _emplace_split_value(const char* value, size_t start, size_t end);
     void _split_line_for_proto_format(const Slice& line);
     Status _check_array_format(std::vector<Slice>& split_values, bool* is_success);
     bool _is_null(const Slice& slice);
@@ -25,9 +25,13 @@
 #include <memory>
 #include <ostream>
 
+#include "common/config.h"
 #include "common/status.h"
 #include "exec/decompressor.h"
 #include "io/fs/file_reader.h"
+#include "io/fs/stream_load_pipe.h"
+#include "runtime/exec_env.h"
+#include "runtime/thread_context.h"
 #include "util/slice.h"
 
 // INPUT_CHUNK must
@@ -68,6 +72,7 @@ NewPlainTextLineReader::NewPlainTextLineReader(RuntimeProfile* profile,
           _more_input_bytes(0),
           _more_output_bytes(0),
           _current_offset(current_offset),
+          _pipe(nullptr),
           _bytes_read_counter(nullptr),
           _read_timer(nullptr),
           _bytes_decompress_counter(nullptr),
@@ -76,6 +81,9 @@ NewPlainTextLineReader::NewPlainTextLineReader(RuntimeProfile* profile,
     _read_timer = ADD_TIMER(_profile, "FileReadTime");
     _bytes_decompress_counter = ADD_COUNTER(_profile, "BytesDecompressed", TUnit::BYTES);
     _decompress_timer = ADD_TIMER(_profile, "DecompressTime");
+    if (_decompressor == nullptr && config::enable_stream_load_zero_copy) {
+        _pipe = dynamic_cast<io::StreamLoadPipe*>(_file_reader.get());
+    }
 }
 
 NewPlainTextLineReader::~NewPlainTextLineReader() {
@@ -92,6 +100,12 @@ void NewPlainTextLineReader::close() {
         delete[] _output_buf;
         _output_buf = nullptr;
     }
+
+    if (_pipe_buf != nullptr) {
+        // the buffers of the pipe are allocated by the http threads
+        SCOPED_SWITCH_THREAD_MEM_TRACKER_LIMITER(ExecEnv::GetInstance()->orphan_mem_tracker());
+        _pipe_buf.reset();
+    }
 }
 
 inline bool NewPlainTextLineReader::update_eof() {
@@ -183,6 +197,93 @@ void NewPlainTextLineReader::extend_output_buf() {
     } while (false);
 }
 
+void NewPlainTextLineReader::append_to_output_buf(const uint8_t* data, size_t size) {
+    if (_output_buf_size - _output_buf_limit < size) {
+        while (_output_buf_size - _output_buf_limit < size) {
+            _output_buf_size = _output_buf_size * 2;
+        }
+        uint8_t* new_output_buf = new uint8_t[_output_buf_size];
+        memcpy(new_output_buf, _output_buf, _output_buf_limit);
+        delete[] _output_buf;
+        _output_buf = new_output_buf;
+    }
+    memcpy(_output_buf + _output_buf_limit, data, size);
+    _output_buf_limit += size;
+}
+
+Status NewPlainTextLineReader::read_line_from_pipe(const uint8_t** ptr, size_t* size,
+                                                   bool* eof) {
+    // the line returned by the last call is not referenced any more
+    _output_buf_pos = 0;
+    _output_buf_limit = 0;
+    bool found_line_delimiter = false;
+    while (!_file_eof) {
+        if (_pipe_buf == nullptr || !_pipe_buf->has_remaining()) {
+            SCOPED_TIMER(_read_timer);
+            RETURN_IF_ERROR(_pipe->read_buffer(&_pipe_buf));
+            if (_pipe_buf == nullptr) {
+                _file_eof = true;
+            } else {
+                COUNTER_UPDATE(_bytes_read_counter, _pipe_buf->remaining());
+            }
+            continue;
+        }
+        auto* start = reinterpret_cast<const uint8_t*>(_pipe_buf->ptr + _pipe_buf->pos);
+        size_t len = _pipe_buf->remaining();
+
+        if (_output_buf_limit > 0 && _line_delimiter_length > 1) {
+            // a multi bytes delimiter may straddle the assembled line and this buffer, look
+            // for it in the tail of the line followed by the head of the buffer
+            size_t tail = std::min(_output_buf_limit, _line_delimiter_length - 1);
+            std::string window(reinterpret_cast<char*>(_output_buf + _output_buf_limit - tail),
+                               tail);
+            window.append(reinterpret_cast<const char*>(start),
+                          std::min(len, _line_delimiter_length - 1));
+            auto* pos = static_cast<const char*>(memmem(window.data(), window.size(),
+                                                        _line_delimiter.c_str(),
+                                                        _line_delimiter_length));
+            if (pos != nullptr) {
+                size_t delimiter_in_line = tail - (pos - window.data());
+                _output_buf_limit -= delimiter_in_line;
+                _pipe_buf->pos += _line_delimiter_length - delimiter_in_line;
+                found_line_delimiter = true;
+                break;
+            }
+        }
+
+        auto* pos = update_field_pos_and_find_line_delimiter(start, len);
+        if (pos == nullptr) {
+            append_to_output_buf(start, len);
+            _pipe_buf->pos += len;
+            continue;
+        }
+        size_t line_len = pos - start;
+        _pipe_buf->pos += line_len + _line_delimiter_length;
+        if (_output_buf_limit == 0) {
+            // the line is in this buffer
+            *ptr = start;
+            *size = line_len;
+            *eof = false;
+            _total_read_bytes += line_len + _line_delimiter_length;
+            return Status::OK();
+        }
+        append_to_output_buf(start, line_len);
+        found_line_delimiter = true;
+        break;
+    }
+
+    if (!found_line_delimiter && _output_buf_limit == 0) {
+        *size = 0;
+        *eof = true;
+        return Status::OK();
+    }
+    *ptr = _output_buf;
+    *size = _output_buf_limit;
+    *eof = false;
+    _total_read_bytes += *size + (found_line_delimiter ? _line_delimiter_length : 0);
+    return Status::OK();
+}
+
 Status NewPlainTextLineReader::read_line(const uint8_t** ptr, size_t* size, bool* eof,
                                          const io::IOContext* io_ctx) {
     if (_eof || update_eof()) {
@@ -190,6 +291,9 @@ Status NewPlainTextLineReader::read_line(const uint8_t** ptr, size_t* size, bool
         *eof = true;
         return Status::OK();
     }
+    if (_pipe != nullptr) {
+        return read_line_from_pipe(ptr, size, eof);
+    }
     int found_line_delimiter = 0;
     size_t offset = 0;
     while (!done()) {
@@ -24,12 +24,14 @@
 
 #include "exec/line_reader.h"
 #include "io/fs/file_reader_writer_fwd.h"
+#include "util/byte_buffer.h"
 #include "util/runtime_profile.h"
 
 namespace doris {
 namespace io {
 class IOContext;
-}
+class StreamLoadPipe;
+} // namespace io
 
 class Decompressor;
 class Status;
@@ -68,6 +70,11 @@ private:
     void extend_input_buf();
     void extend_output_buf();
 
+    // read the lines in place from the buffers of a stream load pipe, only the line straddling
+    // two buffers is assembled in the output buf.
+    Status read_line_from_pipe(const uint8_t** ptr, size_t* size, bool* eof);
+    void append_to_output_buf(const uint8_t* data, size_t size);
+
     RuntimeProfile* _profile;
     io::FileReaderSPtr _file_reader;
     Decompressor* _decompressor;
@@ -99,6 +106,10 @@ private:
 
     size_t _current_offset;
 
+    // not null if reading an uncompressed stream load by reference
+    io::StreamLoadPipe* _pipe;
+    ByteBufferPtr _pipe_buf;
+
     // Profile counters
     RuntimeProfile::Counter* _bytes_read_counter;
     RuntimeProfile::Counter* _read_timer;
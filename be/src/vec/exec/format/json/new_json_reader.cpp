@@ -208,13 +208,15 @@ Status NewJsonReader::get_next_block(Block* block, size_t* read_rows, bool* eof)
         }
 
         bool is_empty_row = false;
+        size_t num_rows = block->rows();
 
         RETURN_IF_ERROR(_read_json_column(*block, _file_slot_descs, &is_empty_row, &_reader_eof));
         if (is_empty_row) {
             // Read empty row, just continue
             continue;
         }
-        ++(*read_rows);
+        // batch mode reads many rows at a time
+        *read_rows += _batch_read_json ? block->rows() - num_rows : 1;
     }
 
     return Status::OK();
@@ -1064,6 +1066,13 @@ Status NewJsonReader::_simdjson_init_reader() {
             _vhandle_json_callback = &NewJsonReader::_simdjson_handle_nested_complex_json;
         }
     }
+    // the lines of simple json are parsed by a document stream in batch
+    _batch_read_json = config::enable_simdjson_batch_reader && _read_json_by_line &&
+                       !_is_dynamic_schema && _parsed_jsonpaths.empty() &&
+                       _parsed_json_root.empty() && !_strip_outer_array;
+    if (_batch_read_json) {
+        _vhandle_json_callback = &NewJsonReader::_simdjson_handle_simple_json_batch;
+    }
     if (_is_dynamic_schema) {
         _json_parser = std::make_unique<vectorized::JSONDataParser<vectorized::SimdJSONParser>>();
     }
@@ -1173,6 +1182,143 @@ Status NewJsonReader::_simdjson_handle_simple_json(Block& block,
     return Status::OK();
 }
 
+Status NewJsonReader::_simdjson_handle_simple_json_batch(
+        Block& block, const std::vector<SlotDescriptor*>& slot_descs, bool* is_empty_row,
+        bool* eof) {
+    const size_t batch_size = std::max(_state->batch_size(), (int)_MIN_BATCH_SIZE);
+    size_t num_rows = block.rows();
+    *is_empty_row = true;
+    if (num_rows >= batch_size) {
+        return Status::OK();
+    }
+    RETURN_IF_ERROR(_simdjson_read_json_lines(batch_size - num_rows, eof));
+    if (_json_lines.empty()) {
+        return Status::OK();
+    }
+
+    size_t next_line = 0;
+    RETURN_IF_ERROR(_simdjson_parse_json_lines(block, slot_descs, &next_line));
+    // The lines after a broken document are parsed one by one, so the error of each line
+    // is reported the same as the non batch mode.
+    for (; next_line < _json_lines.size() && !*_scanner_eof; ++next_line) {
+        RETURN_IF_ERROR(_simdjson_handle_json_line(block, slot_descs, next_line));
+    }
+    *is_empty_row = block.rows() == num_rows;
+    return Status::OK();
+}
+
+Status NewJsonReader::_simdjson_read_json_lines(size_t max_lines, bool* eof) {
+    SCOPED_TIMER(_file_read_timer);
+    _json_lines.clear();
+    _json_lines_buffer.clear();
+    while (_json_lines.size() < max_lines && _json_lines_buffer.size() < _init_buffer_size) {
+        const uint8_t* line = nullptr;
+        size_t size = 0;
+        RETURN_IF_ERROR(_line_reader->read_line(&line, &size, eof, _io_ctx));
+        if (*eof) {
+            break;
+        }
+        if (size == 0) {
+            continue;
+        }
+        // trim BOM since simdjson does not handle UTF-8 Unicode (with BOM)
+        if (size >= 3 && static_cast<char>(line[0]) == '\xEF' &&
+            static_cast<char>(line[1]) == '\xBB' && static_cast<char>(line[2]) == '\xBF') {
+            line += 3;
+            size -= 3;
+        }
+        _json_lines.emplace_back(_json_lines_buffer.size(), size);
+        _json_lines_buffer.append(reinterpret_cast<const char*>(line), size);
+        _json_lines_buffer.push_back('\n');
+    }
+    _json_lines_size = _json_lines_buffer.size();
+    _json_lines_buffer.append(simdjson::SIMDJSON_PADDING, ' ');
+    return Status::OK();
+}
+
+Status NewJsonReader::_simdjson_parse_json_lines(Block& block,
+                                                 const std::vector<SlotDescriptor*>& slot_descs,
+                                                 size_t* next_line) {
+    simdjson::ondemand::document_stream stream;
+    // all lines are in one batch, so the structural indexes are built by a single pass
+    auto error = _ondemand_json_parser
+                         ->iterate_many(_json_lines_buffer.data(), _json_lines_size,
+                                        _json_lines_size)
+                         .get(stream);
+    if (error != simdjson::error_code::SUCCESS) {
+        return Status::OK();
+    }
+    size_t line = 0;
+    for (auto it = stream.begin(); it != stream.end(); ++it) {
+        size_t doc_offset = it.current_index();
+        while (line + 1 < _json_lines.size() && _json_lines[line + 1].first <= doc_offset) {
+            ++line;
+        }
+        simdjson::ondemand::document_reference doc;
+        simdjson::ondemand::object object_value;
+        // A document across lines is invalid in the non batch mode, e.g. a line is not closed.
+        if ((*it).get(doc) != simdjson::error_code::SUCCESS ||
+            doc_offset + it.source().size() > _json_lines[line].first + _json_lines[line].second ||
+            doc.get_object().get(object_value) != simdjson::error_code::SUCCESS) {
+            return Status::OK();
+        }
+        size_t num_rows = block.rows();
+        bool valid = false;
+        try {
+            RETURN_IF_ERROR(_simdjson_set_column_value(&object_value, block, slot_descs, &valid));
+        } catch (simdjson::simdjson_error& e) {
+            // clean the fail parsed row, the line is parsed again to report the error
+            for (int i = 0; i < block.columns(); ++i) {
+                auto column = block.get_by_position(i).column->assume_mutable();
+                if (column->size() > num_rows) {
+                    column->pop_back(column->size() - num_rows);
+                }
+            }
+            return Status::OK();
+        }
+        *next_line = line + 1;
+        if (*_scanner_eof) {
+            return Status::OK();
+        }
+    }
+    return Status::OK();
+}
+
+Status NewJsonReader::_simdjson_handle_json_line(Block& block,
+                                                 const std::vector<SlotDescriptor*>& slot_descs,
+                                                 size_t line) {
+    const uint8_t* json_str =
+            reinterpret_cast<const uint8_t*>(_json_lines_buffer.data()) + _json_lines[line].first;
+    size_t size = _json_lines[line].second;
+    bool eof = false;
+    Status st = _simdjson_parse_json_str(json_str, &size, &eof);
+    if (st.is<DATA_QUALITY_ERROR>() || eof) {
+        return Status::OK();
+    }
+    RETURN_IF_ERROR(st);
+    size_t num_rows = block.rows();
+    bool valid = false;
+    try {
+        simdjson::ondemand::object object_value = _json_value;
+        RETURN_IF_ERROR(_simdjson_set_column_value(&object_value, block, slot_descs, &valid));
+    } catch (simdjson::simdjson_error& e) {
+        fmt::memory_buffer error_msg;
+        fmt::format_to(error_msg, "Parse json data for object failed. code: {}, error info: {}",
+                       e.error(), e.what());
+        RETURN_IF_ERROR(_state->append_error_msg_to_file(
+                [&]() -> std::string { return std::string((char*)json_str, size); },
+                [&]() -> std::string { return fmt::to_string(error_msg); }, _scanner_eof));
+        _counter->num_rows_filtered++;
+        for (int i = 0; i < block.columns(); ++i) {
+            auto column = block.get_by_position(i).column->assume_mutable();
+            if (column->size() > num_rows) {
+                column->pop_back(column->size() - num_rows);
+            }
+        }
+    }
+    return Status::OK();
+}
+
 Status NewJsonReader::_simdjson_handle_flat_array_complex_json(
         Block& block, const std::vector<SlotDescriptor*>& slot_descs, bool* is_empty_row,
         bool* eof) {
@@ -1543,6 +1689,10 @@ Status NewJsonReader::_simdjson_parse_json_doc(size_t* size, bool* eof) {
     if (*eof) {
         return Status::OK();
     }
+    return _simdjson_parse_json_str(json_str, size, eof);
+}
+
+Status NewJsonReader::_simdjson_parse_json_str(const uint8_t* json_str, size_t* size, bool* eof) {
     if (*size + simdjson::SIMDJSON_PADDING > _padded_size) {
         // For efficiency reasons, simdjson requires a string with a few bytes (simdjson::SIMDJSON_PADDING) at the end.
         // Hence, a re-allocation is needed if the space is not enough.
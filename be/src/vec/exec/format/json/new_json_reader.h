@@ -30,6 +30,7 @@
 #include <string>
 #include <unordered_map>
 #include <unordered_set>
+#include <utility>
 #include <vector>
 
 #include "common/status.h"
@@ -146,11 +147,24 @@ private:
     Status _simdjson_init_reader();
     Status _simdjson_parse_json(bool* is_empty_row, bool* eof);
     Status _simdjson_parse_json_doc(size_t* size, bool* eof);
+    Status _simdjson_parse_json_str(const uint8_t* json_str, size_t* size, bool* eof);
 
     Status _simdjson_handle_simple_json(Block& block,
                                         const std::vector<SlotDescriptor*>& slot_descs,
                                         bool* is_empty_row, bool* eof);
 
+    // Batch mode of the line delimited simple json. Many lines are parsed by one
+    // document stream, and a line is parsed alone again if its document is broken.
+    Status _simdjson_handle_simple_json_batch(Block& block,
+                                              const std::vector<SlotDescriptor*>& slot_descs,
+                                              bool* is_empty_row, bool* eof);
+    Status _simdjson_read_json_lines(size_t max_lines, bool* eof);
+    // next_line is the first line which is not parsed by the document stream
+    Status _simdjson_parse_json_lines(Block& block, const std::vector<SlotDescriptor*>& slot_descs,
+                                      size_t* next_line);
+    Status _simdjson_handle_json_line(Block& block, const std::vector<SlotDescriptor*>& slot_descs,
+                                      size_t line);
+
     Status _simdjson_handle_flat_array_complex_json(Block& block,
                                                     const std::vector<SlotDescriptor*>& slot_descs,
                                                     bool* is_empty_row, bool* eof);
@@ -263,6 +277,11 @@ private:
     simdjson::ondemand::array _array;
     std::unique_ptr<JSONDataParser<SimdJSONParser>> _json_parser;
     std::unique_ptr<simdjson::ondemand::parser> _ondemand_json_parser = nullptr;
+    // for batch mode, the lines joined by '\n' and the offset and size of each line
+    bool _batch_read_json = false;
+    std::string _json_lines_buffer;
+    size_t _json_lines_size = 0;
+    std::vector<std::pair<size_t, size_t>> _json_lines;
     // column to default value string map
     std::unordered_map<std::string, std::string> _col_default_value_map;
 };
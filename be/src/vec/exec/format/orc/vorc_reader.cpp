@@ -30,6 +30,7 @@
 #include <exception>
 #include <iterator>
 #include <map>
+#include <numeric>
 #include <ostream>
 #include <tuple>
 #include <variant>
@@ -41,6 +42,7 @@
 #include "gutil/casts.h"
 #include "gutil/strings/substitute.h"
 #include "io/fs/buffered_reader.h"
+#include "io/fs/file_meta_cache.h"
 #include "io/fs/file_reader.h"
 #include "orc/Exceptions.hh"
 #include "orc/Int128.hh"
@@ -51,6 +53,7 @@
 #include "runtime/decimalv2_value.h"
 #include "runtime/define_primitive_type.h"
 #include "runtime/descriptors.h"
+#include "runtime/exec_env.h"
 #include "runtime/primitive_type.h"
 #include "runtime/thread_context.h"
 #include "util/slice.h"
@@ -218,11 +221,31 @@ Status OrcReader::_create_file_reader() {
     if (_file_input_stream->getLength() == 0) {
         return Status::EndOfFile("empty orc file: " + _scan_range.path);
     }
+    // the serialized tail of the file is cached, so the footer and metadata of a file is not
+    // read and parsed again by the following splits and queries
+    FileMetaCache* meta_cache = ExecEnv::GetInstance()->file_meta_cache();
+    std::string tail_cache_key;
+    ObjLRUCache::CacheHandle tail_handle;
+    if (meta_cache != nullptr && meta_cache->enabled()) {
+        tail_cache_key = FileMetaCache::get_key(
+                FileMetaCache::MetaType::ORC_TAIL, _scan_range.path,
+                _file_input_stream->getLength(),
+                _scan_range.__isset.modification_time ? _scan_range.modification_time : 0);
+        meta_cache->lookup(tail_cache_key, &tail_handle);
+    }
     // create orc reader
     try {
         orc::ReaderOptions options;
+        if (tail_handle.valid()) {
+            options.setSerializedFileTail(*static_cast<std::string*>(tail_handle.data()));
+        }
         _reader = orc::createReader(
                 std::unique_ptr<ORCFileInputStream>(_file_input_stream.release()), options);
+        if (!tail_cache_key.empty() && !tail_handle.valid()) {
+            auto tail = std::make_unique<std::string>(_reader->getSerializedFileTail());
+            size_t charge = tail->size();
+            meta_cache->insert(tail_cache_key, std::move(tail), charge, &tail_handle);
+        }
     } catch (std::exception& e) {
         return Status::InternalError("Init OrcReader failed. reason = {}", e.what());
     }
@@ -232,12 +255,14 @@ Status OrcReader::_create_file_reader() {
 Status OrcReader::init_reader(
         const std::vector<std::string>* column_names,
         std::unordered_map<std::string, ColumnValueRangeType>* colname_to_value_range,
-        const VExprContextSPtrs& conjuncts, bool is_acid) {
+        const VExprContextSPtrs& conjuncts, bool is_acid,
+        const TupleDescriptor* tuple_descriptor) {
     _column_names = column_names;
     _colname_to_value_range = colname_to_value_range;
     _text_converter.reset(new TextConverter('\\'));
     _lazy_read_ctx.conjuncts = conjuncts;
     _is_acid = is_acid;
+    _tuple_descriptor = tuple_descriptor;
     SCOPED_RAW_TIMER(&_statistics.parse_meta_time);
     RETURN_IF_ERROR(_create_file_reader());
     RETURN_IF_ERROR(_init_read_columns());
@@ -729,7 +754,12 @@ Status OrcReader::set_fill_columns(
     // create orc row reader
     _row_reader_options.range(_range_start_offset, _range_size);
     _row_reader_options.setTimezoneName(_ctz);
-    _row_reader_options.include(_read_cols);
+    std::list<uint64_t> selected_type_ids;
+    if (_init_select_type_ids(&selected_type_ids)) {
+        _row_reader_options.includeTypes(selected_type_ids);
+    } else {
+        _row_reader_options.include(_read_cols);
+    }
     if (_lazy_read_ctx.can_lazy_read) {
         _row_reader_options.filter(_lazy_read_ctx.predicate_orc_columns);
         _orc_filter = std::unique_ptr<ORCFilterImpl>(new ORCFilterImpl(this));
@@ -766,6 +796,70 @@ Status OrcReader::_init_select_types(const orc::Type& type, int idx) {
     return Status::OK();
 }
 
+bool OrcReader::_init_select_type_ids(std::list<uint64_t>* type_ids) {
+    if (_is_acid || _tuple_descriptor == nullptr) {
+        return false;
+    }
+    std::unordered_map<std::string, const TypeDescriptor*> doris_types;
+    for (auto* slot : _tuple_descriptor->slots()) {
+        doris_types.emplace(slot->col_name(), &slot->type());
+    }
+    std::unordered_map<std::string, const orc::Type*> orc_types;
+    auto& root_type = _reader->getType();
+    for (int i = 0; i < root_type.getSubtypeCount(); ++i) {
+        orc_types.emplace(root_type.getFieldName(i), root_type.getSubtype(i));
+    }
+    bool pruned = false;
+    auto file_col = _read_cols.begin();
+    for (auto& col_name : _read_cols_lower_case) {
+        auto orc_type = orc_types.find(*file_col++);
+        if (orc_type == orc_types.end()) {
+            return false;
+        }
+        auto doris_type = doris_types.find(col_name);
+        if (doris_type == doris_types.end()) {
+            type_ids->push_back(orc_type->second->getColumnId());
+            continue;
+        }
+        pruned |= _select_type_ids(orc_type->second, *doris_type->second, type_ids);
+    }
+    return pruned;
+}
+
+bool OrcReader::_select_type_ids(const orc::Type* orc_type, const TypeDescriptor& doris_type,
+                                 std::list<uint64_t>* type_ids) {
+    // An included type includes all its sub types, so only the selected fields of a struct
+    // are included, and their parents are included by orc.
+    if (orc_type->getKind() != orc::TypeKind::STRUCT || doris_type.type != TYPE_STRUCT) {
+        type_ids->push_back(orc_type->getColumnId());
+        return false;
+    }
+    std::unordered_map<std::string, size_t> doris_fields;
+    for (size_t i = 0; i < doris_type.field_names.size(); ++i) {
+        std::string name = doris_type.field_names[i];
+        transform(name.begin(), name.end(), name.begin(), ::tolower);
+        doris_fields.emplace(std::move(name), i);
+    }
+    std::list<uint64_t> field_type_ids;
+    bool pruned = false;
+    for (int i = 0; i < orc_type->getSubtypeCount(); ++i) {
+        auto field = doris_fields.find(_get_field_name_lower_case(orc_type, i));
+        if (field == doris_fields.end()) {
+            pruned = true;
+            continue;
+        }
+        pruned |= _select_type_ids(orc_type->getSubtype(i), doris_type.children[field->second],
+                                   &field_type_ids);
+    }
+    if (field_type_ids.empty()) {
+        // the fields are matched by position if no field name is matched
+        type_ids->push_back(orc_type->getColumnId());
+        return false;
+    }
+    type_ids->splice(type_ids->end(), field_type_ids);
+    return pruned;
+}
+
 Status OrcReader::_fill_partition_columns(
         Block* block, size_t rows,
         const std::unordered_map<std::string, std::tuple<std::string, const SlotDescriptor*>>&
@@ -1138,14 +1232,46 @@ Status OrcReader::_orc_column_to_doris_column(const std::string& col_name,
         }
         auto* orc_struct = down_cast<orc::StructVectorBatch*>(cvb);
         auto& doris_struct = static_cast<ColumnStruct&>(*data_column);
-        if (orc_struct->fields.size() != doris_struct.tuple_size()) {
-            return Status::InternalError("Wrong number of struct fields for column '{}'", col_name);
-        }
         const DataTypeStruct* doris_struct_type =
                 reinterpret_cast<const DataTypeStruct*>(remove_nullable(data_type).get());
+        // The orc struct only has the selected fields, which are matched by name. The fields
+        // are matched by position if no name is matched, e.g. the internal names _col0, _col1.
+        std::unordered_map<std::string, int> orc_fields;
+        for (int i = 0; i < orc_column_type->getSubtypeCount(); ++i) {
+            orc_fields.emplace(_get_field_name_lower_case(orc_column_type, i), i);
+        }
+        std::vector<int> field_pos(doris_struct.tuple_size(), -1);
+        bool name_matched = false;
         for (int i = 0; i < doris_struct.tuple_size(); ++i) {
-            orc::ColumnVectorBatch* orc_field = orc_struct->fields[i];
-            const orc::Type* orc_type = orc_column_type->getSubtype(i);
+            std::string name = doris_struct_type->get_element_names()[i];
+            transform(name.begin(), name.end(), name.begin(), ::tolower);
+            auto field = orc_fields.find(name);
+            if (field != orc_fields.end()) {
+                field_pos[i] = field->second;
+                name_matched = true;
+            }
+        }
+        if (!name_matched) {
+            if (orc_struct->fields.size() != doris_struct.tuple_size()) {
+                return Status::InternalError("Wrong number of struct fields for column '{}'",
+                                             col_name);
+            }
+            std::iota(field_pos.begin(), field_pos.end(), 0);
+        }
+        for (int i = 0; i < doris_struct.tuple_size(); ++i) {
+            const DataTypePtr& doris_type = doris_struct_type->get_element(i);
+            if (field_pos[i] < 0) {
+                // the field is not in the orc file
+                if (!doris_type->is_nullable()) {
+                    return Status::InternalError(
+                            "Non nullable field '{}' is not found in struct column '{}'",
+                            doris_struct_type->get_element_names()[i], col_name);
+                }
+                doris_struct.get_column(i).insert_many_defaults(num_values);
+                continue;
+            }
+            orc::ColumnVectorBatch* orc_field = orc_struct->fields[field_pos[i]];
+            const orc::Type* orc_type = orc_column_type->getSubtype(field_pos[i]);
             if (orc_type->getKind() == orc::TypeKind::LIST ||
                 orc_type->getKind() == orc::TypeKind::MAP ||
                 orc_type->getKind() == orc::TypeKind::STRUCT) {
@@ -1153,7 +1279,6 @@ Status OrcReader::_orc_column_to_doris_column(const std::string& col_name,
                         "Struct does not support nested complex type in column {}", col_name);
             }
             const ColumnPtr& doris_field = doris_struct.get_column_ptr(i);
-            const DataTypePtr& doris_type = doris_struct_type->get_element(i);
             RETURN_IF_ERROR(_orc_column_to_doris_column<is_filter>(
                     col_name, doris_field, doris_type, orc_type, orc_field, num_values));
         }
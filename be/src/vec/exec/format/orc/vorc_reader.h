@@ -54,6 +54,7 @@
 namespace doris {
 class RuntimeState;
 class TFileRangeDesc;
+class TupleDescriptor;
 class TFileScanRangeParams;
 
 namespace io {
@@ -143,7 +144,8 @@ public:
     Status init_reader(
             const std::vector<std::string>* column_names,
             std::unordered_map<std::string, ColumnValueRangeType>* colname_to_value_range,
-            const VExprContextSPtrs& conjuncts, bool is_acid);
+            const VExprContextSPtrs& conjuncts, bool is_acid,
+            const TupleDescriptor* tuple_descriptor = nullptr);
 
     Status set_fill_columns(
             const std::unordered_map<std::string, std::tuple<std::string, const SlotDescriptor*>>&
@@ -152,6 +154,13 @@ public:
 
     Status _init_select_types(const orc::Type& type, int idx);
 
+    // Select the orc types read by the doris types of the read columns, only the fields
+    // declared by the doris struct are selected so the other fields are never decoded.
+    // Return false if nothing is pruned, then the read columns are included as a whole.
+    bool _init_select_type_ids(std::list<uint64_t>* type_ids);
+    bool _select_type_ids(const orc::Type* orc_type, const TypeDescriptor& doris_type,
+                          std::list<uint64_t>* type_ids);
+
     Status _fill_partition_columns(
             Block* block, size_t rows,
             const std::unordered_map<std::string, std::tuple<std::string, const SlotDescriptor*>>&
@@ -468,6 +477,7 @@ private:
 
     std::unordered_map<std::string, ColumnValueRangeType>* _colname_to_value_range;
     bool _is_acid = false;
+    const TupleDescriptor* _tuple_descriptor = nullptr;
     std::unique_ptr<IColumn::Filter> _filter = nullptr;
     LazyReadContext _lazy_read_ctx;
     std::unique_ptr<TextConverter> _text_converter = nullptr;
@@ -31,8 +31,6 @@
 #include "common/logging.h"
 #include "common/object_pool.h"
 #include "common/status.h"
-#include "exprs/create_predicate_function.h"
-#include "exprs/hybrid_set.h"
 #include "gutil/stringprintf.h"
 #include "runtime/define_primitive_type.h"
 #include "runtime/descriptors.h"
@@ -54,7 +52,6 @@
 #include "vec/data_types/data_type_nullable.h"
 #include "vec/data_types/data_type_number.h"
 #include "vec/data_types/data_type_string.h"
-#include "vec/exprs/vdirect_in_predicate.h"
 #include "vec/exprs/vectorized_fn_call.h"
 #include "vec/exprs/vexpr.h"
 #include "vec/exprs/vexpr_context.h"
@@ -325,6 +322,7 @@ Status RowGroupReader::next_batch(Block* block, size_t batch_size, size_t* read_
             if (_position_delete_ctx.has_filter) {
                 filters.push_back(_pos_delete_filter_ptr.get());
             }
+            _build_dict_code_filters(block, *read_rows, &filters);
 
             RETURN_IF_CATCH_EXCEPTION(
                     RETURN_IF_ERROR(VExprContext::execute_conjuncts_and_filter_block(
@@ -436,6 +434,7 @@ Status RowGroupReader::_do_lazy_read(Block* block, size_t batch_size, size_t* re
         if (_position_delete_ctx.has_filter) {
             filters.push_back(_pos_delete_filter_ptr.get());
         }
+        _build_dict_code_filters(block, pre_read_rows, &filters);
 
         VExprContextSPtrs filter_contexts;
         for (auto& conjunct : _filter_conjuncts) {
@@ -818,95 +817,73 @@ Status RowGroupReader::_rewrite_dict_predicates() {
                     assert_cast<const ColumnString*>(dict_column.get()), &dict_codes));
         }
 
-        // 4. Rewrite conjuncts.
-        _rewrite_dict_conjuncts(dict_codes, slot_id, dict_column->is_nullable());
+        // 4. Rewrite conjuncts. A single code is compared directly, and the rows are looked up in
+        // a mask indexed by code if the predicates match more codes, which is cheaper than
+        // probing a set of the codes.
+        if (dict_codes.size() == 1) {
+            RETURN_IF_ERROR(
+                    _rewrite_dict_conjuncts(dict_codes[0], slot_id, dict_column->is_nullable()));
+        } else {
+            DictCodeMask code_mask;
+            code_mask.col_name = dict_filter_col_name;
+            code_mask.mask.resize(dict_value_column_size, 0);
+            for (int32_t code : dict_codes) {
+                code_mask.mask[code] = 1;
+            }
+            _dict_code_masks.push_back(std::move(code_mask));
+        }
         ++it;
     }
     return Status::OK();
 }
 
-Status RowGroupReader::_rewrite_dict_conjuncts(std::vector<int32_t>& dict_codes, int slot_id,
-                                               bool is_nullable) {
+Status RowGroupReader::_rewrite_dict_conjuncts(int32_t dict_code, int slot_id, bool is_nullable) {
     VExprSPtr root;
-    if (dict_codes.size() == 1) {
-        {
-            TFunction fn;
-            TFunctionName fn_name;
-            fn_name.__set_db_name("");
-            fn_name.__set_function_name("eq");
-            fn.__set_name(fn_name);
-            fn.__set_binary_type(TFunctionBinaryType::BUILTIN);
-            std::vector<TTypeDesc> arg_types;
-            arg_types.push_back(create_type_desc(PrimitiveType::TYPE_INT));
-            arg_types.push_back(create_type_desc(PrimitiveType::TYPE_INT));
-            fn.__set_arg_types(arg_types);
-            fn.__set_ret_type(create_type_desc(PrimitiveType::TYPE_BOOLEAN));
-            fn.__set_has_var_args(false);
-
-            TExprNode texpr_node;
-            texpr_node.__set_type(create_type_desc(PrimitiveType::TYPE_BOOLEAN));
-            texpr_node.__set_node_type(TExprNodeType::BINARY_PRED);
-            texpr_node.__set_opcode(TExprOpcode::EQ);
-            texpr_node.__set_vector_opcode(TExprOpcode::EQ);
-            texpr_node.__set_fn(fn);
-            texpr_node.__set_child_type(TPrimitiveType::INT);
-            texpr_node.__set_num_children(2);
-            texpr_node.__set_is_nullable(is_nullable);
-            root = VectorizedFnCall::create_shared(texpr_node);
-        }
-        {
-            SlotDescriptor* slot = nullptr;
-            const std::vector<SlotDescriptor*>& slots = _tuple_descriptor->slots();
-            for (auto each : slots) {
-                if (each->id() == slot_id) {
-                    slot = each;
-                    break;
-                }
-            }
-            root->add_child(VSlotRef::create_shared(slot));
-        }
-        {
-            TExprNode texpr_node;
-            texpr_node.__set_node_type(TExprNodeType::INT_LITERAL);
-            texpr_node.__set_type(create_type_desc(TYPE_INT));
-            TIntLiteral int_literal;
-            int_literal.__set_value(dict_codes[0]);
-            texpr_node.__set_int_literal(int_literal);
-            texpr_node.__set_is_nullable(is_nullable);
-            root->add_child(VLiteral::create_shared(texpr_node));
-        }
-    } else {
-        {
-            TTypeDesc type_desc = create_type_desc(PrimitiveType::TYPE_BOOLEAN);
-            TExprNode node;
-            node.__set_type(type_desc);
-            node.__set_node_type(TExprNodeType::IN_PRED);
-            node.in_predicate.__set_is_not_in(false);
-            node.__set_opcode(TExprOpcode::FILTER_IN);
-            node.__isset.vector_opcode = true;
-            node.__set_vector_opcode(TExprOpcode::FILTER_IN);
-            // VdirectInPredicate assume is_nullable = false.
-            node.__set_is_nullable(false);
-
-            root = vectorized::VDirectInPredicate::create_shared(node);
-            std::shared_ptr<HybridSetBase> hybrid_set(
-                    create_set(PrimitiveType::TYPE_INT, dict_codes.size()));
-            for (int j = 0; j < dict_codes.size(); ++j) {
-                hybrid_set->insert(&dict_codes[j]);
-            }
-            static_cast<vectorized::VDirectInPredicate*>(root.get())->set_filter(hybrid_set);
-        }
-        {
-            SlotDescriptor* slot = nullptr;
-            const std::vector<SlotDescriptor*>& slots = _tuple_descriptor->slots();
-            for (auto each : slots) {
-                if (each->id() == slot_id) {
-                    slot = each;
-                    break;
-                }
+    {
+        TFunction fn;
+        TFunctionName fn_name;
+        fn_name.__set_db_name("");
+        fn_name.__set_function_name("eq");
+        fn.__set_name(fn_name);
+        fn.__set_binary_type(TFunctionBinaryType::BUILTIN);
+        std::vector<TTypeDesc> arg_types;
+        arg_types.push_back(create_type_desc(PrimitiveType::TYPE_INT));
+        arg_types.push_back(create_type_desc(PrimitiveType::TYPE_INT));
+        fn.__set_arg_types(arg_types);
+        fn.__set_ret_type(create_type_desc(PrimitiveType::TYPE_BOOLEAN));
+        fn.__set_has_var_args(false);
+
+        TExprNode texpr_node;
+        texpr_node.__set_type(create_type_desc(PrimitiveType::TYPE_BOOLEAN));
+        texpr_node.__set_node_type(TExprNodeType::BINARY_PRED);
+        texpr_node.__set_opcode(TExprOpcode::EQ);
+        texpr_node.__set_vector_opcode(TExprOpcode::EQ);
+        texpr_node.__set_fn(fn);
+        texpr_node.__set_child_type(TPrimitiveType::INT);
+        texpr_node.__set_num_children(2);
+        texpr_node.__set_is_nullable(is_nullable);
+        root = VectorizedFnCall::create_shared(texpr_node);
+    }
+    {
+        SlotDescriptor* slot = nullptr;
+        const std::vector<SlotDescriptor*>& slots = _tuple_descriptor->slots();
+        for (auto each : slots) {
+            if (each->id() == slot_id) {
+                slot = each;
+                break;
             }
-            root->add_child(VSlotRef::create_shared(slot));
         }
+        root->add_child(VSlotRef::create_shared(slot));
+    }
+    {
+        TExprNode texpr_node;
+        texpr_node.__set_node_type(TExprNodeType::INT_LITERAL);
+        texpr_node.__set_type(create_type_desc(TYPE_INT));
+        TIntLiteral int_literal;
+        int_literal.__set_value(dict_code);
+        texpr_node.__set_int_literal(int_literal);
+        texpr_node.__set_is_nullable(is_nullable);
+        root->add_child(VLiteral::create_shared(texpr_node));
     }
     VExprContextSPtr rewritten_conjunct_ctx = VExprContext::create_shared(root);
     RETURN_IF_ERROR(rewritten_conjunct_ctx->prepare(_state, *_row_descriptor));
@@ -916,6 +893,37 @@ Status RowGroupReader::_rewrite_dict_conjuncts(std::vector<int32_t>& dict_codes,
     return Status::OK();
 }
 
+void RowGroupReader::_build_dict_code_filters(Block* block, size_t rows,
+                                              std::vector<IColumn::Filter*>* filters) {
+    for (auto& code_mask : _dict_code_masks) {
+        const ColumnPtr& column = block->get_by_name(code_mask.col_name).column;
+        const uint8_t* null_map = nullptr;
+        const ColumnInt32* dict_column = nullptr;
+        if (auto* nullable_column = check_and_get_column<ColumnNullable>(*column)) {
+            null_map = nullable_column->get_null_map_data().data();
+            dict_column =
+                    assert_cast<const ColumnInt32*>(nullable_column->get_nested_column_ptr().get());
+        } else {
+            dict_column = assert_cast<const ColumnInt32*>(column.get());
+        }
+        DCHECK_EQ(dict_column->size(), rows);
+        const auto* __restrict codes = dict_column->get_data().data();
+        const auto* __restrict mask = code_mask.mask.data();
+        const size_t mask_size = code_mask.mask.size();
+        code_mask.filter.resize(rows);
+        auto* __restrict filter_data = code_mask.filter.data();
+        for (size_t i = 0; i < rows; ++i) {
+            filter_data[i] = static_cast<size_t>(codes[i]) < mask_size && mask[codes[i]];
+        }
+        if (null_map != nullptr) {
+            for (size_t i = 0; i < rows; ++i) {
+                filter_data[i] &= !null_map[i];
+            }
+        }
+        filters->push_back(&code_mask.filter);
+    }
+}
+
 void RowGroupReader::_convert_dict_cols_to_string_cols(Block* block) {
     for (auto& dict_filter_cols : _dict_filter_cols) {
         size_t pos = block->get_position_by_name(dict_filter_cols.first);
@@ -184,7 +184,10 @@ private:
     bool _can_filter_by_dict(int slot_id, const tparquet::ColumnMetaData& column_metadata);
     bool is_dictionary_encoded(const tparquet::ColumnMetaData& column_metadata);
     Status _rewrite_dict_predicates();
-    Status _rewrite_dict_conjuncts(std::vector<int32_t>& dict_codes, int slot_id, bool is_nullable);
+    Status _rewrite_dict_conjuncts(int32_t dict_code, int slot_id, bool is_nullable);
+    // Append the filters of the dict filter columns with code masks to filters.
+    void _build_dict_code_filters(Block* block, size_t rows,
+                                  std::vector<IColumn::Filter*>* filters);
     void _convert_dict_cols_to_string_cols(Block* block);
 
     io::FileReaderSPtr _file_reader;
@@ -214,6 +217,14 @@ private:
     VExprContextSPtrs _filter_conjuncts;
     // std::pair<col_name, slot_id>
     std::vector<std::pair<std::string, int>> _dict_filter_cols;
+    // The dict filter column whose predicates match more than one dict code. mask[code] is 1 if
+    // the value of the code satisfies the predicates, filter is reused by the batches.
+    struct DictCodeMask {
+        std::string col_name;
+        std::vector<uint8_t> mask;
+        IColumn::Filter filter;
+    };
+    std::vector<DictCodeMask> _dict_code_masks;
     RuntimeState* _state;
     std::shared_ptr<ObjectPool> _obj_pool;
     bool _is_row_group_filtered = false;
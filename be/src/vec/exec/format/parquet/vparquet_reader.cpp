@@ -28,8 +28,11 @@
 #include <ostream>
 #include <utility>
 
+#include "common/config.h"
 #include "common/status.h"
 #include "io/file_factory.h"
+#include "io/fs/buffered_reader.h"
+#include "io/fs/file_system.h"
 #include "parquet_pred_cmp.h"
 #include "parquet_thrift_util.h"
 #include "runtime/define_primitive_type.h"
@@ -138,6 +141,8 @@ void ParquetReader::_init_profile() {
                 ADD_CHILD_TIMER(_profile, "PageIndexFilterTime", parquet_profile);
         _parquet_profile.row_group_filter_time =
                 ADD_CHILD_TIMER(_profile, "RowGroupFilterTime", parquet_profile);
+        _parquet_profile.row_group_prefetch_io =
+                ADD_CHILD_COUNTER(_profile, "RowGroupPrefetchIO", TUnit::UNIT, parquet_profile);
 
         _parquet_profile.file_read_time = ADD_TIMER(_profile, "FileReadTime");
         _parquet_profile.file_read_calls = ADD_COUNTER(_profile, "FileReadCalls", TUnit::UNIT);
@@ -182,6 +187,8 @@ void ParquetReader::close() {
                            _statistics.page_index_filter_time);
             COUNTER_UPDATE(_parquet_profile.row_group_filter_time,
                            _statistics.row_group_filter_time);
+            COUNTER_UPDATE(_parquet_profile.row_group_prefetch_io,
+                           _statistics.row_group_prefetch_io);
 
             COUNTER_UPDATE(_parquet_profile.file_read_time, _column_statistics.read_time);
             COUNTER_UPDATE(_parquet_profile.file_read_calls, _column_statistics.read_calls);
@@ -225,7 +232,7 @@ Status ParquetReader::_open_file() {
             return Status::EndOfFile("open file failed, empty parquet file: " + _scan_range.path);
         }
         size_t meta_size = 0;
-        if (_meta_cache == nullptr) {
+        if (_meta_cache == nullptr || !_meta_cache->enabled()) {
             _is_file_metadata_owned = true;
             RETURN_IF_ERROR(
                     parse_thrift_footer(_file_reader, &_file_metadata, &meta_size, _io_ctx));
@@ -234,8 +241,10 @@ Status ParquetReader::_open_file() {
             _column_statistics.meta_read_calls += 1;
         } else {
             _is_file_metadata_owned = false;
-            RETURN_IF_ERROR(_meta_cache->get_parquet_footer(_file_reader, _io_ctx, 0, &meta_size,
-                                                            &_cache_handle));
+            int64_t mtime =
+                    _scan_range.__isset.modification_time ? _scan_range.modification_time : 0;
+            RETURN_IF_ERROR(_meta_cache->get_parquet_footer(_file_reader, _io_ctx, mtime,
+                                                            &meta_size, &_cache_handle));
 
             _column_statistics.read_bytes += meta_size;
             if (meta_size > 0) {
@@ -575,7 +584,10 @@ Status ParquetReader::_next_row_group_reader() {
     RowGroupReader::PositionDeleteContext position_delete_ctx =
             _get_position_delete_ctx(row_group, row_group_index);
     io::FileReaderSPtr group_file_reader;
-    if (typeid_cast<io::InMemoryFileReader*>(_file_reader.get())) {
+    if (_prefetch_row_groups(row_group_index)) {
+        // the column chunks are read from the prefetched buffers
+        group_file_reader = _prefetch_reader;
+    } else if (typeid_cast<io::InMemoryFileReader*>(_file_reader.get())) {
         // InMemoryFileReader has the ability to merge small IO
         group_file_reader = _file_reader;
     } else {
@@ -599,6 +611,57 @@ Status ParquetReader::_next_row_group_reader() {
                                        _slot_id_to_filter_conjuncts);
 }
 
+bool ParquetReader::_prefetch_row_groups(const RowGroupReader::RowGroupIndex& current_group) {
+    if (!config::enable_parquet_row_group_prefetch) {
+        return false;
+    }
+    if (_prefetch_reader == nullptr) {
+        if (typeid_cast<io::InMemoryFileReader*>(_file_reader.get()) ||
+            _file_reader->fs() == nullptr ||
+            _file_reader->fs()->type() == io::FileSystemType::LOCAL) {
+            return false;
+        }
+        _prefetch_reader = std::make_shared<io::AsyncRangePrefetchReader>(
+                _file_reader, config::parquet_row_group_prefetch_max_inflight,
+                io::MergeRangeFileReader::MIN_READ_SIZE, io::MergeRangeFileReader::READ_SLICE_SIZE);
+    }
+
+    // The row groups are already filtered by statistics, each plan covers the current row group
+    // and the next ones within the budget. The buffers of the row groups planned last time are
+    // reused, and the buffers of the finished row group are dropped.
+    size_t budget = static_cast<size_t>(config::parquet_row_group_prefetch_budget_mb) << 20;
+    size_t planned_bytes = 0;
+    std::vector<io::PrefetchRange> ranges;
+    auto plan_group = [&](const RowGroupReader::RowGroupIndex& group) {
+        size_t avg_io_size = 0;
+        std::vector<io::PrefetchRange> group_ranges =
+                _generate_random_access_ranges(group, &avg_io_size);
+        size_t group_bytes = 0;
+        for (const auto& range : group_ranges) {
+            group_bytes += range.end_offset - range.start_offset;
+        }
+        if (planned_bytes + group_bytes > budget) {
+            return false;
+        }
+        planned_bytes += group_bytes;
+        ranges.insert(ranges.end(), group_ranges.begin(), group_ranges.end());
+        return true;
+    };
+    if (!plan_group(current_group)) {
+        // drop the buffers of the previous plan
+        _prefetch_reader->prefetch({}, _io_ctx);
+        return false;
+    }
+    int num_next_groups = 0;
+    for (const auto& group : _read_row_groups) {
+        if (num_next_groups++ >= config::parquet_row_group_prefetch_num || !plan_group(group)) {
+            break;
+        }
+    }
+    _statistics.row_group_prefetch_io += _prefetch_reader->prefetch(std::move(ranges), _io_ctx);
+    return true;
+}
+
 Status ParquetReader::_init_row_groups(const bool& is_filter_groups) {
     SCOPED_RAW_TIMER(&_statistics.row_group_filter_time);
     if (is_filter_groups && (_total_groups == 0 || _t_metadata->num_rows == 0 || _range_size < 0)) {
@@ -55,6 +55,7 @@ class TFileScanRangeParams;
 class TupleDescriptor;
 
 namespace io {
+class AsyncRangePrefetchReader;
 class FileSystem;
 class IOContext;
 } // namespace io
@@ -90,6 +91,7 @@ public:
         int64_t open_file_num = 0;
         int64_t row_group_filter_time = 0;
         int64_t page_index_filter_time = 0;
+        int64_t row_group_prefetch_io = 0;
     };
 
     ParquetReader(RuntimeProfile* profile, const TFileScanRangeParams& params,
@@ -166,6 +168,7 @@ private:
         RuntimeProfile::Counter* open_file_num;
         RuntimeProfile::Counter* row_group_filter_time;
         RuntimeProfile::Counter* page_index_filter_time;
+        RuntimeProfile::Counter* row_group_prefetch_io;
 
         RuntimeProfile::Counter* file_read_time;
         RuntimeProfile::Counter* file_read_calls;
@@ -208,6 +211,9 @@ private:
     std::string _meta_cache_key(const std::string& path) { return "meta_" + path; }
     std::vector<io::PrefetchRange> _generate_random_access_ranges(
             const RowGroupReader::RowGroupIndex& group, size_t* avg_io_size);
+    // Prefetch the column chunks of the current row group and the next ones in background.
+    // Return true if the chunks of the current row group are prefetched.
+    bool _prefetch_row_groups(const RowGroupReader::RowGroupIndex& current_group);
 
     RuntimeProfile* _profile;
     const TFileScanRangeParams& _scan_params;
@@ -216,6 +222,8 @@ private:
     FileDescription _file_description;
     std::shared_ptr<io::FileSystem> _file_system = nullptr;
     io::FileReaderSPtr _file_reader = nullptr;
+    // wraps _file_reader to prefetch the next row groups of remote files
+    std::shared_ptr<io::AsyncRangePrefetchReader> _prefetch_reader = nullptr;
     ObjLRUCache::CacheHandle _cache_handle;
     FileMetaData* _file_metadata = nullptr;
     // set to true if _file_metadata is owned by this reader.
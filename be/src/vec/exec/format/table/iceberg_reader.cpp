@@ -36,8 +36,10 @@
 // IWYU pragma: no_include <opentelemetry/common/threadlocal.h>
 #include "common/compiler_util.h" // IWYU pragma: keep
 #include "common/status.h"
+#include "io/fs/file_meta_cache.h"
 #include "olap/olap_common.h"
 #include "runtime/define_primitive_type.h"
+#include "runtime/exec_env.h"
 #include "runtime/primitive_type.h"
 #include "runtime/runtime_state.h"
 #include "runtime/types.h"
@@ -221,6 +223,12 @@ Status IcebergTableReader::_position_delete(
     std::vector<DeleteRows*> delete_rows_array;
     int64_t num_delete_rows = 0;
     std::vector<DeleteFile*> erase_data;
+    // the deleted rows of a delete file are shared by all queries through the file meta cache,
+    // or by the scanners of this scan node through the kv cache if the former is disabled
+    FileMetaCache* meta_cache = ExecEnv::GetInstance()->file_meta_cache();
+    bool use_meta_cache = meta_cache != nullptr && meta_cache->enabled();
+    // hold the cached deleted rows until they are copied out
+    std::vector<ObjLRUCache::CacheHandle> meta_handles;
     for (auto& delete_file : delete_files) {
         if (whole_range.last_row <= delete_file.position_lower_bound ||
             whole_range.first_row > delete_file.position_upper_bound) {
@@ -229,8 +237,7 @@ Status IcebergTableReader::_position_delete(
 
         SCOPED_TIMER(_iceberg_profile.delete_files_read_time);
         Status create_status = Status::OK();
-        DeleteFile* delete_file_cache = _kv_cache->get<
-                DeleteFile>(_delet_file_cache_key(delete_file.path), [&]() -> DeleteFile* {
+        auto read_delete_file = [&]() -> DeleteFile* {
             TFileRangeDesc delete_range;
             delete_range.path = delete_file.path;
             delete_range.start_offset = 0;
@@ -335,7 +342,31 @@ Status IcebergTableReader::_position_delete(
                 }
             }
             return position_delete;
-        });
+        };
+        DeleteFile* delete_file_cache = nullptr;
+        if (use_meta_cache) {
+            std::string cache_key = FileMetaCache::get_key(
+                    FileMetaCache::MetaType::ICEBERG_POSITION_DELETE, delete_file.path, -1, 0);
+            ObjLRUCache::CacheHandle handle;
+            if (!meta_cache->lookup(cache_key, &handle)) {
+                std::unique_ptr<DeleteFile> position_delete(read_delete_file());
+                if (position_delete != nullptr) {
+                    size_t charge = 0;
+                    for (auto& [path, rows] : *position_delete) {
+                        charge += path.size() + rows->size() * sizeof(int64_t);
+                    }
+                    meta_cache->insert(cache_key, std::move(position_delete), charge, &handle);
+                }
+            }
+            if (handle.valid()) {
+                delete_file_cache = static_cast<DeleteFile*>(handle.data());
+                meta_handles.emplace_back(std::move(handle));
+            }
+        } else {
+            delete_file_cache =
+                    _kv_cache->get<DeleteFile>(_delet_file_cache_key(delete_file.path),
+                                               read_delete_file);
+        }
         if (create_status.is<ErrorCode::END_OF_FILE>()) {
             continue;
         } else if (!create_status.ok()) {
@@ -348,7 +379,8 @@ Status IcebergTableReader::_position_delete(
             if (row_ids->size() > 0) {
                 delete_rows_array.emplace_back(row_ids);
                 num_delete_rows += row_ids->size();
-                if (row_ids->front() >= whole_range.first_row &&
+                // the rows in the file meta cache are shared by the other queries
+                if (!use_meta_cache && row_ids->front() >= whole_range.first_row &&
                     row_ids->back() < whole_range.last_row) {
                     erase_data.emplace_back(delete_file_cache);
                 }
@@ -17,6 +17,11 @@
 
 #include "transactional_hive_reader.h"
 
+#include <memory>
+#include <vector>
+
+#include "io/fs/file_meta_cache.h"
+#include "runtime/exec_env.h"
 #include "runtime/runtime_state.h"
 #include "transactional_hive_common.h"
 #include "vec/data_types/data_type_factory.hpp"
@@ -114,6 +119,8 @@ Status TransactionalHiveReader::init_row_filters(const TFileRangeDesc& range) {
     std::filesystem::path file_path(data_file_path);
 
     SCOPED_TIMER(_transactional_orc_profile.delete_files_read_time);
+    // the deleted rows of a delete delta file are shared by all queries
+    FileMetaCache* meta_cache = ExecEnv::GetInstance()->file_meta_cache();
     for (auto& delete_delta : range.table_format_params.transactional_hive_params.delete_deltas) {
         const std::string file_name = file_path.filename().string();
         auto iter = std::find(delete_delta.file_names.begin(), delete_delta.file_names.end(),
@@ -122,6 +129,17 @@ Status TransactionalHiveReader::init_row_filters(const TFileRangeDesc& range) {
             continue;
         }
         auto delete_file = fmt::format("{}/{}", delete_delta.directory_location, file_name);
+        std::string cache_key = FileMetaCache::get_key(
+                FileMetaCache::MetaType::ACID_DELETE_DELTA, delete_file, -1, 0);
+        ObjLRUCache::CacheHandle handle;
+        if (meta_cache != nullptr && meta_cache->lookup(cache_key, &handle)) {
+            const auto& cached_row_ids = *static_cast<std::vector<AcidRowID>*>(handle.data());
+            _delete_rows.insert(cached_row_ids.begin(), cached_row_ids.end());
+            num_delete_rows += cached_row_ids.size();
+            ++num_delete_files;
+            continue;
+        }
+        auto delete_row_ids = std::make_unique<std::vector<AcidRowID>>();
 
         TFileRangeDesc delete_range;
         delete_range.path = delete_file;
@@ -175,11 +193,16 @@ Status TransactionalHiveReader::init_row_filters(const TFileRangeDesc& range) {
                     Int64 row_id = row_id_column.get_int(i);
                     AcidRowID delete_row_id = {original_transaction, bucket_id, row_id};
                     _delete_rows.insert(delete_row_id);
+                    delete_row_ids->push_back(delete_row_id);
                     ++num_delete_rows;
                 }
             }
         }
         ++num_delete_files;
+        if (meta_cache != nullptr) {
+            size_t charge = delete_row_ids->size() * sizeof(AcidRowID);
+            meta_cache->insert(cache_key, std::move(delete_row_ids), charge, &handle);
+        }
     }
     if (num_delete_rows > 0) {
         orc_reader->set_delete_rows(&_delete_rows);
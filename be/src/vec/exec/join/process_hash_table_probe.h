@@ -79,11 +79,20 @@ struct ProcessHashTableProbe {
     Status process_data_in_hashtable(HashTableType& hash_table_ctx, MutableBlock& mutable_block,
                                      Block* output_block, bool* eos);
 
+    // Compute the hash values of all the probe rows at once, so that the lookup and the prefetch
+    // of each row share one hash computation.
+    template <typename HashTableType, typename KeyGetter>
+    void _compute_probe_side_hash_values(HashTableType& hash_table_ctx, KeyGetter& key_getter,
+                                         size_t probe_rows);
+
+    void set_batch_size(int batch_size) { _batch_size = batch_size; }
+
     vectorized::HashJoinNode* _join_node;
-    const int _batch_size;
+    int _batch_size;
     const std::vector<Block>& _build_blocks;
     std::unique_ptr<Arena> _arena;
     std::vector<StringRef> _probe_keys;
+    std::vector<size_t> _probe_side_hash_values;
 
     std::vector<uint32_t> _items_counts;
     std::vector<int8_t> _build_block_offsets;
@@ -97,6 +106,7 @@ struct ProcessHashTableProbe {
     RuntimeProfile::Counter* _search_hashtable_timer;
     RuntimeProfile::Counter* _build_side_output_timer;
     RuntimeProfile::Counter* _probe_side_output_timer;
+    RuntimeProfile::Counter* _probe_side_compute_hash_timer;
 
     static constexpr int PROBE_SIDE_EXPLODE_RATE = 3;
 };
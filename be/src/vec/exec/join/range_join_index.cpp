@@ -0,0 +1,232 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "vec/exec/join/range_join_index.h"
+
+#include <gen_cpp/Exprs_types.h>
+#include <glog/logging.h>
+
+#include <algorithm>
+#include <string>
+
+#include "util/interval_tree-inl.h"
+#include "util/interval_tree.h"
+#include "vec/columns/column.h"
+#include "vec/columns/column_const.h"
+#include "vec/columns/column_nullable.h"
+#include "vec/data_types/data_type.h"
+#include "vec/data_types/data_type_nullable.h"
+#include "vec/exprs/vexpr.h"
+#include "vec/exprs/vexpr_context.h"
+#include "vec/exprs/vslot_ref.h"
+
+namespace doris::vectorized {
+
+struct RangeJoinIndex::IntervalTraits {
+    using point_type = Point;
+    using interval_type = Interval;
+
+    static point_type get_left(const interval_type& interval) { return interval.left; }
+    static point_type get_right(const interval_type& interval) { return interval.right; }
+
+    static int compare(const point_type& a, const point_type& b) {
+        return a.column->compare_at(a.row, b.row, *b.column, 1);
+    }
+};
+
+// The types ordered by compare_at the same way as by the comparison functions, which are not
+// the floats for NaN and not the old dates, stored as packed date time values.
+static bool is_index_type(const DataTypePtr& probe_type, const DataTypePtr& build_type) {
+    auto type = remove_nullable(probe_type);
+    if (!type->equals(*remove_nullable(build_type))) {
+        return false;
+    }
+    WhichDataType which(type);
+    return which.is_int_or_uint() || which.is_decimal() || which.is_date_v2() ||
+           which.is_date_time_v2() || which.is_string();
+}
+
+// Sets the value column of a build column, the null map is set if it is nullable.
+static const IColumn* unpack_build_column(const IColumn& column, const NullMap** null_map) {
+    if (const auto* nullable = check_and_get_column<ColumnNullable>(column)) {
+        *null_map = &nullable->get_null_map_data();
+        return &nullable->get_nested_column();
+    }
+    *null_map = nullptr;
+    return &column;
+}
+
+// Sets the value column and row of a probe value, returns false if it is null.
+static bool unpack_probe_value(const IColumn& column, size_t row, const IColumn** values,
+                               size_t* value_row) {
+    const IColumn* data = &column;
+    if (const auto* const_column = check_and_get_column<ColumnConst>(data)) {
+        data = &const_column->get_data_column();
+        row = 0;
+    }
+    if (const auto* nullable = check_and_get_column<ColumnNullable>(data)) {
+        if (nullable->is_null_at(row)) {
+            return false;
+        }
+        data = &nullable->get_nested_column();
+    }
+    *values = data;
+    *value_row = row;
+    return true;
+}
+
+bool RangeJoinIndex::find_bounds(const VExprContextSPtrs& conjuncts, size_t num_probe_columns,
+                                 size_t num_build_columns, std::vector<Bound>* bounds) {
+    bounds->clear();
+    for (const auto& conjunct : conjuncts) {
+        const auto& root = conjunct->root();
+        if (root->node_type() != TExprNodeType::BINARY_PRED || root->children().size() != 2) {
+            continue;
+        }
+        const std::string& name = root->fn().name.function_name;
+        bool is_less = name == "lt" || name == "le";
+        if (!is_less && name != "gt" && name != "ge") {
+            continue;
+        }
+        const auto& left = root->children()[0];
+        const auto& right = root->children()[1];
+        if (!left->is_slot_ref() || !right->is_slot_ref()) {
+            continue;
+        }
+        size_t left_column = static_cast<const VSlotRef*>(left.get())->column_id();
+        size_t right_column = static_cast<const VSlotRef*>(right.get())->column_id();
+        size_t num_columns = num_probe_columns + num_build_columns;
+        if (left_column < num_probe_columns && right_column >= num_probe_columns &&
+            right_column < num_columns) {
+            // probe < build, the build column is an upper bound
+            if (is_index_type(left->data_type(), right->data_type())) {
+                bounds->push_back({left_column, right_column, !is_less});
+            }
+        } else if (right_column < num_probe_columns && left_column >= num_probe_columns &&
+                   left_column < num_columns) {
+            if (is_index_type(right->data_type(), left->data_type())) {
+                bounds->push_back({right_column, left_column, is_less});
+            }
+        }
+    }
+    return !bounds->empty();
+}
+
+RangeJoinIndex::RangeJoinIndex(const std::vector<Bound>& bounds, size_t num_probe_columns)
+        : _bound(bounds.front()), _num_probe_columns(num_probe_columns) {
+    for (const auto& lower : bounds) {
+        if (!lower.is_lower) {
+            continue;
+        }
+        for (const auto& upper : bounds) {
+            if (!upper.is_lower && upper.probe_column == lower.probe_column) {
+                _bound = lower;
+                _upper = std::make_unique<Bound>(upper);
+                return;
+            }
+        }
+    }
+}
+
+RangeJoinIndex::~RangeJoinIndex() = default;
+
+Status RangeJoinIndex::build(Blocks* build_blocks) {
+    DCHECK(!build_blocks->empty());
+    MutableBlock merged;
+    for (auto& block : *build_blocks) {
+        RETURN_IF_ERROR(merged.merge(block));
+        block.clear();
+    }
+    Blocks blocks;
+    blocks.emplace_back(merged.to_block());
+    build_blocks->swap(blocks);
+
+    const Block& block = build_blocks->front();
+    const int rows = block.rows();
+    const NullMap* null_map = nullptr;
+    _values = unpack_build_column(
+            *block.get_by_position(_bound.build_column - _num_probe_columns).column, &null_map);
+
+    if (_upper != nullptr) {
+        const NullMap* upper_null_map = nullptr;
+        _upper_values = unpack_build_column(
+                *block.get_by_position(_upper->build_column - _num_probe_columns).column,
+                &upper_null_map);
+        std::vector<Interval> intervals;
+        intervals.reserve(rows);
+        for (int row = 0; row < rows; ++row) {
+            if ((null_map != nullptr && (*null_map)[row]) ||
+                (upper_null_map != nullptr && (*upper_null_map)[row])) {
+                continue;
+            }
+            // an empty interval matches nothing
+            if (_values->compare_at(row, row, *_upper_values, 1) > 0) {
+                continue;
+            }
+            intervals.push_back({{_values, size_t(row)}, {_upper_values, size_t(row)}, row});
+        }
+        _tree = std::make_unique<IntervalTree<IntervalTraits>>(intervals);
+        return Status::OK();
+    }
+
+    _sorted_rows.reserve(rows);
+    for (int row = 0; row < rows; ++row) {
+        if (null_map == nullptr || !(*null_map)[row]) {
+            _sorted_rows.push_back(row);
+        }
+    }
+    std::sort(_sorted_rows.begin(), _sorted_rows.end(),
+              [&](int a, int b) { return _values->compare_at(a, b, *_values, 1) < 0; });
+    return Status::OK();
+}
+
+void RangeJoinIndex::lookup(const Block& probe_block, size_t row,
+                            std::vector<int>* build_rows) const {
+    build_rows->clear();
+    const IColumn* probe_values = nullptr;
+    size_t probe_row = 0;
+    if (!unpack_probe_value(*probe_block.get_by_position(_bound.probe_column).column, row,
+                            &probe_values, &probe_row)) {
+        return;
+    }
+
+    if (_tree != nullptr) {
+        std::vector<Interval> intervals;
+        _tree->FindContainingPoint(Point {probe_values, probe_row}, &intervals);
+        build_rows->reserve(intervals.size());
+        for (const auto& interval : intervals) {
+            build_rows->push_back(interval.build_row);
+        }
+        return;
+    }
+
+    if (_bound.is_lower) {
+        // the prefix of the build values not greater than the probe value
+        auto end = std::partition_point(_sorted_rows.begin(), _sorted_rows.end(), [&](int r) {
+            return _values->compare_at(r, probe_row, *probe_values, 1) <= 0;
+        });
+        build_rows->assign(_sorted_rows.begin(), end);
+    } else {
+        // the suffix of the build values not less than the probe value
+        auto begin = std::partition_point(_sorted_rows.begin(), _sorted_rows.end(), [&](int r) {
+            return _values->compare_at(r, probe_row, *probe_values, 1) < 0;
+        });
+        build_rows->assign(begin, _sorted_rows.end());
+    }
+}
+
+} // namespace doris::vectorized
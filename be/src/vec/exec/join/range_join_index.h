@@ -0,0 +1,97 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <stddef.h>
+
+#include <memory>
+#include <vector>
+
+#include "common/status.h"
+#include "vec/core/block.h"
+#include "vec/exprs/vexpr_fwd.h"
+
+namespace doris {
+template <class Traits>
+class IntervalTree;
+} // namespace doris
+
+namespace doris::vectorized {
+
+class IColumn;
+
+// Looks up the build rows that a probe row of a nested loop join may match by the range
+// conjuncts `probe_slot op build_slot` of the join, e.g. `a.ts >= b.start and a.ts < b.end`,
+// instead of joining the probe row with all the build rows.
+//
+// The build blocks are merged into one block. With a lower and an upper bound of the same probe
+// column, the build rows are put into an interval tree of their bounds. With a single bound, they
+// are sorted by the build column and a probe row may match a prefix or a suffix of them. The rows
+// looked up are a superset of the matches, the join conjuncts still have to be evaluated.
+class RangeJoinIndex {
+public:
+    // build_column <= probe_column if is_lower, build_column >= probe_column otherwise. The
+    // columns are positions in the join block, the build columns follow the probe ones.
+    struct Bound {
+        size_t probe_column;
+        size_t build_column;
+        bool is_lower;
+    };
+
+    // Finds the bounds of the join conjuncts, which are prepared against the join block.
+    // Returns false if there is none that the index can use.
+    static bool find_bounds(const VExprContextSPtrs& conjuncts, size_t num_probe_columns,
+                            size_t num_build_columns, std::vector<Bound>* bounds);
+
+    RangeJoinIndex(const std::vector<Bound>& bounds, size_t num_probe_columns);
+    ~RangeJoinIndex();
+
+    // Merges the build blocks into one and indexes its rows.
+    Status build(Blocks* build_blocks);
+
+    // Sets the rows of the merged build block that the probe row may match, in no order.
+    void lookup(const Block& probe_block, size_t row, std::vector<int>* build_rows) const;
+
+    bool use_interval_tree() const { return _upper != nullptr; }
+
+    struct Point {
+        const IColumn* column;
+        size_t row;
+    };
+    struct Interval {
+        Point left;
+        Point right;
+        int build_row;
+    };
+    struct IntervalTraits;
+
+private:
+    // The single bound, or the lower one of the interval with _upper.
+    Bound _bound;
+    std::unique_ptr<Bound> _upper;
+    size_t _num_probe_columns;
+
+    // The value columns of the build block without the null maps.
+    const IColumn* _values = nullptr;
+    const IColumn* _upper_values = nullptr;
+    // The non null build rows sorted by _values.
+    std::vector<int> _sorted_rows;
+    std::unique_ptr<IntervalTree<IntervalTraits>> _tree;
+};
+
+} // namespace doris::vectorized
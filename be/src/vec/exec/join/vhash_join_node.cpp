@@ -27,6 +27,7 @@
 #include <array>
 #include <boost/iterator/iterator_facade.hpp>
 #include <functional>
+#include <limits>
 #include <map>
 #include <memory>
 #include <new>
@@ -43,12 +44,15 @@
 #include "exprs/runtime_filter.h"
 #include "exprs/runtime_filter_slots.h"
 #include "gutil/strings/substitute.h"
+#include "runtime/block_spill_manager.h"
 #include "runtime/define_primitive_type.h"
 #include "runtime/descriptors.h"
+#include "runtime/exec_env.h"
 #include "runtime/query_context.h"
 #include "runtime/runtime_filter_mgr.h"
 #include "runtime/runtime_state.h"
 #include "runtime/thread_context.h"
+#include "util/countdown_latch.h"
 #include "util/defer_op.h"
 #include "util/telemetry/telemetry.h"
 #include "util/uid_util.h"
@@ -58,6 +62,7 @@
 #include "vec/common/hash_table/hash_map.h"
 #include "vec/common/uint128.h"
 #include "vec/core/column_with_type_and_name.h"
+#include "vec/core/materialize_block.h"
 #include "vec/data_types/data_type.h"
 #include "vec/data_types/data_type_nullable.h"
 #include "vec/data_types/data_type_number.h"
@@ -201,6 +206,17 @@ struct ProcessHashTableBuild {
             }
         }
 
+        const int parallel_build_threads = _parallel_build_threads();
+        if (parallel_build_threads > 1) {
+            RETURN_IF_ERROR(_parallel_emplace<ignore_null>(hash_table_ctx, null_map,
+                                                           parallel_build_threads));
+            COUNTER_UPDATE(_join_node->_build_table_expanse_timer,
+                           hash_table_ctx.hash_table.get_resize_timer_value());
+            COUNTER_UPDATE(_join_node->_build_table_convert_timer,
+                           hash_table_ctx.hash_table.get_convert_timer_value());
+            return Status::OK();
+        }
+
         bool build_unique = _join_node->_build_unique;
 #define EMPLACE_IMPL(stmt)                                                                  \
     for (size_t k = 0; k < _rows; ++k) {                                                    \
@@ -264,6 +280,125 @@ struct ProcessHashTableBuild {
     }
 
 private:
+    int _parallel_build_threads() const {
+        // Only the builder of a hash table shared by a broadcast join is built in parallel, the
+        // other instances are idle while waiting for it, other joins keep all cores busy anyway.
+        if (_join_node->_shared_hashtable_controller == nullptr ||
+            _rows < config::hash_join_parallel_build_min_rows) {
+            return 1;
+        }
+        return std::min<int>(config::hash_join_parallel_build_threads,
+                             HashTableContext::HashTable::get_sub_table_count());
+    }
+
+    // Every thread scans all the rows but only emplaces the ones hashed to its own sub tables of
+    // the partitioned hash table, so the sub tables are filled concurrently without any lock.
+    // The rows of the same key always go to the same thread in their original order, so the
+    // result is the same as the serial build.
+    template <bool ignore_null>
+    Status _parallel_emplace(HashTableContext& hash_table_ctx, ConstNullMapPtr null_map,
+                             int num_threads) {
+        using KeyGetter = typename HashTableContext::State;
+        using Mapped = typename HashTableContext::Mapped;
+        using HashTable = typename HashTableContext::HashTable;
+
+        hash_table_ctx.hash_table.ensure_partitioned();
+
+        auto& arenas = _join_node->_parallel_build_arenas;
+        while (arenas.size() < num_threads) {
+            arenas.emplace_back(std::make_shared<Arena>());
+        }
+        size_t old_arenas_memory = 0;
+        for (auto& arena : arenas) {
+            old_arenas_memory += arena->size();
+        }
+
+        const bool has_runtime_filter = !_join_node->_runtime_filter_descs.empty();
+        const bool build_unique = _join_node->_build_unique;
+        std::vector<std::vector<int>> thread_inserted_rows(num_threads);
+        std::vector<size_t> thread_bf_cardinality(num_threads, 0);
+        std::vector<Status> thread_status(num_threads);
+
+        auto emplace_sub_tables = [&](int thread_idx) -> Status {
+            KeyGetter key_getter(_build_raw_ptrs, _join_node->_build_key_sz, nullptr);
+            if constexpr (ColumnsHashing::IsPreSerializedKeysHashMethodTraits<KeyGetter>::value) {
+                key_getter.set_serialized_keys(hash_table_ctx.keys.data());
+            }
+            auto& arena = *arenas[thread_idx];
+            auto& inserted_rows = thread_inserted_rows[thread_idx];
+            for (size_t k = 0; k < _rows; ++k) {
+                if (k % 65536 == 0) {
+                    RETURN_IF_CANCELLED(_state);
+                }
+                if constexpr (ignore_null) {
+                    if ((*null_map)[k]) {
+                        continue;
+                    }
+                }
+                const auto hash_value = _build_side_hash_values[k];
+                if (HashTable::get_sub_table_from_hash(hash_value) % num_threads != thread_idx) {
+                    continue;
+                }
+                auto emplace_result =
+                        key_getter.emplace_key(hash_table_ctx.hash_table, hash_value, k, arena);
+                if (emplace_result.is_inserted()) {
+                    new (&emplace_result.get_mapped()) Mapped({k, _offset});
+                    if (has_runtime_filter) {
+                        inserted_rows.push_back(k);
+                        thread_bf_cardinality[thread_idx]++;
+                    }
+                } else if (!build_unique) {
+                    emplace_result.get_mapped().insert({k, _offset}, arena);
+                    if (has_runtime_filter) {
+                        inserted_rows.push_back(k);
+                    }
+                }
+            }
+            return Status::OK();
+        };
+
+        {
+            SCOPED_TIMER(_join_node->_build_table_parallel_insert_timer);
+            CountDownLatch latch(num_threads - 1);
+            for (int i = 1; i < num_threads; ++i) {
+                auto st = _state->exec_env()->join_node_thread_pool()->submit_func(
+                        [&, i, state = _state] {
+                            SCOPED_ATTACH_TASK(state);
+                            thread_status[i] = emplace_sub_tables(i);
+                            latch.count_down();
+                        });
+                if (!st.ok()) {
+                    // Fall back to building the sub tables of this thread in the current one.
+                    thread_status[i] = emplace_sub_tables(i);
+                    latch.count_down();
+                }
+            }
+            thread_status[0] = emplace_sub_tables(0);
+            latch.wait();
+        }
+
+        for (auto& st : thread_status) {
+            RETURN_IF_ERROR(st);
+        }
+
+        if (has_runtime_filter) {
+            auto& inserted_rows = _join_node->_inserted_rows[&_acquired_block];
+            for (int i = 0; i < num_threads; ++i) {
+                inserted_rows.insert(inserted_rows.end(), thread_inserted_rows[i].begin(),
+                                     thread_inserted_rows[i].end());
+                _join_node->_build_bf_cardinality += thread_bf_cardinality[i];
+            }
+        }
+
+        size_t arenas_memory = 0;
+        for (auto& arena : arenas) {
+            arenas_memory += arena->size();
+        }
+        _join_node->_build_arena_memory_usage->add(arenas_memory - old_arenas_memory);
+        COUNTER_SET(_join_node->_build_parallel_threads_counter, int64_t(num_threads));
+        return Status::OK();
+    }
+
     const int _rows;
     int _skip_rows;
     Block& _acquired_block;
@@ -291,6 +426,10 @@ struct ProcessRuntimeFilterBuild {
 
         RETURN_IF_ERROR(_join_node->_runtime_filter_slots->init(
                 state, hash_table_ctx.hash_table.get_size(), _join_node->_build_bf_cardinality));
+        if (!_join_node->_runtime_filter_slots->decisions().empty()) {
+            _join_node->runtime_profile()->add_info_string(
+                    "RuntimeFilterDecisions", _join_node->_runtime_filter_slots->decisions());
+        }
 
         if (!_join_node->_runtime_filter_slots->empty() && !_join_node->_inserted_rows.empty()) {
             {
@@ -394,7 +533,7 @@ Status HashJoinNode::init(const TPlanNode& tnode, RuntimeState* state) {
     for (size_t i = 0; i < _runtime_filter_descs.size(); i++) {
         RETURN_IF_ERROR(state->runtime_filter_mgr()->register_filter(
                 RuntimeFilterRole::PRODUCER, _runtime_filter_descs[i], state->query_options(), -1,
-                _probe_expr_ctxs.size() == 1));
+                true));
         RETURN_IF_ERROR(state->runtime_filter_mgr()->get_producer_filter(
                 _runtime_filter_descs[i].filter_id, &_runtime_filters[i]));
     }
@@ -457,6 +596,10 @@ Status HashJoinNode::prepare(RuntimeState* state) {
     _build_expr_call_timer = ADD_TIMER(record_profile, "BuildExprCallTime");
     _build_table_expanse_timer = ADD_TIMER(record_profile, "BuildTableExpanseTime");
     _build_table_convert_timer = ADD_TIMER(record_profile, "BuildTableConvertToPartitionedTime");
+    _build_table_parallel_insert_timer =
+            ADD_CHILD_TIMER(record_profile, "BuildTableParallelInsertTime", "BuildTableInsertTime");
+    _build_parallel_threads_counter =
+            ADD_COUNTER(record_profile, "BuildTableParallelThreads", TUnit::UNIT);
     _build_side_compute_hash_timer = ADD_TIMER(record_profile, "BuildSideHashComputingTime");
     _build_runtime_filter_timer = ADD_TIMER(record_profile, "BuildRuntimeFilterTime");
 
@@ -470,12 +613,35 @@ Status HashJoinNode::prepare(RuntimeState* state) {
             ADD_CHILD_TIMER(probe_phase_profile, "ProbeWhenBuildSideOutputTime", "ProbeTime");
     _probe_side_output_timer =
             ADD_CHILD_TIMER(probe_phase_profile, "ProbeWhenProbeSideOutputTime", "ProbeTime");
+    _probe_side_compute_hash_timer =
+            ADD_CHILD_TIMER(probe_phase_profile, "ProbeWhenComputeHashTime", "ProbeTime");
     _open_timer = ADD_TIMER(runtime_profile(), "OpenTime");
     _allocate_resource_timer = ADD_TIMER(runtime_profile(), "AllocateResourceTime");
     _process_other_join_conjunct_timer = ADD_TIMER(runtime_profile(), "OtherJoinConjunctTime");
 
     _build_buckets_counter = ADD_COUNTER(runtime_profile(), "BuildBuckets", TUnit::UNIT);
     _build_buckets_fill_counter = ADD_COUNTER(runtime_profile(), "FilledBuckets", TUnit::UNIT);
+    if (state->preferred_block_size_bytes() > 0) {
+        _adaptive_batch_size_counter =
+                ADD_COUNTER(probe_phase_profile, "AdaptiveBatchSize", TUnit::UNIT);
+    }
+
+    _external_join_bytes_threshold = state->external_join_bytes_threshold();
+    // Null aware left anti join and mark join depend on whether there is any null in the whole
+    // build side, and a shared hash table is used by other instances, so they are never spilled.
+    if (_join_op == TJoinOp::NULL_AWARE_LEFT_ANTI_JOIN || _is_mark_join ||
+        _shared_hashtable_controller) {
+        _external_join_bytes_threshold = 0;
+    }
+    if (_external_join_bytes_threshold > 0) {
+        // skip the bits used by PartitionedHashTable to choose sub table.
+        _spill_partition_helper = std::make_unique<SpillPartitionHelper>(
+                state->external_join_partition_bits(), 4);
+        _build_side_reservation.init(state->query_mem_tracker());
+        _spill_build_rows_counter = ADD_COUNTER(runtime_profile(), "SpillBuildRows", TUnit::UNIT);
+        _spill_probe_rows_counter = ADD_COUNTER(runtime_profile(), "SpillProbeRows", TUnit::UNIT);
+        _spill_partition_timer = ADD_TIMER(runtime_profile(), "SpillPartitionTime");
+    }
 
     RETURN_IF_ERROR(VExpr::prepare(_build_expr_ctxs, state, child(1)->row_desc()));
     RETURN_IF_ERROR(VExpr::prepare(_probe_expr_ctxs, state, child(0)->row_desc()));
@@ -529,6 +695,14 @@ Status HashJoinNode::pull(doris::RuntimeState* state, vectorized::Block* output_
         *eos = true;
         return Status::OK();
     }
+    if (_spill_context.has_data) {
+        return _pull_with_spilled_data(state, output_block, eos);
+    }
+    return _pull_impl(state, output_block, eos, _probe_eos);
+}
+
+Status HashJoinNode::_pull_impl(RuntimeState* state, Block* output_block, bool* eos,
+                                bool probe_eos) {
     _join_block.clear_column_data();
 
     MutableBlock mutable_join_block(&_join_block);
@@ -575,7 +749,7 @@ Status HashJoinNode::pull(doris::RuntimeState* state, vectorized::Block* output_
                     make_bool_variant(_need_null_map_for_probe),
                     make_bool_variant(_probe_ignore_null));
         });
-    } else if (_probe_eos) {
+    } else if (probe_eos) {
         if (_is_right_semi_anti || (_is_outer_join && _join_op != TJoinOp::LEFT_OUTER_JOIN)) {
             std::visit(
                     [&](auto&& arg, auto&& process_hashtable_ctx) {
@@ -618,39 +792,75 @@ Status HashJoinNode::pull(doris::RuntimeState* state, vectorized::Block* output_
     return Status::OK();
 }
 
-Status HashJoinNode::push(RuntimeState* /*state*/, vectorized::Block* input_block, bool eos) {
+Status HashJoinNode::push(RuntimeState* state, vectorized::Block* input_block, bool eos) {
     _probe_eos = eos;
     if (input_block->rows() > 0) {
         COUNTER_UPDATE(_probe_rows_counter, input_block->rows());
-        int probe_expr_ctxs_sz = _probe_expr_ctxs.size();
-        _probe_columns.resize(probe_expr_ctxs_sz);
-
-        std::vector<int> res_col_ids(probe_expr_ctxs_sz);
-        RETURN_IF_ERROR(
-                _do_evaluate(*input_block, _probe_expr_ctxs, *_probe_expr_call_timer, res_col_ids));
-        if (_join_op == TJoinOp::RIGHT_OUTER_JOIN || _join_op == TJoinOp::FULL_OUTER_JOIN) {
-            _probe_column_convert_to_null = _convert_block_to_null(*input_block);
-        }
-        // TODO: Now we are not sure whether a column is nullable only by ExecNode's `row_desc`
-        //  so we have to initialize this flag by the first probe block.
-        if (!_has_set_need_null_map_for_probe) {
-            _has_set_need_null_map_for_probe = true;
-            _need_null_map_for_probe = _need_probe_null_map(*input_block, res_col_ids);
-        }
-        if (_need_null_map_for_probe) {
-            if (_null_map_column == nullptr) {
-                _null_map_column = ColumnUInt8::create();
+        if (_spill_context.has_data) {
+            RETURN_IF_ERROR(_spill_probe_block(state, *input_block));
+        } else {
+            RETURN_IF_ERROR(_prepare_probe_columns(*input_block));
+            if (UNLIKELY(_adaptive_batch_size == 0) && _adaptive_batch_size_counter) {
+                _update_adaptive_batch_size(state, *input_block);
+            }
+            if (&_probe_block != input_block) {
+                input_block->swap(_probe_block);
             }
-            _null_map_column->get_data().assign(input_block->rows(), (uint8_t)0);
         }
+    }
+    if (eos && _spill_context.has_data) {
+        RETURN_IF_ERROR(JoinSpillContext::close_writers(_spill_context.probe_writers));
+    }
+    return Status::OK();
+}
+
+void HashJoinNode::_update_adaptive_batch_size(RuntimeState* state, const Block& probe_block) {
+    size_t build_bytes = 0;
+    size_t build_rows = 0;
+    for (const auto& block : *_build_blocks) {
+        build_bytes += block.bytes();
+        build_rows += block.rows();
+    }
+    size_t row_bytes = probe_block.bytes() / probe_block.rows();
+    if (build_rows > 0) {
+        row_bytes += build_bytes / build_rows;
+    }
+    _adaptive_batch_size = state->adaptive_batch_size(row_bytes);
+    COUNTER_SET(_adaptive_batch_size_counter, static_cast<int64_t>(_adaptive_batch_size));
+
+    std::visit(
+            [&](auto&& process_hashtable_ctx) {
+                using HashTableProbeType = std::decay_t<decltype(process_hashtable_ctx)>;
+                if constexpr (!std::is_same_v<HashTableProbeType, std::monostate>) {
+                    process_hashtable_ctx.set_batch_size(_adaptive_batch_size);
+                }
+            },
+            *_process_hashtable_ctx_variants);
+}
 
-        RETURN_IF_ERROR(_extract_join_column<false>(*input_block, _null_map_column, _probe_columns,
-                                                    res_col_ids));
-        if (&_probe_block != input_block) {
-            input_block->swap(_probe_block);
+Status HashJoinNode::_prepare_probe_columns(Block& block) {
+    int probe_expr_ctxs_sz = _probe_expr_ctxs.size();
+    _probe_columns.resize(probe_expr_ctxs_sz);
+
+    std::vector<int> res_col_ids(probe_expr_ctxs_sz);
+    RETURN_IF_ERROR(_do_evaluate(block, _probe_expr_ctxs, *_probe_expr_call_timer, res_col_ids));
+    if (_join_op == TJoinOp::RIGHT_OUTER_JOIN || _join_op == TJoinOp::FULL_OUTER_JOIN) {
+        _probe_column_convert_to_null = _convert_block_to_null(block);
+    }
+    // TODO: Now we are not sure whether a column is nullable only by ExecNode's `row_desc`
+    //  so we have to initialize this flag by the first probe block.
+    if (!_has_set_need_null_map_for_probe) {
+        _has_set_need_null_map_for_probe = true;
+        _need_null_map_for_probe = _need_probe_null_map(block, res_col_ids);
+    }
+    if (_need_null_map_for_probe) {
+        if (_null_map_column == nullptr) {
+            _null_map_column = ColumnUInt8::create();
         }
+        _null_map_column->get_data().assign(block.rows(), (uint8_t)0);
     }
-    return Status::OK();
+
+    return _extract_join_column<false>(block, _null_map_column, _probe_columns, res_col_ids);
 }
 
 Status HashJoinNode::get_next(RuntimeState* state, Block* output_block, bool* eos) {
@@ -662,7 +872,7 @@ Status HashJoinNode::get_next(RuntimeState* state, Block* output_block, bool* eo
         return Status::OK();
     }
 
-    if (_join_op == TJoinOp::RIGHT_OUTER_JOIN) {
+    if (_join_op == TJoinOp::RIGHT_OUTER_JOIN && !_spill_context.has_data) {
         const auto hash_table_empty = std::visit(
                 Overload {[&](std::monostate&) -> bool {
                               LOG(FATAL) << "FATAL: uninited hash table";
@@ -803,9 +1013,6 @@ Status HashJoinNode::_materialize_build_side(RuntimeState* state) {
 Status HashJoinNode::sink(doris::RuntimeState* state, vectorized::Block* in_block, bool eos) {
     SCOPED_TIMER(_build_timer);
 
-    // make one block for each 4 gigabytes
-    constexpr static auto BUILD_BLOCK_MAX_SIZE = 4 * 1024UL * 1024UL * 1024UL;
-
     if (_short_circuit_for_null_in_probe_side) {
         // TODO: if _short_circuit_for_null_in_probe_side is true we should finish current pipeline task.
         DCHECK(state->enable_pipeline_exec());
@@ -816,43 +1023,40 @@ Status HashJoinNode::sink(doris::RuntimeState* state, vectorized::Block* in_bloc
         // data from probe side.
         _build_side_mem_used += in_block->allocated_bytes();
 
-        if (in_block->rows() != 0) {
-            SCOPED_TIMER(_build_side_merge_block_timer);
-            RETURN_IF_ERROR(_build_side_mutable_block.merge(*in_block));
-        }
-
-        if (UNLIKELY(_build_side_mem_used - _build_side_last_mem_used > BUILD_BLOCK_MAX_SIZE)) {
-            if (_build_blocks->size() == _MAX_BUILD_BLOCK_COUNT) {
-                return Status::NotSupported(
-                        strings::Substitute("data size of right table in hash join > $0",
-                                            BUILD_BLOCK_MAX_SIZE * _MAX_BUILD_BLOCK_COUNT));
+        if (_spill_context.has_data) {
+            if (in_block->rows() != 0) {
+                RETURN_IF_ERROR(_spill_build_block(state, *in_block));
+            }
+        } else {
+            if (in_block->rows() != 0) {
+                SCOPED_TIMER(_build_side_merge_block_timer);
+                RETURN_IF_ERROR(_build_side_mutable_block.merge(*in_block));
             }
-            _build_blocks->emplace_back(_build_side_mutable_block.to_block());
-
-            COUNTER_UPDATE(_build_blocks_memory_usage, (*_build_blocks)[_build_block_idx].bytes());
-
-            // TODO:: Rethink may we should do the process after we receive all build blocks ?
-            // which is better.
-            RETURN_IF_ERROR(_process_build_block(state, (*_build_blocks)[_build_block_idx],
-                                                 _build_block_idx));
 
-            _build_side_mutable_block = MutableBlock();
-            ++_build_block_idx;
-            _build_side_last_mem_used = _build_side_mem_used;
+            // expect the next build block is as large as this one
+            if (_external_join_bytes_threshold > 0 &&
+                (_build_side_mem_used >= _external_join_bytes_threshold ||
+                 !_build_side_reservation.try_resize(in_block->allocated_bytes()))) {
+                _build_side_reservation.release();
+                RETURN_IF_ERROR(_spill_build_side(state));
+            } else if (UNLIKELY(_build_side_mem_used - _build_side_last_mem_used >
+                                _BUILD_BLOCK_MAX_SIZE)) {
+                // TODO:: Rethink may we should do the process after we receive all build blocks ?
+                // which is better.
+                RETURN_IF_ERROR(_flush_build_side_mutable_block(state));
+            }
         }
     }
 
-    if (_should_build_hash_table && eos) {
+    if (eos) {
+        _build_side_reservation.release();
+    }
+    if (_should_build_hash_table && eos && _spill_context.has_data) {
+        RETURN_IF_ERROR(JoinSpillContext::close_writers(_spill_context.build_writers));
+        RETURN_IF_ERROR(_ignore_runtime_filters(state));
+    } else if (_should_build_hash_table && eos) {
         if (!_build_side_mutable_block.empty()) {
-            if (_build_blocks->size() == _MAX_BUILD_BLOCK_COUNT) {
-                return Status::NotSupported(
-                        strings::Substitute("data size of right table in hash join > $0",
-                                            BUILD_BLOCK_MAX_SIZE * _MAX_BUILD_BLOCK_COUNT));
-            }
-            _build_blocks->emplace_back(_build_side_mutable_block.to_block());
-            COUNTER_UPDATE(_build_blocks_memory_usage, (*_build_blocks)[_build_block_idx].bytes());
-            RETURN_IF_ERROR(_process_build_block(state, (*_build_blocks)[_build_block_idx],
-                                                 _build_block_idx));
+            RETURN_IF_ERROR(_flush_build_side_mutable_block(state));
         }
         auto ret = std::visit(Overload {[&](std::monostate&) -> Status {
                                             LOG(FATAL) << "FATAL: uninited hash table";
@@ -876,6 +1080,7 @@ Status HashJoinNode::sink(doris::RuntimeState* state, vectorized::Block* in_bloc
             _shared_hash_table_context->status = Status::OK();
             // arena will be shared with other instances.
             _shared_hash_table_context->arena = _arena;
+            _shared_hash_table_context->parallel_build_arenas = _parallel_build_arenas;
             _shared_hash_table_context->blocks = _build_blocks;
             _shared_hash_table_context->hash_table_variants = _hash_table_variants;
             _shared_hash_table_context->short_circuit_for_null_in_probe_side =
@@ -943,6 +1148,272 @@ Status HashJoinNode::sink(doris::RuntimeState* state, vectorized::Block* in_bloc
     return Status::OK();
 }
 
+Status HashJoinNode::_flush_build_side_mutable_block(RuntimeState* state) {
+    if (_build_blocks->size() == _MAX_BUILD_BLOCK_COUNT) {
+        return Status::NotSupported(
+                strings::Substitute("data size of right table in hash join > $0",
+                                    _BUILD_BLOCK_MAX_SIZE * _MAX_BUILD_BLOCK_COUNT));
+    }
+    _build_blocks->emplace_back(_build_side_mutable_block.to_block());
+    COUNTER_UPDATE(_build_blocks_memory_usage, (*_build_blocks)[_build_block_idx].bytes());
+    RETURN_IF_ERROR(
+            _process_build_block(state, (*_build_blocks)[_build_block_idx], _build_block_idx));
+
+    _build_side_mutable_block = MutableBlock();
+    ++_build_block_idx;
+    _build_side_last_mem_used = _build_side_mem_used;
+    return Status::OK();
+}
+
+Status HashJoinNode::_spill_build_side(RuntimeState* state) {
+    DCHECK(!_spill_context.has_data);
+    _spill_context.has_data = true;
+    _spill_context.runtime_profile = runtime_profile()->create_child("Spill", true, true);
+    RETURN_IF_ERROR(_spill_context.init_writers(_spill_partition_helper->partition_count,
+                                                state->batch_size()));
+
+    for (auto& build_block : *_build_blocks) {
+        // remove the build key columns appended by `_process_build_block`
+        build_block.erase_tail(_right_table_data_types.size());
+        RETURN_IF_ERROR(_spill_build_block(state, std::move(build_block)));
+    }
+    if (!_build_side_mutable_block.empty()) {
+        RETURN_IF_ERROR(_spill_build_block(state, _build_side_mutable_block.to_block()));
+    }
+
+    _reset_build_side(state);
+    return Status::OK();
+}
+
+Status HashJoinNode::_spill_build_block(RuntimeState* state, Block block) {
+    SCOPED_TIMER(_spill_partition_timer);
+    if (block.rows() == 0) {
+        return Status::OK();
+    }
+    COUNTER_UPDATE(_spill_build_rows_counter, block.rows());
+
+    materialize_block_inplace(block);
+    // keep the same structure as the blocks processed by `_process_build_block`
+    if (_join_op == TJoinOp::LEFT_OUTER_JOIN || _join_op == TJoinOp::FULL_OUTER_JOIN) {
+        _convert_block_to_null(block);
+    }
+
+    std::vector<size_t> partition_indices;
+    RETURN_IF_ERROR(_get_spill_partition_indices<true>(block, partition_indices));
+
+    std::vector<Block> partitioned_blocks;
+    _spill_partition_helper->split_block(block, partition_indices, partitioned_blocks);
+    for (size_t i = 0; i < partitioned_blocks.size(); ++i) {
+        if (partitioned_blocks[i].rows() > 0) {
+            RETURN_IF_ERROR(_spill_context.build_writers[i]->write(partitioned_blocks[i]));
+        }
+    }
+    return Status::OK();
+}
+
+Status HashJoinNode::_spill_probe_block(RuntimeState* state, Block& block) {
+    SCOPED_TIMER(_spill_partition_timer);
+    COUNTER_UPDATE(_spill_probe_rows_counter, block.rows());
+
+    materialize_block_inplace(block);
+
+    std::vector<size_t> partition_indices;
+    RETURN_IF_ERROR(_get_spill_partition_indices<false>(block, partition_indices));
+
+    std::vector<Block> partitioned_blocks;
+    _spill_partition_helper->split_block(block, partition_indices, partitioned_blocks);
+    for (size_t i = 0; i < partitioned_blocks.size(); ++i) {
+        if (partitioned_blocks[i].rows() > 0) {
+            RETURN_IF_ERROR(_spill_context.probe_writers[i]->write(partitioned_blocks[i]));
+        }
+    }
+    release_block_memory(block);
+    return Status::OK();
+}
+
+template <bool BuildSide>
+Status HashJoinNode::_get_spill_partition_indices(Block& block,
+                                                  std::vector<size_t>& partition_indices) {
+    auto& expr_ctxs = BuildSide ? _build_expr_ctxs : _probe_expr_ctxs;
+    auto& key_sizes = BuildSide ? _build_key_sz : _probe_key_sz;
+    const auto rows = block.rows();
+
+    // evaluate the join keys on a shallow copy, the key columns are not spilled.
+    Block evaluated_block = block;
+    std::vector<int> res_col_ids(expr_ctxs.size());
+    RETURN_IF_ERROR(_do_evaluate(evaluated_block, expr_ctxs,
+                                 BuildSide ? *_build_expr_call_timer : *_probe_expr_call_timer,
+                                 res_col_ids));
+    if constexpr (!BuildSide) {
+        if (_join_op == TJoinOp::RIGHT_OUTER_JOIN || _join_op == TJoinOp::FULL_OUTER_JOIN) {
+            _convert_block_to_null(evaluated_block);
+        }
+    }
+
+    ColumnRawPtrs raw_ptrs(expr_ctxs.size());
+    auto null_map = ColumnUInt8::create();
+    null_map->get_data().assign(rows, (uint8_t)0);
+    RETURN_IF_ERROR(
+            _extract_join_column<BuildSide>(evaluated_block, null_map, raw_ptrs, res_col_ids));
+
+    partition_indices.resize(rows);
+    std::visit(Overload {[&](std::monostate& arg) {
+                             LOG(FATAL) << "FATAL: uninited hash table";
+                             __builtin_unreachable();
+                         },
+                         [&](auto&& arg) {
+                             using HashTableCtxType = std::decay_t<decltype(arg)>;
+                             using KeyGetter = typename HashTableCtxType::State;
+
+                             KeyGetter key_getter(raw_ptrs, key_sizes, nullptr);
+                             Arena arena;
+                             std::vector<StringRef> serialized_keys;
+                             if constexpr (ColumnsHashing::IsPreSerializedKeysHashMethodTraits<
+                                                   KeyGetter>::value) {
+                                 serialized_keys.resize(rows);
+                                 for (size_t i = 0; i < rows; ++i) {
+                                     serialized_keys[i] = serialize_keys_to_pool_contiguous(
+                                             i, raw_ptrs.size(), raw_ptrs, arena);
+                                 }
+                                 key_getter.set_serialized_keys(serialized_keys.data());
+                             }
+
+                             for (size_t i = 0; i < rows; ++i) {
+                                 size_t hash_value;
+                                 if constexpr (ColumnsHashing::IsPreSerializedKeysHashMethodTraits<
+                                                       KeyGetter>::value) {
+                                     hash_value = arg.hash_table.hash(
+                                             key_getter.get_key_holder(i, arena).key);
+                                 } else {
+                                     hash_value =
+                                             arg.hash_table.hash(key_getter.get_key_holder(i, arena));
+                                 }
+                                 partition_indices[i] =
+                                         _spill_partition_helper->get_index(hash_value);
+                             }
+                         }},
+               *_hash_table_variants);
+    return Status::OK();
+}
+
+Status HashJoinNode::_pull_with_spilled_data(RuntimeState* state, Block* output_block,
+                                             bool* eos) {
+    DCHECK(_probe_eos);
+    while (true) {
+        if (!_spill_context.partition_loaded) {
+            if (_spill_context.read_cursor == _spill_partition_helper->partition_count) {
+                *eos = true;
+                return Status::OK();
+            }
+            RETURN_IF_ERROR(_load_spilled_partition(state));
+        }
+
+        if (_probe_index == _probe_block.rows() && !_spill_context.probe_partition_eos) {
+            RETURN_IF_ERROR(_read_spilled_probe_block(state));
+            continue;
+        }
+
+        bool partition_eos = false;
+        RETURN_IF_ERROR(_pull_impl(state, output_block, &partition_eos,
+                                   _spill_context.probe_partition_eos));
+        if (reached_limit()) {
+            *eos = true;
+            return Status::OK();
+        }
+        if (partition_eos) {
+            _spill_context.probe_reader.reset();
+            _spill_context.partition_loaded = false;
+            _spill_context.read_cursor++;
+        }
+        if (output_block->rows() > 0) {
+            return Status::OK();
+        }
+    }
+}
+
+Status HashJoinNode::_load_spilled_partition(RuntimeState* state) {
+    auto* manager = ExecEnv::GetInstance()->block_spill_mgr();
+    const auto partition = _spill_context.read_cursor;
+    _reset_build_side(state);
+
+    {
+        SCOPED_TIMER(_build_timer);
+        BlockSpillReaderUPtr build_reader;
+        RETURN_IF_ERROR(manager->get_reader(_spill_context.build_stream_ids[partition],
+                                            build_reader, _spill_context.runtime_profile, true));
+        bool build_eos = false;
+        while (!build_eos) {
+            Block block;
+            RETURN_IF_ERROR(build_reader->read(&block, &build_eos));
+            if (block.rows() == 0) {
+                continue;
+            }
+            _build_side_mem_used += block.allocated_bytes();
+            RETURN_IF_ERROR(_build_side_mutable_block.merge(block));
+            if (UNLIKELY(_build_side_mem_used - _build_side_last_mem_used >
+                         _BUILD_BLOCK_MAX_SIZE)) {
+                RETURN_IF_ERROR(_flush_build_side_mutable_block(state));
+            }
+        }
+        RETURN_IF_ERROR(build_reader->close());
+        if (!_build_side_mutable_block.empty()) {
+            RETURN_IF_ERROR(_flush_build_side_mutable_block(state));
+        }
+    }
+    _process_hashtable_ctx_variants_init(state);
+
+    RETURN_IF_ERROR(manager->get_reader(_spill_context.probe_stream_ids[partition],
+                                        _spill_context.probe_reader,
+                                        _spill_context.runtime_profile, true));
+    // the probe rows of this partition are never output if the build side of it is empty
+    _spill_context.probe_partition_eos = _can_skip_probe();
+    _probe_index = 0;
+    _prepare_probe_block();
+    _probe_column_convert_to_null.clear();
+    _probe_block.clear();
+    _spill_context.partition_loaded = true;
+    return Status::OK();
+}
+
+Status HashJoinNode::_read_spilled_probe_block(RuntimeState* state) {
+    _probe_index = 0;
+    _prepare_probe_block();
+    _probe_column_convert_to_null.clear();
+
+    bool partition_eos = false;
+    RETURN_IF_ERROR(_spill_context.probe_reader->read(&_probe_block, &partition_eos));
+    if (partition_eos) {
+        _spill_context.probe_partition_eos = true;
+    }
+    if (_probe_block.rows() > 0) {
+        RETURN_IF_ERROR(_prepare_probe_columns(_probe_block));
+    }
+    return Status::OK();
+}
+
+void HashJoinNode::_reset_build_side(RuntimeState* state) {
+    // `_build_blocks` is referenced by the probe process, so it is cleared in place.
+    _build_blocks->clear();
+    _inserted_rows.clear();
+    _build_block_idx = 0;
+    _build_bf_cardinality = 0;
+    _build_side_mutable_block = MutableBlock();
+    _build_side_mem_used = 0;
+    _build_side_last_mem_used = 0;
+    _arena = std::make_shared<Arena>();
+    _parallel_build_arenas.clear();
+    _hash_table_init(state);
+}
+
+Status HashJoinNode::_ignore_runtime_filters(RuntimeState* state) {
+    if (_runtime_filter_descs.empty()) {
+        return Status::OK();
+    }
+    _runtime_filter_slots = std::make_shared<VRuntimeFilterSlots>(
+            _probe_expr_ctxs, _build_expr_ctxs, _runtime_filter_descs);
+    return _runtime_filter_slots->init_ignored(state, "build side of hash join is spilled");
+}
+
 void HashJoinNode::debug_string(int indentation_level, std::stringstream* out) const {
     *out << string(indentation_level * 2, ' ');
     *out << "HashJoin(need_more_input_data=" << (need_more_input_data() ? "true" : "false")
@@ -1118,6 +1589,13 @@ void HashJoinNode::_hash_table_init(RuntimeState* state) {
                     case TYPE_INT:
                     case TYPE_FLOAT:
                     case TYPE_DATEV2:
+                        if constexpr (std::is_same_v<RowRefListType, RowRefList>) {
+                            if (config::enable_join_swiss_hash_table) {
+                                _hash_table_variants
+                                        ->emplace<I32SwissHashTableContext<RowRefList>>();
+                                break;
+                            }
+                        }
                         _hash_table_variants->emplace<I32HashTableContext<RowRefListType>>();
                         break;
                     case TYPE_BIGINT:
@@ -1125,6 +1603,13 @@ void HashJoinNode::_hash_table_init(RuntimeState* state) {
                     case TYPE_DATETIME:
                     case TYPE_DATE:
                     case TYPE_DATETIMEV2:
+                        if constexpr (std::is_same_v<RowRefListType, RowRefList>) {
+                            if (config::enable_join_swiss_hash_table) {
+                                _hash_table_variants
+                                        ->emplace<I64SwissHashTableContext<RowRefList>>();
+                                break;
+                            }
+                        }
                         _hash_table_variants->emplace<I64HashTableContext<RowRefListType>>();
                         break;
                     case TYPE_LARGEINT:
@@ -1234,7 +1719,8 @@ void HashJoinNode::_process_hashtable_ctx_variants_init(RuntimeState* state) {
             [&](auto&& join_op_variants) {
                 using JoinOpType = std::decay_t<decltype(join_op_variants)>;
                 _process_hashtable_ctx_variants->emplace<ProcessHashTableProbe<JoinOpType::value>>(
-                        this, state->batch_size());
+                        this, _adaptive_batch_size > 0 ? _adaptive_batch_size
+                                                       : state->batch_size());
             },
             _join_op_variants);
 }
@@ -1264,6 +1750,7 @@ HashJoinNode::~HashJoinNode() {
 
 void HashJoinNode::_release_mem() {
     _arena = nullptr;
+    _parallel_build_arenas.clear();
     _hash_table_variants = nullptr;
     _process_hashtable_ctx_variants = nullptr;
     _null_map_column = nullptr;
@@ -1273,4 +1760,48 @@ void HashJoinNode::_release_mem() {
     _probe_block.clear();
 }
 
+Status JoinSpillContext::init_writers(size_t partition_count, int32_t probe_batch_size) {
+    auto* manager = ExecEnv::GetInstance()->block_spill_mgr();
+    build_writers.resize(partition_count);
+    probe_writers.resize(partition_count);
+    for (size_t i = 0; i < partition_count; ++i) {
+        // the build side of a partition is read back as a whole.
+        RETURN_IF_ERROR(manager->get_writer(std::numeric_limits<int32_t>::max(),
+                                            build_writers[i], runtime_profile));
+        build_stream_ids.emplace_back(build_writers[i]->get_id());
+        RETURN_IF_ERROR(manager->get_writer(probe_batch_size, probe_writers[i], runtime_profile));
+        probe_stream_ids.emplace_back(probe_writers[i]->get_id());
+    }
+    return Status::OK();
+}
+
+Status JoinSpillContext::close_writers(std::vector<BlockSpillWriterUPtr>& writers) {
+    for (auto& writer : writers) {
+        if (writer) {
+            RETURN_IF_ERROR(writer->close());
+            writer.reset();
+        }
+    }
+    return Status::OK();
+}
+
+JoinSpillContext::~JoinSpillContext() {
+    if (!has_data) {
+        return;
+    }
+    close_writers(build_writers);
+    close_writers(probe_writers);
+    probe_reader.reset();
+
+    // delete the files of the partitions which are not joined, e.g. the query is cancelled.
+    auto* manager = ExecEnv::GetInstance()->block_spill_mgr();
+    for (size_t i = partition_loaded ? read_cursor + 1 : read_cursor; i < build_stream_ids.size();
+         ++i) {
+        BlockSpillReaderUPtr reader;
+        manager->get_reader(build_stream_ids[i], reader, runtime_profile, true);
+        reader.reset();
+        manager->get_reader(probe_stream_ids[i], reader, runtime_profile, true);
+    }
+}
+
 } // namespace doris::vectorized
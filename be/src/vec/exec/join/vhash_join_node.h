@@ -31,6 +31,7 @@
 #include "common/global_types.h"
 #include "common/status.h"
 #include "exprs/runtime_filter_slots.h"
+#include "runtime/memory/mem_reservation.h"
 #include "util/runtime_profile.h"
 #include "vec/aggregate_functions/aggregate_function.h"
 #include "vec/columns/column.h"
@@ -41,6 +42,9 @@
 #include "vec/common/hash_table/partitioned_hash_map.h"
 #include "vec/common/string_ref.h"
 #include "vec/core/block.h"
+#include "vec/core/block_spill_reader.h"
+#include "vec/core/block_spill_writer.h"
+#include "vec/core/spill_partition_helper.h"
 #include "vec/core/types.h"
 #include "vec/exec/join/join_op.h" // IWYU pragma: keep
 #include "vec/exprs/vexpr_fwd.h"
@@ -124,6 +128,35 @@ struct PrimaryTypeHashTableContext {
     }
 };
 
+// Same as PrimaryTypeHashTableContext, but the hash table is a swiss table (phmap), which probes
+// a group of slots at once by comparing their control bytes with SIMD, instead of comparing the
+// keys of the cells one by one in linear probing. It usually does better when most probes miss.
+// Only used by the joins without flags, see HashJoinNode::_hash_table_init.
+template <class T, typename RowRefListType>
+struct SwissPrimaryTypeHashTableContext {
+    using Mapped = RowRefListType;
+    using HashTable = PHPartitionedHashMap<T, Mapped, HashCRC32<T>>;
+    using State =
+            ColumnsHashing::HashMethodOneNumber<typename HashTable::value_type, Mapped, T, false>;
+    using Iter = typename HashTable::iterator;
+
+    HashTable hash_table;
+    Iter iter;
+    bool inited = false;
+
+    void init_once() {
+        if (!inited) {
+            inited = true;
+            iter = hash_table.begin();
+        }
+    }
+};
+
+template <typename RowRefListType>
+using I32SwissHashTableContext = SwissPrimaryTypeHashTableContext<UInt32, RowRefListType>;
+template <typename RowRefListType>
+using I64SwissHashTableContext = SwissPrimaryTypeHashTableContext<UInt64, RowRefListType>;
+
 // TODO: use FixedHashTable instead of HashTable
 template <typename RowRefListType>
 using I8HashTableContext = PrimaryTypeHashTableContext<UInt8, RowRefListType>;
@@ -176,8 +209,9 @@ using HashTableVariants = std::variant<
         I128FixedKeyHashTableContext<true, RowRefList>,
         I128FixedKeyHashTableContext<false, RowRefList>,
         I256FixedKeyHashTableContext<true, RowRefList>,
-        I256FixedKeyHashTableContext<false, RowRefList>,
-        SerializedHashTableContext<RowRefListWithFlag>, I8HashTableContext<RowRefListWithFlag>,
+        I256FixedKeyHashTableContext<false, RowRefList>, I32SwissHashTableContext<RowRefList>,
+        I64SwissHashTableContext<RowRefList>, SerializedHashTableContext<RowRefListWithFlag>,
+        I8HashTableContext<RowRefListWithFlag>,
         I16HashTableContext<RowRefListWithFlag>, I32HashTableContext<RowRefListWithFlag>,
         I64HashTableContext<RowRefListWithFlag>, I128HashTableContext<RowRefListWithFlag>,
         I256HashTableContext<RowRefListWithFlag>,
@@ -216,6 +250,34 @@ using HashTableIteratorVariants =
         std::variant<std::monostate, ForwardIterator<RowRefList>,
                      ForwardIterator<RowRefListWithFlag>, ForwardIterator<RowRefListWithFlags>>;
 
+// State of the grace hash join.
+//
+// Once the build side takes more memory than `external_join_bytes_threshold`, the build rows
+// and then the probe rows are hash partitioned into one spill stream per partition, the
+// partitions are joined one by one after the probe side reaches eos.
+struct JoinSpillContext {
+    bool has_data = false;
+
+    RuntimeProfile* runtime_profile = nullptr;
+
+    std::vector<BlockSpillWriterUPtr> build_writers;
+    std::vector<BlockSpillWriterUPtr> probe_writers;
+    std::vector<int64_t> build_stream_ids;
+    std::vector<int64_t> probe_stream_ids;
+
+    /// the partition being joined
+    size_t read_cursor = 0;
+    bool partition_loaded = false;
+    bool probe_partition_eos = false;
+    BlockSpillReaderUPtr probe_reader;
+
+    Status init_writers(size_t partition_count, int32_t probe_batch_size);
+
+    static Status close_writers(std::vector<BlockSpillWriterUPtr>& writers);
+
+    ~JoinSpillContext();
+};
+
 class HashJoinNode final : public VJoinNodeBase {
 public:
     // TODO: Best prefetch step is decided by machine. We should also provide a
@@ -261,14 +323,19 @@ public:
 
 private:
     void _init_short_circuit_for_probe() override {
-        _short_circuit_for_probe =
-                (_short_circuit_for_null_in_probe_side &&
-                 _join_op == TJoinOp::NULL_AWARE_LEFT_ANTI_JOIN) ||
-                (_build_blocks->empty() && _join_op == TJoinOp::INNER_JOIN && !_is_mark_join) ||
-                (_build_blocks->empty() && _join_op == TJoinOp::LEFT_SEMI_JOIN && !_is_mark_join) ||
-                (_build_blocks->empty() && _join_op == TJoinOp::RIGHT_OUTER_JOIN) ||
-                (_build_blocks->empty() && _join_op == TJoinOp::RIGHT_SEMI_JOIN) ||
-                (_build_blocks->empty() && _join_op == TJoinOp::RIGHT_ANTI_JOIN);
+        // When the build side is spilled, `_build_blocks` only holds the partition being joined,
+        // so whether the probe side can be skipped is decided for each partition.
+        _short_circuit_for_probe = !_spill_context.has_data && _can_skip_probe();
+    }
+
+    bool _can_skip_probe() const {
+        return (_short_circuit_for_null_in_probe_side &&
+                _join_op == TJoinOp::NULL_AWARE_LEFT_ANTI_JOIN) ||
+               (_build_blocks->empty() && _join_op == TJoinOp::INNER_JOIN && !_is_mark_join) ||
+               (_build_blocks->empty() && _join_op == TJoinOp::LEFT_SEMI_JOIN && !_is_mark_join) ||
+               (_build_blocks->empty() && _join_op == TJoinOp::RIGHT_OUTER_JOIN) ||
+               (_build_blocks->empty() && _join_op == TJoinOp::RIGHT_SEMI_JOIN) ||
+               (_build_blocks->empty() && _join_op == TJoinOp::RIGHT_ANTI_JOIN);
     }
 
     // probe expr
@@ -295,6 +362,8 @@ private:
     RuntimeProfile::Counter* _build_table_insert_timer;
     RuntimeProfile::Counter* _build_table_expanse_timer;
     RuntimeProfile::Counter* _build_table_convert_timer;
+    RuntimeProfile::Counter* _build_table_parallel_insert_timer;
+    RuntimeProfile::Counter* _build_parallel_threads_counter;
     RuntimeProfile::Counter* _probe_expr_call_timer;
     RuntimeProfile::Counter* _probe_next_timer;
     RuntimeProfile::Counter* _build_buckets_counter;
@@ -302,6 +371,7 @@ private:
     RuntimeProfile::Counter* _search_hashtable_timer;
     RuntimeProfile::Counter* _build_side_output_timer;
     RuntimeProfile::Counter* _probe_side_output_timer;
+    RuntimeProfile::Counter* _probe_side_compute_hash_timer;
     RuntimeProfile::Counter* _build_side_compute_hash_timer;
     RuntimeProfile::Counter* _build_side_merge_block_timer;
     RuntimeProfile::Counter* _build_runtime_filter_timer;
@@ -317,6 +387,9 @@ private:
     RuntimeProfile::HighWaterMarkCounter* _probe_arena_memory_usage;
 
     std::shared_ptr<Arena> _arena;
+    // One arena per thread for the parallel build, the mapped row lists and keys in the hash
+    // table are allocated from them.
+    std::vector<std::shared_ptr<Arena>> _parallel_build_arenas;
 
     // maybe share hash table with other fragment instances
     std::shared_ptr<HashTableVariants> _hash_table_variants;
@@ -361,8 +434,58 @@ private:
 
     SharedHashTableContextPtr _shared_hash_table_context = nullptr;
 
+    // 0 means the build side is never spilled
+    int64_t _external_join_bytes_threshold = 0;
+    std::unique_ptr<SpillPartitionHelper> _spill_partition_helper;
+    JoinSpillContext _spill_context;
+    // reserved for the next build block, the build side is spilled if denied
+    MemReservation _build_side_reservation;
+
+    RuntimeProfile::Counter* _spill_build_rows_counter = nullptr;
+    RuntimeProfile::Counter* _spill_probe_rows_counter = nullptr;
+    RuntimeProfile::Counter* _spill_partition_timer = nullptr;
+
+    // the max rows of output blocks adapted to the width of output rows, 0 means not chosen
+    // yet, only used when preferred_block_size_bytes is set
+    int _adaptive_batch_size = 0;
+    RuntimeProfile::Counter* _adaptive_batch_size_counter = nullptr;
+
     Status _materialize_build_side(RuntimeState* state) override;
 
+    Status _pull_impl(RuntimeState* state, Block* output_block, bool* eos, bool probe_eos);
+
+    Status _prepare_probe_columns(Block& block);
+
+    // Estimate the width of output rows by the first probe block and the build side.
+    void _update_adaptive_batch_size(RuntimeState* state, const Block& probe_block);
+
+    Status _flush_build_side_mutable_block(RuntimeState* state);
+
+    // Spill the build side which has been received and switch to grace hash join.
+    Status _spill_build_side(RuntimeState* state);
+
+    // `block` only holds the columns of the build side, it is copied since
+    // the build key columns are appended to it.
+    Status _spill_build_block(RuntimeState* state, Block block);
+
+    Status _spill_probe_block(RuntimeState* state, Block& block);
+
+    template <bool BuildSide>
+    Status _get_spill_partition_indices(Block& block, std::vector<size_t>& partition_indices);
+
+    Status _pull_with_spilled_data(RuntimeState* state, Block* output_block, bool* eos);
+
+    // Build the hash table of the next spilled partition.
+    Status _load_spilled_partition(RuntimeState* state);
+
+    Status _read_spilled_probe_block(RuntimeState* state);
+
+    void _reset_build_side(RuntimeState* state);
+
+    // The runtime filters are built from the whole build side, which is never in memory
+    // once it is spilled, so they are ignored.
+    Status _ignore_runtime_filters(RuntimeState* state);
+
     Status _process_build_block(RuntimeState* state, Block& block, uint8_t offset);
 
     Status _do_evaluate(Block& block, VExprContextSPtrs& exprs,
@@ -380,6 +503,8 @@ private:
     void _process_hashtable_ctx_variants_init(RuntimeState* state);
 
     static constexpr auto _MAX_BUILD_BLOCK_COUNT = 128;
+    // make one block for each 4 gigabytes
+    static constexpr auto _BUILD_BLOCK_MAX_SIZE = 4 * 1024UL * 1024UL * 1024UL;
 
     void _prepare_probe_block();
 
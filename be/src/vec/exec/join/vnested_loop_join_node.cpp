@@ -34,6 +34,7 @@
 
 // IWYU pragma: no_include <opentelemetry/common/threadlocal.h>
 #include "common/compiler_util.h" // IWYU pragma: keep
+#include "common/config.h"
 #include "common/status.h"
 #include "exec/exec_node.h"
 #include "exprs/runtime_filter.h"
@@ -56,6 +57,7 @@
 #include "vec/data_types/data_type_number.h"
 #include "vec/exprs/vexpr.h"
 #include "vec/exprs/vexpr_context.h"
+#include "vec/exprs/vslot_ref.h"
 #include "vec/utils/template_helpers.hpp"
 
 namespace doris {
@@ -64,6 +66,9 @@ class ObjectPool;
 
 namespace doris::vectorized {
 
+// The fewest rows of a build tile, so that the conjuncts are not evaluated on too few rows.
+static constexpr size_t MIN_BUILD_TILE_ROWS = 1024;
+
 struct RuntimeFilterBuild {
     RuntimeFilterBuild(VNestedLoopJoinNode* join_node) : _join_node(join_node) {}
 
@@ -131,6 +136,19 @@ Status VNestedLoopJoinNode::init(const TPlanNode& tnode, RuntimeState* state) {
     return Status::OK();
 }
 
+// Marks the probe columns referenced by the slots of the expr.
+static void mark_probe_columns(const VExprSPtr& expr, std::vector<bool>* probe_columns) {
+    if (expr->is_slot_ref()) {
+        int column_id = static_cast<const VSlotRef*>(expr.get())->column_id();
+        if (column_id >= 0 && static_cast<size_t>(column_id) < probe_columns->size()) {
+            (*probe_columns)[column_id] = true;
+        }
+    }
+    for (const auto& child : expr->children()) {
+        mark_probe_columns(child, probe_columns);
+    }
+}
+
 Status VNestedLoopJoinNode::prepare(RuntimeState* state) {
     SCOPED_TIMER(_runtime_profile->total_time_counter());
     RETURN_IF_ERROR(VJoinNodeBase::prepare(state));
@@ -148,8 +166,13 @@ Status VNestedLoopJoinNode::prepare(RuntimeState* state) {
     }
     _num_probe_side_columns = child(0)->row_desc().num_materialized_slots();
     _num_build_side_columns = child(1)->row_desc().num_materialized_slots();
+    _conjunct_probe_columns.assign(_num_probe_side_columns, false);
+    for (auto& conjunct : _join_conjuncts) {
+        mark_probe_columns(conjunct->root(), &_conjunct_probe_columns);
+    }
     RETURN_IF_ERROR(VExpr::prepare(_output_expr_ctxs, state, *_intermediate_row_desc));
     RETURN_IF_ERROR(VExpr::prepare(_filter_src_expr_ctxs, state, child(1)->row_desc()));
+    _range_join_build_timer = ADD_TIMER(runtime_profile(), "RangeJoinIndexBuildTime");
 
     _construct_mutable_join_block();
     return Status::OK();
@@ -221,6 +244,30 @@ Status VNestedLoopJoinNode::sink(doris::RuntimeState* state, vectorized::Block*
              (_join_op == TJoinOp::type::LEFT_ANTI_JOIN && !_build_blocks.empty()))) {
             _left_side_eos = true;
         }
+
+        // The build side flags are kept per build block, which are merged by the index.
+        if (config::enable_nested_loop_range_join_index && !_old_version_flag &&
+            !_is_output_left_side_only && !_is_mark_join && !_build_blocks.empty() &&
+            !(_match_all_build || _is_right_semi_anti)) {
+            std::vector<RangeJoinIndex::Bound> bounds;
+            if (RangeJoinIndex::find_bounds(_join_conjuncts, _num_probe_side_columns,
+                                            _num_build_side_columns, &bounds)) {
+                SCOPED_TIMER(_range_join_build_timer);
+                _range_join_index =
+                        std::make_unique<RangeJoinIndex>(bounds, _num_probe_side_columns);
+                RETURN_IF_ERROR(_range_join_index->build(&_build_blocks));
+                _runtime_profile->add_info_string(
+                        "RangeJoinIndex",
+                        _range_join_index->use_interval_tree() ? "IntervalTree" : "Sorted");
+            }
+        }
+
+        if (config::enable_nested_loop_join_tiling && !_old_version_flag && !_is_mark_join &&
+            !_is_output_left_side_only && _range_join_index == nullptr &&
+            (_join_op == TJoinOp::INNER_JOIN || _join_op == TJoinOp::CROSS_JOIN)) {
+            _use_tiled_join = true;
+            _split_build_blocks_into_tiles();
+        }
     }
 
     return Status::OK();
@@ -231,6 +278,9 @@ Status VNestedLoopJoinNode::push(doris::RuntimeState* state, vectorized::Block*
     _cur_probe_row_visited_flags.resize(block->rows());
     std::fill(_cur_probe_row_visited_flags.begin(), _cur_probe_row_visited_flags.end(), 0);
     _left_block_pos = 0;
+    _range_build_rows_probe_row = -1;
+    _tile_probe_end = 0;
+    _tile_build_pos = _build_blocks.size();
     _need_more_input_data = false;
     _left_side_eos = eos;
 
@@ -346,6 +396,182 @@ void VNestedLoopJoinNode::_process_left_child_block(MutableBlock& mutable_block,
     }
 }
 
+void VNestedLoopJoinNode::_process_left_child_range_rows(MutableBlock& mutable_block,
+                                                         size_t batch_size) {
+    if (_range_build_rows_probe_row != _left_block_pos) {
+        _range_join_index->lookup(_left_block, _left_block_pos, &_range_build_rows);
+        _range_build_rows_probe_row = _left_block_pos;
+        _range_build_rows_pos = 0;
+    }
+    auto& dst_columns = mutable_block.mutable_columns();
+    const size_t num_rows = std::min(_range_build_rows.size() - _range_build_rows_pos,
+                                     batch_size - std::min(batch_size, mutable_block.rows()));
+    const int* build_rows_begin = _range_build_rows.data() + _range_build_rows_pos;
+    const int* build_rows_end = build_rows_begin + num_rows;
+    for (size_t i = 0; i < _num_probe_side_columns; ++i) {
+        const ColumnWithTypeAndName& src_column = _left_block.get_by_position(i);
+        if (!src_column.column->is_nullable() && dst_columns[i]->is_nullable()) {
+            auto origin_sz = dst_columns[i]->size();
+            DCHECK(_join_op == TJoinOp::RIGHT_OUTER_JOIN || _join_op == TJoinOp::FULL_OUTER_JOIN);
+            assert_cast<ColumnNullable*>(dst_columns[i].get())
+                    ->get_nested_column_ptr()
+                    ->insert_many_from(*src_column.column, _left_block_pos, num_rows);
+            assert_cast<ColumnNullable*>(dst_columns[i].get())
+                    ->get_null_map_column()
+                    .get_data()
+                    .resize_fill(origin_sz + num_rows, 0);
+        } else {
+            dst_columns[i]->insert_many_from(*src_column.column, _left_block_pos, num_rows);
+        }
+    }
+    const Block& build_block = _build_blocks.front();
+    for (size_t i = 0; i < _num_build_side_columns; ++i) {
+        const ColumnWithTypeAndName& src_column = build_block.get_by_position(i);
+        auto& dst_column = dst_columns[_num_probe_side_columns + i];
+        if (!src_column.column->is_nullable() && dst_column->is_nullable()) {
+            auto origin_sz = dst_column->size();
+            DCHECK(_join_op == TJoinOp::LEFT_OUTER_JOIN || _join_op == TJoinOp::FULL_OUTER_JOIN);
+            assert_cast<ColumnNullable*>(dst_column.get())
+                    ->get_nested_column_ptr()
+                    ->insert_indices_from(*src_column.column, build_rows_begin, build_rows_end);
+            assert_cast<ColumnNullable*>(dst_column.get())
+                    ->get_null_map_column()
+                    .get_data()
+                    .resize_fill(origin_sz + num_rows, 0);
+        } else {
+            dst_column->insert_indices_from(*src_column.column, build_rows_begin, build_rows_end);
+        }
+    }
+    _range_build_rows_pos += num_rows;
+    if (_range_build_rows_pos == _range_build_rows.size()) {
+        _current_build_pos = _build_blocks.size();
+    }
+}
+
+void VNestedLoopJoinNode::_split_build_blocks_into_tiles() {
+    Blocks tiles;
+    for (auto& block : _build_blocks) {
+        const size_t rows = block.rows();
+        const size_t row_bytes = std::max<size_t>(1, block.allocated_bytes() / rows);
+        const size_t tile_rows = std::max<size_t>(
+                MIN_BUILD_TILE_ROWS, config::nested_loop_join_tile_bytes / row_bytes);
+        if (rows <= tile_rows) {
+            tiles.emplace_back(std::move(block));
+            continue;
+        }
+        for (size_t start = 0; start < rows; start += tile_rows) {
+            ColumnsWithTypeAndName columns;
+            for (size_t i = 0; i < block.columns(); ++i) {
+                const auto& column = block.get_by_position(i);
+                columns.push_back({column.column->cut(start, std::min(tile_rows, rows - start)),
+                                   column.type, column.name});
+            }
+            tiles.emplace_back(std::move(columns));
+        }
+    }
+    _build_blocks.swap(tiles);
+}
+
+Status VNestedLoopJoinNode::_generate_tiled_join_block_data(RuntimeState* state) {
+    MutableBlock mutable_join_block(&_join_block);
+    while (!_matched_rows_done && !_need_more_input_data &&
+           mutable_join_block.rows() < state->batch_size()) {
+        if (_tile_build_pos == _build_blocks.size()) {
+            // the current tile has been joined with all the build blocks
+            _left_block_pos = _tile_probe_end;
+            const size_t probe_rows = _left_block.rows();
+            if (_tile_probe_end >= probe_rows) {
+                if (_left_side_eos) {
+                    _matched_rows_done = true;
+                } else {
+                    _need_more_input_data = true;
+                }
+                break;
+            }
+            const size_t row_bytes =
+                    std::max<size_t>(1, _left_block.allocated_bytes() / probe_rows);
+            const size_t tile_rows =
+                    std::max<size_t>(1, config::nested_loop_join_tile_bytes / row_bytes);
+            _tile_probe_end = std::min(probe_rows, _tile_probe_end + tile_rows);
+            _tile_probe_pos = _left_block_pos;
+            _tile_build_pos = 0;
+            continue;
+        }
+        RETURN_IF_ERROR(_join_probe_row_with_build_tile(
+                mutable_join_block, _build_blocks[_tile_build_pos], _tile_probe_pos));
+        if (++_tile_probe_pos == _tile_probe_end) {
+            _tile_probe_pos = _left_block_pos;
+            ++_tile_build_pos;
+        }
+    }
+    return Status::OK();
+}
+
+Status VNestedLoopJoinNode::_join_probe_row_with_build_tile(MutableBlock& mutable_block,
+                                                            const Block& build_block,
+                                                            size_t probe_row) {
+    auto& dst_columns = mutable_block.mutable_columns();
+    const size_t build_rows = build_block.rows();
+    if (_join_conjuncts.empty()) {
+        for (size_t i = 0; i < _num_probe_side_columns; ++i) {
+            dst_columns[i]->insert_many_from(*_left_block.get_by_position(i).column, probe_row,
+                                             build_rows);
+        }
+        for (size_t i = 0; i < _num_build_side_columns; ++i) {
+            dst_columns[_num_probe_side_columns + i]->insert_range_from(
+                    *build_block.get_by_position(i).column, 0, build_rows);
+        }
+        return Status::OK();
+    }
+
+    // Only the probe columns of the conjuncts are repeated, the build columns are shared.
+    Block conjunct_block;
+    for (size_t i = 0; i < _num_probe_side_columns; ++i) {
+        const auto& src_column = _left_block.get_by_position(i);
+        if (_conjunct_probe_columns[i]) {
+            auto column = dst_columns[i]->clone_empty();
+            column->insert_many_from(*src_column.column, probe_row, build_rows);
+            conjunct_block.insert({std::move(column), src_column.type, src_column.name});
+        } else {
+            conjunct_block.insert(
+                    {src_column.type->create_column_const_with_default_value(build_rows),
+                     src_column.type, src_column.name});
+        }
+    }
+    for (size_t i = 0; i < _num_build_side_columns; ++i) {
+        conjunct_block.insert(build_block.get_by_position(i));
+    }
+
+    IColumn::Filter filter(build_rows, 1);
+    bool can_filter_all = false;
+    RETURN_IF_ERROR(VExprContext::execute_conjuncts(_join_conjuncts, nullptr, false,
+                                                    &conjunct_block, &filter, &can_filter_all));
+    if (can_filter_all) {
+        return Status::OK();
+    }
+    _tile_selection.clear();
+    for (size_t j = 0; j < build_rows; ++j) {
+        if (filter[j]) {
+            _tile_selection.push_back(j);
+        }
+    }
+    if (_tile_selection.empty()) {
+        return Status::OK();
+    }
+
+    const size_t num_selected = _tile_selection.size();
+    for (size_t i = 0; i < _num_probe_side_columns; ++i) {
+        dst_columns[i]->insert_many_from(*_left_block.get_by_position(i).column, probe_row,
+                                         num_selected);
+    }
+    for (size_t i = 0; i < _num_build_side_columns; ++i) {
+        dst_columns[_num_probe_side_columns + i]->insert_indices_from(
+                *build_block.get_by_position(i).column, _tile_selection.data(),
+                _tile_selection.data() + num_selected);
+    }
+    return Status::OK();
+}
+
 void VNestedLoopJoinNode::_update_additional_flags(Block* block) {
     if (_is_outer_join) {
         auto p0 = _tuple_is_null_left_flag_column->assume_mutable();
@@ -649,6 +875,7 @@ void VNestedLoopJoinNode::debug_string(int indentation_level, std::stringstream*
 
 void VNestedLoopJoinNode::_release_mem() {
     _left_block.clear();
+    _range_join_index.reset();
 
     Blocks tmp_build_blocks;
     _build_blocks.swap(tmp_build_blocks);
@@ -33,6 +33,7 @@
 #include "runtime/thread_context.h"
 #include "vec/columns/column.h"
 #include "vec/core/block.h"
+#include "vec/exec/join/range_join_index.h"
 #include "vec/exec/join/vjoin_node_base.h"
 
 namespace doris {
@@ -97,6 +98,11 @@ private:
         _left_block_start_pos = _left_block_pos;
         _left_side_process_count = 0;
         DCHECK(!_need_more_input_data || !_matched_rows_done);
+        if constexpr (!set_build_side_flag && !set_probe_side_flag) {
+            if (_use_tiled_join) {
+                RETURN_IF_CATCH_EXCEPTION(return _generate_tiled_join_block_data(state));
+            }
+        }
 
         MutableBlock mutable_join_block(&_join_block);
         if (!_matched_rows_done && !_need_more_input_data) {
@@ -129,6 +135,11 @@ private:
                     break;
                 }
 
+                if (_range_join_index != nullptr) {
+                    _process_left_child_range_rows(mutable_join_block, state->batch_size());
+                    continue;
+                }
+
                 const auto& now_process_build_block = _build_blocks[_current_build_pos++];
                 if constexpr (set_build_side_flag) {
                     _build_offset_stack.push(mutable_join_block.rows());
@@ -193,6 +204,16 @@ private:
     //  now_process_build_block: right child block now to process
     void _process_left_child_block(MutableBlock& mutable_block,
                                    const Block& now_process_build_block) const;
+    // Joins the probe row with the next build rows looked up by _range_join_index, and moves
+    // to the next probe row when all of them are joined.
+    void _process_left_child_range_rows(MutableBlock& mutable_block, size_t batch_size);
+
+    // Joins the probe rows of the current tile with a build block after another.
+    Status _generate_tiled_join_block_data(RuntimeState* state);
+    // Appends the joined rows of the probe row and the build block matching the join conjuncts.
+    Status _join_probe_row_with_build_tile(MutableBlock& mutable_block, const Block& build_block,
+                                           size_t probe_row);
+    void _split_build_blocks_into_tiles();
 
     template <bool SetBuildSideFlag, bool SetProbeSideFlag, bool IgnoreNull>
     Status _do_filtering_and_update_visited_flags(Block* block, bool materialize);
@@ -262,6 +283,29 @@ private:
     std::stack<uint16_t> _probe_offset_stack;
     VExprContextSPtrs _join_conjuncts;
 
+    // Built at the end of the build side if the join has range conjuncts, then _build_blocks
+    // holds a single block merged from the build blocks.
+    std::unique_ptr<RangeJoinIndex> _range_join_index;
+    // The build rows looked up for the probe row _range_build_rows_probe_row.
+    std::vector<int> _range_build_rows;
+    size_t _range_build_rows_pos = 0;
+    int _range_build_rows_probe_row = -1;
+    RuntimeProfile::Counter* _range_join_build_timer = nullptr;
+
+    // Set at the end of the build side for the inner and cross joins, which join the probe rows
+    // of a tile with every build block before the next tile, the build blocks being split to
+    // fit config::nested_loop_join_tile_bytes. The join conjuncts are evaluated on the columns
+    // of the probe row and the build block, only the matched rows are materialized.
+    bool _use_tiled_join = false;
+    // The probe columns referenced by the join conjuncts, the other ones are not repeated for
+    // the conjuncts.
+    std::vector<bool> _conjunct_probe_columns;
+    // The probe rows [_left_block_pos, _tile_probe_end) of the current tile.
+    size_t _tile_probe_end = 0;
+    size_t _tile_probe_pos = 0;
+    size_t _tile_build_pos = 0;
+    std::vector<int> _tile_selection;
+
     friend struct RuntimeFilterBuild;
 };
 
@@ -0,0 +1,112 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "vec/exec/scan/file_scan_range_queue.h"
+
+#include <fmt/format.h>
+
+#include <algorithm>
+#include <string>
+
+#include "io/cache/block/block_file_cache.h"
+#include "io/cache/block/block_file_cache_factory.h"
+
+namespace doris::vectorized {
+
+size_t FileScanRangeQueue::add_scanner(const std::vector<TFileRangeDesc>& ranges) {
+    std::lock_guard l(_lock);
+    auto& scanner = _scanners.emplace_back();
+    for (const auto& range : ranges) {
+        scanner.ranges.push_back(&range);
+        scanner.remaining_bytes += _range_bytes(range);
+    }
+    return _scanners.size() - 1;
+}
+
+const TFileRangeDesc* FileScanRangeQueue::next(size_t scanner_idx) {
+    std::lock_guard l(_lock);
+    auto& scanner = _scanners[scanner_idx];
+    if (scanner.ranges.empty()) {
+        return _steal(scanner_idx);
+    }
+    const TFileRangeDesc* range = scanner.ranges.front();
+    scanner.ranges.pop_front();
+    scanner.remaining_bytes -= _range_bytes(*range);
+    return range;
+}
+
+const TFileRangeDesc* FileScanRangeQueue::_steal(size_t scanner_idx) {
+    ScannerRanges* victim = nullptr;
+    for (size_t i = 0; i < _scanners.size(); ++i) {
+        auto& scanner = _scanners[i];
+        if (i == scanner_idx || scanner.ranges.empty()) {
+            continue;
+        }
+        if (victim == nullptr || scanner.remaining_bytes > victim->remaining_bytes) {
+            victim = &scanner;
+        }
+    }
+    if (victim == nullptr) {
+        return nullptr;
+    }
+    // the victim is reading the head, so leave it the head
+    auto& ranges = victim->ranges;
+    auto stolen = ranges.end() - 1;
+    if (_prefer_cached_range) {
+        size_t max_cached_bytes = 0;
+        for (size_t i = 0; i < std::min(STEAL_CANDIDATES, ranges.size()); ++i) {
+            auto candidate = ranges.end() - 1 - i;
+            size_t cached_bytes = _cached_bytes(**candidate);
+            if (cached_bytes > max_cached_bytes) {
+                max_cached_bytes = cached_bytes;
+                stolen = candidate;
+            }
+        }
+    }
+    const TFileRangeDesc* range = *stolen;
+    ranges.erase(stolen);
+    victim->remaining_bytes -= _range_bytes(*range);
+    return range;
+}
+
+int64_t FileScanRangeQueue::_range_bytes(const TFileRangeDesc& range) {
+    if (range.__isset.size && range.size >= 0) {
+        return range.size;
+    }
+    if (range.__isset.file_size && range.file_size >= 0) {
+        return range.file_size - (range.__isset.start_offset ? range.start_offset : 0);
+    }
+    // unknown size, e.g. stream load
+    return 1;
+}
+
+size_t FileScanRangeQueue::_cached_bytes(const TFileRangeDesc& range) {
+    if (!range.__isset.path) {
+        return 0;
+    }
+    // same as the cache key of CachedRemoteFileReader
+    int64_t mtime = range.__isset.modification_time ? range.modification_time : 0;
+    auto key = io::IFileCache::hash(fmt::format("{}:{}", range.path, mtime));
+    auto* cache = io::FileCacheFactory::instance().get_by_path(key);
+    if (cache == nullptr) {
+        return 0;
+    }
+    size_t offset = range.__isset.start_offset ? range.start_offset : 0;
+    return cache->get_cached_size(key, offset, std::max<int64_t>(_range_bytes(range), 0));
+}
+
+} // namespace doris::vectorized
@@ -0,0 +1,66 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <gen_cpp/PlanNodes_types.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include <deque>
+#include <mutex>
+#include <vector>
+
+namespace doris::vectorized {
+
+// The scan ranges of the file scanners of a scan node. A scanner reads its own ranges in
+// order, and steals the remaining ranges of the scanner with the most remaining bytes when
+// it runs out of its own, so a scanner with a few huge files does not hold the scan node
+// while the others idle. The stolen range is taken from the tail of the victim, preferring
+// the one whose blocks are cached most in the block file cache of this backend.
+class FileScanRangeQueue {
+public:
+    explicit FileScanRangeQueue(bool prefer_cached_range)
+            : _prefer_cached_range(prefer_cached_range) {}
+
+    // The ranges must outlive the queue. Return the index of the scanner.
+    size_t add_scanner(const std::vector<TFileRangeDesc>& ranges);
+
+    // nullptr if there is no remaining range of all scanners
+    const TFileRangeDesc* next(size_t scanner_idx);
+
+private:
+    // number of ranges at the tail of the victim to choose the stolen one from
+    static constexpr size_t STEAL_CANDIDATES = 8;
+
+    struct ScannerRanges {
+        std::deque<const TFileRangeDesc*> ranges;
+        int64_t remaining_bytes = 0;
+    };
+
+    static int64_t _range_bytes(const TFileRangeDesc& range);
+
+    static size_t _cached_bytes(const TFileRangeDesc& range);
+
+    const TFileRangeDesc* _steal(size_t scanner_idx);
+
+    const bool _prefer_cached_range;
+    std::mutex _lock;
+    std::vector<ScannerRanges> _scanners;
+};
+
+} // namespace doris::vectorized
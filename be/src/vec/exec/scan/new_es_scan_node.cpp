@@ -23,6 +23,7 @@
 
 #include <ostream>
 
+#include "common/config.h"
 #include "common/logging.h"
 #include "common/object_pool.h"
 #include "exec/es/es_scan_reader.h"
@@ -159,16 +160,28 @@ Status NewEsScanNode::_init_scanners(std::list<VScannerSPtr>* scanners) {
             properties[ESScanReader::KEY_TERMINATE_AFTER] = std::to_string(limit());
         }
 
-        bool doc_value_mode = false;
-        properties[ESScanReader::KEY_QUERY] = ESScrollQueryBuilder::build(
-                properties, _column_names, _docvalue_context, &doc_value_mode);
-
-        std::shared_ptr<NewEsScanner> scanner = NewEsScanner::create_shared(
-                _state, this, _limit_per_scanner, _tuple_id, properties, _docvalue_context,
-                doc_value_mode, _state->runtime_profile());
-
-        RETURN_IF_ERROR(scanner->prepare(_state, _conjuncts));
-        scanners->push_back(scanner);
+        // a search with terminate_after is not a scroll, so it is not sliced
+        int num_slices = config::es_scroll_slices_per_shard;
+        if (properties.find(ESScanReader::KEY_TERMINATE_AFTER) != properties.end()) {
+            num_slices = 1;
+        }
+        for (int slice = 0; slice < num_slices; ++slice) {
+            std::map<std::string, std::string> slice_properties(properties);
+            if (num_slices > 1) {
+                slice_properties[ESScanReader::KEY_SLICE_ID] = std::to_string(slice);
+                slice_properties[ESScanReader::KEY_SLICE_MAX] = std::to_string(num_slices);
+            }
+            bool doc_value_mode = false;
+            slice_properties[ESScanReader::KEY_QUERY] = ESScrollQueryBuilder::build(
+                    slice_properties, _column_names, _docvalue_context, &doc_value_mode);
+
+            std::shared_ptr<NewEsScanner> scanner = NewEsScanner::create_shared(
+                    _state, this, _limit_per_scanner, _tuple_id, slice_properties,
+                    _docvalue_context, doc_value_mode, _state->runtime_profile());
+
+            RETURN_IF_ERROR(scanner->prepare(_state, _conjuncts));
+            scanners->push_back(scanner);
+        }
     }
     return Status::OK();
 }
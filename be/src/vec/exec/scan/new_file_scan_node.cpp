@@ -26,6 +26,11 @@
 
 #include "common/config.h"
 #include "common/object_pool.h"
+#include "io/file_factory.h"
+#include "io/fs/stream_load_pipe.h"
+#include "runtime/exec_env.h"
+#include "runtime/stream_load/new_load_stream_mgr.h"
+#include "runtime/stream_load/stream_load_context.h"
 #include "vec/exec/scan/vfile_scanner.h"
 #include "vec/exec/scan/vscanner.h"
 
@@ -40,6 +45,7 @@ NewFileScanNode::NewFileScanNode(ObjectPool* pool, const TPlanNode& tnode,
                                  const DescriptorTbl& descs)
         : VScanNode(pool, tnode, descs) {
     _output_tuple_id = tnode.file_scan_node.tuple_id;
+    _use_topn_opt = tnode.file_scan_node.__isset.use_topn_opt && tnode.file_scan_node.use_topn_opt;
 }
 
 Status NewFileScanNode::init(const TPlanNode& tnode, RuntimeState* state) {
@@ -106,17 +112,73 @@ Status NewFileScanNode::_init_scanners(std::list<VScannerSPtr>* scanners) {
     size_t shard_num =
             std::min<size_t>(config::doris_scanner_thread_pool_thread_num, _scan_ranges.size());
     _kv_cache.reset(new ShardedKVCache(shard_num));
+    if (config::enable_file_scan_range_stealing && _scan_ranges.size() > 1) {
+        // only look up the block file cache when the file readers use it
+        _range_queue.reset(new FileScanRangeQueue(
+                FileFactory::get_reader_options(_state).cache_type ==
+                io::FileCachePolicy::FILE_BLOCK_CACHE));
+    }
     for (auto& scan_range : _scan_ranges) {
-        std::unique_ptr<VFileScanner> scanner =
-                VFileScanner::create_unique(_state, this, _limit_per_scanner,
-                                            scan_range.scan_range.ext_scan_range.file_scan_range,
-                                            runtime_profile(), _kv_cache.get());
-        RETURN_IF_ERROR(
-                scanner->prepare(_conjuncts, &_colname_to_value_range, &_colname_to_slot_id));
-        scanners->push_back(std::move(scanner));
+        const auto& file_scan_range = scan_range.scan_range.ext_scan_range.file_scan_range;
+        int num_scanners = _num_stream_scanners(file_scan_range);
+        for (int i = 0; i < num_scanners; ++i) {
+            std::unique_ptr<VFileScanner> scanner = VFileScanner::create_unique(
+                    _state, this, _limit_per_scanner, file_scan_range, runtime_profile(),
+                    _kv_cache.get(), _range_queue.get());
+            RETURN_IF_ERROR(
+                    scanner->prepare(_conjuncts, &_colname_to_value_range, &_colname_to_slot_id));
+            scanners->push_back(std::move(scanner));
+        }
     }
 
     return Status::OK();
 }
 
+int NewFileScanNode::_num_stream_scanners(const TFileScanRange& scan_range) {
+    const auto& params = scan_range.params;
+    if (config::stream_load_parse_parallelism <= 1 || !config::enable_stream_load_zero_copy ||
+        params.file_type != TFileType::FILE_STREAM || scan_range.ranges.size() != 1 ||
+        !params.__isset.row_order_insensitive || !params.row_order_insensitive) {
+        return 1;
+    }
+    // the lines are split by the pipe, which has to be read by the zero copy line reader
+    const auto& attrs = params.file_attributes;
+    bool by_line = params.format_type == TFileFormatType::FORMAT_CSV_PLAIN ||
+                   (params.format_type == TFileFormatType::FORMAT_JSON &&
+                    attrs.__isset.read_json_by_line && attrs.read_json_by_line);
+    bool compressed = params.__isset.compress_type &&
+                      params.compress_type != TFileCompressType::PLAIN &&
+                      params.compress_type != TFileCompressType::UNKNOWN;
+    // the header lines are skipped by the first scanner
+    bool has_header = (attrs.__isset.header_type && !attrs.header_type.empty()) ||
+                      (attrs.__isset.skip_lines && attrs.skip_lines > 0);
+    auto ctx = ExecEnv::GetInstance()->new_load_stream_mgr()->get(scan_range.ranges[0].load_id);
+    if (ctx == nullptr || ctx->pipe == nullptr || ctx->is_multi_table || compressed ||
+        has_header) {
+        return 1;
+    }
+    // a routine load is parsed in parallel across its messages whatever the size, a json
+    // message is a buffer of the pipe read as a whole
+    bool routine_load = ctx->load_type == TLoadType::ROUTINE_LOAD;
+    bool by_message = routine_load && params.format_type == TFileFormatType::FORMAT_JSON &&
+                      !by_line;
+    if (!by_line && !by_message) {
+        return 1;
+    }
+    if (!routine_load && ctx->body_bytes < config::stream_load_parallel_parse_min_bytes) {
+        return 1;
+    }
+    if (by_line) {
+        std::string line_delimiter = "\n";
+        if (attrs.__isset.text_params && attrs.text_params.__isset.line_delimiter) {
+            line_delimiter = attrs.text_params.line_delimiter;
+        }
+        ctx->pipe->split_by_lines(line_delimiter);
+    }
+    int num_scanners = config::stream_load_parse_parallelism;
+    LOG(INFO) << "parse stream load in parallel, scanners=" << num_scanners << ", "
+              << ctx->brief();
+    return num_scanners;
+}
+
 }; // namespace doris::vectorized
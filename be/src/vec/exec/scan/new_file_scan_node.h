@@ -25,6 +25,7 @@
 
 #include "common/status.h"
 #include "vec/exec/format/format_common.h"
+#include "vec/exec/scan/file_scan_range_queue.h"
 #include "vec/exec/scan/vscan_node.h"
 
 namespace doris {
@@ -49,12 +50,18 @@ public:
 
     void set_scan_ranges(const std::vector<TScanRangeParams>& scan_ranges) override;
 
+    bool use_topn_opt() const { return _use_topn_opt; }
+
 protected:
     Status _init_profile() override;
     Status _process_conjuncts() override;
     Status _init_scanners(std::list<VScannerSPtr>* scanners) override;
 
 private:
+    // The number of the scanners sharing the pipe of a stream load range, whose lines are
+    // parsed in parallel if it is large enough and the rows can be loaded in any order.
+    int _num_stream_scanners(const TFileScanRange& scan_range);
+
     std::vector<TScanRangeParams> _scan_ranges;
     // A in memory cache to save some common components
     // of the this scan node. eg:
@@ -62,5 +69,9 @@ private:
     // 2. parquet file meta
     // KVCache<std::string> _kv_cache;
     std::unique_ptr<ShardedKVCache> _kv_cache;
+    // shared by the scanners to steal the ranges of each other
+    std::unique_ptr<FileScanRangeQueue> _range_queue;
+    // prune the row groups or stripes by the boundary of the topn above this scan node
+    bool _use_topn_opt = false;
 };
 } // namespace doris::vectorized
@@ -20,6 +20,9 @@
 #include <fmt/format.h>
 #include <gen_cpp/PlanNodes_types.h>
 
+#include <string.h>
+
+#include <algorithm>
 #include <memory>
 #include <ostream>
 
@@ -42,7 +45,11 @@ NewJdbcScanNode::NewJdbcScanNode(ObjectPool* pool, const TPlanNode& tnode,
           _table_name(tnode.jdbc_scan_node.table_name),
           _tuple_id(tnode.jdbc_scan_node.tuple_id),
           _query_string(tnode.jdbc_scan_node.query_string),
-          _table_type(tnode.jdbc_scan_node.table_type) {
+          _table_type(tnode.jdbc_scan_node.table_type),
+          _split_column(tnode.jdbc_scan_node.split_column),
+          _split_num(tnode.jdbc_scan_node.__isset.split_num ? tnode.jdbc_scan_node.split_num : 1),
+          _split_bounds_query(tnode.jdbc_scan_node.split_bounds_query),
+          _split_query_string(tnode.jdbc_scan_node.split_query_string) {
     _output_tuple_id = tnode.jdbc_scan_node.tuple_id;
 }
 
@@ -65,11 +72,56 @@ Status NewJdbcScanNode::_init_scanners(std::list<VScannerSPtr>* scanners) {
     if (_eos == true) {
         return Status::OK();
     }
-    std::unique_ptr<NewJdbcScanner> scanner =
-            NewJdbcScanner::create_unique(_state, this, _limit_per_scanner, _tuple_id,
-                                          _query_string, _table_type, _state->runtime_profile());
-    RETURN_IF_ERROR(scanner->prepare(_state, _conjuncts));
-    scanners->push_back(std::move(scanner));
+    std::vector<std::string> query_strings;
+    RETURN_IF_ERROR(_split_query_strings(&query_strings));
+    for (const auto& query_string : query_strings) {
+        std::unique_ptr<NewJdbcScanner> scanner =
+                NewJdbcScanner::create_unique(_state, this, _limit_per_scanner, _tuple_id,
+                                              query_string, _table_type, _state->runtime_profile());
+        RETURN_IF_ERROR(scanner->prepare(_state, _conjuncts));
+        scanners->push_back(std::move(scanner));
+    }
+    return Status::OK();
+}
+
+static const char* SPLIT_CONDITIONS = "$SPLIT_CONDITIONS";
+
+Status NewJdbcScanNode::_split_query_strings(std::vector<std::string>* query_strings) {
+    size_t pos = _split_query_string.rfind(SPLIT_CONDITIONS);
+    if (_split_num <= 1 || _split_column.empty() || pos == std::string::npos) {
+        query_strings->push_back(_query_string);
+        return Status::OK();
+    }
+    bool has_bounds = false;
+    int64_t min = 0;
+    int64_t max = 0;
+    RETURN_IF_ERROR(NewJdbcScanner::get_split_bounds(_state, _tuple_id, _table_type,
+                                                     _split_bounds_query, &has_bounds, &min,
+                                                     &max));
+    __int128 span = (__int128)max - min + 1;
+    int num = has_bounds ? (int)std::min<__int128>(_split_num, span) : 1;
+    if (num <= 1) {
+        query_strings->push_back(_query_string);
+        return Status::OK();
+    }
+
+    // [min, max] is split into num ranges evenly, the first range gets the nulls as well and
+    // the ends are open for the rows written after the bounds are got.
+    for (int i = 0; i < num; ++i) {
+        auto lower = (int64_t)(min + span * i / num);
+        auto upper = (int64_t)(min + span * (i + 1) / num);
+        std::string conditions;
+        if (i == 0) {
+            conditions = fmt::format("{0} < {1} OR {0} IS NULL", _split_column, upper);
+        } else if (i == num - 1) {
+            conditions = fmt::format("{} >= {}", _split_column, lower);
+        } else {
+            conditions = fmt::format("{0} >= {1} AND {0} < {2}", _split_column, lower, upper);
+        }
+        std::string query_string = _split_query_string;
+        query_string.replace(pos, strlen(SPLIT_CONDITIONS), conditions);
+        query_strings->push_back(std::move(query_string));
+    }
     return Status::OK();
 }
 } // namespace doris::vectorized
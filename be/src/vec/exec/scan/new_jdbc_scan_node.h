@@ -21,6 +21,7 @@
 
 #include <list>
 #include <string>
+#include <vector>
 
 #include "common/global_types.h"
 #include "common/status.h"
@@ -47,10 +48,18 @@ protected:
     Status _init_scanners(std::list<VScannerSPtr>* scanners) override;
 
 private:
+    // The query strings of the scanners, one for each range of the split column of a split scan.
+    Status _split_query_strings(std::vector<std::string>* query_strings);
+
     std::string _table_name;
     TupleId _tuple_id;
     std::string _query_string;
     TOdbcTableType::type _table_type;
+
+    std::string _split_column;
+    int _split_num;
+    std::string _split_bounds_query;
+    std::string _split_query_string;
 };
 } // namespace vectorized
 } // namespace doris
@@ -36,6 +36,25 @@
 #include "vec/exprs/vexpr_context.h"
 
 namespace doris::vectorized {
+
+// Sets the connection params of the jdbc table of the tuple.
+static Status init_jdbc_param(const TupleDescriptor* tuple_desc, JdbcConnectorParam* param) {
+    const JdbcTableDescriptor* jdbc_table =
+            static_cast<const JdbcTableDescriptor*>(tuple_desc->table_desc());
+    if (jdbc_table == nullptr) {
+        return Status::InternalError("jdbc table pointer is NULL of VJdbcScanNode::prepare.");
+    }
+    param->driver_class = jdbc_table->jdbc_driver_class();
+    param->driver_path = jdbc_table->jdbc_driver_url();
+    param->resource_name = jdbc_table->jdbc_resource_name();
+    param->driver_checksum = jdbc_table->jdbc_driver_checksum();
+    param->jdbc_url = jdbc_table->jdbc_url();
+    param->user = jdbc_table->jdbc_user();
+    param->passwd = jdbc_table->jdbc_passwd();
+    param->tuple_desc = tuple_desc;
+    return Status::OK();
+}
+
 NewJdbcScanner::NewJdbcScanner(RuntimeState* state, NewJdbcScanNode* parent, int64_t limit,
                                const TupleId& tuple_id, const std::string& query_string,
                                TOdbcTableType::type table_type, RuntimeProfile* profile)
@@ -73,19 +92,7 @@ Status NewJdbcScanner::prepare(RuntimeState* state, const VExprContextSPtrs& con
     }
 
     // get jdbc table info
-    const JdbcTableDescriptor* jdbc_table =
-            static_cast<const JdbcTableDescriptor*>(_tuple_desc->table_desc());
-    if (jdbc_table == nullptr) {
-        return Status::InternalError("jdbc table pointer is NULL of VJdbcScanNode::prepare.");
-    }
-    _jdbc_param.driver_class = jdbc_table->jdbc_driver_class();
-    _jdbc_param.driver_path = jdbc_table->jdbc_driver_url();
-    _jdbc_param.resource_name = jdbc_table->jdbc_resource_name();
-    _jdbc_param.driver_checksum = jdbc_table->jdbc_driver_checksum();
-    _jdbc_param.jdbc_url = jdbc_table->jdbc_url();
-    _jdbc_param.user = jdbc_table->jdbc_user();
-    _jdbc_param.passwd = jdbc_table->jdbc_passwd();
-    _jdbc_param.tuple_desc = _tuple_desc;
+    RETURN_IF_ERROR(init_jdbc_param(_tuple_desc, &_jdbc_param));
     _jdbc_param.query_string = std::move(_query_string);
     _jdbc_param.table_type = _table_type;
 
@@ -103,6 +110,26 @@ Status NewJdbcScanner::prepare(RuntimeState* state, const VExprContextSPtrs& con
     return Status::OK();
 }
 
+Status NewJdbcScanner::get_split_bounds(RuntimeState* state, const TupleId& tuple_id,
+                                        TOdbcTableType::type table_type,
+                                        const std::string& bounds_query, bool* has_bounds,
+                                        int64_t* min, int64_t* max) {
+    const TupleDescriptor* tuple_desc = state->desc_tbl().get_tuple_descriptor(tuple_id);
+    if (tuple_desc == nullptr) {
+        return Status::InternalError("Failed to get tuple descriptor.");
+    }
+    JdbcConnectorParam param;
+    RETURN_IF_ERROR(init_jdbc_param(tuple_desc, &param));
+    param.query_string = bounds_query;
+    param.table_type = table_type;
+
+    JdbcConnector connector(param);
+    RETURN_IF_ERROR(connector.open(state, true));
+    Status st = connector.get_split_bounds(has_bounds, min, max);
+    RETURN_IF_ERROR(connector.close());
+    return st;
+}
+
 Status NewJdbcScanner::open(RuntimeState* state) {
     VLOG_CRITICAL << "NewJdbcScanner::open";
     if (state == nullptr) {
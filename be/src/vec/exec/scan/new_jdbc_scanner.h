@@ -54,6 +54,13 @@ public:
 
     Status prepare(RuntimeState* state, const VExprContextSPtrs& conjuncts);
 
+    // Gets the min and the max of the split column of a split scan by its bounds query,
+    // has_bounds is false if the table has no rows of the split column.
+    static Status get_split_bounds(RuntimeState* state, const TupleId& tuple_id,
+                                   TOdbcTableType::type table_type,
+                                   const std::string& bounds_query, bool* has_bounds,
+                                   int64_t* min, int64_t* max);
+
 protected:
     Status _get_block_impl(RuntimeState* state, Block* block, bool* eos) override;
 
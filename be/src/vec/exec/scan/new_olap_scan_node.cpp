@@ -27,8 +27,10 @@
 
 #include <algorithm>
 #include <charconv>
+#include <limits>
 #include <ostream>
 #include <shared_mutex>
+#include <type_traits>
 #include <unordered_map>
 #include <utility>
 #include <variant>
@@ -93,6 +95,7 @@ Status NewOlapScanNode::prepare(RuntimeState* state) {
     // if you want to add some profile in scan node, even it have not new VScanner object
     // could add here, not in the _init_profile() function
     _tablet_counter = ADD_COUNTER(_runtime_profile, "TabletNum", TUnit::UNIT);
+    _pruned_tablet_counter = ADD_COUNTER(_runtime_profile, "PrunedTabletNum", TUnit::UNIT);
     return Status::OK();
 }
 
@@ -135,6 +138,9 @@ Status NewOlapScanNode::_init_profile() {
     _second_read_timer = ADD_TIMER(_segment_profile, "SecondReadTime");
     _first_read_seek_timer = ADD_TIMER(_segment_profile, "FirstReadSeekTime");
     _first_read_seek_counter = ADD_COUNTER(_segment_profile, "FirstReadSeekCount", TUnit::UNIT);
+    _page_prefetch_plan_timer = ADD_TIMER(_segment_profile, "PagePrefetchPlanTime");
+    _page_prefetch_io_counter = ADD_COUNTER(_segment_profile, "PagePrefetchIOCount", TUnit::UNIT);
+    _page_prefetch_bytes_counter = ADD_COUNTER(_segment_profile, "PagePrefetchBytes", TUnit::BYTES);
 
     _lazy_read_timer = ADD_TIMER(_segment_profile, "LazyReadTime");
     _lazy_read_seek_timer = ADD_TIMER(_segment_profile, "LazyReadSeekTime");
@@ -144,11 +150,15 @@ Status NewOlapScanNode::_init_profile() {
 
     _stats_filtered_counter = ADD_COUNTER(_segment_profile, "RowsStatsFiltered", TUnit::UNIT);
     _bf_filtered_counter = ADD_COUNTER(_segment_profile, "RowsBloomFilterFiltered", TUnit::UNIT);
+    _late_rf_index_filtered_counter =
+            ADD_COUNTER(_segment_profile, "RowsLateRuntimeFilterIndexFiltered", TUnit::UNIT);
     _del_filtered_counter = ADD_COUNTER(_scanner_profile, "RowsDelFiltered", TUnit::UNIT);
     _conditions_filtered_counter =
             ADD_COUNTER(_segment_profile, "RowsConditionsFiltered", TUnit::UNIT);
     _key_range_filtered_counter =
             ADD_COUNTER(_segment_profile, "RowsKeyRangeFiltered", TUnit::UNIT);
+    _key_range_lookup_cache_hit_counter =
+            ADD_COUNTER(_segment_profile, "KeyRangeLookupCacheHit", TUnit::UNIT);
 
     _io_timer = ADD_TIMER(_segment_profile, "IOTimer");
     _decompressor_timer = ADD_TIMER(_segment_profile, "DecompressorTimer");
@@ -181,6 +191,15 @@ Status NewOlapScanNode::_init_profile() {
 
     _filtered_segment_counter = ADD_COUNTER(_segment_profile, "NumSegmentFiltered", TUnit::UNIT);
     _total_segment_counter = ADD_COUNTER(_segment_profile, "NumSegmentTotal", TUnit::UNIT);
+    _filtered_rowset_counter = ADD_COUNTER(_segment_profile, "NumRowsetFiltered", TUnit::UNIT);
+    _segment_ngram_bf_checked_counter =
+            ADD_COUNTER(_segment_profile, "NumSegmentNGramBloomFilterChecked", TUnit::UNIT);
+    _segment_ngram_bf_filtered_counter =
+            ADD_COUNTER(_segment_profile, "NumSegmentNGramBloomFilterFiltered", TUnit::UNIT);
+    _merged_agg_block_cache_hit_counter =
+            ADD_COUNTER(_scanner_profile, "MergedAggBlockCacheHit", TUnit::UNIT);
+    _merged_agg_block_cache_miss_counter =
+            ADD_COUNTER(_scanner_profile, "MergedAggBlockCacheMiss", TUnit::UNIT);
 
     return Status::OK();
 }
@@ -247,7 +266,79 @@ Status NewOlapScanNode::_process_conjuncts() {
     return Status::OK();
 }
 
+void NewOlapScanNode::_prune_scan_ranges_by_partition() {
+    auto is_matched = [&](const TKeyRange& partition_range) {
+        if (partition_range.column_type != TPrimitiveType::TINYINT &&
+            partition_range.column_type != TPrimitiveType::SMALLINT &&
+            partition_range.column_type != TPrimitiveType::INT &&
+            partition_range.column_type != TPrimitiveType::BIGINT) {
+            return true;
+        }
+        auto iter = _colname_to_value_range.find(partition_range.column_name);
+        if (iter == _colname_to_value_range.end()) {
+            return true;
+        }
+        // the partition is [begin_key, end_key), an end_key of INT64_MAX is MAXVALUE
+        __int128 begin = partition_range.begin_key;
+        __int128 end = partition_range.end_key == std::numeric_limits<int64_t>::max()
+                               ? static_cast<__int128>(partition_range.end_key) + 1
+                               : partition_range.end_key;
+        return std::visit(
+                [&](auto&& range) {
+                    using CppType = typename std::decay_t<decltype(range)>::CppType;
+                    if constexpr (!std::is_integral_v<CppType> || std::is_same_v<CppType, bool> ||
+                                  sizeof(CppType) > sizeof(int64_t)) {
+                        return true;
+                    } else {
+                        if (range.contain_null() || range.is_match_value_range()) {
+                            return true;
+                        }
+                        if (range.is_fixed_value_range()) {
+                            for (const auto& value : range.get_fixed_value_set()) {
+                                if (value >= begin && value < end) {
+                                    return true;
+                                }
+                            }
+                            return false;
+                        }
+                        __int128 low = range.get_range_min_value();
+                        __int128 high = range.get_range_max_value();
+                        low += range.is_begin_include() ? 0 : 1;
+                        high += range.is_end_include() ? 1 : 0;
+                        return low < end && begin < high;
+                    }
+                },
+                iter->second);
+    };
+
+    size_t num_pruned = 0;
+    for (auto it = _scan_ranges.begin(); it != _scan_ranges.end();) {
+        bool matched = true;
+        for (const auto& partition_range : (*it)->partition_column_ranges) {
+            if (!is_matched(partition_range)) {
+                matched = false;
+                break;
+            }
+        }
+        if (matched) {
+            ++it;
+        } else {
+            it = _scan_ranges.erase(it);
+            ++num_pruned;
+        }
+    }
+    COUNTER_UPDATE(_pruned_tablet_counter, num_pruned);
+    if (_scan_ranges.empty()) {
+        _eos = true;
+    }
+}
+
 Status NewOlapScanNode::_build_key_ranges_and_filters() {
+    // before the value ranges of the key columns are moved into the scan keys
+    _prune_scan_ranges_by_partition();
+    if (_eos) {
+        return Status::OK();
+    }
     if (!_olap_scan_node.__isset.push_down_agg_type_opt ||
         _olap_scan_node.push_down_agg_type_opt == TPushAggOp::NONE) {
         const std::vector<std::string>& column_names = _olap_scan_node.key_column_name;
@@ -324,6 +415,19 @@ Status NewOlapScanNode::_build_key_ranges_and_filters() {
             std::visit([&](auto&& the_range) { the_range.to_in_condition(_olap_filters, false); },
                        range);
         }
+
+        // Append the bounds derived from the geo predicates
+        for (const auto& [col_name, bound] : _geo_bounds) {
+            std::pair<const char*, double> conditions[] = {{">=", bound.first},
+                                                           {"<=", bound.second}};
+            for (const auto& [op, value] : conditions) {
+                TCondition filter;
+                filter.__set_column_name(col_name);
+                filter.__set_condition_op(op);
+                filter.condition_values.push_back(fmt::format("{}", value));
+                _olap_filters.push_back(filter);
+            }
+        }
     } else {
         _runtime_profile->add_info_string(
                 "PushDownAggregate",
@@ -450,17 +554,20 @@ Status NewOlapScanNode::_init_scanners(std::list<VScannerSPtr>* scanners) {
     if (_cond_ranges.empty()) {
         _cond_ranges.emplace_back(new doris::OlapScanRange());
     }
+    _key_range_lookup_cache = std::make_shared<KeyRangeLookupCache>();
     int scanners_per_tablet = std::max(1, 64 / (int)_scan_ranges.size());
 
-    bool is_duplicate_key = false;
-    int segment_count = 0;
+    bool split_by_rows = false;
+    int64_t total_rows = 0;
     std::vector<std::vector<RowsetReaderSharedPtr>> rowset_readers_vector(_scan_ranges.size());
-    std::vector<std::vector<int>> tablet_rs_seg_count(_scan_ranges.size());
 
-    // Split tablet segment by scanner, only use in pipeline in duplicate key
-    // 1. if tablet count lower than scanner thread num, count segment num of all tablet ready for scan
-    // TODO: some tablet may do not have segment, may need split segment all case
-    if (_shared_scan_opt && _scan_ranges.size() < config::doris_scanner_thread_pool_thread_num) {
+    // Split tablet by segments and row ranges of segments, only for duplicate key, or unique key
+    // with merge-on-write whose rowsets need no merge with the delete bitmap. It is used in
+    // shared scan, or if the tablets can not be split by key ranges.
+    // 1. if tablet count lower than scanner thread num, capture rowsets of all tablet ready for scan
+    if ((_shared_scan_opt ||
+         (config::doris_scan_split_min_rows > 0 && _cond_ranges.size() == 1)) &&
+        _scan_ranges.size() < config::doris_scanner_thread_pool_thread_num) {
         for (int i = 0; i < _scan_ranges.size(); ++i) {
             auto& scan_range = _scan_ranges[i];
             auto tablet_id = scan_range->tablet_id;
@@ -469,8 +576,10 @@ Status NewOlapScanNode::_init_scanners(std::list<VScannerSPtr>* scanners) {
                                                                                        true);
             RETURN_IF_ERROR(status);
 
-            is_duplicate_key = tablet->keys_type() == DUP_KEYS;
-            if (!is_duplicate_key) {
+            split_by_rows = tablet->keys_type() == DUP_KEYS ||
+                            (tablet->enable_unique_key_merge_on_write() &&
+                             !_state->skip_delete_bitmap());
+            if (!split_by_rows) {
                 break;
             }
 
@@ -478,12 +587,11 @@ Status NewOlapScanNode::_init_scanners(std::list<VScannerSPtr>* scanners) {
             std::from_chars(scan_range->version.c_str(),
                             scan_range->version.c_str() + scan_range->version.size(), version);
 
-            std::shared_lock rdlock(tablet->get_header_lock());
             // acquire tablet rowset readers at the beginning of the scan node
             // to prevent this case: when there are lots of olap scanners to run for example 10000
             // the rowsets maybe compacted when the last olap scanner starts
             Status acquire_reader_st =
-                    tablet->capture_rs_readers({0, version}, &rowset_readers_vector[i]);
+                    tablet->capture_rs_readers_of_version(version, &rowset_readers_vector[i]);
             if (!acquire_reader_st.ok()) {
                 LOG(WARNING) << "fail to init reader.res=" << acquire_reader_st;
                 std::stringstream ss;
@@ -494,9 +602,7 @@ Status NewOlapScanNode::_init_scanners(std::list<VScannerSPtr>* scanners) {
             }
 
             for (const auto& rowset_reader : rowset_readers_vector[i]) {
-                auto num_segments = rowset_reader->rowset()->num_segments();
-                tablet_rs_seg_count[i].emplace_back(num_segments);
-                segment_count += num_segments;
+                total_rows += rowset_reader->rowset()->num_rows();
             }
         }
     }
@@ -515,79 +621,78 @@ Status NewOlapScanNode::_init_scanners(std::list<VScannerSPtr>* scanners) {
         scanners->push_back(scanner);
         return Status::OK();
     };
-    if (is_duplicate_key) {
-        // 2. Split by segment count, each scanner need scan avg segment count
-        auto avg_segment_count =
-                std::max(segment_count / config::doris_scanner_thread_pool_thread_num, 1);
+    if (split_by_rows) {
+        // 2. Split by rows, each scanner scans about the same number of rows of whole segments,
+        // or of a row range of a large segment, which is located by the ordinal index.
+        int64_t num_splits = config::doris_scanner_thread_pool_thread_num;
+        if (config::doris_scan_split_min_rows > 0) {
+            num_splits = std::clamp<int64_t>(total_rows / config::doris_scan_split_min_rows, 1,
+                                             num_splits);
+        }
+        int64_t rows_per_scanner = std::max<int64_t>(total_rows / num_splits, 1);
+        std::vector<doris::OlapScanRange*> scanner_ranges;
+        for (auto& range : _cond_ranges) {
+            scanner_ranges.push_back(range.get());
+        }
         for (int i = 0; i < _scan_ranges.size(); ++i) {
-            auto& scan_range = _scan_ranges[i];
-            std::vector<std::unique_ptr<doris::OlapScanRange>>* ranges = &_cond_ranges;
-            int num_ranges = ranges->size();
-            std::vector<doris::OlapScanRange*> scanner_ranges(num_ranges);
-            for (int j = 0; j < num_ranges; ++j) {
-                scanner_ranges[j] = (*ranges)[j].get();
-            }
-
-            const auto& rs_seg_count = tablet_rs_seg_count[i];
-            int rs_seg_count_index = 0;
-            int rs_seg_start_scan = 0;
-            int scanner_seg_occupy = 0;
             std::vector<RowsetReaderSharedPtr> rs_readers;
             std::vector<std::pair<int, int>> rs_reader_seg_offsets;
+            std::vector<std::unordered_map<uint32_t, std::pair<uint32_t, uint32_t>>>
+                    rs_reader_row_ranges;
+            int64_t scanner_rows = 0;
+            auto flush_scanner = [&]() {
+                for (size_t j = 0; j < rs_readers.size(); ++j) {
+                    rs_readers[j]->set_segment_row_ranges(std::move(rs_reader_row_ranges[j]));
+                }
+                RETURN_IF_ERROR(build_new_scanner(*_scan_ranges[i], scanner_ranges, rs_readers,
+                                                  rs_reader_seg_offsets));
+                rs_readers.clear();
+                rs_reader_seg_offsets.clear();
+                rs_reader_row_ranges.clear();
+                scanner_rows = 0;
+                return Status::OK();
+            };
 
-            while (rs_seg_count_index < rs_seg_count.size()) {
-                // do not generator range of segment (0, 0)
-                if (rs_seg_count[rs_seg_count_index] == 0) {
-                    rs_seg_start_scan = 0;
-                    rs_seg_count_index++;
+            for (const auto& rowset_reader : rowset_readers_vector[i]) {
+                auto rowset = rowset_reader->rowset();
+                int num_segments = rowset->num_segments();
+                if (num_segments == 0) {
                     continue;
                 }
-
-                auto max_add_seg_nums = rs_seg_count[rs_seg_count_index] - rs_seg_start_scan;
-                rs_readers.emplace_back(rowset_readers_vector[i][rs_seg_count_index]->clone());
-
-                if (scanner_seg_occupy + max_add_seg_nums > avg_segment_count) {
-                    auto need_add_seg_nums = avg_segment_count - scanner_seg_occupy;
-                    rs_reader_seg_offsets.emplace_back(
-                            rs_seg_start_scan,
-                            rs_seg_start_scan + need_add_seg_nums); // only scan need_add_seg_nums
-                    RETURN_IF_ERROR(build_new_scanner(*scan_range, scanner_ranges, rs_readers,
-                                                      rs_reader_seg_offsets));
-
-                    rs_seg_start_scan += need_add_seg_nums;
-                    scanner_seg_occupy = 0;
-                    rs_readers.clear();
-                    rs_reader_seg_offsets.clear();
-                } else if (scanner_seg_occupy + max_add_seg_nums == avg_segment_count) {
-                    rs_reader_seg_offsets.emplace_back(rs_seg_start_scan,
-                                                       rs_seg_count[rs_seg_count_index]);
-                    RETURN_IF_ERROR(build_new_scanner(*scan_range, scanner_ranges, rs_readers,
-                                                      rs_reader_seg_offsets));
-
-                    rs_seg_start_scan = 0;
-                    scanner_seg_occupy = 0;
-                    rs_readers.clear();
-                    rs_reader_seg_offsets.clear();
-                    rs_seg_count_index++;
-                } else {
-                    rs_reader_seg_offsets.emplace_back(rs_seg_start_scan,
-                                                       rs_seg_count[rs_seg_count_index]);
-
-                    rs_seg_start_scan = 0;
-                    scanner_seg_occupy += max_add_seg_nums;
-                    rs_seg_count_index++;
+                // the rows of a segment are estimated, so the last split of a segment reads to
+                // the end of it
+                int64_t segment_rows = std::max<int64_t>(rowset->num_rows() / num_segments, 1);
+                for (int seg = 0; seg < num_segments; ++seg) {
+                    for (int64_t first_row = 0; first_row < segment_rows;) {
+                        int64_t split_rows =
+                                std::min(segment_rows - first_row, rows_per_scanner - scanner_rows);
+                        bool to_end = first_row + split_rows == segment_rows;
+                        // A split ends in the middle of a segment only if the scanner is full,
+                        // so the segments of a rowset in a scanner are always continuous.
+                        if (rs_readers.empty() || rs_readers.back()->rowset() != rowset) {
+                            rs_readers.push_back(rowset_reader->clone());
+                            rs_reader_seg_offsets.emplace_back(seg, seg + 1);
+                            rs_reader_row_ranges.emplace_back();
+                        } else {
+                            rs_reader_seg_offsets.back().second = seg + 1;
+                        }
+                        if (first_row > 0 || !to_end) {
+                            rs_reader_row_ranges.back()[seg] = {
+                                    static_cast<uint32_t>(first_row),
+                                    to_end ? std::numeric_limits<uint32_t>::max()
+                                           : static_cast<uint32_t>(first_row + split_rows)};
+                        }
+                        first_row += split_rows;
+                        scanner_rows += split_rows;
+                        if (scanner_rows >= rows_per_scanner) {
+                            RETURN_IF_ERROR(flush_scanner());
+                        }
+                    }
                 }
             }
-
-#ifndef NDEBUG
-            for (const auto& offset : rs_reader_seg_offsets) {
-                DCHECK_NE(offset.first, offset.second);
-            }
-#endif
-
             // dispose some segment tail
             if (!rs_readers.empty()) {
-                build_new_scanner(*scan_range, scanner_ranges, rs_readers, rs_reader_seg_offsets);
+                RETURN_IF_ERROR(flush_scanner());
             }
         }
     } else {
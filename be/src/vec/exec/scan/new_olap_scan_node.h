@@ -31,6 +31,7 @@
 #include "common/status.h"
 #include "exec/olap_common.h"
 #include "exec/olap_utils.h"
+#include "olap/key_range_lookup_cache.h"
 #include "olap/olap_common.h"
 #include "util/runtime_profile.h"
 #include "vec/exec/scan/vscan_node.h"
@@ -85,6 +86,8 @@ protected:
 
     PushDownType _should_push_down_is_null_predicate() override { return PushDownType::ACCEPTABLE; }
 
+    PushDownType _should_push_down_geo_predicate() override { return PushDownType::ACCEPTABLE; }
+
     bool _should_push_down_common_expr() override;
 
     Status _init_scanners(std::list<VScannerSPtr>* scanners) override;
@@ -93,11 +96,16 @@ protected:
 
 private:
     Status _build_key_ranges_and_filters();
+    // Drop the scan ranges of the partitions the value range of the partition column, e.g. from
+    // the runtime filters arrived, does not match, before any scanner is created.
+    void _prune_scan_ranges_by_partition();
 
 private:
     TOlapScanNode _olap_scan_node;
     std::vector<std::unique_ptr<TPaloScanRange>> _scan_ranges;
     std::vector<std::unique_ptr<doris::OlapScanRange>> _cond_ranges;
+    // shared by all the scanners, see KeyRangeLookupCache
+    std::shared_ptr<KeyRangeLookupCache> _key_range_lookup_cache;
     OlapScanKeys _scan_keys;
     std::vector<TCondition> _olap_filters;
     // _compound_filters store conditions in the one compound relationship in conjunct expr tree except leaf node of `and` node,
@@ -112,6 +120,7 @@ private:
     RuntimeProfile::Counter* _num_disks_accessed_counter = nullptr;
 
     RuntimeProfile::Counter* _tablet_counter = nullptr;
+    RuntimeProfile::Counter* _pruned_tablet_counter = nullptr;
     RuntimeProfile::Counter* _rows_pushed_cond_filtered_counter = nullptr;
     RuntimeProfile::Counter* _reader_init_timer = nullptr;
     RuntimeProfile::Counter* _scanner_init_timer = nullptr;
@@ -135,9 +144,11 @@ private:
 
     RuntimeProfile::Counter* _stats_filtered_counter = nullptr;
     RuntimeProfile::Counter* _bf_filtered_counter = nullptr;
+    RuntimeProfile::Counter* _late_rf_index_filtered_counter = nullptr;
     RuntimeProfile::Counter* _del_filtered_counter = nullptr;
     RuntimeProfile::Counter* _conditions_filtered_counter = nullptr;
     RuntimeProfile::Counter* _key_range_filtered_counter = nullptr;
+    RuntimeProfile::Counter* _key_range_lookup_cache_hit_counter = nullptr;
 
     RuntimeProfile::Counter* _block_fetch_timer = nullptr;
     RuntimeProfile::Counter* _block_load_timer = nullptr;
@@ -152,6 +163,9 @@ private:
     RuntimeProfile::Counter* _second_read_timer = nullptr;
     RuntimeProfile::Counter* _first_read_seek_timer = nullptr;
     RuntimeProfile::Counter* _first_read_seek_counter = nullptr;
+    RuntimeProfile::Counter* _page_prefetch_plan_timer = nullptr;
+    RuntimeProfile::Counter* _page_prefetch_io_counter = nullptr;
+    RuntimeProfile::Counter* _page_prefetch_bytes_counter = nullptr;
     RuntimeProfile::Counter* _lazy_read_timer = nullptr;
     RuntimeProfile::Counter* _lazy_read_seek_timer = nullptr;
     RuntimeProfile::Counter* _lazy_read_seek_counter = nullptr;
@@ -189,6 +203,11 @@ private:
     RuntimeProfile::Counter* _filtered_segment_counter = nullptr;
     // total number of segment related to this scan node
     RuntimeProfile::Counter* _total_segment_counter = nullptr;
+    RuntimeProfile::Counter* _filtered_rowset_counter = nullptr;
+    RuntimeProfile::Counter* _segment_ngram_bf_checked_counter = nullptr;
+    RuntimeProfile::Counter* _segment_ngram_bf_filtered_counter = nullptr;
+    RuntimeProfile::Counter* _merged_agg_block_cache_hit_counter = nullptr;
+    RuntimeProfile::Counter* _merged_agg_block_cache_miss_counter = nullptr;
 };
 
 } // namespace doris::vectorized
@@ -34,11 +34,14 @@
 #include "common/consts.h"
 #include "common/logging.h"
 #include "exec/olap_utils.h"
+#include "exprs/create_predicate_function.h"
 #include "exprs/function_filter.h"
 #include "io/cache/block/block_file_cache_profile.h"
 #include "io/io_common.h"
+#include "io/io_statistics_reporter.h"
 #include "olap/olap_common.h"
 #include "olap/olap_tuple.h"
+#include "olap/predicate_creator.h"
 #include "olap/rowset/rowset.h"
 #include "olap/rowset/rowset_meta.h"
 #include "olap/schema_cache.h"
@@ -52,10 +55,13 @@
 #include "service/backend_options.h"
 #include "util/doris_metrics.h"
 #include "util/runtime_profile.h"
+#include "util/time.h"
 #include "vec/core/block.h"
 #include "vec/exec/scan/new_olap_scan_node.h"
 #include "vec/exec/scan/vscan_node.h"
 #include "vec/exprs/vexpr_context.h"
+#include "vec/exprs/vliteral.h"
+#include "vec/exprs/vslot_ref.h"
 #include "vec/olap/block_reader.h"
 
 namespace doris::vectorized {
@@ -134,6 +140,7 @@ Status NewOlapScanner::init() {
                 StorageEngine::instance()->tablet_manager()->get_tablet_and_status(tablet_id, true);
         RETURN_IF_ERROR(status);
         _tablet = std::move(tablet);
+        _tablet->set_last_query_time(UnixMillis());
         TOlapScanNode& olap_scan_node = ((NewOlapScanNode*)_parent)->_olap_scan_node;
         if (olap_scan_node.__isset.schema_version && olap_scan_node.__isset.columns_desc &&
             !olap_scan_node.columns_desc.empty() &&
@@ -166,33 +173,24 @@ Status NewOlapScanner::init() {
             }
         }
 
-        {
-            std::shared_lock rdlock(_tablet->get_header_lock());
-            if (_tablet_reader_params.rs_readers.empty()) {
-                const RowsetSharedPtr rowset = _tablet->rowset_with_max_version();
-                if (rowset == nullptr) {
-                    std::stringstream ss;
-                    ss << "fail to get latest version of tablet: " << tablet_id;
-                    LOG(WARNING) << ss.str();
-                    return Status::InternalError(ss.str());
-                }
-
-                // acquire tablet rowset readers at the beginning of the scan node
-                // to prevent this case: when there are lots of olap scanners to run for example 10000
-                // the rowsets maybe compacted when the last olap scanner starts
-                Version rd_version(0, _version);
-                Status acquire_reader_st =
-                        _tablet->capture_rs_readers(rd_version, &_tablet_reader_params.rs_readers);
-                if (!acquire_reader_st.ok()) {
-                    LOG(WARNING) << "fail to init reader.res=" << acquire_reader_st;
-                    std::stringstream ss;
-                    ss << "failed to initialize storage reader. tablet=" << _tablet->full_name()
-                       << ", res=" << acquire_reader_st
-                       << ", backend=" << BackendOptions::get_localhost();
-                    return Status::InternalError(ss.str());
-                }
+        if (_tablet_reader_params.rs_readers.empty()) {
+            // acquire tablet rowset readers at the beginning of the scan node
+            // to prevent this case: when there are lots of olap scanners to run for example 10000
+            // the rowsets maybe compacted when the last olap scanner starts
+            Status acquire_reader_st = _tablet->capture_rs_readers_of_version(
+                    _version, &_tablet_reader_params.rs_readers);
+            if (!acquire_reader_st.ok()) {
+                LOG(WARNING) << "fail to init reader.res=" << acquire_reader_st;
+                std::stringstream ss;
+                ss << "failed to initialize storage reader. tablet=" << _tablet->full_name()
+                   << ", res=" << acquire_reader_st
+                   << ", backend=" << BackendOptions::get_localhost();
+                return Status::InternalError(ss.str());
             }
+        }
 
+        {
+            std::shared_lock rdlock(_tablet->get_header_lock());
             // Initialize tablet_reader_params
             RETURN_IF_ERROR(_init_tablet_reader_params(_key_ranges, parent->_olap_filters,
                                                        parent->_filter_predicates,
@@ -257,8 +255,15 @@ Status NewOlapScanner::_init_tablet_reader_params(
         _tablet_reader_params.direct_mode = true;
         _aggregation = true;
     } else {
+        // The delete bitmap of a merge-on-write table already filters out the old rows of the
+        // same keys, so the rowsets are just concatenated, unless they are read in key order.
+        const auto& sort_info = real_parent->_olap_scan_node.sort_info;
+        bool mow_unordered = _tablet->enable_unique_key_merge_on_write() &&
+                             !_state->skip_delete_bitmap() &&
+                             !(real_parent->_olap_scan_node.__isset.sort_info &&
+                               !sort_info.is_asc_order.empty());
         _tablet_reader_params.direct_mode =
-                _aggregation || single_version ||
+                _aggregation || single_version || mow_unordered ||
                 real_parent->_olap_scan_node.__isset.push_down_agg_type_opt;
     }
 
@@ -268,6 +273,7 @@ Status NewOlapScanner::_init_tablet_reader_params(
     _tablet_reader_params.tablet_schema = _tablet_schema;
     _tablet_reader_params.reader_type = ReaderType::READER_QUERY;
     _tablet_reader_params.aggregation = _aggregation;
+    _tablet_reader_params.use_merged_agg_block_cache = config::enable_merged_agg_block_cache;
     if (real_parent->_olap_scan_node.__isset.push_down_agg_type_opt) {
         _tablet_reader_params.push_down_agg_type_opt =
                 real_parent->_olap_scan_node.push_down_agg_type_opt;
@@ -410,6 +416,26 @@ Status NewOlapScanner::_init_tablet_reader_params(
                 ((NewOlapScanNode*)_parent)->_olap_scan_node.use_topn_opt;
     }
 
+    if (!_tablet_reader_params.start_key.empty()) {
+        _tablet_reader_params.key_range_lookup_cache =
+                ((NewOlapScanNode*)_parent)->_key_range_lookup_cache;
+    }
+
+    if (config::enable_late_runtime_filter_index_pruning && _total_rf_num > 0) {
+        _late_rf_predicates = std::make_shared<LateRuntimeFilterPredicates>();
+        _tablet_reader_params.late_runtime_filter_predicates = _late_rf_predicates;
+    }
+
+    // The rows of a duplicate key segment are not merged with the other segments, so a segment
+    // can stop reading after the limit of the scan when there is no conjunct left to filter the
+    // rows, e.g. it stops iterating the postings of a match predicate early.
+    if (_parent->limit() > 0 && !_tablet_reader_params.read_orderby_key && _conjuncts.empty() &&
+        _common_expr_ctxs_push_down.empty() && _total_rf_num == 0 &&
+        !real_parent->_olap_scan_node.__isset.push_down_agg_type_opt &&
+        _tablet_schema->keys_type() == KeysType::DUP_KEYS) {
+        _tablet_reader_params.read_limit = _parent->limit();
+    }
+
     // If this is a Two-Phase read query, and we need to delay the release of Rowset
     // by rowset->update_delayed_expired_timestamp().This could expand the lifespan of Rowset
     if (_tablet_schema->field_index(BeConsts::ROWID_COL) >= 0) {
@@ -425,6 +451,72 @@ Status NewOlapScanner::_init_tablet_reader_params(
     return Status::OK();
 }
 
+Status NewOlapScanner::_on_late_arrival_runtime_filter() {
+    if (_late_rf_predicates == nullptr) {
+        return Status::OK();
+    }
+    VExprSPtrs exprs;
+    _parent->get_late_arrival_rf_exprs(_num_late_rf_exprs, &exprs);
+    _num_late_rf_exprs += exprs.size();
+    for (const auto& expr : exprs) {
+        ColumnPredicate* predicate = _parse_late_rf_to_predicate(expr);
+        if (predicate != nullptr) {
+            _late_rf_predicates->add(predicate);
+        }
+    }
+    return Status::OK();
+}
+
+// Only IN and min/max runtime filters on the slots of this table could be used by the index.
+ColumnPredicate* NewOlapScanner::_parse_late_rf_to_predicate(const VExprSPtr& rf_expr) {
+    auto impl = rf_expr->get_impl();
+    if (impl == nullptr || impl->children().empty() || !impl->children()[0]->is_slot_ref()) {
+        return nullptr;
+    }
+    auto slot_id = static_cast<const VSlotRef*>(impl->children()[0].get())->slot_id();
+    const SlotDescriptor* slot = nullptr;
+    for (auto* s : _output_tuple_desc->slots()) {
+        if (s->id() == slot_id) {
+            slot = s;
+            break;
+        }
+    }
+    if (slot == nullptr) {
+        return nullptr;
+    }
+    int32_t index = _tablet_schema->field_index(slot->col_name());
+    if (index < 0) {
+        return nullptr;
+    }
+    const TabletColumn& column = _tablet_schema->column(index);
+
+    if (impl->node_type() == TExprNodeType::IN_PRED && impl->get_set_func() != nullptr) {
+        return create_column_predicate(index, impl->get_set_func(), column.type(),
+                                       _state->be_exec_version(), &column);
+    }
+    if (impl->node_type() != TExprNodeType::BINARY_PRED || impl->children().size() != 2) {
+        return nullptr;
+    }
+    // the literal of float may lose precision when converted to string
+    auto literal = std::dynamic_pointer_cast<VLiteral>(impl->children()[1]);
+    if (literal == nullptr || is_float_or_double(slot->type().type)) {
+        return nullptr;
+    }
+    TCondition condition;
+    condition.__set_column_name(column.name());
+    condition.__set_column_unique_id(column.unique_id());
+    const auto& fn_name = impl->fn().name.function_name;
+    if (fn_name == "ge") {
+        condition.__set_condition_op(">=");
+    } else if (fn_name == "le") {
+        condition.__set_condition_op("<=");
+    } else {
+        return nullptr;
+    }
+    condition.condition_values.push_back(literal->value());
+    return parse_to_predicate(_tablet_schema, condition, _late_rf_predicates->arena());
+}
+
 Status NewOlapScanner::_init_return_columns() {
     for (auto slot : _output_tuple_desc->slots()) {
         if (!slot->is_materialized()) {
@@ -555,6 +647,9 @@ void NewOlapScanner::_update_counters_before_close() {
     COUNTER_UPDATE(olap_parent->_second_read_timer, stats.second_read_ns);
     COUNTER_UPDATE(olap_parent->_first_read_seek_timer, stats.block_first_read_seek_ns);
     COUNTER_UPDATE(olap_parent->_first_read_seek_counter, stats.block_first_read_seek_num);
+    COUNTER_UPDATE(olap_parent->_page_prefetch_plan_timer, stats.page_prefetch_plan_ns);
+    COUNTER_UPDATE(olap_parent->_page_prefetch_io_counter, stats.page_prefetch_io_count);
+    COUNTER_UPDATE(olap_parent->_page_prefetch_bytes_counter, stats.page_prefetch_bytes);
     COUNTER_UPDATE(olap_parent->_lazy_read_timer, stats.lazy_read_ns);
     COUNTER_UPDATE(olap_parent->_lazy_read_seek_timer, stats.block_lazy_read_seek_ns);
     COUNTER_UPDATE(olap_parent->_lazy_read_seek_counter, stats.block_lazy_read_seek_num);
@@ -572,12 +667,16 @@ void NewOlapScanner::_update_counters_before_close() {
 
     COUNTER_UPDATE(olap_parent->_stats_filtered_counter, stats.rows_stats_filtered);
     COUNTER_UPDATE(olap_parent->_bf_filtered_counter, stats.rows_bf_filtered);
+    COUNTER_UPDATE(olap_parent->_late_rf_index_filtered_counter,
+                   stats.rows_late_rf_index_filtered);
     COUNTER_UPDATE(olap_parent->_del_filtered_counter, stats.rows_del_filtered);
     COUNTER_UPDATE(olap_parent->_del_filtered_counter, stats.rows_del_by_bitmap);
     COUNTER_UPDATE(olap_parent->_del_filtered_counter, stats.rows_vec_del_cond_filtered);
 
     COUNTER_UPDATE(olap_parent->_conditions_filtered_counter, stats.rows_conditions_filtered);
     COUNTER_UPDATE(olap_parent->_key_range_filtered_counter, stats.rows_key_range_filtered);
+    COUNTER_UPDATE(olap_parent->_key_range_lookup_cache_hit_counter,
+                   stats.key_range_lookup_cache_hit);
 
     COUNTER_UPDATE(olap_parent->_total_pages_num_counter, stats.total_pages_num);
     COUNTER_UPDATE(olap_parent->_cached_pages_num_counter, stats.cached_pages_num);
@@ -605,12 +704,22 @@ void NewOlapScanner::_update_counters_before_close() {
         io::FileCacheProfileReporter cache_profile(olap_parent->_segment_profile.get());
         cache_profile.update(&stats.file_cache_stats);
     }
+    io::report_io_statistics(_state, olap_parent->_segment_profile.get(), stats.io_stats);
 
     COUNTER_UPDATE(olap_parent->_output_index_result_column_timer,
                    stats.output_index_result_column_timer);
 
     COUNTER_UPDATE(olap_parent->_filtered_segment_counter, stats.filtered_segment_number);
     COUNTER_UPDATE(olap_parent->_total_segment_counter, stats.total_segment_number);
+    COUNTER_UPDATE(olap_parent->_filtered_rowset_counter, stats.filtered_rowset_number);
+    COUNTER_UPDATE(olap_parent->_segment_ngram_bf_checked_counter,
+                   stats.segment_ngram_bf_checked_number);
+    COUNTER_UPDATE(olap_parent->_segment_ngram_bf_filtered_counter,
+                   stats.segment_ngram_bf_filtered_number);
+    COUNTER_UPDATE(olap_parent->_merged_agg_block_cache_hit_counter,
+                   stats.merged_agg_block_cache_hit);
+    COUNTER_UPDATE(olap_parent->_merged_agg_block_cache_miss_counter,
+                   stats.merged_agg_block_cache_miss);
 
     // Update metrics
     DorisMetrics::instance()->query_scan_bytes->increment(_compressed_bytes_read);
@@ -76,6 +76,7 @@ public:
 protected:
     Status _get_block_impl(RuntimeState* state, Block* block, bool* eos) override;
     void _update_counters_before_close() override;
+    Status _on_late_arrival_runtime_filter() override;
 
 private:
     void _update_realtime_counters();
@@ -87,6 +88,8 @@ private:
 
     Status _init_return_columns();
 
+    ColumnPredicate* _parse_late_rf_to_predicate(const VExprSPtr& rf_expr);
+
     bool _aggregation;
     bool _need_agg_finalize;
 
@@ -103,6 +106,10 @@ private:
     std::unordered_set<uint32_t> _tablet_columns_convert_to_null_set;
     std::vector<TCondition> _compound_filters;
 
+    // shared with the segment iterators to prune by index with the late arrived runtime filters
+    std::shared_ptr<LateRuntimeFilterPredicates> _late_rf_predicates;
+    size_t _num_late_rf_exprs = 0;
+
     // ========= profiles ==========
     int64_t _compressed_bytes_read = 0;
     int64_t _raw_rows_read = 0;
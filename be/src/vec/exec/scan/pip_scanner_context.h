@@ -17,6 +17,7 @@
 
 #pragma once
 
+#include "pipeline/exec/dependency.h"
 #include "runtime/descriptors.h"
 #include "scanner_context.h"
 
@@ -40,28 +41,25 @@ public:
 
     Status get_block_from_queue(RuntimeState* state, vectorized::BlockUPtr* block, bool* eos,
                                 int id, bool wait = false) override {
-        {
-            std::unique_lock l(_transfer_lock);
-            if (state->is_cancelled()) {
-                _process_status = Status::Cancelled("cancelled");
-            }
-
-            if (!_process_status.ok()) {
-                return _process_status;
-            }
+        if (state->is_cancelled()) {
+            set_status_on_error(Status::Cancelled("cancelled"));
+        }
+        if (_status_error) {
+            std::lock_guard l(_transfer_lock);
+            return _process_status;
         }
 
-        {
-            std::unique_lock<std::mutex> l(*_queue_mutexs[id]);
-            if (!_blocks_queues[id].empty()) {
-                *block = std::move(_blocks_queues[id].front());
-                _blocks_queues[id].pop_front();
-            } else {
-                *eos = _is_finished || _should_stop;
-                return Status::OK();
+        // All the blocks are in the queue once it is finished, so check it before popping.
+        bool is_finished = _is_finished || _should_stop;
+        if (!_blocks_queues[id]->try_pop(block)) {
+            if (!is_finished) {
+                ++_num_consumer_starved;
             }
+            *eos = is_finished;
+            return Status::OK();
         }
         _current_used_bytes -= (*block)->allocated_bytes();
+        _consumed_bytes += (*block)->allocated_bytes();
         return Status::OK();
     }
 
@@ -69,13 +67,14 @@ public:
     bool done() override { return _is_finished || _should_stop || _status_error; }
 
     void append_blocks_to_queue(std::vector<vectorized::BlockUPtr>& blocks) override {
-        const int queue_size = _queue_mutexs.size();
+        const int queue_size = _blocks_queues.size();
         const int block_size = blocks.size();
         int64_t local_bytes = 0;
 
         if (_need_colocate_distribute) {
             std::vector<uint64_t> hash_vals;
             for (const auto& block : blocks) {
+                _produced_bytes += block->allocated_bytes();
                 // vectorized calculate hash
                 int rows = block->rows();
                 const auto element_size = _max_queue_size;
@@ -109,31 +108,31 @@ public:
             for (const auto& block : blocks) {
                 local_bytes += block->allocated_bytes();
             }
+            // count the bytes before the blocks are visible to the consumers
+            _current_used_bytes += local_bytes;
+            _produced_bytes += local_bytes;
 
             for (int i = 0; i < queue_size && i < block_size; ++i) {
                 int queue = _next_queue_to_feed;
-                {
-                    std::lock_guard<std::mutex> l(*_queue_mutexs[queue]);
-                    for (int j = i; j < block_size; j += queue_size) {
-                        _blocks_queues[queue].emplace_back(std::move(blocks[j]));
-                    }
+                for (int j = i; j < block_size; j += queue_size) {
+                    _blocks_queues[queue]->push(std::move(blocks[j]));
                 }
+                _dependencies[queue]->notify();
                 _next_queue_to_feed = queue + 1 < queue_size ? queue + 1 : 0;
             }
         }
-        _current_used_bytes += local_bytes;
     }
 
-    bool empty_in_queue(int id) override {
-        std::unique_lock<std::mutex> l(*_queue_mutexs[id]);
-        return _blocks_queues[id].empty();
-    }
+    bool empty_in_queue(int id) override { return _blocks_queues[id]->empty(); }
+
+    pipeline::Dependency* source_dependency(int id) override { return _dependencies[id].get(); }
 
     void set_max_queue_size(const int max_queue_size) override {
         _max_queue_size = max_queue_size;
         for (int i = 0; i < max_queue_size; ++i) {
-            _queue_mutexs.emplace_back(new std::mutex);
-            _blocks_queues.emplace_back(std::list<vectorized::BlockUPtr>());
+            _blocks_queues.emplace_back(std::make_unique<MpmcQueue<vectorized::BlockUPtr>>(
+                    std::max(_free_blocks_capacity.load(), 16)));
+            _dependencies.emplace_back(std::make_unique<Dependency>());
         }
         if (_need_colocate_distribute) {
             int real_block_size =
@@ -157,24 +156,35 @@ public:
         return _current_used_bytes < _max_bytes_in_queue / 2 * _max_queue_size;
     }
 
+    double _blocks_queue_fill_ratio() const override {
+        return (double)_current_used_bytes / (_max_bytes_in_queue * _max_queue_size);
+    }
+
     void _dispose_coloate_blocks_not_in_queue() override {
         if (_need_colocate_distribute) {
             for (int i = 0; i < _max_queue_size; ++i) {
-                std::scoped_lock s(*_colocate_block_mutexs[i], *_queue_mutexs[i]);
+                std::lock_guard l(*_colocate_block_mutexs[i]);
                 if (_colocate_blocks[i] && !_colocate_blocks[i]->empty()) {
                     _current_used_bytes += _colocate_blocks[i]->allocated_bytes();
-                    _blocks_queues[i].emplace_back(std::move(_colocate_blocks[i]));
+                    _blocks_queues[i]->push(std::move(_colocate_blocks[i]));
                     _colocate_mutable_blocks[i]->clear();
                 }
             }
         }
     }
 
+    void _notify_dependencies() override {
+        for (auto& dependency : _dependencies) {
+            dependency->notify();
+        }
+    }
+
 private:
     int _max_queue_size = 1;
     int _next_queue_to_feed = 0;
-    std::vector<std::unique_ptr<std::mutex>> _queue_mutexs;
-    std::vector<std::list<vectorized::BlockUPtr>> _blocks_queues;
+    // lock-free queues, one for each consumer
+    std::vector<std::unique_ptr<MpmcQueue<vectorized::BlockUPtr>>> _blocks_queues;
+    std::vector<std::unique_ptr<Dependency>> _dependencies;
     std::atomic_int64_t _current_used_bytes = 0;
 
     const std::vector<int>& _col_distribute_ids;
@@ -205,10 +215,8 @@ private:
 
             if (row_add == max_add) {
                 _current_used_bytes += _colocate_blocks[loc]->allocated_bytes();
-                {
-                    std::lock_guard<std::mutex> queue_l(*_queue_mutexs[loc]);
-                    _blocks_queues[loc].emplace_back(std::move(_colocate_blocks[loc]));
-                }
+                _blocks_queues[loc]->push(std::move(_colocate_blocks[loc]));
+                _dependencies[loc]->notify();
                 bool get_block_not_empty = true;
                 _colocate_blocks[loc] = get_free_block(&get_block_not_empty, get_block_not_empty);
                 _colocate_mutable_blocks[loc]->set_muatable_columns(
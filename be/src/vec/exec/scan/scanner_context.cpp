@@ -33,6 +33,7 @@
 #include "runtime/query_context.h"
 #include "runtime/runtime_state.h"
 #include "util/pretty_printer.h"
+#include "util/time.h"
 #include "util/uid_util.h"
 #include "vec/core/block.h"
 #include "vec/exec/scan/scanner_scheduler.h"
@@ -77,6 +78,8 @@ Status ScannerContext::init() {
     if (_parent->should_run_serial()) {
         _max_thread_num = 1;
     }
+    _num_active_scanners = _max_thread_num;
+    _last_adjust_concurrency_ms = MonotonicMillis();
 
     _scanner_profile = _parent->_scanner_profile;
     _scanner_sched_counter = _parent->_scanner_sched_counter;
@@ -98,42 +101,49 @@ Status ScannerContext::init() {
             limit == -1 ? _batch_size : std::min(static_cast<int64_t>(_batch_size), limit);
     _block_per_scanner = (doris_scanner_row_num + (real_block_size - 1)) / real_block_size;
     _free_blocks_capacity = _max_thread_num * _block_per_scanner;
+    // The blocks in use are bounded by the free blocks capacity in most cases, the queue
+    // falls back to a locked list if there are more.
+    _blocks_queue = std::make_unique<MpmcQueue<vectorized::BlockUPtr>>(
+            std::max(_free_blocks_capacity.load(), 16));
+    _free_blocks = std::make_unique<BoundedMpmcQueue<vectorized::BlockUPtr>>(
+            std::max(_free_blocks_capacity.load(), 16));
 
 #ifndef BE_TEST
     // 3. get thread token
     thread_token = _state->get_query_ctx()->get_token();
 #endif
+    _scan_in_pipeline_task = _parent->_is_pipeline_scan && config::enable_scan_in_pipeline_task;
 
     // 4. This ctx will be submitted to the scanner scheduler right after init.
     // So set _num_scheduling_ctx to 1 here.
-    _num_scheduling_ctx = 1;
+    _num_scheduling_ctx = _scan_in_pipeline_task ? 0 : 1;
 
     _num_unfinished_scanners = _scanners.size();
 
     COUNTER_SET(_parent->_max_scanner_thread_num, (int64_t)_max_thread_num);
     _parent->_runtime_profile->add_info_string("UseSpecificThreadToken",
                                                thread_token == nullptr ? "False" : "True");
+    _parent->_runtime_profile->add_info_string("ScanInPipelineTask",
+                                               _scan_in_pipeline_task ? "True" : "False");
 
     return Status::OK();
 }
 
 vectorized::BlockUPtr ScannerContext::get_free_block(bool* has_free_block,
                                                      bool get_block_not_empty) {
-    {
-        std::lock_guard l(_free_blocks_lock);
-        *has_free_block = _free_blocks_capacity > 0;
-        // Always reduce _free_blocks_capacity by one since we always return a block
-        if (_free_blocks_capacity > 0) {
-            --_free_blocks_capacity;
-        }
-
-        if (!_free_blocks.empty()) {
-            if (!get_block_not_empty || _free_blocks.back()->mem_reuse()) {
-                auto block = std::move(_free_blocks.back());
-                _free_blocks.pop_back();
-                _free_blocks_memory_usage->add(-block->allocated_bytes());
-                return block;
-            }
+    // Always reduce _free_blocks_capacity by one since we always return a block
+    int32_t capacity = _free_blocks_capacity.load();
+    while (capacity > 0 &&
+           !_free_blocks_capacity.compare_exchange_weak(capacity, capacity - 1)) {
+    }
+    *has_free_block = capacity > 0;
+
+    vectorized::BlockUPtr block;
+    if (_free_blocks->try_pop(&block)) {
+        _free_blocks_memory_usage->add(-block->allocated_bytes());
+        // the block without columns is dropped
+        if (!get_block_not_empty || block->mem_reuse()) {
+            return block;
         }
     }
 
@@ -144,32 +154,45 @@ vectorized::BlockUPtr ScannerContext::get_free_block(bool* has_free_block,
 
 void ScannerContext::return_free_block(std::unique_ptr<vectorized::Block> block) {
     block->clear_column_data();
-    _free_blocks_memory_usage->add(block->allocated_bytes());
-    std::lock_guard l(_free_blocks_lock);
-    _free_blocks.emplace_back(std::move(block));
+    auto block_bytes = block->allocated_bytes();
+    if (_free_blocks->try_push(std::move(block))) {
+        _free_blocks_memory_usage->add(block_bytes);
+    }
     ++_free_blocks_capacity;
 }
 
 void ScannerContext::append_blocks_to_queue(std::vector<vectorized::BlockUPtr>& blocks) {
-    std::lock_guard l(_transfer_lock);
-    auto old_bytes_in_queue = _cur_bytes_in_queue;
+    int64_t bytes = 0;
+    for (auto& b : blocks) {
+        bytes += b->allocated_bytes();
+    }
+    // count the bytes before the blocks are visible to the consumer
+    _cur_bytes_in_queue += bytes;
+    _produced_bytes += bytes;
+    _queued_blocks_memory_usage->add(bytes);
     for (auto& b : blocks) {
-        _cur_bytes_in_queue += b->allocated_bytes();
-        _blocks_queue.push_back(std::move(b));
+        _blocks_queue->push(std::move(b));
     }
     blocks.clear();
-    _blocks_queue_added_cv.notify_one();
-    _queued_blocks_memory_usage->add(_cur_bytes_in_queue - old_bytes_in_queue);
+    _wake_up_waiting_consumer();
+}
+
+void ScannerContext::_wake_up_waiting_consumer() {
+    // Pairs with the fence in get_block_from_queue, so either the consumer sees the new blocks
+    // before waiting, or we see it is waiting.
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (_num_waiting_consumers > 0) {
+        std::lock_guard l(_transfer_lock);
+        _blocks_queue_added_cv.notify_one();
+    }
 }
 
 bool ScannerContext::empty_in_queue(int id) {
-    std::unique_lock l(_transfer_lock);
-    return _blocks_queue.empty();
+    return _blocks_queue->empty();
 }
 
 Status ScannerContext::get_block_from_queue(RuntimeState* state, vectorized::BlockUPtr* block,
                                             bool* eos, int id, bool wait) {
-    std::unique_lock l(_transfer_lock);
     // Normally, the scanner scheduler will schedule ctx.
     // But when the amount of data in the blocks queue exceeds the upper limit,
     // the scheduler will stop scheduling.
@@ -177,48 +200,66 @@ Status ScannerContext::get_block_from_queue(RuntimeState* state, vectorized::Blo
     // At this point, consumers are required to trigger new scheduling to ensure that
     // data can be continuously fetched.
     if (has_enough_space_in_blocks_queue() && _num_running_scanners == 0) {
-        _num_scheduling_ctx++;
-        _scanner_scheduler->submit(this);
-    }
-    // Wait for block from queue
-    if (wait) {
-        SCOPED_TIMER(_scanner_wait_batch_timer);
-        while (!(!_blocks_queue.empty() || _is_finished || !_process_status.ok() ||
-                 state->is_cancelled())) {
-            _blocks_queue_added_cv.wait(l);
+        std::lock_guard l(_transfer_lock);
+        if (has_enough_space_in_blocks_queue() && _num_running_scanners == 0) {
+            _num_scheduling_ctx++;
+            _scanner_scheduler->submit(this);
         }
     }
+    auto ready = [&]() {
+        return !_blocks_queue->empty() || _is_finished || _status_error || state->is_cancelled();
+    };
+    while (true) {
+        if (state->is_cancelled()) {
+            set_status_on_error(Status::Cancelled("cancelled"));
+        }
+        if (_status_error) {
+            std::lock_guard l(_transfer_lock);
+            return _process_status;
+        }
 
-    if (state->is_cancelled()) {
-        _process_status = Status::Cancelled("cancelled");
-    }
-
-    if (!_process_status.ok()) {
-        return _process_status;
-    }
+        // All the blocks are in the queue once it is finished, so check it before popping.
+        bool is_finished = _is_finished;
+        if (_blocks_queue->try_pop(block)) {
+            auto block_bytes = (*block)->allocated_bytes();
+            _cur_bytes_in_queue -= block_bytes;
+            _consumed_bytes += block_bytes;
+            _queued_blocks_memory_usage->add(-block_bytes);
+            return Status::OK();
+        }
+        if (!is_finished) {
+            ++_num_consumer_starved;
+        }
+        if (!wait || is_finished) {
+            *eos = is_finished;
+            return Status::OK();
+        }
 
-    if (!_blocks_queue.empty()) {
-        *block = std::move(_blocks_queue.front());
-        _blocks_queue.pop_front();
-        auto block_bytes = (*block)->allocated_bytes();
-        _cur_bytes_in_queue -= block_bytes;
-        _queued_blocks_memory_usage->add(-block_bytes);
-        return Status::OK();
-    } else {
-        *eos = _is_finished;
+        // Wait for block from queue
+        SCOPED_TIMER(_scanner_wait_batch_timer);
+        std::unique_lock l(_transfer_lock);
+        ++_num_waiting_consumers;
+        // Pairs with the fence in _wake_up_waiting_consumer.
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        while (!ready()) {
+            _blocks_queue_added_cv.wait(l);
+        }
+        --_num_waiting_consumers;
     }
-    return Status::OK();
 }
 
 bool ScannerContext::set_status_on_error(const Status& status) {
-    std::lock_guard l(_transfer_lock);
-    if (_process_status.ok()) {
+    {
+        std::lock_guard l(_transfer_lock);
+        if (!_process_status.ok()) {
+            return false;
+        }
         _process_status = status;
         _status_error = true;
         _blocks_queue_added_cv.notify_one();
-        return true;
     }
-    return false;
+    _notify_dependencies();
+    return true;
 }
 
 Status ScannerContext::_close_and_clear_scanners(VScanNode* node, RuntimeState* state) {
@@ -280,9 +321,10 @@ void ScannerContext::clear_and_join(VScanNode* node, RuntimeState* state) {
     // So that we can make sure to close all scanners.
     _close_and_clear_scanners(node, state);
 
-    _blocks_queue.clear();
-    std::unique_lock lock(_free_blocks_lock);
-    _free_blocks.clear();
+    _blocks_queue->clear();
+    vectorized::BlockUPtr block;
+    while (_free_blocks->try_pop(&block)) {
+    }
 }
 
 bool ScannerContext::no_schedule() {
@@ -295,13 +337,18 @@ std::string ScannerContext::debug_string() {
             "id: {}, sacnners: {}, blocks in queue: {},"
             " status: {}, _should_stop: {}, _is_finished: {}, free blocks: {},"
             " limit: {}, _num_running_scanners: {}, _num_scheduling_ctx: {}, _max_thread_num: {},"
-            " _block_per_scanner: {}, _cur_bytes_in_queue: {}, MAX_BYTE_OF_QUEUE: {}",
-            ctx_id, _scanners.size(), _blocks_queue.size(), _process_status.ok(), _should_stop,
-            _is_finished, _free_blocks.size(), limit, _num_running_scanners, _num_scheduling_ctx,
-            _max_thread_num, _block_per_scanner, _cur_bytes_in_queue, _max_bytes_in_queue);
+            " _num_active_scanners: {}, _block_per_scanner: {}, _cur_bytes_in_queue: {},"
+            " MAX_BYTE_OF_QUEUE: {}",
+            ctx_id, _scanners.size(), _blocks_queue->size_approx(), _process_status.ok(),
+            _should_stop, _is_finished, _free_blocks->size_approx(), limit, _num_running_scanners,
+            _num_scheduling_ctx, _max_thread_num, _num_active_scanners, _block_per_scanner,
+            _cur_bytes_in_queue.load(), _max_bytes_in_queue);
 }
 
 void ScannerContext::reschedule_scanner_ctx() {
+    if (_scan_in_pipeline_task) {
+        return;
+    }
     std::lock_guard l(_transfer_lock);
     auto submit_st = _scanner_scheduler->submit(this);
     //todo(wb) rethinking is it better to mark current scan_context failed when submit failed many times?
@@ -315,8 +362,8 @@ void ScannerContext::push_back_scanner_and_reschedule(VScannerSPtr scanner) {
         std::unique_lock l(_scanners_lock);
         _scanners.push_front(scanner);
     }
-    std::lock_guard l(_transfer_lock);
-    if (has_enough_space_in_blocks_queue()) {
+    std::unique_lock l(_transfer_lock);
+    if (!_scan_in_pipeline_task && has_enough_space_in_blocks_queue()) {
         _num_scheduling_ctx++;
         auto submit_st = _scanner_scheduler->submit(this);
         if (!submit_st.ok()) {
@@ -338,20 +385,61 @@ void ScannerContext::push_back_scanner_and_reschedule(VScannerSPtr scanner) {
     // In pipeline engine, doris will close scanners when `no_schedule`.
     _num_running_scanners--;
     _ctx_finish_cv.notify_one();
+    if (_is_finished || _scan_in_pipeline_task) {
+        // the scanner may be taken by the waiting pipeline tasks
+        l.unlock();
+        _notify_dependencies();
+    }
+}
+
+void ScannerContext::_adjust_scanner_concurrency() {
+    if (config::scanner_concurrency_adjust_interval_ms <= 0) {
+        _num_active_scanners = _max_thread_num;
+        return;
+    }
+    int64_t now_ms = MonotonicMillis();
+    int64_t last_ms = _last_adjust_concurrency_ms;
+    if (now_ms - last_ms < config::scanner_concurrency_adjust_interval_ms ||
+        !_last_adjust_concurrency_ms.compare_exchange_strong(last_ms, now_ms)) {
+        return;
+    }
+    int64_t produced = _produced_bytes.exchange(0);
+    int64_t consumed = _consumed_bytes.exchange(0);
+    int32_t starved = _num_consumer_starved.exchange(0);
+    double fill_ratio = _blocks_queue_fill_ratio();
+    int32_t active = _num_active_scanners;
+    if (fill_ratio >= HIGH_QUEUE_FILL_RATIO && produced > consumed) {
+        // The consumer is slower than the scanners, keep the scanners which are enough to
+        // catch up with it.
+        active = std::max<int32_t>(1, std::min<int64_t>(active - 1, active * consumed / produced));
+    } else if (fill_ratio <= LOW_QUEUE_FILL_RATIO && (starved > 0 || consumed >= produced)) {
+        // The consumer takes the blocks as soon as they are produced.
+        active = std::min(_max_thread_num, active * 2);
+    }
+    if (active < _num_active_scanners) {
+        vectorized::BlockUPtr block;
+        size_t num_kept_blocks = active * _block_per_scanner;
+        while (_free_blocks->size_approx() > num_kept_blocks && _free_blocks->try_pop(&block)) {
+            _free_blocks_memory_usage->add(-block->allocated_bytes());
+        }
+    }
+    _num_active_scanners = active;
 }
 
-void ScannerContext::get_next_batch_of_scanners(std::list<VScannerSPtr>* current_run) {
+void ScannerContext::get_next_batch_of_scanners(std::list<VScannerSPtr>* current_run,
+                                                int max_num) {
+    _adjust_scanner_concurrency();
     // 1. Calculate how many scanners should be scheduled at this run.
     int thread_slot_num = 0;
     {
         // If there are enough space in blocks queue,
         // the scanner number depends on the _free_blocks_capacity
-        std::lock_guard f(_free_blocks_lock);
         thread_slot_num = (_free_blocks_capacity + _block_per_scanner - 1) / _block_per_scanner;
-        thread_slot_num = std::min(thread_slot_num, _max_thread_num - _num_running_scanners);
+        thread_slot_num = std::min(thread_slot_num, _num_active_scanners - _num_running_scanners);
         if (thread_slot_num <= 0) {
             thread_slot_num = 1;
         }
+        thread_slot_num = std::min(thread_slot_num, max_num);
     }
 
     // 2. get #thread_slot_num scanners from ctx->scanners
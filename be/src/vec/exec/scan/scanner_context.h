@@ -21,6 +21,7 @@
 #include <stdint.h>
 
 #include <atomic>
+#include <limits>
 #include <list>
 #include <memory>
 #include <mutex>
@@ -30,6 +31,8 @@
 #include "common/factory_creator.h"
 #include "common/status.h"
 #include "util/lock.h"
+#include "util/lock_profiler.h"
+#include "util/mpmc_queue.h"
 #include "util/runtime_profile.h"
 #include "vec/core/block.h"
 #include "vec/exec/scan/vscanner.h"
@@ -40,6 +43,10 @@ class ThreadPoolToken;
 class RuntimeState;
 class TupleDescriptor;
 
+namespace pipeline {
+class Dependency;
+} // namespace pipeline
+
 namespace vectorized {
 
 class VScanner;
@@ -91,9 +98,12 @@ public:
     // Called by ScanNode.
     // Used to notify the scheduler that this ScannerContext can stop working.
     void set_should_stop() {
-        std::lock_guard l(_transfer_lock);
-        _should_stop = true;
-        _blocks_queue_added_cv.notify_one();
+        {
+            std::lock_guard l(_transfer_lock);
+            _should_stop = true;
+            _blocks_queue_added_cv.notify_one();
+        }
+        _notify_dependencies();
     }
 
     // Return true if this ScannerContext need no more process
@@ -115,7 +125,22 @@ public:
 
     int get_num_scheduling_ctx() const { return _num_scheduling_ctx; }
 
-    void get_next_batch_of_scanners(std::list<VScannerSPtr>* current_run);
+    // Get at most `max_num` scanners to run.
+    void get_next_batch_of_scanners(std::list<VScannerSPtr>* current_run,
+                                    int max_num = std::numeric_limits<int>::max());
+
+    // Whether the scanners are run by the pipeline tasks of the scan operators instead of
+    // the scanner thread pools, see config::enable_scan_in_pipeline_task.
+    bool scan_in_pipeline_task() const { return _scan_in_pipeline_task; }
+
+    // Whether a pipeline task may take a scanner to run, only a hint.
+    bool has_idle_scanner() {
+        if (!has_enough_space_in_blocks_queue() || _num_running_scanners >= _num_active_scanners) {
+            return false;
+        }
+        std::lock_guard l(_scanners_lock);
+        return !_scanners.empty();
+    }
 
     void clear_and_join(VScanNode* node, RuntimeState* state);
 
@@ -134,6 +159,10 @@ public:
 
     virtual void set_max_queue_size(int max_queue_size) {};
 
+    // The dependency notified when blocks are appended to the queue `id' or this context is
+    // done, nullptr if the consumer waits on the condition variable in get_block_from_queue.
+    virtual pipeline::Dependency* source_dependency(int id) { return nullptr; }
+
     // todo(wb) rethinking how to calculate ```_max_bytes_in_queue``` when executing shared scan
     virtual inline bool has_enough_space_in_blocks_queue() const {
         return _cur_bytes_in_queue < _max_bytes_in_queue / 2;
@@ -151,8 +180,30 @@ private:
     Status _close_and_clear_scanners(VScanNode* node, RuntimeState* state);
 
 protected:
+    // see _adjust_scanner_concurrency(), the scanners are not scheduled once the queue is
+    // half full, see has_enough_space_in_blocks_queue()
+    static constexpr double HIGH_QUEUE_FILL_RATIO = 0.5;
+    static constexpr double LOW_QUEUE_FILL_RATIO = 0.1;
+
     virtual void _dispose_coloate_blocks_not_in_queue() {}
 
+    // Called when this context is done, to wake up the consumers waiting on dependencies.
+    virtual void _notify_dependencies() {}
+
+    // Wake up the consumer waiting in get_block_from_queue after blocks are appended.
+    void _wake_up_waiting_consumer();
+
+    // The bytes in the blocks queues divided by their limit.
+    virtual double _blocks_queue_fill_ratio() const {
+        return (double)_cur_bytes_in_queue / _max_bytes_in_queue;
+    }
+
+    // Scale _num_active_scanners every config::scanner_concurrency_adjust_interval_ms:
+    // shrink it if the queue fills up faster than the blocks are consumed, and release the
+    // free blocks kept for the scanners no longer active; grow it if the queue is nearly empty
+    // and the consumers keep up with the scanners.
+    void _adjust_scanner_concurrency();
+
     RuntimeState* _state;
     VScanNode* _parent;
 
@@ -165,16 +216,24 @@ protected:
 
     // _transfer_lock is used to protect the critical section
     // where the ScanNode and ScannerScheduler interact.
-    // Including access to variables such as blocks_queue, _process_status, _is_finished, etc.
+    // Including access to variables such as _process_status, _is_finished, etc.
+#if !defined(USE_BTHREAD_SCANNER)
+    ProfiledMutex<doris::Mutex> _transfer_lock {"ScannerContext::_transfer_lock"};
+#else
+    // bthread::ConditionVariable only waits with a bthread::Mutex
     doris::Mutex _transfer_lock;
+#endif
     // The blocks got from scanners will be added to the "blocks_queue".
     // And the upper scan node will be as a consumer to fetch blocks from this queue.
-    // Should be protected by "_transfer_lock"
-    std::list<vectorized::BlockUPtr> _blocks_queue;
+    // It is lock-free, created in init().
+    std::unique_ptr<MpmcQueue<vectorized::BlockUPtr>> _blocks_queue;
     // Wait in get_block_from_queue(), by ScanNode.
-    doris::ConditionVariable _blocks_queue_added_cv;
+    doris::ConditionVariableAny _blocks_queue_added_cv;
+    // The number of consumers waiting on _blocks_queue_added_cv, so the scanners only take
+    // _transfer_lock to notify when someone is waiting.
+    std::atomic_int32_t _num_waiting_consumers = 0;
     // Wait in clear_and_join(), by ScanNode.
-    doris::ConditionVariable _ctx_finish_cv;
+    doris::ConditionVariableAny _ctx_finish_cv;
 
     // The following 3 variables control the process of the scanner scheduling.
     // Use _transfer_lock to protect them.
@@ -195,12 +254,12 @@ protected:
     std::atomic_bool _is_finished = false;
 
     // Lazy-allocated blocks for all scanners to share, for memory reuse.
-    doris::Mutex _free_blocks_lock;
-    std::vector<vectorized::BlockUPtr> _free_blocks;
+    // The block returned when it is full is released, created in init().
+    std::unique_ptr<BoundedMpmcQueue<vectorized::BlockUPtr>> _free_blocks;
     // The current number of free blocks available to the scanners.
     // Used to limit the memory usage of the scanner.
     // NOTE: this is NOT the size of `_free_blocks`.
-    int32_t _free_blocks_capacity = 0;
+    std::atomic_int32_t _free_blocks_capacity = 0;
 
     int _batch_size;
     // The limit from SQL's limit clause
@@ -218,11 +277,20 @@ protected:
     int32_t _num_unfinished_scanners = 0;
     // Max number of scan thread for this scanner context.
     int32_t _max_thread_num = 0;
+    // The number of scanners allowed to run now, in [1, _max_thread_num].
+    std::atomic_int32_t _num_active_scanners = 0;
+    std::atomic_int64_t _last_adjust_concurrency_ms = 0;
+    // The statistics since the last adjustment of _num_active_scanners.
+    std::atomic_int64_t _produced_bytes = 0;
+    std::atomic_int64_t _consumed_bytes = 0;
+    std::atomic_int32_t _num_consumer_starved = 0;
+    // Set in init(), the ctx is never submitted to the scanner scheduler if it is true.
+    bool _scan_in_pipeline_task = false;
     // How many blocks a scanner can use in one task.
     int32_t _block_per_scanner = 0;
 
     // The current bytes of blocks in blocks queue
-    int64_t _cur_bytes_in_queue = 0;
+    std::atomic_int64_t _cur_bytes_in_queue = 0;
     // The max limit bytes of blocks in blocks queue
     int64_t _max_bytes_in_queue;
 
@@ -38,10 +38,12 @@
 #include "runtime/thread_context.h"
 #include "util/async_io.h" // IWYU pragma: keep
 #include "util/blocking_queue.hpp"
+#include "util/doris_metrics.h"
 #include "util/priority_thread_pool.hpp"
 #include "util/priority_work_stealing_thread_pool.hpp"
 #include "util/thread.h"
 #include "util/threadpool.h"
+#include "util/time.h"
 #include "vec/core/block.h"
 #include "vec/exec/scan/new_olap_scanner.h" // IWYU pragma: keep
 #include "vec/exec/scan/scanner_context.h"
@@ -50,6 +52,10 @@
 
 namespace doris::vectorized {
 
+DEFINE_GAUGE_METRIC_PROTOTYPE_2ARG(local_scan_queue_size, MetricUnit::NOUNIT);
+DEFINE_GAUGE_METRIC_PROTOTYPE_2ARG(local_scan_queue_finished_tasks, MetricUnit::NOUNIT);
+DEFINE_GAUGE_METRIC_PROTOTYPE_2ARG(local_scan_queue_stolen_tasks, MetricUnit::NOUNIT);
+
 ScannerScheduler::ScannerScheduler() {}
 
 ScannerScheduler::~ScannerScheduler() {
@@ -71,6 +77,11 @@ ScannerScheduler::~ScannerScheduler() {
     _scheduler_pool->wait();
     _local_scan_thread_pool->join();
 
+    for (auto& metrics : _local_scan_queue_metrics) {
+        metrics.entity->deregister_hook("local_scan_queue");
+        DorisMetrics::instance()->metric_registry()->deregister_entity(metrics.entity);
+    }
+
     for (int i = 0; i < QUEUE_NUM; i++) {
         delete _pending_queues[i];
     }
@@ -93,7 +104,28 @@ Status ScannerScheduler::init(ExecEnv* env) {
     // 2. local scan thread pool
     _local_scan_thread_pool.reset(new PriorityWorkStealingThreadPool(
             config::doris_scanner_thread_pool_thread_num, env->store_paths().size(),
-            config::doris_scanner_thread_pool_queue_size, "local_scan"));
+            config::doris_scanner_thread_pool_queue_size, "local_scan",
+            config::doris_scanner_thread_pool_reserved_thread_num_per_disk));
+    _local_scan_queue_metrics.resize(_local_scan_thread_pool->get_num_queues());
+    for (uint32_t i = 0; i < _local_scan_queue_metrics.size(); ++i) {
+        auto* metrics = &_local_scan_queue_metrics[i];
+        auto* pool = _local_scan_thread_pool.get();
+        metrics->entity = DorisMetrics::instance()->metric_registry()->register_entity(
+                "local_scan_queue." + std::to_string(i), {{"queue", std::to_string(i)}});
+        metrics->local_scan_queue_size = (UIntGauge*)metrics->entity->register_metric<UIntGauge>(
+                &METRIC_local_scan_queue_size);
+        metrics->local_scan_queue_finished_tasks =
+                (UIntGauge*)metrics->entity->register_metric<UIntGauge>(
+                        &METRIC_local_scan_queue_finished_tasks);
+        metrics->local_scan_queue_stolen_tasks =
+                (UIntGauge*)metrics->entity->register_metric<UIntGauge>(
+                        &METRIC_local_scan_queue_stolen_tasks);
+        metrics->entity->register_hook("local_scan_queue", [metrics, pool, i]() {
+            metrics->local_scan_queue_size->set_value(pool->get_queue_size(i));
+            metrics->local_scan_queue_finished_tasks->set_value(pool->get_finished_tasks(i));
+            metrics->local_scan_queue_stolen_tasks->set_value(pool->get_stolen_tasks(i));
+        });
+    }
 
     // 3. remote scan thread pool
     ThreadPoolBuilder("RemoteScanThreadPool")
@@ -152,6 +184,14 @@ void ScannerScheduler::_schedule_thread(int queue_id) {
     return nullptr;
 }
 
+// The scanners run on bthreads with USE_BTHREAD_SCANNER. Their reads by FileReader::read_at
+// are handed to the AsyncIO pools, so a scanner waiting for a local or remote read, e.g. of
+// the files on S3 or HDFS, does not hold a thread.
+[[maybe_unused]] static bool is_bthread_scanner(VScanner* scanner) {
+    return dynamic_cast<NewOlapScanner*>(scanner) != nullptr ||
+           dynamic_cast<VFileScanner*>(scanner) != nullptr;
+}
+
 void ScannerScheduler::_schedule_scanners(ScannerContext* ctx) {
     ctx->incr_num_ctx_scheduling(1);
     if (ctx->done()) {
@@ -222,9 +262,8 @@ void ScannerScheduler::_schedule_scanners(ScannerContext* ctx) {
 #if !defined(USE_BTHREAD_SCANNER)
     submit_to_thread_pool();
 #else
-    // Only OlapScanner uses bthread scanner
     // Todo: Make other scanners support bthread scanner
-    if (dynamic_cast<NewOlapScanner*>(*iter) == nullptr) {
+    if (!is_bthread_scanner(iter->get())) {
         return submit_to_thread_pool();
     }
     ctx->incr_num_scanner_scheduling(this_run.size());
@@ -265,12 +304,32 @@ void ScannerScheduler::_scanner_scan(ScannerScheduler* scheduler, ScannerContext
 #if !defined(USE_BTHREAD_SCANNER)
     Thread::set_self_name("_scanner_scan");
 #else
-    if (dynamic_cast<NewOlapScanner*>(scanner) == nullptr) {
+    if (!is_bthread_scanner(scanner.get())) {
         Thread::set_self_name("_scanner_scan");
     }
 #endif
     scanner->update_wait_worker_timer();
+    _do_scanner_scan(ctx, scanner, 0);
+}
+
+void ScannerScheduler::scan_in_pipeline_task(ScannerContext* ctx) {
+    // Count the ctx as scheduling while taking the scanner, so that it is not closed as no
+    // scanner is running.
+    ctx->update_num_running(0, 1);
+    std::list<VScannerSPtr> this_run;
+    ctx->get_next_batch_of_scanners(&this_run, 1);
+    ctx->update_num_running(this_run.size(), -1);
+    if (this_run.empty()) {
+        return;
+    }
+    ctx->incr_num_scanner_scheduling(1);
+    _do_scanner_scan(ctx, this_run.front(), config::pipeline_task_scan_time_slice_ms * 1000000L);
+}
+
+void ScannerScheduler::_do_scanner_scan(ScannerContext* ctx, VScannerSPtr scanner,
+                                        int64_t time_slice_ns) {
     scanner->start_scan_cpu_timer();
+    int64_t start_ns = time_slice_ns > 0 ? MonotonicNanos() : 0;
     Status status = Status::OK();
     bool eos = false;
     RuntimeState* state = ctx->state();
@@ -316,7 +375,7 @@ void ScannerScheduler::_scanner_scan(ScannerScheduler* scheduler, ScannerContext
     // queue, it will affect query latency and query concurrency for example ssb 3.3.
     while (!eos && raw_bytes_read < raw_bytes_threshold &&
            ((raw_rows_read < raw_rows_threshold && has_free_block) ||
-            num_rows_in_block < state->batch_size())) {
+            num_rows_in_block < scanner->adaptive_batch_size())) {
         if (UNLIKELY(ctx->done())) {
             // No need to set status on error here.
             // Because done() maybe caused by "should_stop"
@@ -350,7 +409,8 @@ void ScannerScheduler::_scanner_scan(ScannerScheduler* scheduler, ScannerContext
         if (UNLIKELY(block->rows() == 0)) {
             ctx->return_free_block(std::move(block));
         } else {
-            if (!blocks.empty() && blocks.back()->rows() + block->rows() <= state->batch_size()) {
+            if (!blocks.empty() &&
+                blocks.back()->rows() + block->rows() <= scanner->adaptive_batch_size()) {
                 status = vectorized::MutableBlock(blocks.back().get()).merge(*block);
                 if (!status.ok()) {
                     break;
@@ -361,6 +421,10 @@ void ScannerScheduler::_scanner_scan(ScannerScheduler* scheduler, ScannerContext
             }
         }
         raw_rows_read = scanner->get_rows_read();
+        // yield the pipeline executor between the batches, even if no full block is read
+        if (time_slice_ns > 0 && MonotonicNanos() - start_ns > time_slice_ns) {
+            break;
+        }
     } // end for while
 
     // if we failed, check status.
@@ -19,14 +19,16 @@
 
 #include <atomic>
 #include <memory>
+#include <vector>
 
 #include "common/status.h"
+#include "util/metrics.h"
 #include "util/threadpool.h"
 #include "vec/exec/scan/vscanner.h"
 
 namespace doris {
 class ExecEnv;
-class PriorityThreadPool;
+class PriorityWorkStealingThreadPool;
 
 namespace vectorized {
 class VScanner;
@@ -56,6 +58,10 @@ class ScannerContext;
 //     Each Scanner will act as a producer, read a group of blocks and put them into
 //     the corresponding block queue.
 //     The corresponding ScanNode will act as a consumer to consume blocks from the block queue.
+//
+// If config::enable_scan_in_pipeline_task is set, the ScannerContext of a pipeline query is
+// not submitted, the scan operators run the Scanners in the pipeline executors by
+// scan_in_pipeline_task() instead when their block queues are empty.
 class ScannerScheduler {
 public:
     ScannerScheduler();
@@ -68,6 +74,10 @@ public:
     std::unique_ptr<ThreadPoolToken> new_limited_scan_pool_token(ThreadPool::ExecutionMode mode,
                                                                  int max_concurrency);
 
+    // Run a scanner of `ctx` in the calling pipeline task for a time slice, if there is one
+    // not running, see ScannerContext::scan_in_pipeline_task().
+    void scan_in_pipeline_task(ScannerContext* ctx);
+
 private:
     // scheduling thread function
     void _schedule_thread(int queue_id);
@@ -75,6 +85,9 @@ private:
     void _schedule_scanners(ScannerContext* ctx);
     // execution thread function
     void _scanner_scan(ScannerScheduler* scheduler, ScannerContext* ctx, VScannerSPtr scanner);
+    // Read blocks from the scanner until a threshold is reached, `time_slice_ns` is 0 if
+    // there is no time limit.
+    void _do_scanner_scan(ScannerContext* ctx, VScannerSPtr scanner, int64_t time_slice_ns);
 
 private:
     // Scheduling queue number.
@@ -94,10 +107,19 @@ private:
     // _local_scan_thread_pool is for local scan task(typically, olap scanner)
     // _remote_scan_thread_pool is for remote scan task(cold data on s3, hdfs, etc.)
     // _limited_scan_thread_pool is a special pool for queries with resource limit
-    std::unique_ptr<PriorityThreadPool> _local_scan_thread_pool;
+    std::unique_ptr<PriorityWorkStealingThreadPool> _local_scan_thread_pool;
     std::unique_ptr<ThreadPool> _remote_scan_thread_pool;
     std::unique_ptr<ThreadPool> _limited_scan_thread_pool;
 
+    // The metrics of the queues of _local_scan_thread_pool, one queue for each disk.
+    struct LocalScanQueueMetrics {
+        std::shared_ptr<MetricEntity> entity;
+        UIntGauge* local_scan_queue_size = nullptr;
+        UIntGauge* local_scan_queue_finished_tasks = nullptr;
+        UIntGauge* local_scan_queue_stolen_tasks = nullptr;
+    };
+    std::vector<LocalScanQueueMetrics> _local_scan_queue_metrics;
+
     // true is the scheduler is closed.
     std::atomic_bool _is_closed = {false};
     bool _is_init = false;
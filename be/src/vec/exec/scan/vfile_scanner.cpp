@@ -39,7 +39,11 @@
 #include "common/logging.h"
 #include "common/object_pool.h"
 #include "io/cache/block/block_file_cache_profile.h"
+#include "io/fs/io_scheduler.h"
+#include "io/io_statistics_reporter.h"
 #include "runtime/descriptors.h"
+#include "runtime/query_context.h"
+#include "runtime/runtime_predicate.h"
 #include "runtime/runtime_state.h"
 #include "runtime/types.h"
 #include "vec/aggregate_functions/aggregate_function.h"
@@ -61,6 +65,7 @@
 #include "vec/exec/format/parquet/vparquet_reader.h"
 #include "vec/exec/format/table/iceberg_reader.h"
 #include "vec/exec/format/table/transactional_hive_reader.h"
+#include "vec/exec/scan/file_scan_range_queue.h"
 #include "vec/exec/scan/hudi_jni_reader.h"
 #include "vec/exec/scan/max_compute_jni_reader.h"
 #include "vec/exec/scan/new_file_scan_node.h"
@@ -86,11 +91,12 @@ using namespace ErrorCode;
 
 VFileScanner::VFileScanner(RuntimeState* state, NewFileScanNode* parent, int64_t limit,
                            const TFileScanRange& scan_range, RuntimeProfile* profile,
-                           ShardedKVCache* kv_cache)
+                           ShardedKVCache* kv_cache, FileScanRangeQueue* range_queue)
         : VScanner(state, static_cast<VScanNode*>(parent), limit, profile),
           _params(scan_range.params),
           _ranges(scan_range.ranges),
           _next_range(0),
+          _range_queue(range_queue),
           _cur_reader(nullptr),
           _cur_reader_eof(false),
           _kv_cache(kv_cache),
@@ -98,6 +104,10 @@ VFileScanner::VFileScanner(RuntimeState* state, NewFileScanNode* parent, int64_t
     if (scan_range.params.__isset.strict_mode) {
         _strict_mode = scan_range.params.strict_mode;
     }
+    if (_range_queue != nullptr) {
+        _scanner_idx = _range_queue->add_scanner(_ranges);
+    }
+    _use_topn_opt = parent->use_topn_opt();
 }
 
 Status VFileScanner::prepare(
@@ -125,7 +135,12 @@ Status VFileScanner::prepare(
     _file_cache_statistics.reset(new io::FileCacheStatistics());
     _io_ctx.reset(new io::IOContext());
     _io_ctx->file_cache_stats = _file_cache_statistics.get();
+    _io_stats.reset(new io::IOStatistics());
+    _io_ctx->io_stats = _io_stats.get();
+    _hdfs_read_statistics.reset(new io::HdfsReadStatistics());
+    _io_ctx->hdfs_read_stats = _hdfs_read_statistics.get();
     _io_ctx->query_id = &_state->query_id();
+    io::IOScheduler::set_workload_group(_state, _io_ctx.get());
 
     if (_is_load) {
         _src_row_desc.reset(new RowDescriptor(_state->desc_tbl(),
@@ -366,7 +381,7 @@ Status VFileScanner::_cast_to_input_block(Block* block) {
 }
 
 Status VFileScanner::_fill_columns_from_path(size_t rows) {
-    const TFileRangeDesc& range = _ranges.at(_next_range - 1);
+    const TFileRangeDesc& range = *_current_range;
     if (range.__isset.columns_from_path && !_partition_slot_descs.empty()) {
         SCOPED_TIMER(_fill_path_columns_timer);
         for (const auto& slot_desc : _partition_slot_descs) {
@@ -572,18 +587,38 @@ Status VFileScanner::_get_next_reader() {
     while (true) {
         _cur_reader.reset(nullptr);
         _src_block_init = false;
-        if (_next_range >= _ranges.size()) {
+        if (_range_queue != nullptr) {
+            _current_range = _range_queue->next(_scanner_idx);
+        } else {
+            _current_range = _next_range < _ranges.size() ? &_ranges[_next_range] : nullptr;
+        }
+        if (_current_range == nullptr) {
             _scanner_eof = true;
-            _state->update_num_finished_scan_range(1);
+            // all ranges of the scanner may be stolen before it starts
+            if (_next_range != 0) {
+                _state->update_num_finished_scan_range(1);
+            }
             return Status::OK();
         }
         if (_next_range != 0) {
             _state->update_num_finished_scan_range(1);
         }
 
-        const TFileRangeDesc& range = _ranges[_next_range++];
+        const TFileRangeDesc& range = *_current_range;
+        _next_range++;
         _current_range_path = range.path;
 
+        // The boundary of the topn only gets tighter, so the ranges are narrowed again for
+        // every file, and the later files get more row groups or stripes pruned.
+        auto* colname_to_value_range = _colname_to_value_range;
+        if (_use_topn_opt) {
+            _topn_colname_to_value_range = *_colname_to_value_range;
+            if (_state->get_query_ctx()->get_runtime_predicate().narrow_value_range(
+                        &_topn_colname_to_value_range)) {
+                colname_to_value_range = &_topn_colname_to_value_range;
+            }
+        }
+
         // create reader for specific format
         // TODO: add json, avro
         Status init_status;
@@ -639,7 +674,7 @@ Status VFileScanner::_get_next_reader() {
                                                           _state, _params, range, _kv_cache,
                                                           _io_ctx.get());
                 init_status = iceberg_reader->init_reader(
-                        _file_col_names, _col_id_name_map, _colname_to_value_range,
+                        _file_col_names, _col_id_name_map, colname_to_value_range,
                         _push_down_conjuncts, _real_tuple_desc, _default_val_row_desc.get(),
                         _col_name_to_slot_id, &_not_single_slot_filter_conjuncts,
                         &_slot_id_to_filter_conjuncts);
@@ -648,7 +683,7 @@ Status VFileScanner::_get_next_reader() {
             } else {
                 std::vector<std::string> place_holder;
                 init_status = parquet_reader->init_reader(
-                        _file_col_names, place_holder, _colname_to_value_range,
+                        _file_col_names, place_holder, colname_to_value_range,
                         _push_down_conjuncts, _real_tuple_desc, _default_val_row_desc.get(),
                         _col_name_to_slot_id, &_not_single_slot_filter_conjuncts,
                         &_slot_id_to_filter_conjuncts);
@@ -673,13 +708,14 @@ Status VFileScanner::_get_next_reader() {
                         TransactionalHiveReader::create_unique(std::move(orc_reader), _profile,
                                                                _state, _params, range,
                                                                _io_ctx.get());
-                init_status = tran_orc_reader->init_reader(_file_col_names, _colname_to_value_range,
+                init_status = tran_orc_reader->init_reader(_file_col_names, colname_to_value_range,
                                                            _push_down_conjuncts);
                 RETURN_IF_ERROR(tran_orc_reader->init_row_filters(range));
                 _cur_reader = std::move(tran_orc_reader);
             } else {
-                init_status = orc_reader->init_reader(&_file_col_names, _colname_to_value_range,
-                                                      _push_down_conjuncts, false);
+                init_status = orc_reader->init_reader(&_file_col_names, colname_to_value_range,
+                                                      _push_down_conjuncts, false,
+                                                      _real_tuple_desc);
                 _cur_reader = std::move(orc_reader);
             }
             break;
@@ -745,7 +781,7 @@ Status VFileScanner::_generate_fill_columns() {
             partition_columns;
     std::unordered_map<std::string, VExprContextSPtr> missing_columns;
 
-    const TFileRangeDesc& range = _ranges.at(_next_range - 1);
+    const TFileRangeDesc& range = *_current_range;
     if (range.__isset.columns_from_path && !_partition_slot_descs.empty()) {
         for (const auto& slot_desc : _partition_slot_descs) {
             if (slot_desc) {
@@ -914,9 +950,31 @@ Status VFileScanner::close(RuntimeState* state) {
         io::FileCacheProfileReporter cache_profile(_profile);
         cache_profile.update(_file_cache_statistics.get());
     }
+    io::report_io_statistics(_state, _profile, *_io_stats);
+    if (_hdfs_read_statistics->num_read_calls > 0) {
+        _report_hdfs_read_statistics();
+    }
 
     RETURN_IF_ERROR(VScanner::close(state));
     return Status::OK();
 }
 
+void VFileScanner::_report_hdfs_read_statistics() {
+    static const char* hdfs_profile = "HdfsIO";
+    ADD_TIMER(_profile, hdfs_profile);
+    auto* stats = _hdfs_read_statistics.get();
+    COUNTER_UPDATE(ADD_CHILD_COUNTER(_profile, "NumReadCalls", TUnit::UNIT, hdfs_profile),
+                   stats->num_read_calls);
+    COUNTER_UPDATE(ADD_CHILD_TIMER(_profile, "ReadTime", hdfs_profile), stats->read_timer);
+    COUNTER_UPDATE(ADD_CHILD_COUNTER(_profile, "BytesRead", TUnit::BYTES, hdfs_profile),
+                   stats->bytes_read);
+    COUNTER_UPDATE(ADD_CHILD_COUNTER(_profile, "LocalBytesRead", TUnit::BYTES, hdfs_profile),
+                   stats->local_bytes_read);
+    COUNTER_UPDATE(
+            ADD_CHILD_COUNTER(_profile, "ShortCircuitBytesRead", TUnit::BYTES, hdfs_profile),
+            stats->short_circuit_bytes_read);
+    COUNTER_UPDATE(ADD_CHILD_COUNTER(_profile, "ZeroCopyBytesRead", TUnit::BYTES, hdfs_profile),
+                   stats->zero_copy_bytes_read);
+}
+
 } // namespace doris::vectorized
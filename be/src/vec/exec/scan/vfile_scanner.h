@@ -46,6 +46,7 @@ class TFileScanRange;
 class TFileScanRangeParams;
 
 namespace vectorized {
+class FileScanRangeQueue;
 class ShardedKVCache;
 class VExpr;
 class VExprContext;
@@ -65,7 +66,7 @@ public:
 
     VFileScanner(RuntimeState* state, NewFileScanNode* parent, int64_t limit,
                  const TFileScanRange& scan_range, RuntimeProfile* profile,
-                 ShardedKVCache* kv_cache);
+                 ShardedKVCache* kv_cache, FileScanRangeQueue* range_queue = nullptr);
 
     Status open(RuntimeState* state) override;
 
@@ -92,10 +93,17 @@ protected:
     const TFileScanRangeParams& _params;
     const std::vector<TFileRangeDesc>& _ranges;
     int _next_range;
+    // the range being read, which may be stolen from the other scanners by the range queue
+    const TFileRangeDesc* _current_range = nullptr;
+    FileScanRangeQueue* _range_queue = nullptr;
+    size_t _scanner_idx = 0;
 
     std::unique_ptr<GenericReader> _cur_reader;
     bool _cur_reader_eof;
     std::unordered_map<std::string, ColumnValueRangeType>* _colname_to_value_range;
+    // the value ranges narrowed by the topn boundary for the current reader
+    bool _use_topn_opt = false;
+    std::unordered_map<std::string, ColumnValueRangeType> _topn_colname_to_value_range;
     // File source slot descriptors
     std::vector<SlotDescriptor*> _file_slot_descs;
     // col names from _file_slot_descs
@@ -154,6 +162,8 @@ protected:
     std::unique_ptr<vectorized::schema_util::FullBaseSchemaView> _full_base_schema_view;
 
     std::unique_ptr<io::FileCacheStatistics> _file_cache_statistics;
+    std::unique_ptr<io::IOStatistics> _io_stats;
+    std::unique_ptr<io::HdfsReadStatistics> _hdfs_read_statistics;
     std::unique_ptr<io::IOContext> _io_ctx;
 
 private:
@@ -189,6 +199,7 @@ private:
     Status _split_conjuncts_expr(const VExprContextSPtr& context,
                                  const VExprSPtr& conjunct_expr_root);
     void _get_slot_ids(VExpr* expr, std::vector<int>* slot_ids);
+    void _report_hdfs_read_statistics();
 
     void _reset_counter() {
         _counter.num_rows_unselected = 0;
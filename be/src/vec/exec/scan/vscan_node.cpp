@@ -37,6 +37,7 @@
 #include "exprs/bloom_filter_func.h"
 #include "exprs/hybrid_set.h"
 #include "exprs/runtime_filter.h"
+#include "geo/geo_types.h"
 #include "runtime/descriptors.h"
 #include "runtime/exec_env.h"
 #include "runtime/primitive_type.h"
@@ -181,8 +182,11 @@ Status VScanNode::alloc_resource(RuntimeState* state) {
                 DCHECK(!_eos && _num_scanners->value() > 0);
                 _scanner_ctx->set_max_queue_size(
                         _shared_scan_opt ? std::max(state->query_parallel_instance_num(), 1) : 1);
-                RETURN_IF_ERROR(
-                        _state->exec_env()->scanner_scheduler()->submit(_scanner_ctx.get()));
+                // otherwise the scanners are run by the scan operators
+                if (!_scanner_ctx->scan_in_pipeline_task()) {
+                    RETURN_IF_ERROR(
+                            _state->exec_env()->scanner_scheduler()->submit(_scanner_ctx.get()));
+                }
             }
             if (_shared_scan_opt) {
                 _shared_scanner_controller->set_scanner_context(id(),
@@ -288,6 +292,8 @@ Status VScanNode::_init_profile() {
     _prefilter_timer = ADD_TIMER(_scanner_profile, "ScannerPrefilterTime");
     _convert_block_timer = ADD_TIMER(_scanner_profile, "ScannerConvertBlockTime");
     _filter_timer = ADD_TIMER(_scanner_profile, "ScannerFilterTime");
+    _adaptive_batch_size_counter =
+            ADD_COUNTER(_scanner_profile, "AdaptiveBatchSize", TUnit::UNIT);
 
     // time of scan thread to wait for worker thread of the thread pool
     _scanner_wait_worker_timer = ADD_TIMER(_runtime_profile, "ScannerWorkerWaitTime");
@@ -592,6 +598,11 @@ Status VScanNode::_normalize_predicate(const VExprSPtr& conjunct_expr_root, VExp
                         *range);
             }
 
+            if (pdt == PushDownType::UNACCEPTABLE &&
+                _should_push_down_geo_predicate() == PushDownType::ACCEPTABLE) {
+                RETURN_IF_ERROR(_normalize_geo_predicate(cur_expr, context));
+            }
+
             if (pdt == PushDownType::UNACCEPTABLE &&
                 TExprNodeType::COMPOUND_PRED == cur_expr->node_type()) {
                 _normalize_compound_predicate(cur_expr, context, &pdt, _is_runtime_filter_predicate,
@@ -1045,6 +1056,124 @@ Status VScanNode::_normalize_noneq_binary_predicate(VExpr* expr, VExprContext* e
     return Status::OK();
 }
 
+SlotDescriptor* VScanNode::_get_double_slot(VExpr* expr) {
+    if (expr->node_type() != TExprNodeType::SLOT_REF) {
+        return nullptr;
+    }
+    auto slot_id = static_cast<VSlotRef*>(expr)->slot_id();
+    for (auto* slot : _output_tuple_desc->slots()) {
+        if (slot->id() == slot_id) {
+            return slot->type().type == TYPE_DOUBLE ? slot : nullptr;
+        }
+    }
+    return nullptr;
+}
+
+Status VScanNode::_normalize_geo_predicate(VExpr* expr, VExprContext* expr_ctx) {
+    // the data of a non-null constant child, or nullptr
+    auto get_const_value = [expr_ctx](const VExprSPtr& child, StringRef* value) -> Status {
+        *value = StringRef();
+        if (!child->is_constant()) {
+            return Status::OK();
+        }
+        std::shared_ptr<ColumnPtrWrapper> const_col_wrapper;
+        RETURN_IF_ERROR(child->get_const_col(expr_ctx, &const_col_wrapper));
+        if (const ColumnConst* const_column =
+                    check_and_get_column<ColumnConst>(const_col_wrapper->column_ptr)) {
+            *value = const_column->get_data_at(0);
+        }
+        return Status::OK();
+    };
+    auto get_const_double = [&](const VExprSPtr& child, double* value, bool* found) -> Status {
+        StringRef data;
+        RETURN_IF_ERROR(get_const_value(child, &data));
+        *found = child->type().type == TYPE_DOUBLE && data.data != nullptr &&
+                 data.size == sizeof(double);
+        if (*found) {
+            memcpy(value, data.data, sizeof(double));
+        }
+        return Status::OK();
+    };
+    auto is_fn_call = [](const VExpr* child, const char* name) {
+        return child->node_type() == TExprNodeType::FUNCTION_CALL &&
+               child->fn().name.function_name == name;
+    };
+
+    GeoBound bound;
+    VExpr* lng_expr = nullptr;
+    VExpr* lat_expr = nullptr;
+    if (TExprNodeType::BINARY_PRED == expr->node_type()) {
+        // st_distance_sphere(...) < d or d > st_distance_sphere(...)
+        const std::string& fn_name = expr->fn().name.function_name;
+        int fn_child = -1;
+        if (fn_name == "lt" || fn_name == "le") {
+            fn_child = 0;
+        } else if (fn_name == "gt" || fn_name == "ge") {
+            fn_child = 1;
+        }
+        if (fn_child < 0 || !is_fn_call(expr->children()[fn_child].get(), "st_distance_sphere")) {
+            return Status::OK();
+        }
+        double distance = 0;
+        bool found = false;
+        RETURN_IF_ERROR(get_const_double(expr->children()[1 - fn_child], &distance, &found));
+        if (!found) {
+            return Status::OK();
+        }
+        // the distance is symmetric, the columns may be either of the two points
+        const auto& args = expr->children()[fn_child]->children();
+        for (int slot_arg : {0, 2}) {
+            double lng = 0;
+            double lat = 0;
+            bool lng_found = false;
+            bool lat_found = false;
+            RETURN_IF_ERROR(get_const_double(args[2 - slot_arg], &lng, &lng_found));
+            RETURN_IF_ERROR(get_const_double(args[3 - slot_arg], &lat, &lat_found));
+            if (lng_found && lat_found) {
+                if (!GeoPoint::ComputeDistanceBound(lng, lat, distance, &bound)) {
+                    return Status::OK();
+                }
+                lng_expr = args[slot_arg].get();
+                lat_expr = args[slot_arg + 1].get();
+                break;
+            }
+        }
+    } else if (is_fn_call(expr, "st_contains") &&
+               is_fn_call(expr->children()[1].get(), "st_point")) {
+        StringRef encoded;
+        RETURN_IF_ERROR(get_const_value(expr->children()[0], &encoded));
+        if (encoded.data == nullptr) {
+            return Status::OK();
+        }
+        std::unique_ptr<GeoShape> shape(GeoShape::from_encoded(encoded.data, encoded.size));
+        if (shape == nullptr || !shape->get_bound(&bound)) {
+            return Status::OK();
+        }
+        lng_expr = expr->children()[1]->children()[0].get();
+        lat_expr = expr->children()[1]->children()[1].get();
+    }
+    if (lng_expr == nullptr) {
+        return Status::OK();
+    }
+
+    auto add_bound = [this](SlotDescriptor* slot, double min, double max) {
+        auto [it, inserted] = _geo_bounds.emplace(slot->col_name(), std::pair {min, max});
+        if (!inserted) {
+            it->second.first = std::max(it->second.first, min);
+            it->second.second = std::min(it->second.second, max);
+        }
+    };
+    if (auto* slot = _get_double_slot(lat_expr); slot != nullptr) {
+        add_bound(slot, bound.min_lat, bound.max_lat);
+    }
+    // the points of any longitude may be within the bound
+    if (auto* slot = _get_double_slot(lng_expr);
+        slot != nullptr && (bound.min_lng > -180 || bound.max_lng < 180)) {
+        add_bound(slot, bound.min_lng, bound.max_lng);
+    }
+    return Status::OK();
+}
+
 Status VScanNode::_normalize_compound_predicate(
         vectorized::VExpr* expr, VExprContext* expr_ctx, PushDownType* pdt,
         bool _is_runtime_filter_predicate,
@@ -1311,6 +1440,7 @@ Status VScanNode::try_append_late_arrival_runtime_filter(int* arrived_rf_num) {
     // 2. Append unapplied runtime filters to vconjunct_ctx_ptr
     if (!exprs.empty()) {
         RETURN_IF_ERROR(_append_rf_into_conjuncts(exprs));
+        _late_arrival_rf_exprs.insert(_late_arrival_rf_exprs.end(), exprs.begin(), exprs.end());
     }
     if (current_arrived_rf_num == _runtime_filter_descs.size()) {
         _is_all_rf_applied = true;
@@ -1320,6 +1450,14 @@ Status VScanNode::try_append_late_arrival_runtime_filter(int* arrived_rf_num) {
     return Status::OK();
 }
 
+void VScanNode::get_late_arrival_rf_exprs(size_t start, VExprSPtrs* exprs) {
+    std::unique_lock l(_rf_locks);
+    if (start < _late_arrival_rf_exprs.size()) {
+        exprs->insert(exprs->end(), _late_arrival_rf_exprs.begin() + start,
+                      _late_arrival_rf_exprs.end());
+    }
+}
+
 Status VScanNode::clone_conjunct_ctxs(VExprContextSPtrs& conjuncts) {
     if (!_conjuncts.empty()) {
         std::unique_lock l(_rf_locks);
@@ -147,6 +147,9 @@ public:
     // Clone current _conjuncts to conjuncts, if exists.
     Status clone_conjunct_ctxs(VExprContextSPtrs& conjuncts);
 
+    // Get the exprs of late arrived runtime filters, starting from the `start`th one.
+    void get_late_arrival_rf_exprs(size_t start, VExprSPtrs* exprs);
+
     int runtime_filter_num() const { return (int)_runtime_filter_ctxs.size(); }
 
     TupleId input_tuple_id() const { return _input_tuple_id; }
@@ -236,6 +239,8 @@ protected:
         return PushDownType::UNACCEPTABLE;
     }
 
+    virtual PushDownType _should_push_down_geo_predicate() { return PushDownType::UNACCEPTABLE; }
+
     // Return true if it is a key column.
     // Only predicate on key column can be pushed down.
     virtual bool _is_key_column(const std::string& col_name) { return false; }
@@ -271,6 +276,8 @@ protected:
     std::vector<bool> _runtime_filter_ready_flag;
     doris::Mutex _rf_locks;
     phmap::flat_hash_set<VExprSPtr> _rf_vexpr_set;
+    // exprs of the runtime filters arrived after the scanners are created, in arrival order
+    VExprSPtrs _late_arrival_rf_exprs;
     // True means all runtime filters are applied to scanners
     bool _is_all_rf_applied = true;
 
@@ -314,6 +321,10 @@ protected:
     // "_colname_to_value_range" and in "_not_in_value_ranges"
     std::vector<ColumnValueRangeType> _not_in_value_ranges;
 
+    // The bounds of the double columns derived from the geo predicates, the double type is
+    // not supported by ColumnValueRange. column name -> [min, max]
+    std::map<std::string, std::pair<double, double>> _geo_bounds;
+
     bool _need_agg_finalize = true;
     bool _blocked_by_rf = false;
     // If the query like select * from table limit 10; then the query should run in
@@ -353,6 +364,8 @@ protected:
     RuntimeProfile::Counter* _convert_block_timer = nullptr;
     // time of filter output block from scanner
     RuntimeProfile::Counter* _filter_timer = nullptr;
+    // the max rows of a block chosen by the scanners according to preferred_block_size_bytes
+    RuntimeProfile::Counter* _adaptive_batch_size_counter = nullptr;
 
     RuntimeProfile::Counter* _scanner_sched_counter = nullptr;
     RuntimeProfile::Counter* _scanner_ctx_sched_counter = nullptr;
@@ -440,6 +453,14 @@ private:
                                       SlotDescriptor* slot, ColumnValueRange<T>& range,
                                       PushDownType* pdt);
 
+    // Derive the bounds of the longitude and latitude columns from
+    // st_distance_sphere(lng, lat, x, y) < d or st_contains(shape, st_point(lng, lat)),
+    // so the zone maps prune the pages out of the bounds. The predicate itself is always kept.
+    Status _normalize_geo_predicate(vectorized::VExpr* expr, VExprContext* expr_ctx);
+
+    // Get the double column referred by the expr, nullptr if it is not a slot ref of double.
+    SlotDescriptor* _get_double_slot(vectorized::VExpr* expr);
+
     template <bool IsFixed, PrimitiveType PrimitiveType, typename ChangeFixedValueRangeFunc>
     static Status _change_value_range(ColumnValueRange<PrimitiveType>& range, void* value,
                                       const ChangeFixedValueRangeFunc& func,
@@ -34,7 +34,8 @@ VScanner::VScanner(RuntimeState* state, VScanNode* parent, int64_t limit, Runtim
           _limit(limit),
           _profile(profile),
           _input_tuple_desc(parent->input_tuple_desc()),
-          _output_tuple_desc(parent->output_tuple_desc()) {
+          _output_tuple_desc(parent->output_tuple_desc()),
+          _adaptive_batch_size(state->batch_size()) {
     _real_tuple_desc = _input_tuple_desc != nullptr ? _input_tuple_desc : _output_tuple_desc;
     _total_rf_num = _parent->runtime_filter_num();
     _is_load = (_input_tuple_desc != nullptr);
@@ -82,6 +83,9 @@ Status VScanner::get_block(RuntimeState* state, Block* block, bool* eof) {
                     break;
                 }
                 _num_rows_read += block->rows();
+                if (UNLIKELY(!_adaptive_batch_size_updated) && block->rows() > 0) {
+                    _update_adaptive_batch_size(*block);
+                }
             }
 
             // 2. Filter the output block finally.
@@ -108,7 +112,21 @@ Status VScanner::get_block(RuntimeState* state, Block* block, bool* eof) {
     return Status::OK();
 }
 
+void VScanner::_update_adaptive_batch_size(const Block& block) {
+    _adaptive_batch_size_updated = true;
+    if (_state->preferred_block_size_bytes() <= 0) {
+        return;
+    }
+    _adaptive_batch_size = _state->adaptive_batch_size(block.bytes() / block.rows());
+    COUNTER_SET(_parent->_adaptive_batch_size_counter, static_cast<int64_t>(_adaptive_batch_size));
+}
+
 Status VScanner::_filter_output_block(Block* block) {
+    if (config::enable_adaptive_conjunct_order && _conjuncts.size() > 1 &&
+        config::conjunct_reorder_block_interval > 0 &&
+        ++_num_filtered_blocks % config::conjunct_reorder_block_interval == 0) {
+        VExprContext::reorder_conjuncts(&_conjuncts);
+    }
     auto old_rows = block->rows();
     Status st = VExprContext::filter_block(_conjuncts, block, block->columns());
     _counter.num_rows_unselected += old_rows - block->rows();
@@ -138,7 +156,7 @@ Status VScanner::try_append_late_arrival_runtime_filter() {
     // But it is ok because it will be updated at next time.
     RETURN_IF_ERROR(_parent->clone_conjunct_ctxs(_conjuncts));
     _applied_rf_num = arrived_rf_num;
-    return Status::OK();
+    return _on_late_arrival_runtime_filter();
 }
 
 Status VScanner::close(RuntimeState* state) {
@@ -80,6 +80,10 @@ protected:
     // Filter the output block finally.
     Status _filter_output_block(Block* block);
 
+    // Called after the conjuncts are renewed by the late arrived runtime filters,
+    // subclass could push them down to its data source.
+    virtual Status _on_late_arrival_runtime_filter() { return Status::OK(); }
+
     // Not virtual, all child will call this method explictly
     Status prepare(RuntimeState* state, const VExprContextSPtrs& conjuncts);
 
@@ -112,6 +116,9 @@ public:
 
     RuntimeState* runtime_state() { return _state; }
 
+    // The max rows of the blocks returned by this scanner, adapted to the width of its rows.
+    int adaptive_batch_size() const { return _adaptive_batch_size; }
+
     bool is_open() { return _is_open; }
     void set_opened() { _is_open = true; }
 
@@ -141,6 +148,8 @@ public:
     }
 
 protected:
+    void _update_adaptive_batch_size(const Block& block);
+
     void _discard_conjuncts() {
         for (auto& conjunct : _conjuncts) {
             _stale_expr_ctxs.emplace_back(conjunct);
@@ -183,12 +192,19 @@ protected:
     // and will be destroyed at the end.
     VExprContextSPtrs _stale_expr_ctxs;
 
+    // num of blocks filtered by _conjuncts, to reorder them periodically
+    int64_t _num_filtered_blocks = 0;
+
     // num of rows read from scanner
     int64_t _num_rows_read = 0;
 
     // num of rows return from scanner, after filter block
     int64_t _num_rows_return = 0;
 
+    int _adaptive_batch_size;
+    // the row width is estimated by the first non-empty block
+    bool _adaptive_batch_size_updated = false;
+
     // Set true after counter is updated finally
     bool _has_updated_counter = false;
 
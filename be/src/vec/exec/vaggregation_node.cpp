@@ -26,7 +26,9 @@
 #include <atomic>
 #include <memory>
 
+#include "common/config.h"
 #include "exec/exec_node.h"
+#include "olap/hll.h"
 #include "runtime/block_spill_manager.h"
 #include "runtime/define_primitive_type.h"
 #include "runtime/descriptors.h"
@@ -99,6 +101,12 @@ static constexpr StreamingHtMinReductionEntry STREAMING_HT_MIN_REDUCTION[] = {
 static constexpr int STREAMING_HT_MIN_REDUCTION_SIZE =
         sizeof(STREAMING_HT_MIN_REDUCTION) / sizeof(STREAMING_HT_MIN_REDUCTION[0]);
 
+// The keys are regarded as unique if aggregating them reduces the rows less than this.
+static constexpr double STREAMING_HT_UNIQUE_KEYS_REDUCTION = 1.01;
+// Min rows of the hash table to stop expanding it for the unique keys before the L2 cache
+// is filled.
+static constexpr size_t STREAMING_HT_MIN_ROWS_FOR_UNIQUE_KEYS = 65536;
+
 AggregationNode::AggregationNode(ObjectPool* pool, const TPlanNode& tnode,
                                  const DescriptorTbl& descs)
         : ExecNode(pool, tnode, descs),
@@ -164,6 +172,7 @@ Status AggregationNode::init(const TPlanNode& tnode, RuntimeState* state) {
 
     const auto& agg_functions = tnode.agg_node.aggregate_functions;
     _external_agg_bytes_threshold = state->external_agg_bytes_threshold();
+    _partitioned_threshold = state->partitioned_hash_agg_rows_threshold();
 
     if (_external_agg_bytes_threshold > 0) {
         size_t spill_partition_count_bits = 4;
@@ -173,6 +182,7 @@ Status AggregationNode::init(const TPlanNode& tnode, RuntimeState* state) {
 
         _spill_partition_helper =
                 std::make_unique<SpillPartitionHelper>(spill_partition_count_bits);
+        _agg_reservation.init(state->query_mem_tracker());
     }
 
     _is_merge = std::any_of(agg_functions.cbegin(), agg_functions.cend(),
@@ -343,6 +353,15 @@ Status AggregationNode::prepare_profile(RuntimeState* state) {
     _hash_table_iterate_timer = ADD_TIMER(runtime_profile(), "HashTableIterateTime");
     _insert_keys_to_column_timer = ADD_TIMER(runtime_profile(), "InsertKeysToColumnTime");
     _streaming_agg_timer = ADD_TIMER(runtime_profile(), "StreamingAggTime");
+    _preagg_to_passthrough_counter =
+            ADD_COUNTER(runtime_profile(), "PreAggSwitchToPassthrough", TUnit::UNIT);
+    _preagg_to_aggregate_counter =
+            ADD_COUNTER(runtime_profile(), "PreAggSwitchToAggregate", TUnit::UNIT);
+    _preagg_passthrough_rows_counter =
+            ADD_COUNTER(runtime_profile(), "PreAggPassthroughRows", TUnit::UNIT);
+    // the last sampled reduction of a block, in percent
+    _preagg_sampled_reduction =
+            ADD_COUNTER(runtime_profile(), "PreAggSampledReductionPercent", TUnit::UNIT);
     _hash_table_size_counter = ADD_COUNTER(runtime_profile(), "HashTableSize", TUnit::UNIT);
     _hash_table_input_counter = ADD_COUNTER(runtime_profile(), "HashTableInputCount", TUnit::UNIT);
     _max_row_size_counter = ADD_COUNTER(runtime_profile(), "MaxRowSizeInBytes", TUnit::UNIT);
@@ -436,6 +455,8 @@ Status AggregationNode::prepare_profile(RuntimeState* state) {
                     using HashTableType = std::decay_t<decltype(agg_method.data)>;
                     using KeyType = typename HashTableType::key_type;
 
+                    _init_partitioned_threshold(agg_method.data);
+
                     /// some aggregate functions (like AVG for decimal) have align issues.
                     _aggregate_data_container.reset(new AggregateDataContainer(
                             sizeof(KeyType),
@@ -450,6 +471,17 @@ Status AggregationNode::prepare_profile(RuntimeState* state) {
         } else {
             _executor.execute = std::bind<Status>(&AggregationNode::_execute_with_serialized_key,
                                                   this, std::placeholders::_1);
+            if (config::enable_fused_agg_kernels) {
+                std::vector<const IAggregateFunction*> functions;
+                for (auto& evaluator : _aggregate_evaluators) {
+                    functions.push_back(evaluator->function().get());
+                }
+                _fused_agg_functions = create_fused_aggregate_functions(functions);
+            }
+            if (_fused_agg_functions) {
+                _fused_agg_columns.resize(_aggregate_evaluators.size());
+                runtime_profile()->append_exec_option("Fused Aggregate Kernel");
+            }
         }
 
         if (_is_streaming_preagg) {
@@ -586,10 +618,11 @@ Status AggregationNode::pull(doris::RuntimeState* state, vectorized::Block* bloc
 Status AggregationNode::sink(doris::RuntimeState* state, vectorized::Block* in_block, bool eos) {
     if (in_block->rows() > 0) {
         RETURN_IF_ERROR(_executor.execute(in_block));
-        RETURN_IF_ERROR(_try_spill_disk());
+        RETURN_IF_ERROR(_try_spill_disk(false, in_block->allocated_bytes()));
         _executor.update_memusage();
     }
     if (eos) {
+        _agg_reservation.release();
         if (_spill_context.has_data) {
             _try_spill_disk(true);
             RETURN_IF_ERROR(_spill_context.prepare_for_reading());
@@ -608,6 +641,11 @@ void AggregationNode::release_resource(RuntimeState* state) {
         std::visit(
                 [&](auto&& agg_method) {
                     COUNTER_SET(_hash_table_size_counter, int64_t(agg_method.data.size()));
+                    using HashTableType = std::decay_t<decltype(agg_method.data)>;
+                    if constexpr (HashTableTraits<HashTableType>::is_partitioned_table) {
+                        COUNTER_SET(_build_table_convert_timer,
+                                    agg_method.data.get_convert_timer_value());
+                    }
                 },
                 _agg_data->_aggregated_method_variant);
     }
@@ -634,13 +672,61 @@ Status AggregationNode::_create_agg_status(AggregateDataPtr data) {
     return Status::OK();
 }
 
+void AggregationNode::_create_agg_status_batch() {
+    if (_new_places.empty()) {
+        return;
+    }
+    size_t i = 0;
+    try {
+        for (; i < _aggregate_evaluators.size(); ++i) {
+            _aggregate_evaluators[i]->function()->create_batch(
+                    _new_places.data(), _new_places.size(), _offsets_of_aggregate_states[i]);
+        }
+    } catch (...) {
+        for (size_t j = 0; j < i; ++j) {
+            for (auto place : _new_places) {
+                _aggregate_evaluators[j]->function()->destroy(place +
+                                                              _offsets_of_aggregate_states[j]);
+            }
+        }
+        // the groups are already in the hash table, do not destroy their states again
+        _places_without_status.insert(_new_places.begin(), _new_places.end());
+        _new_places.clear();
+        throw;
+    }
+    _new_places.clear();
+}
+
 Status AggregationNode::_destroy_agg_status(AggregateDataPtr data) {
+    if (UNLIKELY(!_places_without_status.empty()) && _places_without_status.count(data)) {
+        return Status::OK();
+    }
     for (int i = 0; i < _aggregate_evaluators.size(); ++i) {
         _aggregate_evaluators[i]->function()->destroy(data + _offsets_of_aggregate_states[i]);
     }
     return Status::OK();
 }
 
+Status AggregationNode::_execute_batch_add(Block* block, bool agg_many) {
+    if (_fused_agg_functions) {
+        for (int i = 0; i < _aggregate_evaluators.size(); ++i) {
+            RETURN_IF_ERROR(_aggregate_evaluators[i]->calc_argument_columns(block));
+            _fused_agg_columns[i] = _aggregate_evaluators[i]->argument_columns();
+        }
+        SCOPED_TIMER(_exec_timer);
+        _fused_agg_functions->add_batch(block->rows(), _places.data(),
+                                        _offsets_of_aggregate_states.data(),
+                                        _fused_agg_columns.data(), _agg_arena_pool.get());
+        return Status::OK();
+    }
+    for (int i = 0; i < _aggregate_evaluators.size(); ++i) {
+        RETURN_IF_ERROR(_aggregate_evaluators[i]->execute_batch_add(
+                block, _offsets_of_aggregate_states[i], _places.data(), _agg_arena_pool.get(),
+                agg_many));
+    }
+    return Status::OK();
+}
+
 Status AggregationNode::_get_without_key_result(RuntimeState* state, Block* block, bool* eos) {
     DCHECK(_agg_data->without_key != nullptr);
     block->clear();
@@ -821,8 +907,17 @@ void AggregationNode::_make_nullable_output_key(Block* block) {
     }
 }
 
-bool AggregationNode::_should_expand_preagg_hash_tables() {
-    if (!_should_expand_hash_table) return false;
+bool AggregationNode::_should_expand_preagg_hash_tables(const ColumnRawPtrs& key_columns,
+                                                        size_t rows) {
+    const bool adaptive = config::enable_adaptive_streaming_preagg;
+    if (!_should_expand_hash_table) {
+        // In passthrough mode, sample a block now and then to find whether the keys get
+        // repeated again, e.g. the input is clustered by the keys from now on.
+        if (!adaptive ||
+            ++_passthrough_blocks % std::max(1, config::streaming_preagg_sample_block_interval)) {
+            return false;
+        }
+    }
 
     return std::visit(
             [&](auto&& agg_method) -> bool {
@@ -839,6 +934,21 @@ bool AggregationNode::_should_expand_preagg_hash_tables() {
                        ht_mem >= STREAMING_HT_MIN_REDUCTION[cache_level + 1].min_ht_mem) {
                     ++cache_level;
                 }
+                double min_reduction =
+                        STREAMING_HT_MIN_REDUCTION[cache_level].streaming_ht_min_reduction;
+
+                if (!_should_expand_hash_table) {
+                    // The reduction of the hash table is stale since passing through, so only
+                    // the reduction of the sampled block is considered.
+                    double block_reduction = _estimate_block_reduction(key_columns, rows);
+                    if (block_reduction >= 0 &&
+                        block_reduction >
+                                std::max(min_reduction, STREAMING_HT_UNIQUE_KEYS_REDUCTION)) {
+                        _should_expand_hash_table = true;
+                        COUNTER_UPDATE(_preagg_to_aggregate_counter, 1);
+                    }
+                    return _should_expand_hash_table;
+                }
 
                 // Compare the number of rows in the hash table with the number of input rows that
                 // were aggregated into it. Exclude passed through rows from this calculation since
@@ -862,18 +972,65 @@ bool AggregationNode::_should_expand_preagg_hash_tables() {
                 //  double estimated_reduction = aggregated_input_rows >= expected_input_rows
                 //      ? current_reduction
                 //      : 1 + (expected_input_rows / aggregated_input_rows) * (current_reduction - 1);
-                double min_reduction =
-                        STREAMING_HT_MIN_REDUCTION[cache_level].streaming_ht_min_reduction;
 
                 //  COUNTER_SET(preagg_estimated_reduction_, estimated_reduction);
                 //    COUNTER_SET(preagg_streaming_ht_min_reduction_, min_reduction);
                 //  return estimated_reduction > min_reduction;
-                _should_expand_hash_table = current_reduction > min_reduction;
+                bool expand = current_reduction > min_reduction;
+                // The reduction of the hash table is diluted by the long tail of skewed keys and
+                // reacts slowly to the change of input, the reduction of aggregating the current
+                // block by itself tells about the recent input.
+                double block_reduction =
+                        adaptive ? _estimate_block_reduction(key_columns, rows) : -1;
+                if (block_reduction >= 0) {
+                    if (current_reduction < STREAMING_HT_UNIQUE_KEYS_REDUCTION &&
+                        block_reduction < STREAMING_HT_UNIQUE_KEYS_REDUCTION) {
+                        // do not wait for filling the L2 cache with unique keys
+                        expand = ht_rows < STREAMING_HT_MIN_ROWS_FOR_UNIQUE_KEYS;
+                    } else {
+                        expand = std::max(current_reduction, block_reduction) > min_reduction;
+                    }
+                }
+                if (!expand) {
+                    _passthrough_blocks = 0;
+                    COUNTER_UPDATE(_preagg_to_passthrough_counter, 1);
+                }
+                _should_expand_hash_table = expand;
                 return _should_expand_hash_table;
             },
             _agg_data->_aggregated_method_variant);
 }
 
+double AggregationNode::_estimate_block_reduction(const ColumnRawPtrs& key_columns,
+                                                  size_t rows) {
+    for (const auto* column : key_columns) {
+        const IColumn* nested = column;
+        if (const auto* nullable = check_and_get_column<ColumnNullable>(column)) {
+            nested = &nullable->get_nested_column();
+        }
+        // only these columns could be hashed in batch
+        if (!nested->is_numeric() && !check_and_get_column<ColumnString>(nested) &&
+            !nested->is_column_decimal()) {
+            return -1;
+        }
+    }
+    if (rows == 0) {
+        return 1.0;
+    }
+    _sample_hashes.assign(rows, 0);
+    for (const auto* column : key_columns) {
+        column->update_hashes_with_value(_sample_hashes.data());
+    }
+    HyperLogLog sketch;
+    for (auto hash_value : _sample_hashes) {
+        sketch.update(hash_value);
+    }
+    double reduction =
+            static_cast<double>(rows) / std::max<int64_t>(1, sketch.estimate_cardinality());
+    COUNTER_SET(_preagg_sampled_reduction, static_cast<int64_t>(reduction * 100));
+    return reduction;
+}
+
 size_t AggregationNode::_memory_usage() const {
     size_t usage = 0;
     std::visit(
@@ -923,6 +1080,7 @@ Status AggregationNode::_reset_hash_table() {
                          _align_aggregate_states) *
                                 _align_aggregate_states));
                 hash_table = HashTableType();
+                _init_partitioned_threshold(hash_table);
                 _agg_arena_pool.reset(new Arena);
                 return Status::OK();
             },
@@ -936,12 +1094,53 @@ size_t AggregationNode::_get_hash_table_size() {
 
 void AggregationNode::_emplace_into_hash_table(AggregateDataPtr* places, ColumnRawPtrs& key_columns,
                                                const size_t num_rows) {
+    // The states of the new groups are created together after emplacing the block, and even
+    // if the emplacing fails, so all the groups in the hash table have their states.
+    _new_places.clear();
+    try {
+        _emplace_keys_into_hash_table(places, key_columns, num_rows);
+    } catch (...) {
+        _create_agg_status_batch();
+        throw;
+    }
+    _create_agg_status_batch();
+}
+
+void AggregationNode::_emplace_keys_into_hash_table(AggregateDataPtr* places,
+                                                    ColumnRawPtrs& key_columns,
+                                                    const size_t num_rows) {
     std::visit(
             [&](auto&& agg_method) -> void {
                 SCOPED_TIMER(_hash_table_compute_timer);
                 using HashMethodType = std::decay_t<decltype(agg_method)>;
                 using HashTableType = std::decay_t<decltype(agg_method.data)>;
                 using AggState = typename HashMethodType::State;
+
+                auto creator = [this](const auto& ctor, const auto& key) {
+                    using KeyType = std::decay_t<decltype(key)>;
+                    if constexpr (HashTableTraits<HashTableType>::is_string_hash_table &&
+                                  !std::is_same_v<StringRef, KeyType>) {
+                        StringRef string_ref = to_string_ref(key);
+                        ArenaKeyHolder key_holder {string_ref, *_agg_arena_pool};
+                        key_holder_persist_key(key_holder);
+                        auto mapped = _aggregate_data_container->append_data(key_holder.key);
+                        _new_places.push_back(mapped);
+                        ctor(key, mapped);
+                    } else {
+                        auto mapped = _aggregate_data_container->append_data(key);
+                        _new_places.push_back(mapped);
+                        ctor(key, mapped);
+                    }
+                };
+
+                if constexpr (std::is_same_v<HashTableType, AggregatedDataWithShortStringKey>) {
+                    if (key_columns[0]->is_column_dictionary()) {
+                        _emplace_dict_codes_into_hash_table(places, agg_method.data,
+                                                            *key_columns[0], num_rows, creator);
+                        return;
+                    }
+                }
+
                 AggState state(key_columns, _probe_key_sz, nullptr);
 
                 _pre_serialize_key_if_need(state, agg_method, key_columns, num_rows);
@@ -961,27 +1160,10 @@ void AggregationNode::_emplace_into_hash_table(AggregateDataPtr* places, ColumnR
                     }
                 }
 
-                auto creator = [this](const auto& ctor, const auto& key) {
-                    using KeyType = std::decay_t<decltype(key)>;
-                    if constexpr (HashTableTraits<HashTableType>::is_string_hash_table &&
-                                  !std::is_same_v<StringRef, KeyType>) {
-                        StringRef string_ref = to_string_ref(key);
-                        ArenaKeyHolder key_holder {string_ref, *_agg_arena_pool};
-                        key_holder_persist_key(key_holder);
-                        auto mapped = _aggregate_data_container->append_data(key_holder.key);
-                        _create_agg_status(mapped);
-                        ctor(key, mapped);
-                    } else {
-                        auto mapped = _aggregate_data_container->append_data(key);
-                        _create_agg_status(mapped);
-                        ctor(key, mapped);
-                    }
-                };
-
                 auto creator_for_null_key = [this](auto& mapped) {
                     mapped = _agg_arena_pool->aligned_alloc(_total_size_of_aggregate_states,
                                                             _align_aggregate_states);
-                    _create_agg_status(mapped);
+                    _new_places.push_back(mapped);
                 };
 
                 /// For all rows.
@@ -1028,6 +1210,15 @@ void AggregationNode::_find_in_hash_table(AggregateDataPtr* places, ColumnRawPtr
                 using HashMethodType = std::decay_t<decltype(agg_method)>;
                 using HashTableType = std::decay_t<decltype(agg_method.data)>;
                 using AggState = typename HashMethodType::State;
+
+                if constexpr (std::is_same_v<HashTableType, AggregatedDataWithShortStringKey>) {
+                    if (key_columns[0]->is_column_dictionary()) {
+                        _find_dict_codes_in_hash_table(places, agg_method.data, *key_columns[0],
+                                                       num_rows);
+                        return;
+                    }
+                }
+
                 AggState state(key_columns, _probe_key_sz, nullptr);
 
                 _pre_serialize_key_if_need(state, agg_method, key_columns, num_rows);
@@ -1110,11 +1301,14 @@ Status AggregationNode::_pre_agg_with_serialized_key(doris::vectorized::Block* i
                     /// it is better to output the data directly without performing further aggregation.
                     const bool used_too_much_memory =
                             (_external_agg_bytes_threshold > 0 &&
-                             _memory_usage() > _external_agg_bytes_threshold);
+                             (_memory_usage() > _external_agg_bytes_threshold ||
+                              !_agg_reservation.try_resize(in_block->allocated_bytes())));
                     // do not try to do agg, just init and serialize directly return the out_block
-                    if (!_should_expand_preagg_hash_tables() || used_too_much_memory) {
+                    if (!_should_expand_preagg_hash_tables(key_columns, rows) ||
+                        used_too_much_memory) {
                         SCOPED_TIMER(_streaming_agg_timer);
                         ret_flag = true;
+                        COUNTER_UPDATE(_preagg_passthrough_rows_counter, rows);
 
                         // will serialize value data to string column.
                         // non-nullable column(id in `_make_nullable_keys`)
@@ -1204,11 +1398,7 @@ Status AggregationNode::_pre_agg_with_serialized_key(doris::vectorized::Block* i
     if (!ret_flag) {
         RETURN_IF_CATCH_EXCEPTION(_emplace_into_hash_table(_places.data(), key_columns, rows));
 
-        for (int i = 0; i < _aggregate_evaluators.size(); ++i) {
-            RETURN_IF_ERROR(_aggregate_evaluators[i]->execute_batch_add(
-                    in_block, _offsets_of_aggregate_states[i], _places.data(),
-                    _agg_arena_pool.get(), _should_expand_hash_table));
-        }
+        RETURN_IF_ERROR(_execute_batch_add(in_block, _should_expand_hash_table));
     }
 
     return Status::OK();
@@ -1332,77 +1522,44 @@ Status AggregationNode::_spill_hash_table(HashTableCtxType& agg_method, HashTabl
     _spill_context.stream_ids.emplace_back(writer->get_id());
 
     std::vector<size_t> partitioned_indices(block.rows());
-    std::vector<size_t> blocks_rows(_spill_partition_helper->partition_count);
 
     // The last row may contain a null key.
     const size_t rows = hash_table.has_null_key_data() ? block.rows() - 1 : block.rows();
     for (size_t i = 0; i < rows; ++i) {
         const auto index = _spill_partition_helper->get_index(hash_table.hash(keys[i]));
         partitioned_indices[i] = index;
-        blocks_rows[index]++;
     }
 
     if (hash_table.has_null_key_data()) {
         // Here put the row with null key at the last partition.
         const auto index = _spill_partition_helper->partition_count - 1;
         partitioned_indices[rows] = index;
-        blocks_rows[index]++;
     }
 
+    std::vector<Block> partitioned_blocks;
+    _spill_partition_helper->split_block(block, partitioned_indices, partitioned_blocks);
     for (size_t i = 0; i < _spill_partition_helper->partition_count; ++i) {
-        Block block_to_write = block.clone_empty();
-        if (blocks_rows[i] == 0) {
-            /// Here write one empty block to ensure there are enough blocks in the file,
-            /// blocks' count should be equal with partition_count.
-            writer->write(block_to_write);
-            continue;
-        }
-
-        MutableBlock mutable_block(std::move(block_to_write));
-
-        for (auto& column : mutable_block.mutable_columns()) {
-            column->reserve(blocks_rows[i]);
-        }
-
-        size_t begin = 0;
-        size_t length = 0;
-        for (size_t j = 0; j < partitioned_indices.size(); ++j) {
-            if (partitioned_indices[j] != i) {
-                if (length > 0) {
-                    mutable_block.add_rows(&block, begin, length);
-                }
-                length = 0;
-                continue;
-            }
-
-            if (length == 0) {
-                begin = j;
-            }
-            length++;
-        }
-
-        if (length > 0) {
-            mutable_block.add_rows(&block, begin, length);
-        }
-
-        CHECK_EQ(mutable_block.rows(), blocks_rows[i]);
-        RETURN_IF_ERROR(writer->write(mutable_block.to_block()));
+        /// Here write one block for each partition(even if it is empty) to ensure there are
+        /// enough blocks in the file, blocks' count should be equal with partition_count.
+        RETURN_IF_ERROR(writer->write(partitioned_blocks[i]));
     }
     RETURN_IF_ERROR(writer->close());
 
     return Status::OK();
 }
 
-Status AggregationNode::_try_spill_disk(bool eos) {
+Status AggregationNode::_try_spill_disk(bool eos, int64_t next_block_bytes) {
     if (_external_agg_bytes_threshold == 0) {
         return Status::OK();
     }
     return std::visit(
             [&](auto&& agg_method) -> Status {
                 auto& hash_table = agg_method.data;
-                if (!eos && _memory_usage() < _external_agg_bytes_threshold) {
+                if (!eos && _memory_usage() < _external_agg_bytes_threshold &&
+                    _agg_reservation.try_resize(next_block_bytes)) {
                     return Status::OK();
                 }
+                _agg_reservation.release();
 
                 if (_get_hash_table_size() == 0) {
                     return Status::OK();
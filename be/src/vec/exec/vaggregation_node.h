@@ -28,6 +28,7 @@
 #include <ostream>
 #include <string>
 #include <type_traits>
+#include <unordered_set>
 #include <utility>
 #include <variant>
 #include <vector>
@@ -37,9 +38,12 @@
 #include "common/global_types.h"
 #include "common/status.h"
 #include "exec/exec_node.h"
+#include "runtime/memory/mem_reservation.h"
 #include "util/runtime_profile.h"
 #include "vec/aggregate_functions/aggregate_function.h"
+#include "vec/aggregate_functions/aggregate_function_fused.h"
 #include "vec/columns/column.h"
+#include "vec/columns/column_dictionary.h"
 #include "vec/columns/column_nullable.h"
 #include "vec/columns/column_string.h"
 #include "vec/columns/column_vector_helper.h"
@@ -52,6 +56,7 @@
 #include "vec/common/hash_table/fixed_hash_map.h"
 #include "vec/common/hash_table/fixed_hash_table.h"
 #include "vec/common/hash_table/hash.h"
+#include "vec/common/hash_table/hash_table_key_holder.h"
 #include "vec/common/hash_table/partitioned_hash_map.h"
 #include "vec/common/hash_table/ph_hash_map.h"
 #include "vec/common/hash_table/string_hash_map.h"
@@ -62,6 +67,7 @@
 #include "vec/core/block_spill_reader.h"
 #include "vec/core/block_spill_writer.h"
 #include "vec/core/column_with_type_and_name.h"
+#include "vec/core/spill_partition_helper.h"
 #include "vec/core/types.h"
 #include "vec/exprs/vectorized_agg_fn.h"
 #include "vec/exprs/vexpr.h"
@@ -189,7 +195,11 @@ private:
 };
 
 using AggregatedDataWithoutKey = AggregateDataPtr;
-using AggregatedDataWithStringKey = PHHashMap<StringRef, AggregateDataPtr, DefaultHash<StringRef>>;
+// The hash tables of the keys which may have a large number of groups start as a single level
+// table, and are converted to partitioned ones of 16 sub tables when the size reaches the
+// partitioned_hash_agg_rows_threshold, so a huge table does not stall on a single resize.
+using AggregatedDataWithStringKey =
+        PHPartitionedHashMap<StringRef, AggregateDataPtr, DefaultHash<StringRef>>;
 using AggregatedDataWithShortStringKey = StringHashMap<AggregateDataPtr>;
 
 template <typename TData>
@@ -436,18 +446,22 @@ struct AggregationMethodSingleNullableColumn : public SingleColumnMethod {
 using AggregatedDataWithUInt8Key =
         FixedImplicitZeroHashMapWithCalculatedSize<UInt8, AggregateDataPtr>;
 using AggregatedDataWithUInt16Key = FixedImplicitZeroHashMap<UInt16, AggregateDataPtr>;
-using AggregatedDataWithUInt32Key = PHHashMap<UInt32, AggregateDataPtr, HashCRC32<UInt32>>;
-using AggregatedDataWithUInt64Key = PHHashMap<UInt64, AggregateDataPtr, HashCRC32<UInt64>>;
-using AggregatedDataWithUInt128Key = PHHashMap<UInt128, AggregateDataPtr, HashCRC32<UInt128>>;
-using AggregatedDataWithUInt256Key = PHHashMap<UInt256, AggregateDataPtr, HashCRC32<UInt256>>;
+using AggregatedDataWithUInt32Key =
+        PHPartitionedHashMap<UInt32, AggregateDataPtr, HashCRC32<UInt32>>;
+using AggregatedDataWithUInt64Key =
+        PHPartitionedHashMap<UInt64, AggregateDataPtr, HashCRC32<UInt64>>;
+using AggregatedDataWithUInt128Key =
+        PHPartitionedHashMap<UInt128, AggregateDataPtr, HashCRC32<UInt128>>;
+using AggregatedDataWithUInt256Key =
+        PHPartitionedHashMap<UInt256, AggregateDataPtr, HashCRC32<UInt256>>;
 using AggregatedDataWithUInt32KeyPhase2 =
-        PHHashMap<UInt32, AggregateDataPtr, HashMixWrapper<UInt32>>;
+        PHPartitionedHashMap<UInt32, AggregateDataPtr, HashMixWrapper<UInt32>>;
 using AggregatedDataWithUInt64KeyPhase2 =
-        PHHashMap<UInt64, AggregateDataPtr, HashMixWrapper<UInt64>>;
+        PHPartitionedHashMap<UInt64, AggregateDataPtr, HashMixWrapper<UInt64>>;
 using AggregatedDataWithUInt128KeyPhase2 =
-        PHHashMap<UInt128, AggregateDataPtr, HashMixWrapper<UInt128>>;
+        PHPartitionedHashMap<UInt128, AggregateDataPtr, HashMixWrapper<UInt128>>;
 using AggregatedDataWithUInt256KeyPhase2 =
-        PHHashMap<UInt256, AggregateDataPtr, HashMixWrapper<UInt256>>;
+        PHPartitionedHashMap<UInt256, AggregateDataPtr, HashMixWrapper<UInt256>>;
 
 using AggregatedDataWithNullableUInt8Key = AggregationDataWithNullKey<AggregatedDataWithUInt8Key>;
 using AggregatedDataWithNullableUInt16Key = AggregationDataWithNullKey<AggregatedDataWithUInt16Key>;
@@ -848,21 +862,6 @@ struct AggSpillContext {
     }
 };
 
-struct SpillPartitionHelper {
-    const size_t partition_count_bits;
-    const size_t partition_count;
-    const size_t max_partition_index;
-
-    SpillPartitionHelper(const size_t partition_count_bits_)
-            : partition_count_bits(partition_count_bits_),
-              partition_count(1 << partition_count_bits),
-              max_partition_index(partition_count - 1) {}
-
-    size_t get_index(size_t hash_value) const {
-        return (hash_value >> (32 - partition_count_bits)) & max_partition_index;
-    }
-};
-
 // not support spill
 class AggregationNode final : public ::doris::ExecNode {
 public:
@@ -923,9 +922,16 @@ private:
 
     AggSpillContext _spill_context;
     std::unique_ptr<SpillPartitionHelper> _spill_partition_helper;
+    // reserved for the growth of the hash table by the next block, the hash table is
+    // spilled or the pre-aggregation passes the rows through if denied
+    MemReservation _agg_reservation;
 
     ArenaUPtr _agg_arena_pool;
 
+    // adds a block into all the states in one pass, nullptr if the functions are not fusible
+    std::unique_ptr<IFusedAggregateFunctions> _fused_agg_functions;
+    std::vector<const IColumn**> _fused_agg_columns;
+
     RuntimeProfile::Counter* _build_timer;
     RuntimeProfile::Counter* _build_table_convert_timer;
     RuntimeProfile::Counter* _serialize_key_timer;
@@ -940,6 +946,10 @@ private:
     RuntimeProfile::Counter* _hash_table_iterate_timer;
     RuntimeProfile::Counter* _insert_keys_to_column_timer;
     RuntimeProfile::Counter* _streaming_agg_timer;
+    RuntimeProfile::Counter* _preagg_to_passthrough_counter = nullptr;
+    RuntimeProfile::Counter* _preagg_to_aggregate_counter = nullptr;
+    RuntimeProfile::Counter* _preagg_passthrough_rows_counter = nullptr;
+    RuntimeProfile::Counter* _preagg_sampled_reduction = nullptr;
     RuntimeProfile::Counter* _hash_table_size_counter;
     RuntimeProfile::Counter* _hash_table_input_counter;
     RuntimeProfile::Counter* _max_row_size_counter;
@@ -951,6 +961,13 @@ private:
     bool _is_streaming_preagg;
     Block _preagg_block = Block();
     bool _should_expand_hash_table = true;
+    // blocks passed through since the last switch to passthrough
+    int64_t _passthrough_blocks = 0;
+    std::vector<uint64_t> _sample_hashes;
+    // the places of the groups emplaced into hash table, whose states are not created yet
+    std::vector<AggregateDataPtr> _new_places;
+    // the places whose states failed to be created
+    std::unordered_set<AggregateDataPtr> _places_without_status;
     bool _child_eos = false;
 
     bool _should_limit_output = false;
@@ -960,20 +977,30 @@ private:
     PODArray<AggregateDataPtr> _places;
     std::vector<char> _deserialize_buffer;
     std::vector<size_t> _hash_values;
+    // places of the dictionary codes of the current block
+    std::vector<AggregateDataPtr> _dict_code_places;
+    std::vector<bool> _dict_code_not_found;
     std::vector<AggregateDataPtr> _values;
     std::unique_ptr<AggregateDataContainer> _aggregate_data_container;
 
     void _release_self_resource(RuntimeState* state);
     /// Return true if we should keep expanding hash tables in the preagg. If false,
     /// the preagg should pass through any rows it can't fit in its tables.
-    bool _should_expand_preagg_hash_tables();
+    bool _should_expand_preagg_hash_tables(const ColumnRawPtrs& key_columns, size_t rows);
+    /// The reduction of aggregating the block by itself, estimated by the distinct keys,
+    /// or -1 if the keys could not be sampled.
+    double _estimate_block_reduction(const ColumnRawPtrs& key_columns, size_t rows);
 
     size_t _get_hash_table_size();
 
     void _make_nullable_output_key(Block* block);
 
     Status _create_agg_status(AggregateDataPtr data);
+    // create the states of _new_places function by function
+    void _create_agg_status_batch();
     Status _destroy_agg_status(AggregateDataPtr data);
+    // add the block into the states of _places, by the fused kernel if any
+    Status _execute_batch_add(Block* block, bool agg_many);
 
     Status _get_without_key_result(RuntimeState* state, Block* block, bool* eos);
     Status _serialize_without_key(RuntimeState* state, Block* block, bool* eos);
@@ -1051,11 +1078,7 @@ private:
         } else {
             _emplace_into_hash_table(_places.data(), key_columns, rows);
 
-            for (int i = 0; i < _aggregate_evaluators.size(); ++i) {
-                RETURN_IF_ERROR(_aggregate_evaluators[i]->execute_batch_add(
-                        block, _offsets_of_aggregate_states[i], _places.data(),
-                        _agg_arena_pool.get()));
-            }
+            RETURN_IF_ERROR(_execute_batch_add(block, false));
 
             if (_should_limit_output) {
                 _reach_limit = _get_hash_table_size() >= _limit;
@@ -1200,11 +1223,15 @@ private:
     void _emplace_into_hash_table(AggregateDataPtr* places, ColumnRawPtrs& key_columns,
                                   const size_t num_rows);
 
+    void _emplace_keys_into_hash_table(AggregateDataPtr* places, ColumnRawPtrs& key_columns,
+                                       const size_t num_rows);
+
     size_t _memory_usage() const;
 
     Status _reset_hash_table();
 
-    Status _try_spill_disk(bool eos = false);
+    // next_block_bytes is the memory expected to be allocated by the next block
+    Status _try_spill_disk(bool eos = false, int64_t next_block_bytes = 0);
 
     template <typename HashTableCtxType, typename HashTableType, typename KeyType>
     Status _serialize_hash_table_to_block(HashTableCtxType& context, HashTableType& hash_table,
@@ -1213,8 +1240,63 @@ private:
     template <typename HashTableCtxType, typename HashTableType>
     Status _spill_hash_table(HashTableCtxType& agg_method, HashTableType& hash_table);
 
+    template <typename HashTableType>
+    void _init_partitioned_threshold(HashTableType& hash_table) {
+        if constexpr (HashTableTraits<HashTableType>::is_partitioned_table) {
+            hash_table.set_partitioned_threshold(_partitioned_threshold);
+        }
+    }
+
     void _find_in_hash_table(AggregateDataPtr* places, ColumnRawPtrs& key_columns, size_t num_rows);
 
+    // The single string key still encoded as dictionary codes, e.g. of a low cardinality column
+    // read from a dictionary page, is grouped on the codes in a dense array, so only the
+    // distinct values of the block are hashed and decoded.
+    template <typename HashTableType, typename Creator>
+    void _emplace_dict_codes_into_hash_table(AggregateDataPtr* places, HashTableType& hash_table,
+                                             const IColumn& key_column, size_t num_rows,
+                                             Creator&& creator) {
+        const auto& column_dict = assert_cast<const ColumnDictI32&>(key_column);
+        DCHECK(!column_dict.is_dict_sorted() || column_dict.is_dict_code_converted());
+        const auto& codes = column_dict.get_data();
+        _dict_code_places.assign(column_dict.dict_size(), nullptr);
+        for (size_t i = 0; i < num_rows; ++i) {
+            DCHECK(codes[i] >= 0 && codes[i] < _dict_code_places.size());
+            auto& place = _dict_code_places[codes[i]];
+            if (place == nullptr) {
+                ArenaKeyHolder key_holder {column_dict.get_value(codes[i]), *_agg_arena_pool};
+                typename HashTableType::LookupResult it;
+                hash_table.lazy_emplace(key_holder, it, creator);
+                place = *lookup_result_get_mapped(it);
+            }
+            places[i] = place;
+        }
+    }
+
+    template <typename HashTableType>
+    void _find_dict_codes_in_hash_table(AggregateDataPtr* places, HashTableType& hash_table,
+                                        const IColumn& key_column, size_t num_rows) {
+        const auto& column_dict = assert_cast<const ColumnDictI32&>(key_column);
+        DCHECK(!column_dict.is_dict_sorted() || column_dict.is_dict_code_converted());
+        const auto& codes = column_dict.get_data();
+        // the codes not found in the hash table are marked by _dict_code_not_found
+        _dict_code_places.assign(column_dict.dict_size(), nullptr);
+        _dict_code_not_found.assign(column_dict.dict_size(), false);
+        for (size_t i = 0; i < num_rows; ++i) {
+            DCHECK(codes[i] >= 0 && codes[i] < _dict_code_places.size());
+            auto& place = _dict_code_places[codes[i]];
+            if (place == nullptr && !_dict_code_not_found[codes[i]]) {
+                auto it = hash_table.find(column_dict.get_value(codes[i]));
+                if (it != nullptr) {
+                    place = *lookup_result_get_mapped(it);
+                } else {
+                    _dict_code_not_found[codes[i]] = true;
+                }
+            }
+            places[i] = place;
+        }
+    }
+
     void release_tracker();
 
     void _release_mem();
@@ -23,6 +23,7 @@
 #include <thrift/protocol/TDebugProtocol.h>
 
 #include <algorithm>
+#include <limits>
 #include <ostream>
 #include <utility>
 
@@ -30,11 +31,16 @@
 #include "common/compiler_util.h" // IWYU pragma: keep
 #include "common/exception.h"
 #include "common/logging.h"
+#include "runtime/block_spill_manager.h"
 #include "runtime/descriptors.h"
+#include "runtime/exec_env.h"
 #include "runtime/memory/mem_tracker.h"
 #include "runtime/runtime_state.h"
 #include "util/telemetry/telemetry.h"
+#include "vec/columns/column_const.h"
 #include "vec/columns/column_nullable.h"
+#include "vec/core/block_spill_reader.h"
+#include "vec/core/block_spill_writer.h"
 #include "vec/core/column_with_type_and_name.h"
 #include "vec/data_types/data_type.h"
 #include "vec/data_types/data_type_nullable.h"
@@ -171,6 +177,11 @@ Status VAnalyticEvalNode::prepare(RuntimeState* state) {
     _blocks_memory_usage =
             runtime_profile()->AddHighWaterMarkCounter("Blocks", TUnit::BYTES, "MemoryUsage");
     _evaluation_timer = ADD_TIMER(runtime_profile(), "EvaluationTime");
+    _external_analytic_bytes_threshold = state->external_analytic_bytes_threshold();
+    if (_external_analytic_bytes_threshold > 0) {
+        _block_spill_profile = runtime_profile()->create_child("BlockSpill", true, true);
+        _spilled_block_count = ADD_COUNTER(_block_spill_profile, "SpilledBlockCount", TUnit::UNIT);
+    }
     SCOPED_TIMER(_evaluation_timer);
 
     _intermediate_tuple_desc = state->desc_tbl().get_tuple_descriptor(_intermediate_tuple_id);
@@ -588,6 +599,11 @@ Status VAnalyticEvalNode::sink(doris::RuntimeState* /*state*/, vectorized::Block
     //TODO: if need improvement, the is a tips to maintain a free queue,
     //so the memory could reuse, no need to new/delete again;
     _input_blocks.emplace_back(std::move(*input_block));
+    _spilled_stream_ids.emplace_back(-1);
+    if (_external_analytic_bytes_threshold > 0 &&
+        _blocks_memory_usage->current_value() > _external_analytic_bytes_threshold) {
+        RETURN_IF_ERROR(_spill_input_blocks());
+    }
     _found_partition_end = _get_partition_by_end();
     _need_more_input = whether_need_next_partition(_found_partition_end);
     return Status::OK();
@@ -647,6 +663,9 @@ Status VAnalyticEvalNode::_output_current_block(Block* block) {
     block->swap(std::move(_input_blocks[_output_block_index]));
     _blocks_memory_usage->add(-block->allocated_bytes());
     mem_tracker()->consume(-block->allocated_bytes());
+    if (_spilled_stream_ids[_output_block_index] != -1) {
+        RETURN_IF_ERROR(_restore_spilled_block(block));
+    }
     if (_origin_cols.size() < block->columns()) {
         block->erase_not_in(_origin_cols);
     }
@@ -794,7 +813,92 @@ std::string VAnalyticEvalNode::debug_window_bound_string(TAnalyticWindowBoundary
     return ss.str();
 }
 
+bool VAnalyticEvalNode::_is_key_column(size_t column_id) const {
+    return std::find(_partition_by_column_idxs.begin(), _partition_by_column_idxs.end(),
+                     column_id) != _partition_by_column_idxs.end() ||
+           std::find(_ordey_by_column_idxs.begin(), _ordey_by_column_idxs.end(), column_id) !=
+                   _ordey_by_column_idxs.end();
+}
+
+Status VAnalyticEvalNode::_spill_input_blocks() {
+    _next_spill_block_index = std::max<size_t>(_next_spill_block_index, _output_block_index);
+    for (; _next_spill_block_index < _input_blocks.size(); ++_next_spill_block_index) {
+        auto& block = _input_blocks[_next_spill_block_index];
+        const auto rows = block.rows();
+        if (rows == 0) {
+            continue;
+        }
+
+        Block spilled_block;
+        for (size_t i = 0; i < _origin_cols.size(); ++i) {
+            if (!_is_key_column(i)) {
+                auto column_with_type = block.get_by_position(i);
+                column_with_type.column = column_with_type.column->convert_to_full_column_if_const();
+                spilled_block.insert(std::move(column_with_type));
+            }
+        }
+        if (spilled_block.columns() == 0) {
+            continue;
+        }
+
+        BlockSpillWriterUPtr spill_block_writer;
+        RETURN_IF_ERROR(ExecEnv::GetInstance()->block_spill_mgr()->get_writer(
+                std::numeric_limits<int32_t>::max(), spill_block_writer, _block_spill_profile));
+        RETURN_IF_ERROR(spill_block_writer->write(spilled_block));
+        _spilled_stream_ids[_next_spill_block_index] = spill_block_writer->get_id();
+        RETURN_IF_ERROR(spill_block_writer->close());
+        COUNTER_UPDATE(_spilled_block_count, 1);
+
+        // keep the number of rows and the positions of the key columns of block
+        const auto bytes_before_spill = block.allocated_bytes();
+        for (size_t i = 0; i < block.columns(); ++i) {
+            auto& column = block.get_by_position(i).column;
+            if (!_is_key_column(i) && !is_column_const(*column)) {
+                column = ColumnConst::create(column->clone_resized(1), rows);
+            }
+        }
+        const int64_t spilled_bytes = bytes_before_spill - block.allocated_bytes();
+        _blocks_memory_usage->add(-spilled_bytes);
+        mem_tracker()->consume(-spilled_bytes);
+    }
+    return Status::OK();
+}
+
+Status VAnalyticEvalNode::_restore_spilled_block(Block* block) {
+    BlockSpillReaderUPtr spilled_block_reader;
+    RETURN_IF_ERROR(ExecEnv::GetInstance()->block_spill_mgr()->get_reader(
+            _spilled_stream_ids[_output_block_index], spilled_block_reader, _block_spill_profile));
+    _spilled_stream_ids[_output_block_index] = -1;
+
+    Block spilled_block;
+    bool eos = false;
+    RETURN_IF_ERROR(spilled_block_reader->read(&spilled_block, &eos));
+    RETURN_IF_ERROR(spilled_block_reader->close());
+    DCHECK_EQ(spilled_block.rows(), block->rows());
+
+    Block restored_block;
+    size_t spilled_column_id = 0;
+    for (size_t i = 0; i < _origin_cols.size(); ++i) {
+        restored_block.insert(_is_key_column(i)
+                                      ? block->get_by_position(i)
+                                      : spilled_block.get_by_position(spilled_column_id++));
+    }
+    block->swap(restored_block);
+    return Status::OK();
+}
+
 void VAnalyticEvalNode::_release_mem() {
+    // delete the spilled files which are not read back, e.g. the query is cancelled or
+    // reaches the limit.
+    for (auto stream_id : _spilled_stream_ids) {
+        if (stream_id != -1) {
+            BlockSpillReaderUPtr spilled_block_reader;
+            ExecEnv::GetInstance()->block_spill_mgr()->get_reader(stream_id, spilled_block_reader,
+                                                                   _block_spill_profile);
+        }
+    }
+    _spilled_stream_ids.clear();
+
     _agg_arena_pool = nullptr;
 
     std::vector<Block> tmp_input_blocks;
@@ -133,6 +133,13 @@ private:
 
     void _release_mem();
 
+    bool _is_key_column(size_t column_id) const;
+    // Spill the non key columns of the buffered blocks which are not output yet, only the
+    // partition by and order by columns are kept in memory to find the boundaries of partitions.
+    Status _spill_input_blocks();
+    // Read back the spilled columns of the block to output.
+    Status _restore_spilled_block(Block* block);
+
 private:
     enum AnalyticFnScope { PARTITION, RANGE, ROWS };
     std::vector<Block> _input_blocks;
@@ -188,5 +195,13 @@ private:
     RuntimeProfile::HighWaterMarkCounter* _blocks_memory_usage;
 
     std::vector<bool> _change_to_nullable_flags;
+
+    // 0 means the buffered blocks are never spilled
+    int64_t _external_analytic_bytes_threshold = 0;
+    // stream id of the spilled columns of each buffered block, -1 if it is not spilled
+    std::vector<int64_t> _spilled_stream_ids;
+    size_t _next_spill_block_index = 0;
+    RuntimeProfile* _block_spill_profile = nullptr;
+    RuntimeProfile::Counter* _spilled_block_count = nullptr;
 };
 } // namespace doris::vectorized
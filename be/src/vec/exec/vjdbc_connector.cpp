@@ -69,6 +69,7 @@ const char* JDBC_EXECUTOR_HAS_NEXT_SIGNATURE = "()Z";
 const char* JDBC_EXECUTOR_GET_BLOCK_SIGNATURE = "(I)Ljava/util/List;";
 const char* JDBC_EXECUTOR_GET_BLOCK_WITH_TYPES_SIGNATURE = "(ILjava/lang/Object;)Ljava/util/List;";
 const char* JDBC_EXECUTOR_GET_TYPES_SIGNATURE = "()Ljava/util/List;";
+const char* JDBC_EXECUTOR_GET_SPLIT_BOUNDS_SIGNATURE = "()[J";
 const char* JDBC_EXECUTOR_CLOSE_SIGNATURE = "()V";
 const char* JDBC_EXECUTOR_TRANSACTION_SIGNATURE = "()V";
 const char* JDBC_EXECUTOR_COPY_BATCH_SIGNATURE = "(Ljava/lang/Object;ZIJJ)V";
@@ -455,6 +456,27 @@ Status JdbcConnector::get_next(bool* eos, std::vector<MutableColumnPtr>& columns
     return JniUtil::GetJniExceptionMsg(env);
 }
 
+Status JdbcConnector::get_split_bounds(bool* has_bounds, int64_t* min, int64_t* max) {
+    if (!_is_open) {
+        return Status::InternalError("get_split_bounds before open of jdbc connector.");
+    }
+    SCOPED_RAW_TIMER(&_jdbc_statistic._execte_read_timer);
+    JNIEnv* env = nullptr;
+    RETURN_IF_ERROR(JniUtil::GetJNIEnv(&env));
+    jobject bounds = env->CallNonvirtualObjectMethod(_executor_obj, _executor_clazz,
+                                                     _executor_get_split_bounds_id);
+    RETURN_IF_ERROR(JniUtil::GetJniExceptionMsg(env));
+    *has_bounds = bounds != nullptr;
+    if (*has_bounds) {
+        jlong values[2];
+        env->GetLongArrayRegion(static_cast<jlongArray>(bounds), 0, 2, values);
+        env->DeleteLocalRef(bounds);
+        *min = values[0];
+        *max = values[1];
+    }
+    return JniUtil::GetJniExceptionMsg(env);
+}
+
 Status JdbcConnector::_convert_batch_result_set(JNIEnv* env, jobject jcolumn_data,
                                                 const SlotDescriptor* slot_desc,
                                                 vectorized::IColumn* column_ptr, int num_rows,
@@ -682,6 +704,9 @@ Status JdbcConnector::_register_func_id(JNIEnv* env) {
                                 _executor_has_next_id));
     RETURN_IF_ERROR(
             register_id(_executor_clazz, "getCurBlockRows", "()I", _executor_block_rows_id));
+    RETURN_IF_ERROR(register_id(_executor_clazz, "getSplitBounds",
+                                JDBC_EXECUTOR_GET_SPLIT_BOUNDS_SIGNATURE,
+                                _executor_get_split_bounds_id));
     RETURN_IF_ERROR(register_id(_executor_clazz, "copyBatchBooleanResult",
                                 JDBC_EXECUTOR_COPY_BATCH_SIGNATURE, _executor_get_boolean_result));
     RETURN_IF_ERROR(register_id(_executor_clazz, "copyBatchTinyIntResult",
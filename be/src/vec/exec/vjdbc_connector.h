@@ -86,6 +86,11 @@ public:
     Status get_next(bool* eos, std::vector<MutableColumnPtr>& columns, Block* block,
                     int batch_size);
 
+    // Gets the min and the max selected by the query string, which selects the min and the max
+    // of a split column. has_bounds is false if they are null. Called after open() instead of
+    // query().
+    Status get_split_bounds(bool* has_bounds, int64_t* min, int64_t* max);
+
     // use in JDBC transaction
     Status begin_trans() override; // should be call after connect and before query or init_to_write
     Status abort_trans() override; // should be call after transaction abort
@@ -144,6 +149,7 @@ private:
     jmethodID _executor_get_array_result;
     jmethodID _executor_get_hll_result;
     jmethodID _executor_get_types_id;
+    jmethodID _executor_get_split_bounds_id;
     jmethodID _executor_close_id;
     jmethodID _executor_get_list_id;
     jmethodID _get_bytes_id;
@@ -19,6 +19,7 @@
 
 #include <glog/logging.h>
 
+#include <algorithm>
 #include <cstddef>
 #include <cstdint>
 #include <memory>
@@ -30,6 +31,8 @@
 #include "common/object_pool.h"
 #include "runtime/runtime_state.h"
 #include "vec/common/hash_table/hash_set.h"
+#include "vec/core/sort_block.h"
+#include "vec/core/sort_description.h"
 #include "vec/exprs/vexpr.h"
 #include "vec/exprs/vexpr_context.h"
 
@@ -79,6 +82,7 @@ Status VPartitionSortNode::prepare(RuntimeState* state) {
     _get_sorted_timer = ADD_TIMER(runtime_profile(), "GetSortedTime");
     _selector_block_timer = ADD_TIMER(runtime_profile(), "SelectorBlockTime");
     _emplace_key_timer = ADD_TIMER(runtime_profile(), "EmplaceKeyTime");
+    _partition_compact_timer = ADD_TIMER(runtime_profile(), "PartitionCompactTime");
 
     RETURN_IF_ERROR(ExecNode::prepare(state));
     RETURN_IF_ERROR(_vsort_exec_exprs.prepare(state, child(0)->row_desc(), _row_descriptor));
@@ -96,15 +100,14 @@ Status VPartitionSortNode::_split_block_by_partition(vectorized::Block* input_bl
         DCHECK(result_column_id != -1);
         _partition_columns[i] = input_block->get_by_position(result_column_id).column.get();
     }
-    _emplace_into_hash_table(_partition_columns, input_block, batch_size);
-    return Status::OK();
+    return _emplace_into_hash_table(_partition_columns, input_block, batch_size);
 }
 
-void VPartitionSortNode::_emplace_into_hash_table(const ColumnRawPtrs& key_columns,
-                                                  const vectorized::Block* input_block,
-                                                  int batch_size) {
-    std::visit(
-            [&](auto&& agg_method) -> void {
+Status VPartitionSortNode::_emplace_into_hash_table(const ColumnRawPtrs& key_columns,
+                                                    const vectorized::Block* input_block,
+                                                    int batch_size) {
+    return std::visit(
+            [&](auto&& agg_method) -> Status {
                 SCOPED_TIMER(_build_timer);
                 using HashMethodType = std::decay_t<decltype(agg_method)>;
                 using HashTableType = std::decay_t<decltype(agg_method.data)>;
@@ -162,23 +165,100 @@ void VPartitionSortNode::_emplace_into_hash_table(const ColumnRawPtrs& key_colum
                     assert(aggregate_data != nullptr);
                     aggregate_data->add_row_idx(row);
                 }
+                bool can_compact = _can_compact_partition();
+                size_t compact_rows = _partition_compact_rows(batch_size);
                 for (auto place : _value_places) {
-                    SCOPED_TIMER(_selector_block_timer);
-                    place->append_block_by_selector(input_block, child(0)->row_desc(),
-                                                    _has_global_limit, _partition_inner_limit,
-                                                    batch_size);
+                    if (place->selector.empty()) {
+                        continue;
+                    }
+                    {
+                        SCOPED_TIMER(_selector_block_timer);
+                        place->append_block_by_selector(input_block, child(0)->row_desc(),
+                                                        _has_global_limit, _partition_inner_limit,
+                                                        batch_size);
+                    }
+                    if (can_compact && place->buffered_rows >= compact_rows) {
+                        RETURN_IF_ERROR(_compact_partition(place, batch_size));
+                    }
                 }
+                return Status::OK();
             },
             _partitioned_data->_partition_method_variant);
 }
 
+bool VPartitionSortNode::_can_compact_partition() const {
+    // The rows of dense_rank() are not bounded by the limit, the ties of distinct values are.
+    // The materialized sort tuple doesn't have the columns of the partition blocks.
+    return _partition_inner_limit > 0 && !_vsort_exec_exprs.need_materialize_tuple() &&
+           (_top_n_algorithm != TopNAlgorithm::DENSE_RANK || _has_global_limit);
+}
+
+size_t VPartitionSortNode::_partition_compact_rows(int batch_size) const {
+    // Sorting a partition every few rows of a small limit costs more than it saves.
+    return std::max<size_t>(2 * _partition_inner_limit, batch_size);
+}
+
+Status VPartitionSortNode::_compact_partition(PartitionBlocks* place, int batch_size) {
+    SCOPED_TIMER(_partition_compact_timer);
+    auto mutable_block = MutableBlock::build_mutable_block(place->blocks[0].get());
+    for (size_t i = 1; i < place->blocks.size(); ++i) {
+        RETURN_IF_ERROR(mutable_block.merge(*place->blocks[i]));
+    }
+    Block block = mutable_block.to_block();
+    const size_t num_columns = block.columns();
+
+    SortDescription sort_description(_vsort_exec_exprs.lhs_ordering_expr_ctxs().size());
+    for (int i = 0; i < sort_description.size(); i++) {
+        const auto& ordering_expr = _vsort_exec_exprs.lhs_ordering_expr_ctxs()[i];
+        RETURN_IF_ERROR(ordering_expr->execute(&block, &sort_description[i].column_number));
+        sort_description[i].direction = _is_asc_order[i] ? 1 : -1;
+        sort_description[i].nulls_direction =
+                _nulls_first[i] ? -sort_description[i].direction : sort_description[i].direction;
+    }
+
+    // rank() outputs the ties of the last row within the limit as well
+    bool keep_ties = _top_n_algorithm == TopNAlgorithm::RANK && !_has_global_limit;
+    sort_block(block, block, sort_description, keep_ties ? 0 : _partition_inner_limit);
+    size_t rows = std::min<size_t>(block.rows(), _partition_inner_limit);
+    if (keep_ties) {
+        auto is_tie = [&](size_t row) {
+            for (const auto& desc : sort_description) {
+                const auto& column = block.get_by_position(desc.column_number).column;
+                if (column->compare_at(row, row - 1, *column, desc.nulls_direction) != 0) {
+                    return false;
+                }
+            }
+            return true;
+        };
+        while (rows > 0 && rows < block.rows() && is_tie(rows)) {
+            rows++;
+        }
+    }
+    while (block.columns() > num_columns) {
+        block.erase(block.columns() - 1);
+    }
+    block.set_num_rows(rows);
+
+    place->blocks.clear();
+    place->blocks.push_back(Block::create_unique(std::move(block)));
+    place->buffered_rows = rows;
+    place->init_rows = batch_size - rows;
+    return Status::OK();
+}
+
 Status VPartitionSortNode::sink(RuntimeState* state, vectorized::Block* input_block, bool eos) {
     auto current_rows = input_block->rows();
     if (current_rows > 0) {
         child_input_rows = child_input_rows + current_rows;
         if (UNLIKELY(_partition_exprs_num == 0)) {
             //no partition key
-            _value_places[0]->append_whole_block(input_block, child(0)->row_desc());
+            auto* place = _value_places[0];
+            place->append_whole_block(input_block, child(0)->row_desc());
+            place->buffered_rows += current_rows;
+            if (_can_compact_partition() &&
+                place->buffered_rows >= _partition_compact_rows(state->batch_size())) {
+                RETURN_IF_ERROR(_compact_partition(place, state->batch_size()));
+            }
         } else {
             //just simply use partition num to check
             if (_num_partition > 512 && child_input_rows < 10000 * _num_partition) {
@@ -59,6 +59,7 @@ public:
         }
         init_rows = init_rows - selector.size();
         total_rows = total_rows + selector.size();
+        buffered_rows = buffered_rows + selector.size();
         selector.clear();
     }
 
@@ -77,6 +78,8 @@ public:
     IColumn::Selector selector;
     std::vector<std::unique_ptr<Block>> blocks;
     size_t total_rows = 0;
+    // the rows in blocks, which are cut to the top rows of the partition by compaction
+    size_t buffered_rows = 0;
     int init_rows = 4096;
 };
 
@@ -344,8 +347,15 @@ private:
 
     void _init_hash_method();
     Status _split_block_by_partition(vectorized::Block* input_block, int batch_size);
-    void _emplace_into_hash_table(const ColumnRawPtrs& key_columns,
-                                  const vectorized::Block* input_block, int batch_size);
+    Status _emplace_into_hash_table(const ColumnRawPtrs& key_columns,
+                                    const vectorized::Block* input_block, int batch_size);
+    // Whether the buffered rows of a partition can be cut to its top _partition_inner_limit
+    // rows, and the rows it buffers before that.
+    bool _can_compact_partition() const;
+    size_t _partition_compact_rows(int batch_size) const;
+    // Sorts the buffered rows of a partition and keeps the ones the sorter may output, so the
+    // memory of a partition is bounded by the limit rather than by its input rows.
+    Status _compact_partition(PartitionBlocks* place, int batch_size);
     Status get_sorted_block(RuntimeState* state, Block* output_block, bool* eos);
 
     // hash table
@@ -379,6 +389,7 @@ private:
     RuntimeProfile::Counter* _partition_sort_timer;
     RuntimeProfile::Counter* _get_sorted_timer;
     RuntimeProfile::Counter* _selector_block_timer;
+    RuntimeProfile::Counter* _partition_compact_timer;
 
     RuntimeProfile::Counter* _hash_table_size_counter;
     //only for profile record
@@ -19,7 +19,6 @@
 
 #include <gen_cpp/PlanNodes_types.h>
 #include <opentelemetry/nostd/shared_ptr.h>
-#include <string.h>
 
 #include <functional>
 #include <ostream>
@@ -37,7 +36,6 @@
 #include "vec/columns/column.h"
 #include "vec/columns/column_nullable.h"
 #include "vec/columns/column_vector.h"
-#include "vec/common/assert_cast.h"
 #include "vec/core/column_with_type_and_name.h"
 #include "vec/core/types.h"
 #include "vec/data_types/data_type.h"
@@ -102,55 +100,53 @@ Status VRepeatNode::get_repeated_block(Block* child_block, int repeat_id_idx, Bl
 
     size_t child_column_size = child_block->columns();
     size_t column_size = _output_slots.size();
-    bool mem_reuse = output_block->mem_reuse();
     DCHECK_LT(child_column_size, column_size);
-    std::vector<vectorized::MutableColumnPtr> columns(column_size);
-    for (size_t i = 0; i < column_size; i++) {
-        if (mem_reuse) {
-            columns[i] = std::move(*output_block->get_by_position(i).column).mutate();
-        } else {
-            columns[i] = _output_slots[i]->get_empty_mutable_column();
-        }
-    }
+    const auto rows = child_block->rows();
+    _null_columns.resize(child_column_size);
+    _nullable_columns.resize(child_column_size);
 
     /* Fill all slots according to child, for example:select tc1,tc2,sum(tc3) from t1 group by grouping sets((tc1),(tc2));
      * insert into t1 values(1,2,1),(1,3,1),(2,1,1),(3,1,1);
      * slot_id_set_list=[[0],[1]],repeat_id_idx=0,
      * child_block 1,2,1 | 1,3,1 | 2,1,1 | 3,1,1
      * output_block 1,null,1,1 | 1,null,1,1 | 2,nul,1,1 | 3,null,1,1
+     *
+     * The columns of the child block are shared by the output blocks rather than copied, only the
+     * all null columns and the null maps of the not nullable repeat slots are created, once for
+     * all the grouping sets.
      */
+    ColumnsWithTypeAndName columns;
+    columns.reserve(column_size);
     size_t cur_col = 0;
     for (size_t i = 0; i < child_column_size; i++) {
         const ColumnWithTypeAndName& src_column = child_block->get_by_position(i);
+        const auto* slot_desc = _output_slots[cur_col];
 
         std::set<SlotId>& repeat_ids = _slot_id_set_list[repeat_id_idx];
-        bool is_repeat_slot =
-                _all_slot_ids.find(_output_slots[cur_col]->id()) != _all_slot_ids.end();
-        bool is_set_null_slot = repeat_ids.find(_output_slots[cur_col]->id()) == repeat_ids.end();
-        const auto row_size = src_column.column->size();
+        bool is_repeat_slot = _all_slot_ids.find(slot_desc->id()) != _all_slot_ids.end();
+        bool is_set_null_slot = repeat_ids.find(slot_desc->id()) == repeat_ids.end();
 
+        ColumnPtr column = src_column.column;
         if (is_repeat_slot) {
-            DCHECK(_output_slots[cur_col]->is_nullable());
-            auto* nullable_column = reinterpret_cast<ColumnNullable*>(columns[cur_col].get());
-            auto& null_map = nullable_column->get_null_map_data();
-            auto* column_ptr = columns[cur_col].get();
-
+            DCHECK(slot_desc->is_nullable());
             // set slot null not in repeat_ids
             if (is_set_null_slot) {
-                nullable_column->resize(row_size);
-                memset(nullable_column->get_null_map_data().data(), 1, sizeof(UInt8) * row_size);
-            } else {
-                if (!src_column.type->is_nullable()) {
-                    for (size_t j = 0; j < row_size; ++j) {
-                        null_map.push_back(0);
-                    }
-                    column_ptr = &nullable_column->get_nested_column();
+                if (_null_columns[i] == nullptr) {
+                    auto null_column = slot_desc->get_empty_mutable_column();
+                    null_column->insert_many_defaults(rows);
+                    _null_columns[i] = std::move(null_column);
+                }
+                column = _null_columns[i];
+            } else if (!src_column.type->is_nullable()) {
+                if (_nullable_columns[i] == nullptr) {
+                    _nullable_columns[i] = ColumnNullable::create(
+                            src_column.column, ColumnUInt8::create(rows, 0));
                 }
-                column_ptr->insert_range_from(*src_column.column, 0, row_size);
+                column = _nullable_columns[i];
             }
-        } else {
-            columns[cur_col]->insert_range_from(*src_column.column, 0, row_size);
         }
+        columns.emplace_back(std::move(column), slot_desc->get_data_type_ptr(),
+                             slot_desc->col_name());
         cur_col++;
     }
 
@@ -161,29 +157,18 @@ Status VRepeatNode::get_repeated_block(Block* child_block, int repeat_id_idx, Bl
         DCHECK_EQ(_virtual_slot_desc->type().type, _output_slots[cur_col]->type().type);
         DCHECK_EQ(_virtual_slot_desc->col_name(), _output_slots[cur_col]->col_name());
         int64_t val = _grouping_list[slot_idx][repeat_id_idx];
-        auto* column_ptr = columns[cur_col].get();
         DCHECK(!_output_slots[cur_col]->is_nullable());
 
-        auto* col = assert_cast<ColumnVector<Int64>*>(column_ptr);
-        for (size_t i = 0; i < child_block->rows(); ++i) {
-            col->insert_value(val);
-        }
+        auto col = ColumnVector<Int64>::create(rows, val);
+        columns.emplace_back(std::move(col), _output_slots[cur_col]->get_data_type_ptr(),
+                             _output_slots[cur_col]->col_name());
         cur_col++;
     }
 
     DCHECK_EQ(cur_col, column_size);
 
-    if (!columns.empty() && !columns[0]->empty()) {
-        auto n_columns = 0;
-        if (!mem_reuse) {
-            for (const auto slot_desc : _output_slots) {
-                output_block->insert(ColumnWithTypeAndName(std::move(columns[n_columns++]),
-                                                           slot_desc->get_data_type_ptr(),
-                                                           slot_desc->col_name()));
-            }
-        } else {
-            columns.clear();
-        }
+    if (rows > 0) {
+        *output_block = Block(std::move(columns));
     }
     return Status::OK();
 }
@@ -205,6 +190,8 @@ Status VRepeatNode::pull(doris::RuntimeState* state, vectorized::Block* output_b
         int size = _repeat_id_list.size();
         if (_repeat_id_idx >= size) {
             _intermediate_block->clear();
+            _null_columns.clear();
+            _nullable_columns.clear();
             release_block_memory(_child_block);
             _repeat_id_idx = 0;
         }
@@ -223,6 +210,8 @@ Status VRepeatNode::push(RuntimeState* state, vectorized::Block* input_block, bo
 
     if (input_block->rows() > 0) {
         _intermediate_block = Block::create_unique();
+        _null_columns.clear();
+        _nullable_columns.clear();
 
         for (auto& expr : _expr_ctxs) {
             int result_column_id = -1;
@@ -76,6 +76,10 @@ private:
 
     Block _child_block;
     std::unique_ptr<Block> _intermediate_block {};
+    // The nullable repeat columns of _intermediate_block, all null or of its values, shared by
+    // the output blocks of all the grouping sets instead of copying the rows once per set.
+    std::vector<ColumnPtr> _null_columns;
+    std::vector<ColumnPtr> _nullable_columns;
 
     std::vector<SlotDescriptor*> _output_slots;
 
@@ -25,12 +25,15 @@
 
 #include <array>
 #include <atomic>
+#include <limits>
 #include <ostream>
 #include <string>
 #include <type_traits>
 #include <utility>
 
+#include "runtime/block_spill_manager.h"
 #include "runtime/define_primitive_type.h"
+#include "runtime/exec_env.h"
 #include "runtime/runtime_state.h"
 #include "util/defer_op.h"
 #include "util/telemetry/telemetry.h"
@@ -265,6 +268,19 @@ Status VSetOperationNode<is_intersect>::prepare(RuntimeState* state) {
     _probe_timer = ADD_TIMER(runtime_profile(), "ProbeTime");
     _pull_timer = ADD_TIMER(runtime_profile(), "PullTime");
 
+    _external_set_operation_bytes_threshold = state->external_set_operation_bytes_threshold();
+    if (_external_set_operation_bytes_threshold > 0) {
+        size_t spill_partition_count_bits = 4;
+        if (state->query_options().__isset.external_agg_partition_bits) {
+            spill_partition_count_bits = state->query_options().external_agg_partition_bits;
+        }
+        // skip the bits used by PartitionedHashTable to choose sub table.
+        _spill_partition_helper =
+                std::make_unique<SpillPartitionHelper>(spill_partition_count_bits, 4);
+        _spill_rows_counter = ADD_COUNTER(runtime_profile(), "SpillRows", TUnit::UNIT);
+        _spill_partition_timer = ADD_TIMER(runtime_profile(), "SpillPartitionTime");
+    }
+
     // Prepare result expr lists.
     vector<bool> nullable_flags;
     nullable_flags.resize(_child_expr_lists[0].size(), false);
@@ -379,6 +395,28 @@ void VSetOperationNode<is_intersect>::hash_table_init() {
 
 template <bool is_intersect>
 Status VSetOperationNode<is_intersect>::sink(RuntimeState* state, Block* block, bool eos) {
+    if (_spill_context.has_data) {
+        if (block->rows() != 0) {
+            RETURN_IF_ERROR(_spill_block(state, 0, *block));
+        }
+        if (eos) {
+            RETURN_IF_ERROR(_spill_context.close_writers(0));
+            _build_finished = true;
+        }
+        return Status::OK();
+    }
+
+    RETURN_IF_ERROR(_sink_build_block(state, block, eos));
+    if (!eos && _external_set_operation_bytes_threshold > 0 &&
+        _mem_used >= _external_set_operation_bytes_threshold) {
+        RETURN_IF_ERROR(_spill_build_side(state));
+    }
+    return Status::OK();
+}
+
+template <bool is_intersect>
+Status VSetOperationNode<is_intersect>::_sink_build_block(RuntimeState* state, Block* block,
+                                                          bool eos) {
     constexpr static auto BUILD_BLOCK_MAX_SIZE = 4 * 1024UL * 1024UL * 1024UL;
 
     if (block->rows() != 0) {
@@ -415,6 +453,15 @@ Status VSetOperationNode<is_intersect>::sink(RuntimeState* state, Block* block,
 template <bool is_intersect>
 Status VSetOperationNode<is_intersect>::pull(RuntimeState* state, Block* output_block, bool* eos) {
     SCOPED_TIMER(_pull_timer);
+    if (_spill_context.has_data) {
+        return _pull_with_spilled_data(state, output_block, eos);
+    }
+    return _pull_impl(state, output_block, eos);
+}
+
+template <bool is_intersect>
+Status VSetOperationNode<is_intersect>::_pull_impl(RuntimeState* state, Block* output_block,
+                                                   bool* eos) {
     create_mutable_cols(output_block);
     auto st = std::visit(
             [&](auto&& arg) -> Status {
@@ -513,26 +560,45 @@ Status VSetOperationNode<is_intersect>::sink_probe(RuntimeState* state, int chil
         CHECK(_probe_finished_children_index[child_id - 1])
                 << fmt::format("child with id: {} should be probed first", child_id);
     }
-    auto probe_rows = block->rows();
-    if (probe_rows > 0) {
-        RETURN_IF_ERROR(extract_probe_column(*block, _probe_columns, child_id));
-        RETURN_IF_ERROR(std::visit(
-                [&](auto&& arg) -> Status {
-                    using HashTableCtxType = std::decay_t<decltype(arg)>;
-                    if constexpr (!std::is_same_v<HashTableCtxType, std::monostate>) {
-                        HashTableProbe<HashTableCtxType, is_intersect> process_hashtable_ctx(
-                                this, probe_rows);
-                        return process_hashtable_ctx.mark_data_in_hashtable(arg);
-                    } else {
-                        LOG(FATAL) << "FATAL: uninited hash table";
-                    }
-                },
-                *_hash_table_variants));
+    if (_spill_context.has_data) {
+        if (block->rows() > 0) {
+            RETURN_IF_ERROR(_spill_block(state, child_id, *block));
+        }
+        if (eos) {
+            RETURN_IF_ERROR(_spill_context.close_writers(child_id));
+            if (child_id == (_children.size() - 1)) {
+                _can_read = true;
+            }
+            _probe_finished_children_index[child_id] = true;
+        }
+        return Status::OK();
     }
 
+    RETURN_IF_ERROR(_probe_hash_table(block, child_id));
     return eos ? finalize_probe(state, child_id) : Status::OK();
 }
 
+template <bool is_intersect>
+Status VSetOperationNode<is_intersect>::_probe_hash_table(Block* block, int child_id) {
+    auto probe_rows = block->rows();
+    if (probe_rows == 0) {
+        return Status::OK();
+    }
+    RETURN_IF_ERROR(extract_probe_column(*block, _probe_columns, child_id));
+    return std::visit(
+            [&](auto&& arg) -> Status {
+                using HashTableCtxType = std::decay_t<decltype(arg)>;
+                if constexpr (!std::is_same_v<HashTableCtxType, std::monostate>) {
+                    HashTableProbe<HashTableCtxType, is_intersect> process_hashtable_ctx(
+                            this, probe_rows);
+                    return process_hashtable_ctx.mark_data_in_hashtable(arg);
+                } else {
+                    LOG(FATAL) << "FATAL: uninited hash table";
+                }
+            },
+            *_hash_table_variants);
+}
+
 template <bool is_intersect>
 Status VSetOperationNode<is_intersect>::finalize_probe(RuntimeState* /*state*/, int child_id) {
     if (child_id != (_children.size() - 1)) {
@@ -770,6 +836,233 @@ Status VSetOperationNode<is_intersected>::get_data_in_hashtable(HashTableContext
     return Status::OK();
 }
 
+template <bool is_intersect>
+Status VSetOperationNode<is_intersect>::_spill_build_side(RuntimeState* state) {
+    DCHECK(!_spill_context.has_data);
+    _spill_context.has_data = true;
+    _spill_context.runtime_profile = runtime_profile()->create_child("Spill", true, true);
+    RETURN_IF_ERROR(_spill_context.init_writers(
+            _children.size(), _spill_partition_helper->partition_count, state->batch_size()));
+
+    const auto column_count = child(0)->row_desc().num_materialized_slots();
+    for (auto& build_block : _build_blocks) {
+        // remove the result columns appended by `extract_build_column`
+        build_block.erase_tail(column_count);
+        RETURN_IF_ERROR(_spill_block(state, 0, build_block));
+    }
+    if (_mutable_block.rows() > 0) {
+        auto block = _mutable_block.to_block();
+        RETURN_IF_ERROR(_spill_block(state, 0, block));
+    }
+    _reset_build_side();
+    return Status::OK();
+}
+
+template <bool is_intersect>
+Status VSetOperationNode<is_intersect>::_spill_block(RuntimeState* state, int child_id,
+                                                     Block& block) {
+    SCOPED_TIMER(_spill_partition_timer);
+    if (block.rows() == 0) {
+        return Status::OK();
+    }
+    COUNTER_UPDATE(_spill_rows_counter, block.rows());
+
+    vectorized::materialize_block_inplace(block);
+    std::vector<size_t> partition_indices;
+    RETURN_IF_ERROR(_get_spill_partition_indices(block, child_id, partition_indices));
+
+    std::vector<Block> partitioned_blocks;
+    _spill_partition_helper->split_block(block, partition_indices, partitioned_blocks);
+    auto& writers = _spill_context.writers[child_id];
+    for (size_t i = 0; i < partitioned_blocks.size(); ++i) {
+        if (partitioned_blocks[i].rows() > 0) {
+            RETURN_IF_ERROR(writers[i]->write(partitioned_blocks[i]));
+        }
+    }
+    return Status::OK();
+}
+
+template <bool is_intersect>
+Status VSetOperationNode<is_intersect>::_get_spill_partition_indices(
+        Block& block, int child_id, std::vector<size_t>& partition_indices) {
+    const auto rows = block.rows();
+    // evaluate the keys on a shallow copy, the result columns are not spilled.
+    Block evaluated_block = block;
+    ColumnRawPtrs raw_ptrs(_child_expr_lists[child_id].size());
+    if (child_id == 0) {
+        RETURN_IF_ERROR(extract_build_column(evaluated_block, raw_ptrs));
+    } else {
+        RETURN_IF_ERROR(extract_probe_column(evaluated_block, raw_ptrs, child_id));
+    }
+
+    partition_indices.resize(rows);
+    std::visit(
+            [&](auto&& arg) {
+                using HashTableCtxType = std::decay_t<decltype(arg)>;
+                if constexpr (!std::is_same_v<HashTableCtxType, std::monostate>) {
+                    using KeyGetter = typename HashTableCtxType::State;
+
+                    KeyGetter key_getter(raw_ptrs, child_id == 0 ? _build_key_sz : _probe_key_sz,
+                                         nullptr);
+                    Arena arena;
+                    std::vector<StringRef> serialized_keys;
+                    if constexpr (ColumnsHashing::IsPreSerializedKeysHashMethodTraits<
+                                          KeyGetter>::value) {
+                        serialized_keys.resize(rows);
+                        for (size_t i = 0; i < rows; ++i) {
+                            serialized_keys[i] = serialize_keys_to_pool_contiguous(
+                                    i, raw_ptrs.size(), raw_ptrs, arena);
+                        }
+                        key_getter.set_serialized_keys(serialized_keys.data());
+                    }
+
+                    for (size_t i = 0; i < rows; ++i) {
+                        size_t hash_value;
+                        if constexpr (ColumnsHashing::IsPreSerializedKeysHashMethodTraits<
+                                              KeyGetter>::value) {
+                            hash_value =
+                                    arg.hash_table.hash(key_getter.get_key_holder(i, arena).key);
+                        } else {
+                            hash_value = arg.hash_table.hash(key_getter.get_key_holder(i, arena));
+                        }
+                        partition_indices[i] = _spill_partition_helper->get_index(hash_value);
+                    }
+                } else {
+                    LOG(FATAL) << "FATAL: uninited hash table";
+                }
+            },
+            *_hash_table_variants);
+    return Status::OK();
+}
+
+template <bool is_intersect>
+void VSetOperationNode<is_intersect>::_reset_build_side() {
+    _build_blocks.clear();
+    _build_block_index = 0;
+    _mutable_block.clear();
+    _mem_used = 0;
+    _valid_element_in_hash_tbl = 0;
+    hash_table_init();
+    _arena = std::make_unique<Arena>();
+}
+
+template <bool is_intersect>
+Status VSetOperationNode<is_intersect>::_process_spilled_partition(RuntimeState* state) {
+    auto* manager = ExecEnv::GetInstance()->block_spill_mgr();
+    const auto partition = _spill_context.read_cursor;
+    _reset_build_side();
+
+    {
+        SCOPED_TIMER(_build_timer);
+        BlockSpillReaderUPtr reader;
+        RETURN_IF_ERROR(manager->get_reader(_spill_context.stream_ids[0][partition], reader,
+                                            _spill_context.runtime_profile, true));
+        bool eos = false;
+        while (!eos) {
+            RETURN_IF_CANCELLED(state);
+            Block block;
+            RETURN_IF_ERROR(reader->read(&block, &eos));
+            RETURN_IF_ERROR(_sink_build_block(state, &block, eos));
+        }
+        RETURN_IF_ERROR(reader->close());
+    }
+
+    SCOPED_TIMER(_probe_timer);
+    _probe_columns.resize(_child_expr_lists[1].size());
+    for (int child_id = 1; child_id < _children.size(); ++child_id) {
+        BlockSpillReaderUPtr reader;
+        RETURN_IF_ERROR(manager->get_reader(_spill_context.stream_ids[child_id][partition],
+                                            reader, _spill_context.runtime_profile, true));
+        bool eos = false;
+        while (!eos) {
+            RETURN_IF_CANCELLED(state);
+            Block block;
+            RETURN_IF_ERROR(reader->read(&block, &eos));
+            RETURN_IF_ERROR(_probe_hash_table(&block, child_id));
+        }
+        RETURN_IF_ERROR(reader->close());
+        RETURN_IF_ERROR(finalize_probe(state, child_id));
+    }
+    _spill_context.partition_loaded = true;
+    return Status::OK();
+}
+
+template <bool is_intersect>
+Status VSetOperationNode<is_intersect>::_pull_with_spilled_data(RuntimeState* state,
+                                                                Block* output_block, bool* eos) {
+    while (true) {
+        if (!_spill_context.partition_loaded) {
+            if (_spill_context.read_cursor == _spill_partition_helper->partition_count) {
+                *eos = true;
+                return Status::OK();
+            }
+            RETURN_IF_ERROR(_process_spilled_partition(state));
+        }
+
+        bool partition_eos = false;
+        RETURN_IF_ERROR(_pull_impl(state, output_block, &partition_eos));
+        if (reached_limit()) {
+            *eos = true;
+            return Status::OK();
+        }
+        if (partition_eos) {
+            _spill_context.partition_loaded = false;
+            _spill_context.read_cursor++;
+        }
+        if (output_block->rows() > 0) {
+            return Status::OK();
+        }
+    }
+}
+
+Status SetSpillContext::init_writers(size_t child_count, size_t partition_count,
+                                     int32_t batch_size) {
+    auto* manager = ExecEnv::GetInstance()->block_spill_mgr();
+    writers.resize(child_count);
+    stream_ids.resize(child_count);
+    for (size_t child_id = 0; child_id < child_count; ++child_id) {
+        // the first child of a partition is read back as a whole to build the hash table.
+        const int32_t writer_batch_size =
+                child_id == 0 ? std::numeric_limits<int32_t>::max() : batch_size;
+        writers[child_id].resize(partition_count);
+        for (size_t i = 0; i < partition_count; ++i) {
+            RETURN_IF_ERROR(manager->get_writer(writer_batch_size, writers[child_id][i],
+                                                runtime_profile));
+            stream_ids[child_id].emplace_back(writers[child_id][i]->get_id());
+        }
+    }
+    return Status::OK();
+}
+
+Status SetSpillContext::close_writers(int child_id) {
+    for (auto& writer : writers[child_id]) {
+        if (writer) {
+            RETURN_IF_ERROR(writer->close());
+            writer.reset();
+        }
+    }
+    return Status::OK();
+}
+
+SetSpillContext::~SetSpillContext() {
+    if (!has_data) {
+        return;
+    }
+    for (size_t child_id = 0; child_id < writers.size(); ++child_id) {
+        close_writers(child_id);
+    }
+
+    // delete the files of the partitions which are not output, e.g. the query is cancelled.
+    auto* manager = ExecEnv::GetInstance()->block_spill_mgr();
+    for (auto& child_stream_ids : stream_ids) {
+        for (size_t i = partition_loaded ? read_cursor + 1 : read_cursor;
+             i < child_stream_ids.size(); ++i) {
+            BlockSpillReaderUPtr reader;
+            manager->get_reader(child_stream_ids[i], reader, runtime_profile, true);
+        }
+    }
+}
+
 template class VSetOperationNode<true>;
 template class VSetOperationNode<false>;
 
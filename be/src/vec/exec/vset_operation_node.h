@@ -36,6 +36,9 @@
 #include "vec/common/hash_table/hash_map.h"
 #include "vec/common/string_ref.h"
 #include "vec/core/block.h"
+#include "vec/core/block_spill_reader.h"
+#include "vec/core/block_spill_writer.h"
+#include "vec/core/spill_partition_helper.h"
 #include "vec/exec/join/process_hash_table_probe.h"
 #include "vec/exec/join/vhash_join_node.h"
 
@@ -49,6 +52,32 @@ namespace vectorized {
 class VExprContext;
 struct RowRefListWithFlags;
 
+// State of the spilled set operation.
+//
+// Once the hash table built from the first child takes more memory than
+// `external_set_operation_bytes_threshold`, the rows of every child are hash partitioned into
+// one spill stream per child and partition, and the partitions are processed one by one after
+// the last child reaches eos.
+struct SetSpillContext {
+    bool has_data = false;
+
+    RuntimeProfile* runtime_profile = nullptr;
+
+    /// writers[child_id][partition]
+    std::vector<std::vector<BlockSpillWriterUPtr>> writers;
+    std::vector<std::vector<int64_t>> stream_ids;
+
+    /// the partition being output
+    size_t read_cursor = 0;
+    bool partition_loaded = false;
+
+    Status init_writers(size_t child_count, size_t partition_count, int32_t batch_size);
+
+    Status close_writers(int child_id);
+
+    ~SetSpillContext();
+};
+
 template <bool is_intersect>
 class VSetOperationNode final : public ExecNode {
 public:
@@ -93,6 +122,20 @@ private:
     void create_mutable_cols(Block* output_block);
     void release_mem();
 
+    Status _sink_build_block(RuntimeState* state, Block* block, bool eos);
+    Status _probe_hash_table(Block* block, int child_id);
+    Status _pull_impl(RuntimeState* state, Block* output_block, bool* eos);
+
+    // Spill the build side which has been received and switch to spilled mode.
+    Status _spill_build_side(RuntimeState* state);
+    Status _spill_block(RuntimeState* state, int child_id, Block& block);
+    Status _get_spill_partition_indices(Block& block, int child_id,
+                                        std::vector<size_t>& partition_indices);
+    void _reset_build_side();
+    // Build the hash table of the next spilled partition and probe it with all the other children.
+    Status _process_spilled_partition(RuntimeState* state);
+    Status _pull_with_spilled_data(RuntimeState* state, Block* output_block, bool* eos);
+
     std::unique_ptr<HashTableVariants> _hash_table_variants;
 
     std::vector<size_t> _probe_key_sz;
@@ -127,6 +170,13 @@ private:
     RuntimeProfile::Counter* _probe_timer; // time to probe
     RuntimeProfile::Counter* _pull_timer;  // time to pull data
 
+    // 0 means the build side is never spilled
+    int64_t _external_set_operation_bytes_threshold = 0;
+    std::unique_ptr<SpillPartitionHelper> _spill_partition_helper;
+    SetSpillContext _spill_context;
+    RuntimeProfile::Counter* _spill_rows_counter = nullptr;
+    RuntimeProfile::Counter* _spill_partition_timer = nullptr;
+
     template <class HashTableContext, bool is_intersected>
     friend struct HashTableBuild;
     template <class HashTableContext, bool is_intersected>
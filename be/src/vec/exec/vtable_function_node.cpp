@@ -29,6 +29,7 @@
 #include <string>
 #include <utility>
 
+#include "vec/columns/column_nullable.h"
 #include "vec/exprs/table_function/table_function.h"
 #include "vec/exprs/table_function/table_function_factory.h"
 #include "vec/exprs/vexpr.h"
@@ -183,7 +184,10 @@ Status VTableFunctionNode::_get_expanded_block(RuntimeState* state, Block* outpu
         while (columns[_child_slots.size()]->size() < state->batch_size()) {
             int idx = _find_last_fn_eos_idx();
             if (idx == 0 || skip_child_row) {
-                _copy_output_slots(columns);
+                _copy_output_slots();
+                if (_cur_child_offset + 1 >= _child_block.rows()) {
+                    _replicate_output_slots(columns);
+                }
                 // all table functions' results are exhausted, process next child row.
                 RETURN_IF_ERROR(_process_next_child_row());
                 if (_cur_child_offset == -1) {
@@ -215,7 +219,8 @@ Status VTableFunctionNode::_get_expanded_block(RuntimeState* state, Block* outpu
         }
     }
 
-    _copy_output_slots(columns);
+    _copy_output_slots();
+    _replicate_output_slots(columns);
 
     size_t row_size = columns[_child_slots.size()]->size();
     for (auto index : _useless_slot_indexs) {
@@ -242,6 +247,43 @@ Status VTableFunctionNode::_get_expanded_block(RuntimeState* state, Block* outpu
     return Status::OK();
 }
 
+// The columns ColumnString, ColumnVector and ColumnDecimal, nullable or not, append the rows
+// replicated to the result column. A const column would make the result one too.
+static bool can_replicate(const IColumn& column) {
+    if (is_column_const(column)) {
+        return false;
+    }
+    if (const auto* nullable = check_and_get_column<ColumnNullable>(column)) {
+        return can_replicate(nullable->get_nested_column());
+    }
+    return column.is_numeric() || column.is_column_decimal() || column.is_column_string();
+}
+
+void VTableFunctionNode::_replicate_output_slots(std::vector<MutableColumnPtr>& columns) {
+    if (_replicate_begin == -1) {
+        return;
+    }
+    const uint32_t* counts = _replicate_counts.data();
+    for (auto index : _output_slot_indexs) {
+        const auto& src_column = _child_block.get_by_position(index).column;
+        if (can_replicate(*src_column)) {
+            src_column->replicate(counts, _replicate_rows, *columns[index], _replicate_begin,
+                                  _replicate_end - _replicate_begin);
+            continue;
+        }
+        for (int64_t row = _replicate_begin; row < _replicate_end; ++row) {
+            if (counts[row]) {
+                columns[index]->insert_many_from(*src_column, row, counts[row]);
+            }
+        }
+    }
+    std::fill(_replicate_counts.begin() + _replicate_begin,
+              _replicate_counts.begin() + _replicate_end, 0);
+    _replicate_begin = -1;
+    _replicate_end = -1;
+    _replicate_rows = 0;
+}
+
 Status VTableFunctionNode::_process_next_child_row() {
     _cur_child_offset++;
 
@@ -126,19 +126,34 @@ private:
 
     Status _get_expanded_block(RuntimeState* state, Block* output_block, bool* eos);
 
-    void _copy_output_slots(std::vector<MutableColumnPtr>& columns) {
+    // Counts the output rows of the current child row, the output slots of all the child rows
+    // counted are copied at once by _replicate_output_slots().
+    void _copy_output_slots() {
         if (!_current_row_insert_times) {
             return;
         }
-        for (auto index : _output_slot_indexs) {
-            auto src_column = _child_block.get_by_position(index).column;
-            columns[index]->insert_many_from(*src_column, _cur_child_offset,
-                                             _current_row_insert_times);
+        if (_replicate_counts.size() < _child_block.rows()) {
+            _replicate_counts.resize(_child_block.rows(), 0);
         }
+        if (_replicate_begin == -1) {
+            _replicate_begin = _cur_child_offset;
+        }
+        _replicate_counts[_cur_child_offset] += _current_row_insert_times;
+        _replicate_end = _cur_child_offset + 1;
+        _replicate_rows += _current_row_insert_times;
         _current_row_insert_times = 0;
     }
+    // Copies the output slots of the child rows [_replicate_begin, _replicate_end) by one
+    // replicate() of each column, has to be called before _child_block is released.
+    void _replicate_output_slots(std::vector<MutableColumnPtr>& columns);
     int _current_row_insert_times = 0;
 
+    // The times to copy each row of _child_block, zero out of [_replicate_begin, _replicate_end).
+    std::vector<uint32_t> _replicate_counts;
+    int64_t _replicate_begin = -1;
+    int64_t _replicate_end = -1;
+    size_t _replicate_rows = 0;
+
     Block _child_block;
     std::vector<SlotDescriptor*> _child_slots;
     std::vector<SlotDescriptor*> _output_slots;
@@ -0,0 +1,92 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <stdint.h>
+
+#include <algorithm>
+#include <numeric>
+#include <vector>
+
+namespace doris::vectorized {
+
+// The measured selectivity and cost of a conjunct of an AND chain. The conjuncts are ordered
+// by rank = (1 - selectivity) / cost, i.e. the one filtering the most rows per ns goes first,
+// since planner stats are often wrong, e.g. for semi-structured data.
+struct ConjunctStats {
+    // rows surviving the previous conjuncts, and the ones surviving this conjunct too
+    int64_t input_rows = 0;
+    int64_t output_rows = 0;
+    // rows the conjunct executed on and the time it took
+    int64_t executed_rows = 0;
+    int64_t exec_ns = 0;
+
+    void update(int64_t input, int64_t output, int64_t executed, int64_t ns) {
+        input_rows += input;
+        output_rows += output;
+        executed_rows += executed;
+        exec_ns += ns;
+    }
+
+    bool has_samples() const { return input_rows > 0 && executed_rows > 0; }
+
+    double rank() const {
+        double selectivity = static_cast<double>(output_rows) / input_rows;
+        // plus one to avoid dividing by zero for the too cheap ones
+        double cost = static_cast<double>(exec_ns + 1) / executed_rows;
+        return (1 - selectivity) / cost;
+    }
+
+    // Halve the history after reordering so the order follows the changes of the data.
+    void decay() {
+        input_rows /= 2;
+        output_rows /= 2;
+        executed_rows /= 2;
+        exec_ns /= 2;
+    }
+};
+
+// Stably sort the conjuncts by the rank of their stats, get_stats(conjunct) returns the
+// ConjunctStats of a conjunct. Nothing is reordered until all conjuncts have samples.
+template <typename T, typename GetStats>
+void reorder_conjuncts_by_rank(std::vector<T>* conjuncts, GetStats get_stats) {
+    std::vector<double> ranks;
+    ranks.reserve(conjuncts->size());
+    for (auto& conjunct : *conjuncts) {
+        const ConjunctStats& stats = get_stats(conjunct);
+        if (!stats.has_samples()) {
+            return;
+        }
+        ranks.push_back(stats.rank());
+    }
+    std::vector<size_t> order(conjuncts->size());
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(), order.end(),
+                     [&ranks](size_t lhs, size_t rhs) { return ranks[lhs] > ranks[rhs]; });
+    std::vector<T> sorted;
+    sorted.reserve(conjuncts->size());
+    for (auto i : order) {
+        sorted.push_back(std::move((*conjuncts)[i]));
+    }
+    conjuncts->swap(sorted);
+    for (auto& conjunct : *conjuncts) {
+        get_stats(conjunct).decay();
+    }
+}
+
+} // namespace doris::vectorized
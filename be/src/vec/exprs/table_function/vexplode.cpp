@@ -19,11 +19,15 @@
 
 #include <glog/logging.h>
 
+#include <algorithm>
 #include <ostream>
+#include <typeinfo>
 #include <vector>
 
 #include "common/status.h"
 #include "vec/columns/column.h"
+#include "vec/columns/column_nullable.h"
+#include "vec/common/assert_cast.h"
 #include "vec/common/string_ref.h"
 #include "vec/core/block.h"
 #include "vec/core/column_with_type_and_name.h"
@@ -84,4 +88,40 @@ void VExplodeTableFunction::get_value(MutableColumnPtr& column) {
     }
 }
 
+int VExplodeTableFunction::get_value(MutableColumnPtr& column, int max_step) {
+    max_step = std::min(max_step, (int)(_cur_size - _cur_offset));
+    if (current_empty() || max_step <= 0) {
+        return TableFunction::get_value(column, max_step);
+    }
+
+    ColumnNullable* nullable = nullptr;
+    IColumn* data_column = column.get();
+    if (column->is_nullable()) {
+        nullable = assert_cast<ColumnNullable*>(column.get());
+        data_column = &nullable->get_nested_column();
+    }
+    // the elements are copied by insert_data otherwise, and a non nullable column can not get
+    // the nulls of the elements by a range copy
+    const IColumn& nested = *_detail.nested_col;
+    if (typeid(*data_column) != typeid(nested) ||
+        !(nested.is_numeric() || nested.is_column_decimal() || nested.is_column_string()) ||
+        (nullable == nullptr && _detail.nested_nullmap_data)) {
+        return TableFunction::get_value(column, max_step);
+    }
+
+    size_t pos = _array_offset + _cur_offset;
+    data_column->insert_range_from(nested, pos, max_step);
+    if (nullable != nullptr) {
+        auto& null_map = nullable->get_null_map_data();
+        if (_detail.nested_nullmap_data) {
+            null_map.insert(_detail.nested_nullmap_data + pos,
+                            _detail.nested_nullmap_data + pos + max_step);
+        } else {
+            null_map.resize_fill(null_map.size() + max_step, 0);
+        }
+    }
+    forward(max_step);
+    return max_step;
+}
+
 } // namespace doris::vectorized
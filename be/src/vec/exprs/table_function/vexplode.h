@@ -44,6 +44,8 @@ public:
     Status process_row(size_t row_idx) override;
     Status process_close() override;
     void get_value(MutableColumnPtr& column) override;
+    // Copies the elements of the current array by one insert_range_from of the nested column.
+    int get_value(MutableColumnPtr& column, int max_step) override;
 
 private:
     ColumnPtr _array_column;
@@ -0,0 +1,202 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "vec/exprs/vcompound_pred.h"
+
+#include <hs/hs_compile.h>
+#include <hs/hs_runtime.h>
+
+#include <typeinfo>
+
+#include "common/config.h"
+#include "vec/columns/column_nullable.h"
+#include "vec/columns/column_string.h"
+#include "vec/data_types/data_type_nullable.h"
+#include "vec/exprs/vexpr_context.h"
+#include "vec/exprs/vliteral.h"
+#include "vec/exprs/vslot_ref.h"
+#include "vec/functions/like.h"
+#include "vec/functions/regexps.h"
+
+namespace doris::vectorized {
+
+Status VCompoundPred::prepare(RuntimeState* state, const RowDescriptor& desc,
+                              VExprContext* context) {
+    RETURN_IF_ERROR(VectorizedFnCall::prepare(state, desc, context));
+    if (_op == TExprOpcode::COMPOUND_OR && config::enable_multi_pattern_like &&
+        _multi_patterns == nullptr) {
+        RETURN_IF_ERROR(_prepare_multi_patterns());
+    }
+    return Status::OK();
+}
+
+Status VCompoundPred::open(RuntimeState* state, VExprContext* context,
+                           FunctionContext::FunctionStateScope scope) {
+    RETURN_IF_ERROR(VectorizedFnCall::open(state, context, scope));
+    if (_multi_patterns != nullptr) {
+        // the scratch space is not thread safe, every context has its own copy
+        hs_scratch_t* scratch = nullptr;
+        if (hs_clone_scratch(_multi_patterns->getScratch(), &scratch) != HS_SUCCESS) {
+            return Status::InternalError("failed to clone hyperscan scratch space");
+        }
+        context->fn_context(_fn_context_index)
+                ->set_function_state(FunctionContext::THREAD_LOCAL,
+                                     std::shared_ptr<hs_scratch_t>(scratch, hs_free_scratch));
+    }
+    return Status::OK();
+}
+
+void VCompoundPred::_collect_or_leaves(VExprSPtrs* leaves) const {
+    for (const auto& child : _children) {
+        if (typeid(*child) == typeid(VCompoundPred) &&
+            static_cast<const VCompoundPred&>(*child)._op == TExprOpcode::COMPOUND_OR) {
+            static_cast<const VCompoundPred&>(*child)._collect_or_leaves(leaves);
+        } else {
+            leaves->push_back(child);
+        }
+    }
+}
+
+Status VCompoundPred::_prepare_multi_patterns() {
+    VExprSPtrs leaves;
+    _collect_or_leaves(&leaves);
+    if (leaves.size() < 2) {
+        return Status::OK();
+    }
+
+    int slot_id = -1;
+    std::vector<std::string> patterns;
+    for (const auto& leaf : leaves) {
+        if (typeid(*leaf) != typeid(VectorizedFnCall) || leaf->children().size() != 2) {
+            return Status::OK();
+        }
+        const auto& name = static_cast<const VectorizedFnCall&>(*leaf).function_name();
+        bool is_like = name == "like";
+        if (!is_like && name != "regexp" && name != "rlike") {
+            return Status::OK();
+        }
+        const auto& slot = leaf->children()[0];
+        const auto& literal = leaf->children()[1];
+        if (typeid(*slot) != typeid(VSlotRef) ||
+            remove_nullable(slot->data_type())->get_type_id() != TypeIndex::String ||
+            typeid(*literal) != typeid(VLiteral) ||
+            literal->data_type()->get_type_id() != TypeIndex::String) {
+            return Status::OK();
+        }
+        int leaf_slot_id = static_cast<const VSlotRef&>(*slot).slot_id();
+        if (slot_id != -1 && leaf_slot_id != slot_id) {
+            return Status::OK();
+        }
+        slot_id = leaf_slot_id;
+        // the rows of a null slot are null, so the result is not nullable without a null slot
+        if (slot->data_type()->is_nullable() && !_data_type->is_nullable()) {
+            return Status::OK();
+        }
+
+        std::string pattern =
+                static_cast<const VLiteral&>(*literal).get_column_ptr()->get_data_at(0).to_string();
+        if (is_like) {
+            LikeSearchState like_state;
+            std::string re_pattern;
+            FunctionLike::convert_like_pattern(&like_state, pattern, &re_pattern);
+            patterns.push_back(std::move(re_pattern));
+        } else {
+            patterns.push_back(std::move(pattern));
+        }
+        if (_multi_pattern_slot == nullptr) {
+            _multi_pattern_slot = slot;
+        }
+    }
+
+    std::vector<const char*> expressions;
+    std::vector<unsigned int> flags;
+    for (const auto& pattern : patterns) {
+        expressions.push_back(pattern.c_str());
+        flags.push_back(HS_FLAG_DOTALL | HS_FLAG_ALLOWEMPTY | HS_FLAG_UTF8 | HS_FLAG_SINGLEMATCH);
+    }
+    hs_database_t* database = nullptr;
+    hs_compile_error_t* compile_err = nullptr;
+    if (hs_compile_multi(expressions.data(), flags.data(), nullptr, expressions.size(),
+                         HS_MODE_BLOCK, nullptr, &database, &compile_err) != HS_SUCCESS) {
+        // e.g. a regex not supported by hyperscan, every pattern is matched by itself
+        VLOG_DEBUG << "failed to compile the patterns of " << debug_string() << ": "
+                   << compile_err->message;
+        hs_free_compile_error(compile_err);
+        _multi_pattern_slot = nullptr;
+        return Status::OK();
+    }
+    hs_scratch_t* scratch = nullptr;
+    if (hs_alloc_scratch(database, &scratch) != HS_SUCCESS) {
+        hs_free_database(database);
+        _multi_pattern_slot = nullptr;
+        return Status::OK();
+    }
+    _multi_patterns = std::make_shared<multiregexps::Regexps>(database, scratch);
+    return Status::OK();
+}
+
+Status VCompoundPred::_execute_multi_patterns(VExprContext* context, vectorized::Block* block,
+                                              int* result_column_id) {
+    auto* scratch = reinterpret_cast<hs_scratch_t*>(
+            context->fn_context(_fn_context_index)
+                    ->get_function_state(FunctionContext::THREAD_LOCAL));
+    DCHECK(scratch != nullptr);
+
+    int slot_column_id = -1;
+    RETURN_IF_ERROR(_multi_pattern_slot->execute(context, block, &slot_column_id));
+    ColumnPtr column =
+            block->get_by_position(slot_column_id).column->convert_to_full_column_if_const();
+    const size_t rows = column->size();
+    const ColumnNullable* nullable_column = check_and_get_column<ColumnNullable>(*column);
+    const NullMap* null_map = nullptr;
+    const ColumnString* strings = nullptr;
+    if (nullable_column != nullptr) {
+        null_map = &nullable_column->get_null_map_data();
+        strings = &assert_cast<const ColumnString&>(nullable_column->get_nested_column());
+    } else {
+        strings = &assert_cast<const ColumnString&>(*column);
+    }
+
+    auto res = ColumnUInt8::create(rows, 0);
+    auto& res_data = res->get_data();
+    hs_database_t* database = _multi_patterns->getDB();
+    for (size_t i = 0; i < rows; ++i) {
+        if (null_map != nullptr && (*null_map)[i]) {
+            continue;
+        }
+        StringRef value = strings->get_data_at(i);
+        auto ret = hs_scan(database, value.data, value.size, 0, scratch,
+                           LikeSearchState::hs_match_handler, res_data.data() + i);
+        if (ret != HS_SUCCESS && ret != HS_SCAN_TERMINATED) {
+            return Status::RuntimeError("hyperscan error: {}", ret);
+        }
+    }
+
+    ColumnPtr result = std::move(res);
+    if (_data_type->is_nullable()) {
+        if (nullable_column != nullptr) {
+            result = ColumnNullable::create(result, nullable_column->get_null_map_column_ptr());
+        } else {
+            result = ColumnNullable::create(result, ColumnUInt8::create(rows, 0));
+        }
+    }
+    block->insert({result, _data_type, _expr_name});
+    *result_column_id = block->columns() - 1;
+    return Status::OK();
+}
+
+} // namespace doris::vectorized
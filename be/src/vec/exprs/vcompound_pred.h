@@ -28,6 +28,10 @@
 
 namespace doris::vectorized {
 
+namespace multiregexps {
+class Regexps;
+} // namespace multiregexps
+
 inline std::string compound_operator_to_string(TExprOpcode::type op) {
     if (op == TExprOpcode::COMPOUND_AND) {
         return "and";
@@ -52,8 +56,16 @@ public:
 
     const std::string& expr_name() const override { return _expr_name; }
 
+    Status prepare(RuntimeState* state, const RowDescriptor& desc, VExprContext* context) override;
+
+    Status open(RuntimeState* state, VExprContext* context,
+                FunctionContext::FunctionStateScope scope) override;
+
     Status execute(VExprContext* context, vectorized::Block* block,
                    int* result_column_id) override {
+        if (_multi_patterns != nullptr) {
+            return _execute_multi_patterns(context, block, result_column_id);
+        }
         if (children().size() == 1 || !_all_child_is_compound_and_not_const() ||
             _children[0]->is_nullable() || _children[1]->is_nullable()) {
             // TODO:
@@ -158,6 +170,16 @@ public:
     bool is_compound_predicate() const override { return true; }
 
 private:
+    // Compile an OR chain of LIKE and REGEXP with constant patterns on the same string slot,
+    // e.g. msg LIKE '%timeout%' OR msg LIKE '%refused%', into one hyperscan database, so a
+    // string is scanned once for all the patterns instead of once per pattern.
+    Status _prepare_multi_patterns();
+
+    void _collect_or_leaves(VExprSPtrs* leaves) const;
+
+    Status _execute_multi_patterns(VExprContext* context, vectorized::Block* block,
+                                   int* result_column_id);
+
     bool _all_child_is_compound_and_not_const() const {
         for (auto child : _children) {
             // we can make sure non const compound predicate's return column is allow modifyied locally.
@@ -197,5 +219,9 @@ private:
     TExprOpcode::type _op;
 
     std::string _expr_name;
+
+    // the compiled patterns and the slot they match, set if the OR chain is compiled
+    std::shared_ptr<multiregexps::Regexps> _multi_patterns;
+    VExprSPtr _multi_pattern_slot;
 };
 } // namespace doris::vectorized
@@ -86,6 +86,11 @@ public:
     Status streaming_agg_serialize_to_column(Block* block, MutableColumnPtr& dst,
                                              const size_t num_rows, Arena* arena);
 
+    // evaluate the argument columns of the block, for the callers which add the batch
+    // into the states by themselves, e.g. the fused aggregate kernels
+    Status calc_argument_columns(Block* block) { return _calc_argment_columns(block); }
+    const IColumn** argument_columns() { return _agg_columns.data(); }
+
     void insert_result_info(AggregateDataPtr place, IColumn* column);
 
     void insert_result_info_vec(const std::vector<AggregateDataPtr>& place, size_t offset,
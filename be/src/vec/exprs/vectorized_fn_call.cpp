@@ -25,6 +25,7 @@
 #include <memory>
 #include <ostream>
 #include <string_view>
+#include <unordered_set>
 #include <utility>
 
 #include "common/config.h"
@@ -42,6 +43,7 @@
 #include "vec/exprs/vexpr_context.h"
 #include "vec/functions/function_agg_state.h"
 #include "vec/functions/function_java_udf.h"
+#include "vec/functions/function_native_udf.h"
 #include "vec/functions/function_rpc.h"
 #include "vec/functions/simple_function_factory.h"
 #include "vec/utils/util.hpp"
@@ -79,6 +81,8 @@ Status VectorizedFnCall::prepare(RuntimeState* state, const RowDescriptor& desc,
                     "Java UDF is not enabled, you can change be config enable_java_support to true "
                     "and restart be.");
         }
+    } else if (_fn.binary_type == TFunctionBinaryType::NATIVE) {
+        _function = NativeFunctionCall::create(_fn, argument_template, _data_type);
     } else if (_fn.binary_type == TFunctionBinaryType::AGG_STATE) {
         DataTypes argument_types;
         for (auto column : argument_template) {
@@ -137,6 +141,20 @@ void VectorizedFnCall::close(VExprContext* context, FunctionContext::FunctionSta
 
 Status VectorizedFnCall::execute(VExprContext* context, vectorized::Block* block,
                                  int* result_column_id) {
+    if (_common_result != nullptr && _common_result->column_id >= 0) {
+        DCHECK_LT(_common_result->column_id, block->columns());
+        *result_column_id = _common_result->column_id;
+        return Status::OK();
+    }
+    RETURN_IF_ERROR(_do_execute(context, block, result_column_id));
+    if (_common_result != nullptr) {
+        _common_result->column_id = *result_column_id;
+    }
+    return Status::OK();
+}
+
+Status VectorizedFnCall::_do_execute(VExprContext* context, vectorized::Block* block,
+                                     int* result_column_id) {
     // TODO: not execute const expr again, but use the const column in function context
     vectorized::ColumnNumbers arguments(_children.size());
     for (int i = 0; i < _children.size(); ++i) {
@@ -197,6 +215,12 @@ const std::string& VectorizedFnCall::expr_name() const {
     return _expr_name;
 }
 
+bool VectorizedFnCall::is_deterministic() const {
+    static const std::unordered_set<std::string> NON_DETERMINISTIC_FUNCTIONS = {
+            "rand", "random", "uuid", "uuid_numeric", "sleep"};
+    return _function->is_deterministic() && !NON_DETERMINISTIC_FUNCTIONS.contains(_function_name);
+}
+
 std::string VectorizedFnCall::debug_string() const {
     std::stringstream out;
     out << "VectorizedFn[";
@@ -64,10 +64,23 @@ public:
     bool fast_execute(FunctionContext* context, Block& block, const ColumnNumbers& arguments,
                       size_t result, size_t input_rows_count);
 
+    const std::string& function_name() const { return _function_name; }
+
+    // the functions returning a different value each call, e.g. rand(), are not shared
+    bool is_deterministic() const;
+
+    void set_common_result(std::shared_ptr<VExprCommonResult> result) {
+        _common_result = std::move(result);
+    }
+
 private:
+    Status _do_execute(VExprContext* context, Block* block, int* result_column_id);
+
     FunctionBasePtr _function;
     bool _can_fast_execute = false;
     std::string _expr_name;
     std::string _function_name;
+    // not null if the result is shared with the equal function calls
+    std::shared_ptr<VExprCommonResult> _common_result;
 };
 } // namespace doris::vectorized
@@ -17,6 +17,7 @@
 
 #include "vec/exprs/vexpr.h"
 
+#include <fmt/format.h>
 #include <gen_cpp/Exprs_types.h>
 #include <thrift/protocol/TDebugProtocol.h>
 
@@ -24,6 +25,8 @@
 #include <boost/iterator/iterator_facade.hpp>
 #include <memory>
 #include <stack>
+#include <typeinfo>
+#include <unordered_map>
 
 #include "common/config.h"
 #include "common/exception.h"
@@ -374,6 +377,65 @@ bool VExpr::is_constant() const {
     return true;
 }
 
+// Return the key of the subtree, which is equal for the subtrees computing the same result, or
+// empty if the subtree can not be shared. The function calls are collected by their keys.
+static std::string common_subexpr_key(
+        const VExprSPtr& expr, bool* has_slot,
+        std::unordered_map<std::string, std::vector<VectorizedFnCall*>>* fn_calls) {
+    if (typeid(*expr) == typeid(VSlotRef)) {
+        *has_slot = true;
+        return fmt::format("slot({})", static_cast<const VSlotRef*>(expr.get())->slot_id());
+    }
+    if (typeid(*expr) == typeid(VLiteral)) {
+        return fmt::format("literal({}, {})", expr->data_type()->get_name(),
+                           static_cast<const VLiteral*>(expr.get())->value());
+    }
+    bool is_fn_call = typeid(*expr) == typeid(VectorizedFnCall);
+    if (is_fn_call && !static_cast<const VectorizedFnCall*>(expr.get())->is_deterministic()) {
+        return "";
+    }
+    if (!is_fn_call && typeid(*expr) != typeid(VCastExpr)) {
+        return "";
+    }
+    std::string key = is_fn_call ? static_cast<const VectorizedFnCall*>(expr.get())->function_name()
+                                 : "cast";
+    key += "(";
+    bool has_child_slot = false;
+    for (const auto& child : expr->children()) {
+        std::string child_key = common_subexpr_key(child, &has_child_slot, fn_calls);
+        if (child_key.empty()) {
+            return "";
+        }
+        key += child_key + ", ";
+    }
+    key += expr->data_type()->get_name() + ")";
+    *has_slot |= has_child_slot;
+    // the constant subtrees are executed on the temporary blocks by get_const_col
+    if (is_fn_call && has_child_slot) {
+        (*fn_calls)[key].push_back(static_cast<VectorizedFnCall*>(expr.get()));
+    }
+    return key;
+}
+
+void VExpr::eliminate_common_subexprs(const VExprContextSPtrs& ctxs,
+                                      VExprCommonResults* results) {
+    std::unordered_map<std::string, std::vector<VectorizedFnCall*>> fn_calls;
+    for (const auto& ctx : ctxs) {
+        bool has_slot = false;
+        common_subexpr_key(ctx->root(), &has_slot, &fn_calls);
+    }
+    for (auto& [key, exprs] : fn_calls) {
+        if (exprs.size() < 2) {
+            continue;
+        }
+        auto result = std::make_shared<VExprCommonResult>();
+        for (auto* expr : exprs) {
+            expr->set_common_result(result);
+        }
+        results->push_back(std::move(result));
+    }
+}
+
 Status VExpr::get_const_col(VExprContext* context,
                             std::shared_ptr<ColumnPtrWrapper>* column_wrapper) {
     if (!is_constant()) {
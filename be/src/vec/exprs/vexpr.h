@@ -60,6 +60,12 @@ namespace vectorized {
         RETURN_IF_ERROR(stmt);            \
     }
 
+// The result column of the equal subtrees in the exprs of a node. The first one executed on a
+// block saves its result column in the block, and the others reuse the column.
+struct VExprCommonResult {
+    int column_id = -1;
+};
+
 // VExpr should be used as shared pointer because it will be passed between classes
 // like runtime filter to scan node, or from scannode to scanner. We could not make sure
 // the relatioinship between threads and classes.
@@ -139,6 +145,18 @@ public:
     static Status clone_if_not_exists(const VExprContextSPtrs& ctxs, RuntimeState* state,
                                       VExprContextSPtrs& new_ctxs);
 
+    // Let the equal deterministic function calls on slots in the prepared exprs be executed
+    // once per block, e.g. json_extract(payload, '$.a') in several projections. The results
+    // must be reset before the exprs are executed on another block.
+    static void eliminate_common_subexprs(const VExprContextSPtrs& ctxs,
+                                          VExprCommonResults* results);
+
+    static void reset_common_results(const VExprCommonResults& results) {
+        for (const auto& result : results) {
+            result->column_id = -1;
+        }
+    }
+
     bool is_nullable() const { return _data_type->is_nullable(); }
 
     PrimitiveType result_type() const { return _type.type; }
@@ -25,11 +25,15 @@
 
 // IWYU pragma: no_include <opentelemetry/common/threadlocal.h>
 #include "common/compiler_util.h" // IWYU pragma: keep
+#include "common/config.h"
 #include "common/object_pool.h"
 #include "runtime/runtime_state.h"
 #include "runtime/thread_context.h"
 #include "udf/udf.h"
+#include "util/defer_op.h"
+#include "util/simd/bits.h"
 #include "util/stack_util.h"
+#include "util/time.h"
 #include "vec/columns/column_const.h"
 #include "vec/core/column_with_type_and_name.h"
 #include "vec/core/columns_with_type_and_name.h"
@@ -162,7 +166,24 @@ Status VExprContext::execute_conjuncts(const VExprContextSPtrs& ctxs,
     DCHECK(result_filter->size() == block->rows());
     *can_filter_all = false;
     auto* __restrict result_filter_data = result_filter->data();
+    const bool collect_stats = config::enable_adaptive_conjunct_order;
+    size_t input_rows = 0;
+    if (collect_stats) {
+        input_rows = result_filter->size() -
+                     simd::count_zero_num((int8_t*)result_filter_data, result_filter->size());
+    }
     for (auto& ctx : ctxs) {
+        int64_t start_ns = collect_stats ? MonotonicNanos() : 0;
+        Defer update_stats {[&]() {
+            if (collect_stats) {
+                size_t output_rows = result_filter->size() -
+                                     simd::count_zero_num((int8_t*)result_filter_data,
+                                                          result_filter->size());
+                ctx->conjunct_stats().update(input_rows, output_rows, result_filter->size(),
+                                             MonotonicNanos() - start_ns);
+                input_rows = output_rows;
+            }
+        }};
         int result_column_id = -1;
         RETURN_IF_ERROR(ctx->execute(block, &result_column_id));
         ColumnPtr& filter_column = block->get_by_position(result_column_id).column;
@@ -233,46 +254,129 @@ Status VExprContext::execute_conjuncts(const VExprContextSPtrs& ctxs,
     return Status::OK();
 }
 
-// TODO Performance Optimization
 // need exception safety
 Status VExprContext::execute_conjuncts_and_filter_block(
         const VExprContextSPtrs& ctxs, const std::vector<IColumn::Filter*>* filters, Block* block,
         std::vector<uint32_t>& columns_to_filter, int column_to_keep) {
-    IColumn::Filter result_filter(block->rows(), 1);
-    bool can_filter_all;
-    RETURN_IF_ERROR(
-            execute_conjuncts(ctxs, filters, false, block, &result_filter, &can_filter_all));
-    if (can_filter_all) {
-        for (auto& col : columns_to_filter) {
-            std::move(*block->get_by_position(col).column).assume_mutable()->clear();
-        }
-    } else {
-        RETURN_IF_CATCH_EXCEPTION(
-                Block::filter_block_internal(block, columns_to_filter, result_filter));
-    }
-    Block::erase_useless_column(block, column_to_keep);
-    return Status::OK();
+    IColumn::Filter result_filter;
+    return _execute_conjuncts_and_filter_block(ctxs, filters, block, columns_to_filter,
+                                               column_to_keep, result_filter);
 }
 
 Status VExprContext::execute_conjuncts_and_filter_block(const VExprContextSPtrs& ctxs, Block* block,
                                                         std::vector<uint32_t>& columns_to_filter,
                                                         int column_to_keep,
                                                         IColumn::Filter& filter) {
-    filter.resize_fill(block->rows(), 1);
-    bool can_filter_all;
-    RETURN_IF_ERROR(execute_conjuncts(ctxs, nullptr, false, block, &filter, &can_filter_all));
+    return _execute_conjuncts_and_filter_block(ctxs, nullptr, block, columns_to_filter,
+                                               column_to_keep, filter);
+}
+
+bool VExprContext::_can_filter_block_early(const Block& block,
+                                           const std::vector<uint32_t>& columns_to_filter,
+                                           int column_to_keep) {
+    const size_t rows = block.rows();
+    std::vector<bool> filtered(column_to_keep, false);
+    for (auto col : columns_to_filter) {
+        if (col < column_to_keep) {
+            filtered[col] = true;
+        }
+    }
+    for (int i = 0; i < column_to_keep; ++i) {
+        if (!filtered[i] && block.get_by_position(i).column->size() == rows) {
+            return false;
+        }
+    }
+    return true;
+}
+
+Status VExprContext::_execute_conjuncts_and_filter_block(
+        const VExprContextSPtrs& ctxs, const std::vector<IColumn::Filter*>* filters, Block* block,
+        std::vector<uint32_t>& columns_to_filter, int column_to_keep,
+        IColumn::Filter& result_filter) {
+    const size_t rows = block->rows();
+    result_filter.resize_fill(rows, 1);
+    bool can_filter_all = false;
+    if (config::early_filter_block_ratio <= 0 || ctxs.size() + (filters != nullptr) < 2 ||
+        !_can_filter_block_early(*block, columns_to_filter, column_to_keep)) {
+        RETURN_IF_ERROR(
+                execute_conjuncts(ctxs, filters, false, block, &result_filter, &can_filter_all));
+        if (can_filter_all) {
+            for (auto& col : columns_to_filter) {
+                std::move(*block->get_by_position(col).column).assume_mutable()->clear();
+            }
+        } else {
+            RETURN_IF_CATCH_EXCEPTION(
+                    Block::filter_block_internal(block, columns_to_filter, result_filter));
+        }
+        Block::erase_useless_column(block, column_to_keep);
+        return Status::OK();
+    }
+
+    // The filters are cheap, so they go first. filter is the filter of the rows of the
+    // current block, and sel keeps the positions of them in the input block once the block
+    // is filtered early.
+    IColumn::Filter filter(rows, 1);
+    std::vector<uint32_t> sel;
+    bool filtered_early = false;
+    if (filters != nullptr) {
+        RETURN_IF_ERROR(execute_conjuncts({}, filters, false, block, &filter, &can_filter_all));
+    }
+    for (const auto& ctx : ctxs) {
+        if (can_filter_all) {
+            break;
+        }
+        size_t count = filter.size() - simd::count_zero_num((int8_t*)filter.data(), filter.size());
+        if (count <= filter.size() * config::early_filter_block_ratio) {
+            if (!filtered_early) {
+                sel.reserve(count);
+                for (uint32_t i = 0; i < filter.size(); ++i) {
+                    if (filter[i]) {
+                        sel.push_back(i);
+                    }
+                }
+                filtered_early = true;
+            } else {
+                size_t j = 0;
+                for (size_t i = 0; i < filter.size(); ++i) {
+                    sel[j] = sel[i];
+                    j += filter[i];
+                }
+                sel.resize(j);
+            }
+            RETURN_IF_CATCH_EXCEPTION(
+                    Block::filter_block_internal(block, columns_to_filter, filter));
+            Block::erase_useless_column(block, column_to_keep);
+            filter.assign(count, (uint8_t)1);
+        }
+        RETURN_IF_ERROR(execute_conjuncts({ctx}, nullptr, false, block, &filter, &can_filter_all));
+    }
+
     if (can_filter_all) {
         for (auto& col : columns_to_filter) {
             std::move(*block->get_by_position(col).column).assume_mutable()->clear();
         }
+        memset(result_filter.data(), 0, rows);
     } else {
         RETURN_IF_CATCH_EXCEPTION(Block::filter_block_internal(block, columns_to_filter, filter));
+        if (filtered_early) {
+            memset(result_filter.data(), 0, rows);
+            for (size_t i = 0; i < sel.size(); ++i) {
+                result_filter[sel[i]] = filter[i];
+            }
+        } else {
+            result_filter.swap(filter);
+        }
     }
-
     Block::erase_useless_column(block, column_to_keep);
     return Status::OK();
 }
 
+void VExprContext::reorder_conjuncts(VExprContextSPtrs* ctxs) {
+    reorder_conjuncts_by_rank(ctxs, [](const VExprContextSPtr& ctx) -> ConjunctStats& {
+        return ctx->conjunct_stats();
+    });
+}
+
 Status VExprContext::get_output_block_after_execute_exprs(
         const VExprContextSPtrs& output_vexpr_ctxs, const Block& input_block, Block* output_block) {
     vectorized::Block tmp_block(input_block.get_columns_with_type_and_name());
@@ -27,6 +27,7 @@
 #include "runtime/types.h"
 #include "udf/udf.h"
 #include "vec/core/block.h"
+#include "vec/exprs/conjunct_stats.h"
 #include "vec/exprs/vexpr_fwd.h"
 
 namespace doris {
@@ -107,6 +108,12 @@ public:
 
     void set_force_materialize_slot() { _force_materialize_slot = true; }
 
+    // collected by execute_conjuncts if enable_adaptive_conjunct_order is set
+    ConjunctStats& conjunct_stats() { return _conjunct_stats; }
+
+    // Reorder the conjuncts of an AND chain by their measured selectivity and cost.
+    static void reorder_conjuncts(VExprContextSPtrs* ctxs);
+
     VExprContext& operator=(const VExprContext& other) {
         if (this == &other) {
             return *this;
@@ -142,6 +149,20 @@ private:
     // Close method is called in vexpr context dector, not need call expicility
     void close();
 
+    // Execute the conjuncts and filter the block, result_filter is the filter of the rows of
+    // the input block. When the rows surviving the executed conjuncts are few, the block is
+    // filtered before the next conjunct, so the later conjuncts only execute on them.
+    [[nodiscard]] static Status _execute_conjuncts_and_filter_block(
+            const VExprContextSPtrs& ctxs, const std::vector<IColumn::Filter*>* filters,
+            Block* block, std::vector<uint32_t>& columns_to_filter, int column_to_keep,
+            IColumn::Filter& result_filter);
+
+    // The block can only be filtered early if all the columns which conjuncts may read are
+    // filtered, the others are not materialized yet.
+    static bool _can_filter_block_early(const Block& block,
+                                        const std::vector<uint32_t>& columns_to_filter,
+                                        int column_to_keep);
+
 private:
     friend class VExpr;
 
@@ -167,5 +188,7 @@ private:
     // This flag only works on VSlotRef.
     // Force to materialize even if the slot need_materialize is false, we just ignore need_materialize flag
     bool _force_materialize_slot = false;
+
+    ConjunctStats _conjunct_stats;
 };
 } // namespace doris::vectorized
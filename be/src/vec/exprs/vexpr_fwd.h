@@ -23,11 +23,13 @@
 namespace doris::vectorized {
 class VExpr;
 class VExprContext;
+struct VExprCommonResult;
 
 using VExprSPtr = std::shared_ptr<VExpr>;
 using VExprContextSPtr = std::shared_ptr<VExprContext>;
 
 using VExprSPtrs = std::vector<VExprSPtr>;
 using VExprContextSPtrs = std::vector<VExprContextSPtr>;
+using VExprCommonResults = std::vector<std::shared_ptr<VExprCommonResult>>;
 
 } // namespace doris::vectorized
\ No newline at end of file
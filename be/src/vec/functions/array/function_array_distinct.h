@@ -174,8 +174,7 @@ private:
                     continue;
                 }
 
-                if (!set.find(src_datas[j])) {
-                    set.insert(src_datas[j]);
+                if (set.insert(src_datas[j]).second) {
                     dest_datas.push_back(src_datas[j]);
                     if (dest_null_map) {
                         (*dest_null_map).push_back(false);
@@ -228,8 +227,7 @@ private:
                 }
 
                 StringRef src_str_ref = src_data_concrete->get_data_at(j);
-                if (!set.find(src_str_ref)) {
-                    set.insert(src_str_ref);
+                if (set.insert(src_str_ref).second) {
                     // copy the src data to column_string_chars
                     const size_t old_size = column_string_chars.size();
                     const size_t new_size = old_size + src_str_ref.size;
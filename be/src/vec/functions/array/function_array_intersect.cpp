@@ -52,7 +52,8 @@ struct IntersectAction {
                 current_null_flag = true;
             } else {
                 if constexpr (std::is_same_v<ColumnString, ColumnType>) {
-                    value = &map[param.nested_col->get_data_at(off)];
+                    auto& data_col = assert_cast<const ColumnString&>(*param.nested_col);
+                    value = &map[data_col.get_data_at(off)];
                 } else {
                     auto& data_col = static_cast<const ColumnType&>(*param.nested_col);
                     value = &map[data_col.get_element(off)];
@@ -22,13 +22,21 @@
 #include <fmt/format.h>
 #include <glog/logging.h>
 #include <stddef.h>
+#include <string.h>
 
+#include <algorithm>
 #include <memory>
+#include <numeric>
 #include <ostream>
 
 #include "common/status.h"
 #include "vec/columns/column.h"
 #include "vec/columns/column_array.h"
+#include "vec/columns/column_decimal.h"
+#include "vec/columns/column_nullable.h"
+#include "vec/columns/column_string.h"
+#include "vec/columns/column_vector.h"
+#include "vec/columns/columns_number.h"
 #include "vec/core/block.h"
 #include "vec/core/column_numbers.h"
 #include "vec/core/column_with_type_and_name.h"
@@ -84,6 +92,26 @@ private:
         const auto& src_offsets = src_column_array.get_offsets();
         const auto& src_nested_column = src_column_array.get_data();
 
+        // sort the typed nested data of the arrays as segments between the offsets
+        const IColumn* src_values = &src_nested_column;
+        const NullMap* src_null_map = nullptr;
+        if (const auto* nullable = check_and_get_column<ColumnNullable>(src_nested_column)) {
+            src_values = &nullable->get_nested_column();
+            src_null_map = &nullable->get_null_map_data();
+        }
+        ColumnPtr sorted_nested_column;
+        if (_sort_typed<ALL_COLUMNS_NUMERIC>(*src_values, src_null_map, src_offsets,
+                                             &sorted_nested_column)) {
+            return ColumnArray::create(std::move(sorted_nested_column),
+                                       src_column_array.get_offsets_ptr());
+        }
+        if (const auto* src_strings = check_and_get_column<ColumnString>(*src_values)) {
+            return ColumnArray::create(
+                    src_nested_column.permute(
+                            _sort_strings(*src_strings, src_null_map, src_offsets), 0),
+                    src_column_array.get_offsets_ptr());
+        }
+
         size_t size = src_offsets.size();
         size_t nested_size = src_nested_column.size();
         IColumn::Permutation permutation(nested_size);
@@ -103,6 +131,108 @@ private:
                                    src_column_array.get_offsets_ptr());
     }
 
+    template <typename ColumnType, typename... ColumnTypes>
+    static bool _sort_typed(const IColumn& src_values, const NullMap* src_null_map,
+                            const ColumnArray::Offsets64& src_offsets, ColumnPtr* result) {
+        if (_sort_number<ColumnType>(src_values, src_null_map, src_offsets, result)) {
+            return true;
+        }
+        if constexpr (sizeof...(ColumnTypes) > 0) {
+            return _sort_typed<ColumnTypes...>(src_values, src_null_map, src_offsets, result);
+        }
+        return false;
+    }
+
+    // Copies the values and sorts them in place, the nulls of an array are moved first in the
+    // ascending order and last in the descending one, like compare_at with a hint of -1.
+    template <typename ColumnType>
+    static bool _sort_number(const IColumn& src_values, const NullMap* src_null_map,
+                             const ColumnArray::Offsets64& src_offsets, ColumnPtr* result) {
+        using T = typename ColumnType::value_type;
+        const auto* src_column = check_and_get_column<ColumnType>(src_values);
+        if (src_column == nullptr) {
+            return false;
+        }
+        const auto& src_data = src_column->get_data();
+        auto dst_column = src_column->clone_resized(src_data.size());
+        auto* __restrict dst_data = assert_cast<ColumnType&>(*dst_column).get_data().data();
+        auto less = [](const T& a, const T& b) {
+            if constexpr (Positive) {
+                return CompareHelper<T>::less(a, b, -1);
+            } else {
+                return CompareHelper<T>::greater(a, b, -1);
+            }
+        };
+
+        if (src_null_map == nullptr) {
+            for (size_t i = 0; i < src_offsets.size(); ++i) {
+                std::sort(dst_data + src_offsets[i - 1], dst_data + src_offsets[i], less);
+            }
+            *result = std::move(dst_column);
+            return true;
+        }
+
+        auto dst_null_map_column = ColumnUInt8::create(src_data.size(), 0);
+        auto* __restrict dst_null_map = dst_null_map_column->get_data().data();
+        const auto* __restrict null_map = src_null_map->data();
+        for (size_t i = 0; i < src_offsets.size(); ++i) {
+            const size_t begin = src_offsets[i - 1];
+            const size_t end = src_offsets[i];
+            size_t num_values = 0;
+            for (size_t j = begin; j < end; ++j) {
+                if (!null_map[j]) {
+                    dst_data[begin + num_values++] = src_data[j];
+                }
+            }
+            const size_t num_nulls = end - begin - num_values;
+            size_t values_begin = begin;
+            if constexpr (Positive) {
+                values_begin += num_nulls;
+                std::move_backward(dst_data + begin, dst_data + begin + num_values,
+                                   dst_data + end);
+                std::fill(dst_data + begin, dst_data + values_begin, T());
+                memset(dst_null_map + begin, 1, num_nulls);
+            } else {
+                std::fill(dst_data + begin + num_values, dst_data + end, T());
+                memset(dst_null_map + begin + num_values, 1, num_nulls);
+            }
+            std::sort(dst_data + values_begin, dst_data + values_begin + num_values, less);
+        }
+        *result = ColumnNullable::create(std::move(dst_column), std::move(dst_null_map_column));
+        return true;
+    }
+
+    // The permutation sorting the arrays of strings, compared as StringRefs.
+    static IColumn::Permutation _sort_strings(const ColumnString& src_strings,
+                                              const NullMap* src_null_map,
+                                              const ColumnArray::Offsets64& src_offsets) {
+        IColumn::Permutation permutation(src_strings.size());
+        std::iota(permutation.begin(), permutation.end(), 0);
+        auto less = [&](size_t lhs, size_t rhs) {
+            if constexpr (Positive) {
+                return src_strings.get_data_at(lhs) < src_strings.get_data_at(rhs);
+            } else {
+                return src_strings.get_data_at(rhs) < src_strings.get_data_at(lhs);
+            }
+        };
+        for (size_t i = 0; i < src_offsets.size(); ++i) {
+            auto* begin = permutation.data() + src_offsets[i - 1];
+            auto* end = permutation.data() + src_offsets[i];
+            if (src_null_map != nullptr) {
+                // nulls first in the ascending order and last in the descending one
+                auto is_null = [&](size_t row) { return (*src_null_map)[row] == Positive; };
+                auto* values_begin = std::partition(begin, end, is_null);
+                if constexpr (Positive) {
+                    begin = values_begin;
+                } else {
+                    end = values_begin;
+                }
+            }
+            std::sort(begin, end, less);
+        }
+        return permutation;
+    }
+
     struct Less {
         const IColumn& column;
 
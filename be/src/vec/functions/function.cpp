@@ -70,6 +70,9 @@ ColumnPtr wrap_in_nullable(const ColumnPtr& src, const Block& block, const Colum
         }
 
         if (auto* nullable = assert_cast<const ColumnNullable*>(elem.column.get())) {
+            if (!nullable->has_null()) {
+                continue;
+            }
             const ColumnPtr& null_map_column = nullable->get_null_map_column_ptr();
             if (!result_null_map_column) {
                 result_null_map_column = null_map_column->clone_resized(input_rows_count);
@@ -120,6 +123,19 @@ NullPresence get_null_presence(const Block& block, const ColumnNumbers& args) {
     return res;
 }
 
+// Whether the result of the function with default implementation for nulls is all null,
+// the has_null flags cached by the nullable columns make it cheap for the common cases.
+static bool has_all_null_argument(const Block& block, const ColumnNumbers& args) {
+    for (auto arg : args) {
+        const auto* nullable =
+                check_and_get_column<ColumnNullable>(block.get_by_position(arg).column.get());
+        if (nullable != nullptr && nullable->all_null()) {
+            return true;
+        }
+    }
+    return false;
+}
+
 [[maybe_unused]] NullPresence get_null_presence(const ColumnsWithTypeAndName& args) {
     NullPresence res;
 
@@ -226,7 +242,8 @@ Status PreparedFunctionImpl::default_implementation_for_nulls(
 
     NullPresence null_presence = get_null_presence(block, args);
 
-    if (null_presence.has_null_constant) {
+    if (null_presence.has_null_constant ||
+        (null_presence.has_nullable && has_all_null_argument(block, args))) {
         block.get_by_position(result).column =
                 block.get_by_position(result).type->create_column_const(input_rows_count, Null());
         *executed = true;
@@ -524,7 +524,10 @@ private:
 
     static ALWAYS_INLINE UInt8 apply_op_safely(NativeResultType a, NativeResultType b,
                                                NativeResultType& c) {
-        if constexpr (OpTraits::is_multiply || OpTraits::is_plus_minus) {
+        if constexpr ((OpTraits::is_multiply || OpTraits::is_plus_minus) && !check_overflow) {
+            c = Op::template apply<NativeResultType>(a, b);
+            return 0;
+        } else if constexpr (OpTraits::is_multiply || OpTraits::is_plus_minus) {
             return Op::template apply(a, b, c);
         }
     }
@@ -614,7 +617,7 @@ struct BinaryOperationTraits {
 
 template <typename LeftDataType, typename RightDataType, typename ExpectedResultDataType,
           template <typename, typename> class Operation, bool is_to_null_type,
-          bool return_nullable_type>
+          bool return_nullable_type, bool check_overflow = true>
 struct ConstOrVectorAdapter {
     static constexpr bool result_is_decimal =
             IsDataTypeDecimal<LeftDataType> || IsDataTypeDecimal<RightDataType>;
@@ -627,12 +630,26 @@ struct ConstOrVectorAdapter {
     using OperationImpl = std::conditional_t<
             IsDataTypeDecimal<ResultDataType>,
             DecimalBinaryOperation<A, B, Operation, ResultType, is_to_null_type,
-                                   return_nullable_type>,
+                                   return_nullable_type, check_overflow>,
             BinaryOperationImpl<A, B, Operation<A, B>, is_to_null_type, ResultType>>;
 
+    static constexpr bool can_skip_overflow_check =
+            check_overflow && IsDataTypeDecimal<LeftDataType> && IsDataTypeDecimal<RightDataType> &&
+            IsDataTypeDecimal<ResultDataType> && !IsDecimalV2<A> && !IsDecimalV2<B> &&
+            !IsDecimalV2<ResultType> &&
+            (OperationTraits<Operation>::is_multiply || OperationTraits<Operation>::is_plus_minus);
+
     static ColumnPtr execute(ColumnPtr column_left, ColumnPtr column_right,
                              const LeftDataType& type_left, const RightDataType& type_right,
                              DataTypePtr res_data_type) {
+        if constexpr (can_skip_overflow_check) {
+            if (cannot_overflow(type_left, type_right)) {
+                return ConstOrVectorAdapter<LeftDataType, RightDataType, ExpectedResultDataType,
+                                            Operation, is_to_null_type, return_nullable_type,
+                                            false>::execute(column_left, column_right, type_left,
+                                                            type_right, res_data_type);
+            }
+        }
         bool is_const_left = is_column_const(*column_left);
         bool is_const_right = is_column_const(*column_right);
 
@@ -649,6 +666,20 @@ struct ConstOrVectorAdapter {
     }
 
 private:
+    // Whether the native result can not overflow for any values of the argument precisions,
+    // i.e. |a| < 10^pa and |b| < 10^pb, so the per row overflow checks, which are much slower
+    // than the operations themselves on __int128, are skipped for the whole column.
+    static bool cannot_overflow(const LeftDataType& type_left, const RightDataType& type_right) {
+        constexpr size_t max_precision = max_decimal_precision<ResultType>();
+        if constexpr (OperationTraits<Operation>::is_multiply) {
+            return type_left.get_precision() + type_right.get_precision() <= max_precision;
+        } else {
+            // |a +- b| < 2 * 10^max(pa, pb)
+            return std::max(type_left.get_precision(), type_right.get_precision()) + 1 <=
+                   max_precision;
+        }
+    }
+
     static ColumnPtr constant_constant(ColumnPtr column_left, ColumnPtr column_right,
                                        const LeftDataType& type_left,
                                        const RightDataType& type_right, DataTypePtr res_data_type) {
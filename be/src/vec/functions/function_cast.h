@@ -41,6 +41,7 @@
 // IWYU pragma: no_include <opentelemetry/common/threadlocal.h>
 #include "common/compiler_util.h" // IWYU pragma: keep
 #include "common/status.h"
+#include "gutil/strings/numbers.h"
 #include "runtime/runtime_state.h"
 #include "udf/udf.h"
 #include "util/jsonb_document.h"
@@ -500,6 +501,15 @@ struct ConvertImplGenericToString {
         size_t size = col_from.size();
 
         auto col_to = ColumnString::create();
+        WhichDataType which(type);
+        if ((which.is_int8() && execute_integer<Int8>(col_from, col_to.get())) ||
+            (which.is_int16() && execute_integer<Int16>(col_from, col_to.get())) ||
+            (which.is_int32() && execute_integer<Int32>(col_from, col_to.get())) ||
+            (which.is_int64() && execute_integer<Int64>(col_from, col_to.get()))) {
+            block.replace_by_position(result, std::move(col_to));
+            return Status::OK();
+        }
+
         col_to->reserve(size * 2);
         VectorBufferWriter write_buffer(*col_to.get());
         for (size_t i = 0; i < size; ++i) {
@@ -515,6 +525,37 @@ struct ConvertImplGenericToString {
                            const size_t result, size_t /*input_rows_count*/) {
         return execute(block, arguments, result);
     }
+
+private:
+    // Write all integers into the chars with the two digits lookup of FastInt64ToBufferLeft,
+    // instead of formatting each row through IDataType::to_string. The output is the same.
+    template <typename T>
+    static bool execute_integer(const IColumn& col_from, ColumnString* col_to) {
+        const auto* col = check_and_get_column<ColumnVector<T>>(col_from);
+        if (col == nullptr) {
+            return false;
+        }
+        const auto& data = col->get_data();
+        size_t size = data.size();
+        auto& chars = col_to->get_chars();
+        auto& offsets = col_to->get_offsets();
+        offsets.resize(size);
+        // sign and 19 digits of int64, plus the terminating zero written by FastInt64ToBuffer
+        constexpr size_t MAX_INT64_CHARS = 20;
+        chars.resize(size * MAX_INT64_CHARS + 1);
+        char* begin = reinterpret_cast<char*>(chars.data());
+        char* pos = begin;
+        for (size_t i = 0; i < size; ++i) {
+            if constexpr (sizeof(T) <= sizeof(int32_t)) {
+                pos = FastInt32ToBufferLeft(data[i], pos);
+            } else {
+                pos = FastInt64ToBufferLeft(data[i], pos);
+            }
+            offsets[i] = pos - begin;
+        }
+        chars.resize(pos - begin);
+        return true;
+    }
 };
 
 template <typename StringColumnType>
@@ -17,6 +17,7 @@
 
 #pragma once
 
+#include <cctz/civil_time.h>
 #include <cctz/time_zone.h>
 #include <stddef.h>
 #include <stdint.h>
@@ -30,6 +31,7 @@
 #include "common/status.h"
 #include "udf/udf.h"
 #include "util/binary_cast.hpp"
+#include "util/timezone_transitions.h"
 #include "util/timezone_utils.h"
 #include "vec/aggregate_functions/aggregate_function.h"
 #include "vec/columns/column.h"
@@ -65,7 +67,28 @@ class DateV2Value;
 namespace doris::vectorized {
 
 struct ConvertTzCtx {
-    std::map<std::string, cctz::time_zone> time_zone_cache;
+    struct TimeZone {
+        bool valid = false;
+        cctz::time_zone ctz;
+        // the transitions of ctz if it could be tabulated
+        bool has_transitions = false;
+        TimezoneTransitions transitions;
+    };
+
+    // nullptr if the time zone is not found
+    const TimeZone* find_time_zone(const StringRef& name) {
+        auto it = time_zone_cache.find(name.to_string());
+        if (it == time_zone_cache.end()) {
+            it = time_zone_cache.emplace(name.to_string(), TimeZone()).first;
+            TimeZone& time_zone = it->second;
+            time_zone.valid = TimezoneUtils::find_cctz_time_zone(it->first, time_zone.ctz);
+            time_zone.has_transitions =
+                    time_zone.valid && time_zone.transitions.init(time_zone.ctz);
+        }
+        return it->second.valid ? &it->second : nullptr;
+    }
+
+    std::map<std::string, TimeZone> time_zone_cache;
 };
 
 template <typename DateValueType, typename ArgType>
@@ -84,6 +107,7 @@ struct ConvertTZImpl {
             std::conditional_t<std::is_same_v<VecDateTimeValue, DateValueType>, Int64, UInt64>;
     using ReturnColumnType = std::conditional_t<std::is_same_v<VecDateTimeValue, DateValueType>,
                                                 ColumnDateTime, ColumnDateTimeV2>;
+    using TimeZone = ConvertTzCtx::TimeZone;
 
     static void execute(FunctionContext* context, const ColumnType* date_column,
                         const ColumnString* from_tz_column, const ColumnString* to_tz_column,
@@ -91,17 +115,28 @@ struct ConvertTZImpl {
                         size_t input_rows_count) {
         auto convert_ctx = reinterpret_cast<ConvertTzCtx*>(
                 context->get_function_state(FunctionContext::FunctionStateScope::THREAD_LOCAL));
-        std::map<std::string, cctz::time_zone> time_zone_cache_;
-        auto& time_zone_cache = convert_ctx ? convert_ctx->time_zone_cache : time_zone_cache_;
+        ConvertTzCtx convert_ctx_;
+        auto& ctx = convert_ctx ? *convert_ctx : convert_ctx_;
+        // the time zones of a column are mostly the same as the previous row
+        StringRef last_from_name, last_to_name;
+        const TimeZone* from_tz = nullptr;
+        const TimeZone* to_tz = nullptr;
         for (size_t i = 0; i < input_rows_count; i++) {
             if (result_null_map[i]) {
                 result_column->insert_default();
                 continue;
             }
-            auto from_tz = from_tz_column->get_data_at(i).to_string();
-            auto to_tz = to_tz_column->get_data_at(i).to_string();
-            execute_inner_loop(date_column, time_zone_cache, from_tz, to_tz, result_column,
-                               result_null_map, i);
+            StringRef from_name = from_tz_column->get_data_at(i);
+            StringRef to_name = to_tz_column->get_data_at(i);
+            if (from_tz == nullptr || from_name != last_from_name) {
+                from_tz = ctx.find_time_zone(from_name);
+                last_from_name = from_name;
+            }
+            if (to_tz == nullptr || to_name != last_to_name) {
+                to_tz = ctx.find_time_zone(to_name);
+                last_to_name = to_name;
+            }
+            execute_inner_loop(date_column, from_tz, to_tz, result_column, result_null_map, i);
         }
     }
 
@@ -111,54 +146,65 @@ struct ConvertTZImpl {
                                  NullMap& result_null_map, size_t input_rows_count) {
         auto convert_ctx = reinterpret_cast<ConvertTzCtx*>(
                 context->get_function_state(FunctionContext::FunctionStateScope::THREAD_LOCAL));
-        std::map<std::string, cctz::time_zone> time_zone_cache_;
-        auto& time_zone_cache = convert_ctx ? convert_ctx->time_zone_cache : time_zone_cache_;
+        ConvertTzCtx convert_ctx_;
+        auto& ctx = convert_ctx ? *convert_ctx : convert_ctx_;
 
-        auto from_tz = from_tz_column->get_data_at(0).to_string();
-        auto to_tz = to_tz_column->get_data_at(0).to_string();
+        const TimeZone* from_tz = ctx.find_time_zone(from_tz_column->get_data_at(0));
+        const TimeZone* to_tz = ctx.find_time_zone(to_tz_column->get_data_at(0));
         for (size_t i = 0; i < input_rows_count; i++) {
             if (result_null_map[i]) {
                 result_column->insert_default();
                 continue;
             }
-            execute_inner_loop(date_column, time_zone_cache, from_tz, to_tz, result_column,
-                               result_null_map, i);
+            execute_inner_loop(date_column, from_tz, to_tz, result_column, result_null_map, i);
         }
     }
 
-    static void execute_inner_loop(const ColumnType* date_column,
-                                   std::map<std::string, cctz::time_zone>& time_zone_cache,
-                                   const std::string& from_tz, const std::string& to_tz,
-                                   ReturnColumnType* result_column, NullMap& result_null_map,
-                                   const size_t index_now) {
+    static void execute_inner_loop(const ColumnType* date_column, const TimeZone* from_tz,
+                                   const TimeZone* to_tz, ReturnColumnType* result_column,
+                                   NullMap& result_null_map, const size_t index_now) {
+        if (from_tz == nullptr || to_tz == nullptr) {
+            result_null_map[index_now] = true;
+            result_column->insert_default();
+            return;
+        }
         DateValueType ts_value =
                 binary_cast<NativeType, DateValueType>(date_column->get_element(index_now));
-        int64_t timestamp;
-
-        if (time_zone_cache.find(from_tz) == time_zone_cache.cend()) {
-            if (!TimezoneUtils::find_cctz_time_zone(from_tz, time_zone_cache[from_tz])) {
-                result_null_map[index_now] = true;
-                result_column->insert_default();
-                return;
-            }
-        }
 
-        if (time_zone_cache.find(to_tz) == time_zone_cache.cend()) {
-            if (!TimezoneUtils::find_cctz_time_zone(to_tz, time_zone_cache[to_tz])) {
-                result_null_map[index_now] = true;
-                result_column->insert_default();
-                return;
+        // convert by the transition tables, the same as the unix_timestamp and from_unixtime
+        // below but without a cctz lookup
+        static const cctz::civil_second civil_epoch(1970, 1, 1, 0, 0, 0);
+        int64_t local_seconds =
+                cctz::civil_second(ts_value.year(), ts_value.month(), ts_value.day(),
+                                   ts_value.hour(), ts_value.minute(), ts_value.second()) -
+                civil_epoch;
+        int32_t from_offset = 0;
+        int32_t to_offset = 0;
+        if (from_tz->has_transitions && to_tz->has_transitions &&
+            from_tz->transitions.local_offset(local_seconds, &from_offset) &&
+            to_tz->transitions.utc_offset(local_seconds - from_offset, &to_offset)) {
+            cctz::civil_second cs = civil_epoch + (local_seconds - from_offset + to_offset);
+            ReturnDateType ts_value2;
+            if constexpr (std::is_same_v<VecDateTimeValue, ReturnDateType>) {
+                ts_value2.set_time(cs.year(), cs.month(), cs.day(), cs.hour(), cs.minute(),
+                                   cs.second());
+            } else {
+                ts_value2.set_time(cs.year(), cs.month(), cs.day(), cs.hour(), cs.minute(),
+                                   cs.second(), 0);
             }
+            result_column->insert(binary_cast<ReturnDateType, ReturnNativeType>(ts_value2));
+            return;
         }
 
-        if (!ts_value.unix_timestamp(&timestamp, time_zone_cache[from_tz])) {
+        int64_t timestamp;
+        if (!ts_value.unix_timestamp(&timestamp, from_tz->ctz)) {
             result_null_map[index_now] = true;
             result_column->insert_default();
             return;
         }
 
         ReturnDateType ts_value2;
-        if (!ts_value2.from_unixtime(timestamp, time_zone_cache[to_tz])) {
+        if (!ts_value2.from_unixtime(timestamp, to_tz->ctz)) {
             result_null_map[index_now] = true;
             result_column->insert_default();
             return;
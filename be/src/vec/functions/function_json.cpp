@@ -223,12 +223,7 @@ rapidjson::Value* match_value(const std::vector<JsonPath>& parsed_paths, rapidjs
     return root;
 }
 
-template <JsonFunctionType fntype>
-rapidjson::Value* get_json_object(std::string_view json_string, std::string_view path_string,
-                                  rapidjson::Document* document) {
-    std::vector<JsonPath>* parsed_paths;
-    std::vector<JsonPath> tmp_parsed_paths;
-
+void parse_json_path(std::string_view path_string, std::vector<JsonPath>* parsed_paths) {
 #ifdef USE_LIBCPP
     std::string s(path_string);
     auto tok = get_json_token(s);
@@ -236,18 +231,23 @@ rapidjson::Value* get_json_object(std::string_view json_string, std::string_view
     auto tok = get_json_token(path_string);
 #endif
     std::vector<std::string> paths(tok.begin(), tok.end());
-    get_parsed_paths(paths, &tmp_parsed_paths);
-    if (tmp_parsed_paths.empty()) {
+    get_parsed_paths(paths, parsed_paths);
+}
+
+// parsed_paths is parsed by parse_json_path, so a constant path is only parsed once
+template <JsonFunctionType fntype>
+rapidjson::Value* get_json_object(std::string_view json_string,
+                                  const std::vector<JsonPath>& parsed_paths,
+                                  rapidjson::Document* document) {
+    if (parsed_paths.empty()) {
         return document;
     }
 
-    parsed_paths = &tmp_parsed_paths;
-
-    if (!(*parsed_paths)[0].is_valid) {
+    if (!parsed_paths[0].is_valid) {
         return document;
     }
 
-    if (UNLIKELY((*parsed_paths).size() == 1)) {
+    if (UNLIKELY(parsed_paths.size() == 1)) {
         if (fntype == JSON_FUN_STRING) {
             document->SetString(json_string.data(), json_string.size(), document->GetAllocator());
         } else {
@@ -263,7 +263,15 @@ rapidjson::Value* get_json_object(std::string_view json_string, std::string_view
         return document;
     }
 
-    return match_value(*parsed_paths, document, document->GetAllocator());
+    return match_value(parsed_paths, document, document->GetAllocator());
+}
+
+template <JsonFunctionType fntype>
+rapidjson::Value* get_json_object(std::string_view json_string, std::string_view path_string,
+                                  rapidjson::Document* document) {
+    std::vector<JsonPath> parsed_paths;
+    parse_json_path(path_string, &parsed_paths);
+    return get_json_object<fntype>(json_string, parsed_paths, document);
 }
 
 template <typename NumberType>
@@ -272,8 +280,10 @@ struct GetJsonNumberType {
     using ColumnType = typename NumberType::ColumnType;
     using Container = typename ColumnType::Container;
 
+    // Path is the path string or the paths parsed by parse_json_path
+    template <typename Path>
     static void get_json_impl(rapidjson::Value*& root, const std::string_view& json_string,
-                              const std::string_view& path_string, rapidjson::Document& document,
+                              const Path& path_string, rapidjson::Document& document,
                               typename NumberType::T& res, UInt8& null_map) {
         if constexpr (std::is_same_v<double, typename NumberType::T>) {
             root = get_json_object<JSON_FUN_DOUBLE>(json_string, path_string, &document);
@@ -316,7 +326,8 @@ struct GetJsonNumberType {
                               Container& res, NullMap& null_map) {
         size_t size = loffsets.size();
         res.resize(size);
-        std::string_view path_string(rdata.data, rdata.size);
+        std::vector<JsonPath> parsed_paths;
+        parse_json_path(std::string_view(rdata.data, rdata.size), &parsed_paths);
         for (size_t i = 0; i < size; ++i) {
             const char* l_raw_str = reinterpret_cast<const char*>(&ldata[loffsets[i - 1]]);
             int l_str_size = loffsets[i] - loffsets[i - 1];
@@ -329,7 +340,7 @@ struct GetJsonNumberType {
             rapidjson::Document document;
             rapidjson::Value* root = nullptr;
 
-            get_json_impl(root, json_string, path_string, document, res[i], null_map[i]);
+            get_json_impl(root, json_string, parsed_paths, document, res[i], null_map[i]);
         }
     }
     static void scalar_vector(FunctionContext* context, const StringRef& ldata,
@@ -460,6 +471,8 @@ struct GetJsonString {
         size_t input_rows_count = loffsets.size();
         res_offsets.resize(input_rows_count);
 
+        std::vector<JsonPath> parsed_paths;
+        parse_json_path(std::string_view(rdata.data, rdata.size), &parsed_paths);
         for (size_t i = 0; i < input_rows_count; ++i) {
             if (null_map[i]) {
                 StringOP::push_null_string(i, res_data, res_offsets, null_map);
@@ -469,9 +482,8 @@ struct GetJsonString {
             const auto l_raw = reinterpret_cast<const char*>(&ldata[loffsets[i - 1]]);
 
             std::string_view json_string(l_raw, l_size);
-            std::string_view path_string(rdata.data, rdata.size);
 
-            execute_impl(json_string, path_string, res_data, res_offsets, null_map, i);
+            execute_impl(json_string, parsed_paths, res_data, res_offsets, null_map, i);
         }
     }
     static void scalar_vector(FunctionContext* context, const StringRef& ldata, const Chars& rdata,
@@ -495,8 +507,10 @@ struct GetJsonString {
         }
     }
 
-    static void execute_impl(const std::string_view& json_string,
-                             const std::string_view& path_string, Chars& res_data,
+    // Path is the path string or the paths parsed by parse_json_path
+    template <typename Path>
+    static void execute_impl(const std::string_view& json_string, const Path& path_string,
+                             Chars& res_data,
                              Offsets& res_offsets, NullMap& null_map, size_t index_now) {
         rapidjson::Document document;
         rapidjson::Value* root = nullptr;
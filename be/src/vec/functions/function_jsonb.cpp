@@ -335,6 +335,23 @@ public:
         return make_nullable(std::make_shared<typename Impl::ReturnType>());
     }
 
+    Status open(FunctionContext* context, FunctionContext::FunctionStateScope scope) override {
+        if (scope != FunctionContext::FRAGMENT_LOCAL || !context->is_col_constant(1)) {
+            return Status::OK();
+        }
+        // parse the constant path once, see get_parsed_path
+        const auto& path_col = context->get_constant_col(1)->column_ptr;
+        if (path_col->is_null_at(0)) {
+            return Status::OK();
+        }
+        StringRef path = path_col->get_data_at(0);
+        auto parsed_path = std::make_shared<JsonbParsedPath>();
+        if (parsed_path->parse(path.data, path.size)) {
+            context->set_function_state(scope, parsed_path);
+        }
+        return Status::OK();
+    }
+
     Status execute_impl(FunctionContext* context, Block& block, const ColumnNumbers& arguments,
                         size_t result, size_t input_rows_count) override {
         auto null_map = ColumnUInt8::create(input_rows_count, 0);
@@ -391,6 +408,17 @@ public:
     }
 };
 
+// Return the constant path parsed in open, or parse the path into block_path for the rows of
+// a block. nullptr if the path can not be parsed ahead, then findPath is used for each row.
+static const JsonbParsedPath* get_parsed_path(FunctionContext* context, const StringRef& path,
+                                              JsonbParsedPath* block_path) {
+    if (auto* parsed_path = reinterpret_cast<JsonbParsedPath*>(
+                context->get_function_state(FunctionContext::FRAGMENT_LOCAL))) {
+        return parsed_path;
+    }
+    return block_path->parse(path.data, path.size) ? block_path : nullptr;
+}
+
 template <typename ValueType>
 struct JsonbExtractStringImpl {
     using ReturnType = typename ValueType::ReturnType;
@@ -403,8 +431,8 @@ private:
                                               const std::unique_ptr<JsonbWriter>& writer,
                                               std::unique_ptr<JsonbToJson>& formater,
                                               const char* l_raw, int l_size, const char* r_raw,
-                                              int r_size) {
-        String path(r_raw, r_size);
+                                              int r_size,
+                                              const JsonbParsedPath* parsed_path = nullptr) {
 
         if (null_map[i]) {
             StringOP::push_null_string(i, res_data, res_offsets, null_map);
@@ -419,7 +447,8 @@ private:
         }
 
         // value is NOT necessary to be deleted since JsonbValue will not allocate memory
-        JsonbValue* value = doc->getValue()->findPath(r_raw, r_size, nullptr);
+        JsonbValue* value = parsed_path ? parsed_path->find(doc->getValue())
+                                        : doc->getValue()->findPath(r_raw, r_size, nullptr);
         if (UNLIKELY(!value)) {
             StringOP::push_null_string(i, res_data, res_offsets, null_map);
             return;
@@ -513,12 +542,14 @@ public:
 
         std::unique_ptr<JsonbToJson> formater;
 
+        JsonbParsedPath block_path;
+        const JsonbParsedPath* parsed_path = get_parsed_path(context, rdata, &block_path);
         for (size_t i = 0; i < input_rows_count; ++i) {
             int l_size = loffsets[i] - loffsets[i - 1];
             const char* l_raw = reinterpret_cast<const char*>(&ldata[loffsets[i - 1]]);
 
             inner_loop_impl(i, res_data, res_offsets, null_map, writer, formater, l_raw, l_size,
-                            rdata.data, rdata.size);
+                            rdata.data, rdata.size, parsed_path);
         } //for
     }     //function
     static void scalar_vector(FunctionContext* context, const StringRef& ldata,
@@ -555,7 +586,8 @@ struct JsonbExtractImpl {
 private:
     static ALWAYS_INLINE void inner_loop_impl(size_t i, Container& res, NullMap& null_map,
                                               const char* l_raw_str, int l_str_size,
-                                              const char* r_raw_str, int r_str_size) {
+                                              const char* r_raw_str, int r_str_size,
+                                              const JsonbParsedPath* parsed_path = nullptr) {
         if (null_map[i]) {
             res[i] = 0;
             return;
@@ -570,7 +602,8 @@ private:
         }
 
         // value is NOT necessary to be deleted since JsonbValue will not allocate memory
-        JsonbValue* value = doc->getValue()->findPath(r_raw_str, r_str_size, nullptr);
+        JsonbValue* value = parsed_path ? parsed_path->find(doc->getValue())
+                                        : doc->getValue()->findPath(r_raw_str, r_str_size, nullptr);
 
         if (UNLIKELY(!value)) {
             if constexpr (!only_check_exists) {
@@ -678,6 +711,8 @@ public:
         size_t size = loffsets.size();
         res.resize(size);
 
+        JsonbParsedPath block_path;
+        const JsonbParsedPath* parsed_path = get_parsed_path(context, rdata, &block_path);
         for (size_t i = 0; i < loffsets.size(); i++) {
             if constexpr (only_check_exists) {
                 res[i] = 0;
@@ -686,7 +721,8 @@ public:
             const char* l_raw_str = reinterpret_cast<const char*>(&ldata[loffsets[i - 1]]);
             int l_str_size = loffsets[i] - loffsets[i - 1];
 
-            inner_loop_impl(i, res, null_map, l_raw_str, l_str_size, rdata.data, rdata.size);
+            inner_loop_impl(i, res, null_map, l_raw_str, l_str_size, rdata.data, rdata.size,
+                            parsed_path);
         } //for
     }     //function
 };
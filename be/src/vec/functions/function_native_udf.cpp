@@ -0,0 +1,268 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "vec/functions/function_native_udf.h"
+
+#include <fmt/format.h>
+#include <glog/logging.h>
+#include <stdlib.h>
+
+#include <utility>
+#include <vector>
+
+#include "runtime/memory/mem_tracker.h"
+#include "runtime/memory/mem_tracker_limiter.h"
+#include "runtime/runtime_state.h"
+#include "runtime/user_function_cache.h"
+#include "vec/columns/column.h"
+#include "vec/columns/column_nullable.h"
+#include "vec/columns/column_string.h"
+#include "vec/columns/columns_number.h"
+#include "vec/common/assert_cast.h"
+#include "vec/core/column_with_type_and_name.h"
+#include "vec/data_types/data_type_nullable.h"
+
+namespace doris::vectorized {
+
+// Grow the chars of the string result column, the column is kept in result->host.
+static void* reserve_string_chars(DorisUdfResult* result, size_t size) {
+    auto* column = static_cast<ColumnString*>(result->host);
+    auto& chars = column->get_chars();
+    try {
+        if (chars.size() < size) {
+            chars.resize(size);
+        }
+    } catch (...) {
+        // memory limit exceeded, the exception must not be thrown into the plugin
+        return nullptr;
+    }
+    result->data = chars.data();
+    return result->data;
+}
+
+NativeFunctionCall::NativeContext::NativeContext() {
+    udf_ctx.allocate = &NativeContext::allocate;
+    udf_ctx.free = &NativeContext::free;
+    udf_ctx.set_error = &NativeContext::set_error;
+    udf_ctx.num_args = 0;
+    udf_ctx.user_state = nullptr;
+    udf_ctx.host = this;
+}
+
+NativeFunctionCall::NativeContext::~NativeContext() {
+    close();
+}
+
+void NativeFunctionCall::NativeContext::close() {
+    if (is_prepared && close_fn != nullptr) {
+        close_fn(&udf_ctx);
+    }
+    is_prepared = false;
+    if (!allocations.empty()) {
+        LOG(WARNING) << "native udf leaks " << allocations.size() << " allocations";
+    }
+    for (auto& [ptr, size] : allocations) {
+        ::free(ptr);
+        mem_tracker->release(size);
+    }
+    allocations.clear();
+}
+
+void* NativeFunctionCall::NativeContext::allocate(DorisUdfContext* ctx, size_t size) {
+    auto* native_ctx = static_cast<NativeContext*>(ctx->host);
+    if (native_ctx->query_mem_tracker != nullptr &&
+        !native_ctx->query_mem_tracker->check_limit(size).ok()) {
+        return nullptr;
+    }
+    void* ptr = malloc(size);
+    if (ptr == nullptr) {
+        return nullptr;
+    }
+    native_ctx->allocations.emplace(ptr, size);
+    native_ctx->mem_tracker->consume(size);
+    return ptr;
+}
+
+void NativeFunctionCall::NativeContext::free(DorisUdfContext* ctx, void* ptr) {
+    auto* native_ctx = static_cast<NativeContext*>(ctx->host);
+    auto it = native_ctx->allocations.find(ptr);
+    if (it == native_ctx->allocations.end()) {
+        // not allocated by the context, ignore it instead of corrupting the heap
+        LOG(WARNING) << "native udf frees an unknown pointer " << ptr;
+        return;
+    }
+    native_ctx->mem_tracker->release(it->second);
+    native_ctx->allocations.erase(it);
+    ::free(ptr);
+}
+
+void NativeFunctionCall::NativeContext::set_error(DorisUdfContext* ctx, const char* message) {
+    static_cast<NativeContext*>(ctx->host)->error = message == nullptr ? "" : message;
+}
+
+NativeFunctionCall::NativeFunctionCall(const TFunction& fn, const DataTypes& argument_types,
+                                       const DataTypePtr& return_type)
+        : _fn(fn), _argument_types(argument_types), _return_type(return_type) {}
+
+Status NativeFunctionCall::_lookup(const std::string& symbol, void** fn_ptr) const {
+    return UserFunctionCache::instance()->get_function_ptr(_fn.id, _fn.hdfs_location,
+                                                           _fn.checksum, symbol, fn_ptr);
+}
+
+Status NativeFunctionCall::open(FunctionContext* context,
+                                FunctionContext::FunctionStateScope scope) {
+    if (scope != FunctionContext::THREAD_LOCAL) {
+        return Status::OK();
+    }
+    void* fn_ptr = nullptr;
+    RETURN_IF_ERROR(_lookup(DORIS_UDF_ABI_VERSION_SYMBOL, &fn_ptr));
+    int32_t abi_version = reinterpret_cast<DorisUdfAbiVersionFn>(fn_ptr)();
+    if (abi_version != DORIS_UDF_ABI_VERSION) {
+        return Status::NotSupported(
+                "native udf {} is built with abi version {}, but {} is expected", get_name(),
+                abi_version, DORIS_UDF_ABI_VERSION);
+    }
+
+    auto native_ctx = std::make_shared<NativeContext>();
+    native_ctx->udf_ctx.num_args = _argument_types.size();
+    if (context->state() != nullptr) {
+        native_ctx->query_mem_tracker = context->state()->query_mem_tracker();
+    }
+    native_ctx->mem_tracker = std::make_unique<MemTracker>("NativeUdf:" + get_name(),
+                                                           native_ctx->query_mem_tracker.get());
+    RETURN_IF_ERROR(_lookup(_fn.scalar_fn.symbol, &fn_ptr));
+    native_ctx->evaluate_fn = reinterpret_cast<DorisUdfEvaluateFn>(fn_ptr);
+    if (_fn.scalar_fn.__isset.close_fn_symbol && !_fn.scalar_fn.close_fn_symbol.empty()) {
+        RETURN_IF_ERROR(_lookup(_fn.scalar_fn.close_fn_symbol, &fn_ptr));
+        native_ctx->close_fn = reinterpret_cast<DorisUdfCloseFn>(fn_ptr);
+    }
+    context->set_function_state(FunctionContext::THREAD_LOCAL, native_ctx);
+
+    if (_fn.scalar_fn.__isset.prepare_fn_symbol && !_fn.scalar_fn.prepare_fn_symbol.empty()) {
+        RETURN_IF_ERROR(_lookup(_fn.scalar_fn.prepare_fn_symbol, &fn_ptr));
+        if (reinterpret_cast<DorisUdfPrepareFn>(fn_ptr)(&native_ctx->udf_ctx) != DORIS_UDF_OK) {
+            return Status::InternalError("failed to prepare native udf {}: {}", get_name(),
+                                         native_ctx->error);
+        }
+    }
+    native_ctx->is_prepared = true;
+    return Status::OK();
+}
+
+Status NativeFunctionCall::execute(FunctionContext* context, Block& block,
+                                   const ColumnNumbers& arguments, size_t result,
+                                   size_t num_rows, bool dry_run) {
+    auto* native_ctx = reinterpret_cast<NativeContext*>(
+            context->get_function_state(FunctionContext::THREAD_LOCAL));
+    if (native_ctx == nullptr || !native_ctx->is_prepared) {
+        return Status::InternalError("native udf {} is not opened", get_name());
+    }
+
+    // hold the full columns of the constant arguments during the call
+    std::vector<ColumnPtr> columns(arguments.size());
+    std::vector<DorisUdfColumn> args(arguments.size());
+    for (size_t i = 0; i < arguments.size(); ++i) {
+        columns[i] = block.get_by_position(arguments[i]).column->convert_to_full_column_if_const();
+        const IColumn* data_column = columns[i].get();
+        args[i].null_map = nullptr;
+        args[i].offsets = nullptr;
+        if (const auto* nullable = check_and_get_column<ColumnNullable>(data_column)) {
+            args[i].null_map = nullable->get_null_map_data().data();
+            data_column = &nullable->get_nested_column();
+        }
+        if (const auto* str = check_and_get_column<ColumnString>(data_column)) {
+            args[i].data = str->get_chars().data();
+            // offsets[-1] of ColumnString is always 0
+            args[i].offsets = str->get_offsets().data() - 1;
+        } else if (data_column->is_fixed_and_contiguous()) {
+            args[i].data = data_column->get_raw_data().data;
+        } else {
+            return Status::NotSupported("native udf {} does not support argument type {}",
+                                        get_name(), _argument_types[i]->get_name());
+        }
+    }
+
+    MutableColumnPtr result_column = remove_nullable(_return_type)->create_column();
+    ColumnUInt8::MutablePtr null_map;
+    DorisUdfResult udf_result;
+    udf_result.data = nullptr;
+    udf_result.null_map = nullptr;
+    udf_result.offsets = nullptr;
+    udf_result.reserve_chars = nullptr;
+    udf_result.host = nullptr;
+    if (_return_type->is_nullable()) {
+        null_map = ColumnUInt8::create(num_rows, 0);
+        udf_result.null_map = null_map->get_data().data();
+    }
+    auto* result_string = typeid_cast<ColumnString*>(result_column.get());
+    if (result_string != nullptr) {
+        result_string->get_offsets().resize_fill(num_rows, 0);
+        udf_result.offsets = result_string->get_offsets().data() - 1;
+        udf_result.reserve_chars = &reserve_string_chars;
+        udf_result.host = result_string;
+    } else if (result_column->is_fixed_and_contiguous()) {
+        result_column->insert_many_defaults(num_rows);
+        udf_result.data = const_cast<char*>(result_column->get_raw_data().data);
+    } else {
+        return Status::NotSupported("native udf {} does not support return type {}", get_name(),
+                                    _return_type->get_name());
+    }
+
+    if (num_rows > 0) {
+        native_ctx->error.clear();
+        if (native_ctx->evaluate_fn(&native_ctx->udf_ctx, args.data(), num_rows, &udf_result) !=
+            DORIS_UDF_OK) {
+            return Status::InternalError("failed to call native udf {}: {}", get_name(),
+                                         native_ctx->error);
+        }
+    }
+
+    if (result_string != nullptr) {
+        // a broken string column crashes the later operators, so check the offsets here
+        const auto& offsets = result_string->get_offsets();
+        size_t chars_size = result_string->get_chars().size();
+        for (size_t i = 0; i < num_rows; ++i) {
+            if (offsets[i] < offsets[i - 1] || offsets[i] > chars_size) {
+                return Status::InternalError(
+                        "native udf {} returns invalid offset {} at row {}, chars size is {}",
+                        get_name(), offsets[i], i, chars_size);
+            }
+        }
+        result_string->get_chars().resize(num_rows == 0 ? 0 : offsets[num_rows - 1]);
+    }
+    if (null_map != nullptr) {
+        block.replace_by_position(
+                result, ColumnNullable::create(std::move(result_column), std::move(null_map)));
+    } else {
+        block.replace_by_position(result, std::move(result_column));
+    }
+    return Status::OK();
+}
+
+Status NativeFunctionCall::close(FunctionContext* context,
+                                 FunctionContext::FunctionStateScope scope) {
+    if (scope == FunctionContext::THREAD_LOCAL) {
+        auto* native_ctx = reinterpret_cast<NativeContext*>(
+                context->get_function_state(FunctionContext::THREAD_LOCAL));
+        if (native_ctx != nullptr) {
+            native_ctx->close();
+        }
+    }
+    return Status::OK();
+}
+
+} // namespace doris::vectorized
@@ -0,0 +1,118 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <gen_cpp/Types_types.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include <memory>
+#include <string>
+#include <unordered_map>
+
+#include "common/status.h"
+#include "udf/native_udf.h"
+#include "udf/udf.h"
+#include "vec/core/block.h"
+#include "vec/core/column_numbers.h"
+#include "vec/core/columns_with_type_and_name.h"
+#include "vec/core/types.h"
+#include "vec/data_types/data_type.h"
+#include "vec/functions/function.h"
+
+namespace doris {
+class MemTracker;
+class MemTrackerLimiter;
+
+namespace vectorized {
+
+// Scalar UDF implemented by a shared library following the C ABI in udf/native_udf.h.
+// The library is loaded through UserFunctionCache, the arguments are passed as the
+// buffers of the columns and the result is written into the result column directly.
+// The memory allocated by the plugin through its context is accounted to a MemTracker
+// of the query, there is no other isolation, a crash of the plugin crashes the BE.
+class NativeFunctionCall : public IFunctionBase {
+public:
+    NativeFunctionCall(const TFunction& fn, const DataTypes& argument_types,
+                       const DataTypePtr& return_type);
+
+    static FunctionBasePtr create(const TFunction& fn, const ColumnsWithTypeAndName& argument_types,
+                                  const DataTypePtr& return_type) {
+        DataTypes data_types(argument_types.size());
+        for (size_t i = 0; i < argument_types.size(); ++i) {
+            data_types[i] = argument_types[i].type;
+        }
+        return std::make_shared<NativeFunctionCall>(fn, data_types, return_type);
+    }
+
+    String get_name() const override { return _fn.name.function_name; }
+
+    const DataTypes& get_argument_types() const override { return _argument_types; }
+    const DataTypePtr& get_return_type() const override { return _return_type; }
+
+    PreparedFunctionPtr prepare(FunctionContext* context, const Block& sample_block,
+                                const ColumnNumbers& arguments, size_t result) const override {
+        return nullptr;
+    }
+
+    Status open(FunctionContext* context, FunctionContext::FunctionStateScope scope) override;
+
+    Status execute(FunctionContext* context, Block& block, const ColumnNumbers& arguments,
+                   size_t result, size_t input_rows_count, bool dry_run = false) override;
+
+    Status close(FunctionContext* context, FunctionContext::FunctionStateScope scope) override;
+
+    bool is_deterministic() const override { return false; }
+
+    bool is_deterministic_in_scope_of_query() const override { return false; }
+
+    bool is_use_default_implementation_for_constants() const override { return true; }
+
+private:
+    // The per thread state of the plugin, set as the THREAD_LOCAL function state.
+    struct NativeContext {
+        DorisUdfContext udf_ctx;
+        DorisUdfEvaluateFn evaluate_fn = nullptr;
+        DorisUdfCloseFn close_fn = nullptr;
+        bool is_prepared = false;
+        std::string error;
+
+        std::shared_ptr<MemTrackerLimiter> query_mem_tracker;
+        std::unique_ptr<MemTracker> mem_tracker;
+        // the memory allocated through udf_ctx and not freed yet
+        std::unordered_map<void*, size_t> allocations;
+
+        NativeContext();
+        ~NativeContext();
+
+        void close();
+
+        static void* allocate(DorisUdfContext* ctx, size_t size);
+        static void free(DorisUdfContext* ctx, void* ptr);
+        static void set_error(DorisUdfContext* ctx, const char* message);
+    };
+
+    Status _lookup(const std::string& symbol, void** fn_ptr) const;
+
+    const TFunction _fn;
+    const DataTypes _argument_types;
+    const DataTypePtr _return_type;
+};
+
+} // namespace vectorized
+} // namespace doris
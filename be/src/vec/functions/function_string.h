@@ -745,10 +745,14 @@ public:
 
         std::vector<const ColumnString::Offsets*> offsets_list(argument_size);
         std::vector<const ColumnString::Chars*> chars_list(argument_size);
+        // the constant arguments are not expanded, their only row is read for every row
+        std::vector<uint8_t> const_list(argument_size);
 
         for (int i = 0; i < argument_size; ++i) {
-            argument_columns[i] =
-                    block.get_by_position(arguments[i]).column->convert_to_full_column_if_const();
+            bool is_const;
+            std::tie(argument_columns[i], is_const) =
+                    unpack_if_const(block.get_by_position(arguments[i]).column);
+            const_list[i] = is_const;
             auto col_str = assert_cast<const ColumnString*>(argument_columns[i].get());
             offsets_list[i] = &col_str->get_offsets();
             chars_list[i] = &col_str->get_chars();
@@ -765,7 +769,8 @@ public:
         // but it's not necessary to ignore it
         for (size_t i = 0; i < offsets_list.size(); ++i) {
             for (size_t j = 0; j < input_rows_count; ++j) {
-                size_t append = (*offsets_list[i])[j] - (*offsets_list[i])[j - 1];
+                size_t row = index_check_const(j, const_list[i]);
+                size_t append = (*offsets_list[i])[row] - (*offsets_list[i])[row - 1];
                 // check whether the concat output might overflow(unlikely)
                 if (UNLIKELY(UINT_MAX - append < res_reserve_size)) {
                     return Status::BufferAllocFailed("concat output is too large to allocate");
@@ -787,11 +792,12 @@ public:
                 auto& current_offsets = *offsets_list[j];
                 auto& current_chars = *chars_list[j];
 
-                int size = current_offsets[i] - current_offsets[i - 1];
+                size_t row = index_check_const(i, const_list[j]);
+                int size = current_offsets[row] - current_offsets[row - 1];
                 if (size > 0) {
                     memcpy_small_allow_read_write_overflow15(
                             &res_data[res_offset[i - 1]] + current_length,
-                            &current_chars[current_offsets[i - 1]], size);
+                            &current_chars[current_offsets[row - 1]], size);
                     current_length += size;
                 }
             }
@@ -1402,19 +1408,18 @@ public:
         auto& res_chars = res->get_chars();
         res_offsets.resize(input_rows_count);
 
-        const size_t argument_size = arguments.size();
-        ColumnPtr argument_columns[argument_size];
-        for (size_t i = 0; i < argument_size; ++i) {
-            argument_columns[i] =
-                    block.get_by_position(arguments[i]).column->convert_to_full_column_if_const();
-            if (auto* nullable = check_and_get_column<const ColumnNullable>(*argument_columns[i])) {
-                // Danger: Here must dispose the null map data first! Because
-                // argument_columns[i]=nullable->get_nested_column_ptr(); will release the mem
-                // of column nullable mem of null map
-                VectorizedUtils::update_null_map(null_map->get_data(),
-                                                 nullable->get_null_map_data());
-                argument_columns[i] = nullable->get_nested_column_ptr();
-            }
+        // the delimiter and the part number are mostly constant, they are not expanded
+        bool col_const[3];
+        ColumnPtr argument_columns[3];
+        argument_columns[0] =
+                block.get_by_position(arguments[0]).column->convert_to_full_column_if_const();
+        col_const[0] = false;
+        for (int i = 1; i < 3; ++i) {
+            std::tie(argument_columns[i], col_const[i]) =
+                    unpack_if_const(block.get_by_position(arguments[i]).column);
+        }
+        for (int i = 0; i < 3; ++i) {
+            check_set_nullable(argument_columns[i], null_map, col_const[i]);
         }
 
         auto str_col = assert_cast<const ColumnString*>(argument_columns[0].get());
@@ -1425,14 +1430,13 @@ public:
         auto& part_num_col_data = part_num_col->get_data();
 
         for (size_t i = 0; i < input_rows_count; ++i) {
-            if (part_num_col_data[i] == 0) {
+            auto part_number = part_num_col_data[index_check_const(i, col_const[2])];
+            if (part_number == 0) {
                 StringOP::push_null_string(i, res_chars, res_offsets, null_map_data);
                 continue;
             }
 
-            auto delimiter = delimiter_col->get_data_at(i);
-            auto delimiter_str = delimiter_col->get_data_at(i).to_string();
-            auto part_number = part_num_col_data[i];
+            auto delimiter = delimiter_col->get_data_at(index_check_const(i, col_const[1]));
             auto str = str_col->get_data_at(i);
             if (delimiter.size == 0) {
                 StringOP::push_empty_string(i, res_chars, res_offsets);
@@ -1449,7 +1453,7 @@ public:
                         pre_offset = offset;
                         size_t n = str.size - offset - 1;
                         const char* pos = reinterpret_cast<const char*>(
-                                memchr(str.data + offset + 1, delimiter_str[0], n));
+                                memchr(str.data + offset + 1, delimiter.data[0], n));
                         if (pos != nullptr) {
                             offset = pos - str.data;
                             num++;
@@ -2492,18 +2496,26 @@ public:
                         size_t result, size_t input_rows_count) override {
         auto col_origin =
                 block.get_by_position(arguments[0]).column->convert_to_full_column_if_const();
-        auto col_old =
-                block.get_by_position(arguments[1]).column->convert_to_full_column_if_const();
-        auto col_new =
-                block.get_by_position(arguments[2]).column->convert_to_full_column_if_const();
+        const auto& [col_old, old_const] =
+                unpack_if_const(block.get_by_position(arguments[1]).column);
+        const auto& [col_new, new_const] =
+                unpack_if_const(block.get_by_position(arguments[2]).column);
+        const auto* origin = assert_cast<const ColumnString*>(col_origin.get());
+        const auto* old_strs = assert_cast<const ColumnString*>(col_old.get());
+        const auto* new_strs = assert_cast<const ColumnString*>(col_new.get());
 
         ColumnString::MutablePtr col_res = ColumnString::create();
+        if (old_const && new_const) {
+            replace_const(*origin, old_strs->get_data_at(0), new_strs->get_data_at(0),
+                          col_res->get_chars(), col_res->get_offsets());
+            block.replace_by_position(result, std::move(col_res));
+            return Status::OK();
+        }
 
         for (int i = 0; i < input_rows_count; ++i) {
-            StringRef origin_str =
-                    assert_cast<const ColumnString*>(col_origin.get())->get_data_at(i);
-            StringRef old_str = assert_cast<const ColumnString*>(col_old.get())->get_data_at(i);
-            StringRef new_str = assert_cast<const ColumnString*>(col_new.get())->get_data_at(i);
+            StringRef origin_str = origin->get_data_at(i);
+            StringRef old_str = old_strs->get_data_at(index_check_const(i, old_const));
+            StringRef new_str = new_strs->get_data_at(index_check_const(i, new_const));
 
             std::string result = replace(origin_str.to_string(), old_str.to_string_view(),
                                          new_str.to_string_view());
@@ -2515,6 +2527,38 @@ public:
     }
 
 private:
+    // Replace the constant old_str with the constant new_str, e.g. replace(s, ',', ';'). The
+    // searcher of old_str is built once and the result is written to res_chars directly
+    // instead of copying each row into a std::string.
+    static void replace_const(const ColumnString& origin, const StringRef& old_str,
+                              const StringRef& new_str, ColumnString::Chars& res_chars,
+                              ColumnString::Offsets& res_offsets) {
+        if (old_str.size == 0) {
+            res_chars.assign(origin.get_chars().begin(), origin.get_chars().end());
+            res_offsets.assign(origin.get_offsets().begin(), origin.get_offsets().end());
+            return;
+        }
+        size_t rows = origin.size();
+        res_offsets.resize(rows);
+        res_chars.reserve(origin.get_chars().size());
+        ASCIICaseSensitiveStringSearcher searcher(old_str.data, old_str.size);
+        for (size_t i = 0; i < rows; ++i) {
+            StringRef str = origin.get_data_at(i);
+            const char* pos = str.data;
+            const char* end = str.data + str.size;
+            while (true) {
+                const char* match = searcher.search(pos, end);
+                res_chars.insert(pos, match);
+                if (match == end) {
+                    break;
+                }
+                res_chars.insert(new_str.data, new_str.data + new_str.size);
+                pos = match + old_str.size;
+            }
+            res_offsets[i] = res_chars.size();
+        }
+    }
+
     std::string replace(std::string str, std::string_view old_str, std::string_view new_str) {
         if (old_str.empty()) {
             return str;
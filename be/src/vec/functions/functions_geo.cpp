@@ -26,6 +26,9 @@
 #include "geo/geo_common.h"
 #include "geo/geo_types.h"
 #include "vec/columns/column.h"
+#include "vec/columns/column_const.h"
+#include "vec/columns/columns_number.h"
+#include "vec/common/assert_cast.h"
 #include "vec/common/string_ref.h"
 #include "vec/core/block.h"
 #include "vec/core/column_with_type_and_name.h"
@@ -185,21 +188,29 @@ struct StDistanceSphere {
         DCHECK_EQ(arguments.size(), 4);
         auto return_type = block.get_data_type(result);
 
-        auto x_lng = block.get_by_position(arguments[0]).column->convert_to_full_column_if_const();
-        auto x_lat = block.get_by_position(arguments[1]).column->convert_to_full_column_if_const();
-        auto y_lng = block.get_by_position(arguments[2]).column->convert_to_full_column_if_const();
-        auto y_lat = block.get_by_position(arguments[3]).column->convert_to_full_column_if_const();
+        // read the coordinates from the raw data, the constant center of a distance filter
+        // is not expanded to a full column
+        const ColumnFloat64::Container* coords[4];
+        bool is_const[4];
+        for (int i = 0; i < 4; ++i) {
+            const auto& [column, column_is_const] =
+                    unpack_if_const(block.get_by_position(arguments[i]).column);
+            coords[i] = &assert_cast<const ColumnFloat64&>(*column).get_data();
+            is_const[i] = column_is_const;
+        }
 
-        const auto size = x_lng->size();
+        const auto size = block.get_by_position(arguments[0]).column->size();
 
         MutableColumnPtr res = return_type->create_column();
+        res->reserve(size);
 
         for (int row = 0; row < size; ++row) {
+            double values[4];
+            for (int i = 0; i < 4; ++i) {
+                values[i] = (*coords[i])[is_const[i] ? 0 : row];
+            }
             double distance = 0;
-            if (!GeoPoint::ComputeDistance(x_lng->operator[](row).get<Float64>(),
-                                           x_lat->operator[](row).get<Float64>(),
-                                           y_lng->operator[](row).get<Float64>(),
-                                           y_lat->operator[](row).get<Float64>(), &distance)) {
+            if (!GeoPoint::ComputeDistance(values[0], values[1], values[2], values[3], &distance)) {
                 res->insert_data(nullptr, 0);
                 continue;
             }
@@ -464,21 +475,30 @@ struct StContains {
                           size_t result) {
         DCHECK_EQ(arguments.size(), 2);
         auto return_type = block.get_data_type(result);
-        auto shape1 = block.get_by_position(arguments[0]).column->convert_to_full_column_if_const();
-        auto shape2 = block.get_by_position(arguments[1]).column->convert_to_full_column_if_const();
-
-        const auto size = shape1->size();
+        const auto& [shape1, shape1_const] =
+                unpack_if_const(block.get_by_position(arguments[0]).column);
+        const auto& [shape2, shape2_const] =
+                unpack_if_const(block.get_by_position(arguments[1]).column);
+        const IColumn* columns[2] = {shape1.get(), shape2.get()};
+        bool is_const[2] = {shape1_const, shape2_const};
+
+        const auto size = block.get_by_position(arguments[0]).column->size();
         MutableColumnPtr res = return_type->create_column();
+        res->reserve(size);
 
         int i;
         std::vector<std::shared_ptr<GeoShape>> shapes = {nullptr, nullptr};
         for (int row = 0; row < size; ++row) {
-            auto lhs_value = shape1->get_data_at(row);
-            auto rhs_value = shape2->get_data_at(row);
-            StringRef* strs[2] = {&lhs_value, &rhs_value};
             for (i = 0; i < 2; ++i) {
+                // a constant shape, e.g. the polygon of a region filter, is decoded only once
+                if (is_const[i] && row > 0) {
+                    continue;
+                }
+                auto value = columns[i]->get_data_at(is_const[i] ? 0 : row);
                 shapes[i] = std::shared_ptr<GeoShape>(
-                        GeoShape::from_encoded(strs[i]->data, strs[i]->size));
+                        GeoShape::from_encoded(value.data, value.size));
+            }
+            for (i = 0; i < 2; ++i) {
                 if (shapes[i] == nullptr) {
                     res->insert_data(nullptr, 0);
                     break;
@@ -251,6 +251,10 @@ public:
 
     Status open(FunctionContext* context, FunctionContext::FunctionStateScope scope) override;
 
+    // convert a LIKE pattern to the regex of hyperscan and re2
+    static void convert_like_pattern(LikeSearchState* state, const std::string& pattern,
+                                     std::string* re_pattern);
+
     friend struct LikeSearchState;
 
 private:
@@ -265,9 +269,6 @@ private:
     static Status like_fn_scalar(LikeSearchState* state, const StringRef& val,
                                  const StringRef& pattern, unsigned char* result);
 
-    static void convert_like_pattern(LikeSearchState* state, const std::string& pattern,
-                                     std::string* re_pattern);
-
     static void remove_escape_character(std::string* search_string);
 };
 
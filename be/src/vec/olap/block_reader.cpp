@@ -32,6 +32,7 @@
 #include "common/status.h"
 #include "exprs/function_filter.h"
 #include "olap/like_column_predicate.h"
+#include "olap/merged_agg_block_cache.h"
 #include "olap/olap_common.h"
 #include "olap/olap_define.h"
 #include "olap/rowset/rowset.h"
@@ -95,8 +96,16 @@ Status BlockReader::_init_collect_iter(const ReaderParams& read_params) {
                      << ", version:" << read_params.version;
         return res;
     }
-    // check if rowsets are noneoverlapping
-    _is_rowsets_overlapping = _rowsets_overlapping(read_params.rs_readers);
+    std::vector<RowsetReaderSharedPtr> rs_readers = read_params.rs_readers;
+    bool use_merged_agg_blocks = false;
+    if (read_params.use_merged_agg_block_cache) {
+        RETURN_IF_ERROR(_replace_with_merged_agg_blocks(read_params, &rs_readers,
+                                                        &use_merged_agg_blocks));
+    }
+    // check if rowsets are noneoverlapping, the merged rows of the base versions have no
+    // rowset meta of their own
+    _is_rowsets_overlapping = use_merged_agg_blocks ? rs_readers.size() > 1
+                                                    : _rowsets_overlapping(rs_readers);
     _vcollect_iter.init(this, _is_rowsets_overlapping, read_params.read_orderby_key,
                         read_params.read_orderby_key_reverse,
                         read_params.rs_readers_segment_offsets);
@@ -104,11 +113,11 @@ Status BlockReader::_init_collect_iter(const ReaderParams& read_params) {
     _reader_context.push_down_agg_type_opt = read_params.push_down_agg_type_opt;
     std::vector<RowsetReaderSharedPtr> valid_rs_readers;
     DCHECK(read_params.rs_readers_segment_offsets.empty() ||
-           read_params.rs_readers_segment_offsets.size() == read_params.rs_readers.size());
+           read_params.rs_readers_segment_offsets.size() == rs_readers.size());
 
     bool is_empty = read_params.rs_readers_segment_offsets.empty();
-    for (int i = 0; i < read_params.rs_readers.size(); ++i) {
-        auto& rs_reader = read_params.rs_readers[i];
+    for (int i = 0; i < rs_readers.size(); ++i) {
+        auto& rs_reader = rs_readers[i];
 
         // _vcollect_iter.topn_next() will init rs_reader by itself
         if (!_vcollect_iter.use_topn_next()) {
@@ -137,6 +146,139 @@ Status BlockReader::_init_collect_iter(const ReaderParams& read_params) {
     return Status::OK();
 }
 
+bool BlockReader::_can_use_merged_agg_blocks(const ReaderParams& read_params) {
+    // the cached rows are neither filtered nor limited, so any filter pushed down to the
+    // storage makes them useless for the read
+    return read_params.reader_type == ReaderType::READER_QUERY &&
+           read_params.tablet->keys_type() == KeysType::AGG_KEYS && !read_params.direct_mode &&
+           MergedAggBlockCache::instance() != nullptr && read_params.start_key.empty() &&
+           read_params.end_key.empty() && read_params.conditions.empty() &&
+           read_params.bloom_filters.empty() && read_params.bitmap_filters.empty() &&
+           read_params.in_filters.empty() &&
+           read_params.conditions_except_leafnode_of_andnode.empty() &&
+           read_params.function_filters.empty() &&
+           read_params.remaining_vconjunct_root == nullptr &&
+           read_params.remaining_conjunct_roots.empty() &&
+           read_params.common_expr_ctxs_push_down.empty() &&
+           read_params.filter_block_conjuncts.empty() &&
+           read_params.late_runtime_filter_predicates == nullptr && !read_params.use_topn_opt &&
+           !read_params.read_orderby_key && read_params.read_limit == 0 &&
+           read_params.push_down_agg_type_opt == TPushAggOp::NONE && !read_params.record_rowids &&
+           read_params.rs_readers_segment_offsets.empty();
+}
+
+// The base versions [0, v] are the rowsets below the cumulative point. Their merged rows are
+// read from MergedAggBlockCache, or merged by another reader and put into the cache on a miss,
+// then `rs_readers` becomes the reader of the merged rows followed by the later versions.
+Status BlockReader::_replace_with_merged_agg_blocks(const ReaderParams& read_params,
+                                                    std::vector<RowsetReaderSharedPtr>* rs_readers,
+                                                    bool* replaced) {
+    *replaced = false;
+    if (!_can_use_merged_agg_blocks(read_params)) {
+        return Status::OK();
+    }
+    int64_t cumulative_point = read_params.tablet->cumulative_layer_point();
+    std::vector<RowsetReaderSharedPtr> base_readers;
+    std::vector<RowsetReaderSharedPtr> delta_readers;
+    int64_t base_version = -1;
+    RowsetSharedPtr largest_base_rowset;
+    for (const auto& rs_reader : *rs_readers) {
+        Version version = rs_reader->version();
+        if (version.second < cumulative_point) {
+            // the base rowsets are the first ones and continuous
+            if (!delta_readers.empty() || version.first != base_version + 1) {
+                return Status::OK();
+            }
+            base_version = version.second;
+            base_readers.push_back(rs_reader);
+            if (largest_base_rowset == nullptr ||
+                rs_reader->rowset()->num_rows() > largest_base_rowset->num_rows()) {
+                largest_base_rowset = rs_reader->rowset();
+            }
+        } else if (version.first >= cumulative_point) {
+            delta_readers.push_back(rs_reader);
+        } else {
+            // crossing the cumulative point
+            return Status::OK();
+        }
+    }
+    // a single rowset is read as fast as the cached rows
+    if (base_readers.size() < 2) {
+        return Status::OK();
+    }
+    // the deletes of later versions would have to be applied on the cached rows
+    for (const auto& delete_pred : read_params.delete_predicates) {
+        if (delete_pred->version().first > base_version) {
+            return Status::OK();
+        }
+    }
+
+    auto* cache = MergedAggBlockCache::instance();
+    std::string key = MergedAggBlockCache::cache_key(
+            read_params.tablet->tablet_id(), read_params.tablet->schema_hash(), *_tablet_schema,
+            base_version, read_params.return_columns,
+            read_params.tablet_columns_convert_to_null_set);
+    std::shared_ptr<const MergedAggBlockCache::Blocks> blocks;
+    if (cache->lookup(key, &blocks)) {
+        _stats.merged_agg_block_cache_hit++;
+    } else {
+        _stats.merged_agg_block_cache_miss++;
+        // the size on disk is compressed, so the merged rows are at least as large
+        size_t base_disk_size = 0;
+        for (const auto& rs_reader : base_readers) {
+            base_disk_size += rs_reader->rowset()->data_disk_size();
+        }
+        if (base_disk_size > cache->max_charge()) {
+            return Status::OK();
+        }
+        RETURN_IF_ERROR(_merge_base_versions(read_params, base_readers, base_version, &blocks));
+        size_t charge = 0;
+        for (const auto& block : *blocks) {
+            charge += block.allocated_bytes();
+        }
+        if (charge <= cache->max_charge()) {
+            cache->insert(key, blocks);
+        }
+    }
+
+    rs_readers->clear();
+    rs_readers->push_back(std::make_shared<MergedAggBlockRowsetReader>(
+            std::move(blocks), Version(0, base_version), std::move(largest_base_rowset)));
+    rs_readers->insert(rs_readers->end(), delta_readers.begin(), delta_readers.end());
+    *replaced = true;
+    return Status::OK();
+}
+
+Status BlockReader::_merge_base_versions(
+        const ReaderParams& read_params, const std::vector<RowsetReaderSharedPtr>& base_readers,
+        int64_t base_version, std::shared_ptr<const MergedAggBlockCache::Blocks>* blocks) {
+    ReaderParams base_params = read_params;
+    base_params.version = Version(0, base_version);
+    base_params.rs_readers = base_readers;
+    // the merged rows have the layout of the blocks read from a rowset
+    base_params.origin_return_columns = &base_params.return_columns;
+    base_params.use_merged_agg_block_cache = false;
+    base_params.profile = nullptr;
+
+    BlockReader base_reader;
+    base_reader.set_batch_size(batch_size());
+    RETURN_IF_ERROR(base_reader.init(base_params));
+
+    auto merged_blocks = std::make_shared<MergedAggBlockCache::Blocks>();
+    bool eof = false;
+    while (!eof) {
+        Block block = _tablet_schema->create_block(base_params.return_columns,
+                                                   base_params.tablet_columns_convert_to_null_set);
+        RETURN_IF_ERROR(base_reader.next_block_with_aggregation(&block, &eof));
+        if (block.rows() > 0) {
+            merged_blocks->push_back(std::move(block));
+        }
+    }
+    _stats.raw_rows_read += base_reader.stats().raw_rows_read;
+    *blocks = std::move(merged_blocks);
+    return Status::OK();
+}
+
 void BlockReader::_init_agg_state(const ReaderParams& read_params) {
     if (_eof) {
         return;
@@ -24,6 +24,7 @@
 #include <vector>
 
 #include "common/status.h"
+#include "olap/merged_agg_block_cache.h"
 #include "olap/reader.h"
 #include "olap/rowset/rowset_reader.h"
 #include "olap/utils.h"
@@ -76,6 +77,18 @@ private:
 
     Status _init_collect_iter(const ReaderParams& read_params);
 
+    bool _can_use_merged_agg_blocks(const ReaderParams& read_params);
+
+    Status _replace_with_merged_agg_blocks(const ReaderParams& read_params,
+                                           std::vector<RowsetReaderSharedPtr>* rs_readers,
+                                           bool* replaced);
+
+    // Merge and aggregate the rows of the base versions with another reader.
+    Status _merge_base_versions(const ReaderParams& read_params,
+                                const std::vector<RowsetReaderSharedPtr>& base_readers,
+                                int64_t base_version,
+                                std::shared_ptr<const MergedAggBlockCache::Blocks>* blocks);
+
     void _init_agg_state(const ReaderParams& read_params);
 
     void _insert_data_normal(MutableColumns& columns);
@@ -120,7 +120,11 @@ Status VCollectIterator::build_heap(std::vector<RowsetReaderSharedPtr>& rs_reade
     }
 
     DCHECK(rs_readers.size() == _children.size());
-    _skip_same = _reader->_tablet_schema->keys_type() == KeysType::UNIQUE_KEYS;
+    // The merge of a merge-on-write table is only for the order of keys, there is no row of the
+    // same key left after filtering by the delete bitmap.
+    _skip_same = _reader->_tablet_schema->keys_type() == KeysType::UNIQUE_KEYS &&
+                 !(_reader->_tablet->enable_unique_key_merge_on_write() &&
+                   _reader->_reader_context.delete_bitmap != nullptr);
     if (_children.empty()) {
         _inner_iter.reset(nullptr);
         return Status::OK();
@@ -604,13 +608,7 @@ VCollectIterator::Level1Iterator::~Level1Iterator() {
     }
 
     if (_heap) {
-        while (!_heap->empty()) {
-            auto child = _heap->top();
-            _heap->pop();
-            if (child) {
-                delete child;
-            }
-        }
+        _heap->for_each([](LevelIterator* child) { delete child; });
     }
 }
 
@@ -669,11 +667,7 @@ Status VCollectIterator::Level1Iterator::init(bool get_data_by_ref) {
             }
         }
         _heap.reset(new MergeHeap {LevelIteratorComparator(sequence_loc, _is_reverse)});
-        for (auto child : _children) {
-            DCHECK(child != nullptr);
-            //DCHECK(child->current_row().ok());
-            _heap->push(child);
-        }
+        _heap->init(std::vector<LevelIterator*>(_children.begin(), _children.end()));
         _cur_child = _heap->top();
         // Clear _children earlier to release any related references
         _children.clear();
@@ -708,13 +702,14 @@ Status VCollectIterator::Level1Iterator::init_level0_iterators_for_union() {
 }
 
 Status VCollectIterator::Level1Iterator::_merge_next(IteratorRowRef* ref) {
-    _heap->pop();
     auto res = _cur_child->next(ref);
     if (LIKELY(res.ok())) {
-        _heap->push(_cur_child);
+        // only one comparison with the runner-up while the child stays the minimum
+        _heap->update_top();
         _cur_child = _heap->top();
     } else if (res.is<END_OF_FILE>()) {
         // current child has been read, to read next
+        _heap->pop_top();
         delete _cur_child;
         if (!_heap->empty()) {
             _cur_child = _heap->top();
@@ -25,21 +25,12 @@
 #include <vector>
 
 #include "common/status.h"
-#include "olap/rowset/rowset_reader_context.h"
-#include "olap/utils.h"
-#ifdef USE_LIBCPP
-#include <queue>
-#else
-#include <ext/pb_ds/priority_queue.hpp>
-#endif
-
 #include "olap/reader.h"
 #include "olap/rowset/rowset_reader.h"
+#include "olap/rowset/rowset_reader_context.h"
+#include "olap/utils.h"
 #include "vec/core/block.h"
-
-namespace __gnu_pbds {
-struct pairing_heap_tag;
-} // namespace __gnu_pbds
+#include "vec/core/loser_tree.h"
 
 namespace doris {
 
@@ -112,7 +103,7 @@ private:
     // This interface is the actual implementation of the new version of iterator.
     // It currently contains two implementations, one is Level0Iterator,
     // which only reads data from the rowset reader, and the other is Level1Iterator,
-    // which can read merged data from multiple LevelIterators through MergeHeap.
+    // which can read merged data from multiple LevelIterators through a loser tree.
     // By using Level1Iterator, some rowset readers can be merged in advance and
     // then merged with other rowset readers.
     class LevelIterator {
@@ -171,13 +162,7 @@ private:
         bool _is_reverse = false;
     };
 
-#ifdef USE_LIBCPP
-    using MergeHeap = std::priority_queue<LevelIterator*, std::vector<LevelIterator*>,
-                                          LevelIteratorComparator>;
-#else
-    using MergeHeap = __gnu_pbds::priority_queue<LevelIterator*, LevelIteratorComparator,
-                                                 __gnu_pbds::pairing_heap_tag>;
-#endif
+    using MergeHeap = LoserTree<LevelIterator*, LevelIteratorComparator>;
 
     // Iterate from rowset reader. This Iterator usually like a leaf node
     class Level0Iterator : public LevelIterator {
@@ -302,7 +287,7 @@ private:
         LevelIterator* _cur_child = nullptr;
         TabletReader* _reader = nullptr;
 
-        // when `_merge == true`, rowset reader returns ordered rows and VCollectIterator uses a priority queue to merge
+        // when `_merge == true`, rowset reader returns ordered rows and VCollectIterator uses a loser tree to merge
         // sort them. The output of VCollectIterator is also ordered.
         // When `_merge == false`, rowset reader returns *partial* ordered rows. VCollectIterator simply returns all rows
         // from the first rowset, the second rowset, .., the last rowset. The output of CollectorIterator is also
@@ -83,16 +83,29 @@ Status RowSourcesBuffer::append(const std::vector<RowSource>& row_sources) {
 Status RowSourcesBuffer::seek_to_begin() {
     _buf_idx = 0;
     if (_fd > 0) {
-        auto offset = lseek(_fd, 0, SEEK_SET);
-        if (offset != 0) {
-            LOG(WARNING) << "failed to seek to 0";
-            return Status::InternalError("failed to seek to 0");
-        }
+        _file_offset = 0;
         _reset_buffer();
     }
     return Status::OK();
 }
 
+Status RowSourcesBuffer::clone(std::unique_ptr<RowSourcesBuffer>* buffer) const {
+    auto cloned = std::make_unique<RowSourcesBuffer>(_tablet_id, _tablet_path, _reader_type);
+    cloned->_total_size = _total_size;
+    if (_fd > 0) {
+        DCHECK(_buffer->empty()) << "row sources buffer must be flushed before clone";
+        cloned->_fd = ::dup(_fd);
+        if (cloned->_fd < 0) {
+            LOG(WARNING) << "failed to dup row sources buffer file, errno=" << errno;
+            return Status::InternalError("failed to dup row sources buffer file");
+        }
+    } else {
+        cloned->_buffer->insert_range_from(*_buffer, 0, _buffer->size());
+    }
+    *buffer = std::move(cloned);
+    return Status::OK();
+}
+
 Status RowSourcesBuffer::has_remaining() {
     if (_buf_idx < _buffer->size()) {
         return Status::OK();
@@ -207,7 +220,7 @@ Status RowSourcesBuffer::_serialize() {
 
 Status RowSourcesBuffer::_deserialize() {
     size_t rows = 0;
-    ssize_t bytes_read = ::read(_fd, &rows, sizeof(rows));
+    ssize_t bytes_read = ::pread(_fd, &rows, sizeof(rows), _file_offset);
     if (bytes_read == 0) {
         LOG(WARNING) << "end of row source buffer file";
         return Status::EndOfFile("end of row source buffer file");
@@ -215,14 +228,16 @@ Status RowSourcesBuffer::_deserialize() {
         LOG(WARNING) << "failed to read buffer size from file, bytes_read=" << bytes_read;
         return Status::InternalError("failed to read buffer size from file");
     }
+    _file_offset += bytes_read;
     _buffer->resize(rows);
     auto& internal_data = _buffer->get_data();
-    bytes_read = ::read(_fd, internal_data.data(), rows * sizeof(UInt16));
+    bytes_read = ::pread(_fd, internal_data.data(), rows * sizeof(UInt16), _file_offset);
     if (bytes_read != rows * sizeof(UInt16)) {
         LOG(WARNING) << "failed to read buffer data from file, bytes_read=" << bytes_read
                      << ", expect bytes=" << rows * sizeof(UInt16);
         return Status::InternalError("failed to read buffer data from file");
     }
+    _file_offset += bytes_read;
     return Status::OK();
 }
 
@@ -396,7 +411,6 @@ Status VerticalHeapMergeIterator::next_batch(Block* block) {
         }
 
         auto ctx = _merge_heap.top();
-        _merge_heap.pop();
         if (ctx->is_same()) {
             tmp_row_sources.emplace_back(ctx->order(), true);
         } else {
@@ -432,24 +446,30 @@ Status VerticalHeapMergeIterator::next_batch(Block* block) {
 
         RETURN_IF_ERROR(ctx->advance());
         if (ctx->valid()) {
-            _merge_heap.push(ctx);
+            _merge_heap.update_top();
         } else {
-            // push next iterator in same rowset into heap
+            // replace ctx with the next iterator in same rowset
             auto cur_order = ctx->order();
+            VerticalMergeIteratorContext* next_ctx = nullptr;
             while (cur_order + 1 < _iterator_init_flags.size() &&
                    !_iterator_init_flags[cur_order + 1]) {
-                auto next_ctx = _ori_iter_ctx[cur_order + 1];
+                next_ctx = _ori_iter_ctx[cur_order + 1];
                 DCHECK(next_ctx);
                 RETURN_IF_ERROR(next_ctx->init(_opts));
                 if (!next_ctx->valid()) {
                     // next_ctx is empty segment, move to next
                     ++cur_order;
                     delete next_ctx;
+                    next_ctx = nullptr;
                     continue;
                 }
-                _merge_heap.push(next_ctx);
                 break;
             }
+            if (next_ctx != nullptr) {
+                _merge_heap.replace_top(next_ctx);
+            } else {
+                _merge_heap.pop_top();
+            }
             // Release ctx earlier to reduce resource consumed
             delete ctx;
         }
@@ -480,23 +500,30 @@ Status VerticalHeapMergeIterator::init(const StorageReadOptions& opts) {
     // will not be pushed into heap, we should init next one util we find a valid iter
     // so this rowset can work in heap
     bool pre_iter_invalid = false;
+    std::vector<VerticalMergeIteratorContext*> ctxs;
     for (auto& iter : _origin_iters) {
         VerticalMergeIteratorContext* ctx = new VerticalMergeIteratorContext(
                 std::move(iter), _rowset_ids[seg_order], _ori_return_cols, seg_order, _seq_col_idx);
         _ori_iter_ctx.push_back(ctx);
         if (_iterator_init_flags[seg_order] || pre_iter_invalid) {
-            RETURN_IF_ERROR(ctx->init(opts));
+            Status st = ctx->init(opts);
+            if (!st.ok()) {
+                // the contexts in the tree are released by the destructor
+                _merge_heap.init(std::move(ctxs));
+                return st;
+            }
             if (!ctx->valid()) {
                 pre_iter_invalid = true;
                 ++seg_order;
                 delete ctx;
                 continue;
             }
-            _merge_heap.push(ctx);
+            ctxs.push_back(ctx);
             pre_iter_invalid = false;
         }
         ++seg_order;
     }
+    _merge_heap.init(std::move(ctxs));
     _origin_iters.clear();
 
     _opts = opts;
@@ -22,7 +22,6 @@
 #include <algorithm>
 #include <list>
 #include <memory>
-#include <queue>
 #include <string>
 #include <utility>
 #include <vector>
@@ -36,6 +35,7 @@
 #include "vec/columns/column_vector.h"
 #include "vec/columns/columns_number.h"
 #include "vec/core/block.h"
+#include "vec/core/loser_tree.h"
 
 #pragma once
 
@@ -118,6 +118,10 @@ public:
 
     Status seek_to_begin();
 
+    // Create a buffer of the same row sources with its own read position, so that the value
+    // column groups can be merged concurrently. Must be called after flush().
+    Status clone(std::unique_ptr<RowSourcesBuffer>* buffer) const;
+
     size_t same_source_count(uint16_t source, size_t limit);
 
     // return continous agg_flag=true count from index
@@ -137,6 +141,8 @@ private:
     ReaderType _reader_type = ReaderType::UNKNOWN;
     uint64_t _buf_idx = 0;
     int _fd = -1;
+    // read offset of the buffer file, the buffers cloned share the file
+    off_t _file_offset = 0;
     ColumnUInt16::MutablePtr _buffer;
     uint64_t _total_size = 0;
 };
@@ -246,11 +252,7 @@ public:
               _row_sources_buf(row_sources_buf) {}
 
     ~VerticalHeapMergeIterator() override {
-        while (!_merge_heap.empty()) {
-            auto ctx = _merge_heap.top();
-            _merge_heap.pop();
-            delete ctx;
-        }
+        _merge_heap.for_each([](VerticalMergeIteratorContext* ctx) { delete ctx; });
     }
 
     Status init(const StorageReadOptions& opts) override;
@@ -281,9 +283,7 @@ private:
         }
     };
 
-    using VMergeHeap = std::priority_queue<VerticalMergeIteratorContext*,
-                                           std::vector<VerticalMergeIteratorContext*>,
-                                           VerticalMergeContextComparator>;
+    using VMergeHeap = LoserTree<VerticalMergeIteratorContext*, VerticalMergeContextComparator>;
 
     VMergeHeap _merge_heap;
     std::vector<VerticalMergeIteratorContext*> _ori_iter_ctx;
@@ -55,6 +55,7 @@ struct SharedHashTableContext {
 
     Status status;
     std::shared_ptr<Arena> arena;
+    std::vector<std::shared_ptr<Arena>> parallel_build_arenas;
     std::shared_ptr<void> hash_table_variants;
     std::shared_ptr<std::vector<Block>> blocks;
     std::map<int, SharedRuntimeFilterContext> runtime_filters;
@@ -90,13 +90,43 @@ std::shared_ptr<VDataStreamRecvr> VDataStreamMgr::find_recvr(const TUniqueId& fr
 }
 
 Status VDataStreamMgr::transmit_block(const PTransmitDataParams* request,
-                                      ::google::protobuf::Closure** done) {
+                                      ::google::protobuf::Closure** done,
+                                      int64_t* receiver_free_bytes) {
     const PUniqueId& finst_id = request->finst_id();
     TUniqueId t_finst_id;
     t_finst_id.hi = finst_id.hi();
     t_finst_id.lo = finst_id.lo();
+    bool eos = request->eos();
+    // deliver the broadcast block to the other receivers of this BE first, since the request
+    // may be released once it is added to the receiver which may hold the closure
+    bool has_broadcast_recvr = false;
+    for (const auto& broadcast_finst_id : request->broadcast_finst_ids()) {
+        TUniqueId t_broadcast_finst_id;
+        t_broadcast_finst_id.hi = broadcast_finst_id.hi();
+        t_broadcast_finst_id.lo = broadcast_finst_id.lo();
+        auto broadcast_recvr = find_recvr(t_broadcast_finst_id, request->node_id());
+        if (broadcast_recvr == nullptr) {
+            continue;
+        }
+        has_broadcast_recvr = true;
+        if (request->has_query_statistics()) {
+            broadcast_recvr->add_sub_plan_statistics(request->query_statistics(),
+                                                     request->sender_id());
+        }
+        if (request->has_block()) {
+            broadcast_recvr->add_block(request->block(), request->sender_id(),
+                                       request->be_number(), request->packet_seq(), nullptr);
+        }
+        if (eos) {
+            broadcast_recvr->remove_sender(request->sender_id(), request->be_number());
+        }
+    }
+
     auto recvr = find_recvr(t_finst_id, request->node_id());
     if (recvr == nullptr) {
+        if (has_broadcast_recvr) {
+            return Status::OK();
+        }
         // The receiver may remove itself from the receiver map via deregister_recvr()
         // at any time without considering the remaining number of senders.
         // As a consequence, find_recvr() may return an innocuous NULL if a thread
@@ -118,7 +148,6 @@ Status VDataStreamMgr::transmit_block(const PTransmitDataParams* request,
         recvr->add_sub_plan_statistics(request->query_statistics(), request->sender_id());
     }
 
-    bool eos = request->eos();
     if (request->has_block()) {
         recvr->add_block(request->block(), request->sender_id(), request->be_number(),
                          request->packet_seq(), eos ? nullptr : done);
@@ -127,6 +156,9 @@ Status VDataStreamMgr::transmit_block(const PTransmitDataParams* request,
     if (eos) {
         recvr->remove_sender(request->sender_id(), request->be_number());
     }
+    if (receiver_free_bytes != nullptr) {
+        *receiver_free_bytes = recvr->free_buffer_bytes();
+    }
     return Status::OK();
 }
 
@@ -61,7 +61,9 @@ public:
 
     Status deregister_recvr(const TUniqueId& fragment_instance_id, PlanNodeId node_id);
 
-    Status transmit_block(const PTransmitDataParams* request, ::google::protobuf::Closure** done);
+    // receiver_free_bytes is set to the free buffer bytes of the receiver if it is found
+    Status transmit_block(const PTransmitDataParams* request, ::google::protobuf::Closure** done,
+                          int64_t* receiver_free_bytes = nullptr);
 
     void cancel(const TUniqueId& fragment_instance_id);
 
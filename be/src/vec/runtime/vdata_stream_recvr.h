@@ -23,6 +23,7 @@
 #include <stddef.h>
 #include <stdint.h>
 
+#include <algorithm>
 #include <atomic>
 #include <condition_variable>
 #include <deque>
@@ -41,6 +42,7 @@
 #include "common/object_pool.h"
 #include "common/status.h"
 #include "runtime/descriptors.h"
+#include "runtime/memory/mem_tracker_limiter.h"
 #include "runtime/query_statistics.h"
 #include "util/runtime_profile.h"
 #include "util/stopwatch.hpp"
@@ -102,9 +104,18 @@ public:
 
     void close();
 
+    // The responses to the senders are also delayed when the query could not reserve the
+    // memory of the batch, so the senders slow down before the query exceeds its limit.
     bool exceeds_limit(int batch_size) {
         return _blocks_memory_usage->current_value() + batch_size >
-               config::exchg_node_buffer_size_bytes;
+                       config::exchg_node_buffer_size_bytes ||
+               (_query_mem_tracker != nullptr && !_query_mem_tracker->can_reserve(batch_size));
+    }
+
+    // Bytes that can still be buffered before the responses to the senders are delayed.
+    int64_t free_buffer_bytes() const {
+        return std::max<int64_t>(
+                0, config::exchg_node_buffer_size_bytes - _blocks_memory_usage->current_value());
     }
 
     bool is_closed() const { return _is_closed; }
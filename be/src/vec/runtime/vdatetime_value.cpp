@@ -66,6 +66,35 @@ bool VecDateTimeValue::check_date(uint32_t year, uint32_t month, uint32_t day) {
     return false;
 }
 
+// Parse the most common formats "YYYY-MM-DD" and "YYYY-MM-DD HH:MM:SS" into date_val, e.g.
+// the dates of loaded files, which from_date_str parses into the same fields. Return the
+// number of fields, or 0 if date_str is not exactly in these formats.
+static int parse_standard_date_str(const char* date_str, int len, uint32_t* date_val) {
+    static constexpr char DATETIME_LAYOUT[] = "0000-00-00 00:00:00";
+    if (len != 10 && len != 19) {
+        return 0;
+    }
+    for (int i = 0; i < len; ++i) {
+        if (DATETIME_LAYOUT[i] == '0' ? (unsigned char)(date_str[i] - '0') > 9
+                                      : date_str[i] != DATETIME_LAYOUT[i]) {
+            return 0;
+        }
+    }
+    auto two_digits = [date_str](int i) {
+        return (uint32_t)(date_str[i] - '0') * 10 + (date_str[i + 1] - '0');
+    };
+    date_val[0] = two_digits(0) * 100 + two_digits(2);
+    date_val[1] = two_digits(5);
+    date_val[2] = two_digits(8);
+    if (len == 10) {
+        return 3;
+    }
+    date_val[3] = two_digits(11);
+    date_val[4] = two_digits(14);
+    date_val[5] = two_digits(17);
+    return 6;
+}
+
 // The interval format is that with no delimiters
 // YYYY-MM-DD HH-MM-DD.FFFFFF AM in default format
 // 0    1  2  3  4  5  6      7
@@ -79,6 +108,14 @@ bool VecDateTimeValue::from_date_str(const char* date_str, int len) {
     int32_t date_len[MAX_DATE_PARTS];
 
     _neg = false;
+    if (int num_field = parse_standard_date_str(date_str, len, date_val)) {
+        _type = num_field == 3 ? TIME_DATE : TIME_DATETIME;
+        if (num_field == 3) {
+            date_val[3] = date_val[4] = date_val[5] = 0;
+        }
+        return check_range_and_set_time(date_val[0], date_val[1], date_val[2], date_val[3],
+                                        date_val[4], date_val[5], _type);
+    }
     // Skip space character
     while (ptr < end && isspace(*ptr)) {
         ptr++;
@@ -1843,6 +1880,12 @@ bool DateV2Value<T>::from_date_str(const char* date_str, int len, int scale) {
     int32_t date_len[MAX_DATE_PARTS] = {0};
     bool carry_bits[MAX_DATE_PARTS] = {false};
 
+    // no carry without the microseconds, so format_datetime changes nothing
+    if (parse_standard_date_str(date_str, len, date_val)) {
+        return check_range_and_set_time(date_val[0], date_val[1], date_val[2], date_val[3],
+                                        date_val[4], date_val[5], 0);
+    }
+
     // Skip space character
     while (ptr < end && isspace(*ptr)) {
         ptr++;
@@ -32,14 +32,19 @@
 #include <exception>
 #include <ostream>
 #include <string>
+#include <vector>
 
+#include "common/config.h"
 #include "common/status.h"
 #include "io/fs/file_writer.h"
 #include "olap/olap_common.h"
 #include "runtime/decimalv2_value.h"
 #include "runtime/define_primitive_type.h"
+#include "runtime/exec_env.h"
+#include "runtime/thread_context.h"
 #include "runtime/types.h"
 #include "util/binary_cast.hpp"
+#include "util/countdown_latch.h"
 #include "util/mysql_global.h"
 #include "util/types.h"
 #include "vec/columns/column.h"
@@ -317,7 +322,7 @@ Status VParquetWriterWrapper::parse_schema() {
     return Status::InvalidArgument("Invalid column type: {}", raw_column->get_name());
 
 #define DISPATCH_PARQUET_NUMERIC_WRITER(WRITER, COLUMN_TYPE, NATIVE_TYPE)                         \
-    parquet::RowGroupWriter* rgWriter = get_rg_writer();                                          \
+    parquet::RowGroupWriter* rgWriter = _rg_writer;                                               \
     parquet::WRITER* col_writer = static_cast<parquet::WRITER*>(rgWriter->column(i));             \
     if (null_map != nullptr) {                                                                    \
         auto& null_data = assert_cast<const ColumnUInt8&>(*null_map).get_data();                  \
@@ -336,7 +341,7 @@ Status VParquetWriterWrapper::parse_schema() {
     }
 
 #define DISPATCH_PARQUET_DECIMAL_WRITER(DECIMAL_TYPE)                                            \
-    parquet::RowGroupWriter* rgWriter = get_rg_writer();                                         \
+    parquet::RowGroupWriter* rgWriter = _rg_writer;                                              \
     parquet::ByteArrayWriter* col_writer =                                                       \
             static_cast<parquet::ByteArrayWriter*>(rgWriter->column(i));                         \
     parquet::ByteArray value;                                                                    \
@@ -367,7 +372,7 @@ Status VParquetWriterWrapper::parse_schema() {
     }
 
 #define DISPATCH_PARQUET_COMPLEX_WRITER(COLUMN_TYPE)                                             \
-    parquet::RowGroupWriter* rgWriter = get_rg_writer();                                         \
+    parquet::RowGroupWriter* rgWriter = _rg_writer;                                              \
     parquet::ByteArrayWriter* col_writer =                                                       \
             static_cast<parquet::ByteArrayWriter*>(rgWriter->column(i));                         \
     if (null_map != nullptr) {                                                                   \
@@ -402,9 +407,47 @@ Status VParquetWriterWrapper::write(const Block& block) {
     if (block.rows() == 0) {
         return Status::OK();
     }
+    try {
+        _roll_row_group_if_needed();
+    } catch (const std::exception& e) {
+        LOG(WARNING) << "Parquet write error: " << e.what();
+        return Status::InternalError(e.what());
+    }
+
+    // the column chunks of a buffered row group are encoded independently
+    const int num_threads = std::min<int>(config::parquet_writer_encode_threads, block.columns());
+    if (num_threads <= 1) {
+        RETURN_IF_ERROR(_write_columns(block, 0, 1));
+    } else {
+        std::vector<Status> thread_status(num_threads);
+        auto mem_tracker = thread_context()->thread_mem_tracker_mgr->limiter_mem_tracker();
+        CountDownLatch latch(num_threads - 1);
+        for (int thread = 1; thread < num_threads; ++thread) {
+            auto st = ExecEnv::GetInstance()->join_node_thread_pool()->submit_func([&, thread] {
+                SCOPED_ATTACH_TASK(mem_tracker);
+                thread_status[thread] = _write_columns(block, thread, num_threads);
+                latch.count_down();
+            });
+            if (!st.ok()) {
+                // Fall back to writing the columns in the current thread.
+                thread_status[thread] = _write_columns(block, thread, num_threads);
+                latch.count_down();
+            }
+        }
+        thread_status[0] = _write_columns(block, 0, num_threads);
+        latch.wait();
+        for (auto& st : thread_status) {
+            RETURN_IF_ERROR(st);
+        }
+    }
+    _cur_written_rows += block.rows();
+    return Status::OK();
+}
+
+Status VParquetWriterWrapper::_write_columns(const Block& block, int thread, int num_threads) {
     size_t sz = block.rows();
     try {
-        for (size_t i = 0; i < block.columns(); i++) {
+        for (size_t i = thread; i < block.columns(); i += num_threads) {
             auto& raw_column = block.get_by_position(i).column;
             auto nullable = raw_column->is_nullable();
             const auto col = nullable ? reinterpret_cast<const ColumnNullable*>(
@@ -435,7 +478,7 @@ Status VParquetWriterWrapper::write(const Block& block) {
                 break;
             }
             case TYPE_LARGEINT: {
-                parquet::RowGroupWriter* rgWriter = get_rg_writer();
+                parquet::RowGroupWriter* rgWriter = _rg_writer;
                 parquet::ByteArrayWriter* col_writer =
                         static_cast<parquet::ByteArrayWriter*>(rgWriter->column(i));
                 parquet::ByteArray value;
@@ -480,7 +523,7 @@ Status VParquetWriterWrapper::write(const Block& block) {
             }
             case TYPE_TINYINT:
             case TYPE_SMALLINT: {
-                parquet::RowGroupWriter* rgWriter = get_rg_writer();
+                parquet::RowGroupWriter* rgWriter = _rg_writer;
                 parquet::Int32Writer* col_writer =
                         static_cast<parquet::Int32Writer*>(rgWriter->column(i));
                 if (null_map != nullptr) {
@@ -534,7 +577,7 @@ Status VParquetWriterWrapper::write(const Block& block) {
                 break;
             }
             case TYPE_DATETIME: {
-                parquet::RowGroupWriter* rgWriter = get_rg_writer();
+                parquet::RowGroupWriter* rgWriter = _rg_writer;
                 parquet::Int64Writer* col_writer =
                         static_cast<parquet::Int64Writer*>(rgWriter->column(i));
                 uint64_t default_int64 = 0;
@@ -595,7 +638,7 @@ Status VParquetWriterWrapper::write(const Block& block) {
                 break;
             }
             case TYPE_DATE: {
-                parquet::RowGroupWriter* rgWriter = get_rg_writer();
+                parquet::RowGroupWriter* rgWriter = _rg_writer;
                 parquet::Int64Writer* col_writer =
                         static_cast<parquet::Int64Writer*>(rgWriter->column(i));
                 uint64_t default_int64 = 0;
@@ -647,7 +690,7 @@ Status VParquetWriterWrapper::write(const Block& block) {
                 break;
             }
             case TYPE_DATEV2: {
-                parquet::RowGroupWriter* rgWriter = get_rg_writer();
+                parquet::RowGroupWriter* rgWriter = _rg_writer;
                 parquet::ByteArrayWriter* col_writer =
                         static_cast<parquet::ByteArrayWriter*>(rgWriter->column(i));
                 parquet::ByteArray value;
@@ -687,7 +730,7 @@ Status VParquetWriterWrapper::write(const Block& block) {
                 break;
             }
             case TYPE_DATETIMEV2: {
-                parquet::RowGroupWriter* rgWriter = get_rg_writer();
+                parquet::RowGroupWriter* rgWriter = _rg_writer;
                 parquet::ByteArrayWriter* col_writer =
                         static_cast<parquet::ByteArrayWriter*>(rgWriter->column(i));
                 parquet::ByteArray value;
@@ -749,7 +792,7 @@ Status VParquetWriterWrapper::write(const Block& block) {
                 break;
             }
             case TYPE_DECIMALV2: {
-                parquet::RowGroupWriter* rgWriter = get_rg_writer();
+                parquet::RowGroupWriter* rgWriter = _rg_writer;
                 parquet::ByteArrayWriter* col_writer =
                         static_cast<parquet::ByteArrayWriter*>(rgWriter->column(i));
                 parquet::ByteArray value;
@@ -813,7 +856,6 @@ Status VParquetWriterWrapper::write(const Block& block) {
         LOG(WARNING) << "Parquet write error: " << e.what();
         return Status::InternalError(e.what());
     }
-    _cur_written_rows += sz;
     return Status::OK();
 }
 
@@ -832,16 +874,19 @@ Status VParquetWriterWrapper::prepare() {
     return Status::OK();
 }
 
-parquet::RowGroupWriter* VParquetWriterWrapper::get_rg_writer() {
+void VParquetWriterWrapper::_roll_row_group_if_needed() {
     if (_rg_writer == nullptr) {
         _rg_writer = _writer->AppendBufferedRowGroup();
+        return;
     }
-    if (_cur_written_rows > _max_row_per_group) {
+    // The pages of a buffered row group are kept in memory until it is closed, which flushes
+    // them to the output stream.
+    if (_rg_writer->total_bytes_written() + _rg_writer->total_compressed_bytes() >=
+        config::parquet_writer_row_group_max_bytes) {
         _rg_writer->Close();
         _rg_writer = _writer->AppendBufferedRowGroup();
         _cur_written_rows = 0;
     }
-    return _rg_writer;
 }
 
 int64_t VParquetWriterWrapper::written_len() {
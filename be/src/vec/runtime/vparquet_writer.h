@@ -133,7 +133,12 @@ public:
     int64_t written_len() override;
 
 private:
-    parquet::RowGroupWriter* get_rg_writer();
+    // Close the current row group once its buffered pages reach
+    // config::parquet_writer_row_group_max_bytes, and append a new one.
+    void _roll_row_group_if_needed();
+
+    // Write the columns thread, thread + num_threads, ... of the block into the row group.
+    Status _write_columns(const Block& block, int thread, int num_threads);
 
     Status parse_schema();
 
@@ -145,7 +150,6 @@ private:
     std::shared_ptr<parquet::schema::GroupNode> _schema;
     std::unique_ptr<parquet::ParquetFileWriter> _writer;
     parquet::RowGroupWriter* _rg_writer;
-    const int64_t _max_row_per_group = 10;
 
     const std::vector<TParquetSchema>& _parquet_schemas;
     const TParquetCompressionType::type& _compression_type;
@@ -17,6 +17,7 @@
 
 #include "vec/runtime/vsorted_run_merger.h"
 
+#include <algorithm>
 #include <utility>
 #include <vector>
 
@@ -74,11 +75,13 @@ Status VSortedRunMerger::prepare(const vector<BlockSupplier>& input_runs) {
         }
     }
 
+    std::vector<MergeSortCursor> runs;
     for (auto& _cursor : _cursors) {
         if (!_cursor._is_eof) {
-            _priority_queue.push(MergeSortCursor(&_cursor));
+            runs.emplace_back(&_cursor);
         }
     }
+    _loser_tree.init(std::move(runs));
 
     for (const auto& cursor : _cursors) {
         if (!cursor._is_eof) {
@@ -95,8 +98,8 @@ Status VSortedRunMerger::get_next(Block* output_block, bool* eos) {
     // Only have one receive data queue of data, no need to do merge and
     // copy the data of block.
     // return the data in receive data directly
-    if (_priority_queue.size() == 1) {
-        auto current = _priority_queue.top();
+    if (_loser_tree.size() == 1) {
+        auto current = _loser_tree.top();
         while (_offset != 0 && current->block_ptr() != nullptr) {
             if (_offset >= current->rows - current->pos) {
                 _offset -= (current->rows - current->pos);
@@ -133,21 +136,23 @@ Status VSortedRunMerger::get_next(Block* output_block, bool* eos) {
         MutableColumns merged_columns =
                 mem_reuse ? output_block->mutate_columns() : _empty_block.clone_empty_columns();
 
-        /// Take rows from queue in right order and push to 'merged'.
+        /// Take runs of rows from the tree in right order and push to 'merged'.
         size_t merged_rows = 0;
-        while (!_priority_queue.empty()) {
-            auto current = _priority_queue.top();
-            _priority_queue.pop();
-
-            if (_offset > 0) {
-                _offset--;
-            } else {
-                for (size_t i = 0; i < num_columns; ++i)
-                    merged_columns[i]->insert_from(*current->all_columns[i], current->pos);
-                ++merged_rows;
+        while (!_loser_tree.empty() && merged_rows < _batch_size) {
+            auto current = _loser_tree.top();
+            size_t run_rows = run_length(current, _batch_size - merged_rows + _offset);
+            size_t skip_rows = std::min(_offset, run_rows);
+            _offset -= skip_rows;
+            if (run_rows > skip_rows) {
+                for (size_t i = 0; i < num_columns; ++i) {
+                    merged_columns[i]->insert_range_from(*current->all_columns[i],
+                                                         current->pos + skip_rows,
+                                                         run_rows - skip_rows);
+                }
+                merged_rows += run_rows - skip_rows;
             }
+            current->pos += run_rows - 1;
             next_heap(current);
-            if (merged_rows == _batch_size) break;
         }
 
         if (merged_rows == 0) {
@@ -172,10 +177,46 @@ Status VSortedRunMerger::get_next(Block* output_block, bool* eos) {
 void VSortedRunMerger::next_heap(MergeSortCursor& current) {
     if (!current->isLast()) {
         current->next();
-        _priority_queue.push(current);
+        _loser_tree.update_top();
     } else if (has_next_block(current)) {
-        _priority_queue.push(current);
+        _loser_tree.update_top();
+    } else {
+        _loser_tree.pop_top();
+    }
+}
+
+size_t VSortedRunMerger::run_length(MergeSortCursor& current, size_t max_rows) {
+    max_rows = std::min(max_rows, current->rows - current->pos);
+    MergeSortCursor* runner_up = _loser_tree.runner_up();
+    if (runner_up == nullptr || max_rows <= 1) {
+        return max_rows;
+    }
+    auto goes_after = [&](size_t row) {
+        return current.greater_at(*runner_up, row, (*runner_up)->pos) > 0;
+    };
+    // the rows of a run are sorted, so the whole rest of the block is usually taken by
+    // one comparison, otherwise gallop to find the first row going after the runner-up
+    size_t lo = current->pos;
+    size_t hi = current->pos + max_rows - 1;
+    if (!goes_after(hi)) {
+        return max_rows;
+    }
+    for (size_t step = 1; lo + step < hi; step *= 2) {
+        if (goes_after(lo + step)) {
+            hi = lo + step;
+            break;
+        }
+        lo += step;
+    }
+    while (hi - lo > 1) {
+        size_t mid = lo + (hi - lo) / 2;
+        if (goes_after(mid)) {
+            hi = mid;
+        } else {
+            lo = mid;
+        }
     }
+    return lo - current->pos + 1;
 }
 
 inline bool VSortedRunMerger::has_next_block(doris::vectorized::MergeSortCursor& current) {
@@ -20,12 +20,13 @@
 #include <stddef.h>
 #include <stdint.h>
 
-#include <queue>
+#include <functional>
 #include <vector>
 
 #include "common/status.h"
 #include "util/runtime_profile.h"
 #include "vec/core/block.h"
+#include "vec/core/loser_tree.h"
 #include "vec/core/sort_cursor.h"
 #include "vec/core/sort_description.h"
 #include "vec/exprs/vexpr_fwd.h"
@@ -36,8 +37,9 @@ namespace vectorized {
 
 // VSortedRunMerger is used to merge multiple sorted runs of blocks. A run is a sorted
 // sequence of blocks, which are fetched from a BlockSupplier function object.
-// Merging is implemented using a binary min-heap that maintains the run with the next
-// rows in sorted order at the top of the heap.
+// Merging is implemented using a loser tree that maintains the run with the next rows in
+// sorted order at the top of the tree. The rows of the top run which do not go after the
+// runner-up are copied at once as a row range.
 //
 // Merged block of rows are retrieved from VSortedRunMerger via calls to get_next().
 class VSortedRunMerger {
@@ -55,8 +57,7 @@ public:
     virtual ~VSortedRunMerger() = default;
 
     // Prepare this merger to merge and return rows from the sorted runs in 'input_runs'.
-    // Retrieves the first batch from each run and sets up the binary heap implementing
-    // the priority queue.
+    // Retrieves the first batch from each run and sets up the loser tree.
     Status prepare(const std::vector<BlockSupplier>& input_runs);
 
     // Return the next block of sorted rows from this merger.
@@ -75,7 +76,7 @@ protected:
     size_t _offset = 0;
 
     std::vector<BlockSupplierSortCursorImpl> _cursors;
-    std::priority_queue<MergeSortCursor> _priority_queue;
+    LoserTree<MergeSortCursor, std::less<MergeSortCursor>> _loser_tree;
 
     Block _empty_block;
 
@@ -88,6 +89,9 @@ protected:
 private:
     void init_timers(RuntimeProfile* profile);
     void next_heap(MergeSortCursor& current);
+    // number of rows from the current row of the top run up to `max_rows`, which do not go
+    // after the runner-up
+    size_t run_length(MergeSortCursor& current, size_t max_rows);
     bool has_next_block(MergeSortCursor& current);
 };
 
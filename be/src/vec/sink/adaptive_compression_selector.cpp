@@ -0,0 +1,80 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "vec/sink/adaptive_compression_selector.h"
+
+namespace doris::vectorized {
+
+segment_v2::CompressionTypePB AdaptiveCompressionSelector::next() {
+    size_t pos = _num_blocks % RESAMPLE_INTERVAL;
+    if (pos < SAMPLE_BLOCKS_PER_CODEC * CANDIDATES.size()) {
+        return CANDIDATES[pos / SAMPLE_BLOCKS_PER_CODEC];
+    }
+    return CANDIDATES[_current];
+}
+
+void AdaptiveCompressionSelector::update(segment_v2::CompressionTypePB type,
+                                         size_t uncompressed_bytes, size_t compressed_bytes,
+                                         int64_t compress_ns) {
+    size_t pos = _num_blocks % RESAMPLE_INTERVAL;
+    ++_num_blocks;
+    if (uncompressed_bytes == 0) {
+        return;
+    }
+    for (size_t i = 0; i < CANDIDATES.size(); ++i) {
+        if (CANDIDATES[i] != type) {
+            continue;
+        }
+        double ratio = static_cast<double>(compressed_bytes) / uncompressed_bytes;
+        double ns_per_byte = static_cast<double>(compress_ns) / uncompressed_bytes;
+        auto& sample = _samples[i];
+        // the first sample replaces the initial guess, later ones are smoothed
+        double weight = sample.num_blocks == 0 ? 1 : 0.5;
+        sample.ratio += (ratio - sample.ratio) * weight;
+        sample.ns_per_byte += (ns_per_byte - sample.ns_per_byte) * weight;
+        ++sample.num_blocks;
+        break;
+    }
+    if (pos + 1 == SAMPLE_BLOCKS_PER_CODEC * CANDIDATES.size()) {
+        _choose();
+    }
+}
+
+void AdaptiveCompressionSelector::set_network_bytes_per_second(double bytes_per_second) {
+    if (bytes_per_second > 0) {
+        _network_bytes_per_second = bytes_per_second;
+    }
+}
+
+void AdaptiveCompressionSelector::_choose() {
+    double network_ns_per_byte = 1e9 / _network_bytes_per_second;
+    double best_cost = 0;
+    bool found = false;
+    for (size_t i = 0; i < CANDIDATES.size(); ++i) {
+        if (_samples[i].num_blocks == 0) {
+            continue;
+        }
+        double cost = _samples[i].ns_per_byte + _samples[i].ratio * network_ns_per_byte;
+        if (!found || cost < best_cost) {
+            found = true;
+            best_cost = cost;
+            _current = i;
+        }
+    }
+}
+
+} // namespace doris::vectorized
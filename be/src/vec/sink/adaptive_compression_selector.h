@@ -0,0 +1,73 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <gen_cpp/segment_v2.pb.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include <array>
+
+namespace doris::vectorized {
+
+// Choose the codec of the exchanged blocks at runtime by the estimated cost of sending a
+// block, that is the time to compress it plus the time to transfer the compressed bytes.
+// A fast network prefers no or light compression, while a slow link prefers ZSTD.
+//
+// Each codec is sampled on a few blocks at first, and again every RESAMPLE_INTERVAL blocks
+// in case the data or the network changes. Not thread safe.
+class AdaptiveCompressionSelector {
+public:
+    static constexpr size_t SAMPLE_BLOCKS_PER_CODEC = 2;
+    static constexpr size_t RESAMPLE_INTERVAL = 256;
+
+    // The codec to serialize the next block.
+    segment_v2::CompressionTypePB next();
+
+    // Feed back the result of a serialized block.
+    void update(segment_v2::CompressionTypePB type, size_t uncompressed_bytes,
+                size_t compressed_bytes, int64_t compress_ns);
+
+    // Bytes transferred per second of one rpc, measured by the caller.
+    void set_network_bytes_per_second(double bytes_per_second);
+
+    segment_v2::CompressionTypePB current() const { return CANDIDATES[_current]; }
+
+private:
+    static constexpr std::array<segment_v2::CompressionTypePB, 3> CANDIDATES = {
+            segment_v2::CompressionTypePB::NO_COMPRESSION, segment_v2::CompressionTypePB::LZ4,
+            segment_v2::CompressionTypePB::ZSTD};
+
+    struct Sample {
+        // moving average of compressed size / uncompressed size
+        double ratio = 1;
+        // moving average of compress time per uncompressed byte
+        double ns_per_byte = 0;
+        size_t num_blocks = 0;
+    };
+
+    void _choose();
+
+    std::array<Sample, CANDIDATES.size()> _samples;
+    // 1Gbps until measured
+    double _network_bytes_per_second = 125.0 * 1024 * 1024;
+    size_t _num_blocks = 0;
+    size_t _current = 1;
+};
+
+} // namespace doris::vectorized
@@ -0,0 +1,113 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "vec/sink/varrow_flight_result_writer.h"
+
+#include <arrow/memory_pool.h>
+#include <arrow/record_batch.h>
+#include <arrow/type.h>
+#include <gen_cpp/PaloInternalService_types.h>
+
+#include <utility>
+#include <vector>
+
+#include "runtime/buffer_control_block.h"
+#include "runtime/runtime_state.h"
+#include "util/arrow/block_convertor.h"
+#include "util/arrow/row_batch.h"
+#include "vec/core/block.h"
+#include "vec/exprs/vexpr.h"
+#include "vec/exprs/vexpr_context.h"
+
+namespace doris {
+namespace vectorized {
+
+VArrowFlightResultWriter::VArrowFlightResultWriter(BufferControlBlock* sinker,
+                                                   const VExprContextSPtrs& output_vexpr_ctxs,
+                                                   RuntimeProfile* parent_profile)
+        : VResultWriter(),
+          _sinker(sinker),
+          _output_vexpr_ctxs(output_vexpr_ctxs),
+          _parent_profile(parent_profile) {}
+
+Status VArrowFlightResultWriter::init(RuntimeState* state) {
+    _init_profile();
+    if (nullptr == _sinker) {
+        return Status::InternalError("sinker is NULL pointer.");
+    }
+    _is_dry_run = state->query_options().dry_run_query;
+
+    std::vector<std::shared_ptr<arrow::Field>> fields;
+    for (const auto& ctx : _output_vexpr_ctxs) {
+        std::shared_ptr<arrow::DataType> type;
+        RETURN_IF_ERROR(convert_to_arrow_type(ctx->root()->type(), &type));
+        fields.push_back(arrow::field(ctx->root()->expr_name(), type, ctx->root()->is_nullable()));
+    }
+    _arrow_schema = arrow::schema(std::move(fields));
+    return Status::OK();
+}
+
+void VArrowFlightResultWriter::_init_profile() {
+    _append_row_batch_timer = ADD_TIMER(_parent_profile, "AppendBatchTime");
+    _convert_tuple_timer = ADD_CHILD_TIMER(_parent_profile, "TupleConvertTime", "AppendBatchTime");
+    _result_send_timer = ADD_CHILD_TIMER(_parent_profile, "ResultSendTime", "AppendBatchTime");
+    _sent_rows_counter = ADD_COUNTER(_parent_profile, "NumSentRows", TUnit::UNIT);
+}
+
+Status VArrowFlightResultWriter::append_block(Block& input_block) {
+    SCOPED_TIMER(_append_row_batch_timer);
+    if (UNLIKELY(input_block.rows() == 0)) {
+        return Status::OK();
+    }
+
+    Block block;
+    RETURN_IF_ERROR(VExprContext::get_output_block_after_execute_exprs(_output_vexpr_ctxs,
+                                                                       input_block, &block));
+    auto num_rows = block.rows();
+
+    std::shared_ptr<arrow::RecordBatch> result;
+    {
+        SCOPED_TIMER(_convert_tuple_timer);
+        for (auto& column_with_type : block) {
+            column_with_type.column = column_with_type.column->convert_to_full_column_if_const();
+        }
+        // the numeric columns only referenced by the block, e.g. computed by the output exprs,
+        // are moved into the arrow batch, the ones shared with the input block are copied
+        RETURN_IF_ERROR(convert_to_arrow_batch(std::move(block), _arrow_schema,
+                                               arrow::default_memory_pool(), &result));
+    }
+
+    SCOPED_TIMER(_result_send_timer);
+    // If this is a dry run task, no need to send data block
+    if (!_is_dry_run) {
+        RETURN_IF_ERROR(_sinker->add_arrow_batch(result));
+    }
+    _written_rows += num_rows;
+    return Status::OK();
+}
+
+bool VArrowFlightResultWriter::can_sink() {
+    return _sinker->can_sink();
+}
+
+Status VArrowFlightResultWriter::close() {
+    COUNTER_SET(_sent_rows_counter, _written_rows);
+    return Status::OK();
+}
+
+} // namespace vectorized
+} // namespace doris
@@ -137,19 +137,35 @@ Status Channel::send_local_block(bool eos) {
     }
 }
 
-Status Channel::send_local_block(Block* block) {
+Status Channel::send_local_block(Block* block, bool can_be_moved) {
     SCOPED_TIMER(_parent->_local_send_timer);
     if (_recvr_is_valid()) {
         COUNTER_UPDATE(_parent->_local_bytes_send_counter, block->bytes());
         COUNTER_UPDATE(_parent->_local_sent_rows, block->rows());
         COUNTER_UPDATE(_parent->_blocks_sent_counter, 1);
-        _local_recvr->add_block(block, _parent->_sender_id, false);
+        if (can_be_moved) {
+            // hand the columns over to the receiver and leave an empty block of the
+            // same schema to the caller, which clears and refills it for the next round
+            Block moved_block = block->clone_empty();
+            moved_block.swap(*block);
+            _local_recvr->add_block(&moved_block, _parent->_sender_id, true);
+        } else {
+            _local_recvr->add_block(block, _parent->_sender_id, false);
+        }
         return Status::OK();
     } else {
         return receiver_status_;
     }
 }
 
+void Channel::add_broadcast_follower(Channel* follower) {
+    auto* finst_id = _brpc_request.add_broadcast_finst_ids();
+    finst_id->set_hi(follower->_fragment_instance_id.hi);
+    finst_id->set_lo(follower->_fragment_instance_id.lo);
+    follower->_is_broadcast_follower = true;
+    follower->_need_close = false;
+}
+
 Status Channel::send_block(PBlock* block, bool eos) {
     SCOPED_TIMER(_parent->_brpc_send_timer);
     COUNTER_UPDATE(_parent->_blocks_sent_counter, 1);
@@ -180,9 +196,14 @@ Status Channel::send_block(PBlock* block, bool eos) {
 
     {
         SCOPED_SWITCH_THREAD_MEM_TRACKER_LIMITER(ExecEnv::GetInstance()->orphan_mem_tracker());
+        _brpc_request.set_transfer_by_attachment(false);
         if (enable_http_send_block(_brpc_request, _parent->_transfer_large_data_by_brpc)) {
             RETURN_IF_ERROR(transmit_block_http(_state, _closure, _brpc_request, _brpc_dest_addr));
         } else {
+            // the broadcast block is shared by all channels
+            if (block != nullptr && block == _ch_cur_pb_block) {
+                request_block_transfer_attachment_without_copy(&_brpc_request, _closure);
+            }
             transmit_block(*_brpc_stub, _closure, _brpc_request);
         }
     }
@@ -504,13 +525,37 @@ Status VDataStreamSender::open(RuntimeState* state) {
         }
     }
     _only_local_exchange = local_size == _channels.size();
+    if (config::enable_broadcast_exchange_per_host && _part_type == TPartitionType::UNPARTITIONED &&
+        !_only_local_exchange) {
+        _group_broadcast_channels_by_host();
+    }
     SCOPED_CONSUME_MEM_TRACKER(_mem_tracker.get());
     RETURN_IF_ERROR(VExpr::open(_partition_expr_ctxs, state));
 
     _compression_type = state->fragement_transmission_compression_type();
+    if (state->fragment_transmission_compression_adaptive()) {
+        _compression_selector = std::make_unique<AdaptiveCompressionSelector>();
+    }
     return Status::OK();
 }
 
+void VDataStreamSender::_group_broadcast_channels_by_host() {
+    std::map<std::pair<std::string, int>, Channel*> host_to_leader;
+    for (auto channel : _channels) {
+        // the camouflaged empty channel of bucket shuffle join sends nothing
+        if (channel->is_local() || !channel->_need_close) {
+            continue;
+        }
+        auto host = std::make_pair(channel->_brpc_dest_addr.hostname,
+                                   channel->_brpc_dest_addr.port);
+        auto [iter, inserted] = host_to_leader.emplace(host, channel);
+        if (!inserted) {
+            iter->second->add_broadcast_follower(channel);
+            _num_broadcast_followers++;
+        }
+    }
+}
+
 template <typename ChannelPtrType>
 void VDataStreamSender::_handle_eof_channel(RuntimeState* state, ChannelPtrType channel,
                                             Status st) {
@@ -522,7 +567,8 @@ Status VDataStreamSender::send(RuntimeState* state, Block* block, bool eos) {
     SCOPED_TIMER(_profile->total_time_counter());
     bool all_receiver_eof = true;
     for (auto channel : _channels) {
-        if (!channel->is_receiver_eof()) {
+        // a broadcast follower reaches eof together with its leader
+        if (!channel->is_receiver_eof() && !channel->is_broadcast_follower()) {
             all_receiver_eof = false;
             break;
         }
@@ -535,11 +581,20 @@ Status VDataStreamSender::send(RuntimeState* state, Block* block, bool eos) {
         // 1. serialize depends on it is not local exchange
         // 2. send block
         // 3. rollover block
+        // the block is not used after being sent, so the last local channel takes it over
+        // instead of copying it
+        int last_local_idx = -1;
+        for (int i = 0; i < _channels.size(); ++i) {
+            if (_channels[i]->is_local() && !_channels[i]->is_receiver_eof()) {
+                last_local_idx = i;
+            }
+        }
         if (_only_local_exchange) {
             Status status;
-            for (auto channel : _channels) {
+            for (int i = 0; i < _channels.size(); ++i) {
+                auto channel = _channels[i];
                 if (!channel->is_receiver_eof()) {
-                    status = channel->send_local_block(block);
+                    status = channel->send_local_block(block, i == last_local_idx);
                     HANDLE_CHANNEL_STATUS(state, channel, status);
                 }
             }
@@ -549,14 +604,16 @@ Status VDataStreamSender::send(RuntimeState* state, Block* block, bool eos) {
             {
                 SCOPED_CONSUME_MEM_TRACKER(_mem_tracker.get());
                 RETURN_IF_ERROR(
-                        serialize_block(block, block_holder->get_block(), _channels.size()));
+                        serialize_block(block, block_holder->get_block(),
+                                        _channels.size() - _num_broadcast_followers));
             }
 
             Status status;
-            for (auto channel : _channels) {
-                if (!channel->is_receiver_eof()) {
+            for (int i = 0; i < _channels.size(); ++i) {
+                auto channel = _channels[i];
+                if (!channel->is_receiver_eof() && !channel->is_broadcast_follower()) {
                     if (channel->is_local()) {
-                        status = channel->send_local_block(block);
+                        status = channel->send_local_block(block, i == last_local_idx);
                     } else {
                         SCOPED_CONSUME_MEM_TRACKER(_mem_tracker.get());
                         status = channel->send_block(block_holder, eos);
@@ -567,14 +624,16 @@ Status VDataStreamSender::send(RuntimeState* state, Block* block, bool eos) {
         } else {
             {
                 SCOPED_CONSUME_MEM_TRACKER(_mem_tracker.get());
-                RETURN_IF_ERROR(serialize_block(block, _cur_pb_block, _channels.size()));
+                RETURN_IF_ERROR(serialize_block(block, _cur_pb_block,
+                                                _channels.size() - _num_broadcast_followers));
             }
 
             Status status;
-            for (auto channel : _channels) {
-                if (!channel->is_receiver_eof()) {
+            for (int i = 0; i < _channels.size(); ++i) {
+                auto channel = _channels[i];
+                if (!channel->is_receiver_eof() && !channel->is_broadcast_follower()) {
                     if (channel->is_local()) {
-                        status = channel->send_local_block(block);
+                        status = channel->send_local_block(block, i == last_local_idx);
                     } else {
                         SCOPED_CONSUME_MEM_TRACKER(_mem_tracker.get());
                         status = channel->send_block(_cur_pb_block, eos);
@@ -591,7 +650,7 @@ Status VDataStreamSender::send(RuntimeState* state, Block* block, bool eos) {
         if (!current_channel->is_receiver_eof()) {
             // 2. serialize, send and rollover block
             if (current_channel->is_local()) {
-                auto status = current_channel->send_local_block(block);
+                auto status = current_channel->send_local_block(block, true);
                 HANDLE_CHANNEL_STATUS(state, current_channel, status);
             } else {
                 SCOPED_CONSUME_MEM_TRACKER(_mem_tracker.get());
@@ -705,9 +764,22 @@ Status VDataStreamSender::serialize_block(Block* src, PBlock* dest, int num_rece
         SCOPED_TIMER(_serialize_batch_timer);
         dest->Clear();
         size_t uncompressed_bytes = 0, compressed_bytes = 0;
+        auto compression_type = _compression_type;
+        if (_compression_selector) {
+            if (_sink_buffer != nullptr) {
+                _compression_selector->set_network_bytes_per_second(
+                        _sink_buffer->get_rpc_bytes_per_second());
+            }
+            compression_type = _compression_selector->next();
+        }
+        int64_t compress_time_before = src->get_compress_time();
         RETURN_IF_ERROR(src->serialize(_state->be_exec_version(), dest, &uncompressed_bytes,
-                                       &compressed_bytes, _compression_type,
+                                       &compressed_bytes, compression_type,
                                        _transfer_large_data_by_brpc));
+        if (_compression_selector) {
+            _compression_selector->update(compression_type, uncompressed_bytes, compressed_bytes,
+                                          src->get_compress_time() - compress_time_before);
+        }
         COUNTER_UPDATE(_bytes_sent_counter, compressed_bytes * num_receivers);
         COUNTER_UPDATE(_uncompressed_bytes_counter, uncompressed_bytes * num_receivers);
         COUNTER_UPDATE(_compress_timer, src->get_compress_time());
@@ -728,6 +800,7 @@ Status VDataStreamSender::_get_next_available_buffer(BroadcastPBlockHolder** hol
 }
 
 void VDataStreamSender::registe_channels(pipeline::ExchangeSinkBuffer* buffer) {
+    _sink_buffer = buffer;
     for (auto channel : _channels) {
         ((PipChannel*)channel)->registe(buffer);
     }
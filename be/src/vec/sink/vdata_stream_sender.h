@@ -47,6 +47,7 @@
 #include "vec/core/block.h"
 #include "vec/exprs/vexpr_context.h"
 #include "vec/runtime/vdata_stream_recvr.h"
+#include "vec/sink/adaptive_compression_selector.h"
 
 namespace doris {
 class ObjectPool;
@@ -138,6 +139,10 @@ protected:
 
     Status handle_unpartitioned(Block* block);
 
+    // Group the remote broadcast channels by dest BE, only the first channel of a group sends
+    // the blocks and the receiver side delivers them to the others.
+    void _group_broadcast_channels_by_host();
+
     // Sender instance id, unique within a fragment.
     int _sender_id;
 
@@ -193,10 +198,16 @@ protected:
     bool _transfer_large_data_by_brpc = false;
 
     segment_v2::CompressionTypePB _compression_type;
+    // set if the codec is chosen at runtime
+    std::unique_ptr<AdaptiveCompressionSelector> _compression_selector;
+    // used by pipeline engine to measure the network speed
+    pipeline::ExchangeSinkBuffer* _sink_buffer = nullptr;
 
     bool _new_shuffle_hash_method = false;
     bool _only_local_exchange = false;
     bool _enable_pipeline_exec = false;
+    // number of the broadcast channels whose blocks are sent by another channel to the same BE
+    int _num_broadcast_followers = 0;
 };
 
 class Channel {
@@ -260,7 +271,10 @@ public:
 
     Status send_local_block(bool eos = false);
 
-    Status send_local_block(Block* block);
+    // Send the block to the local receiver, the columns of the block are moved into the
+    // receiver's queue if can_be_moved, otherwise they are copied.
+    Status send_local_block(Block* block, bool can_be_moved = false);
+
     // Flush buffered rows and close channel. This function don't wait the response
     // of close operation, client should call close_wait() to finish channel's close.
     // We split one close operation into two phases in order to make multiple channels
@@ -281,6 +295,12 @@ public:
 
     bool is_local() const { return _is_local; }
 
+    bool is_broadcast_follower() const { return _is_broadcast_follower; }
+
+    // Deliver the broadcast blocks sent by this channel to the receiver of the follower too,
+    // which is on the same BE. The follower sends nothing itself.
+    virtual void add_broadcast_follower(Channel* follower);
+
     virtual void ch_roll_pb_block();
 
     bool can_write() {
@@ -366,6 +386,7 @@ protected:
     RuntimeState* _state;
 
     bool _is_local;
+    bool _is_broadcast_follower = false;
     std::shared_ptr<VDataStreamRecvr> _local_recvr;
     // serialized blocks for broadcasting; we need two so we can write
     // one while the other one is still being sent.
@@ -492,6 +513,12 @@ public:
         _buffer->register_sink(_fragment_instance_id);
     }
 
+    void add_broadcast_follower(Channel* follower) override {
+        Channel::add_broadcast_follower(follower);
+        _buffer->register_broadcast_follower(_fragment_instance_id,
+                                             follower->_fragment_instance_id);
+    }
+
     pipeline::SelfDeleteClosure<PTransmitDataResult>* get_closure(
             InstanceLoId id, bool eos, vectorized::BroadcastPBlockHolder* data) {
         if (!_closure) {
@@ -90,6 +90,8 @@ Status VMysqlResultWriter<is_binary_format>::init(RuntimeState* state) {
     }
     set_output_object_data(state->return_object_data_as_binary());
     _is_dry_run = state->query_options().dry_run_query;
+    _pack_rows = state->query_options().__isset.enable_packed_result_rows &&
+                 state->query_options().enable_packed_result_rows;
     return Status::OK();
 }
 
@@ -647,10 +649,30 @@ Status VMysqlResultWriter<is_binary_format>::append_block(Block& input_block) {
     // copy MysqlRowBuffer to Thrift
     {
         SCOPED_TIMER(_copy_buffer_timer);
-        result->result_batch.rows.resize(num_rows);
-        for (int i = 0; i < num_rows; ++i) {
-            result->result_batch.rows[i].append(_rows_buffer[i].buf(), _rows_buffer[i].length());
-            bytes_sent += _rows_buffer[i].length();
+        auto& result_batch = result->result_batch;
+        if (_pack_rows) {
+            // one allocation for the block instead of one string per row, the buffer is moved
+            // into the BufferControlBlock and serialized once for the rpc
+            for (size_t i = 0; i < num_rows; ++i) {
+                bytes_sent += _rows_buffer[i].length();
+            }
+            result_batch.rows_data.resize(bytes_sent);
+            result_batch.row_lengths.resize(num_rows);
+            char* pos = result_batch.rows_data.data();
+            for (size_t i = 0; i < num_rows; ++i) {
+                auto length = _rows_buffer[i].length();
+                memcpy(pos, _rows_buffer[i].buf(), length);
+                pos += length;
+                result_batch.row_lengths[i] = length;
+            }
+            result_batch.__isset.rows_data = true;
+            result_batch.__isset.row_lengths = true;
+        } else {
+            result_batch.rows.resize(num_rows);
+            for (int i = 0; i < num_rows; ++i) {
+                result_batch.rows[i].append(_rows_buffer[i].buf(), _rows_buffer[i].length());
+                bytes_sent += _rows_buffer[i].length();
+            }
         }
     }
     if (status) {
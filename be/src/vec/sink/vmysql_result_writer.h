@@ -88,6 +88,8 @@ private:
     ResultList _results;
     // If true, no block will be sent
     bool _is_dry_run = false;
+    // If true, the rows of a block are sent in TResultBatch.rows_data
+    bool _pack_rows = false;
 
     uint64_t _bytes_sent = 0;
 };
@@ -35,8 +35,10 @@
 #include "runtime/runtime_state.h"
 #include "util/runtime_profile.h"
 #include "util/telemetry/telemetry.h"
+#include "vec/columns/column_nullable.h"
 #include "vec/exprs/vexpr.h"
 #include "vec/exprs/vexpr_context.h"
+#include "vec/sink/varrow_flight_result_writer.h"
 #include "vec/sink/vmysql_result_writer.h"
 #include "vec/sink/vresult_writer.h"
 
@@ -97,6 +99,10 @@ Status VResultSink::prepare(RuntimeState* state) {
         _writer.reset(new (std::nothrow)
                               VMysqlResultWriter(_sender.get(), _output_vexpr_ctxs, _profile));
         break;
+    case TResultSinkType::ARROW_FLIGHT_PROTOCAL:
+        _writer.reset(new (std::nothrow) VArrowFlightResultWriter(_sender.get(), _output_vexpr_ctxs,
+                                                                  _profile));
+        break;
     default:
         return Status::InternalError("Unknown result sink type");
     }
@@ -110,6 +116,9 @@ Status VResultSink::open(RuntimeState* state) {
 }
 
 Status VResultSink::second_phase_fetch_data(RuntimeState* state, Block* final_block) {
+    if (_fetch_option.__isset.fetch_tuple_id) {
+        return fetch_deferred_slots(state, final_block);
+    }
     auto row_id_col = final_block->get_by_position(final_block->columns() - 1);
     CHECK(row_id_col.name == BeConsts::ROWID_COL);
     auto tuple_desc = _row_desc.tuple_descriptors()[0];
@@ -123,6 +132,59 @@ Status VResultSink::second_phase_fetch_data(RuntimeState* state, Block* final_bl
     return Status::OK();
 }
 
+Status VResultSink::fetch_deferred_slots(RuntimeState* state, Block* final_block) {
+    auto tuple_desc = state->desc_tbl().get_tuple_descriptor(_fetch_option.fetch_tuple_id);
+    if (tuple_desc == nullptr ||
+        _fetch_option.output_slot_ids.size() != tuple_desc->slots().size()) {
+        return Status::InternalError("invalid fetch option, tuple id {}",
+                                     _fetch_option.fetch_tuple_id);
+    }
+    // the column positions in final block of the slots of fetch tuple
+    std::vector<int> column_ids;
+    int row_id_column_id = -1;
+    for (size_t i = 0; i < tuple_desc->slots().size(); ++i) {
+        int column_id = _row_desc.get_column_id(_fetch_option.output_slot_ids[i], true);
+        if (column_id < 0 || column_id >= final_block->columns()) {
+            return Status::InternalError("output slot {} of fetch tuple {} is not in block",
+                                         _fetch_option.output_slot_ids[i],
+                                         _fetch_option.fetch_tuple_id);
+        }
+        if (tuple_desc->slots()[i]->col_name() == BeConsts::ROWID_COL) {
+            row_id_column_id = column_id;
+        }
+        column_ids.push_back(column_id);
+    }
+    if (row_id_column_id < 0) {
+        return Status::InternalError("no row id slot in fetch tuple {}",
+                                     _fetch_option.fetch_tuple_id);
+    }
+
+    FetchOption fetch_option;
+    fetch_option.desc = tuple_desc;
+    fetch_option.t_fetch_opt = _fetch_option;
+    fetch_option.runtime_state = state;
+    RowIDFetcher id_fetcher(fetch_option);
+    RETURN_IF_ERROR(id_fetcher.init());
+    Block fetched_block;
+    const auto& row_ids = final_block->get_by_position(row_id_column_id).column;
+    RETURN_IF_ERROR(id_fetcher.fetch(row_ids, &fetched_block));
+
+    for (size_t i = 0; i < tuple_desc->slots().size(); ++i) {
+        const auto& col_name = tuple_desc->slots()[i]->col_name();
+        if (col_name == BeConsts::ROWID_COL) {
+            continue;
+        }
+        auto* fetched = fetched_block.try_get_by_name(col_name);
+        if (fetched == nullptr) {
+            return Status::InternalError("column {} is not fetched", col_name);
+        }
+        auto& dst = final_block->get_by_position(column_ids[i]);
+        // keep the nullable of the slot in sink, e.g. the deferred side of outer join
+        dst.column = dst.type->is_nullable() ? make_nullable(fetched->column) : fetched->column;
+    }
+    return Status::OK();
+}
+
 Status VResultSink::send(RuntimeState* state, Block* block, bool eos) {
     if (_fetch_option.use_two_phase_fetch && block->rows() > 0) {
         RETURN_IF_ERROR(second_phase_fetch_data(state, block));
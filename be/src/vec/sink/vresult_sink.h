@@ -143,6 +143,8 @@ public:
 private:
     Status prepare_exprs(RuntimeState* state);
     Status second_phase_fetch_data(RuntimeState* state, Block* final_block);
+    // Fetch the slots of fetch tuple in place, the other columns of block are kept.
+    Status fetch_deferred_slots(RuntimeState* state, Block* final_block);
     TResultSinkType::type _sink_type;
     // set file options when sink type is FILE
     std::unique_ptr<ResultFileOptions> _file_opts;
@@ -1253,26 +1253,56 @@ Status VOlapTableSink::find_tablet(RuntimeState* state, vectorized::Block* block
     return status;
 }
 
-void VOlapTableSink::_generate_row_distribution_payload(
-        ChannelDistributionPayload& channel_to_payload, const VOlapTablePartition* partition,
-        uint32_t tablet_index, int row_idx, size_t row_cnt) {
-    // Generate channel payload for sinking data to differenct node channel
-    for (int j = 0; j < partition->indexes.size(); ++j) {
-        auto tid = partition->indexes[j].tablets[tablet_index];
-        auto it = _channels[j]->_channels_by_tablet.find(tid);
-        DCHECK(it != _channels[j]->_channels_by_tablet.end())
-                << "unknown tablet, tablet_id=" << tablet_index;
-        for (const auto& channel : it->second) {
-            if (channel_to_payload[j].count(channel.get()) < 1) {
-                channel_to_payload[j].insert(
-                        {channel.get(), Payload {std::unique_ptr<vectorized::IColumn::Selector>(
-                                                         new vectorized::IColumn::Selector()),
-                                                 std::vector<int64_t>()}});
+void VOlapTableSink::_generate_block_distribution_payload(
+        ChannelDistributionPayload& channel_to_payload,
+        const std::vector<const VOlapTablePartition*>& partitions,
+        const std::vector<uint32_t>& tablet_indexes, size_t row_cnt) {
+    // Generate channel payload for sinking data to differenct node channel. The node channels
+    // of a tablet are looked up once per block instead of once per row, rows of a block are
+    // usually spread over a small set of tablets.
+    size_t num_valid_rows = 0;
+    for (size_t i = 0; i < row_cnt; ++i) {
+        num_valid_rows += partitions[i] != nullptr;
+    }
+    for (int j = 0; j < _channels.size(); ++j) {
+        std::unordered_map<int64_t, std::vector<Payload*>> tablet_to_payloads;
+        int64_t last_tid = -1;
+        std::vector<Payload*>* last_payloads = nullptr;
+        for (size_t row_idx = 0; row_idx < row_cnt; ++row_idx) {
+            const auto* partition = partitions[row_idx];
+            if (partition == nullptr) {
+                continue;
+            }
+            auto tid = partition->indexes[j].tablets[tablet_indexes[row_idx]];
+            if (last_payloads == nullptr || tid != last_tid) {
+                auto [it, inserted] = tablet_to_payloads.try_emplace(tid);
+                if (inserted) {
+                    auto channels_it = _channels[j]->_channels_by_tablet.find(tid);
+                    DCHECK(channels_it != _channels[j]->_channels_by_tablet.end())
+                            << "unknown tablet, tablet_id=" << tid;
+                    for (const auto& channel : channels_it->second) {
+                        auto payload_it = channel_to_payload[j].find(channel.get());
+                        if (payload_it == channel_to_payload[j].end()) {
+                            Payload payload {std::make_unique<vectorized::IColumn::Selector>(),
+                                             std::vector<int64_t>()};
+                            payload.first->reserve(num_valid_rows);
+                            payload.second.reserve(num_valid_rows);
+                            payload_it = channel_to_payload[j]
+                                                 .emplace(channel.get(), std::move(payload))
+                                                 .first;
+                        }
+                        it->second.push_back(&payload_it->second);
+                    }
+                }
+                last_tid = tid;
+                last_payloads = &it->second;
+            }
+            for (auto* payload : *last_payloads) {
+                payload->first->push_back(row_idx);
+                payload->second.push_back(tid);
             }
-            channel_to_payload[j][channel.get()].first->push_back(row_idx);
-            channel_to_payload[j][channel.get()].second.push_back(tid);
         }
-        _number_output_rows += row_cnt;
+        _number_output_rows += num_valid_rows;
     }
 }
 
@@ -1328,6 +1358,11 @@ Status VOlapTableSink::send(RuntimeState* state, vectorized::Block* input_block,
         _partition_to_tablet_map.clear();
     }
     _row_distribution_watch.start();
+    // Find the tablets of all rows first, then distribute the rows to node channels in one pass.
+    // nullptr partition means the row is filtered.
+    std::vector<const VOlapTablePartition*> partitions(num_rows, nullptr);
+    std::vector<uint32_t> tablet_indexes(num_rows, 0);
+    const VOlapTablePartition* last_opened_partition = nullptr;
     for (int i = 0; i < num_rows; ++i) {
         if (UNLIKELY(filtered_rows) > 0 && _filter_bitmap.Get(i)) {
             continue;
@@ -1340,14 +1375,16 @@ Status VOlapTableSink::send(RuntimeState* state, vectorized::Block* input_block,
         if (is_continue) {
             continue;
         }
-        // each row
-        _generate_row_distribution_payload(channel_to_payload, partition, tablet_index, i, 1);
+        partitions[i] = partition;
+        tablet_indexes[i] = tablet_index;
         // open partition
-        if (config::enable_lazy_open_partition) {
+        if (config::enable_lazy_open_partition && partition != last_opened_partition) {
             // aysnc open operation,don't block send operation
             _open_partition(partition);
+            last_opened_partition = partition;
         }
     }
+    _generate_block_distribution_payload(channel_to_payload, partitions, tablet_indexes, num_rows);
     _row_distribution_watch.stop();
     // Random distribution and the block belongs to a single tablet, we could optimize to append the whole
     // block into node channel.
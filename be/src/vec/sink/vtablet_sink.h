@@ -486,10 +486,11 @@ private:
 
     using ChannelDistributionPayload = std::vector<std::unordered_map<VNodeChannel*, Payload>>;
 
-    // payload for each row
-    void _generate_row_distribution_payload(ChannelDistributionPayload& payload,
-                                            const VOlapTablePartition* partition,
-                                            uint32_t tablet_index, int row_idx, size_t row_cnt);
+    // payload for all rows of a block, partitions[i] is nullptr if row i is filtered
+    void _generate_block_distribution_payload(
+            ChannelDistributionPayload& payload,
+            const std::vector<const VOlapTablePartition*>& partitions,
+            const std::vector<uint32_t>& tablet_indexes, size_t row_cnt);
 
     // make input data valid for OLAP table
     // return number of invalid/filtered rows.
@@ -15,10 +15,12 @@
 // specific language governing permissions and limitations
 // under the License.
 
+#include <butil/iobuf.h>
 #include <gtest/gtest-message.h>
 #include <gtest/gtest-test-part.h>
 #include <string.h>
 
+#include <algorithm>
 #include <memory>
 #include <string>
 
@@ -58,6 +60,37 @@ TEST_F(BloomFilterPredicateTest, bloom_filter_func_int_test) {
     func->find(nullptr);
 }
 
+TEST_F(BloomFilterPredicateTest, bloom_filter_func_merge_serialized_test) {
+    std::unique_ptr<BloomFilterFuncBase> func(create_bloom_filter(PrimitiveType::TYPE_INT));
+    std::unique_ptr<BloomFilterFuncBase> other(create_bloom_filter(PrimitiveType::TYPE_INT));
+    EXPECT_TRUE(func->init_with_fixed_length(64 * 1024).ok());
+    EXPECT_TRUE(other->init_with_fixed_length(64 * 1024).ok());
+    const int data_size = 1024;
+    int data[data_size];
+    for (int i = 0; i < data_size; i++) {
+        data[i] = i;
+        if (i % 2 == 0) {
+            func->insert((const void*)&data[i]);
+        } else {
+            other->insert((const void*)&data[i]);
+        }
+    }
+    char* other_data = nullptr;
+    int other_len = 0;
+    EXPECT_TRUE(other->get_data(&other_data, &other_len).ok());
+    // chunks which are not aligned to the buckets of the filter
+    butil::IOBuf buf;
+    for (int offset = 0; offset < other_len; offset += 1000) {
+        buf.append_user_data(other_data + offset, std::min(1000, other_len - offset),
+                             [](void*) {});
+    }
+    butil::IOBufAsZeroCopyInputStream stream(buf);
+    EXPECT_TRUE(func->merge(&stream, other_len).ok());
+    for (int i = 0; i < data_size; i++) {
+        EXPECT_TRUE(func->find((const void*)&data[i]));
+    }
+}
+
 TEST_F(BloomFilterPredicateTest, bloom_filter_func_stringval_test) {
     std::unique_ptr<BloomFilterFuncBase> func(create_bloom_filter(PrimitiveType::TYPE_VARCHAR));
     EXPECT_TRUE(func->init(1024, 0.05).ok());
@@ -202,4 +202,45 @@ TEST_F(GeoTypesTest, circle) {
     }
 }
 
+TEST_F(GeoTypesTest, bound) {
+    {
+        const char* wkt = "POLYGON ((10 10, 50 10, 50 50, 10 50, 10 10))";
+        GeoParseStatus status;
+        std::unique_ptr<GeoShape> polygon(GeoShape::from_wkt(wkt, strlen(wkt), &status));
+        GeoBound bound;
+        EXPECT_TRUE(polygon->get_bound(&bound));
+        // the edges are geodesics, which bulge to the pole
+        EXPECT_NEAR(10, bound.min_lng, 1e-6);
+        EXPECT_NEAR(50, bound.max_lng, 1e-6);
+        EXPECT_NEAR(10, bound.min_lat, 1e-6);
+        EXPECT_LE(50, bound.max_lat);
+    }
+    {
+        GeoBound bound;
+        EXPECT_TRUE(GeoPoint::ComputeDistanceBound(116.4, 39.9, 1000, &bound));
+        for (double lng : {bound.min_lng, bound.max_lng}) {
+            double distance = 0;
+            EXPECT_TRUE(GeoPoint::ComputeDistance(lng, 39.9, 116.4, 39.9, &distance));
+            EXPECT_GT(distance, 999.9);
+        }
+        for (double lat : {bound.min_lat, bound.max_lat}) {
+            double distance = 0;
+            EXPECT_TRUE(GeoPoint::ComputeDistance(116.4, lat, 116.4, 39.9, &distance));
+            EXPECT_NEAR(1000, distance, 1);
+        }
+        EXPECT_FALSE(GeoPoint::ComputeDistanceBound(116.4, 39.9, -1, &bound));
+    }
+    {
+        // crosses the antimeridian, only the latitude is bounded
+        GeoCircle circle;
+        EXPECT_EQ(GEO_PARSE_OK, circle.init(180, 0, 10000));
+        GeoBound bound;
+        EXPECT_TRUE(circle.get_bound(&bound));
+        EXPECT_EQ(-180, bound.min_lng);
+        EXPECT_EQ(180, bound.max_lng);
+        EXPECT_GT(0, bound.min_lat);
+        EXPECT_LT(0, bound.max_lat);
+    }
+}
+
 } // namespace doris
@@ -73,6 +73,14 @@ public:
     }
 };
 
+static const std::string s_range_file = ".http_client_test_range.dat";
+
+class HttpClientTestFileHandler : public HttpHandler {
+public:
+    void handle(HttpRequest* req) override { do_file_response(s_range_file, req); }
+};
+
+static HttpClientTestFileHandler s_file_handler = HttpClientTestFileHandler();
 static HttpClientTestSimpleGetHandler s_simple_get_handler = HttpClientTestSimpleGetHandler();
 static HttpClientTestSimplePostHandler s_simple_post_handler = HttpClientTestSimplePostHandler();
 static EvHttpServer* s_server = nullptr;
@@ -89,6 +97,7 @@ public:
         s_server->register_handler(GET, "/simple_get", &s_simple_get_handler);
         s_server->register_handler(HEAD, "/simple_get", &s_simple_get_handler);
         s_server->register_handler(POST, "/simple_post", &s_simple_post_handler);
+        s_server->register_handler(GET, "/file", &s_file_handler);
         s_server->start();
         real_port = s_server->get_real_port();
         EXPECT_NE(0, real_port);
@@ -138,6 +147,51 @@ TEST_F(HttpClientTest, download) {
     unlink(local_file.c_str());
 }
 
+TEST_F(HttpClientTest, download_range) {
+    std::string content = "0123456789abcdefghij";
+    auto fp = fopen(s_range_file.c_str(), "w");
+    fwrite(content.data(), 1, content.size(), fp);
+    fclose(fp);
+    std::string local_file = ".http_client_test_range_local.dat";
+    unlink(local_file.c_str());
+
+    // the second range first, then the first range is resumed after 4 bytes
+    HttpClient client;
+    EXPECT_TRUE(client.init(hostname + "/file").ok());
+    uint64_t downloaded = 0;
+    size_t received = 0;
+    auto st = client.download_range(local_file, 12, 8, &downloaded,
+                                    [&received](size_t length) { received += length; });
+    EXPECT_TRUE(st.ok()) << st;
+    EXPECT_EQ(8, downloaded);
+    EXPECT_EQ(8, received);
+    {
+        auto local_fp = fopen(local_file.c_str(), "r+");
+        fwrite(content.data(), 1, 4, local_fp);
+        fclose(local_fp);
+    }
+    EXPECT_TRUE(client.init(hostname + "/file").ok());
+    downloaded = 4;
+    st = client.download_range(local_file, 0, 12, &downloaded);
+    EXPECT_TRUE(st.ok()) << st;
+    EXPECT_EQ(12, downloaded);
+
+    char buf[50];
+    fp = fopen(local_file.c_str(), "r");
+    auto size = fread(buf, 1, 50, fp);
+    fclose(fp);
+    EXPECT_EQ(content, std::string(buf, size));
+
+    // the handler ignores the range
+    EXPECT_TRUE(client.init(hostname + "/simple_get").ok());
+    client.set_basic_auth("test1", "");
+    downloaded = 0;
+    st = client.download_range(local_file, 0, 5, &downloaded);
+    EXPECT_TRUE(st.is<ErrorCode::NOT_IMPLEMENTED_ERROR>()) << st;
+    unlink(local_file.c_str());
+    unlink(s_range_file.c_str());
+}
+
 TEST_F(HttpClientTest, get_failed) {
     HttpClient client;
     auto st = client.init(hostname + "/simple_get");
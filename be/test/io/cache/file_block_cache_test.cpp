@@ -816,4 +816,45 @@ TEST(LRUFileCache, query_limit_dcheck) {
     }
 }
 
+TEST(LRUFileCache, shard) {
+    if (fs::exists(cache_base_path)) {
+        fs::remove_all(cache_base_path);
+    }
+    fs::create_directories(cache_base_path);
+    io::FileCacheSettings settings;
+    settings.index_queue_elements = 5;
+    settings.index_queue_size = 30;
+    settings.disposable_queue_size = 30;
+    settings.disposable_queue_elements = 5;
+    settings.query_queue_size = 30;
+    settings.query_queue_elements = 5;
+    settings.max_file_segment_size = 100;
+    io::CacheContext context;
+    context.cache_type = io::CacheType::NORMAL;
+    // find two keys which belong to different shards
+    auto key1 = io::LRUFileCache::hash("key1");
+    auto key2 = key1;
+    for (int i = 2; io::KeyHash()(key2) % 2 == io::KeyHash()(key1) % 2; ++i) {
+        key2 = io::LRUFileCache::hash("key" + std::to_string(i));
+    }
+    {
+        io::LRUFileCache shard1(cache_base_path, settings, io::KeyHash()(key1) % 2, 2);
+        io::LRUFileCache shard2(cache_base_path, settings, io::KeyHash()(key2) % 2, 2);
+        ASSERT_TRUE(shard1.initialize());
+        ASSERT_TRUE(shard2.initialize());
+        complete(shard1.get_or_set(key1, 0, 10, context));
+        complete(shard2.get_or_set(key2, 0, 5, context));
+    }
+    // each shard only loads the files of its own keys
+    io::LRUFileCache shard1(cache_base_path, settings, io::KeyHash()(key1) % 2, 2);
+    io::LRUFileCache shard2(cache_base_path, settings, io::KeyHash()(key2) % 2, 2);
+    ASSERT_TRUE(shard1.initialize());
+    ASSERT_TRUE(shard2.initialize());
+    ASSERT_EQ(shard1.get_used_cache_size(io::CacheType::NORMAL), 10);
+    ASSERT_EQ(shard2.get_used_cache_size(io::CacheType::NORMAL), 5);
+    if (fs::exists(cache_base_path)) {
+        fs::remove_all(cache_base_path);
+    }
+}
+
 } // namespace doris::io
@@ -0,0 +1,45 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "io/fs/io_scheduler.h"
+
+#include <gtest/gtest-message.h>
+#include <gtest/gtest-test-part.h>
+
+#include "common/config.h"
+#include "gtest/gtest_pred_impl.h"
+#include "io/io_common.h"
+#include "util/time.h"
+
+namespace doris::io {
+
+TEST(IOSchedulerTest, LimitDeviceBandwidth) {
+    int64_t old_limit = config::local_disk_read_bytes_per_second;
+    // burst of 1MB
+    config::local_disk_read_bytes_per_second = 10 * 1024 * 1024;
+    IOContext io_ctx;
+    io_ctx.reader_type = ReaderType::READER_BASE_COMPACTION;
+    int64_t start_ms = MonotonicMillis();
+    for (int i = 0; i < 3; ++i) {
+        IOScheduler::instance()->schedule(0, &io_ctx, 1024 * 1024);
+    }
+    // the first read is taken from the burst, then 100ms for each
+    EXPECT_GE(MonotonicMillis() - start_ms, 180);
+    config::local_disk_read_bytes_per_second = old_limit;
+}
+
+} // namespace doris::io
@@ -0,0 +1,60 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+#include "io/fs/s3_common.h"
+
+#include <gtest/gtest-message.h>
+#include <gtest/gtest-test-part.h>
+
+#include <iterator>
+#include <string>
+#include <vector>
+
+#include "gtest/gtest_pred_impl.h"
+#include "util/slice.h"
+
+namespace doris {
+
+TEST(SlicesViewStreamTest, ReadAndSeek) {
+    std::string s1 = "hello ";
+    std::string s2 = "doris";
+    std::string s3 = " s3";
+    SlicesViewStream stream({Slice(s1), Slice(s2), Slice(s3)});
+
+    std::string content((std::istreambuf_iterator<char>(stream)),
+                        std::istreambuf_iterator<char>());
+    EXPECT_EQ("hello doris s3", content);
+
+    stream.clear();
+    stream.seekg(0, std::ios_base::end);
+    EXPECT_EQ(14, stream.tellg());
+
+    stream.seekg(4, std::ios_base::beg);
+    char buf[6] = {};
+    stream.read(buf, 5);
+    EXPECT_EQ(5, stream.gcount());
+    EXPECT_EQ("o dor", std::string(buf, 5));
+    EXPECT_EQ(9, stream.tellg());
+
+    stream.seekg(-3, std::ios_base::cur);
+    stream.read(buf, 6);
+    EXPECT_EQ("doris ", std::string(buf, 6));
+
+    stream.seekg(15, std::ios_base::beg);
+    EXPECT_TRUE(stream.fail());
+}
+
+} // namespace doris
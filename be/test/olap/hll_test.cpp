@@ -20,6 +20,8 @@
 #include <gtest/gtest-message.h>
 #include <gtest/gtest-test-part.h>
 
+#include <vector>
+
 #include "gtest/gtest_pred_impl.h"
 #include "util/hash_util.hpp"
 #include "util/slice.h"
@@ -194,6 +196,39 @@ TEST_F(TestHll, Normal) {
     }
 }
 
+TEST_F(TestHll, UpdateBatch) {
+    std::vector<uint64_t> hash_values;
+    for (int i = 0; i < 10 * 1024; ++i) {
+        hash_values.push_back(hash(i));
+    }
+    for (size_t count : {0, 1, 160, 161, 10 * 1024}) {
+        HyperLogLog batch_hll;
+        batch_hll.update_batch(hash_values.data(), count);
+        HyperLogLog hll;
+        for (size_t i = 0; i < count; ++i) {
+            hll.update(hash_values[i]);
+        }
+        EXPECT_EQ(hll.estimate_cardinality(), batch_hll.estimate_cardinality());
+        EXPECT_EQ(hll.to_string(), batch_hll.to_string());
+    }
+}
+
+TEST_F(TestHll, SparseSmallerThanFull) {
+    uint8_t buf[HLL_REGISTERS_COUNT + 1] = {0};
+    // about 5000 non-zero registers, the sparse format is still smaller than the full one
+    HyperLogLog hll;
+    for (int i = 0; i < 5800; ++i) {
+        hll.update(hash(i));
+    }
+    int len = hll.serialize(buf);
+    EXPECT_EQ(HLL_DATA_SPARSE, buf[0]);
+    EXPECT_LT(len, HLL_REGISTERS_COUNT + 1);
+    Slice str((char*)buf, len);
+    EXPECT_TRUE(HyperLogLog::is_valid(str));
+    HyperLogLog test_hll(str);
+    EXPECT_EQ(hll.estimate_cardinality(), test_hll.estimate_cardinality());
+}
+
 TEST_F(TestHll, InvalidPtr) {
     {
         HyperLogLog hll(Slice((char*)nullptr, 0));
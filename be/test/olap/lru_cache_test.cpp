@@ -22,6 +22,7 @@
 #include <gtest/gtest-test-part.h>
 
 #include <iosfwd>
+#include <memory>
 #include <vector>
 
 #include "gtest/gtest_pred_impl.h"
@@ -266,6 +267,35 @@ TEST_F(CacheTest, Usage) {
     ASSERT_EQ(0, cache.get_usage()); // evict 306 706, because 950 + 106 > 1040, so insert failed
 }
 
+TEST_F(CacheTest, Evict) {
+    LRUCache cache(LRUCacheType::SIZE);
+    cache.set_capacity(2000);
+
+    // The usage of each entry is 106 + value, see Usage.
+    insert_LRUCache(cache, CacheKey("100"), 100, CachePriority::NORMAL);
+    insert_LRUCache(cache, CacheKey("200"), 200, CachePriority::DURABLE);
+    insert_LRUCache(cache, CacheKey("300"), 300, CachePriority::NORMAL);
+    insert_LRUCache(cache, CacheKey("400"), 400, CachePriority::NORMAL);
+    ASSERT_EQ(1424, cache.get_usage());
+
+    // the oldest normal entry is enough
+    EXPECT_EQ(206, cache.evict(100));
+    ASSERT_EQ(1218, cache.get_usage());
+
+    // the normal entries are evicted before the durable ones
+    EXPECT_EQ(406 + 506, cache.evict(500));
+    ASSERT_EQ(306, cache.get_usage());
+
+    // an entry in use is not evicted
+    CacheKey key2("200");
+    Cache::Handle* handle = cache.lookup(key2, key2.hash(key2.data(), key2.size(), 0));
+    ASSERT_NE(nullptr, handle);
+    EXPECT_EQ(0, cache.evict(1000));
+    cache.release(handle);
+    EXPECT_EQ(306, cache.evict(1000));
+    ASSERT_EQ(0, cache.get_usage());
+}
+
 TEST_F(CacheTest, Prune) {
     LRUCache cache(LRUCacheType::NUMBER);
     cache.set_capacity(5);
@@ -506,4 +536,53 @@ TEST(CacheHandleTest, HandleTableTest) {
     }
 }
 
+TEST_F(CacheTest, TinyLFUAdmission) {
+    for (auto policy : {CacheAdmissionPolicy::LRU, CacheAdmissionPolicy::TINY_LFU}) {
+        std::unique_ptr<Cache> cache(
+                new ShardedLRUCache("TinyLFUAdmission", 10, LRUCacheType::NUMBER, 1, 0, policy));
+        auto insert = [&](int key) {
+            std::string buf;
+            cache->release(cache->insert(EncodeKey(&buf, key), EncodeValue(key), 1, &deleter,
+                                         CachePriority::NORMAL, 1));
+        };
+        auto lookup = [&](int key) {
+            std::string buf;
+            Cache::Handle* handle = cache->lookup(EncodeKey(&buf, key));
+            if (handle == nullptr) {
+                return false;
+            }
+            cache->release(handle);
+            return true;
+        };
+
+        // hot entries are accessed several times
+        for (int i = 0; i < 10; i++) {
+            insert(i);
+        }
+        for (int round = 0; round < 3; round++) {
+            for (int i = 0; i < 10; i++) {
+                EXPECT_TRUE(lookup(i));
+            }
+        }
+
+        // a scan touches each entry only once
+        for (int i = 100; i < 200; i++) {
+            if (!lookup(i)) {
+                insert(i);
+            }
+        }
+
+        int hot_hits = 0;
+        for (int i = 0; i < 10; i++) {
+            hot_hits += lookup(i);
+        }
+        if (policy == CacheAdmissionPolicy::LRU) {
+            EXPECT_EQ(0, hot_hits);
+        } else {
+            EXPECT_EQ(10, hot_hits);
+        }
+        EXPECT_LE(cache->get_usage(), 10);
+    }
+}
+
 } // namespace doris
@@ -25,6 +25,8 @@
 #include <memory>
 #include <sstream>
 #include <string>
+#include <thread>
+#include <vector>
 
 #include "gtest/gtest_pred_impl.h"
 #include "io/fs/local_file_system.h"
@@ -118,4 +120,28 @@ TEST_F(OlapMetaTest, TestIterate) {
     EXPECT_EQ(Status::OK(), s);
 }
 
+TEST_F(OlapMetaTest, TestGroupPut) {
+    std::vector<std::thread> threads;
+    for (int i = 0; i < 16; i++) {
+        threads.emplace_back([this, i] {
+            for (int j = 0; j < 100; j++) {
+                std::string key = "group_key_" + std::to_string(i) + "_" + std::to_string(j);
+                std::string value = std::to_string(j);
+                EXPECT_EQ(Status::OK(), _meta->group_put(META_COLUMN_FAMILY_INDEX, {{key, value}}));
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    int num_keys = 0;
+    Status s = _meta->iterate(META_COLUMN_FAMILY_INDEX, "group_key_",
+                              [&num_keys](const std::string& key, const std::string& value) {
+                                  ++num_keys;
+                                  return true;
+                              });
+    EXPECT_EQ(Status::OK(), s);
+    EXPECT_EQ(16 * 100, num_keys);
+}
+
 } // namespace doris
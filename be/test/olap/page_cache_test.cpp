@@ -36,8 +36,8 @@ public:
 TEST(StoragePageCacheTest, data_page_only) {
     StoragePageCache cache(kNumShards * 2048, 0, 0, kNumShards);
 
-    StoragePageCache::CacheKey key("abc", 0, 0);
-    StoragePageCache::CacheKey memory_key("mem", 0, 0);
+    StoragePageCache::CacheKey key(1, 0);
+    StoragePageCache::CacheKey memory_key(2, 0);
 
     segment_v2::PageTypePB page_type = segment_v2::DATA_PAGE;
 
@@ -68,7 +68,7 @@ TEST(StoragePageCacheTest, data_page_only) {
 
     // put too many page to eliminate first page
     for (int i = 0; i < 10 * kNumShards; ++i) {
-        StoragePageCache::CacheKey key("bcd", 0, i);
+        StoragePageCache::CacheKey key(3, i);
         PageCacheHandle handle;
         DataPage* data = new DataPage(1024);
         cache.insert(key, data, &handle, page_type, false);
@@ -77,15 +77,15 @@ TEST(StoragePageCacheTest, data_page_only) {
     // cache miss, different offset
     {
         PageCacheHandle handle;
-        StoragePageCache::CacheKey miss_key("abc", 0, 1);
+        StoragePageCache::CacheKey miss_key(1, 1);
         auto found = cache.lookup(miss_key, &handle, page_type);
         EXPECT_FALSE(found);
     }
 
-    // cache miss, different file size
+    // cache miss, different file
     {
         PageCacheHandle handle;
-        StoragePageCache::CacheKey miss_key("abc", 1, 0);
+        StoragePageCache::CacheKey miss_key(4, 0);
         auto found = cache.lookup(miss_key, &handle, page_type);
         EXPECT_FALSE(found);
     }
@@ -102,8 +102,8 @@ TEST(StoragePageCacheTest, data_page_only) {
 TEST(StoragePageCacheTest, index_page_only) {
     StoragePageCache cache(kNumShards * 2048, 100, 0, kNumShards);
 
-    StoragePageCache::CacheKey key("abc", 0, 0);
-    StoragePageCache::CacheKey memory_key("mem", 0, 0);
+    StoragePageCache::CacheKey key(1, 0);
+    StoragePageCache::CacheKey memory_key(2, 0);
 
     segment_v2::PageTypePB page_type = segment_v2::INDEX_PAGE;
 
@@ -134,7 +134,7 @@ TEST(StoragePageCacheTest, index_page_only) {
 
     // put too many page to eliminate first page
     for (int i = 0; i < 10 * kNumShards; ++i) {
-        StoragePageCache::CacheKey key("bcd", 0, i);
+        StoragePageCache::CacheKey key(3, i);
         PageCacheHandle handle;
         DataPage* data = new DataPage(1024);
         cache.insert(key, data, &handle, page_type, false);
@@ -143,15 +143,15 @@ TEST(StoragePageCacheTest, index_page_only) {
     // cache miss, different offset
     {
         PageCacheHandle handle;
-        StoragePageCache::CacheKey miss_key("abc", 1, 1);
+        StoragePageCache::CacheKey miss_key(1, 1);
         auto found = cache.lookup(miss_key, &handle, page_type);
         EXPECT_FALSE(found);
     }
 
-    // cache miss, different file size
+    // cache miss, different file
     {
         PageCacheHandle handle;
-        StoragePageCache::CacheKey miss_key("abc", 1, 0);
+        StoragePageCache::CacheKey miss_key(4, 0);
         auto found = cache.lookup(miss_key, &handle, page_type);
         EXPECT_FALSE(found);
     }
@@ -168,10 +168,10 @@ TEST(StoragePageCacheTest, index_page_only) {
 TEST(StoragePageCacheTest, mixed_pages) {
     StoragePageCache cache(kNumShards * 2048, 10, 0, kNumShards);
 
-    StoragePageCache::CacheKey data_key("data", 0, 0);
-    StoragePageCache::CacheKey index_key("index", 0, 0);
-    StoragePageCache::CacheKey data_key_mem("data_mem", 0, 0);
-    StoragePageCache::CacheKey index_key_mem("index_mem", 0, 0);
+    StoragePageCache::CacheKey data_key(5, 0);
+    StoragePageCache::CacheKey index_key(6, 0);
+    StoragePageCache::CacheKey data_key_mem(7, 0);
+    StoragePageCache::CacheKey index_key_mem(8, 0);
 
     segment_v2::PageTypePB page_type_data = segment_v2::DATA_PAGE;
     segment_v2::PageTypePB page_type_index = segment_v2::INDEX_PAGE;
@@ -214,7 +214,7 @@ TEST(StoragePageCacheTest, mixed_pages) {
 
     // put too many page to eliminate first page of both cache
     for (int i = 0; i < 10 * kNumShards; ++i) {
-        StoragePageCache::CacheKey key("bcd", 0, i);
+        StoragePageCache::CacheKey key(3, i);
         PageCacheHandle handle;
         std::unique_ptr<DataPage> data = std::make_unique<DataPage>(1024);
         std::unique_ptr<DataPage> index = std::make_unique<DataPage>(1024);
@@ -225,7 +225,7 @@ TEST(StoragePageCacheTest, mixed_pages) {
     // cache miss by key
     {
         PageCacheHandle data_handle, index_handle;
-        StoragePageCache::CacheKey miss_key("abc", 0, 1);
+        StoragePageCache::CacheKey miss_key(1, 1);
         auto found_data = cache.lookup(miss_key, &data_handle, page_type_data);
         auto found_index = cache.lookup(miss_key, &index_handle, page_type_index);
         EXPECT_FALSE(found_data);
@@ -235,8 +235,8 @@ TEST(StoragePageCacheTest, mixed_pages) {
     // cache miss by page type
     {
         PageCacheHandle data_handle, index_handle;
-        StoragePageCache::CacheKey miss_key_data("data_miss", 0, 1);
-        StoragePageCache::CacheKey miss_key_index("index_miss", 0, 1);
+        StoragePageCache::CacheKey miss_key_data(9, 1);
+        StoragePageCache::CacheKey miss_key_index(10, 1);
         std::unique_ptr<DataPage> data = std::make_unique<DataPage>(1024);
         std::unique_ptr<DataPage> index = std::make_unique<DataPage>(1024);
         cache.insert(miss_key_data, data.release(), &data_handle, page_type_data, false);
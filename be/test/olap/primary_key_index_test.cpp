@@ -25,6 +25,7 @@
 #include <string>
 #include <vector>
 
+#include "common/config.h"
 #include "gtest/gtest_pred_impl.h"
 #include "gutil/stringprintf.h"
 #include "io/fs/file_writer.h"
@@ -168,4 +169,55 @@ TEST_F(PrimaryKeyIndexTest, builder) {
     }
 }
 
+TEST_F(PrimaryKeyIndexTest, fingerprint_index) {
+    std::string filename = kTestDir + "/fingerprint_index";
+    io::FileWriterPtr file_writer;
+    auto fs = io::global_local_filesystem();
+    EXPECT_TRUE(fs->create_file(filename, &file_writer).ok());
+
+    // keys with a 2 bytes sequence column
+    PrimaryKeyIndexBuilder builder(file_writer.get(), 2);
+    builder.init();
+    std::vector<std::string> keys;
+    for (int i = 1000; i < 10000; i += 2) {
+        keys.push_back(std::to_string(i));
+        builder.add_item(std::to_string(i) + "_s");
+    }
+    segment_v2::PrimaryKeyIndexMetaPB index_meta;
+    EXPECT_TRUE(builder.finalize(&index_meta));
+    EXPECT_TRUE(file_writer->close().ok());
+
+    io::FileReaderSPtr file_reader;
+    EXPECT_TRUE(fs->open_file(filename, &file_reader).ok());
+    auto origin_limit = config::primary_key_fingerprint_index_memory_limit_mb;
+    {
+        PrimaryKeyIndexReader index_reader;
+        EXPECT_TRUE(index_reader.parse_index(file_reader, index_meta).ok());
+        config::primary_key_fingerprint_index_memory_limit_mb = 0;
+        EXPECT_TRUE(index_reader.build_fingerprint_index(2).ok());
+        EXPECT_FALSE(index_reader.has_fingerprint_index());
+    }
+
+    PrimaryKeyIndexReader index_reader;
+    EXPECT_TRUE(index_reader.parse_index(file_reader, index_meta).ok());
+    config::primary_key_fingerprint_index_memory_limit_mb = 16;
+    EXPECT_TRUE(index_reader.build_fingerprint_index(2).ok());
+    config::primary_key_fingerprint_index_memory_limit_mb = origin_limit;
+    EXPECT_TRUE(index_reader.has_fingerprint_index());
+
+    std::unique_ptr<segment_v2::IndexedColumnIterator> index_iterator;
+    EXPECT_TRUE(index_reader.new_iterator(&index_iterator).ok());
+    bool exact_match = false;
+    for (size_t i = 0; i < keys.size(); i++) {
+        EXPECT_TRUE(
+                index_reader.seek_by_fingerprint(index_iterator.get(), keys[i], &exact_match).ok());
+        EXPECT_TRUE(exact_match);
+        EXPECT_EQ(i, index_iterator->get_current_ordinal());
+    }
+    for (std::string key : {"8701", "87", "9999", "1000_s"}) {
+        EXPECT_TRUE(index_reader.seek_by_fingerprint(index_iterator.get(), key, &exact_match).ok());
+        EXPECT_FALSE(exact_match);
+    }
+}
+
 } // namespace doris
@@ -549,6 +549,36 @@ TEST_F(TestRowIdConversion, Basic) {
     EXPECT_EQ(res, -1);
 }
 
+TEST_F(TestRowIdConversion, LinkedSegments) {
+    RowsetId src_rowset;
+    RowsetId dst_rowset;
+    dst_rowset.init(3);
+
+    RowIdConversion rowid_conversion;
+    src_rowset.init(0);
+    rowid_conversion.init_segment_map(src_rowset, {4, 3});
+    src_rowset.init(1);
+    rowid_conversion.init_segment_map(src_rowset, {});
+    src_rowset.init(2);
+    rowid_conversion.init_segment_map(src_rowset, {5});
+    rowid_conversion.set_dst_rowset_id(dst_rowset);
+    rowid_conversion.add_linked_segments();
+
+    // the segments are linked in order, the rows are not moved
+    src_rowset.init(0);
+    RowLocation dst;
+    EXPECT_EQ(rowid_conversion.get(RowLocation(src_rowset, 1, 2), &dst), 0);
+    EXPECT_EQ(dst.rowset_id, dst_rowset);
+    EXPECT_EQ(dst.segment_id, 1);
+    EXPECT_EQ(dst.row_id, 2);
+
+    src_rowset.init(2);
+    EXPECT_EQ(rowid_conversion.get(RowLocation(src_rowset, 0, 4), &dst), 0);
+    EXPECT_EQ(dst.segment_id, 2);
+    EXPECT_EQ(dst.row_id, 4);
+    EXPECT_EQ(rowid_conversion.get(RowLocation(src_rowset, 0, 5), &dst), -1);
+}
+
 INSTANTIATE_TEST_SUITE_P(
         Parameters, TestRowIdConversion,
         ::testing::ValuesIn(std::vector<std::tuple<KeysType, bool, bool, bool>> {
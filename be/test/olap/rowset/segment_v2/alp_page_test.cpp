@@ -0,0 +1,95 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+#include "olap/rowset/segment_v2/alp_page.h"
+
+#include <gtest/gtest-message.h>
+#include <gtest/gtest-test-part.h>
+
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <vector>
+
+#include "gtest/gtest_pred_impl.h"
+#include "olap/olap_common.h"
+#include "vec/common/assert_cast.h"
+#include "vec/columns/columns_number.h"
+
+namespace doris {
+namespace segment_v2 {
+
+class AlpPageTest : public testing::Test {
+public:
+    // return the size of the encoded page
+    size_t check_round_trip(const std::vector<double>& values) {
+        PageBuilderOptions builder_options;
+        builder_options.data_page_size = 256 * 1024;
+        AlpPageBuilder<FieldType::OLAP_FIELD_TYPE_DOUBLE> builder(builder_options);
+        size_t count = values.size();
+        EXPECT_TRUE(builder.add((const uint8_t*)values.data(), &count).ok());
+        OwnedSlice page = builder.finish();
+
+        AlpPageDecoder<FieldType::OLAP_FIELD_TYPE_DOUBLE> decoder(page.slice(),
+                                                                  PageDecoderOptions());
+        EXPECT_TRUE(decoder.init().ok());
+        EXPECT_EQ(values.size(), decoder.count());
+
+        vectorized::MutableColumnPtr column = vectorized::ColumnFloat64::create();
+        size_t n = values.size();
+        EXPECT_TRUE(decoder.next_batch(&n, column).ok());
+        EXPECT_EQ(values.size(), n);
+        const auto& data = assert_cast<const vectorized::ColumnFloat64&>(*column).get_data();
+        for (size_t i = 0; i < n; ++i) {
+            // compare the bits, NaN and -0.0 should be kept as is
+            EXPECT_EQ(0, memcmp(&values[i], &data[i], sizeof(double))) << i;
+        }
+        return page.slice().size;
+    }
+};
+
+TEST_F(AlpPageTest, Decimals) {
+    std::vector<double> values;
+    for (int i = 0; i < 10000; ++i) {
+        values.push_back(100 + (i % 1000) / 100.0);
+    }
+    size_t page_size = check_round_trip(values);
+    EXPECT_LT(page_size, values.size() * sizeof(double) / 4);
+}
+
+TEST_F(AlpPageTest, Exceptions) {
+    std::vector<double> values;
+    for (int i = 0; i < 1000; ++i) {
+        values.push_back(i * 0.5);
+    }
+    values[10] = std::numeric_limits<double>::quiet_NaN();
+    values[20] = -0.0;
+    values[30] = std::numeric_limits<double>::infinity();
+    values[40] = M_PI;
+    check_round_trip(values);
+
+    // too many exceptions, fall back to store the raw values
+    std::vector<double> random_values;
+    for (int i = 0; i < 1000; ++i) {
+        random_values.push_back(std::sin(i) * 1e-3);
+    }
+    EXPECT_EQ(random_values.size() * sizeof(double) + 5, check_round_trip(random_values));
+
+    check_round_trip({});
+}
+
+} // namespace segment_v2
+} // namespace doris
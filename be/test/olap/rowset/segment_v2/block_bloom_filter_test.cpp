@@ -95,6 +95,25 @@ TEST_F(BlockBloomFilterTest, Normal) {
     }
 }
 
+TEST_F(BlockBloomFilterTest, TestAnyHash) {
+    std::unique_ptr<BloomFilter> bf;
+    EXPECT_TRUE(BloomFilter::create(BLOCK_BLOOM_FILTER, &bf).ok());
+    EXPECT_TRUE(bf->init(_expected_num, _fpp, HASH_MURMUR3_X64_64).ok());
+    std::vector<uint64_t> hashes;
+    for (uint32_t i = 0; i < 10000; ++i) {
+        hashes.push_back(bf->hash((char*)&i, sizeof(i)));
+    }
+    for (int i = 0; i < 1000; ++i) {
+        bf->add_hash(hashes[i]);
+    }
+    // the same result as testing the hashes one by one
+    for (auto hash : hashes) {
+        EXPECT_EQ(bf->test_hash(hash), bf->test_any_hash(&hash, 1));
+    }
+    EXPECT_TRUE(bf->test_any_hash(hashes.data(), hashes.size()));
+    EXPECT_FALSE(bf->test_any_hash(hashes.data(), 0));
+}
+
 // Test for int
 TEST_F(BlockBloomFilterTest, SP) {
     // test write
@@ -24,17 +24,23 @@
 #include "io/fs/local_file_system.h"
 #include "olap/column_block.h"
 #include "olap/decimal12.h"
+#include "olap/itoken_extractor.h"
 #include "olap/olap_common.h"
+#include "olap/rowset/segment_v2/bloom_filter.h"
 #include "olap/rowset/segment_v2/column_reader.h"
 #include "olap/rowset/segment_v2/column_writer.h"
 #include "olap/tablet_schema_helper.h"
 #include "olap/types.h"
 #include "testutil/test_util.h"
+#include "vec/columns/column_nullable.h"
+#include "vec/columns/columns_number.h"
+#include "vec/common/assert_cast.h"
 #include "vec/core/types.h"
 #include "vec/data_types/data_type_date.h"
 #include "vec/data_types/data_type_date_time.h"
 #include "vec/data_types/data_type_decimal.h"
 #include "vec/data_types/data_type_nothing.h"
+#include "vec/data_types/data_type_nullable.h"
 #include "vec/data_types/data_type_number.h"
 #include "vec/data_types/data_type_string.h"
 
@@ -825,5 +831,147 @@ TEST_F(ColumnReaderWriterTest, test_mixed_empty_arrays) {
             collection_values.get(), array_is_null.get(), num_array, "test_mixed_empty_arrays");
 }
 
+static void write_segment_ngram_bf_column(const std::vector<std::string>& values,
+                                          const std::string& fname, ColumnMetaPB* meta) {
+    io::FileWriterPtr file_writer;
+    EXPECT_TRUE(io::global_local_filesystem()->create_file(fname, &file_writer).ok());
+
+    ColumnWriterOptions writer_opts;
+    writer_opts.meta = meta;
+    meta->set_column_id(0);
+    meta->set_unique_id(0);
+    meta->set_type(FieldType::OLAP_FIELD_TYPE_VARCHAR);
+    meta->set_length(10);
+    meta->set_encoding(PLAIN_ENCODING);
+    meta->set_compression(segment_v2::CompressionTypePB::LZ4F);
+    meta->set_is_nullable(false);
+    writer_opts.need_segment_ngram_bf = true;
+
+    TabletColumn column = create_varchar_key(1);
+    std::unique_ptr<ColumnWriter> writer;
+    EXPECT_TRUE(ColumnWriter::create(writer_opts, &column, file_writer.get(), &writer).ok());
+    EXPECT_TRUE(writer->init().ok());
+    for (const auto& value : values) {
+        Slice slice(value);
+        EXPECT_TRUE(writer->append(false, &slice).ok());
+    }
+    EXPECT_TRUE(writer->finish().ok());
+    EXPECT_TRUE(writer->write_data().ok());
+    EXPECT_TRUE(writer->write_ordinal_index().ok());
+    EXPECT_TRUE(file_writer->close().ok());
+}
+
+TEST_F(ColumnReaderWriterTest, test_segment_ngram_bf) {
+    auto gram_size = config::segment_ngram_bf_gram_size;
+    auto contains = [&](const ColumnMetaPB& meta, const std::string& pattern) {
+        std::unique_ptr<BloomFilter> segment_bf;
+        std::unique_ptr<BloomFilter> pattern_bf;
+        const auto& bf = meta.segment_ngram_bf().bloom_filter();
+        EXPECT_TRUE(BloomFilter::create(NGRAM_BLOOM_FILTER, &segment_bf, bf.size()).ok());
+        EXPECT_TRUE(segment_bf->init(bf.data(), bf.size(), CITY_HASH_64).ok());
+        EXPECT_TRUE(BloomFilter::create(NGRAM_BLOOM_FILTER, &pattern_bf, bf.size()).ok());
+        NgramTokenExtractor extractor(gram_size);
+        EXPECT_TRUE(
+                extractor.string_like_to_bloom_filter(pattern.data(), pattern.size(), *pattern_bf));
+        return segment_bf->contains(*pattern_bf);
+    };
+
+    {
+        ColumnMetaPB meta;
+        write_segment_ngram_bf_column({"apple", "banana", "cherry"},
+                                      TEST_DIR + "/test_segment_ngram_bf", &meta);
+        ASSERT_TRUE(meta.has_segment_ngram_bf());
+        EXPECT_EQ(gram_size, meta.segment_ngram_bf().gram_size());
+        EXPECT_TRUE(contains(meta, "%nan%"));
+        EXPECT_TRUE(contains(meta, "cher%"));
+        EXPECT_FALSE(contains(meta, "%grape%"));
+
+        io::FileReaderSPtr file_reader;
+        ASSERT_TRUE(io::global_local_filesystem()
+                            ->open_file(TEST_DIR + "/test_segment_ngram_bf", &file_reader)
+                            .ok());
+        std::unique_ptr<ColumnReader> reader;
+        ColumnReaderOptions reader_opts;
+        ASSERT_TRUE(ColumnReader::create(reader_opts, meta, 3, file_reader, &reader).ok());
+        EXPECT_TRUE(reader->has_segment_ngram_bf());
+    }
+
+    {
+        // the values are too large to build a filter
+        auto max_column_kb = config::segment_ngram_bf_max_column_kb;
+        config::segment_ngram_bf_max_column_kb = 1;
+        ColumnMetaPB meta;
+        write_segment_ngram_bf_column(std::vector<std::string>(200, "0123456789"),
+                                      TEST_DIR + "/test_segment_ngram_bf_large", &meta);
+        EXPECT_FALSE(meta.has_segment_ngram_bf());
+        config::segment_ngram_bf_max_column_kb = max_column_kb;
+    }
+}
+
+// the INT values of 0, 1, 2..., every third one null if read into a nullable column
+class IntValuesIterator : public ColumnIterator {
+public:
+    Status seek_to_first() override { return seek_to_ordinal(0); }
+
+    Status seek_to_ordinal(ordinal_t ord) override {
+        _ordinal = ord;
+        return Status::OK();
+    }
+
+    Status next_batch(size_t* n, vectorized::MutableColumnPtr& dst, bool* has_null) override {
+        *has_null = false;
+        for (size_t i = 0; i < *n; ++i, ++_ordinal) {
+            if (dst->is_nullable() && _ordinal % 3 == 0) {
+                dst->insert_default();
+                assert_cast<vectorized::ColumnNullable&>(*dst).get_null_map_data().back() = 1;
+                *has_null = true;
+            } else {
+                int32_t value = _ordinal;
+                dst->insert_many_fix_len_data(reinterpret_cast<const char*>(&value), 1);
+            }
+        }
+        return Status::OK();
+    }
+
+    ordinal_t get_current_ordinal() const override { return _ordinal; }
+
+private:
+    ordinal_t _ordinal = 0;
+};
+
+TEST_F(ColumnReaderWriterTest, test_widening_iterator) {
+    EXPECT_EQ(nullptr, WideningColumnIterator::get_widen_func(FieldType::OLAP_FIELD_TYPE_BIGINT,
+                                                              FieldType::OLAP_FIELD_TYPE_INT));
+    EXPECT_EQ(nullptr, WideningColumnIterator::get_widen_func(FieldType::OLAP_FIELD_TYPE_INT,
+                                                              FieldType::OLAP_FIELD_TYPE_DOUBLE));
+    auto widen = WideningColumnIterator::get_widen_func(FieldType::OLAP_FIELD_TYPE_INT,
+                                                        FieldType::OLAP_FIELD_TYPE_BIGINT);
+    ASSERT_NE(nullptr, widen);
+    WideningColumnIterator iter(std::make_unique<IntValuesIterator>(),
+                                FieldType::OLAP_FIELD_TYPE_INT, widen);
+
+    vectorized::MutableColumnPtr dst = vectorized::ColumnInt64::create();
+    size_t n = 100;
+    EXPECT_TRUE(iter.next_batch(&n, dst).ok());
+    EXPECT_EQ(100, dst->size());
+    for (int i = 0; i < 100; ++i) {
+        EXPECT_EQ(i, assert_cast<vectorized::ColumnInt64&>(*dst).get_data()[i]);
+    }
+
+    EXPECT_TRUE(iter.seek_to_first().ok());
+    vectorized::MutableColumnPtr nullable_dst = vectorized::make_nullable(
+            std::make_shared<vectorized::DataTypeInt64>())->create_column();
+    EXPECT_TRUE(iter.next_batch(&n, nullable_dst).ok());
+    auto& nullable = assert_cast<vectorized::ColumnNullable&>(*nullable_dst);
+    EXPECT_EQ(100, nullable.size());
+    for (int i = 0; i < 100; ++i) {
+        EXPECT_EQ(i % 3 == 0, nullable.is_null_at(i));
+        if (i % 3 != 0) {
+            EXPECT_EQ(i, assert_cast<const vectorized::ColumnInt64&>(nullable.get_nested_column())
+                                 .get_data()[i]);
+        }
+    }
+}
+
 } // namespace segment_v2
 } // namespace doris
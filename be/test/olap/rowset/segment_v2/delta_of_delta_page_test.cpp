@@ -0,0 +1,96 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+#include "olap/rowset/segment_v2/delta_of_delta_page.h"
+
+#include <gtest/gtest-message.h>
+#include <gtest/gtest-test-part.h>
+
+#include <limits>
+#include <vector>
+
+#include "gtest/gtest_pred_impl.h"
+#include "olap/olap_common.h"
+#include "vec/common/assert_cast.h"
+#include "vec/columns/columns_number.h"
+
+namespace doris {
+namespace segment_v2 {
+
+class DeltaOfDeltaPageTest : public testing::Test {
+public:
+    void check_round_trip(const std::vector<int64_t>& values) {
+        PageBuilderOptions builder_options;
+        builder_options.data_page_size = 256 * 1024;
+        DeltaOfDeltaPageBuilder<FieldType::OLAP_FIELD_TYPE_BIGINT> builder(builder_options);
+        size_t count = values.size();
+        EXPECT_TRUE(builder.add((const uint8_t*)values.data(), &count).ok());
+        OwnedSlice page = builder.finish();
+
+        DeltaOfDeltaPageDecoder<FieldType::OLAP_FIELD_TYPE_BIGINT> decoder(page.slice(),
+                                                                         PageDecoderOptions());
+        ASSERT_TRUE(decoder.init().ok());
+        ASSERT_EQ(values.size(), decoder.count());
+
+        vectorized::MutableColumnPtr column = vectorized::ColumnInt64::create();
+        size_t n = values.size();
+        ASSERT_TRUE(decoder.next_batch(&n, column).ok());
+        ASSERT_EQ(values.size(), n);
+        const auto& data = assert_cast<const vectorized::ColumnInt64&>(*column).get_data();
+        for (size_t i = 0; i < values.size(); ++i) {
+            EXPECT_EQ(values[i], data[i]);
+        }
+
+        if (values.size() > 2) {
+            column->clear();
+            ASSERT_TRUE(decoder.seek_to_position_in_page(1).ok());
+            n = 1;
+            ASSERT_TRUE(decoder.next_batch(&n, column).ok());
+            EXPECT_EQ(values[1], data[0]);
+            EXPECT_EQ(2, decoder.current_index());
+        }
+    }
+};
+
+TEST_F(DeltaOfDeltaPageTest, RoundTrip) {
+    std::vector<int64_t> values;
+    for (int64_t i = 0; i < 10000; ++i) {
+        values.push_back(1700000000000 + i * 1000 + (i % 7 == 0 ? 3 : 0));
+    }
+    check_round_trip(values);
+
+    check_round_trip({});
+    check_round_trip({42});
+    check_round_trip({std::numeric_limits<int64_t>::min(), std::numeric_limits<int64_t>::max(),
+                      0, std::numeric_limits<int64_t>::min(), -1});
+}
+
+TEST_F(DeltaOfDeltaPageTest, RegularStepIsSmall) {
+    std::vector<int64_t> values;
+    for (int64_t i = 0; i < 10000; ++i) {
+        values.push_back(1700000000000 + i * 1000);
+    }
+    PageBuilderOptions builder_options;
+    builder_options.data_page_size = 256 * 1024;
+    DeltaOfDeltaPageBuilder<FieldType::OLAP_FIELD_TYPE_BIGINT> builder(builder_options);
+    size_t count = values.size();
+    EXPECT_TRUE(builder.add((const uint8_t*)values.data(), &count).ok());
+    OwnedSlice page = builder.finish();
+    EXPECT_LT(page.slice().size, values.size());
+}
+
+} // namespace segment_v2
+} // namespace doris
@@ -0,0 +1,151 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "olap/rowset/segment_v2/inverted_index_posting_iterator.h"
+
+#include <gtest/gtest-message.h>
+#include <gtest/gtest-test-part.h>
+
+#include <algorithm>
+#include <memory>
+#include <roaring/roaring.hh>
+#include <utility>
+#include <vector>
+
+#include "gtest/gtest_pred_impl.h"
+
+namespace doris {
+namespace segment_v2 {
+
+// postings of sorted docids, counts the docids visited
+class VectorPostingIterator : public PostingIterator {
+public:
+    VectorPostingIterator(std::vector<uint32_t> docs, size_t* visited)
+            : _docs(std::move(docs)), _visited(visited) {}
+
+    uint32_t next() override {
+        _pos = _started ? _pos + 1 : 0;
+        _started = true;
+        return _update();
+    }
+
+    uint32_t advance(uint32_t target) override {
+        size_t begin = _started ? _pos : 0;
+        _started = true;
+        _pos = std::lower_bound(_docs.begin() + begin, _docs.end(), target) - _docs.begin();
+        return _update();
+    }
+
+    uint64_t cost() const override { return _docs.size(); }
+
+private:
+    uint32_t _update() {
+        if (_pos >= _docs.size()) {
+            return _doc = END;
+        }
+        ++*_visited;
+        return _doc = _docs[_pos];
+    }
+
+    std::vector<uint32_t> _docs;
+    size_t* _visited;
+    size_t _pos = 0;
+    bool _started = false;
+};
+
+static std::vector<uint32_t> drain(PostingIterator* iterator) {
+    std::vector<uint32_t> docs;
+    for (uint32_t doc = iterator->next(); doc != PostingIterator::END; doc = iterator->next()) {
+        docs.push_back(doc);
+    }
+    return docs;
+}
+
+static std::vector<PostingIteratorPtr> make_iterators(std::vector<std::vector<uint32_t>> lists,
+                                                      size_t* visited) {
+    std::vector<PostingIteratorPtr> iterators;
+    for (auto& docs : lists) {
+        iterators.push_back(std::make_unique<VectorPostingIterator>(std::move(docs), visited));
+    }
+    return iterators;
+}
+
+TEST(PostingIteratorTest, Conjunction) {
+    size_t visited = 0;
+    ConjunctionPostingIterator iterator(
+            make_iterators({{1, 3, 5, 7, 9, 11}, {3, 4, 5, 9, 10, 11, 12}, {0, 3, 9, 11}},
+                           &visited));
+    EXPECT_EQ(drain(&iterator), std::vector<uint32_t>({3, 9, 11}));
+
+    ConjunctionPostingIterator disjoint(make_iterators({{1, 3}, {2, 4}}, &visited));
+    EXPECT_EQ(drain(&disjoint), std::vector<uint32_t>());
+}
+
+TEST(PostingIteratorTest, ConjunctionSkipsByTheRarestTerm) {
+    size_t visited = 0;
+    std::vector<uint32_t> frequent(100000);
+    for (uint32_t i = 0; i < frequent.size(); ++i) {
+        frequent[i] = i;
+    }
+    ConjunctionPostingIterator iterator(make_iterators({frequent, {10, 50000, 99999}}, &visited));
+    EXPECT_EQ(drain(&iterator), std::vector<uint32_t>({10, 50000, 99999}));
+    // the frequent postings are advanced to the docids of the rare ones, not scanned
+    EXPECT_LT(visited, 20);
+}
+
+TEST(PostingIteratorTest, Disjunction) {
+    size_t visited = 0;
+    DisjunctionPostingIterator iterator(
+            make_iterators({{1, 5, 9}, {2, 5, 10}, {}, {0, 9, 20}}, &visited));
+    EXPECT_EQ(drain(&iterator), std::vector<uint32_t>({0, 1, 2, 5, 9, 10, 20}));
+
+    DisjunctionPostingIterator advanced(make_iterators({{1, 5, 9}, {2, 6, 10}}, &visited));
+    EXPECT_EQ(advanced.advance(6), 6);
+    EXPECT_EQ(advanced.next(), 9);
+    EXPECT_EQ(advanced.advance(10), 10);
+    EXPECT_EQ(advanced.next(), PostingIterator::END);
+}
+
+TEST(PostingIteratorTest, CollectWithLimit) {
+    size_t visited = 0;
+    std::vector<uint32_t> docs(10000);
+    for (uint32_t i = 0; i < docs.size(); ++i) {
+        docs[i] = i * 2;
+    }
+    roaring::Roaring candidates;
+    candidates.addRange(0, 20000);
+    // the deleted rows are not counted
+    candidates.remove(0);
+    candidates.remove(4);
+
+    VectorPostingIterator iterator(docs, &visited);
+    roaring::Roaring result;
+    EXPECT_EQ(collect_postings(&iterator, candidates, 3, &result), 3);
+    EXPECT_EQ(result, roaring::Roaring::bitmapOf(3, 2, 6, 8));
+    // stopped early
+    EXPECT_LT(visited, 10);
+
+    // the postings skip to the candidates
+    roaring::Roaring sparse_candidates = roaring::Roaring::bitmapOf(3, 7001, 15000, 19998);
+    VectorPostingIterator all(docs, &visited);
+    roaring::Roaring sparse_result;
+    EXPECT_EQ(collect_postings(&all, sparse_candidates, 100, &sparse_result), 2);
+    EXPECT_EQ(sparse_result, roaring::Roaring::bitmapOf(2, 15000, 19998));
+}
+
+} // namespace segment_v2
+} // namespace doris
@@ -0,0 +1,74 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "olap/rowset/segment_v2/segment_footer_meta_manager.h"
+
+#include <gen_cpp/segment_v2.pb.h>
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <string>
+
+#include "io/fs/local_file_system.h"
+#include "olap/olap_meta.h"
+
+namespace doris {
+namespace segment_v2 {
+
+class SegmentFooterMetaManagerTest : public testing::Test {
+public:
+    void SetUp() override {
+        _root_path = "./ut_dir/segment_footer_meta_manager_test";
+        EXPECT_TRUE(io::global_local_filesystem()->delete_and_create_directory(_root_path).ok());
+        _meta = std::make_unique<OlapMeta>(_root_path);
+        EXPECT_TRUE(_meta->init().ok());
+    }
+
+    void TearDown() override {
+        _meta.reset();
+        EXPECT_TRUE(io::global_local_filesystem()->delete_directory(_root_path).ok());
+    }
+
+protected:
+    std::string _root_path;
+    std::unique_ptr<OlapMeta> _meta;
+};
+
+TEST_F(SegmentFooterMetaManagerTest, SaveGetAndRemove) {
+    RowsetId rowset_id;
+    rowset_id.init(10086);
+    SegmentFooterPB footer;
+    footer.set_version(1);
+    footer.set_num_rows(4096);
+    footer.add_columns()->set_unique_id(1);
+    EXPECT_TRUE(SegmentFooterMetaManager::save(_meta.get(), rowset_id, 0, 1024, footer).ok());
+    EXPECT_TRUE(SegmentFooterMetaManager::save(_meta.get(), rowset_id, 1, 2048, footer).ok());
+
+    SegmentFooterPB loaded;
+    EXPECT_TRUE(SegmentFooterMetaManager::get(_meta.get(), rowset_id, 0, 1024, &loaded).ok());
+    EXPECT_EQ(footer.SerializeAsString(), loaded.SerializeAsString());
+    // stale footer of a file with different size
+    EXPECT_FALSE(SegmentFooterMetaManager::get(_meta.get(), rowset_id, 1, 1024, &loaded).ok());
+    EXPECT_FALSE(SegmentFooterMetaManager::get(_meta.get(), rowset_id, 2, 1024, &loaded).ok());
+
+    EXPECT_TRUE(SegmentFooterMetaManager::remove(_meta.get(), rowset_id, 2).ok());
+    EXPECT_FALSE(SegmentFooterMetaManager::get(_meta.get(), rowset_id, 0, 1024, &loaded).ok());
+    EXPECT_FALSE(SegmentFooterMetaManager::get(_meta.get(), rowset_id, 1, 2048, &loaded).ok());
+}
+
+} // namespace segment_v2
+} // namespace doris
@@ -27,6 +27,7 @@
 #include <memory>
 #include <new>
 #include <string>
+#include <vector>
 
 #include "gtest/gtest_pred_impl.h"
 #include "olap/data_dir.h"
@@ -108,4 +109,54 @@ TEST_F(TabletMetaManagerTest, TestLoad) {
     // EXPECT_EQ(_json_header, json_meta_read);
 }
 
+TEST_F(TabletMetaManagerTest, TestSaveAndRemoveDeleteBitmap) {
+    const TTabletId tablet_id = 15672;
+    RowsetId rowset_id;
+    rowset_id.init(10);
+    for (uint64_t version = 2; version <= 4; ++version) {
+        DeleteBitmap delete_bitmap(tablet_id);
+        // the version of the bitmap is replaced by the saved version
+        delete_bitmap.add({rowset_id, 0, 0}, version * 10);
+        Status s = TabletMetaManager::save_delete_bitmap(_data_dir, tablet_id, version,
+                                                         delete_bitmap);
+        EXPECT_EQ(Status::OK(), s);
+    }
+    // the bitmaps of another tablet
+    DeleteBitmap other_delete_bitmap(tablet_id + 1);
+    other_delete_bitmap.add({rowset_id, 0, 0}, 1);
+    EXPECT_EQ(Status::OK(), TabletMetaManager::save_delete_bitmap(_data_dir, tablet_id + 1, 2,
+                                                                  other_delete_bitmap));
+
+    DeleteBitmap merged(tablet_id);
+    std::vector<int64_t> versions;
+    auto merge_func = [&](int64_t id, int64_t version, const std::string& value) -> bool {
+        EXPECT_EQ(tablet_id, id);
+        versions.push_back(version);
+        EXPECT_EQ(Status::OK(), TabletMetaManager::merge_delete_bitmap(value, &merged));
+        return true;
+    };
+    EXPECT_EQ(Status::OK(), TabletMetaManager::traverse_delete_bitmaps(_data_dir->get_meta(),
+                                                                       merge_func, tablet_id));
+    EXPECT_EQ(3, versions.size());
+    for (uint64_t version = 2; version <= 4; ++version) {
+        EXPECT_TRUE(merged.contains({rowset_id, 0, version}, version * 10));
+        EXPECT_FALSE(merged.contains({rowset_id, 0, 0}, version * 10));
+    }
+
+    EXPECT_EQ(Status::OK(), TabletMetaManager::remove_delete_bitmaps(_data_dir, tablet_id, 3));
+    versions.clear();
+    auto collect_func = [&](int64_t, int64_t version, const std::string&) -> bool {
+        versions.push_back(version);
+        return true;
+    };
+    EXPECT_EQ(Status::OK(), TabletMetaManager::traverse_delete_bitmaps(_data_dir->get_meta(),
+                                                                       collect_func, tablet_id));
+    EXPECT_EQ(std::vector<int64_t>({4}), versions);
+
+    versions.clear();
+    EXPECT_EQ(Status::OK(), TabletMetaManager::traverse_delete_bitmaps(_data_dir->get_meta(),
+                                                                       collect_func));
+    EXPECT_EQ(2, versions.size());
+}
+
 } // namespace doris
@@ -377,6 +377,41 @@ TEST_F(TestTimestampedVersionTracker, capture_consistent_versions) {
     EXPECT_EQ(Version(6, 8), version_path[3]);
 }
 
+TEST_F(TestTimestampedVersionTracker, capture_consistent_versions_cached) {
+    VersionGraph version_graph;
+    version_graph.add_version_to_graph(Version(0, 0));
+    version_graph.add_version_to_graph(Version(1, 1));
+    version_graph.add_version_to_graph(Version(2, 5));
+
+    std::vector<Version> version_path;
+    EXPECT_TRUE(version_graph.capture_consistent_versions(Version(0, 5), &version_path).ok());
+    EXPECT_EQ(5, version_graph._cached_path_end);
+
+    // a new version extends the cached path
+    version_graph.add_version_to_graph(Version(6, 6));
+    EXPECT_EQ(6, version_graph._cached_path_end);
+    version_path.clear();
+    EXPECT_TRUE(version_graph.capture_consistent_versions(Version(0, 6), &version_path).ok());
+    std::vector<Version> expected {Version(0, 0), Version(1, 1), Version(2, 5), Version(6, 6)};
+    EXPECT_EQ(expected, version_path);
+
+    // a compaction output is a shorter path
+    version_graph.add_version_to_graph(Version(1, 6));
+    EXPECT_EQ(-1, version_graph._cached_path_end);
+    version_path.clear();
+    EXPECT_TRUE(version_graph.capture_consistent_versions(Version(0, 6), &version_path).ok());
+    expected = {Version(0, 0), Version(1, 6)};
+    EXPECT_EQ(expected, version_path);
+
+    // deleting a version off the path keeps the cached path
+    EXPECT_TRUE(version_graph.delete_version_from_graph(Version(2, 5)).ok());
+    EXPECT_EQ(6, version_graph._cached_path_end);
+    EXPECT_TRUE(version_graph.delete_version_from_graph(Version(1, 6)).ok());
+    EXPECT_EQ(-1, version_graph._cached_path_end);
+    EXPECT_FALSE(version_graph.capture_consistent_versions(Version(0, 6), nullptr).ok());
+    EXPECT_TRUE(version_graph.capture_consistent_versions(Version(0, 1), nullptr).ok());
+}
+
 TEST_F(TestTimestampedVersionTracker, capture_consistent_versions_with_same_rowset) {
     std::vector<RowsetMetaSharedPtr> rs_metas;
     std::vector<RowsetMetaSharedPtr> expired_rs_metas;
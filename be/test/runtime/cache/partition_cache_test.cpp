@@ -314,6 +314,64 @@ TEST_F(PartitionCacheTest, fetch_not_continue_partition) {
     clear();
 }
 
+TEST_F(PartitionCacheTest, fetch_partial_partition) {
+    init_default();
+    init_batch_data(1, 1, 3, CacheType::PARTITION_CACHE);
+    set_sql_key(_fetch_request->mutable_sql_key(), 1, 1);
+    _fetch_request->set_fetch_partial(true);
+    for (int i = 1; i <= 4; i++) {
+        PCacheParam* p = _fetch_request->add_params();
+        p->set_partition_key(i);
+        // partition 2 has a newer version, partition 4 is not cached
+        p->set_last_version(i == 2 ? 5 : i);
+        p->set_last_version_time(i == 2 ? 5 : i);
+    }
+    _cache->fetch(_fetch_request, _fetch_result);
+    EXPECT_TRUE(_fetch_result->status() == PCacheStatus::CACHE_OK);
+    EXPECT_EQ(_fetch_result->values_size(), 2);
+    EXPECT_EQ(_fetch_result->values(0).param().partition_key(), 1);
+    EXPECT_EQ(_fetch_result->values(1).param().partition_key(), 3);
+    EXPECT_EQ(_fetch_result->missed_partition_keys_size(), 2);
+    EXPECT_EQ(_fetch_result->missed_partition_keys(0), 2);
+    EXPECT_EQ(_fetch_result->missed_partition_keys(1), 4);
+    clear();
+}
+
+TEST_F(PartitionCacheTest, prune_least_recently_used) {
+    init(1, 1);
+    // 16 * 1024 * 128 = 2M, not pruned yet
+    init_batch_data(128, 1, 1024, CacheType::PARTITION_CACHE);
+    EXPECT_EQ(_cache->get_cache_size(), 2 * 1024 * 1024);
+
+    // sql 1 becomes the most recently used one
+    set_sql_key(_fetch_request->mutable_sql_key(), 1, 1);
+    PCacheParam* p1 = _fetch_request->add_params();
+    p1->set_partition_key(1);
+    p1->set_last_version(1);
+    p1->set_last_version_time(1);
+    _cache->fetch(_fetch_request, _fetch_result);
+    EXPECT_TRUE(_fetch_result->status() == PCacheStatus::CACHE_OK);
+
+    set_sql_key(_update_request->mutable_sql_key(), 200, 200);
+    PCacheValue* value = _update_request->add_values();
+    value->mutable_param()->set_partition_key(1);
+    value->mutable_param()->set_last_version(1);
+    value->mutable_param()->set_last_version_time(1);
+    value->set_data_size(16);
+    value->add_rows("0123456789abcdef");
+    _update_request->set_cache_type(CacheType::PARTITION_CACHE);
+    _cache->update(_update_request, _update_response);
+
+    EXPECT_LE(_cache->get_cache_size(), 1 * 1024 * 1024);
+    UniqueId sql1(1, 1);
+    UniqueId sql2(2, 2);
+    UniqueId sql200(200, 200);
+    EXPECT_TRUE(_cache->contains(sql1));
+    EXPECT_FALSE(_cache->contains(sql2));
+    EXPECT_TRUE(_cache->contains(sql200));
+    clear();
+}
+
 TEST_F(PartitionCacheTest, update_sql_cache) {
     init_default();
     init_batch_data(1, 1, 1, CacheType::SQL_CACHE);
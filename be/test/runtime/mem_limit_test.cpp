@@ -21,7 +21,10 @@
 #include <memory>
 
 #include "gtest/gtest_pred_impl.h"
+#include "runtime/memory/mem_reservation.h"
 #include "runtime/memory/mem_tracker_limiter.h"
+#include "runtime/task_group/task_group.h"
+#include "util/core_local.h"
 
 namespace doris {
 
@@ -54,4 +57,83 @@ TEST(MemTestTest, SingleTrackerWithLimit) {
     t->release(5);
 }
 
+TEST(MemTestTest, Reservation) {
+    auto t = std::make_shared<MemTrackerLimiter>(MemTrackerLimiter::Type::GLOBAL,
+                                                 "reservation tracker", 100);
+    t->consume(50);
+    {
+        MemReservation reservation;
+        reservation.init(t);
+        EXPECT_TRUE(reservation.try_resize(30));
+        EXPECT_EQ(t->reserved_consumption(), 30);
+        EXPECT_EQ(t->spare_capacity(), 20);
+        EXPECT_FALSE(t->can_reserve(21));
+        EXPECT_FALSE(t->check_limit(21).ok());
+
+        // denied, keeps the current reservation
+        EXPECT_FALSE(reservation.try_resize(60));
+        EXPECT_EQ(reservation.bytes(), 30);
+        EXPECT_EQ(reservation.denied_count(), 1);
+
+        EXPECT_TRUE(reservation.try_resize(50));
+        EXPECT_EQ(t->reserved_consumption(), 50);
+        EXPECT_TRUE(reservation.try_resize(10));
+        EXPECT_EQ(t->reserved_consumption(), 10);
+    }
+    EXPECT_EQ(t->reserved_consumption(), 0);
+    EXPECT_TRUE(t->try_reserve(50));
+    EXPECT_FALSE(t->try_reserve(1));
+    t->release_reservation(50);
+    t->release(50);
+}
+
+TEST(MemTestTest, CoreLocalConsume) {
+    auto t = std::make_shared<MemTrackerLimiter>(MemTrackerLimiter::Type::GLOBAL);
+    int64_t slack = t->max_pending_bytes() / CoreLocalValue<int64_t>().size();
+    ASSERT_GT(slack, 1);
+    t->core_local_consume(slack - 1);
+    EXPECT_EQ(t->consumption(), 0);
+    EXPECT_EQ(t->precise_consumption(), slack - 1);
+    t->core_local_consume(1 - slack);
+    EXPECT_EQ(t->precise_consumption(), 0);
+
+    // the slack is bounded by the limit
+    int64_t limit = 64 * CoreLocalValue<int64_t>().size() * 1000;
+    auto limited = std::make_shared<MemTrackerLimiter>(MemTrackerLimiter::Type::GLOBAL,
+                                                       "core local tracker", limit);
+    EXPECT_EQ(limited->max_pending_bytes(), limit / 64);
+    limited->consume(limit - 1000);
+    limited->core_local_consume(999);
+    EXPECT_EQ(limited->consumption(), limit - 1000);
+    EXPECT_TRUE(limited->check_limit(1).ok());
+    // the pending bytes are summed up near the limit
+    EXPECT_FALSE(limited->check_limit(2).ok());
+    limited->core_local_consume(-999);
+    limited->release(limit - 1000);
+}
+
+TEST(MemTestTest, TaskGroupSoftLimitReservation) {
+    taskgroup::TaskGroupInfo tg_info {1, "soft_limit_group", 1024, 1000, false, 1};
+    auto tg = std::make_shared<taskgroup::TaskGroup>(tg_info);
+    EXPECT_EQ(tg->memory_soft_limit(),
+              1000 / 100 * config::workload_group_memory_soft_limit_percent);
+    int64_t soft_limit = tg->memory_soft_limit();
+
+    auto t = std::make_shared<MemTrackerLimiter>(MemTrackerLimiter::Type::QUERY);
+    tg->add_mem_tracker_limiter(t);
+    EXPECT_TRUE(t->try_reserve(soft_limit - 10));
+    EXPECT_EQ(tg->cached_memory_used(), soft_limit - 10);
+    // the group does not overcommit, beyond its soft limit the operators have to spill
+    EXPECT_FALSE(t->can_reserve(20));
+    EXPECT_FALSE(t->try_reserve(20));
+    EXPECT_EQ(t->reserved_consumption(), soft_limit - 10);
+    EXPECT_TRUE(t->try_reserve(10));
+
+    t->release_reservation(soft_limit);
+    EXPECT_EQ(tg->memory_used(), 0);
+    EXPECT_TRUE(t->try_reserve(20));
+    t->release_reservation(20);
+    tg->remove_mem_tracker_limiter(t);
+}
+
 } // end namespace doris
@@ -0,0 +1,50 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "runtime/memory/alloc_profile.h"
+
+#include <gtest/gtest-message.h>
+#include <gtest/gtest-test-part.h>
+
+#include <string>
+
+#include "gtest/gtest_pred_impl.h"
+
+namespace doris {
+
+TEST(AllocProfileTest, FoldedStacks) {
+    void* stack_a[2] = {reinterpret_cast<void*>(0x10), reinterpret_cast<void*>(0x20)};
+    void* stack_b[1] = {reinterpret_cast<void*>(0x30)};
+    AllocProfile profile;
+    profile.record(100, stack_a, 2);
+    profile.record(50, stack_a, 2);
+    profile.record(7, stack_b, 1);
+    EXPECT_EQ(157, profile.sampled_bytes());
+
+    // the outermost frame first, named by address without BfdParser
+    std::string folded = profile.folded_stacks(nullptr);
+    EXPECT_NE(std::string::npos, folded.find("0x20;0x10 150\n"));
+    EXPECT_NE(std::string::npos, folded.find("0x30 7\n"));
+
+    AllocProfile merged;
+    merged.record(1, stack_b, 1);
+    merged.merge(profile);
+    EXPECT_EQ(158, merged.sampled_bytes());
+    EXPECT_NE(std::string::npos, merged.folded_stacks(nullptr).find("0x30 8\n"));
+}
+
+} // namespace doris
@@ -16,14 +16,17 @@
 // under the License.
 
 #include <benchmark/benchmark.h>
+#include <fmt/format.h>
 #include <gflags/gflags.h>
 
 #include <algorithm>
 #include <chrono>
+#include <cmath>
 #include <fstream>
 #include <functional>
 #include <iostream>
 #include <memory>
+#include <numeric>
 #include <random>
 #include <sstream>
 #include <string>
@@ -31,6 +34,7 @@
 
 #include "common/compiler_util.h"
 #include "common/logging.h"
+#include "exprs/zipf_distribution.h"
 #include "gutil/strings/split.h"
 #include "gutil/strings/substitute.h"
 #include "io/fs/file_system.h"
@@ -39,24 +43,43 @@
 #include "olap/comparison_predicate.h"
 #include "olap/data_dir.h"
 #include "olap/in_list_predicate.h"
+#include "olap/iterators.h"
 #include "olap/olap_common.h"
+#include "olap/page_cache.h"
 #include "olap/row_cursor.h"
 #include "olap/rowset/segment_v2/binary_dict_page.h"
 #include "olap/rowset/segment_v2/binary_plain_page.h"
+#include "olap/rowset/segment_v2/encoding_info.h"
 #include "olap/rowset/segment_v2/page_builder.h"
 #include "olap/rowset/segment_v2/page_decoder.h"
+#include "olap/rowset/segment_v2/segment.h"
 #include "olap/rowset/segment_v2/segment_iterator.h"
 #include "olap/rowset/segment_v2/segment_writer.h"
+#include "olap/schema.h"
 #include "olap/tablet_schema.h"
 #include "olap/tablet_schema_helper.h"
 #include "olap/types.h"
 #include "testutil/test_util.h"
+#include "util/block_compression.h"
 #include "util/debug_util.h"
+#include "util/faststring.h"
+#include "vec/columns/column_const.h"
+#include "vec/columns/column_string.h"
+#include "vec/columns/columns_number.h"
+#include "vec/common/hash_table/hash.h"
+#include "vec/common/arena.h"
+#include "vec/common/hash_table/partitioned_hash_map.h"
+#include "vec/core/block.h"
+#include "vec/core/sort_block.h"
+#include "vec/core/sort_description.h"
+#include "vec/data_types/data_type_number.h"
+#include "vec/data_types/data_type_string.h"
+#include "vec/exec/vaggregation_node.h"
+#include "vec/functions/simple_function_factory.h"
 
 DEFINE_string(operation, "Custom",
-              "valid operation: Custom, BinaryDictPageEncode, BinaryDictPageDecode, SegmentScan, "
-              "SegmentWrite, "
-              "SegmentScanByFile, SegmentWriteByFile");
+              "valid operation: Custom, BinaryDictPageEncode, BinaryDictPageDecode, PageEncoding, "
+              "SegmentScan, HashTable, Aggregation, Sort, ColumnString, StringFunction");
 DEFINE_string(input_file, "./sample.dat", "input file directory");
 DEFINE_string(column_type, "int,varchar", "valid type: int, char, varchar, string");
 DEFINE_string(rows_number, "10000", "rows number");
@@ -76,14 +99,14 @@ std::string get_usage(const std::string& progname) {
           "--rows_number=10000 --iterations=40\n";
     ss << "./benchmark_tool --operation=BinaryDictPageDecode "
           "--rows_number=10000 --iterations=40\n";
-    ss << "./benchmark_tool --operation=SegmentScan --column_type=int,varchar "
-          "--rows_number=10000 --iterations=0\n";
-    ss << "./benchmark_tool --operation=SegmentWrite --column_type=int "
-          "--rows_number=10000 --iterations=10\n";
-    ss << "./benchmark_tool --operation=SegmentScanByFile --input_file=./sample.dat "
-          "--iterations=10\n";
-    ss << "./benchmark_tool --operation=SegmentWriteByFile --input_file=./sample.dat "
-          "--iterations=10\n";
+    ss << "./benchmark_tool --operation=PageEncoding --rows_number=1000000 --iterations=10\n";
+    ss << "./benchmark_tool --operation=SegmentScan --rows_number=1000000 --iterations=10\n";
+    ss << "./benchmark_tool --operation=HashTable --rows_number=1000000 --iterations=10\n";
+    ss << "./benchmark_tool --operation=Aggregation --rows_number=1000000 --iterations=10\n";
+    ss << "./benchmark_tool --operation=Sort --rows_number=1000000 --iterations=10\n";
+    ss << "./benchmark_tool --operation=ColumnString --rows_number=1000000 --iterations=10\n";
+    ss << "./benchmark_tool --operation=StringFunction --rows_number=100000 --iterations=10\n";
+    ss << "Add --benchmark_format=json --benchmark_out=<file> to keep the results for tracking\n";
 
     ss << "Sampe data file format: \n"
        << "The first line defines Shcema\n"
@@ -105,6 +128,8 @@ public:
 
     virtual void init() {}
     virtual void run() {}
+    // reports the sizes or the counts of the last run besides the time
+    virtual void add_counters(benchmark::State& state) {}
 
     void register_bm() {
         auto bm = benchmark::RegisterBenchmark(_name.c_str(), [&](benchmark::State& state) {
@@ -117,6 +142,7 @@ public:
                 state.ResumeTiming();
                 this->run();
             }
+            this->add_counters(state);
         });
         if (_iterations != 0) {
             bm->Iterations(_iterations);
@@ -229,6 +255,564 @@ private:
     int _rows_number;
 }; // namespace doris
 
+// Keys in [0, rows) drawn from the distribution:
+//   sequential: 0, 1, 2 ... like auto increment ids, all unique
+//   uniform: uniformly random, about 63% unique
+//   zipf: zipf distribution with the exponent 1, a few hot keys take most of the rows
+std::vector<uint64_t> make_keys(const std::string& distribution, int rows, std::mt19937* rng) {
+    std::vector<uint64_t> keys(rows);
+    zipf_distribution<uint64_t> zipf(rows);
+    for (int i = 0; i < rows; ++i) {
+        if (distribution == "sequential") {
+            keys[i] = i;
+        } else if (distribution == "uniform") {
+            keys[i] = (*rng)() % rows;
+        } else {
+            keys[i] = zipf(*rng) - 1;
+        }
+    }
+    return keys;
+}
+
+// Encodes the values of a type into data pages of an encoding then compresses the pages, as
+// ColumnWriter does, or decompresses and decodes the pages back into a column, as ColumnReader
+// does. The sizes of the pages are reported to compare the ratios of the encodings. The values
+// look like the columns of the type in tables:
+//   INT: slowly increasing small numbers, BIGINT: millisecond timestamps,
+//   DOUBLE: prices with 2 decimals, VARCHAR: 100 distinct names
+class PageEncodingBenchmark : public BaseBenchmark {
+public:
+    PageEncodingBenchmark(int iterations, int rows_number, FieldType type, EncodingTypePB encoding,
+                          CompressionTypePB compression, bool decode)
+            : BaseBenchmark(fmt::format("PageEncoding/{}/{}/{}/{}/rows_number:{}",
+                                        decode ? "decode" : "encode", type_name(type),
+                                        EncodingTypePB_Name(encoding),
+                                        CompressionTypePB_Name(compression), rows_number),
+                            iterations),
+              _rows_number(rows_number),
+              _type(type),
+              _decode(decode) {
+        CHECK(EncodingInfo::get(get_scalar_type_info(type), encoding, &_encoding_info).ok());
+        CHECK(get_block_compression_codec(compression, &_codec).ok());
+    }
+
+    static std::string type_name(FieldType type) {
+        switch (type) {
+        case FieldType::OLAP_FIELD_TYPE_INT:
+            return "INT";
+        case FieldType::OLAP_FIELD_TYPE_BIGINT:
+            return "BIGINT";
+        case FieldType::OLAP_FIELD_TYPE_DOUBLE:
+            return "DOUBLE";
+        default:
+            return "VARCHAR";
+        }
+    }
+
+    void init() override {
+        if (!_values.empty() || !_slices.empty()) {
+            return;
+        }
+        std::mt19937 rng(0);
+        for (int i = 0; i < _rows_number; ++i) {
+            if (_type == FieldType::OLAP_FIELD_TYPE_INT) {
+                append_value<int32_t>(i / 16 + i % 7);
+            } else if (_type == FieldType::OLAP_FIELD_TYPE_BIGINT) {
+                append_value<int64_t>(1700000000000 + i * 1000L + rng() % 10);
+            } else if (_type == FieldType::OLAP_FIELD_TYPE_DOUBLE) {
+                append_value<double>((rng() % 100000) / 100.0);
+            } else {
+                _strings.push_back(fmt::format("name_{}", rng() % 100));
+            }
+        }
+        for (const auto& str : _strings) {
+            _slices.emplace_back(str);
+        }
+        if (_decode) {
+            encode();
+        }
+    }
+
+    void run() override {
+        if (!_decode) {
+            encode();
+            return;
+        }
+        auto column = create_column();
+        for (size_t i = 0; i < _pages.size(); ++i) {
+            Slice page_slice = _pages[i].slice();
+            auto page = std::make_unique<DataPage>(_page_sizes[i]);
+            if (_codec != nullptr) {
+                Slice compressed(_compressed_pages[i].data(), _compressed_pages[i].size());
+                page_slice = Slice(page->data(), _page_sizes[i]);
+                CHECK(_codec->decompress(compressed, &page_slice).ok());
+            }
+            if (auto* pre_decoder = _encoding_info->get_data_page_pre_decoder()) {
+                if (_codec == nullptr) {
+                    memcpy(page->data(), page_slice.data, page_slice.size);
+                    page_slice = Slice(page->data(), page_slice.size);
+                }
+                CHECK(pre_decoder->decode(&page, &page_slice, 0).ok());
+            }
+            PageDecoder* decoder_ptr = nullptr;
+            CHECK(_encoding_info->create_page_decoder(page_slice, {}, &decoder_ptr).ok());
+            std::unique_ptr<PageDecoder> decoder(decoder_ptr);
+            CHECK(decoder->init().ok());
+            size_t n = decoder->count();
+            CHECK(decoder->next_batch(&n, column).ok());
+        }
+        benchmark::DoNotOptimize(column->size());
+    }
+
+    void add_counters(benchmark::State& state) override {
+        size_t encoded_bytes = 0;
+        size_t compressed_bytes = 0;
+        for (size_t i = 0; i < _pages.size(); ++i) {
+            encoded_bytes += _pages[i].slice().size;
+            compressed_bytes +=
+                    _codec != nullptr ? _compressed_pages[i].size() : _pages[i].slice().size;
+        }
+        state.counters["pages"] = _pages.size();
+        state.counters["encoded_bytes"] = encoded_bytes;
+        state.counters["compressed_bytes"] = compressed_bytes;
+    }
+
+private:
+    template <typename T>
+    void append_value(T value) {
+        _values.append(reinterpret_cast<const char*>(&value), sizeof(T));
+    }
+
+    void encode() {
+        PageBuilderOptions options;
+        options.data_page_size = 64 * 1024;
+        PageBuilder* builder_ptr = nullptr;
+        CHECK(_encoding_info->create_page_builder(options, &builder_ptr).ok());
+        std::unique_ptr<PageBuilder> builder(builder_ptr);
+
+        const auto* data = _slices.empty() ? reinterpret_cast<const uint8_t*>(_values.data())
+                                           : reinterpret_cast<const uint8_t*>(_slices.data());
+        size_t value_size = _slices.empty() ? _values.size() / _rows_number : sizeof(Slice);
+        _pages.clear();
+        _page_sizes.clear();
+        _compressed_pages.clear();
+        size_t num_added = 0;
+        while (num_added < _rows_number) {
+            size_t n = _rows_number - num_added;
+            CHECK(builder->add(data + num_added * value_size, &n).ok());
+            num_added += n;
+            if (builder->is_page_full() || num_added == _rows_number) {
+                _pages.push_back(builder->finish());
+                _page_sizes.push_back(_pages.back().slice().size);
+                builder->reset();
+            }
+        }
+        if (_codec != nullptr) {
+            _compressed_pages.resize(_pages.size());
+            for (size_t i = 0; i < _pages.size(); ++i) {
+                CHECK(_codec->compress(_pages[i].slice(), &_compressed_pages[i]).ok());
+            }
+        }
+    }
+
+    vectorized::MutableColumnPtr create_column() {
+        switch (_type) {
+        case FieldType::OLAP_FIELD_TYPE_INT:
+            return vectorized::ColumnInt32::create();
+        case FieldType::OLAP_FIELD_TYPE_BIGINT:
+            return vectorized::ColumnInt64::create();
+        case FieldType::OLAP_FIELD_TYPE_DOUBLE:
+            return vectorized::ColumnFloat64::create();
+        default:
+            return vectorized::ColumnString::create();
+        }
+    }
+
+    int _rows_number;
+    FieldType _type;
+    bool _decode;
+    const EncodingInfo* _encoding_info = nullptr;
+    BlockCompressionCodec* _codec = nullptr;
+    std::string _values;
+    std::vector<std::string> _strings;
+    std::vector<Slice> _slices;
+    std::vector<OwnedSlice> _pages;
+    std::vector<size_t> _page_sizes;
+    std::vector<faststring> _compressed_pages;
+};
+
+// Scans a segment of (k1 INT, k2 VARCHAR, v1 INT with bloom filter) written by SegmentWriter
+// with a compression, k1 is sequential and v1 is k1 % 1000. The predicate in the name is pushed
+// down as a column predicate:
+//   none: reads all rows
+//   range: k1 < rows / 10, most pages are pruned by the zone map
+//   equal: v1 = 42, pages are pruned by the bloom filter and the rows by the predicate
+class SegmentScanBenchmark : public BaseBenchmark {
+public:
+    SegmentScanBenchmark(int iterations, int rows_number, CompressionTypePB compression,
+                         const std::string& predicate, bool use_page_cache)
+            : BaseBenchmark(fmt::format("SegmentScan/{}/predicate:{}/page_cache:{}/"
+                                        "rows_number:{}",
+                                        CompressionTypePB_Name(compression), predicate,
+                                        use_page_cache, rows_number),
+                            iterations),
+              _rows_number(rows_number),
+              _compression(compression),
+              _predicate_name(predicate),
+              _use_page_cache(use_page_cache) {}
+
+    void init() override {
+        if (_segment != nullptr) {
+            return;
+        }
+        _schema = std::make_shared<TabletSchema>();
+        _schema->append_column(create_int_key(0, false));
+        _schema->append_column(create_varchar_key(1, false));
+        _schema->append_column(create_int_value(
+                2, FieldAggregationMethod::OLAP_FIELD_AGGREGATION_NONE, false, "", true));
+        _schema->_keys_type = DUP_KEYS;
+        _schema->_num_short_key_columns = 1;
+        _schema->_compression_type = _compression;
+
+        auto block = _schema->create_block();
+        auto columns = block.mutate_columns();
+        for (int i = 0; i < _rows_number; ++i) {
+            int32_t k1 = i;
+            int32_t v1 = i % 1000;
+            std::string k2 = fmt::format("name_{}", i % 100);
+            columns[0]->insert_data(reinterpret_cast<const char*>(&k1), sizeof(k1));
+            columns[1]->insert_data(k2.data(), k2.size());
+            columns[2]->insert_data(reinterpret_cast<const char*>(&v1), sizeof(v1));
+        }
+        block.set_columns(std::move(columns));
+
+        auto fs = io::global_local_filesystem();
+        CHECK(fs->create_directory(kSegmentDir).ok());
+        std::string path = fmt::format("{}/{}_{}_{}_{}.dat", kSegmentDir,
+                                       CompressionTypePB_Name(_compression), _predicate_name,
+                                       _use_page_cache, _rows_number);
+        io::FileWriterPtr file_writer;
+        CHECK(fs->create_file(path, &file_writer).ok());
+        SegmentWriter writer(file_writer.get(), 0, _schema, nullptr, nullptr, INT32_MAX,
+                             SegmentWriterOptions(), nullptr);
+        CHECK(writer.init().ok());
+        CHECK(writer.append_block(&block, 0, block.rows()).ok());
+        uint64_t file_size = 0;
+        uint64_t index_size = 0;
+        CHECK(writer.finalize(&file_size, &index_size).ok());
+        CHECK(file_writer->close().ok());
+        _file_size = file_size;
+
+        io::FileReaderOptions reader_options(io::FileCachePolicy::NO_CACHE,
+                                             io::SegmentCachePathPolicy());
+        CHECK(Segment::open(fs, path, 0, RowsetId(), _schema, reader_options, &_segment).ok());
+
+        if (_predicate_name == "range") {
+            _predicate.reset(new ComparisonPredicateBase<TYPE_INT, PredicateType::LT>(
+                    0, _rows_number / 10));
+        } else if (_predicate_name == "equal") {
+            _predicate.reset(new ComparisonPredicateBase<TYPE_INT, PredicateType::EQ>(2, 42));
+        }
+    }
+
+    void run() override {
+        OlapReaderStatistics stats;
+        StorageReadOptions opts;
+        opts.stats = &stats;
+        opts.tablet_schema = _schema;
+        opts.use_page_cache = _use_page_cache;
+        if (_predicate != nullptr) {
+            opts.column_predicates.push_back(_predicate.get());
+        }
+        std::unique_ptr<RowwiseIterator> iter;
+        CHECK(_segment->new_iterator(std::make_shared<Schema>(_schema), opts, &iter).ok());
+        auto block = _schema->create_block();
+        _rows_read = 0;
+        while (true) {
+            auto st = iter->next_batch(&block);
+            if (st.is<ErrorCode::END_OF_FILE>()) {
+                break;
+            }
+            CHECK(st.ok()) << st;
+            _rows_read += block.rows();
+            block.clear_column_data();
+        }
+        _pages_read = stats.total_pages_num;
+    }
+
+    void add_counters(benchmark::State& state) override {
+        state.counters["file_bytes"] = _file_size;
+        state.counters["rows_read"] = _rows_read;
+        state.counters["pages_read"] = _pages_read;
+    }
+
+private:
+    int _rows_number;
+    CompressionTypePB _compression;
+    std::string _predicate_name;
+    bool _use_page_cache;
+    TabletSchemaSPtr _schema;
+    SegmentSharedPtr _segment;
+    std::unique_ptr<ColumnPredicate> _predicate;
+    size_t _file_size = 0;
+    size_t _rows_read = 0;
+    size_t _pages_read = 0;
+};
+
+// Builds a hash table of UInt64 keys then probes it, half of the probe keys are missing from
+// the table, see make_keys for the distributions of the keys.
+template <typename HashTable>
+class HashTableBenchmark : public BaseBenchmark {
+public:
+    HashTableBenchmark(const std::string& name, int iterations, int rows_number,
+                       const std::string& distribution)
+            : BaseBenchmark(name + "/" + distribution + "/rows_number:" +
+                                    std::to_string(rows_number),
+                            iterations),
+              _rows_number(rows_number),
+              _distribution(distribution) {}
+
+    void init() override {
+        if (!_build_keys.empty()) {
+            return;
+        }
+        std::mt19937 rng(0);
+        _build_keys = make_keys(_distribution, _rows_number, &rng);
+        _probe_keys.resize(_rows_number);
+        for (int i = 0; i < _rows_number; ++i) {
+            // the odd probes miss the table, no build key is larger than rows
+            _probe_keys[i] = i % 2 ? _rows_number + rng() % _rows_number
+                                   : _build_keys[rng() % _rows_number];
+        }
+    }
+
+    void run() override {
+        HashTable hash_table;
+        for (auto key : _build_keys) {
+            typename HashTable::LookupResult it;
+            bool inserted;
+            hash_table.emplace(key, it, inserted, hash_table.hash(key));
+            if (inserted) {
+                new (lookup_result_get_mapped(it)) uint64_t(0);
+            }
+            ++*lookup_result_get_mapped(it);
+        }
+        uint64_t matched = 0;
+        for (auto key : _probe_keys) {
+            auto it = hash_table.find(key, hash_table.hash(key));
+            if (it != nullptr) {
+                matched += *lookup_result_get_mapped(it);
+            }
+        }
+        benchmark::DoNotOptimize(matched);
+    }
+
+private:
+    int _rows_number;
+    std::string _distribution;
+    std::vector<uint64_t> _build_keys;
+    std::vector<uint64_t> _probe_keys;
+};
+
+// count(*) grouped by a number key, with the hash table of the key variant the aggregation node
+// picks for the key type, see AggregatedDataVariants.
+template <typename HashTable>
+class AggregationBenchmark : public BaseBenchmark {
+public:
+    using Key = typename HashTable::key_type;
+
+    AggregationBenchmark(const std::string& name, int iterations, int rows_number,
+                         const std::string& distribution)
+            : BaseBenchmark("Aggregation/" + name + "/" + distribution +
+                                    "/rows_number:" + std::to_string(rows_number),
+                            iterations),
+              _rows_number(rows_number),
+              _distribution(distribution) {}
+
+    void init() override {
+        if (!_keys.empty()) {
+            return;
+        }
+        std::mt19937 rng(0);
+        for (auto key : make_keys(_distribution, _rows_number, &rng)) {
+            _keys.push_back(static_cast<Key>(key));
+        }
+    }
+
+    void run() override {
+        HashTable hash_table;
+        vectorized::Arena arena;
+        for (auto key : _keys) {
+            typename HashTable::LookupResult it;
+            bool inserted;
+            hash_table.emplace(key, it, inserted, hash_table.hash(key));
+            if (inserted) {
+                auto* place = arena.alloc(sizeof(uint64_t));
+                *reinterpret_cast<uint64_t*>(place) = 0;
+                *lookup_result_get_mapped(it) = place;
+            }
+            ++*reinterpret_cast<uint64_t*>(*lookup_result_get_mapped(it));
+        }
+        benchmark::DoNotOptimize(hash_table.size());
+    }
+
+private:
+    int _rows_number;
+    std::string _distribution;
+    std::vector<Key> _keys;
+};
+
+// Sorts a block of an Int64 column and a String column, by the Int64 column or by both columns,
+// with the kernel of FullSorter (limit 0) or of TopNSorter (a small limit).
+class SortBenchmark : public BaseBenchmark {
+public:
+    SortBenchmark(int iterations, int rows_number, const std::string& distribution,
+                  size_t num_sort_columns, uint64_t limit)
+            : BaseBenchmark(fmt::format("Sort/{}/sort_columns:{}/limit:{}/rows_number:{}",
+                                        distribution, num_sort_columns, limit, rows_number),
+                            iterations),
+              _rows_number(rows_number),
+              _distribution(distribution),
+              _limit(limit) {
+        for (size_t i = 0; i < num_sort_columns; ++i) {
+            _description.emplace_back(i, 1, 1);
+        }
+    }
+
+    void init() override {
+        if (_block.rows() > 0) {
+            return;
+        }
+        std::mt19937 rng(0);
+        auto numbers = vectorized::ColumnInt64::create();
+        auto strings = vectorized::ColumnString::create();
+        for (auto key : make_keys(_distribution, _rows_number, &rng)) {
+            numbers->insert_value(key % 1024);
+            std::string str = fmt::format("value_{}", key);
+            strings->insert_data(str.data(), str.size());
+        }
+        _block.insert({std::move(numbers), std::make_shared<vectorized::DataTypeInt64>(), "k1"});
+        _block.insert({std::move(strings), std::make_shared<vectorized::DataTypeString>(), "k2"});
+    }
+
+    void run() override {
+        auto sorted = _block.clone_empty();
+        vectorized::sort_block(_block, sorted, _description, _limit);
+        benchmark::DoNotOptimize(sorted.rows());
+    }
+
+private:
+    int _rows_number;
+    std::string _distribution;
+    uint64_t _limit;
+    vectorized::SortDescription _description;
+    vectorized::Block _block;
+};
+
+// The kernels of ColumnString on the hot paths of the operators:
+//   filter: the conjuncts of scan and join, half of the rows are selected at random
+//   hash: xxhash of the rows, as the hash partitioned exchange does
+//   crc: crc32 of the rows, as the bucket shuffle exchange does
+class ColumnStringBenchmark : public BaseBenchmark {
+public:
+    ColumnStringBenchmark(int iterations, int rows_number, const std::string& kernel)
+            : BaseBenchmark("ColumnString/" + kernel + "/rows_number:" +
+                                    std::to_string(rows_number),
+                            iterations),
+              _rows_number(rows_number),
+              _kernel(kernel) {}
+
+    void init() override {
+        if (_column != nullptr) {
+            return;
+        }
+        std::mt19937 rng(0);
+        auto column = vectorized::ColumnString::create();
+        _filter.resize(_rows_number);
+        for (int i = 0; i < _rows_number; ++i) {
+            std::string str = rand_rng_string(rand_rng_int(1, 32));
+            column->insert_data(str.data(), str.size());
+            _filter[i] = rng() % 2;
+        }
+        _column = std::move(column);
+        _hashes.resize(_rows_number);
+    }
+
+    void run() override {
+        if (_kernel == "filter") {
+            benchmark::DoNotOptimize(_column->filter(_filter, -1));
+        } else if (_kernel == "hash") {
+            std::fill(_hashes.begin(), _hashes.end(), 0);
+            _column->update_hashes_with_value(_hashes.data(), nullptr);
+            benchmark::DoNotOptimize(_hashes.data());
+        } else {
+            std::fill(_hashes.begin(), _hashes.end(), 0);
+            _column->update_crcs_with_value(_hashes, TYPE_STRING, nullptr);
+            benchmark::DoNotOptimize(_hashes.data());
+        }
+    }
+
+private:
+    int _rows_number;
+    std::string _kernel;
+    vectorized::ColumnPtr _column;
+    vectorized::IColumn::Filter _filter;
+    std::vector<uint64_t> _hashes;
+};
+
+// Executes a string function on a column of strings like "key_1,value_1,tail" with the
+// other arguments constant, which is the most common usage in queries.
+class StringFunctionBenchmark : public BaseBenchmark {
+public:
+    StringFunctionBenchmark(const std::string& name, int iterations, int rows_number,
+                            vectorized::ColumnsWithTypeAndName const_arguments,
+                            vectorized::DataTypePtr return_type)
+            : BaseBenchmark("StringFunction/" + name + "/rows_number:" +
+                                    std::to_string(rows_number),
+                            iterations),
+              _function_name(name),
+              _rows_number(rows_number),
+              _const_arguments(std::move(const_arguments)),
+              _return_type(std::move(return_type)) {}
+
+    void init() override {
+        if (_function != nullptr) {
+            return;
+        }
+        auto column = vectorized::ColumnString::create();
+        for (int i = 0; i < _rows_number; ++i) {
+            std::string str = fmt::format("key_{},value_{},tail", i, i * 7);
+            column->insert_data(str.data(), str.size());
+        }
+        _arguments.push_back({std::move(column), std::make_shared<vectorized::DataTypeString>(),
+                              "str"});
+        for (auto& argument : _const_arguments) {
+            argument.column = vectorized::ColumnConst::create(argument.column, _rows_number);
+            _arguments.push_back(argument);
+        }
+        _function = vectorized::SimpleFunctionFactory::instance().get_function(
+                _function_name, _arguments, _return_type);
+        CHECK(_function != nullptr) << _function_name;
+    }
+
+    void run() override {
+        vectorized::Block block(_arguments);
+        vectorized::ColumnNumbers arguments(_arguments.size());
+        std::iota(arguments.begin(), arguments.end(), 0);
+        block.insert({nullptr, _return_type, "result"});
+        CHECK(_function->execute(nullptr, block, arguments, _arguments.size(), _rows_number).ok());
+        benchmark::DoNotOptimize(block.get_by_position(_arguments.size()).column);
+    }
+
+private:
+    std::string _function_name;
+    int _rows_number;
+    vectorized::ColumnsWithTypeAndName _const_arguments;
+    vectorized::DataTypePtr _return_type;
+    vectorized::ColumnsWithTypeAndName _arguments;
+    vectorized::FunctionBasePtr _function;
+};
+
 // This is sample custom test. User can write custom test code at custom_init()&custom_run().
 // Call method: ./benchmark_tool --operation=Custom
 class CustomBenchmark : public BaseBenchmark {
@@ -286,10 +870,132 @@ public:
         } else if (equal_ignore_case(FLAGS_operation, "BinaryDictPageDecode")) {
             benchmarks.emplace_back(new doris::BinaryDictPageDecodeBenchmark(
                     FLAGS_operation, std::stoi(FLAGS_iterations), std::stoi(FLAGS_rows_number)));
+        } else if (equal_ignore_case(FLAGS_operation, "PageEncoding")) {
+            add_page_encoding_bm();
+        } else if (equal_ignore_case(FLAGS_operation, "SegmentScan")) {
+            for (auto compression : {segment_v2::NO_COMPRESSION, segment_v2::LZ4F,
+                                     segment_v2::ZSTD}) {
+                for (const std::string predicate : {"none", "range", "equal"}) {
+                    for (bool use_page_cache : {false, true}) {
+                        benchmarks.emplace_back(new doris::SegmentScanBenchmark(
+                                std::stoi(FLAGS_iterations), std::stoi(FLAGS_rows_number),
+                                compression, predicate, use_page_cache));
+                    }
+                }
+            }
+        } else if (equal_ignore_case(FLAGS_operation, "HashTable")) {
+            using LinearProbingHashTable =
+                    PartitionedHashMap<uint64_t, uint64_t, HashCRC32<uint64_t>>;
+            using SwissHashTable =
+                    PHPartitionedHashMap<uint64_t, uint64_t, HashCRC32<uint64_t>>;
+            for (const std::string distribution : {"sequential", "uniform", "zipf"}) {
+                benchmarks.emplace_back(new doris::HashTableBenchmark<LinearProbingHashTable>(
+                        "HashTable/linear_probing", std::stoi(FLAGS_iterations),
+                        std::stoi(FLAGS_rows_number), distribution));
+                benchmarks.emplace_back(new doris::HashTableBenchmark<SwissHashTable>(
+                        "HashTable/swiss", std::stoi(FLAGS_iterations),
+                        std::stoi(FLAGS_rows_number), distribution));
+            }
+        } else if (equal_ignore_case(FLAGS_operation, "Aggregation")) {
+            add_aggregation_bm();
+        } else if (equal_ignore_case(FLAGS_operation, "Sort")) {
+            for (const std::string distribution : {"uniform", "zipf"}) {
+                for (size_t num_sort_columns : {1, 2}) {
+                    for (uint64_t limit : {0, 100}) {
+                        benchmarks.emplace_back(new doris::SortBenchmark(
+                                std::stoi(FLAGS_iterations), std::stoi(FLAGS_rows_number),
+                                distribution, num_sort_columns, limit));
+                    }
+                }
+            }
+        } else if (equal_ignore_case(FLAGS_operation, "ColumnString")) {
+            for (const std::string kernel : {"filter", "hash", "crc"}) {
+                benchmarks.emplace_back(new doris::ColumnStringBenchmark(
+                        std::stoi(FLAGS_iterations), std::stoi(FLAGS_rows_number), kernel));
+            }
+        } else if (equal_ignore_case(FLAGS_operation, "StringFunction")) {
+            add_string_function_bm();
         } else {
             std::cout << "operation invalid!" << std::endl;
         }
     }
+    void add_page_encoding_bm() {
+        using namespace segment_v2;
+        // the encodings of the types, see EncodingInfoResolver, the dictionary pages of
+        // DICT_ENCODING are not decoded by the benchmark so it is only encoded
+        std::vector<std::pair<FieldType, std::vector<EncodingTypePB>>> type_encodings = {
+                {FieldType::OLAP_FIELD_TYPE_INT,
+                 {PLAIN_ENCODING, BIT_SHUFFLE, FOR_ENCODING, DELTA_OF_DELTA_ENCODING}},
+                {FieldType::OLAP_FIELD_TYPE_BIGINT,
+                 {PLAIN_ENCODING, BIT_SHUFFLE, FOR_ENCODING, DELTA_OF_DELTA_ENCODING}},
+                {FieldType::OLAP_FIELD_TYPE_DOUBLE, {PLAIN_ENCODING, BIT_SHUFFLE, ALP_ENCODING}},
+                {FieldType::OLAP_FIELD_TYPE_VARCHAR,
+                 {PLAIN_ENCODING, PREFIX_ENCODING, DICT_ENCODING}}};
+        int iterations = std::stoi(FLAGS_iterations);
+        int rows_number = std::stoi(FLAGS_rows_number);
+        for (const auto& [type, encodings] : type_encodings) {
+            for (auto encoding : encodings) {
+                for (auto compression : {NO_COMPRESSION, LZ4F, SNAPPY, ZSTD}) {
+                    for (bool decode : {false, true}) {
+                        if (decode && encoding == DICT_ENCODING) {
+                            continue;
+                        }
+                        benchmarks.emplace_back(new PageEncodingBenchmark(
+                                iterations, rows_number, type, encoding, compression, decode));
+                    }
+                }
+            }
+        }
+    }
+
+    void add_aggregation_bm() {
+        using namespace vectorized;
+        int iterations = std::stoi(FLAGS_iterations);
+        int rows_number = std::stoi(FLAGS_rows_number);
+        for (const std::string distribution : {"uniform", "zipf"}) {
+            benchmarks.emplace_back(new AggregationBenchmark<AggregatedDataWithUInt32Key>(
+                    "int32_key", iterations, rows_number, distribution));
+            benchmarks.emplace_back(new AggregationBenchmark<AggregatedDataWithUInt64Key>(
+                    "int64_key", iterations, rows_number, distribution));
+            benchmarks.emplace_back(new AggregationBenchmark<AggregatedDataWithUInt32KeyPhase2>(
+                    "int32_key_phase2", iterations, rows_number, distribution));
+            benchmarks.emplace_back(new AggregationBenchmark<AggregatedDataWithUInt64KeyPhase2>(
+                    "int64_key_phase2", iterations, rows_number, distribution));
+        }
+    }
+
+    void add_string_function_bm() {
+        using namespace vectorized;
+        auto string_arg = [](const std::string& str) {
+            auto column = ColumnString::create();
+            column->insert_data(str.data(), str.size());
+            return ColumnWithTypeAndName {std::move(column), std::make_shared<DataTypeString>(),
+                                          str};
+        };
+        auto int_arg = [](int32_t value) {
+            auto column = ColumnInt32::create();
+            column->insert_value(value);
+            return ColumnWithTypeAndName {std::move(column), std::make_shared<DataTypeInt32>(),
+                                          std::to_string(value)};
+        };
+        auto string_type = std::make_shared<DataTypeString>();
+        auto nullable_string_type = make_nullable(string_type);
+        int iterations = std::stoi(FLAGS_iterations);
+        int rows_number = std::stoi(FLAGS_rows_number);
+        benchmarks.emplace_back(new StringFunctionBenchmark(
+                "concat", iterations, rows_number, {string_arg("_"), string_arg("suffix")},
+                string_type));
+        benchmarks.emplace_back(new StringFunctionBenchmark(
+                "replace", iterations, rows_number, {string_arg(","), string_arg(";")},
+                string_type));
+        benchmarks.emplace_back(new StringFunctionBenchmark(
+                "split_part", iterations, rows_number, {string_arg(","), int_arg(2)},
+                nullable_string_type));
+        benchmarks.emplace_back(new StringFunctionBenchmark(
+                "substring", iterations, rows_number, {int_arg(5), int_arg(8)},
+                nullable_string_type));
+    }
+
     void register_bm() {
         for (auto bm : benchmarks) {
             bm->register_bm();
@@ -304,6 +1010,9 @@ private:
 int main(int argc, char** argv) {
     std::string usage = get_usage(argv[0]);
     gflags::SetUsageMessage(usage);
+    // takes the --benchmark_* flags, e.g. --benchmark_format=json, out of argv before gflags
+    // which rejects the unknown flags
+    benchmark::Initialize(&argc, argv);
     google::ParseCommandLineFlags(&argc, &argv, true);
 
     doris::StoragePageCache::create_global_cache(1 << 30, 10, 0);
@@ -312,7 +1021,6 @@ int main(int argc, char** argv) {
     multi_bm.add_bm();
     multi_bm.register_bm();
 
-    benchmark::Initialize(&argc, argv);
     benchmark::RunSpecifiedBenchmarks();
     benchmark::Shutdown();
 
@@ -22,7 +22,9 @@
 #include <gtest/gtest-test-part.h>
 #include <stdlib.h>
 
+#include <memory>
 #include <string>
+#include <vector>
 
 #include "gtest/gtest_pred_impl.h"
 #include "util/faststring.h"
@@ -146,4 +148,42 @@ TEST_F(BlockCompressionTest, multi) {
     test_multi_slices(segment_v2::CompressionTypePB::ZSTD);
 }
 
+TEST_F(BlockCompressionTest, zstd_dict) {
+    std::vector<std::string> values;
+    for (int i = 0; i < 2000; ++i) {
+        values.push_back("{\"user_id\": " + std::to_string(i) + ", \"name\": \"user_" +
+                         generate_str(8) + "\", \"status\": \"active\"}");
+    }
+    std::vector<Slice> samples(values.begin(), values.end());
+    std::string dict;
+    ASSERT_TRUE(train_zstd_dict(samples, 4096, &dict).ok());
+    ASSERT_FALSE(dict.empty());
+    EXPECT_LE(dict.size(), 4096);
+
+    std::unique_ptr<BlockCompressionCodec> dict_codec;
+    ASSERT_TRUE(create_zstd_dict_codec(dict, &dict_codec).ok());
+    BlockCompressionCodec* codec;
+    ASSERT_TRUE(get_block_compression_codec(segment_v2::CompressionTypePB::ZSTD, &codec).ok());
+
+    const std::string& orig = values[0];
+    faststring compressed;
+    ASSERT_TRUE(dict_codec->compress(orig, &compressed).ok());
+    faststring compressed_without_dict;
+    ASSERT_TRUE(codec->compress(orig, &compressed_without_dict).ok());
+    EXPECT_LT(compressed.size(), compressed_without_dict.size());
+
+    std::string uncompressed;
+    uncompressed.resize(orig.size());
+    Slice uncompressed_slice(uncompressed);
+    ASSERT_TRUE(dict_codec->decompress(Slice(compressed), &uncompressed_slice).ok());
+    EXPECT_EQ(orig, uncompressed);
+    // the pages compressed with the dictionary can not be decompressed without it
+    uncompressed_slice = Slice(uncompressed);
+    EXPECT_FALSE(codec->decompress(Slice(compressed), &uncompressed_slice).ok());
+
+    // too few samples to train a dictionary
+    ASSERT_TRUE(train_zstd_dict({Slice(orig)}, 4096, &dict).ok());
+    EXPECT_TRUE(dict.empty());
+}
+
 } // namespace doris
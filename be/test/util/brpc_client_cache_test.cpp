@@ -21,6 +21,7 @@
 #include <gtest/gtest-message.h>
 #include <gtest/gtest-test-part.h>
 
+#include "common/config.h"
 #include "gtest/gtest_pred_impl.h"
 
 namespace doris {
@@ -47,6 +48,31 @@ TEST_F(BrpcClientCacheTest, normal) {
     EXPECT_EQ(stub1, stub3);
 }
 
+TEST_F(BrpcClientCacheTest, channels_per_host) {
+    int32_t num_channels = config::brpc_num_channels_per_host;
+    config::brpc_num_channels_per_host = 2;
+    BrpcClientCache<PBackendService_Stub> cache;
+    TNetworkAddress address;
+    address.hostname = "127.0.0.1";
+    address.port = 123;
+    auto stub1 = cache.get_client(address);
+    EXPECT_NE(nullptr, stub1);
+    // the channel held by fewer users is given out
+    auto stub2 = cache.get_client(address);
+    EXPECT_NE(nullptr, stub2);
+    EXPECT_NE(stub1, stub2);
+    auto stub3 = cache.get_client(address);
+    EXPECT_TRUE(stub3 == stub1 || stub3 == stub2);
+    EXPECT_EQ(1, cache.size());
+
+    auto control_stub = cache.get_control_client(address);
+    EXPECT_NE(nullptr, control_stub);
+    EXPECT_NE(stub1, control_stub);
+    EXPECT_NE(stub2, control_stub);
+    EXPECT_EQ(control_stub, cache.get_control_client(address));
+    config::brpc_num_channels_per_host = num_channels;
+}
+
 TEST_F(BrpcClientCacheTest, invalid) {
     BrpcClientCache<PBackendService_Stub> cache;
     TNetworkAddress address;
@@ -0,0 +1,121 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+
+#include "util/ddsketch.h"
+
+#include <gtest/gtest-message.h>
+#include <gtest/gtest-test-part.h>
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "gtest/gtest_pred_impl.h"
+#include "util/slice.h"
+
+namespace doris {
+
+static std::vector<double> random_values(size_t count) {
+    std::mt19937_64 rng(0);
+    std::lognormal_distribution<double> distribution(0, 2);
+    std::vector<double> values;
+    for (size_t i = 0; i < count; ++i) {
+        double value = distribution(rng);
+        values.push_back(i % 10 == 0 ? -value : (i % 97 == 0 ? 0 : value));
+    }
+    return values;
+}
+
+TEST(DDSketchTest, quantile) {
+    DDSketch empty;
+    EXPECT_TRUE(std::isnan(empty.quantile(0.5)));
+
+    auto values = random_values(100000);
+    DDSketch sketch;
+    sketch.add_batch(values.data(), values.size());
+    EXPECT_EQ(values.size(), sketch.count());
+    EXPECT_TRUE(std::isnan(sketch.quantile(1.5)));
+
+    std::sort(values.begin(), values.end());
+    for (double quantile : {0.0, 0.01, 0.1, 0.5, 0.9, 0.99, 1.0}) {
+        double exact = values[(size_t)(quantile * (values.size() - 1))];
+        double estimated = sketch.quantile(quantile);
+        EXPECT_LE(std::abs(estimated - exact), std::abs(exact) * sketch.relative_accuracy())
+                << "quantile=" << quantile;
+    }
+}
+
+TEST(DDSketchTest, deterministic_merge) {
+    auto values = random_values(30000);
+    DDSketch all;
+    all.add_batch(values.data(), values.size());
+    std::vector<DDSketch> parts(3);
+    for (size_t i = 0; i < values.size(); ++i) {
+        parts[i % 3].add(values[i]);
+    }
+
+    DDSketch merged1;
+    merged1.merge(parts[0]);
+    merged1.merge(parts[1]);
+    merged1.merge(parts[2]);
+    DDSketch merged2 = parts[2];
+    merged2.merge(parts[0]);
+    merged2.merge(parts[1]);
+
+    std::string expected;
+    all.serialize(&expected);
+    std::string buf1;
+    merged1.serialize(&buf1);
+    std::string buf2;
+    merged2.serialize(&buf2);
+    EXPECT_EQ(expected, buf1);
+    EXPECT_EQ(expected, buf2);
+}
+
+TEST(DDSketchTest, collapse) {
+    // values across much more buckets than kept
+    DDSketch sketch;
+    for (int i = 0; i < 10000; ++i) {
+        sketch.add(std::pow(1.5, i % 400 - 200));
+    }
+    EXPECT_EQ(10000, sketch.count());
+    double max_value = std::pow(1.5, 199);
+    EXPECT_LE(std::abs(sketch.quantile(1) - max_value), max_value * sketch.relative_accuracy());
+}
+
+TEST(DDSketchTest, serialize) {
+    auto values = random_values(1000);
+    DDSketch sketch(0.02);
+    sketch.add_batch(values.data(), values.size());
+    std::string buf;
+    sketch.serialize(&buf);
+
+    DDSketch other;
+    EXPECT_TRUE(other.deserialize(Slice(buf)));
+    EXPECT_EQ(0.02, other.relative_accuracy());
+    EXPECT_EQ(sketch.count(), other.count());
+    EXPECT_EQ(sketch.quantile(0.5), other.quantile(0.5));
+
+    EXPECT_FALSE(other.deserialize(Slice(buf.data(), buf.size() - 1)));
+    EXPECT_FALSE(other.deserialize(Slice(buf.data(), 3)));
+    EXPECT_EQ(0, other.count());
+}
+
+} // namespace doris
@@ -0,0 +1,101 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "util/mpmc_queue.h"
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <thread>
+#include <vector>
+
+namespace doris {
+
+TEST(MpmcQueueTest, TestBounded) {
+    BoundedMpmcQueue<std::unique_ptr<int>> queue(3);
+    EXPECT_EQ(4, queue.capacity());
+    for (int i = 0; i < 4; ++i) {
+        EXPECT_TRUE(queue.try_push(std::make_unique<int>(i)));
+    }
+    auto value = std::make_unique<int>(4);
+    EXPECT_FALSE(queue.try_push(std::move(value)));
+    // not moved when the queue is full
+    ASSERT_NE(nullptr, value);
+    EXPECT_EQ(4, queue.size_approx());
+
+    std::unique_ptr<int> out;
+    for (int i = 0; i < 4; ++i) {
+        EXPECT_TRUE(queue.try_pop(&out));
+        EXPECT_EQ(i, *out);
+    }
+    EXPECT_FALSE(queue.try_pop(&out));
+    EXPECT_TRUE(queue.empty());
+}
+
+TEST(MpmcQueueTest, TestOverflow) {
+    MpmcQueue<int> queue(2);
+    for (int i = 0; i < 10; ++i) {
+        queue.push(i);
+    }
+    EXPECT_EQ(10, queue.size_approx());
+    int out = -1;
+    for (int i = 0; i < 5; ++i) {
+        EXPECT_TRUE(queue.try_pop(&out));
+        EXPECT_EQ(i, out);
+    }
+    // still in order after the ring buffer has space again
+    for (int i = 10; i < 15; ++i) {
+        queue.push(i);
+    }
+    for (int i = 5; i < 15; ++i) {
+        EXPECT_TRUE(queue.try_pop(&out));
+        EXPECT_EQ(i, out);
+    }
+    EXPECT_FALSE(queue.try_pop(&out));
+}
+
+TEST(MpmcQueueTest, TestMultiThreads) {
+    const int num_producers = 4;
+    const int num_values = 100000;
+    MpmcQueue<int> queue(64);
+    std::vector<std::thread> producers;
+    for (int p = 0; p < num_producers; ++p) {
+        producers.emplace_back([&queue, p] {
+            for (int i = 0; i < num_values; ++i) {
+                queue.push(p * num_values + i);
+            }
+        });
+    }
+    // the values of every producer are popped in order
+    std::vector<int> last(num_producers, -1);
+    int num_popped = 0;
+    while (num_popped < num_producers * num_values) {
+        int out = 0;
+        if (queue.try_pop(&out)) {
+            int p = out / num_values;
+            EXPECT_LT(last[p], out % num_values);
+            last[p] = out % num_values;
+            ++num_popped;
+        }
+    }
+    for (auto& producer : producers) {
+        producer.join();
+    }
+    EXPECT_TRUE(queue.empty());
+}
+
+} // namespace doris
@@ -0,0 +1,47 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "util/simd/bits.h"
+
+#include <gtest/gtest-message.h>
+#include <gtest/gtest-test-part.h>
+
+#include <string>
+
+#include "gtest/gtest_pred_impl.h"
+
+namespace doris {
+
+TEST(SimdBitsTest, Bytes64EqualMask) {
+    std::string data(64, 'a');
+    EXPECT_EQ(simd::bytes64_equal_mask(data.data(), ','), 0);
+    EXPECT_EQ(simd::bytes64_equal_mask(data.data(), 'a'), ~0ULL);
+
+    data[0] = ',';
+    data[15] = ',';
+    data[16] = ',';
+    data[33] = ',';
+    data[63] = ',';
+    uint64_t expected = (1ULL << 0) | (1ULL << 15) | (1ULL << 16) | (1ULL << 33) | (1ULL << 63);
+    EXPECT_EQ(simd::bytes64_equal_mask(data.data(), ','), expected);
+
+    // bytes with the highest bit set
+    data[40] = '\xe4';
+    EXPECT_EQ(simd::bytes64_equal_mask(data.data(), '\xe4'), 1ULL << 40);
+}
+
+} // namespace doris
@@ -193,6 +193,18 @@ TEST(StringToInt, Basic) {
     test_int_value<int64_t>("-0", 0, StringParser::PARSE_SUCCESS);
 }
 
+TEST(StringToInt, EightDigits) {
+    // the digits are parsed 8 at a time, the chunks around a non digit must still be checked
+    test_int_value<int32_t>("123456789", 123456789, StringParser::PARSE_SUCCESS);
+    test_int_value<int32_t>("1234567x9", 0, StringParser::PARSE_FAILURE);
+    test_int_value<int32_t>("12345678 ", 12345678, StringParser::PARSE_SUCCESS);
+    test_int_value<int64_t>("-123456789012345678", -123456789012345678,
+                            StringParser::PARSE_SUCCESS);
+    test_int_value<int64_t>("12345678901234567:", 0, StringParser::PARSE_FAILURE);
+    test_int_value<int64_t>("10000000000000000  ", 10000000000000000,
+                            StringParser::PARSE_SUCCESS);
+}
+
 TEST(StringToInt, InvalidLeadingTrailing) {
     // Test that trailing garbage is not allowed.
     test_int_value<int8_t>("123xyz   ", 0, StringParser::PARSE_FAILURE);
@@ -0,0 +1,71 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+
+#include "util/timezone_transitions.h"
+
+#include <cctz/civil_time.h>
+#include <cctz/time_zone.h>
+#include <gtest/gtest-message.h>
+#include <gtest/gtest-test-part.h>
+
+#include <chrono>
+#include <string>
+
+#include "gtest/gtest_pred_impl.h"
+#include "util/timezone_utils.h"
+
+namespace doris {
+
+// the offsets must be the same as cctz for every tabulated second
+static void check_same_as_cctz(const std::string& name) {
+    cctz::time_zone ctz;
+    ASSERT_TRUE(TimezoneUtils::find_cctz_time_zone(name, ctz));
+    TimezoneTransitions transitions;
+    ASSERT_TRUE(transitions.init(ctz));
+
+    static const auto epoch = std::chrono::time_point_cast<cctz::sys_seconds>(
+            std::chrono::system_clock::from_time_t(0));
+    static const cctz::civil_second civil_epoch(1970, 1, 1, 0, 0, 0);
+    // an odd step to hit the seconds around the transitions
+    for (int64_t seconds = TimezoneTransitions::MIN_SECONDS;
+         seconds < TimezoneTransitions::MAX_SECONDS; seconds += 10799) {
+        int32_t offset = 0;
+        ASSERT_TRUE(transitions.utc_offset(seconds, &offset));
+        EXPECT_EQ(ctz.lookup(epoch + cctz::seconds(seconds)).offset, offset) << name << seconds;
+
+        if (transitions.local_offset(seconds, &offset)) {
+            auto tp = cctz::convert(civil_epoch + seconds, ctz);
+            EXPECT_EQ((tp - epoch).count(), seconds - offset) << name << seconds;
+        }
+    }
+
+    int32_t offset = 0;
+    EXPECT_FALSE(transitions.utc_offset(TimezoneTransitions::MAX_SECONDS, &offset));
+    EXPECT_FALSE(transitions.local_offset(TimezoneTransitions::MIN_SECONDS - 1, &offset));
+}
+
+TEST(TimezoneTransitionsTest, SameAsCctz) {
+    check_same_as_cctz("+08:00");
+    check_same_as_cctz("-05:30");
+    check_same_as_cctz("Asia/Shanghai");
+    check_same_as_cctz("America/Los_Angeles");
+    check_same_as_cctz("Europe/London");
+    check_same_as_cctz("Australia/Lord_Howe");
+}
+
+} // namespace doris
@@ -0,0 +1,134 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <gtest/gtest-message.h>
+#include <gtest/gtest-test-part.h>
+#include <stddef.h>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "gtest/gtest_pred_impl.h"
+#include "vec/aggregate_functions/aggregate_function.h"
+#include "vec/aggregate_functions/aggregate_function_fused.h"
+#include "vec/aggregate_functions/aggregate_function_simple_factory.h"
+#include "vec/columns/column.h"
+#include "vec/columns/column_vector.h"
+#include "vec/columns/columns_number.h"
+#include "vec/core/types.h"
+#include "vec/data_types/data_type_number.h"
+
+namespace doris::vectorized {
+
+void register_aggregate_function_sum(AggregateFunctionSimpleFactory& factory);
+void register_aggregate_function_count(AggregateFunctionSimpleFactory& factory);
+void register_aggregate_function_minmax(AggregateFunctionSimpleFactory& factory);
+
+class AggFusedTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        register_aggregate_function_sum(_factory);
+        register_aggregate_function_count(_factory);
+        register_aggregate_function_minmax(_factory);
+    }
+
+    AggregateFunctionPtr _get(const std::string& name, const DataTypePtr& type) {
+        DataTypes data_types = {type};
+        return _factory.get(name, data_types);
+    }
+
+    AggregateFunctionSimpleFactory _factory;
+};
+
+TEST_F(AggFusedTest, fused_equals_per_function) {
+    const size_t num_rows = 4096;
+    const size_t num_groups = 7;
+    auto a = ColumnInt64::create();
+    auto b = ColumnInt32::create();
+    for (size_t i = 0; i < num_rows; ++i) {
+        a->insert_value(i * 3);
+        b->insert_value(static_cast<Int32>(i % 1000) - 500);
+    }
+
+    std::vector<AggregateFunctionPtr> functions = {
+            _get("sum", std::make_shared<DataTypeInt64>()),
+            _get("count", std::make_shared<DataTypeInt64>()),
+            _get("min", std::make_shared<DataTypeInt32>()),
+            _get("max", std::make_shared<DataTypeInt32>())};
+    std::vector<const IAggregateFunction*> raw_functions;
+    for (auto& function : functions) {
+        raw_functions.push_back(function.get());
+    }
+    auto fused = create_fused_aggregate_functions(raw_functions);
+    ASSERT_NE(fused, nullptr);
+
+    // each place holds the 4 states, 16 bytes are enough for every one of them
+    const size_t state_size = 16;
+    std::vector<size_t> offsets = {0, state_size, state_size * 2, state_size * 3};
+    std::vector<char> fused_memory(num_groups * state_size * 4);
+    std::vector<char> memory(num_groups * state_size * 4);
+    std::vector<AggregateDataPtr> fused_places(num_rows);
+    std::vector<AggregateDataPtr> places(num_rows);
+    for (size_t g = 0; g < num_groups; ++g) {
+        for (size_t k = 0; k < functions.size(); ++k) {
+            ASSERT_LE(functions[k]->size_of_data(), state_size);
+            functions[k]->create(fused_memory.data() + g * state_size * 4 + offsets[k]);
+            functions[k]->create(memory.data() + g * state_size * 4 + offsets[k]);
+        }
+    }
+    for (size_t i = 0; i < num_rows; ++i) {
+        fused_places[i] = fused_memory.data() + (i % num_groups) * state_size * 4;
+        places[i] = memory.data() + (i % num_groups) * state_size * 4;
+    }
+
+    const IColumn* a_columns[1] = {a.get()};
+    const IColumn* b_columns[1] = {b.get()};
+    std::vector<const IColumn**> columns = {a_columns, a_columns, b_columns, b_columns};
+    fused->add_batch(num_rows, fused_places.data(), offsets.data(), columns.data(), nullptr);
+    for (size_t k = 0; k < functions.size(); ++k) {
+        functions[k]->add_batch(num_rows, places.data(), offsets[k], columns[k], nullptr);
+    }
+
+    for (size_t k = 0; k < functions.size(); ++k) {
+        auto fused_result = functions[k]->get_return_type()->create_column();
+        auto result = functions[k]->get_return_type()->create_column();
+        for (size_t g = 0; g < num_groups; ++g) {
+            functions[k]->insert_result_into(fused_memory.data() + g * state_size * 4 + offsets[k],
+                                             *fused_result);
+            functions[k]->insert_result_into(memory.data() + g * state_size * 4 + offsets[k],
+                                             *result);
+        }
+        for (size_t g = 0; g < num_groups; ++g) {
+            EXPECT_EQ(fused_result->get_int(g), result->get_int(g));
+        }
+    }
+}
+
+TEST_F(AggFusedTest, not_fusible) {
+    std::vector<AggregateFunctionPtr> functions = {
+            _get("sum", std::make_shared<DataTypeFloat64>()),
+            _get("count", std::make_shared<DataTypeInt64>())};
+    std::vector<const IAggregateFunction*> raw_functions = {functions[0].get(),
+                                                            functions[1].get()};
+    EXPECT_EQ(create_fused_aggregate_functions(raw_functions), nullptr);
+
+    raw_functions = {functions[1].get()};
+    EXPECT_EQ(create_fused_aggregate_functions(raw_functions), nullptr);
+}
+
+} // namespace doris::vectorized
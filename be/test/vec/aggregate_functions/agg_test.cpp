@@ -23,15 +23,18 @@
 #include <string>
 
 #include "gtest/gtest_pred_impl.h"
+#include "util/bitmap_value.h"
 #include "vec/aggregate_functions/aggregate_function.h"
 #include "vec/aggregate_functions/aggregate_function_simple_factory.h"
 #include "vec/aggregate_functions/aggregate_function_topn.h"
 #include "vec/columns/column.h"
+#include "vec/columns/column_complex.h"
 #include "vec/columns/column_string.h"
 #include "vec/columns/column_vector.h"
 #include "vec/columns/columns_number.h"
 #include "vec/core/field.h"
 #include "vec/core/types.h"
+#include "vec/data_types/data_type_bitmap.h"
 #include "vec/data_types/data_type_number.h"
 #include "vec/data_types/data_type_string.h"
 
@@ -41,6 +44,7 @@ namespace doris::vectorized {
 // declare function
 void register_aggregate_function_sum(AggregateFunctionSimpleFactory& factory);
 void register_aggregate_function_topn(AggregateFunctionSimpleFactory& factory);
+void register_aggregate_function_bitmap(AggregateFunctionSimpleFactory& factory);
 
 TEST(AggTest, basic_test) {
     auto column_vector_int32 = ColumnVector<Int32>::create();
@@ -102,4 +106,41 @@ TEST(AggTest, topn_test) {
     EXPECT_EQ(result, expect_result);
     agg_function->destroy(place);
 }
+
+TEST(AggTest, bitmap_union_batch_test) {
+    auto column_bitmap = ColumnBitmap::create();
+    for (int i = 0; i < agg_test_batch_size; i++) {
+        BitmapValue bitmap;
+        bitmap.add(i);
+        bitmap.add(i + agg_test_batch_size);
+        column_bitmap->get_data().push_back(bitmap);
+    }
+
+    AggregateFunctionSimpleFactory factory;
+    register_aggregate_function_bitmap(factory);
+    DataTypes data_types = {std::make_shared<DataTypeBitMap>()};
+    auto agg_function = factory.get("bitmap_union", data_types);
+    std::unique_ptr<char[]> memory(new char[agg_function->size_of_data()]);
+    AggregateDataPtr place = memory.get();
+    agg_function->create(place);
+    const IColumn* column[1] = {column_bitmap.get()};
+
+    auto get_cardinality = [&]() {
+        auto result = ColumnBitmap::create();
+        agg_function->insert_result_into(place, *result);
+        return result->get_data()[0].cardinality();
+    };
+    agg_function->add_batch_single_place(agg_test_batch_size, place, column, nullptr);
+    EXPECT_EQ(agg_test_batch_size * 2, get_cardinality());
+
+    // the union of the next group must not contain the values of the previous one
+    agg_function->reset(place);
+    agg_function->add_batch_single_place(agg_test_batch_size / 2, place, column, nullptr);
+    EXPECT_EQ(agg_test_batch_size, get_cardinality());
+
+    agg_function->reset(place);
+    agg_function->add_batch_single_place(1, place, column, nullptr);
+    EXPECT_EQ(2, get_cardinality());
+    agg_function->destroy(place);
+}
 } // namespace doris::vectorized
@@ -0,0 +1,49 @@
+
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "vec/columns/column_string.h"
+
+#include <gtest/gtest-message.h>
+#include <gtest/gtest-test-part.h>
+
+#include <string>
+#include <vector>
+
+#include "gtest/gtest_pred_impl.h"
+
+namespace doris::vectorized {
+
+TEST(ColumnStringTest, ReplicateAppendTest) {
+    auto src = ColumnString::create();
+    for (const std::string value : {"a", "bb", "", "ccc"}) {
+        src->insert_data(value.data(), value.size());
+    }
+    auto dst = ColumnString::create();
+    dst->insert_data("x", 1);
+
+    // rows [1, 4) of src, 2, 0 and 1 times
+    std::vector<uint32_t> counts = {0, 2, 0, 1};
+    src->replicate(counts.data(), 3, *dst, 1, 3);
+    ASSERT_EQ(4, dst->size());
+    EXPECT_EQ("x", dst->get_data_at(0).to_string());
+    EXPECT_EQ("bb", dst->get_data_at(1).to_string());
+    EXPECT_EQ("bb", dst->get_data_at(2).to_string());
+    EXPECT_EQ("ccc", dst->get_data_at(3).to_string());
+}
+
+} // namespace doris::vectorized
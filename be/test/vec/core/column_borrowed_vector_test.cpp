@@ -0,0 +1,62 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+
+#include "vec/columns/column_borrowed_vector.h"
+
+#include <gtest/gtest-message.h>
+#include <gtest/gtest-test-part.h>
+
+#include <memory>
+#include <vector>
+
+#include "gtest/gtest_pred_impl.h"
+#include "vec/columns/column_vector.h"
+
+namespace doris::vectorized {
+
+TEST(ColumnBorrowedVectorTest, BorrowAndMaterialize) {
+    auto buffer = std::make_shared<std::vector<Int32>>(std::vector<Int32> {3, 1, 2, 5});
+    std::weak_ptr<std::vector<Int32>> weak_buffer = buffer;
+    ColumnPtr column = ColumnBorrowedVector<Int32>::create(buffer->data(), buffer->size(), buffer);
+    const Int32* data = buffer->data();
+    buffer.reset();
+    // the column keeps the buffer alive
+    EXPECT_FALSE(weak_buffer.expired());
+    EXPECT_EQ(column->size(), 4);
+    EXPECT_EQ(column->get_data_at(1).data, reinterpret_cast<const char*>(data + 1));
+    EXPECT_EQ(column->get_int(0), 3);
+
+    IColumn::Filter filter = {1, 0, 1, 1};
+    auto filtered = column->filter(filter, -1);
+    const auto& filtered_data = assert_cast<const ColumnInt32&>(*filtered).get_data();
+    ASSERT_EQ(filtered_data.size(), 3);
+    EXPECT_EQ(filtered_data[0], 3);
+    EXPECT_EQ(filtered_data[1], 2);
+    EXPECT_EQ(filtered_data[2], 5);
+
+    auto full = column->convert_to_full_column_if_const();
+    const auto& full_data = assert_cast<const ColumnInt32&>(*full).get_data();
+    ASSERT_EQ(full_data.size(), 4);
+    EXPECT_NE(full_data.data(), data);
+    EXPECT_EQ(full_data[3], 5);
+
+    column = nullptr;
+    EXPECT_TRUE(weak_buffer.expired());
+}
+
+} // namespace doris::vectorized
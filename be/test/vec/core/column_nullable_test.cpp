@@ -51,4 +51,24 @@ TEST(ColumnNullableTest, HashTest) {
     EXPECT_NE(hashes[0].get64(), hashes[1].get64());
 }
 
+TEST(ColumnNullableTest, AllNullTest) {
+    auto nullable_column =
+            ColumnNullable::create(ColumnVector<int>::create(), ColumnUInt8::create());
+    EXPECT_FALSE(nullable_column->all_null());
+
+    nullable_column->insert_many_defaults(3);
+    EXPECT_TRUE(nullable_column->has_null());
+    EXPECT_TRUE(nullable_column->all_null());
+
+    int val = 10;
+    nullable_column->insert_data((const char*)(&val), sizeof(val));
+    EXPECT_TRUE(nullable_column->has_null());
+    EXPECT_FALSE(nullable_column->all_null());
+
+    auto not_null_column =
+            ColumnNullable::create(ColumnVector<int>::create(2, 1), ColumnUInt8::create(2, 0));
+    EXPECT_FALSE(not_null_column->has_null());
+    EXPECT_FALSE(not_null_column->all_null());
+}
+
 } // namespace doris::vectorized
@@ -0,0 +1,93 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+
+#include "vec/core/column_pool.h"
+
+#include <gtest/gtest-message.h>
+#include <gtest/gtest-test-part.h>
+
+#include "gtest/gtest_pred_impl.h"
+#include "vec/columns/column_const.h"
+#include "vec/columns/column_vector.h"
+#include "vec/core/block.h"
+#include "vec/data_types/data_type_number.h"
+
+namespace doris::vectorized {
+
+TEST(ColumnPoolTest, TakeAndGiveBack) {
+    ColumnPool pool(1 << 20);
+    auto type = std::make_shared<DataTypeInt32>();
+
+    auto column = pool.take(type);
+    EXPECT_EQ(pool.miss_count(), 1);
+    for (int i = 0; i < 1024; ++i) {
+        column->insert_data(reinterpret_cast<const char*>(&i), sizeof(i));
+    }
+    size_t capacity = column->allocated_bytes();
+    const void* data = column->get_raw_data().data;
+
+    pool.give_back(std::move(column), type);
+    EXPECT_EQ(pool.pooled_bytes(), capacity);
+
+    auto recycled = pool.take(type);
+    EXPECT_EQ(pool.hit_count(), 1);
+    EXPECT_EQ(recycled->size(), 0);
+    EXPECT_EQ(recycled->allocated_bytes(), capacity);
+    EXPECT_EQ(recycled->get_raw_data().data, data);
+    EXPECT_EQ(pool.pooled_bytes(), 0);
+}
+
+TEST(ColumnPoolTest, IgnoreSharedOrForeignColumns) {
+    ColumnPool pool(1 << 20);
+    auto type = std::make_shared<DataTypeInt32>();
+
+    ColumnPtr shared = ColumnInt32::create(16);
+    ColumnPtr holder = shared;
+    pool.give_back(std::move(shared), type);
+    EXPECT_EQ(pool.pooled_bytes(), 0);
+    EXPECT_EQ(holder->size(), 16);
+
+    ColumnPtr const_column = ColumnConst::create(ColumnInt32::create(1), 16);
+    pool.give_back(std::move(const_column), type);
+    EXPECT_EQ(pool.pooled_bytes(), 0);
+
+    ColumnPool small_pool(16);
+    small_pool.give_back(ColumnInt32::create(1024), type);
+    EXPECT_EQ(small_pool.pooled_bytes(), 0);
+}
+
+TEST(ColumnPoolTest, BlockRecyclesColumns) {
+    ColumnPool pool(1 << 20);
+    ColumnPool::ScopedAttach attach(&pool);
+    auto type = std::make_shared<DataTypeInt32>();
+
+    Block block;
+    block.insert({ColumnInt32::create(1024), type, "a"});
+    block.insert({ColumnInt32::create(1024), type, "b"});
+    // the function result column "b" is returned to the pool
+    block.clear_column_data(1);
+    EXPECT_EQ(block.columns(), 1);
+    EXPECT_GT(pool.pooled_bytes(), 0);
+
+    auto columns = Block({{nullptr, type, "c"}}).mutate_columns();
+    EXPECT_EQ(pool.hit_count(), 1);
+    EXPECT_EQ(columns[0]->size(), 0);
+    EXPECT_GE(columns[0]->allocated_bytes(), 1024 * sizeof(int32_t));
+}
+
+} // namespace doris::vectorized
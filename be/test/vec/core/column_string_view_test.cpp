@@ -0,0 +1,104 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+
+#include "vec/columns/column_string_view.h"
+
+#include <gtest/gtest-message.h>
+#include <gtest/gtest-test-part.h>
+
+#include <string>
+
+#include "gtest/gtest_pred_impl.h"
+#include "vec/columns/column_string.h"
+
+namespace doris::vectorized {
+
+TEST(ColumnStringViewTest, StringView) {
+    std::string short_str = "abc";
+    std::string long_str = "abcdefghijklmnopq";
+    StringView short_view(short_str.data(), short_str.size());
+    StringView long_view(long_str.data(), long_str.size());
+    EXPECT_TRUE(short_view.is_inline());
+    EXPECT_FALSE(long_view.is_inline());
+    EXPECT_EQ(short_view.to_string_ref().to_string(), short_str);
+    EXPECT_EQ(long_view.data(), long_str.data());
+
+    std::string long_copy = long_str;
+    EXPECT_EQ(long_view, StringView(long_copy.data(), long_copy.size()));
+    EXPECT_NE(short_view, long_view);
+    EXPECT_LT(short_view.compare(long_view), 0);
+    EXPECT_GT(long_view.compare(short_view), 0);
+    EXPECT_EQ(StringView().compare(StringView("", 0)), 0);
+}
+
+TEST(ColumnStringViewTest, ShareLongStrings) {
+    auto column = ColumnStringView::create();
+    std::vector<std::string> values = {"a", "", "a long string of more than 12 bytes", "id_0001"};
+    for (const auto& value : values) {
+        column->insert_data(value.data(), value.size());
+    }
+    EXPECT_EQ(column->size(), values.size());
+
+    IColumn::Filter filter = {0, 1, 1, 0};
+    auto filtered = column->filter(filter, -1);
+    ASSERT_EQ(filtered->size(), 2);
+    EXPECT_EQ(filtered->get_data_at(0).to_string(), "");
+    // the long string is not copied by filter
+    EXPECT_EQ(filtered->get_data_at(1).data, column->get_data_at(2).data);
+
+    // the long string is still alive after the source is cleared
+    const auto* long_data = column->get_data_at(2).data;
+    column->clear();
+    EXPECT_EQ(filtered->get_data_at(1).data, long_data);
+    EXPECT_EQ(filtered->get_data_at(1).to_string(), values[2]);
+}
+
+TEST(ColumnStringViewTest, FromColumnString) {
+    auto string_column = ColumnString::create();
+    std::vector<std::string> values = {"b", "a long string of more than 12 bytes", "a"};
+    for (const auto& value : values) {
+        string_column->insert_data(value.data(), value.size());
+    }
+    ColumnPtr holder = std::move(string_column);
+    auto column = ColumnStringView::create_from(assert_cast<const ColumnString&>(*holder));
+    ASSERT_EQ(column->size(), values.size());
+    EXPECT_EQ(column->get_data_at(1).data, holder->get_data_at(1).data);
+
+    IColumn::Permutation perm;
+    column->get_permutation(false, 0, 1, perm);
+    EXPECT_EQ(perm[0], 2);
+    EXPECT_EQ(perm[1], 1);
+    EXPECT_EQ(perm[2], 0);
+
+    auto back = column->to_column_string();
+    for (size_t i = 0; i < values.size(); ++i) {
+        EXPECT_EQ(back->get_data_at(i).to_string(), values[i]);
+    }
+
+    Arena arena;
+    const char* begin = nullptr;
+    auto deserialized = ColumnStringView::create();
+    for (size_t i = 0; i < column->size(); ++i) {
+        auto ref = column->serialize_value_into_arena(i, arena, begin);
+        deserialized->deserialize_and_insert_from_arena(ref.data);
+        begin = nullptr;
+        EXPECT_EQ(deserialized->get_data_at(i).to_string(), values[i]);
+    }
+}
+
+} // namespace doris::vectorized
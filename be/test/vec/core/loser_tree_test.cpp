@@ -0,0 +1,175 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "vec/core/loser_tree.h"
+
+#include <gtest/gtest-message.h>
+#include <gtest/gtest-test-part.h>
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+#include "gtest/gtest_pred_impl.h"
+
+namespace doris::vectorized {
+
+namespace {
+
+struct SortedRun {
+    std::vector<int> values;
+    size_t pos = 0;
+    // joins the tree after this run is exhausted
+    SortedRun* next = nullptr;
+    int current() const { return values[pos]; }
+};
+
+struct SortedRunGreater {
+    bool operator()(const SortedRun* lhs, const SortedRun* rhs) const {
+        return lhs->current() > rhs->current();
+    }
+};
+
+std::vector<std::vector<int>> make_runs(size_t num_runs, size_t max_rows, int max_value,
+                                        std::mt19937* rng) {
+    std::vector<std::vector<int>> runs(num_runs);
+    for (auto& run : runs) {
+        size_t rows = 1 + (*rng)() % max_rows;
+        for (size_t i = 0; i < rows; ++i) {
+            run.push_back((*rng)() % max_value);
+        }
+        std::sort(run.begin(), run.end());
+    }
+    return runs;
+}
+
+std::vector<int> expected_output(const std::vector<std::vector<int>>& runs) {
+    std::vector<int> expected;
+    for (const auto& run : runs) {
+        expected.insert(expected.end(), run.begin(), run.end());
+    }
+    std::sort(expected.begin(), expected.end());
+    return expected;
+}
+
+} // namespace
+
+TEST(LoserTreeTest, MergeRowByRow) {
+    std::mt19937 rng(0);
+    for (size_t num_runs = 1; num_runs <= 17; ++num_runs) {
+        auto values = make_runs(num_runs, 50, 100, &rng);
+        std::vector<SortedRun> runs(num_runs);
+        std::vector<SortedRun*> children;
+        for (size_t i = 0; i < num_runs; ++i) {
+            runs[i].values = values[i];
+            children.push_back(&runs[i]);
+        }
+        LoserTree<SortedRun*, SortedRunGreater> tree;
+        tree.init(children);
+        EXPECT_EQ(tree.size(), num_runs);
+
+        std::vector<int> output;
+        while (!tree.empty()) {
+            SortedRun* top = tree.top();
+            output.push_back(top->current());
+            if (++top->pos < top->values.size()) {
+                tree.update_top();
+            } else {
+                tree.pop_top();
+            }
+        }
+        EXPECT_EQ(output, expected_output(values));
+    }
+}
+
+TEST(LoserTreeTest, MergeRuns) {
+    std::mt19937 rng(1);
+    for (size_t num_runs = 1; num_runs <= 9; ++num_runs) {
+        // few distinct values make long runs
+        auto values = make_runs(num_runs, 200, 1000, &rng);
+        std::vector<SortedRun> runs(num_runs);
+        std::vector<SortedRun*> children;
+        for (size_t i = 0; i < num_runs; ++i) {
+            runs[i].values = values[i];
+            children.push_back(&runs[i]);
+        }
+        LoserTree<SortedRun*, SortedRunGreater> tree;
+        tree.init(children);
+
+        std::vector<int> output;
+        while (!tree.empty()) {
+            SortedRun* top = tree.top();
+            SortedRun** runner_up = tree.runner_up();
+            size_t end = top->pos + 1;
+            while (end < top->values.size() &&
+                   (runner_up == nullptr || top->values[end] <= (*runner_up)->current())) {
+                ++end;
+            }
+            output.insert(output.end(), top->values.begin() + top->pos, top->values.begin() + end);
+            top->pos = end;
+            if (top->pos < top->values.size()) {
+                tree.update_top();
+            } else {
+                tree.pop_top();
+            }
+        }
+        EXPECT_EQ(output, expected_output(values));
+    }
+}
+
+TEST(LoserTreeTest, ReplaceTop) {
+    // the second half of every run joins the tree after the first half is exhausted
+    std::mt19937 rng(2);
+    size_t num_runs = 5;
+    auto values = make_runs(num_runs, 100, 100, &rng);
+    std::vector<SortedRun> first_halves(num_runs);
+    std::vector<SortedRun> second_halves(num_runs);
+    std::vector<SortedRun*> children;
+    for (size_t i = 0; i < num_runs; ++i) {
+        size_t half = (values[i].size() + 1) / 2;
+        first_halves[i].values.assign(values[i].begin(), values[i].begin() + half);
+        second_halves[i].values.assign(values[i].begin() + half, values[i].end());
+        if (!second_halves[i].values.empty()) {
+            first_halves[i].next = &second_halves[i];
+        }
+        children.push_back(&first_halves[i]);
+    }
+    LoserTree<SortedRun*, SortedRunGreater> tree;
+    tree.init(children);
+
+    std::vector<int> output;
+    while (!tree.empty()) {
+        SortedRun* top = tree.top();
+        output.push_back(top->current());
+        if (++top->pos < top->values.size()) {
+            tree.update_top();
+            continue;
+        }
+        if (top->next != nullptr) {
+            tree.replace_top(top->next);
+        } else {
+            tree.pop_top();
+        }
+    }
+    EXPECT_EQ(output, expected_output(values));
+
+    size_t num_left = 0;
+    tree.for_each([&num_left](SortedRun*) { ++num_left; });
+    EXPECT_EQ(num_left, 0);
+}
+
+} // namespace doris::vectorized
@@ -0,0 +1,102 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+
+#include "vec/core/sort_block.h"
+
+#include <gtest/gtest-message.h>
+#include <gtest/gtest-test-part.h>
+
+#include <random>
+#include <string>
+
+#include "common/config.h"
+#include "gtest/gtest_pred_impl.h"
+#include "vec/columns/column_nullable.h"
+#include "vec/columns/column_string.h"
+#include "vec/columns/columns_number.h"
+#include "vec/data_types/data_type_nullable.h"
+#include "vec/data_types/data_type_number.h"
+#include "vec/data_types/data_type_string.h"
+
+namespace doris::vectorized {
+
+static Block create_sort_block(size_t rows) {
+    std::mt19937 rng(rows);
+    auto nullable_column = ColumnNullable::create(ColumnInt32::create(), ColumnUInt8::create());
+    auto string_column = ColumnString::create();
+    auto bigint_column = ColumnInt64::create();
+    for (size_t i = 0; i < rows; ++i) {
+        if (rng() % 5 == 0) {
+            nullable_column->insert_default();
+        } else {
+            Int32 value = static_cast<Int32>(rng() % 7) - 3;
+            nullable_column->insert_data((const char*)&value, sizeof(value));
+        }
+        // long strings with a common prefix are only ordered by the comparator
+        std::string value = rng() % 2 ? "prefix_of_string_" : "";
+        value += std::to_string(rng() % 13);
+        string_column->insert_data(value.data(), value.size());
+        bigint_column->insert_value(static_cast<Int64>(rng() % 11) - 5);
+    }
+    Block block;
+    block.insert({std::move(nullable_column),
+                  std::make_shared<DataTypeNullable>(std::make_shared<DataTypeInt32>()), "a"});
+    block.insert({std::move(string_column), std::make_shared<DataTypeString>(), "b"});
+    block.insert({std::move(bigint_column), std::make_shared<DataTypeInt64>(), "c"});
+    return block;
+}
+
+static void check_normalized_key_sort(const SortDescription& description, UInt64 limit) {
+    for (size_t rows : {10, 1000, 10000}) {
+        Block block = create_sort_block(rows);
+        Block expected = block.clone_empty();
+        Block actual = block.clone_empty();
+
+        config::enable_normalized_key_sort = false;
+        sort_block(block, expected, description, limit);
+        config::enable_normalized_key_sort = true;
+        sort_block(block, actual, description, limit);
+
+        ASSERT_EQ(expected.rows(), actual.rows());
+        EXPECT_TRUE(is_already_sorted(actual, description));
+        // the other columns of the rows with equal sort keys may be in any order
+        for (const auto& sort_desc : description) {
+            const auto& expected_column = *expected.get_by_position(sort_desc.column_number).column;
+            const auto& actual_column = *actual.get_by_position(sort_desc.column_number).column;
+            for (size_t row = 0; row < expected.rows(); ++row) {
+                ASSERT_EQ(expected_column.compare_at(row, row, actual_column, 1), 0);
+            }
+        }
+    }
+}
+
+TEST(SortBlockTest, NormalizedKeySort) {
+    // fixed-width columns
+    check_normalized_key_sort({SortColumnDescription(0, 1, 1), SortColumnDescription(2, 1, 1)}, 0);
+    check_normalized_key_sort({SortColumnDescription(2, -1, 1), SortColumnDescription(0, -1, -1)},
+                              0);
+    // the string column ends the normalized key
+    check_normalized_key_sort({SortColumnDescription(0, 1, -1), SortColumnDescription(1, 1, 1),
+                               SortColumnDescription(2, -1, 1)},
+                              0);
+    check_normalized_key_sort({SortColumnDescription(1, -1, 1), SortColumnDescription(0, 1, 1),
+                               SortColumnDescription(2, 1, 1)},
+                              900);
+}
+
+} // namespace doris::vectorized
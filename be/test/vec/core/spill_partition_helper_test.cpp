@@ -0,0 +1,77 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "vec/core/spill_partition_helper.h"
+
+#include <gtest/gtest-message.h>
+#include <gtest/gtest-test-part.h>
+#include <stddef.h>
+
+#include <vector>
+
+#include "gtest/gtest_pred_impl.h"
+#include "vec/columns/columns_number.h"
+#include "vec/common/assert_cast.h"
+#include "vec/data_types/data_type_number.h"
+
+namespace doris::vectorized {
+
+TEST(SpillPartitionHelperTest, GetIndex) {
+    SpillPartitionHelper helper(4);
+    EXPECT_EQ(helper.partition_count, 16);
+    EXPECT_EQ(helper.get_index(0), 0);
+    EXPECT_EQ(helper.get_index(0xF0000000), 15);
+    EXPECT_EQ(helper.get_index(0x1FFFFFFF), 1);
+
+    // the 4 highest bits are skipped
+    SpillPartitionHelper skipped_helper(4, 4);
+    EXPECT_EQ(skipped_helper.get_index(0xF0000000), 0);
+    EXPECT_EQ(skipped_helper.get_index(0x0A000000), 10);
+}
+
+TEST(SpillPartitionHelperTest, SplitBlock) {
+    SpillPartitionHelper helper(2);
+
+    auto column = ColumnInt32::create();
+    std::vector<size_t> partition_indices;
+    for (int i = 0; i < 10; ++i) {
+        column->insert_value(i);
+        // partition 3 is left empty
+        partition_indices.emplace_back(i % 3);
+    }
+    Block block({ColumnWithTypeAndName(std::move(column), std::make_shared<DataTypeInt32>(), "k")});
+
+    std::vector<Block> partitioned_blocks;
+    helper.split_block(block, partition_indices, partitioned_blocks);
+    ASSERT_EQ(partitioned_blocks.size(), 4);
+    EXPECT_EQ(partitioned_blocks[0].rows(), 4);
+    EXPECT_EQ(partitioned_blocks[1].rows(), 3);
+    EXPECT_EQ(partitioned_blocks[2].rows(), 3);
+    EXPECT_EQ(partitioned_blocks[3].rows(), 0);
+    EXPECT_EQ(partitioned_blocks[3].columns(), 1);
+
+    for (size_t i = 0; i < 3; ++i) {
+        const auto& data = assert_cast<const ColumnInt32&>(
+                                   *partitioned_blocks[i].get_by_position(0).column)
+                                   .get_data();
+        for (size_t j = 0; j < data.size(); ++j) {
+            EXPECT_EQ(data[j], static_cast<int32_t>(i + j * 3));
+        }
+    }
+}
+
+} // namespace doris::vectorized
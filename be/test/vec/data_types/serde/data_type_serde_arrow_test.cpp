@@ -16,6 +16,7 @@
 // specific language governing permissions and limitations
 // under the License.
 
+#include <arrow/array/array_primitive.h>
 #include <arrow/array/builder_base.h>
 #include <arrow/array/builder_binary.h>
 #include <arrow/array/builder_decimal.h>
@@ -318,4 +319,53 @@ TEST(DataTypeSerDeArrowTest, DataTypeScalaSerDeTest) {
     serialize_and_deserialize_arrow_test();
 }
 
+TEST(DataTypeSerDeArrowTest, MoveNumericColumns) {
+    int row_num = 100;
+    auto make_block = [&]() {
+        auto k1 = vectorized::ColumnVector<Int64>::create();
+        auto k2 = vectorized::ColumnVector<Float64>::create();
+        auto null_map = vectorized::ColumnUInt8::create();
+        for (int i = 0; i < row_num; ++i) {
+            k1->insert_value(i);
+            k2->insert_value(i * 0.5);
+            null_map->insert_value(i % 3 == 0);
+        }
+        vectorized::Block block;
+        block.insert({std::move(k1), std::make_shared<vectorized::DataTypeInt64>(), "k1"});
+        block.insert({vectorized::ColumnNullable::create(std::move(k2), std::move(null_map)),
+                      vectorized::make_nullable(std::make_shared<vectorized::DataTypeFloat64>()),
+                      "k2"});
+        return block;
+    };
+    auto schema = arrow::schema(
+            {arrow::field("k1", arrow::int64(), false), arrow::field("k2", arrow::float64())});
+
+    vectorized::Block copied_block = make_block();
+    std::shared_ptr<arrow::RecordBatch> copied;
+    EXPECT_EQ(convert_to_arrow_batch(copied_block, schema, arrow::default_memory_pool(), &copied),
+              Status::OK());
+
+    vectorized::Block moved_block = make_block();
+    const auto* k1_data = moved_block.get_by_position(0).column->get_raw_data().data;
+    std::shared_ptr<arrow::RecordBatch> moved;
+    EXPECT_EQ(convert_to_arrow_batch(std::move(moved_block), schema, arrow::default_memory_pool(),
+                                     &moved),
+              Status::OK());
+    // the data of the moved column is shared with the array
+    EXPECT_EQ(reinterpret_cast<const char*>(moved->column(0)->data()->buffers[1]->data()),
+              k1_data);
+
+    EXPECT_TRUE(moved->Equals(*copied));
+    EXPECT_EQ(moved->num_rows(), row_num);
+    EXPECT_EQ(moved->column(0)->null_count(), 0);
+    EXPECT_EQ(moved->column(1)->null_count(), (row_num + 2) / 3);
+    const auto& k2_array = static_cast<const arrow::DoubleArray&>(*moved->column(1));
+    for (int i = 0; i < row_num; ++i) {
+        EXPECT_EQ(k2_array.IsNull(i), i % 3 == 0);
+        if (!k2_array.IsNull(i)) {
+            EXPECT_EQ(k2_array.Value(i), i * 0.5);
+        }
+    }
+}
+
 } // namespace doris::vectorized
@@ -0,0 +1,61 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "vec/exec/scan/file_scan_range_queue.h"
+
+#include <gen_cpp/PlanNodes_types.h>
+#include <gtest/gtest-message.h>
+#include <gtest/gtest-test-part.h>
+
+#include <string>
+#include <vector>
+
+#include "gtest/gtest_pred_impl.h"
+
+namespace doris::vectorized {
+
+static TFileRangeDesc make_range(const std::string& path, int64_t size) {
+    TFileRangeDesc range;
+    range.__set_path(path);
+    range.__set_start_offset(0);
+    range.__set_size(size);
+    return range;
+}
+
+TEST(FileScanRangeQueueTest, StealFromLargestScanner) {
+    std::vector<TFileRangeDesc> ranges0 = {make_range("a", 10)};
+    std::vector<TFileRangeDesc> ranges1 = {make_range("b", 100), make_range("c", 100),
+                                           make_range("d", 100)};
+    std::vector<TFileRangeDesc> ranges2 = {make_range("e", 50), make_range("f", 50)};
+    FileScanRangeQueue queue(false);
+    EXPECT_EQ(0, queue.add_scanner(ranges0));
+    EXPECT_EQ(1, queue.add_scanner(ranges1));
+    EXPECT_EQ(2, queue.add_scanner(ranges2));
+
+    // own ranges first
+    EXPECT_EQ("a", queue.next(0)->path);
+    EXPECT_EQ("b", queue.next(1)->path);
+    // steal the tail of the scanner with the most remaining bytes
+    EXPECT_EQ("d", queue.next(0)->path);
+    EXPECT_EQ("c", queue.next(0)->path);
+    EXPECT_EQ("f", queue.next(0)->path);
+    EXPECT_EQ("e", queue.next(1)->path);
+    EXPECT_EQ(nullptr, queue.next(2));
+    EXPECT_EQ(nullptr, queue.next(0));
+}
+
+} // namespace doris::vectorized
@@ -0,0 +1,139 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+
+#include "vec/exec/format/file_reader/new_plain_text_line_reader.h"
+
+#include <gtest/gtest-message.h>
+#include <gtest/gtest-test-part.h>
+
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "common/config.h"
+#include "gtest/gtest_pred_impl.h"
+#include "io/fs/stream_load_pipe.h"
+#include "util/byte_buffer.h"
+#include "util/runtime_profile.h"
+
+namespace doris {
+
+class NewPlainTextLineReaderTest : public testing::Test {
+protected:
+    // reads the lines of `chunks` appended to a pipe as separate buffers
+    std::vector<std::string> read_lines(const std::vector<std::string>& chunks,
+                                        const std::string& delimiter) {
+        auto pipe = std::make_shared<io::StreamLoadPipe>();
+        for (const auto& chunk : chunks) {
+            auto buf = ByteBuffer::allocate(chunk.size());
+            buf->put_bytes(chunk.data(), chunk.size());
+            buf->flip();
+            EXPECT_TRUE(pipe->append(buf).ok());
+        }
+        EXPECT_TRUE(pipe->finish().ok());
+
+        RuntimeProfile profile("test");
+        NewPlainTextLineReader reader(&profile, pipe, nullptr, -1, delimiter, delimiter.size(),
+                                      0);
+        std::vector<std::string> lines;
+        while (true) {
+            const uint8_t* ptr = nullptr;
+            size_t size = 0;
+            bool eof = false;
+            EXPECT_TRUE(reader.read_line(&ptr, &size, &eof, nullptr).ok());
+            if (eof) {
+                break;
+            }
+            lines.emplace_back(reinterpret_cast<const char*>(ptr), size);
+        }
+        return lines;
+    }
+};
+
+TEST_F(NewPlainTextLineReaderTest, pipe_lines_across_buffers) {
+    config::enable_stream_load_zero_copy = true;
+    std::vector<std::string> expected = {"a,1", "bb,2", "", "ccc,3", "d"};
+    EXPECT_EQ(expected, read_lines({"a,1\nbb", ",2\n", "\ncc", "c,", "3\nd"}, "\n"));
+    EXPECT_EQ(expected, read_lines({"a,1\nbb,2\n\nccc,3\nd\n"}, "\n"));
+    EXPECT_TRUE(read_lines({}, "\n").empty());
+}
+
+TEST_F(NewPlainTextLineReaderTest, pipe_delimiter_across_buffers) {
+    config::enable_stream_load_zero_copy = true;
+    std::vector<std::string> expected = {"a,1", "bb,2", "c"};
+    EXPECT_EQ(expected, read_lines({"a,1|", "|$bb,2|", "|", "$c"}, "||$"));
+    EXPECT_EQ(expected, read_lines({"a,1||$bb", ",2||$c"}, "||$"));
+    // a partial delimiter is a part of the line
+    EXPECT_EQ(std::vector<std::string>({"a|", "b"}), read_lines({"a|", "||$b"}, "||$"));
+}
+
+TEST_F(NewPlainTextLineReaderTest, pipe_split_by_lines) {
+    config::enable_stream_load_zero_copy = true;
+    for (const std::string delimiter : {"\n", "||$"}) {
+        std::vector<std::string> expected;
+        std::string data;
+        for (int i = 0; i < 1000; ++i) {
+            auto c = static_cast<char>('a' + i % 26);
+            expected.push_back(std::string(i % 37, c) + std::to_string(i));
+            data += expected.back() + delimiter;
+        }
+        // the last line has no delimiter
+        data.resize(data.size() - delimiter.size());
+
+        auto pipe = std::make_shared<io::StreamLoadPipe>(data.size());
+        pipe->split_by_lines(delimiter);
+        for (size_t pos = 0; pos < data.size(); pos += 97) {
+            size_t size = std::min<size_t>(97, data.size() - pos);
+            auto buf = ByteBuffer::allocate(size);
+            buf->put_bytes(data.data() + pos, size);
+            buf->flip();
+            EXPECT_TRUE(pipe->append(buf).ok());
+        }
+        EXPECT_TRUE(pipe->finish().ok());
+
+        // the readers sharing the pipe read whole lines by turns
+        RuntimeProfile profile("test");
+        NewPlainTextLineReader reader1(&profile, pipe, nullptr, -1, delimiter, delimiter.size(),
+                                       0);
+        NewPlainTextLineReader reader2(&profile, pipe, nullptr, -1, delimiter, delimiter.size(),
+                                       0);
+        std::vector<std::string> lines;
+        bool eof1 = false;
+        bool eof2 = false;
+        while (!eof1 || !eof2) {
+            for (auto [reader, eof] : {std::make_pair(&reader1, &eof1),
+                                       std::make_pair(&reader2, &eof2)}) {
+                const uint8_t* ptr = nullptr;
+                size_t size = 0;
+                if (*eof) {
+                    continue;
+                }
+                EXPECT_TRUE(reader->read_line(&ptr, &size, eof, nullptr).ok());
+                if (!*eof) {
+                    lines.emplace_back(reinterpret_cast<const char*>(ptr), size);
+                }
+            }
+        }
+        std::sort(lines.begin(), lines.end());
+        std::sort(expected.begin(), expected.end());
+        EXPECT_EQ(expected, lines);
+    }
+}
+
+} // namespace doris
@@ -0,0 +1,107 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "vec/exec/join/range_join_index.h"
+
+#include <gtest/gtest-message.h>
+#include <gtest/gtest-test-part.h>
+
+#include <algorithm>
+#include <vector>
+
+#include "gtest/gtest_pred_impl.h"
+#include "vec/columns/column_nullable.h"
+#include "vec/columns/columns_number.h"
+#include "vec/core/column_with_type_and_name.h"
+#include "vec/data_types/data_type_nullable.h"
+#include "vec/data_types/data_type_number.h"
+
+namespace doris::vectorized {
+
+static ColumnWithTypeAndName int_column(const std::vector<int32_t>& values) {
+    auto column = ColumnInt32::create();
+    for (auto value : values) {
+        column->insert_value(value);
+    }
+    return {std::move(column), std::make_shared<DataTypeInt32>(), "c"};
+}
+
+static ColumnWithTypeAndName nullable_int_column(const std::vector<int32_t>& values,
+                                                 const std::vector<uint8_t>& nulls) {
+    auto column = ColumnNullable::create(ColumnInt32::create(), ColumnUInt8::create());
+    for (size_t i = 0; i < values.size(); ++i) {
+        if (nulls[i]) {
+            column->insert_default();
+        } else {
+            column->insert_data(reinterpret_cast<const char*>(&values[i]), sizeof(int32_t));
+        }
+    }
+    return {std::move(column), make_nullable(std::make_shared<DataTypeInt32>()), "c"};
+}
+
+static std::vector<int> lookup(const RangeJoinIndex& index, const Block& probe_block, int row) {
+    std::vector<int> rows;
+    index.lookup(probe_block, row, &rows);
+    std::sort(rows.begin(), rows.end());
+    return rows;
+}
+
+TEST(RangeJoinIndexTest, sorted) {
+    // probe column 0, build column 1: build <= probe
+    RangeJoinIndex index({{0, 1, true}}, 1);
+    EXPECT_FALSE(index.use_interval_tree());
+    Blocks build_blocks;
+    build_blocks.emplace_back(Block({nullable_int_column({5, 1, 0}, {0, 0, 1})}));
+    build_blocks.emplace_back(Block({int_column({3, 9})}));
+    ASSERT_TRUE(index.build(&build_blocks).ok());
+    ASSERT_EQ(1, build_blocks.size());
+    ASSERT_EQ(5, build_blocks[0].rows());
+
+    Block probe_block({nullable_int_column({0, 3, 100, 7}, {0, 0, 0, 1})});
+    EXPECT_EQ(std::vector<int>(), lookup(index, probe_block, 0));
+    EXPECT_EQ(std::vector<int>({1, 3}), lookup(index, probe_block, 1));
+    EXPECT_EQ(std::vector<int>({0, 1, 3, 4}), lookup(index, probe_block, 2));
+    // null probe values match nothing
+    EXPECT_EQ(std::vector<int>(), lookup(index, probe_block, 3));
+
+    // build >= probe
+    RangeJoinIndex upper_index({{0, 1, false}}, 1);
+    Blocks upper_build_blocks;
+    upper_build_blocks.emplace_back(Block({int_column({5, 1, 3, 9})}));
+    ASSERT_TRUE(upper_index.build(&upper_build_blocks).ok());
+    EXPECT_EQ(std::vector<int>({0, 2, 3}), lookup(upper_index, probe_block, 1));
+    EXPECT_EQ(std::vector<int>(), lookup(upper_index, probe_block, 2));
+}
+
+TEST(RangeJoinIndexTest, interval_tree) {
+    // probe column 0 between build columns 1 and 2
+    RangeJoinIndex index({{0, 2, false}, {0, 1, true}}, 1);
+    EXPECT_TRUE(index.use_interval_tree());
+    Blocks build_blocks;
+    Block build_block({int_column({0, 5, 3, 8}), int_column({4, 10, 2, 8})});
+    build_blocks.emplace_back(std::move(build_block));
+    ASSERT_TRUE(index.build(&build_blocks).ok());
+
+    Block probe_block({int_column({3, 8, 11, -1})});
+    // [3, 2] is empty
+    EXPECT_EQ(std::vector<int>({0}), lookup(index, probe_block, 0));
+    EXPECT_EQ(std::vector<int>({1, 3}), lookup(index, probe_block, 1));
+    EXPECT_EQ(std::vector<int>(), lookup(index, probe_block, 2));
+    EXPECT_EQ(std::vector<int>(), lookup(index, probe_block, 3));
+}
+
+} // namespace doris::vectorized
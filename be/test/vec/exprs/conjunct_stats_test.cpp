@@ -0,0 +1,52 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "vec/exprs/conjunct_stats.h"
+
+#include <gtest/gtest-message.h>
+#include <gtest/gtest-test-part.h>
+
+#include <vector>
+
+#include "gtest/gtest_pred_impl.h"
+
+namespace doris::vectorized {
+
+TEST(ConjunctStatsTest, ReorderByRank) {
+    std::vector<ConjunctStats> stats(3);
+    // filters half of the rows at 10ns per row
+    stats[0].update(1000, 500, 1000, 10000);
+    // filters 90% of the rows at 1ns per row
+    stats[1].update(1000, 100, 1000, 1000);
+    // filters nothing
+    stats[2].update(1000, 1000, 1000, 1000);
+
+    std::vector<int> conjuncts {0, 1, 2};
+    auto get_stats = [&stats](int i) -> ConjunctStats& { return stats[i]; };
+    reorder_conjuncts_by_rank(&conjuncts, get_stats);
+    EXPECT_EQ(std::vector<int>({1, 0, 2}), conjuncts);
+    EXPECT_EQ(500, stats[1].input_rows);
+    EXPECT_EQ(50, stats[1].output_rows);
+
+    // not reordered until all conjuncts have samples
+    stats[0] = ConjunctStats();
+    conjuncts = {2, 0, 1};
+    reorder_conjuncts_by_rank(&conjuncts, get_stats);
+    EXPECT_EQ(std::vector<int>({2, 0, 1}), conjuncts);
+}
+
+} // namespace doris::vectorized
@@ -36,6 +36,7 @@
 #include <utility>
 #include <vector>
 
+#include "common/config.h"
 #include "common/status.h"
 #include "gtest/gtest_pred_impl.h"
 #include "gutil/stringprintf.h"
@@ -451,6 +452,45 @@ TEST_F(VerticalCompactionTest, TestRowSourcesBuffer) {
     }
 }
 
+TEST_F(VerticalCompactionTest, TestCloneRowSourcesBuffer) {
+    std::vector<RowSource> tmp_row_source;
+    for (uint16_t i = 0; i < 6; ++i) {
+        tmp_row_source.emplace_back(i % 3, false);
+    }
+    // row sources in memory
+    RowSourcesBuffer buffer(102, absolute_dir, ReaderType::READER_CUMULATIVE_COMPACTION);
+    EXPECT_TRUE(buffer.append(tmp_row_source).ok());
+    EXPECT_TRUE(buffer.flush().ok());
+    // row sources spilled to file
+    auto max_row_source_memory_mb = config::vertical_compaction_max_row_source_memory_mb;
+    config::vertical_compaction_max_row_source_memory_mb = 0;
+    RowSourcesBuffer buffer1(103, absolute_dir, ReaderType::READER_CUMULATIVE_COMPACTION);
+    EXPECT_TRUE(buffer1.append(tmp_row_source).ok());
+    EXPECT_TRUE(buffer1.flush().ok());
+    config::vertical_compaction_max_row_source_memory_mb = max_row_source_memory_mb;
+
+    for (auto* origin : {&buffer, &buffer1}) {
+        std::unique_ptr<RowSourcesBuffer> cloned1;
+        std::unique_ptr<RowSourcesBuffer> cloned2;
+        EXPECT_TRUE(origin->clone(&cloned1).ok());
+        EXPECT_TRUE(origin->clone(&cloned2).ok());
+        EXPECT_EQ(cloned1->total_size(), 6);
+        // the cloned buffers are read independently
+        for (size_t i = 0; i < tmp_row_source.size(); ++i) {
+            EXPECT_TRUE(cloned1->has_remaining().ok());
+            EXPECT_EQ(cloned1->current().get_source_num(), i % 3);
+            cloned1->advance();
+            if (i % 2 == 0) {
+                EXPECT_TRUE(cloned2->has_remaining().ok());
+                EXPECT_EQ(cloned2->current().get_source_num(), (i / 2) % 3);
+                cloned2->advance();
+            }
+        }
+        EXPECT_FALSE(cloned1->has_remaining().ok());
+        EXPECT_TRUE(cloned2->has_remaining().ok());
+    }
+}
+
 TEST_F(VerticalCompactionTest, TestDupKeyVerticalMerge) {
     auto num_input_rowset = 2;
     auto num_segments = 2;
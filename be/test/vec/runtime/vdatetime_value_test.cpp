@@ -21,6 +21,8 @@
 #include <gtest/gtest-test-part.h>
 
 #include <string>
+#include <utility>
+#include <vector>
 
 #include "gtest/gtest_pred_impl.h"
 
@@ -570,4 +572,36 @@ TEST(VDateTimeValueTest, date_v2_to_string_test) {
     }
 }
 
+TEST(VDateTimeValueTest, from_standard_date_str_test) {
+    // "YYYY-MM-DD" and "YYYY-MM-DD HH:MM:SS" are parsed by a fast path, the results must be
+    // the same as the other separators
+    for (const auto& [standard, other] :
+         std::vector<std::pair<std::string, std::string>> {
+                 {"2024-02-29", "2024/02/29"},
+                 {"2023-02-29", "2023/02/29"},
+                 {"2023-12-31 23:59:59", "2023/12/31 23.59.59"},
+                 {"2023-12-31 24:00:00", "2023/12/31 24.00.00"},
+                 {"2023-12-31 23:60:00", "2023/12/31 23.60.00"},
+                 {"2023-00-31 23:59:59", "2023/00/31 23.59.59"}}) {
+        DateV2Value<DateTimeV2ValueType> datetime_v2;
+        DateV2Value<DateTimeV2ValueType> other_datetime_v2;
+        EXPECT_EQ(datetime_v2.from_date_str(standard.data(), standard.size(), -1),
+                  other_datetime_v2.from_date_str(other.data(), other.size(), -1));
+        EXPECT_EQ(datetime_v2.to_date_int_val(), other_datetime_v2.to_date_int_val());
+
+        DateV2Value<DateV2ValueType> date_v2;
+        DateV2Value<DateV2ValueType> other_date_v2;
+        EXPECT_EQ(date_v2.from_date_str(standard.data(), standard.size()),
+                  other_date_v2.from_date_str(other.data(), other.size()));
+        EXPECT_EQ(date_v2.to_date_int_val(), other_date_v2.to_date_int_val());
+
+        VecDateTimeValue datetime;
+        VecDateTimeValue other_datetime;
+        EXPECT_EQ(datetime.from_date_str(standard.data(), standard.size()),
+                  other_datetime.from_date_str(other.data(), other.size()));
+        EXPECT_EQ(datetime.to_int64(), other_datetime.to_int64());
+        EXPECT_EQ(datetime.type(), other_datetime.type());
+    }
+}
+
 } // namespace doris::vectorized
@@ -0,0 +1,83 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "vec/sink/adaptive_compression_selector.h"
+
+#include <gtest/gtest-message.h>
+#include <gtest/gtest-test-part.h>
+
+#include "gtest/gtest_pred_impl.h"
+
+namespace doris::vectorized {
+
+using segment_v2::CompressionTypePB;
+
+// Feed the sampling round with the given ratio and compress time per byte of each codec.
+static void sample_round(AdaptiveCompressionSelector* selector, double lz4_ratio,
+                         double lz4_ns_per_byte, double zstd_ratio, double zstd_ns_per_byte) {
+    const size_t bytes = 1 << 20;
+    for (size_t i = 0; i < AdaptiveCompressionSelector::SAMPLE_BLOCKS_PER_CODEC * 3; ++i) {
+        auto type = selector->next();
+        if (type == CompressionTypePB::NO_COMPRESSION) {
+            selector->update(type, bytes, bytes, 0);
+        } else if (type == CompressionTypePB::LZ4) {
+            selector->update(type, bytes, bytes * lz4_ratio, bytes * lz4_ns_per_byte);
+        } else {
+            EXPECT_EQ(CompressionTypePB::ZSTD, type);
+            selector->update(type, bytes, bytes * zstd_ratio, bytes * zstd_ns_per_byte);
+        }
+    }
+}
+
+TEST(AdaptiveCompressionSelectorTest, choose_by_network_speed) {
+    // 10GB/s, compression costs more time than it saves
+    AdaptiveCompressionSelector fast;
+    fast.set_network_bytes_per_second(10.0 * 1024 * 1024 * 1024);
+    sample_round(&fast, 0.5, 1, 0.3, 4);
+    EXPECT_EQ(CompressionTypePB::NO_COMPRESSION, fast.next());
+
+    // 10MB/s, the smallest output wins
+    AdaptiveCompressionSelector slow;
+    slow.set_network_bytes_per_second(10.0 * 1024 * 1024);
+    sample_round(&slow, 0.5, 1, 0.3, 4);
+    EXPECT_EQ(CompressionTypePB::ZSTD, slow.next());
+
+    // 500MB/s, lz4 is cheap and good enough
+    AdaptiveCompressionSelector medium;
+    medium.set_network_bytes_per_second(500.0 * 1024 * 1024);
+    sample_round(&medium, 0.5, 0.2, 0.45, 4);
+    EXPECT_EQ(CompressionTypePB::LZ4, medium.next());
+}
+
+TEST(AdaptiveCompressionSelectorTest, resample) {
+    AdaptiveCompressionSelector selector;
+    selector.set_network_bytes_per_second(10.0 * 1024 * 1024);
+    sample_round(&selector, 0.5, 1, 0.3, 4);
+    EXPECT_EQ(CompressionTypePB::ZSTD, selector.current());
+    size_t num_sampled = AdaptiveCompressionSelector::SAMPLE_BLOCKS_PER_CODEC * 3;
+    for (size_t i = num_sampled; i < AdaptiveCompressionSelector::RESAMPLE_INTERVAL; ++i) {
+        auto type = selector.next();
+        EXPECT_EQ(CompressionTypePB::ZSTD, type);
+        selector.update(type, 1024, 300, 4096);
+    }
+    // the data can not be compressed any more
+    selector.set_network_bytes_per_second(10.0 * 1024 * 1024 * 1024);
+    sample_round(&selector, 1, 1, 1, 4);
+    EXPECT_EQ(CompressionTypePB::NO_COMPRESSION, selector.current());
+}
+
+} // namespace doris::vectorized
@@ -41,7 +41,7 @@ Usage: $0 <options>
      [no option]            build all components
      --fe                   build Frontend and Spark DPP application. Default ON.
      --be                   build Backend. Default ON.
-     --meta-tool            build Backend meta tool. Default OFF.
+     --meta-tool            build Backend meta tool and rpc replay tool. Default OFF.
      --broker               build Broker. Default ON.
      --audit                build audit loader. Default ON.
      --spark-dpp            build Spark DPP application. Default ON.
@@ -630,6 +630,7 @@ EOF
 
     if [[ "${BUILD_META_TOOL}" = "ON" ]]; then
         cp -r -p "${DORIS_HOME}/be/output/lib/meta_tool" "${DORIS_OUTPUT}/be/lib"/
+        cp -r -p "${DORIS_HOME}/be/output/lib/rpc_replay_tool" "${DORIS_OUTPUT}/be/lib"/
     fi
 
     cp -r -p "${DORIS_HOME}/webroot/be"/* "${DORIS_OUTPUT}/be/www"/
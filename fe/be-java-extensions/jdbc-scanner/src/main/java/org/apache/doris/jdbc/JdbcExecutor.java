@@ -156,6 +156,26 @@ public class JdbcExecutor {
         }
     }
 
+    // Returns the min and the max selected by the statement, or null if they are null.
+    public long[] getSplitBounds() throws UdfRuntimeException {
+        try (ResultSet rs = ((PreparedStatement) stmt).executeQuery()) {
+            if (!rs.next()) {
+                return null;
+            }
+            long min = rs.getLong(1);
+            if (rs.wasNull()) {
+                return null;
+            }
+            long max = rs.getLong(2);
+            if (rs.wasNull()) {
+                return null;
+            }
+            return new long[] {min, max};
+        } catch (SQLException e) {
+            throw new UdfRuntimeException("JDBC executor get split bounds has error: ", e);
+        }
+    }
+
     public int write(String sql) throws UdfRuntimeException {
         try {
             return stmt.executeUpdate(sql);
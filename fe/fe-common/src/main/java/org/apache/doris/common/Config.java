@@ -1299,6 +1299,13 @@ public class Config extends ConfigBase {
     @ConfField(mutable = true, masterOnly = true)
     public static int max_backup_restore_job_num_per_db = 10;
 
+    /**
+     * Whether a backup copies the rowset files already in the last backup of the db to the same repository
+     * on the remote storage, instead of uploading them again from the backends.
+     */
+    @ConfField(mutable = true, masterOnly = true)
+    public static boolean enable_incremental_backup_upload = true;
+
     /**
      * Control the default max num of the instance for a user.
      */
@@ -238,8 +238,8 @@ public class CreateFunctionStmt extends DdlStmt {
         if (binaryType == null) {
             throw new AnalysisException("unknown function type");
         }
-        if (type.equals("NATIVE")) {
-            throw new AnalysisException("do not support 'NATIVE' udf type after doris version 1.2.0,"
+        if (type.equals("NATIVE") && isAggregate) {
+            throw new AnalysisException("'NATIVE' udf type only supports scalar function,"
                                     + "please use JAVA_UDF or RPC instead");
         }
 
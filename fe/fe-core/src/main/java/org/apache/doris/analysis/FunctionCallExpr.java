@@ -973,17 +973,19 @@ public class FunctionCallExpr extends Expr {
             }
         }
 
-        if (fnName.getFunction().equalsIgnoreCase("percentile_approx")) {
+        if (fnName.getFunction().equalsIgnoreCase("percentile_approx")
+                || fnName.getFunction().equalsIgnoreCase("percentile_ddsketch")) {
+            String fn = fnName.getFunction().toLowerCase();
             if (children.size() != 2 && children.size() != 3) {
-                throw new AnalysisException("percentile_approx(expr, DOUBLE [, B]) requires two or three parameters");
+                throw new AnalysisException(fn + "(expr, DOUBLE [, B]) requires two or three parameters");
             }
             if (!getChild(1).isConstant()) {
-                throw new AnalysisException("percentile_approx requires second parameter must be a constant : "
+                throw new AnalysisException(fn + " requires second parameter must be a constant : "
                         + this.toSql());
             }
             if (children.size() == 3) {
                 if (!getChild(2).isConstant()) {
-                    throw new AnalysisException("percentile_approx requires the third parameter must be a constant : "
+                    throw new AnalysisException(fn + " requires the third parameter must be a constant : "
                             + this.toSql());
                 }
             }
@@ -67,7 +67,10 @@ public enum SchemaTableType {
     SCH_VIEWS("VIEWS", "VIEWS", TSchemaTableType.SCH_VIEWS),
     SCH_CREATE_TABLE("CREATE_TABLE", "CREATE_TABLE", TSchemaTableType.SCH_CREATE_TABLE),
     SCH_INVALID("NULL", "NULL", TSchemaTableType.SCH_INVALID),
-    SCH_ROWSETS("ROWSETS", "ROWSETS", TSchemaTableType.SCH_ROWSETS);
+    SCH_ROWSETS("ROWSETS", "ROWSETS", TSchemaTableType.SCH_ROWSETS),
+    SCH_COMPACTION_HISTORY("COMPACTION_HISTORY", "COMPACTION_HISTORY",
+            TSchemaTableType.SCH_COMPACTION_HISTORY),
+    SCH_LOAD_CHANNELS("LOAD_CHANNELS", "LOAD_CHANNELS", TSchemaTableType.SCH_LOAD_CHANNELS);
 
     private static final String dbName = "INFORMATION_SCHEMA";
     private static SelectList fullSelectLists;
@@ -2586,7 +2586,8 @@ public class SelectStmt extends QueryStmt {
         if (eqPredicates == null) {
             return false;
         }
-        if (!olapTable.getEnableUniqueKeyMergeOnWrite() || !olapTable.storeRowColumn()) {
+        // The tables without row store read the output columns from their column pages in BE
+        if (!olapTable.getEnableUniqueKeyMergeOnWrite()) {
             return false;
         }
         // check if PK columns are fully matched with predicate
@@ -74,6 +74,7 @@ import java.nio.file.Path;
 import java.nio.file.Paths;
 import java.util.Deque;
 import java.util.HashMap;
+import java.util.Iterator;
 import java.util.LinkedList;
 import java.util.List;
 import java.util.Map;
@@ -490,6 +491,26 @@ public class BackupHandler extends MasterDaemon implements Writable {
         }
     }
 
+    // The label of the last finished backup of the db to the repository, the base of the incremental upload of
+    // the next backup.
+    public String getLastFinishedBackupLabel(long dbId, long repoId) {
+        jobLock.lock();
+        try {
+            Iterator<AbstractJob> iter = dbIdToBackupOrRestoreJobs.getOrDefault(dbId, new LinkedList<>())
+                    .descendingIterator();
+            while (iter.hasNext()) {
+                AbstractJob job = iter.next();
+                if (job instanceof BackupJob && job.getRepoId() == repoId
+                        && ((BackupJob) job).getState() == BackupJobState.FINISHED) {
+                    return job.getLabel();
+                }
+            }
+            return null;
+        } finally {
+            jobLock.unlock();
+        }
+    }
+
     private List<AbstractJob> getAllCurrentJobs() {
         jobLock.lock();
         try {
@@ -35,6 +35,7 @@ import org.apache.doris.catalog.Table;
 import org.apache.doris.catalog.TableIf.TableType;
 import org.apache.doris.catalog.Tablet;
 import org.apache.doris.catalog.View;
+import org.apache.doris.common.Config;
 import org.apache.doris.common.io.Text;
 import org.apache.doris.common.util.TimeUtils;
 import org.apache.doris.task.AgentBatchTask;
@@ -584,6 +585,10 @@ public class BackupJob extends AbstractJob {
             beToSnapshots.put(info.getBeId(), info);
         }
 
+        // The rowset files already in the last backup to the repository are copied remotely by the backends.
+        String baseLabel = Config.enable_incremental_backup_upload
+                ? env.getBackupHandler().getLastFinishedBackupLabel(dbId, repoId) : null;
+
         AgentBatchTask batchTask = new AgentBatchTask();
         for (Long beId : beToSnapshots.keySet()) {
             List<SnapshotInfo> infos = beToSnapshots.get(beId);
@@ -606,6 +611,7 @@ public class BackupJob extends AbstractJob {
             int index = 0;
             for (int batch = 0; batch < batchNum; batch++) {
                 Map<String, String> srcToDest = Maps.newHashMap();
+                Map<String, String> srcToBase = Maps.newHashMap();
                 int currentBatchTaskNum = (batch == batchNum - 1) ? totalNum - index : taskNumPerBatch;
                 for (int j = 0; j < currentBatchTaskNum; j++) {
                     SnapshotInfo info = infos.get(index++);
@@ -616,11 +622,18 @@ public class BackupJob extends AbstractJob {
                         return;
                     }
                     srcToDest.put(src, dest);
+                    if (baseLabel != null) {
+                        String base = repo.getRepoTabletPathBySnapshotInfo(baseLabel, info);
+                        if (base != null) {
+                            srcToBase.put(src, base);
+                        }
+                    }
                 }
                 long signature = env.getNextId();
                 UploadTask task = new UploadTask(null, beId, signature, jobId, dbId, srcToDest,
                         brokers.get(0), repo.getRemoteFileSystem().getProperties(),
                         repo.getRemoteFileSystem().getStorageType(), repo.getLocation());
+                task.setSrcToBasePath(srcToBase);
                 LOG.info("yy debug upload location: " + repo.getLocation());
                 batchTask.addTask(task);
                 unfinishedTaskIds.put(signature, beId);
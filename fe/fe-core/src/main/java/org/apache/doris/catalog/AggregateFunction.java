@@ -57,7 +57,8 @@ public class AggregateFunction extends Function {
             FunctionSet.SEQUENCE_MATCH, FunctionSet.SEQUENCE_COUNT);
 
     public static ImmutableSet<String> ALWAYS_NULLABLE_AGGREGATE_FUNCTION_NAME_SET =
-            ImmutableSet.of("stddev_samp", "variance_samp", "var_samp", "percentile_approx");
+            ImmutableSet.of("stddev_samp", "variance_samp", "var_samp", "percentile_approx",
+                    "percentile_ddsketch");
 
     public static ImmutableSet<String> CUSTOM_AGGREGATE_FUNCTION_NAME_SET =
             ImmutableSet.of("group_concat");
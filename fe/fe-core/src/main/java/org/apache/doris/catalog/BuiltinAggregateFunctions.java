@@ -47,6 +47,7 @@ import org.apache.doris.nereids.trees.expressions.functions.agg.OrthogonalBitmap
 import org.apache.doris.nereids.trees.expressions.functions.agg.Percentile;
 import org.apache.doris.nereids.trees.expressions.functions.agg.PercentileApprox;
 import org.apache.doris.nereids.trees.expressions.functions.agg.PercentileArray;
+import org.apache.doris.nereids.trees.expressions.functions.agg.PercentileDDSketch;
 import org.apache.doris.nereids.trees.expressions.functions.agg.QuantileUnion;
 import org.apache.doris.nereids.trees.expressions.functions.agg.Retention;
 import org.apache.doris.nereids.trees.expressions.functions.agg.SequenceCount;
@@ -105,6 +106,7 @@ public class BuiltinAggregateFunctions implements FunctionHelper {
             agg(Percentile.class, "percentile"),
             agg(PercentileApprox.class, "percentile_approx"),
             agg(PercentileArray.class, "percentile_array"),
+            agg(PercentileDDSketch.class, "percentile_ddsketch"),
             agg(QuantileUnion.class, "quantile_union"),
             agg(Retention.class, "retention"),
             agg(SequenceCount.class, "sequence_count"),
@@ -2054,6 +2054,16 @@ public class FunctionSet<T> {
                 "", "", "", "", "",
                 false, true, false, true));
 
+        addBuiltin(AggregateFunction.createBuiltin("percentile_ddsketch",
+                Lists.<Type>newArrayList(Type.DOUBLE, Type.DOUBLE), Type.DOUBLE, Type.VARCHAR,
+                "", "", "", "", "",
+                false, true, false, true));
+
+        addBuiltin(AggregateFunction.createBuiltin("percentile_ddsketch",
+                Lists.<Type>newArrayList(Type.DOUBLE, Type.DOUBLE, Type.DOUBLE), Type.DOUBLE, Type.VARCHAR,
+                "", "", "", "", "",
+                false, true, false, true));
+
         // collect_list
         for (Type t : Type.getArraySubTypes()) {
             addBuiltin(AggregateFunction.createBuiltin(COLLECT_LIST, Lists.newArrayList(t), new ArrayType(t), t,
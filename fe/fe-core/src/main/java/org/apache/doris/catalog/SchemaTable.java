@@ -392,6 +392,53 @@ public class SchemaTable extends Table {
                                     .column("CREATION_TIME", ScalarType.createType(PrimitiveType.BIGINT))
                                     .column("NEWEST_WRITE_TIMESTAMP", ScalarType.createType(PrimitiveType.BIGINT))
                                     .build()))
+            .put("compaction_history", new SchemaTable(SystemIdGenerator.getNextId(), "compaction_history",
+                            TableType.SCHEMA,
+                            builder().column("BACKEND_ID", ScalarType.createType(PrimitiveType.BIGINT))
+                                    .column("TABLET_ID", ScalarType.createType(PrimitiveType.BIGINT))
+                                    .column("DATA_DIR", ScalarType.createVarchar(256))
+                                    .column("COMPACTION_TYPE", ScalarType.createVarchar(64))
+                                    .column("STATUS", ScalarType.createVarchar(1024))
+                                    .column("QUEUE_DEPTH", ScalarType.createType(PrimitiveType.BIGINT))
+                                    .column("START_TIME", ScalarType.createType(PrimitiveType.BIGINT))
+                                    .column("END_TIME", ScalarType.createType(PrimitiveType.BIGINT))
+                                    .column("PREPARE_TIME_MS", ScalarType.createType(PrimitiveType.BIGINT))
+                                    .column("MERGE_TIME_MS", ScalarType.createType(PrimitiveType.BIGINT))
+                                    .column("BUILD_TIME_MS", ScalarType.createType(PrimitiveType.BIGINT))
+                                    .column("MODIFY_TIME_MS", ScalarType.createType(PrimitiveType.BIGINT))
+                                    .column("INPUT_ROWSETS", ScalarType.createType(PrimitiveType.BIGINT))
+                                    .column("INPUT_SEGMENTS", ScalarType.createType(PrimitiveType.BIGINT))
+                                    .column("INPUT_ROWS", ScalarType.createType(PrimitiveType.BIGINT))
+                                    .column("INPUT_BYTES", ScalarType.createType(PrimitiveType.BIGINT))
+                                    .column("INPUT_LOADED_BYTES", ScalarType.createType(PrimitiveType.BIGINT))
+                                    .column("OUTPUT_ROWS", ScalarType.createType(PrimitiveType.BIGINT))
+                                    .column("OUTPUT_BYTES", ScalarType.createType(PrimitiveType.BIGINT))
+                                    .column("MERGED_ROWS", ScalarType.createType(PrimitiveType.BIGINT))
+                                    .column("FILTERED_ROWS", ScalarType.createType(PrimitiveType.BIGINT))
+                                    .column("WRITE_AMPLIFICATION", ScalarType.createType(PrimitiveType.DOUBLE))
+                                    .build()))
+            .put("load_channels", new SchemaTable(SystemIdGenerator.getNextId(), "load_channels",
+                            TableType.SCHEMA,
+                            builder().column("BACKEND_ID", ScalarType.createType(PrimitiveType.BIGINT))
+                                    .column("LOAD_ID", ScalarType.createVarchar(64))
+                                    .column("SENDER_IP", ScalarType.createVarchar(64))
+                                    .column("IS_HIGH_PRIORITY", ScalarType.createType(PrimitiveType.BOOLEAN))
+                                    .column("TIMEOUT_S", ScalarType.createType(PrimitiveType.BIGINT))
+                                    .column("LAST_UPDATED_TIME", ScalarType.createType(PrimitiveType.BIGINT))
+                                    .column("MEM_CONSUMPTION", ScalarType.createType(PrimitiveType.BIGINT))
+                                    .column("WRITE_MEM_CONSUMPTION", ScalarType.createType(PrimitiveType.BIGINT))
+                                    .column("NUM_INDEXES", ScalarType.createType(PrimitiveType.BIGINT))
+                                    .column("NUM_TABLETS", ScalarType.createType(PrimitiveType.BIGINT))
+                                    .column("FLUSH_RUNNING", ScalarType.createType(PrimitiveType.BIGINT))
+                                    .column("FLUSH_FINISHED", ScalarType.createType(PrimitiveType.BIGINT))
+                                    .column("FLUSH_BYTES", ScalarType.createType(PrimitiveType.BIGINT))
+                                    .column("FLUSH_DISK_BYTES", ScalarType.createType(PrimitiveType.BIGINT))
+                                    .column("FLUSH_TIME_MS", ScalarType.createType(PrimitiveType.BIGINT))
+                                    .column("FLUSH_WAIT_TIME_MS", ScalarType.createType(PrimitiveType.BIGINT))
+                                    .column("FLUSH_LATENCY_P50_MS", ScalarType.createType(PrimitiveType.BIGINT))
+                                    .column("FLUSH_LATENCY_P99_MS", ScalarType.createType(PrimitiveType.BIGINT))
+                                    .column("FLUSH_LATENCY_HISTOGRAM", ScalarType.createVarchar(1024))
+                                    .build()))
             .build();
 
     protected SchemaTable(long id, String name, TableType type, List<Column> baseSchema) {
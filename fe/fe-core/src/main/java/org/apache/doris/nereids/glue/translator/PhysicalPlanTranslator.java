@@ -156,6 +156,7 @@ import org.apache.doris.planner.SetOperationNode;
 import org.apache.doris.planner.SortNode;
 import org.apache.doris.planner.TableFunctionNode;
 import org.apache.doris.planner.UnionNode;
+import org.apache.doris.planner.external.FileQueryScanNode;
 import org.apache.doris.planner.external.HiveScanNode;
 import org.apache.doris.planner.external.hudi.HudiScanNode;
 import org.apache.doris.planner.external.iceberg.IcebergScanNode;
@@ -1066,9 +1067,13 @@ public class PhysicalPlanTranslator extends DefaultPlanVisitor<PlanFragment, Pla
             if (topN.getMutableState(PhysicalTopN.TOPN_RUNTIME_FILTER).isPresent()) {
                 sortNode.setUseTopnOpt(true);
                 PlanNode child = sortNode.getChild(0);
-                Preconditions.checkArgument(child instanceof OlapScanNode,
-                        "topN opt expect OlapScanNode, but we get " + child);
-                ((OlapScanNode) child).setUseTopnOpt(true);
+                Preconditions.checkArgument(child instanceof OlapScanNode || child instanceof FileQueryScanNode,
+                        "topN opt expect OlapScanNode or FileQueryScanNode, but we get " + child);
+                if (child instanceof OlapScanNode) {
+                    ((OlapScanNode) child).setUseTopnOpt(true);
+                } else {
+                    ((FileQueryScanNode) child).setUseTopnOpt(true);
+                }
             }
             addPlanRoot(currentFragment, sortNode, topN);
         } else {
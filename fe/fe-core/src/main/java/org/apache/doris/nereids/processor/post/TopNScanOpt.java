@@ -23,6 +23,7 @@ import org.apache.doris.nereids.trees.plans.Plan;
 import org.apache.doris.nereids.trees.plans.SortPhase;
 import org.apache.doris.nereids.trees.plans.algebra.Filter;
 import org.apache.doris.nereids.trees.plans.algebra.Project;
+import org.apache.doris.nereids.trees.plans.physical.PhysicalFileScan;
 import org.apache.doris.nereids.trees.plans.physical.PhysicalOlapScan;
 import org.apache.doris.nereids.trees.plans.physical.PhysicalTopN;
 import org.apache.doris.qe.ConnectContext;
@@ -72,6 +73,11 @@ public class TopNScanOpt extends PlanPostProcessor {
         while (child instanceof Project || child instanceof Filter) {
             child = child.child(0);
         }
+        if (child instanceof PhysicalFileScan) {
+            // the file scan prunes the row groups or stripes by the boundary of the topn
+            topN.setMutableState(PhysicalTopN.TOPN_RUNTIME_FILTER, true);
+            return topN;
+        }
         if (!(child instanceof PhysicalOlapScan)) {
             return topN;
         }
@@ -52,6 +52,7 @@ import org.apache.doris.nereids.trees.expressions.functions.agg.OrthogonalBitmap
 import org.apache.doris.nereids.trees.expressions.functions.agg.Percentile;
 import org.apache.doris.nereids.trees.expressions.functions.agg.PercentileApprox;
 import org.apache.doris.nereids.trees.expressions.functions.agg.PercentileArray;
+import org.apache.doris.nereids.trees.expressions.functions.agg.PercentileDDSketch;
 import org.apache.doris.nereids.trees.expressions.functions.agg.QuantileUnion;
 import org.apache.doris.nereids.trees.expressions.functions.agg.Retention;
 import org.apache.doris.nereids.trees.expressions.functions.agg.SequenceCount;
@@ -209,6 +210,10 @@ public interface AggregateFunctionVisitor<R, C> {
         return visitAggregateFunction(percentileArray, context);
     }
 
+    default R visitPercentileDDSketch(PercentileDDSketch percentileDDSketch, C context) {
+        return visitAggregateFunction(percentileDDSketch, context);
+    }
+
     default R visitQuantileUnion(QuantileUnion quantileUnion, C context) {
         return visitAggregateFunction(quantileUnion, context);
     }
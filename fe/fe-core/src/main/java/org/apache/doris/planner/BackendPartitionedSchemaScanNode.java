@@ -52,9 +52,12 @@ import java.util.Map;
  */
 public class BackendPartitionedSchemaScanNode extends SchemaScanNode {
     public static final String ROWSETS = "rowsets";
+    public static final String COMPACTION_HISTORY = "compaction_history";
+    public static final String LOAD_CHANNELS = "load_channels";
 
     public static boolean isBackendPartitionedSchemaTable(String tableName) {
-        if (tableName.equalsIgnoreCase(ROWSETS)) {
+        if (tableName.equalsIgnoreCase(ROWSETS) || tableName.equalsIgnoreCase(COMPACTION_HISTORY)
+                || tableName.equalsIgnoreCase(LOAD_CHANNELS)) {
             return true;
         }
         return false;
@@ -37,6 +37,7 @@ import org.apache.doris.common.Config;
 import org.apache.doris.common.UserException;
 import org.apache.doris.nereids.glue.translator.PlanTranslatorContext;
 import org.apache.doris.planner.external.ExternalScanNode;
+import org.apache.doris.qe.ConnectContext;
 import org.apache.doris.statistics.StatisticalType;
 import org.apache.doris.statistics.StatsRecursiveDerive;
 import org.apache.doris.statistics.query.StatsDelta;
@@ -59,6 +60,9 @@ import java.util.Set;
 public class JdbcScanNode extends ExternalScanNode {
     private static final Logger LOG = LogManager.getLogger(JdbcScanNode.class);
 
+    // The filter of the split query that BE replaces with the range of the split column of a scanner.
+    private static final String SPLIT_CONDITIONS = "$SPLIT_CONDITIONS";
+
     private final List<String> columns = new ArrayList<String>();
     private final List<String> filters = new ArrayList<String>();
     private String tableName;
@@ -158,7 +162,46 @@ public class JdbcScanNode extends ExternalScanNode {
         return limit != -1 && conjuncts.isEmpty();
     }
 
+    /**
+     * The column to split the scan into jdbc_scan_split_num scans by its range, which is the first column of the
+     * table if it is an integer, usually its primary key. BE gets the range by the min and the max of the column.
+     */
+    private Column getSplitColumn() {
+        ConnectContext context = ConnectContext.get();
+        if (context == null || context.getSessionVariable().getJdbcScanSplitNum() <= 1) {
+            return null;
+        }
+        if (isNebula() || shouldPushDownLimit()) {
+            return null;
+        }
+        if (jdbcType != TOdbcTableType.MYSQL && jdbcType != TOdbcTableType.POSTGRESQL
+                && jdbcType != TOdbcTableType.OCEANBASE) {
+            return null;
+        }
+        List<Column> schema = desc.getTable().getBaseSchema();
+        if (schema.isEmpty() || !schema.get(0).getType().isIntegerType()) {
+            return null;
+        }
+        return schema.get(0);
+    }
+
+    private String getSplitBoundsQueryStr(String splitColumn) {
+        StringBuilder sql = new StringBuilder("SELECT ");
+        sql.append("MIN(").append(splitColumn).append("), MAX(").append(splitColumn).append(")");
+        sql.append(" FROM ").append(tableName);
+        if (!filters.isEmpty()) {
+            sql.append(" WHERE (");
+            sql.append(Joiner.on(") AND (").join(filters));
+            sql.append(")");
+        }
+        return sql.toString();
+    }
+
     private String getJdbcQueryStr() {
+        return getJdbcQueryStr(null);
+    }
+
+    private String getJdbcQueryStr(String splitConditions) {
         if (isNebula()) {
             return graphQueryString;
         }
@@ -178,9 +221,14 @@ public class JdbcScanNode extends ExternalScanNode {
         sql.append(Joiner.on(", ").join(columns));
         sql.append(" FROM ").append(tableName);
 
-        if (!filters.isEmpty()) {
+        List<String> queryFilters = filters;
+        if (splitConditions != null) {
+            queryFilters = Lists.newArrayList(filters);
+            queryFilters.add(splitConditions);
+        }
+        if (!queryFilters.isEmpty()) {
             sql.append(" WHERE (");
-            sql.append(Joiner.on(") AND (").join(filters));
+            sql.append(Joiner.on(") AND (").join(queryFilters));
             sql.append(")");
         }
 
@@ -207,6 +255,11 @@ public class JdbcScanNode extends ExternalScanNode {
             return output.toString();
         }
         output.append(prefix).append("QUERY: ").append(getJdbcQueryStr()).append("\n");
+        Column splitColumn = getSplitColumn();
+        if (splitColumn != null) {
+            output.append(prefix).append("SPLIT: ").append(splitColumn.getName()).append(", ")
+                    .append(ConnectContext.get().getSessionVariable().getJdbcScanSplitNum()).append("\n");
+        }
         return output.toString();
     }
 
@@ -254,6 +307,14 @@ public class JdbcScanNode extends ExternalScanNode {
         msg.jdbc_scan_node.setTableName(tableName);
         msg.jdbc_scan_node.setQueryString(getJdbcQueryStr());
         msg.jdbc_scan_node.setTableType(jdbcType);
+        Column splitColumn = getSplitColumn();
+        if (splitColumn != null) {
+            String splitColumnName = JdbcTable.databaseProperName(jdbcType, splitColumn.getName());
+            msg.jdbc_scan_node.setSplitColumn(splitColumnName);
+            msg.jdbc_scan_node.setSplitNum(ConnectContext.get().getSessionVariable().getJdbcScanSplitNum());
+            msg.jdbc_scan_node.setSplitBoundsQuery(getSplitBoundsQueryStr(splitColumnName));
+            msg.jdbc_scan_node.setSplitQueryString(getJdbcQueryStr(SPLIT_CONDITIONS));
+        }
     }
 
     @Override
@@ -50,7 +50,10 @@ import org.apache.doris.catalog.Partition;
 import org.apache.doris.catalog.Partition.PartitionState;
 import org.apache.doris.catalog.PartitionInfo;
 import org.apache.doris.catalog.PartitionItem;
+import org.apache.doris.catalog.PartitionKey;
 import org.apache.doris.catalog.PartitionType;
+import org.apache.doris.catalog.PrimitiveType;
+import org.apache.doris.catalog.RangePartitionItem;
 import org.apache.doris.catalog.Replica;
 import org.apache.doris.catalog.ScalarType;
 import org.apache.doris.catalog.Tablet;
@@ -70,6 +73,7 @@ import org.apache.doris.statistics.query.StatsDelta;
 import org.apache.doris.system.Backend;
 import org.apache.doris.thrift.TColumn;
 import org.apache.doris.thrift.TExplainLevel;
+import org.apache.doris.thrift.TKeyRange;
 import org.apache.doris.thrift.TNetworkAddress;
 import org.apache.doris.thrift.TOlapScanNode;
 import org.apache.doris.thrift.TOlapTableIndex;
@@ -90,6 +94,7 @@ import com.google.common.base.Preconditions;
 import com.google.common.collect.ArrayListMultimap;
 import com.google.common.collect.Lists;
 import com.google.common.collect.Maps;
+import com.google.common.collect.Range;
 import com.google.common.collect.Sets;
 import org.apache.logging.log4j.LogManager;
 import org.apache.logging.log4j.Logger;
@@ -704,10 +709,35 @@ public class OlapScanNode extends ScanNode {
         }
     }
 
+    // The range [begin_key, end_key) of a single integer range partition column, so BE could skip the
+    // tablets of the partitions that the runtime filters on the partition column do not match.
+    private List<TKeyRange> getPartitionColumnRanges(Partition partition) {
+        PartitionInfo partitionInfo = olapTable.getPartitionInfo();
+        if (partitionInfo.getType() != PartitionType.RANGE || partitionInfo.getPartitionColumns().size() != 1) {
+            return null;
+        }
+        Column column = partitionInfo.getPartitionColumns().get(0);
+        PrimitiveType type = column.getDataType();
+        if (!type.isFixedPointType() || type == PrimitiveType.LARGEINT) {
+            return null;
+        }
+        PartitionItem item = partitionInfo.getItem(partition.getId());
+        if (!(item instanceof RangePartitionItem)) {
+            return null;
+        }
+        Range<PartitionKey> range = ((RangePartitionItem) item).getItems();
+        PartitionKey lower = range.lowerEndpoint();
+        PartitionKey upper = range.upperEndpoint();
+        long beginKey = lower.isMinValue() ? Long.MIN_VALUE : lower.getKeys().get(0).getLongValue();
+        long endKey = upper.isMaxValue() ? Long.MAX_VALUE : upper.getKeys().get(0).getLongValue();
+        return Lists.newArrayList(new TKeyRange(beginKey, endKey, type.toThrift(), column.getName()));
+    }
+
     private void addScanRangeLocations(Partition partition,
             List<Tablet> tablets) throws UserException {
         long visibleVersion = partition.getVisibleVersion();
         String visibleVersionStr = String.valueOf(visibleVersion);
+        List<TKeyRange> partitionColumnRanges = getPartitionColumnRanges(partition);
 
         Set<Tag> allowedTags = Sets.newHashSet();
         boolean needCheckTags = false;
@@ -738,6 +768,9 @@ public class OlapScanNode extends ScanNode {
             paloRange.setVersion(visibleVersionStr);
             paloRange.setVersionHash("");
             paloRange.setTabletId(tabletId);
+            if (partitionColumnRanges != null) {
+                paloRange.setPartitionColumnRanges(partitionColumnRanges);
+            }
 
             // random shuffle List && only collect one copy
             List<Replica> replicas = tablet.getQueryableReplicas(visibleVersion);
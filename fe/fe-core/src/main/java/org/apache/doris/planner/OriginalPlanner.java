@@ -49,6 +49,7 @@ import org.apache.doris.common.UserException;
 import org.apache.doris.common.util.VectorizedUtil;
 import org.apache.doris.datasource.InternalCatalog;
 import org.apache.doris.mysql.privilege.PrivPredicate;
+import org.apache.doris.planner.external.FileQueryScanNode;
 import org.apache.doris.qe.ConnectContext;
 import org.apache.doris.rewrite.mvrewrite.MVSelectFailedException;
 import org.apache.doris.statistics.query.StatsDelta;
@@ -594,7 +595,7 @@ public class OriginalPlanner extends Planner {
     /**
      * optimize for topn query like: SELECT * FROM t1 WHERE a>100 ORDER BY b,c LIMIT 100
      * the pre-requirement is as follows:
-     * 1. only contains SortNode + OlapScanNode
+     * 1. only contains SortNode + OlapScanNode or SortNode + FileQueryScanNode
      * 2. limit > 0
      * 3. first expression of order by is a table column
      */
@@ -602,23 +603,35 @@ public class OriginalPlanner extends Planner {
         if (node instanceof SortNode && node.getChildren().size() == 1) {
             SortNode sortNode = (SortNode) node;
             PlanNode child = sortNode.getChild(0);
-            if (child instanceof OlapScanNode && sortNode.getLimit() > 0
-                    && ConnectContext.get() != null && ConnectContext.get().getSessionVariable() != null
-                    && sortNode.getLimit() <= ConnectContext.get().getSessionVariable().topnOptLimitThreshold
-                    && sortNode.getSortInfo().getOrigOrderingExprs().size() > 0) {
-                Expr firstSortExpr = sortNode.getSortInfo().getOrigOrderingExprs().get(0);
-                if (firstSortExpr instanceof SlotRef && !firstSortExpr.getType().isStringType()
-                        && !firstSortExpr.getType().isFloatingPointType()) {
-                    OlapScanNode scanNode = (OlapScanNode) child;
-                    if (scanNode.isDupKeysOrMergeOnWrite()) {
-                        sortNode.setUseTopnOpt(true);
-                        scanNode.setUseTopnOpt(true);
-                    }
+            if (!isTopnOptCandidate(sortNode)) {
+                return;
+            }
+            if (child instanceof OlapScanNode) {
+                OlapScanNode scanNode = (OlapScanNode) child;
+                if (scanNode.isDupKeysOrMergeOnWrite()) {
+                    sortNode.setUseTopnOpt(true);
+                    scanNode.setUseTopnOpt(true);
                 }
+            } else if (child instanceof FileQueryScanNode) {
+                // the file scan prunes the row groups or stripes by the boundary of the topn
+                sortNode.setUseTopnOpt(true);
+                ((FileQueryScanNode) child).setUseTopnOpt(true);
             }
         }
     }
 
+    private boolean isTopnOptCandidate(SortNode sortNode) {
+        if (sortNode.getLimit() <= 0 || ConnectContext.get() == null
+                || ConnectContext.get().getSessionVariable() == null
+                || sortNode.getLimit() > ConnectContext.get().getSessionVariable().topnOptLimitThreshold
+                || sortNode.getSortInfo().getOrigOrderingExprs().isEmpty()) {
+            return false;
+        }
+        Expr firstSortExpr = sortNode.getSortInfo().getOrigOrderingExprs().get(0);
+        return firstSortExpr instanceof SlotRef && !firstSortExpr.getType().isStringType()
+                && !firstSortExpr.getType().isFloatingPointType();
+    }
+
     /**
      * Construct a tuple for file status, the tuple schema as following:
      * | FileNumber | Int     |
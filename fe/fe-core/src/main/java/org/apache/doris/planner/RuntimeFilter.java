@@ -22,6 +22,7 @@ import org.apache.doris.analysis.BinaryPredicate;
 import org.apache.doris.analysis.BitmapFilterPredicate;
 import org.apache.doris.analysis.CastExpr;
 import org.apache.doris.analysis.Expr;
+import org.apache.doris.analysis.FunctionCallExpr;
 import org.apache.doris.analysis.Predicate;
 import org.apache.doris.analysis.SlotId;
 import org.apache.doris.analysis.SlotRef;
@@ -34,11 +35,14 @@ import org.apache.doris.common.FeConstants;
 import org.apache.doris.common.IdGenerator;
 import org.apache.doris.qe.ConnectContext;
 import org.apache.doris.qe.SessionVariable;
+import org.apache.doris.thrift.TPaloScanRange;
 import org.apache.doris.thrift.TRuntimeFilterDesc;
 import org.apache.doris.thrift.TRuntimeFilterType;
+import org.apache.doris.thrift.TScanRangeLocations;
 
 import com.google.common.base.Joiner;
 import com.google.common.base.Preconditions;
+import org.apache.commons.codec.digest.DigestUtils;
 import org.apache.logging.log4j.LogManager;
 import org.apache.logging.log4j.Logger;
 
@@ -49,6 +53,7 @@ import java.util.HashSet;
 import java.util.Iterator;
 import java.util.List;
 import java.util.Map;
+import java.util.stream.Collectors;
 
 /**
  * Representation of a runtime filter. A runtime filter is generated from
@@ -222,9 +227,68 @@ public final class RuntimeFilter {
             tFilter.setBitmapFilterNotIn(bitmapFilterNotIn);
         }
         tFilter.setOptRemoteRf(optRemoteRf);
+        String cacheKey = computeCacheKey();
+        if (cacheKey != null) {
+            tFilter.setCacheKey(cacheKey);
+        }
         return tFilter;
     }
 
+    /**
+     * Fingerprint of the build side, so that BE could share the filter across the queries whose
+     * build side scans the same tablets of the same versions with the same predicates.
+     * Only a broadcast join with local targets only, whose build side is a plain olap scan, gets
+     * a key: every instance of such a join builds the filter from the whole build side by itself.
+     * Returns null if the filter can not be cached.
+     */
+    private String computeCacheKey() {
+        if (!isBroadcastJoin || !hasLocalTargets || hasRemoteTargets || builderNode.getChildren().size() < 2) {
+            return null;
+        }
+        PlanNode buildNode = builderNode.getChild(1);
+        if (buildNode instanceof ExchangeNode) {
+            buildNode = buildNode.getChild(0);
+        }
+        if (!(buildNode instanceof OlapScanNode)) {
+            return null;
+        }
+        OlapScanNode scanNode = (OlapScanNode) buildNode;
+        // The build side may be reduced by the runtime filters of other joins, and the function calls
+        // in the predicates may not be deterministic, both make the filter depend on the query.
+        if (scanNode.hasLimit() || !scanNode.getRuntimeFilters().isEmpty()) {
+            return null;
+        }
+        for (Expr conjunct : scanNode.getConjuncts()) {
+            if (conjunct.contains(FunctionCallExpr.class)) {
+                return null;
+            }
+        }
+        List<TScanRangeLocations> locations = scanNode.getScanRangeLocations(0);
+        if (locations == null || locations.isEmpty()) {
+            return null;
+        }
+
+        StringBuilder sb = new StringBuilder();
+        sb.append(scanNode.getOlapTable().getId()).append(':').append(scanNode.getSelectedIndexId());
+        List<String> tablets = new ArrayList<>();
+        for (TScanRangeLocations location : locations) {
+            TPaloScanRange range = location.getScanRange().getPaloScanRange();
+            if (range == null) {
+                return null;
+            }
+            tablets.add(range.getTabletId() + "@" + range.getVersion());
+        }
+        Collections.sort(tablets);
+        sb.append('|').append(Joiner.on(',').join(tablets));
+        sb.append('|').append(scanNode.getConjuncts().stream().map(Expr::toSql).collect(Collectors.joining(",")));
+        if (scanNode.projectList != null) {
+            sb.append('|').append(scanNode.projectList.stream().map(Expr::toSql).collect(Collectors.joining(",")));
+        }
+        sb.append('|').append(srcExpr.toSql()).append('|').append(runtimeFilterType)
+                .append('|').append(filterSizeBytes).append('|').append(bitmapFilterNotIn);
+        return DigestUtils.md5Hex(sb.toString());
+    }
+
     public List<RuntimeFilterTarget> getTargets() {
         return targets;
     }
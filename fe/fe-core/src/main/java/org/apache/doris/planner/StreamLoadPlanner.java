@@ -31,11 +31,16 @@ import org.apache.doris.catalog.Column;
 import org.apache.doris.catalog.Database;
 import org.apache.doris.catalog.Env;
 import org.apache.doris.catalog.KeysType;
+import org.apache.doris.catalog.MaterializedIndex;
+import org.apache.doris.catalog.MaterializedIndex.IndexExtState;
+import org.apache.doris.catalog.MaterializedIndexMeta;
 import org.apache.doris.catalog.OlapTable;
 import org.apache.doris.catalog.Partition;
 import org.apache.doris.catalog.PartitionInfo;
 import org.apache.doris.catalog.PartitionItem;
 import org.apache.doris.catalog.PartitionType;
+import org.apache.doris.catalog.Replica;
+import org.apache.doris.catalog.Tablet;
 import org.apache.doris.catalog.Type;
 import org.apache.doris.common.AnalysisException;
 import org.apache.doris.common.Config;
@@ -60,6 +65,7 @@ import org.apache.doris.thrift.TPlanFragmentExecParams;
 import org.apache.doris.thrift.TQueryGlobals;
 import org.apache.doris.thrift.TQueryOptions;
 import org.apache.doris.thrift.TQueryType;
+import org.apache.doris.thrift.TScanRange;
 import org.apache.doris.thrift.TScanRangeLocations;
 import org.apache.doris.thrift.TScanRangeParams;
 import org.apache.doris.thrift.TUniqueId;
@@ -281,6 +287,7 @@ public class StreamLoadPlanner {
         Map<Integer, List<TScanRangeParams>> perNodeScanRange = Maps.newHashMap();
         List<TScanRangeParams> scanRangeParams = Lists.newArrayList();
         for (TScanRangeLocations locations : scanNode.getScanRangeLocations(0)) {
+            setRowOrderInsensitive(locations.getScanRange());
             scanRangeParams.add(new TScanRangeParams(locations.getScanRange()));
         }
         // For stream load, only one sender
@@ -481,6 +488,7 @@ public class StreamLoadPlanner {
         Map<Integer, List<TScanRangeParams>> perNodeScanRange = Maps.newHashMap();
         List<TScanRangeParams> scanRangeParams = Lists.newArrayList();
         for (TScanRangeLocations locations : scanNode.getScanRangeLocations(0)) {
+            setRowOrderInsensitive(locations.getScanRange());
             scanRangeParams.add(new TScanRangeParams(locations.getScanRange()));
         }
         // For stream load, only one sender
@@ -515,6 +523,48 @@ public class StreamLoadPlanner {
         return pipParams;
     }
 
+    // The rows of a duplicate table, or of a unique table merged by the sequence column, can be
+    // written in any order, which lets the BE parse a large stream in parallel.
+    private void setRowOrderInsensitive(TScanRange scanRange) {
+        if (!scanRange.isSetExtScanRange() || !scanRange.getExtScanRange().isSetFileScanRange()
+                || !scanRange.getExtScanRange().getFileScanRange().isSetParams()) {
+            return;
+        }
+        boolean insensitive = destTable.getKeysType() == KeysType.DUP_KEYS
+                || (destTable.getKeysType() == KeysType.UNIQUE_KEYS && destTable.hasSequenceCol());
+        scanRange.getExtScanRange().getFileScanRange().getParams().setRowOrderInsensitive(insensitive);
+    }
+
+    // The signature of the metadata a load plan of the table depends on: the schemas of its indexes,
+    // including the shadow ones of a schema change, its partitions and the locations of its tablets.
+    // A BE may reuse a plan of the table whose signature is unchanged, instead of planning it again.
+    // Must be called with the read lock of the table.
+    public static long getPlanSignature(OlapTable table) {
+        long signature = table.getId();
+        signature = 31 * signature + table.getState().ordinal();
+        signature = 31 * signature + Config.be_exec_version;
+        signature = 31 * signature + (Config.enable_single_replica_load ? 1 : 0);
+        for (Map.Entry<Long, MaterializedIndexMeta> entry : table.getIndexIdToMeta().entrySet()) {
+            signature = 31 * signature + entry.getKey();
+            signature = 31 * signature + entry.getValue().getSchemaVersion();
+            signature = 31 * signature + entry.getValue().getSchemaHash();
+        }
+        for (Partition partition : table.getAllPartitions()) {
+            signature = 31 * signature + partition.getId();
+            for (MaterializedIndex index : partition.getMaterializedIndices(IndexExtState.ALL)) {
+                signature = 31 * signature + index.getId();
+                for (Tablet tablet : index.getTablets()) {
+                    signature = 31 * signature + tablet.getId();
+                    for (Replica replica : tablet.getReplicas()) {
+                        signature = 31 * signature + replica.getBackendId();
+                        signature = 31 * signature + replica.getState().ordinal();
+                    }
+                }
+            }
+        }
+        return signature;
+    }
+
     // get all specified partition ids.
     // if no partition specified, return null
     private List<Long> getAllPartitionIds() throws DdlException, AnalysisException {
@@ -67,6 +67,8 @@ public abstract class FileScanNode extends ExternalScanNode {
     protected long totalFileSize = 0;
     protected long totalPartitionNum = 0;
     protected long readPartitionNum = 0;
+    // prune the row groups or stripes by the boundary of the topn above, see SortNode.useTopnOpt
+    protected boolean useTopnOpt = false;
 
     public FileScanNode(PlanNodeId id, TupleDescriptor desc, String planNodeName, StatisticalType statisticalType,
                             boolean needCheckColumnPriv) {
@@ -79,9 +81,18 @@ public abstract class FileScanNode extends ExternalScanNode {
         planNode.setNodeType(TPlanNodeType.FILE_SCAN_NODE);
         TFileScanNode fileScanNode = new TFileScanNode();
         fileScanNode.setTupleId(desc.getId().asInt());
+        fileScanNode.setUseTopnOpt(useTopnOpt);
         planNode.setFileScanNode(fileScanNode);
     }
 
+    public boolean getUseTopnOpt() {
+        return useTopnOpt;
+    }
+
+    public void setUseTopnOpt(boolean useTopnOpt) {
+        this.useTopnOpt = useTopnOpt;
+    }
+
     @Override
     public String getNodeExplainString(String prefix, TExplainLevel detailLevel) {
         StringBuilder output = new StringBuilder();
@@ -93,6 +104,9 @@ public abstract class FileScanNode extends ExternalScanNode {
             output.append(prefix).append("runtime filters: ");
             output.append(getRuntimeFilterExplainString(false));
         }
+        if (useTopnOpt) {
+            output.append(prefix).append("TOPN OPT\n");
+        }
 
         output.append(prefix).append("inputSplitNum=").append(inputSplitsNum).append(", totalFileSize=")
             .append(totalFileSize).append(", scanRanges=").append(scanRangeLocations.size()).append("\n");
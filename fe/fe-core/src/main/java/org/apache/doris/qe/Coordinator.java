@@ -86,10 +86,12 @@ import org.apache.doris.thrift.TExternalScanRange;
 import org.apache.doris.thrift.TFileScanRange;
 import org.apache.doris.thrift.TNetworkAddress;
 import org.apache.doris.thrift.TPaloScanRange;
+import org.apache.doris.thrift.TPartitionType;
 import org.apache.doris.thrift.TPipelineFragmentParams;
 import org.apache.doris.thrift.TPipelineFragmentParamsList;
 import org.apache.doris.thrift.TPipelineInstanceParams;
 import org.apache.doris.thrift.TPipelineWorkloadGroup;
+import org.apache.doris.thrift.TPlanFragment;
 import org.apache.doris.thrift.TPlanFragmentDestination;
 import org.apache.doris.thrift.TPlanFragmentExecParams;
 import org.apache.doris.thrift.TQueryGlobals;
@@ -1625,10 +1627,26 @@ public class Coordinator {
                         params.instanceExecParams.add(instanceParam);
                     }
                 } else {
+                    Map<TNetworkAddress, Integer> hostInstanceNums = Maps.newLinkedHashMap();
                     for (FInstanceExecParam execParams
                             : fragmentExecParamsMap.get(inputFragmentId).instanceExecParams) {
                         FInstanceExecParam instanceParam = new FInstanceExecParam(null, execParams.host, 0, params);
                         params.instanceExecParams.add(instanceParam);
+                        hostInstanceNums.merge(execParams.host, 1, Integer::sum);
+                    }
+                    // The input fragment may have few instances on a host, e.g. it scans few tablets,
+                    // but a hash partitioned fragment, like the merge phase of an aggregation, is not
+                    // bound to the scan ranges. Run it on all the local cores, the rows are shuffled to
+                    // the instances by the hash of the partition exprs.
+                    if (enablePipelineEngine && exchangeInstances <= 0
+                            && fragment.getDataPartition().getType() == TPartitionType.HASH_PARTITIONED) {
+                        int localParallelism = fragment.getParallelExecNum();
+                        for (Map.Entry<TNetworkAddress, Integer> entry : hostInstanceNums.entrySet()) {
+                            for (int i = entry.getValue(); i < localParallelism; i++) {
+                                params.instanceExecParams.add(
+                                        new FInstanceExecParam(null, entry.getKey(), 0, params));
+                            }
+                        }
                     }
                 }
 
@@ -2871,12 +2889,28 @@ public class Coordinator {
          */
         public void unsetFields() {
             boolean first = true;
+            TPlanFragment prevFragment = null;
+            TQueryOptions prevQueryOptions = null;
             for (BackendExecState state : states) {
+                TPlanFragment fragment = state.rpcParams.getFragment();
+                TQueryOptions queryOptions = state.rpcParams.getQueryOptions();
                 if (first) {
                     first = false;
-                    continue;
+                } else {
+                    state.unsetFields();
+                    // The instances of a fragment share the same fragment and query options,
+                    // so they are only sent with the first instance. BE copies them from the previous params.
+                    if (fragment == prevFragment) {
+                        state.rpcParams.unsetFragment();
+                        state.rpcParams.setIsDeltaParam(true);
+                    }
+                    if (queryOptions == prevQueryOptions) {
+                        state.rpcParams.unsetQueryOptions();
+                        state.rpcParams.setIsDeltaParam(true);
+                    }
                 }
-                state.unsetFields();
+                prevFragment = fragment;
+                prevQueryOptions = queryOptions;
             }
         }
 
@@ -3059,12 +3093,13 @@ public class Coordinator {
 
         List<TExecPlanFragmentParams> toThrift(int backendNum) {
             List<TExecPlanFragmentParams> paramsList = Lists.newArrayList();
+            TPlanFragment tFragment = fragment.toThrift();
 
             for (int i = 0; i < instanceExecParams.size(); ++i) {
                 final FInstanceExecParam instanceExecParam = instanceExecParams.get(i);
                 TExecPlanFragmentParams params = new TExecPlanFragmentParams();
                 params.setProtocolVersion(PaloInternalServiceVersion.V1);
-                params.setFragment(fragment.toThrift());
+                params.setFragment(tFragment);
                 params.setDescTbl(descTable);
                 params.setParams(new TPlanFragmentExecParams());
                 params.setBuildHashTableForBroadcastJoin(instanceExecParam.buildHashTableForBroadcastJoin);
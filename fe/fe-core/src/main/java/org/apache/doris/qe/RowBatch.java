@@ -20,6 +20,10 @@ package org.apache.doris.qe;
 import org.apache.doris.proto.Data.PQueryStatistics;
 import org.apache.doris.thrift.TResultBatch;
 
+import java.nio.ByteBuffer;
+import java.util.ArrayList;
+import java.util.List;
+
 public final class RowBatch {
     private TResultBatch batch;
     private PQueryStatistics statistics;
@@ -34,9 +38,26 @@ public final class RowBatch {
     }
 
     public void setBatch(TResultBatch batch) {
+        if (batch != null && batch.isSetRowsData()) {
+            unpackRows(batch);
+        }
         this.batch = batch;
     }
 
+    // The BE sends all the rows of a block in one buffer, the rows are views of it.
+    private static void unpackRows(TResultBatch batch) {
+        byte[] data = batch.getRowsData();
+        List<ByteBuffer> rows = new ArrayList<>(batch.getRowLengthsSize());
+        int offset = 0;
+        for (int length : batch.getRowLengths()) {
+            rows.add(ByteBuffer.wrap(data, offset, length));
+            offset += length;
+        }
+        batch.setRows(rows);
+        batch.unsetRowsData();
+        batch.unsetRowLengths();
+    }
+
     public PQueryStatistics getQueryStatistics() {
         return statistics;
     }
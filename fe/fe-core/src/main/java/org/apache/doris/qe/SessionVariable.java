@@ -299,6 +299,15 @@ public class SessionVariable implements Serializable, Writable {
     public static final String EXTERNAL_SORT_BYTES_THRESHOLD = "external_sort_bytes_threshold";
     public static final String EXTERNAL_AGG_BYTES_THRESHOLD = "external_agg_bytes_threshold";
     public static final String EXTERNAL_AGG_PARTITION_BITS = "external_agg_partition_bits";
+    public static final String EXTERNAL_JOIN_BYTES_THRESHOLD = "external_join_bytes_threshold";
+    public static final String EXTERNAL_JOIN_PARTITION_BITS = "external_join_partition_bits";
+    public static final String EXTERNAL_ANALYTIC_BYTES_THRESHOLD = "external_analytic_bytes_threshold";
+    public static final String EXTERNAL_SET_OPERATION_BYTES_THRESHOLD = "external_set_operation_bytes_threshold";
+    public static final String EXTERNAL_MULTI_CAST_BYTES_THRESHOLD = "external_multi_cast_bytes_threshold";
+
+    public static final String PREFERRED_BLOCK_SIZE_BYTES = "preferred_block_size_bytes";
+
+    public static final String ENABLE_OPERATOR_PERF_COUNTERS = "enable_operator_perf_counters";
 
     public static final String ENABLE_TWO_PHASE_READ_OPT = "enable_two_phase_read_opt";
     public static final String TOPN_OPT_LIMIT_THRESHOLD = "topn_opt_limit_threshold";
@@ -350,6 +359,8 @@ public class SessionVariable implements Serializable, Writable {
 
     public static final String EXTERNAL_TABLE_ANALYZE_PART_NUM = "external_table_analyze_part_num";
 
+    public static final String JDBC_SCAN_SPLIT_NUM = "jdbc_scan_split_num";
+
     public static final List<String> DEBUG_VARIABLES = ImmutableList.of(
             SKIP_DELETE_PREDICATE,
             SKIP_DELETE_BITMAP,
@@ -827,9 +838,10 @@ public class SessionVariable implements Serializable, Writable {
     @VariableMgr.VarAttr(name = PARTITIONED_HASH_JOIN_ROWS_THRESHOLD, fuzzy = true)
     public int partitionedHashJoinRowsThreshold = 0;
 
-    // Use partitioned hash join if build side row count >= the threshold . 0 - the threshold is not set.
+    // Convert the hash table of aggregation to a partitioned one if its row count >= the threshold.
+    // 0 - the threshold is not set.
     @VariableMgr.VarAttr(name = PARTITIONED_HASH_AGG_ROWS_THRESHOLD, fuzzy = true)
-    public int partitionedHashAggRowsThreshold = 0;
+    public int partitionedHashAggRowsThreshold = 1048576;
 
     @VariableMgr.VarAttr(name = PARTITION_PRUNING_EXPAND_THRESHOLD, fuzzy = true)
     public int partitionPruningExpandThreshold = 10;
@@ -865,6 +877,48 @@ public class SessionVariable implements Serializable, Writable {
             checker = "checkExternalAggPartitionBits", fuzzy = true)
     public int externalAggPartitionBits = 8; // means that the hash table will be partitioned into 256 blocks.
 
+    // Set to 0 to disable; min: 128M
+    public static final long MIN_EXTERNAL_JOIN_BYTES_THRESHOLD = 134217728;
+    @VariableMgr.VarAttr(name = EXTERNAL_JOIN_BYTES_THRESHOLD,
+            checker = "checkExternalJoinBytesThreshold", fuzzy = true)
+    public long externalJoinBytesThreshold = 0;
+
+    public static final int MIN_EXTERNAL_JOIN_PARTITION_BITS = 4;
+    public static final int MAX_EXTERNAL_JOIN_PARTITION_BITS = 8;
+    @VariableMgr.VarAttr(name = EXTERNAL_JOIN_PARTITION_BITS,
+            checker = "checkExternalJoinPartitionBits", fuzzy = true)
+    public int externalJoinPartitionBits = 6; // means that the build side will be partitioned into 64 streams.
+
+    // Set to 0 to disable; min: 128M
+    public static final long MIN_EXTERNAL_ANALYTIC_BYTES_THRESHOLD = 134217728;
+    @VariableMgr.VarAttr(name = EXTERNAL_ANALYTIC_BYTES_THRESHOLD,
+            checker = "checkExternalAnalyticBytesThreshold", fuzzy = true)
+    public long externalAnalyticBytesThreshold = 0;
+
+    // Set to 0 to disable; min: 128M
+    public static final long MIN_EXTERNAL_SET_OPERATION_BYTES_THRESHOLD = 134217728;
+    @VariableMgr.VarAttr(name = EXTERNAL_SET_OPERATION_BYTES_THRESHOLD,
+            checker = "checkExternalSetOperationBytesThreshold", fuzzy = true)
+    public long externalSetOperationBytesThreshold = 0;
+
+    // Set to 0 to disable; min: 128M
+    public static final long MIN_EXTERNAL_MULTI_CAST_BYTES_THRESHOLD = 134217728;
+    @VariableMgr.VarAttr(name = EXTERNAL_MULTI_CAST_BYTES_THRESHOLD,
+            checker = "checkExternalMultiCastBytesThreshold", fuzzy = true)
+    public long externalMultiCastBytesThreshold = 0;
+
+    // The rows of a block are reduced to keep the block around this size for wide rows,
+    // set to 0 to always use batch_size rows; min: 64K
+    public static final long MIN_PREFERRED_BLOCK_SIZE_BYTES = 65536;
+    @VariableMgr.VarAttr(name = PREFERRED_BLOCK_SIZE_BYTES, checker = "checkPreferredBlockSizeBytes",
+            fuzzy = true)
+    public long preferredBlockSizeBytes = 8388608;
+
+    // Record the cycles, instructions, LLC misses and branch misses of each operator in the profile,
+    // the backends need the permission of perf_event_open
+    @VariableMgr.VarAttr(name = ENABLE_OPERATOR_PERF_COUNTERS)
+    public boolean enableOperatorPerfCounters = false;
+
     // Whether enable two phase read optimization
     // 1. read related rowids along with necessary column data
     // 2. spawn fetch RPC to other nodes to get related data by sorted rowids
@@ -963,6 +1017,14 @@ public class SessionVariable implements Serializable, Writable {
             needForward = false)
     public int externalTableAnalyzePartNum = -1;
 
+    @VariableMgr.VarAttr(
+            name = JDBC_SCAN_SPLIT_NUM,
+            description = {"JDBC 表按首列的取值范围拆分成的并行扫描数，默认 1 表示不拆分",
+                    "Number of parallel scans that a JDBC table is split into by the range of its first column, "
+                            + "default 1 means no split"},
+            needForward = true)
+    public int jdbcScanSplitNum = 1;
+
     @VariableMgr.VarAttr(
             name = INLINE_CTE_REFERENCED_THRESHOLD
     )
@@ -1003,21 +1065,44 @@ public class SessionVariable implements Serializable, Writable {
             case 0:
                 this.externalSortBytesThreshold = 0;
                 this.externalAggBytesThreshold = 0;
+                this.externalJoinBytesThreshold = 0;
+                this.externalAnalyticBytesThreshold = 0;
+                this.externalSetOperationBytesThreshold = 0;
+                this.externalMultiCastBytesThreshold = 0;
+                this.preferredBlockSizeBytes = 0;
                 break;
             case 1:
                 this.externalSortBytesThreshold = 1;
                 this.externalAggBytesThreshold = 1;
                 this.externalAggPartitionBits = 6;
+                this.externalJoinBytesThreshold = 1;
+                this.externalJoinPartitionBits = 4;
+                this.externalAnalyticBytesThreshold = 1;
+                this.externalSetOperationBytesThreshold = 1;
+                this.externalMultiCastBytesThreshold = 1;
+                this.preferredBlockSizeBytes = 65536;
                 break;
             case 2:
                 this.externalSortBytesThreshold = 1024 * 1024;
                 this.externalAggBytesThreshold = 1024 * 1024;
                 this.externalAggPartitionBits = 8;
+                this.externalJoinBytesThreshold = 1024 * 1024;
+                this.externalJoinPartitionBits = 8;
+                this.externalAnalyticBytesThreshold = 1024 * 1024;
+                this.externalSetOperationBytesThreshold = 1024 * 1024;
+                this.externalMultiCastBytesThreshold = 1024 * 1024;
+                this.preferredBlockSizeBytes = 1024 * 1024;
                 break;
             default:
                 this.externalSortBytesThreshold = 100 * 1024 * 1024 * 1024;
                 this.externalAggBytesThreshold = 100 * 1024 * 1024 * 1024;
                 this.externalAggPartitionBits = 4;
+                this.externalJoinBytesThreshold = 100 * 1024 * 1024 * 1024;
+                this.externalJoinPartitionBits = 6;
+                this.externalAnalyticBytesThreshold = 100 * 1024 * 1024 * 1024;
+                this.externalSetOperationBytesThreshold = 100 * 1024 * 1024 * 1024;
+                this.externalMultiCastBytesThreshold = 100 * 1024 * 1024 * 1024;
+                this.preferredBlockSizeBytes = 8388608;
                 break;
         }
         // pull_request_id default value is 0
@@ -1878,6 +1963,61 @@ public class SessionVariable implements Serializable, Writable {
         }
     }
 
+    public void checkExternalJoinBytesThreshold(String externalJoinBytesThreshold) {
+        long value = Long.valueOf(externalJoinBytesThreshold);
+        if (value > 0 && value < MIN_EXTERNAL_JOIN_BYTES_THRESHOLD) {
+            LOG.warn("external join bytes threshold: {}, min: {}", value, MIN_EXTERNAL_JOIN_BYTES_THRESHOLD);
+            throw new UnsupportedOperationException("minimum value is " + MIN_EXTERNAL_JOIN_BYTES_THRESHOLD);
+        }
+    }
+
+    public void checkExternalJoinPartitionBits(String externalJoinPartitionBits) {
+        int value = Integer.valueOf(externalJoinPartitionBits);
+        if (value < MIN_EXTERNAL_JOIN_PARTITION_BITS || value > MAX_EXTERNAL_JOIN_PARTITION_BITS) {
+            LOG.warn("external join partition bits: {}, min: {}, max: {}",
+                    value, MIN_EXTERNAL_JOIN_PARTITION_BITS, MAX_EXTERNAL_JOIN_PARTITION_BITS);
+            throw new UnsupportedOperationException("min value is " + MIN_EXTERNAL_JOIN_PARTITION_BITS
+                    + " max value is " + MAX_EXTERNAL_JOIN_PARTITION_BITS);
+        }
+    }
+
+    public void checkExternalAnalyticBytesThreshold(String externalAnalyticBytesThreshold) {
+        long value = Long.valueOf(externalAnalyticBytesThreshold);
+        if (value > 0 && value < MIN_EXTERNAL_ANALYTIC_BYTES_THRESHOLD) {
+            LOG.warn("external analytic bytes threshold: {}, min: {}", value,
+                    MIN_EXTERNAL_ANALYTIC_BYTES_THRESHOLD);
+            throw new UnsupportedOperationException("minimum value is " + MIN_EXTERNAL_ANALYTIC_BYTES_THRESHOLD);
+        }
+    }
+
+    public void checkExternalSetOperationBytesThreshold(String externalSetOperationBytesThreshold) {
+        long value = Long.valueOf(externalSetOperationBytesThreshold);
+        if (value > 0 && value < MIN_EXTERNAL_SET_OPERATION_BYTES_THRESHOLD) {
+            LOG.warn("external set operation bytes threshold: {}, min: {}", value,
+                    MIN_EXTERNAL_SET_OPERATION_BYTES_THRESHOLD);
+            throw new UnsupportedOperationException(
+                    "minimum value is " + MIN_EXTERNAL_SET_OPERATION_BYTES_THRESHOLD);
+        }
+    }
+
+    public void checkExternalMultiCastBytesThreshold(String externalMultiCastBytesThreshold) {
+        long value = Long.valueOf(externalMultiCastBytesThreshold);
+        if (value > 0 && value < MIN_EXTERNAL_MULTI_CAST_BYTES_THRESHOLD) {
+            LOG.warn("external multi cast bytes threshold: {}, min: {}", value,
+                    MIN_EXTERNAL_MULTI_CAST_BYTES_THRESHOLD);
+            throw new UnsupportedOperationException(
+                    "minimum value is " + MIN_EXTERNAL_MULTI_CAST_BYTES_THRESHOLD);
+        }
+    }
+
+    public void checkPreferredBlockSizeBytes(String preferredBlockSizeBytes) {
+        long value = Long.valueOf(preferredBlockSizeBytes);
+        if (value > 0 && value < MIN_PREFERRED_BLOCK_SIZE_BYTES) {
+            LOG.warn("preferred block size bytes: {}, min: {}", value, MIN_PREFERRED_BLOCK_SIZE_BYTES);
+            throw new UnsupportedOperationException("minimum value is " + MIN_PREFERRED_BLOCK_SIZE_BYTES);
+        }
+    }
+
     public boolean isEnableFileCache() {
         return enableFileCache;
     }
@@ -1913,6 +2053,10 @@ public class SessionVariable implements Serializable, Writable {
         return externalTableAnalyzePartNum;
     }
 
+    public int getJdbcScanSplitNum() {
+        return jdbcScanSplitNum;
+    }
+
     /**
      * Serialize to thrift object.
      * Used for rest api.
@@ -1984,6 +2128,23 @@ public class SessionVariable implements Serializable, Writable {
 
         tResult.setExternalAggPartitionBits(externalAggPartitionBits);
 
+        tResult.setExternalJoinBytesThreshold(externalJoinBytesThreshold);
+
+        tResult.setExternalJoinPartitionBits(externalJoinPartitionBits);
+
+        tResult.setExternalAnalyticBytesThreshold(externalAnalyticBytesThreshold);
+
+        tResult.setExternalSetOperationBytesThreshold(externalSetOperationBytesThreshold);
+
+        tResult.setExternalMultiCastBytesThreshold(externalMultiCastBytesThreshold);
+
+        tResult.setPreferredBlockSizeBytes(preferredBlockSizeBytes);
+
+        tResult.setEnableOperatorPerfCounters(enableOperatorPerfCounters);
+
+        // rows of the result batches are unpacked in RowBatch
+        tResult.setEnablePackedResultRows(true);
+
         tResult.setEnableFileCache(enableFileCache);
 
         tResult.setFileCacheBasePath(fileCacheBasePath);
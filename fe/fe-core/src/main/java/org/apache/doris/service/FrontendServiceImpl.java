@@ -1711,9 +1711,16 @@ public class FrontendServiceImpl implements FrontendService.Iface {
             multiTableFragmentInstanceIdIndexMap.putIfAbsent(request.getTxnId(), 1);
             for (OlapTable table : olapTables) {
                 int index = multiTableFragmentInstanceIdIndexMap.get(request.getTxnId());
-                TExecPlanFragmentParams planFragmentParams = generatePlanFragmentParams(request, db, fullDbName,
-                        table, timeoutMs, index);
-                planFragmentParamsList.add(planFragmentParams);
+                Long cachedSignature = request.isSetTablePlanSignatures()
+                        ? request.getTablePlanSignatures().get(table.getName()) : null;
+                if (cachedSignature != null
+                        && reuseCachedPlan(request, db, fullDbName, table, timeoutMs, cachedSignature)) {
+                    result.putToCachedPlanInstanceIndexes(table.getName(), index);
+                } else {
+                    TExecPlanFragmentParams planFragmentParams = generatePlanFragmentParams(request, db,
+                            fullDbName, table, timeoutMs, index);
+                    planFragmentParamsList.add(planFragmentParams);
+                }
                 multiTableFragmentInstanceIdIndexMap.put(request.getTxnId(), ++index);
             }
             Env.getCurrentGlobalTransactionMgr().getDatabaseTransactionMgr(db.getId())
@@ -1777,12 +1784,39 @@ public class FrontendServiceImpl implements FrontendService.Iface {
             }
             txnState.addTableIndexes(table);
             plan.setTableName(table.getName());
+            if (request.isSetTableNames()) {
+                plan.setPlanSignature(StreamLoadPlanner.getPlanSignature(table));
+            }
             return plan;
         } finally {
             table.readUnlock();
         }
     }
 
+    // Returns true if the plan of the table cached by the BE is still valid, in which case the table is
+    // added to the transaction as if it was planned again.
+    private boolean reuseCachedPlan(TStreamLoadPutRequest request, Database db, String fullDbName,
+                                    OlapTable table, long timeoutMs, long cachedSignature) throws UserException {
+        if (!table.tryReadLock(timeoutMs, TimeUnit.MILLISECONDS)) {
+            throw new UserException(
+                    "get table read lock timeout, database=" + fullDbName + ",table=" + table.getName());
+        }
+        try {
+            if (StreamLoadPlanner.getPlanSignature(table) != cachedSignature) {
+                return false;
+            }
+            TransactionState txnState = Env.getCurrentGlobalTransactionMgr()
+                    .getTransactionState(db.getId(), request.getTxnId());
+            if (txnState == null) {
+                throw new UserException("txn does not exist: " + request.getTxnId());
+            }
+            txnState.addTableIndexes(table);
+            return true;
+        } finally {
+            table.readUnlock();
+        }
+    }
+
     private TPipelineFragmentParams pipelineStreamLoadPutImpl(TStreamLoadPutRequest request) throws UserException {
         String cluster = request.getCluster();
         if (Strings.isNullOrEmpty(cluster)) {
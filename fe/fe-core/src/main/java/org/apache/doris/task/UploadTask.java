@@ -31,6 +31,8 @@ public class UploadTask extends AgentTask {
     private long jobId;
 
     private Map<String, String> srcToDestPath;
+    // the remote path of each tablet in the last backup to the repository
+    private Map<String, String> srcToBasePath;
     private FsBroker broker;
     private Map<String, String> brokerProperties;
     private StorageBackend.StorageType storageType;
@@ -56,6 +58,10 @@ public class UploadTask extends AgentTask {
         return srcToDestPath;
     }
 
+    public void setSrcToBasePath(Map<String, String> srcToBasePath) {
+        this.srcToBasePath = srcToBasePath;
+    }
+
     public FsBroker getBrokerAddress() {
         return broker;
     }
@@ -70,6 +76,9 @@ public class UploadTask extends AgentTask {
         request.setBrokerProp(brokerProperties);
         request.setStorageBackend(storageType.toThrift());
         request.setLocation(location);
+        if (srcToBasePath != null && !srcToBasePath.isEmpty()) {
+            request.setSrcBaseMap(srcToBasePath);
+        }
         return request;
     }
 }
@@ -286,6 +286,8 @@ struct TUploadReq {
     4: optional map<string, string> broker_prop
     5: optional Types.TStorageBackendType storage_backend = Types.TStorageBackendType.BROKER
     6: optional string location // root path
+    // the remote path of each tablet in the last backup to the repository
+    7: optional map<string, string> src_base_map
 }
 
 struct TRemoteTabletSnapshot {
@@ -77,4 +77,11 @@ struct TResultBatch {
   3: required i64 packet_seq
 
   4: optional map<string,string> attached_infos
+
+  // all the rows of the batch one after another, rows is empty then, see
+  // TQueryOptions.enable_packed_result_rows
+  5: optional binary rows_data
+
+  // length of every row in rows_data
+  6: optional list<i32> row_lengths
 }
@@ -41,6 +41,7 @@ enum TDataSinkType {
 enum TResultSinkType {
     MYSQL_PROTOCAL,
     FILE,    // deprecated, should not be used any more. FileResultSink is covered by TRESULT_FILE_SINK for concurrent purpose.
+    ARROW_FLIGHT_PROTOCAL, // arrow batches fetched from the BE by fetch_arrow_data
 }
 
 enum TParquetCompressionType {
@@ -168,6 +169,12 @@ struct TFetchOption {
     3: optional bool fetch_row_store;
     // Fetch schema
     4: optional list<Descriptors.TColumn> column_desc;
+    // The tuple whose slots are fetched by row id, e.g. the probe side of a join whose payload
+    // columns are deferred until the join filters the rows. If it is set, only the columns of
+    // output_slot_ids are replaced, the other columns of the block are kept as is.
+    5: optional Types.TTupleId fetch_tuple_id;
+    // The slots of the sink receiving the slots of fetch tuple, in the same order, row id included
+    6: optional list<Types.TSlotId> output_slot_ids;
 }
 
 struct TResultSink {
@@ -114,7 +114,9 @@ enum TSchemaTableType {
     SCH_INVALID,
     SCH_ROWSETS,
     SCH_BACKENDS,
-    SCH_COLUMN_STATISTICS
+    SCH_COLUMN_STATISTICS,
+    SCH_COMPACTION_HISTORY,
+    SCH_LOAD_CHANNELS
 }
 
 enum THdfsCompression {
@@ -604,6 +604,9 @@ struct TStreamLoadPutRequest {
     44: optional bool enable_profile
     45: optional bool partial_update
     46: optional list<string> table_names
+    // the signatures of the plans of table_names cached by the BE, see plan_signature of
+    // TExecPlanFragmentParams
+    47: optional map<string, i64> table_plan_signatures
 }
 
 struct TStreamLoadPutResult {
@@ -617,6 +620,9 @@ struct TStreamLoadMultiTablePutResult {
     1: required Status.TStatus status
     // valid when status is OK
     2: optional list<PaloInternalService.TExecPlanFragmentParams> params
+    // the tables whose cached plans are still valid, which are not planned again, to the
+    // index of their fragment instance ids
+    3: optional map<string, i32> cached_plan_instance_indexes
 }
 
 struct TKafkaRLTaskProgress {
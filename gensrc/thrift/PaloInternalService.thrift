@@ -225,6 +225,38 @@ struct TQueryOptions {
   74: optional bool enable_scan_node_run_serial = false; 
 
   75: optional bool enable_insert_strict = false;
+
+  // spill the build side of hash join to disk when it takes more memory than this threshold,
+  // 0 means disabled
+  76: optional i64 external_join_bytes_threshold = 0
+
+  // partition count(1 << external_join_partition_bits) when spill hash join data into disk
+  77: optional i32 external_join_partition_bits = 4
+
+  // spill the buffered blocks of analytic node to disk when they take more memory than this
+  // threshold, 0 means disabled
+  78: optional i64 external_analytic_bytes_threshold = 0
+
+  // spill the hash table side of intersect/except to disk when it takes more memory than this
+  // threshold, 0 means disabled
+  79: optional i64 external_set_operation_bytes_threshold = 0
+
+  // the bytes of a block produced by scanners and hash join probe is kept around this by
+  // reducing its rows according to the average row width, never more than batch_size rows,
+  // 0 means disabled
+  80: optional i64 preferred_block_size_bytes = 0
+
+  // the FE splits TResultBatch.rows_data into rows, so the result sink writes the rows of a
+  // block into one buffer instead of one string per row
+  81: optional bool enable_packed_result_rows = false
+
+  // record the hardware counters (cycles, instructions, LLC misses and branch misses) of each
+  // operator in the runtime profile
+  82: optional bool enable_operator_perf_counters = false
+
+  // spill the blocks buffered for the consumers of a multi cast data stream sink (a shared CTE)
+  // to disk when they take more memory than this threshold, 0 means disabled
+  83: optional i64 external_multi_cast_bytes_threshold = 0
 }
 
 
@@ -420,6 +452,15 @@ struct TExecPlanFragmentParams {
 
   22: optional list<Types.TUniqueId> instances_sharing_hash_table;
   23: optional string table_name;
+
+  // If true, the unset fragment and query_options are the same as the ones of the previous
+  // params in the same TExecPlanFragmentParamsList, which is the case of the instances of one
+  // fragment on a BE.
+  24: optional bool is_delta_param = false;
+
+  // The signature of the table metadata a plan of a multi-table load depends on, with which the
+  // BE may reuse the plan for the following loads of the table
+  25: optional i64 plan_signature;
 }
 
 struct TExecPlanFragmentParamsList {
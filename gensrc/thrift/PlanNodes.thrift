@@ -371,6 +371,9 @@ struct TFileScanRangeParams {
     // Map of slot to its position in table schema. Only for Hive external table.
     19: optional map<string, i32> slot_name_to_schema_pos
     20: optional list<Exprs.TExpr> pre_filter_exprs_list
+    // For load, the rows can be written to the table in any order, so the scanners may parse
+    // a stream in parallel.
+    21: optional bool row_order_insensitive
 }
 
 struct TFileRangeDesc {
@@ -481,6 +484,13 @@ struct TJdbcScanNode {
   2: optional string table_name
   3: optional string query_string
   4: optional Types.TOdbcTableType table_type
+  // Split the scan into split_num scanners by the range of split_column, which is got by
+  // split_bounds_query. The range filter of a scanner replaces $SPLIT_CONDITIONS of
+  // split_query_string.
+  5: optional string split_column
+  6: optional i32 split_num
+  7: optional string split_bounds_query
+  8: optional string split_query_string
 }
 
 struct TBrokerScanNode {
@@ -494,6 +504,8 @@ struct TBrokerScanNode {
 
 struct TFileScanNode {
     1: optional Types.TTupleId tuple_id
+    // prune the row groups or stripes by the boundary of the topn above
+    2: optional bool use_topn_opt
 }
 
 struct TEsScanNode {
@@ -1062,6 +1074,10 @@ struct TRuntimeFilterDesc {
   11: optional bool bitmap_filter_not_in
 
   12: optional bool opt_remote_rf;
+
+  // Fingerprint of the build side (scanned tablets with versions, predicates and filter params),
+  // set only if the filter built by one query could be reused by another one.
+  13: optional string cache_key;
 }
 
 struct TDataGenScanNode {